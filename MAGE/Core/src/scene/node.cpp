@@ -13,6 +13,8 @@
 //-----------------------------------------------------------------------------
 namespace mage {
 
+	AtomicBool Node::s_structure_dirty = true;
+
 	Node::Node(std::string name)
 		: m_transform(),
 		m_parent(nullptr),
@@ -59,6 +61,8 @@ namespace mage {
 		ForEachChild([this](Node& node) noexcept {
 			node.m_parent = m_this;
 		});
+
+		SetStructureDirty();
 	}
 
 	//-------------------------------------------------------------------------
@@ -82,6 +86,8 @@ namespace mage {
 		node->m_transform.SetDirty();
 
 		m_childs.push_back(std::move(node));
+
+		SetStructureDirty();
 	}
 
 	void Node::RemoveChild(NodePtr node) {
@@ -96,6 +102,8 @@ namespace mage {
 		node->m_parent = nullptr;
 		node->m_transform.SetDirty();
 
+		SetStructureDirty();
+
 		if (const auto it = std::find(cbegin(m_childs), cend(m_childs), node); 
 			it != cend(m_childs)) {
 
@@ -113,6 +121,8 @@ namespace mage {
 		});
 
 		m_childs.clear();
+
+		SetStructureDirty();
 	}
 
 	//-------------------------------------------------------------------------
@@ -7,6 +7,7 @@
 
 #include "scene\component.hpp"
 #include "scene\transform.hpp"
+#include "parallel\atomic.hpp"
 
 #pragma endregion
 
@@ -47,6 +48,35 @@ namespace mage {
 		 */
 		using ComponentPtr = ProxyPtr< Component >;
 
+		//---------------------------------------------------------------------
+		// Class Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Marks the structure of the scenes (i.e. the node hierarchies and 
+		 the components of the nodes) as changed.
+
+		 This method is thread-safe.
+		 */
+		static void SetStructureDirty() noexcept {
+			s_structure_dirty.store(true, std::memory_order_release);
+		}
+
+		/**
+		 Checks whether the structure of the scenes (i.e. the node 
+		 hierarchies and the components of the nodes) changed since the 
+		 previous call, and marks the structure as unchanged.
+
+		 This method is thread-safe.
+
+		 @return		@c true if the structure of the scenes changed since 
+						the previous call. @c false otherwise.
+		 */
+		[[nodiscard]]
+		static bool ResetStructureDirty() noexcept {
+			return s_structure_dirty.exchange(false, std::memory_order_acq_rel);
+		}
+
 		//---------------------------------------------------------------------
 		// Constructors and Destructors
 		//---------------------------------------------------------------------
@@ -480,6 +510,15 @@ namespace mage {
 
 	private:
 
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A flag indicating whether the structure of the scenes changed.
+		 */
+		static AtomicBool s_structure_dirty;
+
 		//---------------------------------------------------------------------
 		// Member Variables: Transform
 		//---------------------------------------------------------------------
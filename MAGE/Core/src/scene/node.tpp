@@ -24,7 +24,7 @@ namespace mage {
 			// Visit child node.
 			action(*child);
 			// Visit child node's child nodes.
-			child->ForEachDescendantNode(action);
+			child->ForEachDescendant(action);
 		}
 	}
 
@@ -105,6 +105,8 @@ namespace mage {
 		ComponentClient::SetOwner(*component, m_this);
 
 		m_components.emplace(typeid(*component), std::move(component));
+
+		SetStructureDirty();
 	}
 
 	template< typename ComponentT, typename ActionT >
@@ -12,6 +12,8 @@
 //-----------------------------------------------------------------------------
 namespace mage {
 
+	thread_local bool Transform::s_read_snapshots = false;
+
 	void Transform::SetDirty() const noexcept {
 		m_dirty_object_to_world = true;
 		m_dirty_world_to_object = true;
@@ -23,6 +25,14 @@ namespace mage {
 		}
 	}
 
+	void Transform::Snapshot() const noexcept {
+		UpdateObjectToWorldMatrix();
+		UpdateWorldToObjectMatrix();
+		
+		m_snapshot_object_to_world = m_object_to_world;
+		m_snapshot_world_to_object = m_world_to_object;
+	}
+
 	void Transform::UpdateObjectToWorldMatrix() const noexcept {
 		if (m_dirty_object_to_world) {
 			m_dirty_object_to_world = false;
@@ -40,6 +40,8 @@ namespace mage {
 			: m_transform(),
 			m_object_to_world(),
 			m_world_to_object(),
+			m_snapshot_object_to_world(),
+			m_snapshot_world_to_object(),
 			m_dirty_object_to_world(true),
 			m_dirty_world_to_object(true),
 			m_owner() {}
@@ -54,6 +56,8 @@ namespace mage {
 			: m_transform(transform.m_transform),
 			m_object_to_world(),
 			m_world_to_object(),
+			m_snapshot_object_to_world(),
+			m_snapshot_world_to_object(),
 			m_dirty_object_to_world(true),
 			m_dirty_world_to_object(true),
 			m_owner() {}
@@ -1203,6 +1207,10 @@ namespace mage {
 		 */
 		[[nodiscard]]
 		const XMMATRIX XM_CALLCONV GetObjectToWorldMatrix() const noexcept {
+			if (s_read_snapshots) {
+				return m_snapshot_object_to_world;
+			}
+
 			UpdateObjectToWorldMatrix();
 			return m_object_to_world;
 		}
@@ -1214,6 +1222,10 @@ namespace mage {
 		 */
 		[[nodiscard]]
 		const XMMATRIX XM_CALLCONV GetWorldToObjectMatrix() const noexcept {
+			if (s_read_snapshots) {
+				return m_snapshot_world_to_object;
+			}
+
 			UpdateWorldToObjectMatrix();
 			return m_world_to_object;
 		}
@@ -1462,6 +1474,36 @@ namespace mage {
 
 		#pragma endregion
 
+		//---------------------------------------------------------------------
+		// Member Methods: Snapshot
+		//---------------------------------------------------------------------
+		#pragma region
+
+		/**
+		 Takes a snapshot of the object-to-world and world-to-object matrices 
+		 of this transform.
+
+		 @pre			This transform must have an owner.
+		 */
+		void Snapshot() const noexcept;
+
+		/**
+		 Sets whether the calling thread reads the snapshot instead of the 
+		 current object-to-world and world-to-object matrices of transforms 
+		 (e.g., a render thread rendering the previous frame while the 
+		 transforms are updated for the current frame).
+
+		 @param[in]		read_snapshots
+						@c true if the calling thread reads the snapshot of 
+						the object-to-world and world-to-object matrices of 
+						transforms. @c false otherwise.
+		 */
+		static void ReadSnapshots(bool read_snapshots) noexcept {
+			s_read_snapshots = read_snapshots;
+		}
+
+		#pragma endregion
+
 	private:
 
 		//---------------------------------------------------------------------
@@ -1502,6 +1544,17 @@ namespace mage {
 
 		#pragma endregion
 
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A flag indicating whether the calling thread reads the snapshot 
+		 instead of the current object-to-world and world-to-object matrices 
+		 of transforms.
+		 */
+		static thread_local bool s_read_snapshots;
+
 		//---------------------------------------------------------------------
 		// Member Variables
 		//---------------------------------------------------------------------
@@ -1521,6 +1574,16 @@ namespace mage {
 		 */
 		mutable XMMATRIX m_world_to_object;
 
+		/**
+		 The snapshot of the object-to-world matrix of this transform.
+		 */
+		mutable XMMATRIX m_snapshot_object_to_world;
+
+		/**
+		 The snapshot of the world-to-object matrix of this transform.
+		 */
+		mutable XMMATRIX m_snapshot_world_to_object;
+
 		/**
 		 A flag indicating whether the object-to-world matrix of this transform 
 		 is dirty.
@@ -1,5 +1,151 @@
+#include "samples\brdf\brdf_scene.hpp"
+#include "samples\cornell\cornell_scene.hpp"
+#include "samples\forrest\forrest_scene.hpp"
+#include "samples\scripts\scripts_scene.hpp"
+#include "samples\sibenik\sibenik_scene.hpp"
 #include "samples\sponza\sponza_scene.hpp"
 
+#include <shellapi.h>
+
+namespace {
+
+	/**
+	 A struct of demo options.
+	 */
+	struct DemoOptions final {
+
+	public:
+
+		/**
+		 The name of the start scene.
+		 */
+		std::wstring m_scene = L"sponza";
+
+		/**
+		 A flag indicating whether the models of the start scene use levels 
+		 of detail.
+		 */
+		bool m_lods = true;
+
+		/**
+		 A flag indicating whether the start scene bakes and exports its 
+		 precomputed visibility and lighting data instead of loading it.
+		 */
+		bool m_bake = false;
+	};
+
+	/**
+	 Creates the start scene of the given demo options.
+
+	 @param[in]		options
+					A reference to the demo options.
+	 @return		A pointer to the start scene. The sponza scene if no 
+					scene has the name of the start scene.
+	 */
+	[[nodiscard]]
+	mage::UniquePtr< mage::Scene > CreateScene(const DemoOptions& options) {
+		using namespace mage;
+
+		const std::wstring_view name(options.m_scene);
+
+		if (L"brdf" == name) {
+			return MakeUnique< BRDFScene >();
+		}
+		if (L"cornell" == name) {
+			return MakeUnique< CornellScene >();
+		}
+		if (L"forrest" == name) {
+			return MakeUnique< ForrestScene >(options.m_lods);
+		}
+		if (L"scripts" == name) {
+			return MakeUnique< ScriptsScene >();
+		}
+		if (L"sibenik" == name) {
+			return MakeUnique< SibenikScene >(options.m_bake);
+		}
+
+		return MakeUnique< SponzaScene >(options.m_lods);
+	}
+
+	/**
+	 Applies the command line arguments to the given engine setup.
+
+	 Supported arguments:
+	 @c -headless,
+	 @c -record <file>,
+	 @c -replay <file>,
+	 @c -benchmark <frames> <file>,
+	 @c -fps <rate>,
+	 @c -background-fps <rate>,
+	 @c -parallel-scripts,
+	 @c -pipelined,
+	 @c -record-commands,
+	 @c -no-lod,
+	 @c -bake and
+	 @c -scene <name>.
+
+	 @param[in,out]	setup
+					A reference to the engine setup.
+	 @return		The demo options.
+	 */
+	[[nodiscard]]
+	const DemoOptions ParseCommandLine(mage::EngineSetup& setup) {
+		DemoOptions options;
+
+		int argc = 0;
+		const auto argv = CommandLineToArgvW(GetCommandLineW(), &argc);
+		if (!argv) {
+			return options;
+		}
+
+		for (int i = 1; i < argc; ++i) {
+			const std::wstring_view arg(argv[i]);
+
+			if (L"-headless" == arg) {
+				setup.SetHeadless(true);
+			}
+			else if (L"-record" == arg && i + 1 < argc) {
+				setup.SetInputRecordingPath(argv[++i]);
+			}
+			else if (L"-replay" == arg && i + 1 < argc) {
+				setup.SetInputReplayPath(argv[++i]);
+			}
+			else if (L"-benchmark" == arg && i + 2 < argc) {
+				const auto nb_frames = static_cast< mage::U32 >(_wtoi(argv[++i]));
+				setup.SetBenchmark(argv[++i], nb_frames);
+			}
+			else if (L"-fps" == arg && i + 1 < argc) {
+				setup.SetTargetFrameRate(_wtof(argv[++i]));
+			}
+			else if (L"-background-fps" == arg && i + 1 < argc) {
+				setup.SetBackgroundFrameRate(_wtof(argv[++i]));
+			}
+			else if (L"-parallel-scripts" == arg) {
+				setup.SetParallelScripts(true);
+			}
+			else if (L"-pipelined" == arg) {
+				setup.SetPipelinedRendering(true);
+			}
+			else if (L"-record-commands" == arg) {
+				setup.SetCommandRecording(true);
+			}
+			else if (L"-no-lod" == arg) {
+				options.m_lods = false;
+			}
+			else if (L"-bake" == arg) {
+				options.m_bake = true;
+			}
+			else if (L"-scene" == arg && i + 1 < argc) {
+				options.m_scene = argv[++i];
+			}
+		}
+
+		LocalFree(argv);
+
+		return options;
+	}
+}
+
 /**
  The user-provided entry point for MAGE.
 
@@ -23,12 +169,13 @@ int WINAPI WinMain(HINSTANCE instance, HINSTANCE, LPSTR, int nCmdShow) {
 	// Create the engine setup.
 	const auto not_null_instance = NotNull< HINSTANCE >(instance);
 	EngineSetup setup(not_null_instance);
+	const auto options = ParseCommandLine(setup);
 	
 	// Create the engine.
 	UniquePtr< Engine > engine = CreateEngine(setup);
 	if (engine) {
 		// Run the engine.
-		return engine->Run(MakeUnique< SponzaScene >(), nCmdShow);
+		return engine->Run(CreateScene(options), nCmdShow);
 	}
 
 	return 0;
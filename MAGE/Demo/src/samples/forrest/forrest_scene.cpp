@@ -14,6 +14,7 @@
 #pragma region
 
 #include "resource\texture\texture_factory.hpp"
+#include "parallel\parallel.hpp"
 
 #include "character_motor_script.hpp"
 #include "mouse_look_script.hpp"
@@ -29,8 +30,9 @@
 //-----------------------------------------------------------------------------
 namespace mage {
 
-	ForrestScene::ForrestScene()
-		: Scene("forrest_scene") {}
+	ForrestScene::ForrestScene(bool lods)
+		: Scene("forrest_scene"), 
+		m_lods(lods) {}
 
 	ForrestScene::ForrestScene(ForrestScene&& scene) = default;
 
@@ -48,41 +50,57 @@ namespace mage {
 		//---------------------------------------------------------------------
 		// Resources
 		//---------------------------------------------------------------------
-		MeshDescriptor< VertexPositionNormalTexture > mesh_desc(true, true);
+		MeshDescriptor< VertexPositionNormalTexture > mesh_desc(
+			true, true, LODDescriptor(m_lods ? 3u : 0u));
 
-		const auto plane_model_desc 
-			= rendering_factory.GetOrCreate< ModelDescriptor >(
+		// Request all resources first, so that they are imported in parallel.
+		const auto plane_model_desc_future
+			= rendering_factory.GetOrCreateAsync< ModelDescriptor >(
 				L"assets/models/plane/plane.obj", mesh_desc);
-		const auto tree1_model_desc 
-			= rendering_factory.GetOrCreate< ModelDescriptor >(
+		const auto tree1_model_desc_future
+			= rendering_factory.GetOrCreateAsync< ModelDescriptor >(
 				L"assets/models/tree/tree1a_lod0.mdl", mesh_desc);
-		const auto tree2_model_desc 
-			= rendering_factory.GetOrCreate< ModelDescriptor >(
+		const auto tree2_model_desc_future
+			= rendering_factory.GetOrCreateAsync< ModelDescriptor >(
 				L"assets/models/tree/tree1b_lod0.mdl", mesh_desc);
-		const auto tree3_model_desc 
-			= rendering_factory.GetOrCreate< ModelDescriptor >(
+		const auto tree3_model_desc_future
+			= rendering_factory.GetOrCreateAsync< ModelDescriptor >(
 				L"assets/models/tree/tree2a_lod0.mdl", mesh_desc);
-		const auto tree4_model_desc 
-			= rendering_factory.GetOrCreate< ModelDescriptor >(
+		const auto tree4_model_desc_future
+			= rendering_factory.GetOrCreateAsync< ModelDescriptor >(
 				L"assets/models/tree/tree2b_lod0.mdl", mesh_desc);
-		const auto tree5_model_desc 
-			= rendering_factory.GetOrCreate< ModelDescriptor >(
+		const auto tree5_model_desc_future
+			= rendering_factory.GetOrCreateAsync< ModelDescriptor >(
 				L"assets/models/tree/tree3a_lod0.mdl", mesh_desc);
-		const auto tree6_model_desc 
-			= rendering_factory.GetOrCreate< ModelDescriptor >(
+		const auto tree6_model_desc_future
+			= rendering_factory.GetOrCreateAsync< ModelDescriptor >(
 				L"assets/models/tree/tree3b_lod0.mdl", mesh_desc);
-		const auto tree7_model_desc 
-			= rendering_factory.GetOrCreate< ModelDescriptor >(
+		const auto tree7_model_desc_future
+			= rendering_factory.GetOrCreateAsync< ModelDescriptor >(
 				L"assets/models/tree/tree4a_lod0.mdl", mesh_desc);
-		const auto tree8_model_desc 
-			= rendering_factory.GetOrCreate< ModelDescriptor >(
+		const auto tree8_model_desc_future
+			= rendering_factory.GetOrCreateAsync< ModelDescriptor >(
 				L"assets/models/tree/tree4b_lod0.mdl", mesh_desc);
-		const auto windmill_model_desc 
-			= rendering_factory.GetOrCreate< ModelDescriptor >(
+		const auto windmill_model_desc_future
+			= rendering_factory.GetOrCreateAsync< ModelDescriptor >(
 				L"assets/models/windmill/windmill.mdl", mesh_desc);
-		const auto sky_texture
-			= rendering_factory.GetOrCreate< Texture >(
+		const auto sky_texture_future
+			= rendering_factory.GetOrCreateAsync< Texture >(
 				L"assets/textures/sky/sky.dds");
+
+		// Wait for all resources, helping the worker threads meanwhile.
+		const auto plane_model_desc    = WaitFor(plane_model_desc_future);
+		const auto tree1_model_desc    = WaitFor(tree1_model_desc_future);
+		const auto tree2_model_desc    = WaitFor(tree2_model_desc_future);
+		const auto tree3_model_desc    = WaitFor(tree3_model_desc_future);
+		const auto tree4_model_desc    = WaitFor(tree4_model_desc_future);
+		const auto tree5_model_desc    = WaitFor(tree5_model_desc_future);
+		const auto tree6_model_desc    = WaitFor(tree6_model_desc_future);
+		const auto tree7_model_desc    = WaitFor(tree7_model_desc_future);
+		const auto tree8_model_desc    = WaitFor(tree8_model_desc_future);
+		const auto windmill_model_desc = WaitFor(windmill_model_desc_future);
+		const auto sky_texture         = WaitFor(sky_texture_future);
+
 		const auto logo_texture = CreateMAGETexture(rendering_factory);
 
 		//---------------------------------------------------------------------
@@ -18,7 +18,7 @@ namespace mage {
 
 	public:
 
-		ForrestScene();
+		explicit ForrestScene(bool lods = true);
 
 		ForrestScene(const ForrestScene& scene) = delete;
 
@@ -33,5 +33,7 @@ namespace mage {
 	private:
 
 		virtual void Load([[maybe_unused]] Engine& engine) override;
+
+		bool m_lods;
 	};
 }
\ No newline at end of file
@@ -0,0 +1,82 @@
+//-----------------------------------------------------------------------------
+// Game Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "samples\scripts\scripts_scene.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "editor_script.hpp"
+#include "rotation_script.hpp"
+#include "stats_script.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Game Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	ScriptsScene::ScriptsScene(size_t nb_scripts)
+		: Scene("scripts_scene"),
+		m_nb_scripts(nb_scripts) {}
+
+	ScriptsScene::ScriptsScene(ScriptsScene&& scene) = default;
+
+	ScriptsScene::~ScriptsScene() = default;
+
+	void ScriptsScene::Load([[maybe_unused]] Engine& engine) {
+		using namespace rendering;
+
+		auto& rendering_world = engine.GetRenderingManager().GetWorld();
+
+		//---------------------------------------------------------------------
+		// Cameras
+		//---------------------------------------------------------------------
+		const auto camera = rendering_world.Create< PerspectiveCamera >();
+
+		const auto camera_node = Create< Node >("Player");
+		camera_node->Add(camera);
+
+		//---------------------------------------------------------------------
+		// Nodes
+		//---------------------------------------------------------------------
+		// Each node forms its own node hierarchy, so all rotation scripts can 
+		// be updated in parallel.
+		static constexpr script::RotationScript::RotationAxis axes[] = {
+			script::RotationScript::RotationAxis::X,
+			script::RotationScript::RotationAxis::Y,
+			script::RotationScript::RotationAxis::Z
+		};
+
+		for (size_t i = 0u; i < m_nb_scripts; ++i) {
+			const auto node   = Create< Node >("Rotating Node");
+			const auto script = Create< script::RotationScript >();
+			script->SetRotationAxis(axes[i % std::size(axes)]);
+			node->Add(script);
+			node->GetTransform().SetTranslation(static_cast< F32 >(i % 100u), 
+												0.0f, 
+												static_cast< F32 >(i / 100u));
+		}
+
+		//---------------------------------------------------------------------
+		// Sprites
+		//---------------------------------------------------------------------
+		const auto text = rendering_world.Create< SpriteText >();
+
+		camera_node->Add(text);
+
+		//---------------------------------------------------------------------
+		// Scripts
+		//---------------------------------------------------------------------
+		Create< script::EditorScript >();
+
+		camera_node->Add(Create< script::StatsScript >());
+	}
+}
\ No newline at end of file
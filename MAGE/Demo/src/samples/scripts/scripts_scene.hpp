@@ -0,0 +1,43 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "scene\scene.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Game Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 A class of scripts scenes for measuring the scaling of the behavior 
+	 script updates (e.g., with and without parallel scripts).
+	 */
+	class ScriptsScene : public Scene {
+
+	public:
+
+		explicit ScriptsScene(size_t nb_scripts = 10000u);
+
+		ScriptsScene(const ScriptsScene& scene) = delete;
+
+		ScriptsScene(ScriptsScene&& scene);
+
+		virtual ~ScriptsScene();
+
+		ScriptsScene& operator=(const ScriptsScene& scene) = delete;
+
+		ScriptsScene& operator=(ScriptsScene&& scene) = delete;
+
+	private:
+
+		virtual void Load([[maybe_unused]] Engine& engine) override;
+
+		size_t m_nb_scripts;
+	};
+}
\ No newline at end of file
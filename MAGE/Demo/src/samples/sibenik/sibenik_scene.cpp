@@ -14,6 +14,12 @@
 #pragma region
 
 #include "resource\texture\texture_factory.hpp"
+#include "renderer\culling\pvs_baker.hpp"
+#include "loaders\pvs\pvs_loader.hpp"
+#include "renderer\probe\probe_baker.hpp"
+#include "loaders\prb\prb_loader.hpp"
+#include "renderer\voxelization\voxelizer.hpp"
+#include "loaders\vxb\vxb_loader.hpp"
 
 #include "character_motor_script.hpp"
 #include "mouse_look_script.hpp"
@@ -24,13 +30,23 @@
 
 #pragma endregion
 
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <filesystem>
+
+#pragma endregion
+
 //-----------------------------------------------------------------------------
 // Game Definitions
 //-----------------------------------------------------------------------------
 namespace mage {
 
-	SibenikScene::SibenikScene()
-		: Scene("sibenik_scene") {}
+	SibenikScene::SibenikScene(bool bake)
+		: Scene("sibenik_scene"), 
+		m_bake(bake) {}
 
 	SibenikScene::SibenikScene(SibenikScene&& scene) = default;
 
@@ -79,6 +95,25 @@ namespace mage {
 		sibenik_node->GetTransform().SetScale(30.0f);
 		sibenik_node->GetTransform().SetTranslationY(12.1f);
 
+		// The cathedral is static; the rotating tree is not.
+		const auto nb_static_models = rendering_world.MakeStatic(*sibenik_node);
+
+		// Load the prebaked potentially visible set of the cathedral (baked 
+		// offline with -bake).
+		{
+			const std::filesystem::path pvs_path 
+				= L"assets/models/sibenik/sibenik.pvs";
+			if (m_bake) {
+				rendering_world.GetPVS() 
+					= BakePVS(rendering_world, PVSDescriptor(2.0f));
+				loader::ExportPVSToFile(pvs_path, rendering_world.GetPVS());
+			}
+			else if (std::filesystem::exists(pvs_path)) {
+				loader::ImportPVSFromFile(pvs_path, rendering_world.GetPVS(), 
+										  nb_static_models);
+			}
+		}
+
 		const auto tree_node = Import(engine, *tree_model_desc_tree);
 		tree_node->GetTransform().SetScale(5.0f);
 		tree_node->GetTransform().AddTranslationY(2.5f);
@@ -95,6 +130,51 @@ namespace mage {
 		omni_light_node->Add(omni_light);
 		omni_light_node->GetTransform().SetTranslationY(7.0f);
 
+		// Load the prebaked irradiance volume of the cathedral used by the 
+		// non-VCT render modes (baked offline with -bake).
+		{
+			const std::filesystem::path prb_path 
+				= L"assets/models/sibenik/sibenik.prb";
+			if (m_bake) {
+				rendering_world.GetIrradianceVolume() 
+					= BakeIrradianceVolume(rendering_world, 
+										   ProbeBakerDescriptor(2.0f));
+				loader::ExportIrradianceVolumeToFile(prb_path, 
+					rendering_world.GetIrradianceVolume());
+			}
+			else if (std::filesystem::exists(prb_path)) {
+				loader::ImportIrradianceVolumeFromFile(prb_path, 
+					rendering_world.GetIrradianceVolume());
+			}
+		}
+
+		// Load the prebaked voxel grid of the cathedral used by the VCT 
+		// render modes instead of voxelizing the cathedral every frame 
+		// (baked offline with -bake).
+		{
+			const std::filesystem::path vxb_path 
+				= L"assets/models/sibenik/sibenik.vxb";
+			SparseVoxelGrid grid;
+			if (m_bake) {
+				const VoxelizerDescriptor desc(
+					VoxelizationSettings::GetVoxelGridCenter(), 
+					VoxelizationSettings::GetVoxelGridResolution(), 
+					VoxelizationSettings::GetVoxelSize());
+				grid = Voxelize(rendering_world, desc);
+				loader::ExportSparseVoxelGridToFile(vxb_path, grid);
+			}
+			else if (std::filesystem::exists(vxb_path)) {
+				loader::ImportSparseVoxelGridFromFile(vxb_path, grid);
+			}
+
+			if (!grid.empty()) {
+				VoxelizationSettings::SetBakedVoxelGrid(
+					MakeShared< const SparseVoxelGrid >(std::move(grid)));
+			}
+		}
+
+		// The flashlight moves with the player, so it is created after baking 
+		// (the baking scenes include all active lights).
 		const auto spot_light = rendering_world.Create< SpotLight >();
 		spot_light->SetRange(15.0f);
 		spot_light->SetAngularCutoff(1.0f, 0.5f);
@@ -129,4 +209,9 @@ namespace mage {
 		camera_node->Add(Create< script::CharacterMotorScript >());
 		tree_node->Add(Create< script::RotationScript >());
 	}
+
+	void SibenikScene::Close([[maybe_unused]] Engine& engine) {
+		// The baked voxel grid only covers the cathedral.
+		rendering::VoxelizationSettings::SetBakedVoxelGrid(nullptr);
+	}
 }
\ No newline at end of file
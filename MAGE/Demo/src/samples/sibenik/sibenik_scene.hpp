@@ -18,7 +18,7 @@ namespace mage {
 
 	public:
 
-		SibenikScene();
+		explicit SibenikScene(bool bake = false);
 
 		SibenikScene(const SibenikScene& scene) = delete;
 
@@ -33,5 +33,9 @@ namespace mage {
 	private:
 
 		virtual void Load([[maybe_unused]] Engine& engine) override;
+
+		virtual void Close([[maybe_unused]] Engine& engine) override;
+
+		bool m_bake;
 	};
 }
\ No newline at end of file
@@ -29,8 +29,9 @@
 //-----------------------------------------------------------------------------
 namespace mage {
 
-	SponzaScene::SponzaScene()
-		: Scene("sponza_scene") {}
+	SponzaScene::SponzaScene(bool lods)
+		: Scene("sponza_scene"), 
+		m_lods(lods) {}
 
 	SponzaScene::SponzaScene(SponzaScene&& scene) = default;
 
@@ -48,7 +49,8 @@ namespace mage {
 		//---------------------------------------------------------------------
 		// Resources
 		//---------------------------------------------------------------------
-		MeshDescriptor< VertexPositionNormalTexture > mesh_desc(true, true);
+		MeshDescriptor< VertexPositionNormalTexture > mesh_desc(
+			true, true, LODDescriptor(m_lods ? 3u : 0u), true);
 		
 		const auto sponza_model_desc
 			= rendering_factory.GetOrCreate< ModelDescriptor >(
@@ -67,6 +69,7 @@ namespace mage {
 		const auto camera = rendering_world.Create< PerspectiveCamera >();
 		camera->GetSettings().GetFog().SetDensity(0.001f);
 		camera->GetSettings().GetSky().SetTexture(sky_texture);
+		camera->GetSettings().SetOcclusionCulling(true);
 		
 		const auto camera_node = Create< Node >("Player");
 		camera_node->Add(camera);
@@ -78,6 +81,12 @@ namespace mage {
 		const auto sponza_node = Import(engine, *sponza_model_desc);
 		sponza_node->GetTransform().SetScale(10.0f);
 		sponza_node->GetTransform().SetTranslationY(2.1f);
+		// The opaque architecture of Sponza occludes the other models.
+		rendering_world.ForEach< Model >([](Model& model) noexcept {
+			if (!model.GetMaterial().IsTransparant()) {
+				model.EnableGeometryOcclusion();
+			}
+		});
 		
 		const auto tree_node = Import(engine, *tree_model_desc_tree);
 		tree_node->GetTransform().AddTranslationY(1.0f);
@@ -18,7 +18,7 @@ namespace mage {
 
 	public:
 
-		SponzaScene();
+		explicit SponzaScene(bool lods = true);
 
 		SponzaScene(const SponzaScene& scene) = delete;
 
@@ -33,5 +33,7 @@ namespace mage {
 	private:
 
 		virtual void Load([[maybe_unused]] Engine& engine) override;
+
+		bool m_lods;
 	};
 }
\ No newline at end of file
@@ -104,6 +104,23 @@ namespace mage::input {
 		 */
 		void Update() noexcept;
 
+		/**
+		 Updates the state of this keyboard to the given state instead of 
+		 polling the keyboard device (e.g., for replaying recorded input).
+
+		 @param[in]		state
+						A reference to the keyboard state.
+		 */
+		void Update(const KeyboardState& state) noexcept;
+
+		/**
+		 Returns the state of this keyboard.
+
+		 @return		The state of this keyboard.
+		 */
+		[[nodiscard]]
+		const KeyboardState GetState() const noexcept;
+
 		/**
 		 Checks whether the given key of this keyboard is pressed.
 
@@ -279,6 +296,21 @@ namespace mage::input {
 		++m_press_stamp;
 	}
 
+	void Keyboard::Impl::Update(const KeyboardState& state) noexcept {
+		static_assert(sizeof(m_key_state) == sizeof(state.m_keys));
+		memcpy(m_key_state, state.m_keys, sizeof(m_key_state));
+
+		// Increment the press stamp.
+		++m_press_stamp;
+	}
+
+	[[nodiscard]]
+	const KeyboardState Keyboard::Impl::GetState() const noexcept {
+		KeyboardState state;
+		memcpy(state.m_keys, m_key_state, sizeof(m_key_state));
+		return state;
+	}
+
 	#pragma endregion
 
 	//-------------------------------------------------------------------------
@@ -302,6 +334,15 @@ namespace mage::input {
 		return m_impl->Update();
 	}
 
+	void Keyboard::Update(const KeyboardState& state) noexcept {
+		return m_impl->Update(state);
+	}
+
+	[[nodiscard]]
+	const KeyboardState Keyboard::GetState() const noexcept {
+		return m_impl->GetState();
+	}
+
 	bool Keyboard::GetKeyPress(unsigned char key,
 							   bool ignore_press_stamp) const noexcept {
 		
@@ -14,6 +14,19 @@
 // Engine Declarations
 //-----------------------------------------------------------------------------
 namespace mage::input {
+
+	/**
+	 A struct of keyboard states.
+	 */
+	struct KeyboardState final {
+
+	public:
+
+		/**
+		 The state of the key buttons of this keyboard state.
+		 */
+		U8 m_keys[256] = {};
+	};
 	
 	/**
 	 A class of keyboards.
@@ -99,6 +112,23 @@ namespace mage::input {
 		 */
 		void Update() noexcept;
 
+		/**
+		 Updates the state of this keyboard to the given state instead of 
+		 polling the keyboard device (e.g., for replaying recorded input).
+
+		 @param[in]		state
+						A reference to the keyboard state.
+		 */
+		void Update(const KeyboardState& state) noexcept;
+
+		/**
+		 Returns the state of this keyboard.
+
+		 @return		The state of this keyboard.
+		 */
+		[[nodiscard]]
+		const KeyboardState GetState() const noexcept;
+
 		/**
 		 Checks whether the given key of this keyboard is pressed.
 
@@ -131,6 +131,23 @@ namespace mage::input {
 		 */
 		void Update() noexcept;
 
+		/**
+		 Updates the state of this mouse to the given state instead of 
+		 polling the mouse device (e.g., for replaying recorded input).
+
+		 @param[in]		state
+						A reference to the mouse state.
+		 */
+		void Update(const MouseState& state) noexcept;
+
+		/**
+		 Returns the state of this mouse.
+
+		 @return		The state of this mouse.
+		 */
+		[[nodiscard]]
+		const MouseState GetState() const noexcept;
+
 		/**
 		 Checks whether the given mouse button of this mouse is pressed.
 
@@ -386,6 +403,31 @@ namespace mage::input {
 		++m_press_stamp;
 	}
 
+	void Mouse::Impl::Update(const MouseState& state) noexcept {
+		m_button_state.lX = static_cast< LONG >(state.m_delta[0]);
+		m_button_state.lY = static_cast< LONG >(state.m_delta[1]);
+		m_button_state.lZ = static_cast< LONG >(state.m_delta_wheel);
+		static_assert(sizeof(m_button_state.rgbButtons) == sizeof(state.m_buttons));
+		memcpy(m_button_state.rgbButtons, state.m_buttons, 
+			   sizeof(m_button_state.rgbButtons));
+		
+		m_position = state.m_position;
+
+		// Increment the press stamp.
+		++m_press_stamp;
+	}
+
+	[[nodiscard]]
+	const MouseState Mouse::Impl::GetState() const noexcept {
+		MouseState state;
+		state.m_position    = m_position;
+		state.m_delta       = GetDelta();
+		state.m_delta_wheel = GetDeltaWheel();
+		memcpy(state.m_buttons, m_button_state.rgbButtons, 
+			   sizeof(state.m_buttons));
+		return state;
+	}
+
 	#pragma endregion
 
 	//-------------------------------------------------------------------------
@@ -409,6 +451,15 @@ namespace mage::input {
 		m_impl->Update();
 	}
 
+	void Mouse::Update(const MouseState& state) noexcept {
+		m_impl->Update(state);
+	}
+
+	[[nodiscard]]
+	const MouseState Mouse::GetState() const noexcept {
+		return m_impl->GetState();
+	}
+
 	bool Mouse::GetMouseButtonPress(char button, 
 									bool ignore_press_stamp) const noexcept {
 
@@ -15,6 +15,35 @@
 //-----------------------------------------------------------------------------
 namespace mage::input {
 
+	/**
+	 A struct of mouse states.
+	 */
+	struct MouseState final {
+
+	public:
+
+		/**
+		 The position of the mouse cursor (expressed in client-area 
+		 coordinates) of this mouse state.
+		 */
+		S32x2 m_position = {};
+
+		/**
+		 The change in the coordinates of this mouse state.
+		 */
+		S32x2 m_delta = {};
+
+		/**
+		 The change in the scroll wheel of this mouse state.
+		 */
+		S32 m_delta_wheel = 0;
+
+		/**
+		 The state of the mouse buttons of this mouse state.
+		 */
+		U8 m_buttons[4] = {};
+	};
+
 	/**
 	 A class of mouses.
 	 */
@@ -99,6 +128,23 @@ namespace mage::input {
 		 */
 		void Update() noexcept;
 
+		/**
+		 Updates the state of this mouse to the given state instead of 
+		 polling the mouse device (e.g., for replaying recorded input).
+
+		 @param[in]		state
+						A reference to the mouse state.
+		 */
+		void Update(const MouseState& state) noexcept;
+
+		/**
+		 Returns the state of this mouse.
+
+		 @return		The state of this mouse.
+		 */
+		[[nodiscard]]
+		const MouseState GetState() const noexcept;
+
 		/**
 		 Checks whether the given mouse button of this mouse is pressed.
 
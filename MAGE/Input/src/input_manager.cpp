@@ -108,6 +108,23 @@ namespace mage::input {
 			m_mouse->Update();
 		}
 
+		/**
+		 Updates the state of the input systems of this input manager to the 
+		 given states instead of polling the input devices (e.g., for 
+		 replaying recorded input).
+
+		 @param[in]		keyboard
+						A reference to the keyboard state.
+		 @param[in]		mouse
+						A reference to the mouse state.
+		 */
+		void Update(const KeyboardState& keyboard, 
+					const MouseState& mouse) noexcept {
+
+			m_keyboard->Update(keyboard);
+			m_mouse->Update(mouse);
+		}
+
 		/**
 		 Returns the keyboard of this input manager.
 
@@ -241,6 +258,12 @@ namespace mage::input {
 		m_impl->Update();
 	}
 
+	void Manager::Update(const KeyboardState& keyboard, 
+						 const MouseState& mouse) noexcept {
+
+		m_impl->Update(keyboard, mouse);
+	}
+
 	[[nodiscard]]
 	const Keyboard& Manager::GetKeyboard() const noexcept {
 		return m_impl->GetKeyboard();
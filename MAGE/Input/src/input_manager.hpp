@@ -100,6 +100,19 @@ namespace mage::input {
 		 */
 		void Update() noexcept;
 
+		/**
+		 Updates the state of the input systems of this input manager to the 
+		 given states instead of polling the input devices (e.g., for 
+		 replaying recorded input).
+
+		 @param[in]		keyboard
+						A reference to the keyboard state.
+		 @param[in]		mouse
+						A reference to the mouse state.
+		 */
+		void Update(const KeyboardState& keyboard, 
+					const MouseState& mouse) noexcept;
+
 		/**
 		 Returns the keyboard of this input manager.
 
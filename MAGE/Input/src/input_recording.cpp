@@ -0,0 +1,251 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "input_recording.hpp"
+#include "io\binary_reader.hpp"
+#include "exception\exception.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::input {
+
+	namespace {
+
+		/**
+		 The magic token of input recording files.
+		 */
+		constexpr const_zstring g_input_recording_token_magic = "MAGEinp";
+
+		/**
+		 A class of input recording readers for reading input frames.
+		 */
+		class InputRecordingReader final : private BigEndianBinaryReader {
+
+		public:
+
+			//-----------------------------------------------------------------
+			// Constructors and Destructors
+			//-----------------------------------------------------------------
+
+			explicit InputRecordingReader(std::vector< InputFrame >& frames)
+				: BigEndianBinaryReader(),
+				m_frames(frames) {}
+
+			InputRecordingReader(const InputRecordingReader& reader) = delete;
+
+			InputRecordingReader(InputRecordingReader&& reader) = delete;
+
+			~InputRecordingReader() = default;
+
+			//-----------------------------------------------------------------
+			// Assignment Operators
+			//-----------------------------------------------------------------
+
+			InputRecordingReader& operator=(
+				const InputRecordingReader& reader) = delete;
+
+			InputRecordingReader& operator=(
+				InputRecordingReader&& reader) = delete;
+
+			//-----------------------------------------------------------------
+			// Member Methods
+			//-----------------------------------------------------------------
+
+			using BigEndianBinaryReader::ReadFromFile;
+
+		private:
+
+			//-----------------------------------------------------------------
+			// Member Methods
+			//-----------------------------------------------------------------
+
+			virtual void ReadData() override {
+				// Read the header.
+				{
+					const bool result = IsHeaderValid();
+					ThrowIfFailed(result,
+								  "%ls: invalid input recording header.",
+								  GetPath().c_str());
+				}
+
+				const auto nb_frames = Read< U64 >();
+				m_frames.clear();
+				m_frames.reserve(static_cast< size_t >(nb_frames));
+
+				// The number of frames is only finalized when the recording
+				// is closed, so a truncated recording is read until its end.
+				// A partially written last frame is dropped.
+				InputFrame frame;
+				const auto nb_buttons = std::size(frame.m_mouse.m_buttons);
+				const auto frame_size = 2u * sizeof(F64)
+					                  + 2u * sizeof(S32x2)
+					                  + sizeof(S32)
+					                  + nb_buttons * sizeof(U8)
+					                  + sizeof(U16);
+				while (frame_size <= GetNumberOfRemainingChars()) {
+					frame.m_wall_clock_delta_time
+						= TimeIntervalSeconds(Read< F64 >());
+					frame.m_core_clock_delta_time
+						= TimeIntervalSeconds(Read< F64 >());
+
+					frame.m_mouse.m_position    = Read< S32x2 >();
+					frame.m_mouse.m_delta       = Read< S32x2 >();
+					frame.m_mouse.m_delta_wheel = Read< S32 >();
+					const auto buttons = ReadArray< U8 >(nb_buttons);
+					std::copy(buttons, buttons + nb_buttons,
+							  frame.m_mouse.m_buttons);
+
+					const auto nb_keys = Read< U16 >();
+					if (nb_keys * 2u * sizeof(U8) > GetNumberOfRemainingChars()) {
+						break;
+					}
+					for (U16 i = 0u; i < nb_keys; ++i) {
+						const auto key = Read< U8 >();
+						frame.m_keyboard.m_keys[key] = Read< U8 >();
+					}
+
+					m_frames.push_back(frame);
+				}
+			}
+
+			[[nodiscard]]
+			bool IsHeaderValid() {
+				for (auto magic = g_input_recording_token_magic;
+					 *magic != '\0'; ++magic) {
+
+					if (*magic != Read< U8 >()) {
+						return false;
+					}
+				}
+
+				return true;
+			}
+
+			//-----------------------------------------------------------------
+			// Member Variables
+			//-----------------------------------------------------------------
+
+			std::vector< InputFrame >& m_frames;
+		};
+	}
+
+	//-------------------------------------------------------------------------
+	// InputRecorder
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	InputRecorder::InputRecorder(std::filesystem::path path)
+		: m_path(std::move(path)),
+		m_file_stream(),
+		m_keyboard(),
+		m_nb_frames(0u) {
+
+		FILE* file;
+		{
+			const errno_t result = _wfopen_s(&file, m_path.c_str(), L"wb");
+			ThrowIfFailed((0 == result),
+						  "%ls: could not open file.", m_path.c_str());
+		}
+
+		m_file_stream.reset(file);
+
+		// Write the header.
+		for (auto magic = g_input_recording_token_magic;
+			 *magic != '\0'; ++magic) {
+
+			Write(static_cast< U8 >(*magic));
+		}
+		Write(U64(0u));
+	}
+
+	InputRecorder::InputRecorder(InputRecorder&& recorder) noexcept = default;
+
+	InputRecorder::~InputRecorder() {
+		if (!m_file_stream) {
+			return;
+		}
+
+		// Finalize the number of frames (which is only used as a hint by the
+		// reader).
+		const auto offset
+			= static_cast< long >(std::strlen(g_input_recording_token_magic));
+		if (0 == fseek(m_file_stream.get(), offset, SEEK_SET)) {
+			const auto nb_frames = static_cast< U64 >(m_nb_frames);
+			fwrite(&nb_frames, sizeof(nb_frames), 1u, m_file_stream.get());
+		}
+	}
+
+	InputRecorder& InputRecorder
+		::operator=(InputRecorder&& recorder) noexcept = default;
+
+	void InputRecorder::Record(const InputFrame& frame) {
+		Write(frame.m_wall_clock_delta_time.count());
+		Write(frame.m_core_clock_delta_time.count());
+
+		Write(frame.m_mouse.m_position);
+		Write(frame.m_mouse.m_delta);
+		Write(frame.m_mouse.m_delta_wheel);
+		Write(frame.m_mouse.m_buttons);
+
+		// Write the keys that changed since the previous frame.
+		U8 keys[std::size(KeyboardState().m_keys)];
+		U16 nb_keys = 0u;
+		for (size_t i = 0u; i < std::size(keys); ++i) {
+			if (frame.m_keyboard.m_keys[i] != m_keyboard.m_keys[i]) {
+				keys[nb_keys++] = static_cast< U8 >(i);
+			}
+		}
+
+		Write(nb_keys);
+		for (U16 i = 0u; i < nb_keys; ++i) {
+			Write(keys[i]);
+			Write(frame.m_keyboard.m_keys[keys[i]]);
+		}
+
+		m_keyboard = frame.m_keyboard;
+		++m_nb_frames;
+	}
+
+	template< typename T >
+	void InputRecorder::Write(const T& data) {
+		const size_t count_written
+			= fwrite(&data, sizeof(T), 1u, m_file_stream.get());
+		ThrowIfFailed((1u == count_written),
+					  "%ls: could not write to file.", m_path.c_str());
+	}
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// Input Recording Utilities
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	[[nodiscard]]
+	const std::vector< InputFrame >
+		ReadInputRecording(const std::filesystem::path& path) {
+
+		std::vector< InputFrame > frames;
+		InputRecordingReader reader(frames);
+		reader.ReadFromFile(path);
+		return frames;
+	}
+
+	#pragma endregion
+}
\ No newline at end of file
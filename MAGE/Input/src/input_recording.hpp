@@ -0,0 +1,238 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "device\keyboard.hpp"
+#include "device\mouse.hpp"
+#include "memory\memory.hpp"
+#include "system\timer.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <filesystem>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::input {
+
+	//-------------------------------------------------------------------------
+	// InputFrame
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A struct of input frames.
+
+	 An input frame contains everything a frame of the engine consumes from
+	 outside the engine: the input device states and the time deltas.
+	 */
+	struct InputFrame final {
+
+	public:
+
+		/**
+		 The wall clock delta time of this input frame.
+		 */
+		TimeIntervalSeconds m_wall_clock_delta_time = TimeIntervalSeconds::zero();
+
+		/**
+		 The core clock delta time of this input frame.
+		 */
+		TimeIntervalSeconds m_core_clock_delta_time = TimeIntervalSeconds::zero();
+
+		/**
+		 The keyboard state of this input frame.
+		 */
+		KeyboardState m_keyboard;
+
+		/**
+		 The mouse state of this input frame.
+		 */
+		MouseState m_mouse;
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// InputRecorder
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A class of input recorders for recording input frames to a (binary)
+	 input recording file.
+
+	 Each input frame is appended to the file as soon as it is recorded.
+	 The keyboard state is stored as the (usually empty) set of keys that
+	 changed since the previous input frame.
+	 */
+	class InputRecorder final {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs an input recorder.
+
+		 @param[in]		path
+						The path of the input recording file.
+		 @throws		Exception
+						Failed to open the input recording file.
+		 */
+		explicit InputRecorder(std::filesystem::path path);
+
+		/**
+		 Constructs an input recorder from the given input recorder.
+
+		 @param[in]		recorder
+						A reference to the input recorder to copy.
+		 */
+		InputRecorder(const InputRecorder& recorder) = delete;
+
+		/**
+		 Constructs an input recorder by moving the given input recorder.
+
+		 @param[in]		recorder
+						A reference to the input recorder to move.
+		 */
+		InputRecorder(InputRecorder&& recorder) noexcept;
+
+		/**
+		 Destructs this input recorder.
+		 */
+		~InputRecorder();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given input recorder to this input recorder.
+
+		 @param[in]		recorder
+						A reference to the input recorder to copy.
+		 @return		A reference to the copy of the given input recorder
+						(i.e. this input recorder).
+		 */
+		InputRecorder& operator=(const InputRecorder& recorder) = delete;
+
+		/**
+		 Moves the given input recorder to this input recorder.
+
+		 @param[in]		recorder
+						A reference to the input recorder to move.
+		 @return		A reference to the moved input recorder (i.e. this
+						input recorder).
+		 */
+		InputRecorder& operator=(InputRecorder&& recorder) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the path of the input recording file of this input recorder.
+
+		 @return		A reference to the path of the input recording file of
+						this input recorder.
+		 */
+		[[nodiscard]]
+		const std::filesystem::path& GetPath() const noexcept {
+			return m_path;
+		}
+
+		/**
+		 Returns the number of recorded input frames of this input recorder.
+
+		 @return		The number of recorded input frames of this input
+						recorder.
+		 */
+		[[nodiscard]]
+		size_t GetNumberOfFrames() const noexcept {
+			return m_nb_frames;
+		}
+
+		/**
+		 Records the given input frame.
+
+		 @param[in]		frame
+						A reference to the input frame.
+		 @throws		Exception
+						Failed to write the input frame.
+		 */
+		void Record(const InputFrame& frame);
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		template< typename T >
+		void Write(const T& data);
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The path of the input recording file of this input recorder.
+		 */
+		std::filesystem::path m_path;
+
+		/**
+		 A pointer to the file stream of this input recorder.
+		 */
+		UniqueFileStream m_file_stream;
+
+		/**
+		 The keyboard state of the previous input frame of this input
+		 recorder.
+		 */
+		KeyboardState m_keyboard;
+
+		/**
+		 The number of recorded input frames of this input recorder.
+		 */
+		size_t m_nb_frames;
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// Input Recording Utilities
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 Reads the input frames of the input recording file associated with the
+	 given path.
+
+	 @param[in]		path
+					A reference to the path of the input recording file.
+	 @return		A vector containing the input frames of the input
+					recording file.
+	 @throws		Exception
+					Failed to read the input recording file.
+	 */
+	[[nodiscard]]
+	const std::vector< InputFrame >
+		ReadInputRecording(const std::filesystem::path& path);
+
+	#pragma endregion
+}
\ No newline at end of file
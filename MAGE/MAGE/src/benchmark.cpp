@@ -0,0 +1,200 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "benchmark.hpp"
+#include "system\profiler.hpp"
+#include "exception\exception.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	namespace {
+
+		/**
+		 Writes the summary of the given values to the given file stream.
+
+		 @param[in]		stream
+						A pointer to the file stream.
+		 @param[in]		name
+						The name of the values.
+		 @param[in]		values
+						The values (which will be sorted).
+		 @return		A negative value if an error occurred.
+		 */
+		int WriteSummary(NotNull< FILE* > stream,
+						 NotNull< const_zstring > name,
+						 std::vector< F64 >& values) {
+
+			std::sort(values.begin(), values.end());
+
+			F64 sum = 0.0;
+			for (const auto value : values) {
+				sum += value;
+			}
+
+			const auto quantile = [&values](F64 q) noexcept {
+				const auto index = static_cast< size_t >(q * (values.size() - 1u) + 0.5);
+				return values[index];
+			};
+
+			return fprintf(stream,
+				"\"%s\":{\"avg\":%.3f,\"p50\":%.3f,\"p95\":%.3f,"
+				"\"p99\":%.3f,\"max\":%.3f}",
+				name.get(),
+				sum / values.size(),
+				quantile(0.50),
+				quantile(0.95),
+				quantile(0.99),
+				values.back());
+		}
+	}
+
+	Benchmark::Benchmark(std::filesystem::path path,
+						 U32 nb_frames,
+						 TimeIntervalSeconds fixed_delta_time)
+		: m_path(std::move(path)),
+		m_nb_frames(nb_frames),
+		m_fixed_delta_time(fixed_delta_time),
+		m_frames() {
+
+		m_frames.reserve(m_nb_frames);
+	}
+
+	Benchmark::Benchmark(Benchmark&& benchmark) noexcept = default;
+
+	Benchmark::~Benchmark() = default;
+
+	Benchmark& Benchmark::operator=(Benchmark&& benchmark) noexcept = default;
+
+	void Benchmark::Record(const BenchmarkFrame& frame) {
+		if (IsFinished()) {
+			return;
+		}
+
+		m_frames.push_back(frame);
+	}
+
+	void Benchmark::Export() const {
+		FILE* file;
+		{
+			const errno_t result = _wfopen_s(&file, m_path.c_str(), L"w");
+			ThrowIfFailed((0 == result),
+						  "%ls: could not open file.", m_path.c_str());
+		}
+
+		UniqueFileStream file_stream(file);
+		const auto stream = NotNull< FILE* >(file_stream.get());
+		auto result       = 0;
+
+		result = std::min(result, fprintf(stream,
+			"{\"frames\":%zu,\"fixed_delta_time_s\":%.6f,\"summary\":{",
+			m_frames.size(),
+			m_fixed_delta_time.count()));
+
+		// Summarize the timings (in milliseconds) and counters.
+		if (!m_frames.empty()) {
+			using Field = F64 (*)(const BenchmarkFrame&);
+			static constexpr std::pair< const_zstring, Field > fields[] = {
+				{ "update_ms", [](const BenchmarkFrame& frame) {
+					return F64(frame.m_update_time); } },
+				{ "render_ms", [](const BenchmarkFrame& frame) {
+					return F64(frame.m_render_time); } },
+				{ "wait_ms", [](const BenchmarkFrame& frame) {
+					return F64(frame.m_wait_time); } },
+				{ "snapshot_ms", [](const BenchmarkFrame& frame) {
+					return F64(frame.m_snapshot_time); } },
+				{ "frame_ms", [](const BenchmarkFrame& frame) {
+					return F64(frame.m_frame_time); } },
+				{ "draws", [](const BenchmarkFrame& frame) {
+					return F64(frame.m_counters.m_nb_draws); } },
+				{ "triangles", [](const BenchmarkFrame& frame) {
+					return F64(frame.m_counters.m_nb_triangles); } },
+				{ "bindings", [](const BenchmarkFrame& frame) {
+					return F64(frame.m_counters.m_nb_bindings); } },
+				{ "redundant_bindings", [](const BenchmarkFrame& frame) {
+					return F64(frame.m_counters.m_nb_redundant_bindings); } },
+				{ "occlusion_tests", [](const BenchmarkFrame& frame) {
+					return F64(frame.m_counters.m_nb_occlusion_tests); } },
+				{ "occlusion_culled", [](const BenchmarkFrame& frame) {
+					return F64(frame.m_counters.m_nb_occlusion_culled); } },
+				{ "resident_bytes", [](const BenchmarkFrame& frame) {
+					return F64(frame.m_counters.m_resident_size); } }
+			};
+
+			std::vector< F64 > values(m_frames.size());
+			auto first = true;
+			for (const auto& [name, field] : fields) {
+				std::transform(m_frames.cbegin(), m_frames.cend(),
+							   values.begin(), field);
+
+				if (!first) {
+					result = std::min(result, fputc(',', stream));
+				}
+				result = std::min(result, WriteSummary(stream,
+					NotNull< const_zstring >(name), values));
+				first = false;
+			}
+		}
+
+		// Summarize the profile zones.
+		result = std::min(result, fprintf(stream, "},\"passes\":{"));
+		auto first = true;
+		for (const auto& zone : Profiler::Get().GetStatistics()) {
+			result = std::min(result, fprintf(stream,
+				"%s\"%.*s\":{\"calls\":%.2f,\"min_ms\":%.3f,\"avg_ms\":%.3f,"
+				"\"p99_ms\":%.3f}",
+				first ? "" : ",",
+				static_cast< int >(zone.m_name.size()), zone.m_name.data(),
+				zone.m_nb_calls,
+				zone.m_min,
+				zone.m_avg,
+				zone.m_p99));
+			first = false;
+		}
+
+		// Write the per-frame timings and counters.
+		result = std::min(result, fprintf(stream, "},\"per_frame\":[\n"));
+		for (size_t i = 0u; i < m_frames.size(); ++i) {
+			const auto& frame    = m_frames[i];
+			const auto& counters = frame.m_counters;
+			result = std::min(result, fprintf(stream,
+				"%s{\"update_ms\":%.3f,\"render_ms\":%.3f,\"wait_ms\":%.3f,"
+				"\"snapshot_ms\":%.3f,\"frame_ms\":%.3f,\"draws\":%u,"
+				"\"triangles\":%u,\"bindings\":%u,\"redundant_bindings\":%u,"
+				"\"occlusion_tests\":%u,\"occlusion_culled\":%u,"
+				"\"resident_bytes\":%zu}",
+				(0u == i) ? "" : ",\n",
+				frame.m_update_time,
+				frame.m_render_time,
+				frame.m_wait_time,
+				frame.m_snapshot_time,
+				frame.m_frame_time,
+				counters.m_nb_draws,
+				counters.m_nb_triangles,
+				counters.m_nb_bindings,
+				counters.m_nb_redundant_bindings,
+				counters.m_nb_occlusion_tests,
+				counters.m_nb_occlusion_culled,
+				counters.m_resident_size));
+		}
+		result = std::min(result, fprintf(stream, "\n]}\n"));
+
+		ThrowIfFailed((0 <= result),
+					  "%ls: could not write to file.", m_path.c_str());
+	}
+}
\ No newline at end of file
@@ -0,0 +1,230 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "rendering_manager.hpp"
+#include "system\timer.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <filesystem>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	//-------------------------------------------------------------------------
+	// BenchmarkFrame
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A struct of benchmark frames.
+	 */
+	struct BenchmarkFrame final {
+
+	public:
+
+		/**
+		 The time (in milliseconds) spent updating the input and the scripts
+		 of this benchmark frame.
+		 */
+		F32 m_update_time = 0.0f;
+
+		/**
+		 The time (in milliseconds) spent on the CPU-side rendering work of
+		 this benchmark frame. With pipelined rendering, the time spent by 
+		 the render thread on the previous frame.
+		 */
+		F32 m_render_time = 0.0f;
+
+		/**
+		 The time (in milliseconds) the main thread waited for the render 
+		 thread in this benchmark frame (pipelined rendering only).
+		 */
+		F32 m_wait_time = 0.0f;
+
+		/**
+		 The time (in milliseconds) the main thread spent extracting the 
+		 render snapshot (or recording the commands) of the previous frame 
+		 (pipelined rendering only).
+		 */
+		F32 m_snapshot_time = 0.0f;
+
+		/**
+		 The time (in milliseconds) spent by the main thread on this 
+		 benchmark frame.
+		 */
+		F32 m_frame_time = 0.0f;
+
+		/**
+		 The frame counters of this benchmark frame.
+		 */
+		rendering::FrameCounters m_counters;
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// Benchmark
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A class of benchmarks.
+
+	 A benchmark runs a fixed number of frames with a fixed time step and
+	 exports a summary and the per-frame timings and counters of these frames
+	 to a JSON file.
+	 */
+	class Benchmark final {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a benchmark.
+
+		 @param[in]		path
+						The path of the benchmark report file.
+		 @param[in]		nb_frames
+						The number of frames to run.
+		 @param[in]		fixed_delta_time
+						The fixed delta time (in seconds) of each frame.
+		 */
+		explicit Benchmark(std::filesystem::path path,
+						   U32 nb_frames,
+						   TimeIntervalSeconds fixed_delta_time);
+
+		/**
+		 Constructs a benchmark from the given benchmark.
+
+		 @param[in]		benchmark
+						A reference to the benchmark to copy.
+		 */
+		Benchmark(const Benchmark& benchmark) = delete;
+
+		/**
+		 Constructs a benchmark by moving the given benchmark.
+
+		 @param[in]		benchmark
+						A reference to the benchmark to move.
+		 */
+		Benchmark(Benchmark&& benchmark) noexcept;
+
+		/**
+		 Destructs this benchmark.
+		 */
+		~Benchmark();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given benchmark to this benchmark.
+
+		 @param[in]		benchmark
+						A reference to the benchmark to copy.
+		 @return		A reference to the copy of the given benchmark (i.e.
+						this benchmark).
+		 */
+		Benchmark& operator=(const Benchmark& benchmark) = delete;
+
+		/**
+		 Moves the given benchmark to this benchmark.
+
+		 @param[in]		benchmark
+						A reference to the benchmark to move.
+		 @return		A reference to the moved benchmark (i.e. this
+						benchmark).
+		 */
+		Benchmark& operator=(Benchmark&& benchmark) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the fixed delta time of this benchmark.
+
+		 @return		The fixed delta time (in seconds) of each frame of
+						this benchmark.
+		 */
+		[[nodiscard]]
+		TimeIntervalSeconds GetFixedDeltaTime() const noexcept {
+			return m_fixed_delta_time;
+		}
+
+		/**
+		 Checks whether all frames of this benchmark are recorded.
+
+		 @return		@c true if all frames of this benchmark are recorded.
+						@c false otherwise.
+		 */
+		[[nodiscard]]
+		bool IsFinished() const noexcept {
+			return m_nb_frames <= m_frames.size();
+		}
+
+		/**
+		 Records the given frame.
+
+		 @param[in]		frame
+						A reference to the benchmark frame.
+		 */
+		void Record(const BenchmarkFrame& frame);
+
+		/**
+		 Exports the recorded frames of this benchmark to the benchmark
+		 report file.
+
+		 @throws		Exception
+						Failed to export the benchmark report.
+		 */
+		void Export() const;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The path of the benchmark report file of this benchmark.
+		 */
+		std::filesystem::path m_path;
+
+		/**
+		 The number of frames to run of this benchmark.
+		 */
+		U32 m_nb_frames;
+
+		/**
+		 The fixed delta time (in seconds) of each frame of this benchmark.
+		 */
+		TimeIntervalSeconds m_fixed_delta_time;
+
+		/**
+		 The recorded frames of this benchmark.
+		 */
+		std::vector< BenchmarkFrame > m_frames;
+	};
+
+	#pragma endregion
+}
\ No newline at end of file
@@ -12,6 +12,7 @@
 #include "meta\targetver.hpp"
 #include "meta\version.hpp"
 #include "scene\scene.hpp"
+#include "system\profiler.hpp"
 
 #pragma endregion
 
@@ -128,11 +129,31 @@ namespace mage {
 		m_rendering_manager(), 
 		m_scene(), 
 		m_requested_scene(), 
+		m_staged_scene(), 
+		m_staged_world(), 
+		m_staging_progress(), 
+		m_staging(), 
+		m_staging_thread(), 
+		m_script_scheduler(MakeUnique< ScriptScheduler >()), 
+		m_parallel_scripts(setup.IsParallelScripts()), 
+		m_pipelined_rendering(setup.IsPipelinedRendering() 
+							  || setup.IsCommandRecording()), 
+		m_command_recording(setup.IsCommandRecording()), 
+		m_render_wait_time(TimeIntervalSeconds::zero()), 
+		m_snapshot_time(TimeIntervalSeconds::zero()), 
 		m_timer(), 
 		m_time(), 
+		m_frame_statistics(), 
+		m_input_recorder(), 
+		m_input_frames(), 
+		m_input_frame(0u), 
+		m_replay(false), 
+		m_benchmark(), 
+		m_headless(setup.IsHeadless()), 
 		m_fixed_delta_time(TimeIntervalSeconds::zero()),
 		m_fixed_time_budget(TimeIntervalSeconds::zero()),
 		m_deactive(false), 
+		m_paused(false), 
 		m_mode_switch(false), 
 		m_has_requested_scene(false) {
 
@@ -161,13 +182,6 @@ namespace mage {
 			
 			m_message_handler.m_on_active_change = [this](bool deactive) {
 				m_deactive = deactive;
-
-				if (m_deactive) {
-					m_timer.Stop();
-				}
-				else {
-					m_timer.Resume();
-				}
 			};
 
 			m_message_handler.m_on_mode_switch   = [this]() {
@@ -175,6 +189,9 @@ namespace mage {
 			};
 			
 			m_message_handler.m_on_print_screen  = [this]() {
+				// Wait for the frame being rendered (if any).
+				m_rendering_manager->WaitForRender();
+
 				auto& swap_chain = m_rendering_manager->GetSwapChain();
 				const auto fname = L"screenshot-" + GetLocalSystemDateAndTimeAsString() 
 					             + L".png";
@@ -189,12 +206,34 @@ namespace mage {
 		
 		const auto window = NotNull< HWND >(m_window->GetWindow());
 
+		// Initialize the frame pacing.
+		m_timer.SetTargetFrameRate(setup.GetTargetFrameRate());
+		m_timer.SetBackgroundFrameRate(setup.GetBackgroundFrameRate());
+
 		// Initialize the input system.
 		m_input_manager = MakeUnique< input::Manager >(window);
 
+		// Initialize the input recording or replay.
+		if (!setup.GetInputReplayPath().empty()) {
+			m_input_frames = input::ReadInputRecording(setup.GetInputReplayPath());
+			m_replay       = true;
+		}
+		else if (!setup.GetInputRecordingPath().empty()) {
+			m_input_recorder 
+				= MakeUnique< input::InputRecorder >(setup.GetInputRecordingPath());
+		}
+
+		// Initialize the benchmark.
+		if (setup.IsBenchmark()) {
+			m_benchmark = MakeUnique< Benchmark >(setup.GetBenchmarkPath(), 
+												  setup.GetNumberOfBenchmarkFrames(), 
+												  setup.GetBenchmarkDeltaTime());
+		}
+
 		// Initialize the rendering system.
 		m_rendering_manager = MakeUnique< rendering::Manager >(window, 
-															   std::move(display_config));
+															   std::move(display_config), 
+															   m_command_recording);
 		m_rendering_manager->BindPersistentState();
 		
 		// Initializes the COM library for use by the calling thread and sets 
@@ -203,6 +242,20 @@ namespace mage {
 	}
 
 	void Engine::UninitializeSystems() noexcept {
+		// Wait for the scene being loaded in the background.
+		if (m_staging_thread.joinable()) {
+			m_staging_thread.join();
+		}
+
+		// Wait for the frame being rendered on the render thread (if any), 
+		// before destroying the scene.
+		if (m_rendering_manager) {
+			try {
+				m_rendering_manager->WaitForRender();
+			}
+			catch (...) {}
+		}
+
 		m_window->RemoveAllListeners();
 		m_window->RemoveAllHandlers();
 		
@@ -232,20 +285,163 @@ namespace mage {
 		m_scene               = std::move(m_requested_scene);
 		m_requested_scene     = nullptr;
 		m_has_requested_scene = false;
+		m_script_scheduler->Invalidate();
 
 		if (m_scene) {
 			m_scene->Initialize(*this);
 
+			// Evict the cached resources of the previous scene which are not 
+			// used by the current scene and exceed their budgets.
+			m_rendering_manager->GetResourceManager().Trim();
+
 			m_timer.Restart();
 			m_time = GameTime();
 			m_fixed_time_budget = TimeIntervalSeconds::zero();
 		}
 	}
 
+	void Engine::RequestSceneAsync(UniquePtr< Scene >&& scene) {
+		if (!scene) {
+			RequestScene(std::move(scene));
+			return;
+		}
+
+		if (IsLoadingScene()) {
+			Warning("%s: a scene is already loading.", scene->GetName().c_str());
+			return;
+		}
+
+		m_staged_scene     = std::move(scene);
+		m_staged_world     = m_rendering_manager->CreateWorld();
+		m_staging_progress = MakeUnique< ProgressReporter >(
+			m_staged_scene->GetName(), 2u);
+
+		const auto promise = MakeShared< std::promise< void > >();
+		m_staging = promise->get_future();
+
+		// The scene is preloaded on a dedicated thread, since preloading 
+		// blocks on resources which are loaded by the worker threads.
+		m_staging_thread = std::thread([this, promise]() noexcept {
+			// Initializes the COM library for use by the staging thread.
+			CoInitializeEx(nullptr, COINIT_MULTITHREADED);
+
+			const auto& rendering_manager = GetRenderingManager();
+			
+			// Load the scene into the staging world, while the current scene 
+			// is still rendered from the current world.
+			std::exception_ptr exception;
+			rendering_manager.BindWorld(m_staged_world.get());
+			try {
+				m_staged_scene->Preload(*this);
+			}
+			catch (...) {
+				exception = std::current_exception();
+			}
+			rendering_manager.BindWorld(nullptr);
+
+			m_staging_progress->Update();
+
+			// Uninitialize the COM library.
+			CoUninitialize();
+
+			// The staged members are only accessed by the main thread after 
+			// this point.
+			if (exception) {
+				promise->set_exception(exception);
+			}
+			else {
+				promise->set_value();
+			}
+		});
+	}
+
+	void Engine::ApplyStagedScene() {
+		m_staging_thread.join();
+
+		auto scene    = std::move(m_staged_scene);
+		auto world    = std::move(m_staged_world);
+		auto progress = std::move(m_staging_progress);
+
+		// Rethrow the exception (if any) of the preloading.
+		m_staging.get();
+
+		if (m_scene) {
+			m_scene->Uninitialize(*this);
+		}
+
+		// Swap in the staging world (and destroy the previous world).
+		m_rendering_manager->SwapWorld(std::move(world));
+
+		m_scene = std::move(scene);
+		m_script_scheduler->Invalidate();
+		m_scene->Activate(*this);
+		progress->Done();
+
+		// Evict the cached resources of the previous scene which are not 
+		// used by the current scene and exceed their budgets.
+		m_rendering_manager->GetResourceManager().Trim();
+
+		m_timer.Restart();
+		m_time = GameTime();
+		m_fixed_time_budget = TimeIntervalSeconds::zero();
+	}
+
+	[[nodiscard]]
+	bool Engine::HasStagedScene() const {
+		return IsLoadingScene() && std::future_status::ready 
+			== m_staging.wait_for(std::chrono::seconds(0));
+	}
+
+	[[nodiscard]]
+	bool Engine::HasStructuralChanges() const {
+		return m_script_scheduler->HasCommands()
+			|| HasStagedScene()
+			|| HasRequestedScene();
+	}
+
+	void Engine::UpdateStagedScene() {
+		// Switch to the scene loaded in the background, if loaded.
+		if (HasStagedScene()) {
+			ApplyStagedScene();
+		}
+	}
+
+	[[nodiscard]]
+	bool Engine::UpdateRequestedScene() {
+		if (m_has_requested_scene) {
+			ApplyRequestedScene();
+			
+			if (!m_scene) {
+				PostQuitMessage(0);
+				return true;
+			}
+		}
+
+		return false;
+	}
+
 	[[nodiscard]]
 	bool Engine::UpdateInput() {
+		MAGE_PROFILE_FUNCTION();
+
 		// Update the input manager.
-		m_input_manager->Update();
+		if (m_replay) {
+			// Terminate after the last replayed input frame.
+			if (m_input_frames.size() <= m_input_frame) {
+				PostQuitMessage(0);
+				return true;
+			}
+
+			const auto& frame = m_input_frames[m_input_frame];
+			m_input_manager->Update(frame.m_keyboard, frame.m_mouse);
+		}
+		else if (m_benchmark) {
+			// Benchmarks do not depend on the input devices.
+			m_input_manager->Update(input::KeyboardState(), input::MouseState());
+		}
+		else {
+			m_input_manager->Update();
+		}
 		
 		// Handle forced exit.
 		if (m_input_manager->GetKeyboard().GetKeyPress(DIK_F1)) {
@@ -256,12 +452,138 @@ namespace mage {
 		return false;
 	}
 
+	[[nodiscard]]
+	bool Engine::UpdatePause() noexcept {
+		// A headless engine is never paused. Otherwise, the engine is paused 
+		// while the main window is minimized, or deactive without a 
+		// background frame rate.
+		const auto run_in_background 
+			= (TimeIntervalSeconds::zero() != m_timer.GetBackgroundFrameTime());
+		const auto paused = !m_headless 
+			&& (IsIconic(m_window->GetWindow()) 
+				|| (m_deactive && !run_in_background));
+
+		if (paused != m_paused) {
+			m_paused = paused;
+
+			if (m_paused) {
+				m_timer.Stop();
+			}
+			else {
+				m_timer.Resume();
+			}
+		}
+
+		return m_paused;
+	}
+
+	void Engine::UpdateTime() noexcept {
+		if (!m_replay && !m_benchmark) {
+			m_time = m_timer.GetTime();
+			return;
+		}
+
+		auto wall_clock_delta_time = TimeIntervalSeconds::zero();
+		auto core_clock_delta_time = TimeIntervalSeconds::zero();
+		
+		if (m_benchmark) {
+			// Use the fixed time step of the benchmark.
+			wall_clock_delta_time = m_benchmark->GetFixedDeltaTime();
+			core_clock_delta_time = m_benchmark->GetFixedDeltaTime();
+		}
+		else {
+			// Replay the time deltas instead of querying the timer.
+			const auto& frame = m_input_frames[m_input_frame];
+			wall_clock_delta_time = frame.m_wall_clock_delta_time;
+			core_clock_delta_time = frame.m_core_clock_delta_time;
+		}
+
+		m_time = GameTime(wall_clock_delta_time,
+						  m_time.GetWallClockTotalDeltaTime() 
+						  + wall_clock_delta_time,
+						  core_clock_delta_time,
+						  m_time.GetCoreClockTotalDeltaTime() 
+						  + core_clock_delta_time);
+	}
+
+	void Engine::RecordInput() {
+		// Frames which are not recorded (e.g., display mode switches) do
+		// not consume a replayed input frame either.
+		if (m_replay) {
+			++m_input_frame;
+			return;
+		}
+
+		if (!m_input_recorder) {
+			return;
+		}
+
+		input::InputFrame frame;
+		frame.m_wall_clock_delta_time = m_time.GetWallClockDeltaTime();
+		frame.m_core_clock_delta_time = m_time.GetCoreClockDeltaTime();
+		frame.m_keyboard = m_input_manager->GetKeyboard().GetState();
+		frame.m_mouse    = m_input_manager->GetMouse().GetState();
+		m_input_recorder->Record(frame);
+	}
+
+	void Engine::RecordFrame(const WallClockTimer& timer, 
+							 TimeIntervalSeconds update_time) {
+
+		m_frame_statistics.Record(
+			m_time.GetWallClockDeltaTime(),
+			m_time.GetCoreClockDeltaTime(),
+			m_rendering_manager->GetPresentTime());
+
+		if (m_benchmark) {
+			RecordBenchmark(timer, update_time);
+		}
+	}
+
+	void Engine::RecordBenchmark(const WallClockTimer& timer, 
+								 TimeIntervalSeconds update_time) {
+		
+		const auto to_ms = [](TimeIntervalSeconds time) noexcept {
+			return static_cast< F32 >(time.count() * 1000.0);
+		};
+
+		BenchmarkFrame frame;
+		frame.m_update_time = to_ms(update_time);
+		if (m_pipelined_rendering) {
+			// The render timings and counters are those of the previous 
+			// frame, which is rendered on the render thread while this frame 
+			// is updated.
+			frame.m_render_time   = to_ms(m_rendering_manager->GetRenderTime());
+			frame.m_wait_time     = to_ms(m_render_wait_time);
+			frame.m_snapshot_time = to_ms(m_snapshot_time);
+			frame.m_frame_time    = to_ms(update_time + m_render_wait_time 
+										  + m_snapshot_time);
+		}
+		else {
+			const auto frame_time = timer.GetTotalDeltaTime();
+			frame.m_render_time   = to_ms(frame_time - update_time);
+			frame.m_frame_time    = to_ms(frame_time);
+		}
+		frame.m_counters = m_rendering_manager->GetFrameCounters();
+		m_benchmark->Record(frame);
+
+		// Export the report and terminate after the last benchmark frame.
+		if (m_benchmark->IsFinished()) {
+			m_benchmark->Export();
+			PostQuitMessage(0);
+		}
+	}
+
 	[[nodiscard]]
 	bool Engine::UpdateRendering() {
+		MAGE_PROFILE_FUNCTION();
+
 		// Handle switch between full screen and windowed mode.
 		auto& swap_chain     = m_rendering_manager->GetSwapChain();
 		const auto lost_mode = swap_chain.LostMode();
 		if (m_mode_switch || lost_mode) {
+			// Wait for the frame being rendered (if any).
+			m_rendering_manager->WaitForRender();
+
 			swap_chain.SwitchMode(!lost_mode);
 			m_mode_switch = false;
 			return true;
@@ -272,55 +594,120 @@ namespace mage {
 
 		return false;
 	}
+
+	[[nodiscard]]
+	bool Engine::UpdatePipeline(const WallClockTimer& timer, 
+								TimeIntervalSeconds update_time) {
+		MAGE_PROFILE_FUNCTION();
+
+		WallClockTimer stage_timer;
+		stage_timer.Start();
+
+		// Record this frame while the render thread replays the previous 
+		// frame. The recorded commands do not retain the device objects, so 
+		// frames with structural changes are only recorded after these 
+		// changes are performed.
+		const auto record_ahead = m_command_recording 
+			                   && !HasStructuralChanges();
+		if (record_ahead) {
+			m_rendering_manager->Record(m_time);
+		}
+		const auto record_time = stage_timer.GetTotalDeltaTime();
+
+		stage_timer.Restart();
+
+		// Wait for the render thread to render the previous frame.
+		m_rendering_manager->WaitForRender();
+		m_render_wait_time = stage_timer.GetTotalDeltaTime();
+
+		// The render timings and counters are written by the render thread.
+		RecordFrame(timer, update_time);
+
+		// Perform the structural changes while nothing is rendered.
+		if (!record_ahead) {
+			m_script_scheduler->ExecuteCommands(*this);
+			UpdateStagedScene();
+			if (UpdateRequestedScene()) {
+				return true;
+			}
+		}
+
+		stage_timer.Restart();
+
+		// Extract the render snapshot and render this frame on the render 
+		// thread, while the next frame is updated. Except for the transforms, 
+		// the world is not changed until this frame is rendered. Recorded 
+		// frames are extracted while recording and need no snapshot.
+		if (!m_command_recording) {
+			m_scene->ForEach< Node >([](const Node& node) noexcept {
+				node.GetTransform().Snapshot();
+			});
+		}
+		// Benchmarks measure the CPU-side work without presenting.
+		m_rendering_manager->RenderAsync(m_time, !m_benchmark);
+
+		m_snapshot_time = record_time + stage_timer.GetTotalDeltaTime();
+
+		return false;
+	}
 	
+	void Engine::UpdateScripts(ScriptScheduler::UpdateMethod update, 
+							   bool interruptible) {
+		if (m_parallel_scripts) {
+			m_script_scheduler->Update(*m_scene, *this, update, interruptible);
+		}
+		else {
+			m_scene->ForEach< BehaviorScript >(
+				[this, update, interruptible](BehaviorScript& script) {
+					if (State::Active == script.GetState()
+						&& !(interruptible && m_has_requested_scene)) {
+
+						(script.*update)(*this);
+					}
+				}
+			);
+		}
+
+		// With pipelined rendering, the deferred commands are executed once 
+		// the previous frame is rendered.
+		if (!m_pipelined_rendering) {
+			m_script_scheduler->ExecuteCommands(*this);
+		}
+	}
+
 	[[nodiscard]]
 	bool Engine::UpdateScripting() {
+		MAGE_PROFILE_FUNCTION();
+
+		// With pipelined rendering, the scenes are switched once the previous 
+		// frame is rendered.
+		if (!m_pipelined_rendering) {
+			UpdateStagedScene();
+		}
+
 		// Perform the fixed delta time updates of the current scene.
 		if (TimeIntervalSeconds::zero() != m_fixed_delta_time) {
 			m_fixed_time_budget += m_time.GetWallClockDeltaTime();
 			while (m_fixed_time_budget >= m_fixed_delta_time) {
-				m_scene->ForEach< BehaviorScript >([this](BehaviorScript& script) {
-					if (State::Active == script.GetState()) {
-						script.FixedUpdate(*this);
-					}
-				});
+				UpdateScripts(&BehaviorScript::FixedUpdate, false);
 
 				m_fixed_time_budget -= m_fixed_delta_time;
 			}
 		}
 		else {
-			m_scene->ForEach< BehaviorScript >([this](BehaviorScript& script) {
-				if (State::Active == script.GetState()) {
-					script.FixedUpdate(*this);
-				}
-			});
+			UpdateScripts(&BehaviorScript::FixedUpdate, false);
 		}
 		
 		// Perform the non-fixed delta time updates of the current scene.
-		m_scene->ForEach< BehaviorScript >([this](BehaviorScript& script) {
-			if (State::Active == script.GetState()
-				&& !m_has_requested_scene) {
-
-				script.Update(*this);
-			}
-		});
+		UpdateScripts(&BehaviorScript::Update, true);
 
-		if (m_has_requested_scene) {
-			ApplyRequestedScene();
-			
-			if (!m_scene) {
-				PostQuitMessage(0);
-				return true;
-			}
-		}
-
-		return false;
+		return m_pipelined_rendering ? false : UpdateRequestedScene();
 	}
 
 	[[nodiscard]]
 	int Engine::Run(UniquePtr< Scene >&& scene, int nCmdShow) {
-		// Show the main window.
-		m_window->Show(nCmdShow);
+		// Show the main window (benchmarks run with a hidden window).
+		m_window->Show(m_benchmark ? SW_HIDE : nCmdShow);
 
 		// Handle startup in fullscreen mode.
 		auto& swap_chain = m_rendering_manager->GetSwapChain();
@@ -349,27 +736,59 @@ namespace mage {
 				continue;
 			}
 
-			// Check if the main window is deactive.
-			if (m_deactive) {
+			// Check if the engine is paused.
+			if (UpdatePause()) {
+				// Block until the next message instead of polling.
+				WaitMessage();
 				continue;
 			}
 
-			if (UpdateInput()) {
-				continue;
-			}
+			{
+				MAGE_PROFILE_ZONE("mage::Engine::Run");
 
-			// Calculate the time.
-			m_time = m_timer.GetTime();
+				// Measure the CPU-side work of this frame.
+				WallClockTimer frame_timer;
+				frame_timer.Start();
 
-			if (UpdateRendering()) {
-				continue;
+				if (UpdateInput()) {
+					continue;
+				}
+
+				// Calculate the time.
+				UpdateTime();
+
+				if (UpdateRendering()) {
+					continue;
+				}
+
+				RecordInput();
+
+				if (UpdateScripting()) {
+					continue;
+				}
+
+				const auto update_time = frame_timer.GetTotalDeltaTime();
+
+				if (m_pipelined_rendering) {
+					if (UpdatePipeline(frame_timer, update_time)) {
+						continue;
+					}
+				}
+				else {
+					// Benchmarks measure the CPU-side work without presenting.
+					m_rendering_manager->Render(m_time, !m_benchmark);
+
+					RecordFrame(frame_timer, update_time);
+				}
 			}
 
-			if (UpdateScripting()) {
-				continue;
+			// Wait for the next frame (benchmarks are not paced).
+			if (!m_benchmark) {
+				m_timer.WaitForNextFrame(m_deactive);
 			}
 
-			m_rendering_manager->Render(m_time);
+			// Drain the profile events of this frame.
+			MAGE_PROFILE_END_FRAME();
 		}
 
 		return static_cast< int >(msg.wParam);
@@ -399,7 +818,9 @@ namespace mage {
 
 		// Enumerate the display configurations.
 		auto configurator = MakeUnique< rendering::DisplayConfigurator >();
-		const HRESULT result = configurator->Configure();
+		const HRESULT result = setup.IsHeadless() 
+			? configurator->ConfigureHeadless(setup.GetHeadlessResolution()) 
+			: configurator->Configure();
 		if (FAILED(result)) {
 			return nullptr;
 		}
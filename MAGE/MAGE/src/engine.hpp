@@ -5,13 +5,28 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
+#include "benchmark.hpp"
 #include "engine_setup.hpp"
 #include "input_manager.hpp"
+#include "input_recording.hpp"
+#include "logging\progress_reporter.hpp"
 #include "rendering_manager.hpp"
+#include "scene\script\script_scheduler.hpp"
+#include "system\frame_statistics.hpp"
 #include "ui\window.hpp"
 
 #pragma endregion
 
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <future>
+#include <thread>
+
+#pragma endregion
+
 //-----------------------------------------------------------------------------
 // Engine Declarations and Definitions
 //-----------------------------------------------------------------------------
@@ -259,6 +274,81 @@ namespace mage {
 		 */
 		void RequestScene(UniquePtr< Scene >&& scene) noexcept;
 
+		/**
+		 Loads the given scene in the background and switches to it once it 
+		 is loaded.
+
+		 The given scene is preloaded into a staging world on a dedicated 
+		 thread, while the current scene keeps running. Once preloaded, the 
+		 current scene is uninitialized and the given scene is activated 
+		 within a single frame. Requests while a scene is loading are 
+		 ignored.
+
+		 @param[in]		scene
+						A reference to the scene. If @c nullptr, the request 
+						is handled as a synchronous scene request.
+		 @throws		Exception
+						Failed to create the staging world.
+		 */
+		void RequestSceneAsync(UniquePtr< Scene >&& scene);
+
+		/**
+		 Checks whether this engine is loading a scene in the background.
+
+		 @return		@c true if this engine is loading a scene in the 
+						background. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool IsLoadingScene() const noexcept {
+			return m_staging.valid();
+		}
+
+		/**
+		 Checks whether this engine has a requested scene.
+
+		 @return		@c true if this engine has a requested scene. @c false 
+						otherwise.
+		 */
+		[[nodiscard]]
+		bool HasRequestedScene() const noexcept {
+			return m_has_requested_scene;
+		}
+
+		/**
+		 Checks whether this engine renders each frame on a render thread 
+		 while updating the next frame.
+
+		 @return		@c true if this engine renders each frame on a render 
+						thread while updating the next frame. @c false 
+						otherwise.
+		 */
+		[[nodiscard]]
+		bool IsPipelinedRendering() const noexcept {
+			return m_pipelined_rendering;
+		}
+
+		/**
+		 Defers the given command until all behavior scripts of the current 
+		 scripting phase are updated.
+
+		 Deferred commands are executed on the main thread in an order that 
+		 only depends on the order of the behavior scripts. This method is 
+		 thread-safe, and is the only way for thread-safe behavior scripts to 
+		 perform structural changes (e.g., creating or destroying nodes, 
+		 requesting scenes).
+
+		 With pipelined rendering, deferred commands are executed once the 
+		 previous frame is rendered, and are the only way for behavior 
+		 scripts to perform structural changes or to change the components 
+		 of the rendering world (e.g., cameras, lights, models, sprites).
+
+		 @param[in]		command
+						The command.
+		 */
+		void Defer(std::function< void(Engine&) > command) {
+			m_script_scheduler->Defer(std::move(command));
+		}
+
 		/**
 		 Returns the game time of this game engine.
 
@@ -268,6 +358,38 @@ namespace mage {
 			return m_time;
 		}
 
+		/**
+		 Returns the game timer of this game engine.
+
+		 @return		A reference to the game timer of this game engine.
+		 */
+		[[nodiscard]]
+		const GameTimer& GetTimer() const noexcept {
+			return m_timer;
+		}
+
+		/**
+		 Returns the frame statistics of this game engine.
+
+		 @return		A reference to the frame statistics of this game
+						engine.
+		 */
+		[[nodiscard]]
+		FrameStatistics& GetFrameStatistics() noexcept {
+			return m_frame_statistics;
+		}
+
+		/**
+		 Returns the frame statistics of this game engine.
+
+		 @return		A reference to the frame statistics of this game
+						engine.
+		 */
+		[[nodiscard]]
+		const FrameStatistics& GetFrameStatistics() const noexcept {
+			return m_frame_statistics;
+		}
+
 	private:
 
 		//---------------------------------------------------------------------
@@ -295,12 +417,45 @@ namespace mage {
 
 		void ApplyRequestedScene();
 
+		void ApplyStagedScene();
+
+		[[nodiscard]]
+		bool HasStagedScene() const;
+
+		[[nodiscard]]
+		bool HasStructuralChanges() const;
+
+		void UpdateStagedScene();
+
+		[[nodiscard]]
+		bool UpdateRequestedScene();
+
 		[[nodiscard]]
 		bool UpdateInput();
+
+		[[nodiscard]]
+		bool UpdatePause() noexcept;
+
+		void UpdateTime() noexcept;
+
+		void RecordInput();
+
+		void RecordFrame(const WallClockTimer& timer,
+						 TimeIntervalSeconds update_time);
+
+		void RecordBenchmark(const WallClockTimer& timer,
+							 TimeIntervalSeconds update_time);
 		
 		[[nodiscard]]
 		bool UpdateRendering();
+
+		[[nodiscard]]
+		bool UpdatePipeline(const WallClockTimer& timer,
+							TimeIntervalSeconds update_time);
 		
+		void UpdateScripts(ScriptScheduler::UpdateMethod update, 
+						   bool interruptible);
+
 		[[nodiscard]]
 		bool UpdateScripting();
 
@@ -338,6 +493,70 @@ namespace mage {
 		 */
 		UniquePtr< Scene > m_requested_scene;
 
+		/**
+		 A pointer to the scene being loaded in the background of this 
+		 engine.
+		 */
+		UniquePtr< Scene > m_staged_scene;
+
+		/**
+		 A pointer to the staging world of the scene being loaded in the 
+		 background of this engine.
+		 */
+		UniquePtr< rendering::World > m_staged_world;
+
+		/**
+		 A pointer to the progress reporter of the scene being loaded in the 
+		 background of this engine.
+		 */
+		UniquePtr< ProgressReporter > m_staging_progress;
+
+		/**
+		 The future signaling the completion of the scene being loaded in the 
+		 background of this engine.
+		 */
+		std::future< void > m_staging;
+
+		/**
+		 The thread loading a scene in the background of this engine.
+		 */
+		std::thread m_staging_thread;
+
+		/**
+		 A pointer to the script scheduler of this engine.
+		 */
+		UniquePtr< ScriptScheduler > m_script_scheduler;
+
+		/**
+		 Flag indicating whether this engine updates thread-safe behavior 
+		 scripts in parallel.
+		 */
+		bool m_parallel_scripts;
+
+		/**
+		 Flag indicating whether this engine renders each frame on a render 
+		 thread while updating the next frame.
+		 */
+		bool m_pipelined_rendering;
+
+		/**
+		 Flag indicating whether this engine records the commands of each 
+		 frame on the main thread and replays them on a render thread.
+		 */
+		bool m_command_recording;
+
+		/**
+		 The time (in seconds) the main thread of this engine waited for the 
+		 render thread to render the previous frame.
+		 */
+		TimeIntervalSeconds m_render_wait_time;
+
+		/**
+		 The time (in seconds) the main thread of this engine spent extracting 
+		 the render snapshot of the previous frame.
+		 */
+		TimeIntervalSeconds m_snapshot_time;
+
 		/**
 		 The timer of this engine.
 		 */
@@ -348,6 +567,42 @@ namespace mage {
 		 */
 		GameTime m_time;
 
+		/**
+		 The frame statistics of this engine.
+		 */
+		FrameStatistics m_frame_statistics;
+
+		/**
+		 A pointer to the input recorder of this engine.
+		 */
+		UniquePtr< input::InputRecorder > m_input_recorder;
+
+		/**
+		 The input frames to replay of this engine.
+		 */
+		std::vector< input::InputFrame > m_input_frames;
+
+		/**
+		 The index of the next input frame to replay of this engine. Only
+		 frames which would have been recorded advance this index.
+		 */
+		size_t m_input_frame;
+
+		/**
+		 Flag indicating whether this engine replays input frames.
+		 */
+		bool m_replay;
+
+		/**
+		 A pointer to the benchmark of this engine.
+		 */
+		UniquePtr< Benchmark > m_benchmark;
+
+		/**
+		 Flag indicating whether this engine runs headless.
+		 */
+		bool m_headless;
+
 		/**
 		 The fixed delta time (in seconds) of this engine.
 
@@ -366,6 +621,11 @@ namespace mage {
 		 */
 		bool m_deactive;
 
+		/**
+		 Flag indicating whether the application is paused or not.
+		 */
+		bool m_paused;
+
 		/**
 		 Flag indicating whether the application should switch between full
 		 screen and windowed mode.
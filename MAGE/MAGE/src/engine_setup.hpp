@@ -5,10 +5,20 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
+#include "system\timer.hpp"
 #include "type\types.hpp"
 
 #pragma endregion
 
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <filesystem>
+
+#pragma endregion
+
 //-----------------------------------------------------------------------------
 // Engine Declarations and Definitions
 //-----------------------------------------------------------------------------
@@ -36,7 +46,19 @@ namespace mage {
 		explicit EngineSetup(NotNull< HINSTANCE > instance, 
 							 std::wstring name = L"MAGE")
 			: m_instance(instance),
-			m_name(std::move(name)) {}
+			m_name(std::move(name)),
+			m_input_recording_path(),
+			m_input_replay_path(),
+			m_headless_resolution{ 1280u, 720u },
+			m_headless(false),
+			m_benchmark_path(),
+			m_nb_benchmark_frames(0u),
+			m_benchmark_delta_time(1.0 / 60.0),
+			m_target_frame_rate(0.0),
+			m_background_frame_rate(0.0),
+			m_parallel_scripts(false),
+			m_pipelined_rendering(false),
+			m_command_recording(false) {}
 
 		/**
 		 Constructs an engine setup from the given engine setup.
@@ -107,6 +129,305 @@ namespace mage {
 			return m_name;
 		}
 
+		/**
+		 Returns the path of the input recording file to record the input 
+		 frames to.
+
+		 @return		A reference to the path of the input recording file to 
+						record the input frames to. An empty path if the input 
+						frames are not recorded.
+		 */
+		[[nodiscard]]
+		const std::filesystem::path& GetInputRecordingPath() const noexcept {
+			return m_input_recording_path;
+		}
+
+		/**
+		 Sets the path of the input recording file to record the input frames 
+		 to.
+
+		 @param[in]		path
+						The path of the input recording file to record the 
+						input frames to. An empty path if the input frames 
+						must not be recorded.
+		 */
+		void SetInputRecordingPath(std::filesystem::path path) noexcept {
+			m_input_recording_path = std::move(path);
+		}
+
+		/**
+		 Returns the path of the input recording file to replay the input 
+		 frames from.
+
+		 @return		A reference to the path of the input recording file to 
+						replay the input frames from. An empty path if no input 
+						frames are replayed.
+		 */
+		[[nodiscard]]
+		const std::filesystem::path& GetInputReplayPath() const noexcept {
+			return m_input_replay_path;
+		}
+
+		/**
+		 Sets the path of the input recording file to replay the input frames 
+		 from.
+
+		 While replaying, the input devices and the timer are not polled, and 
+		 the engine terminates after the last input frame.
+
+		 @param[in]		path
+						The path of the input recording file to replay the 
+						input frames from. An empty path if no input frames 
+						must be replayed.
+		 */
+		void SetInputReplayPath(std::filesystem::path path) noexcept {
+			m_input_replay_path = std::move(path);
+		}
+
+		/**
+		 Checks whether the application runs headless.
+
+		 @return		@c true if the application runs headless. @c false 
+						otherwise.
+		 */
+		[[nodiscard]]
+		bool IsHeadless() const noexcept {
+			return m_headless 
+				|| !m_input_replay_path.empty() 
+				|| IsBenchmark();
+		}
+
+		/**
+		 Sets the headless flag of the application to the given value.
+
+		 A headless application does not ask for a display configuration and 
+		 keeps running while its window is not active.
+
+		 @param[in]		headless
+						@c true if the application must run headless. 
+						@c false otherwise.
+		 */
+		void SetHeadless(bool headless) noexcept {
+			m_headless = headless;
+		}
+
+		/**
+		 Returns the requested display resolution of the application if it 
+		 runs headless.
+
+		 @return		The requested display resolution of the application if 
+						it runs headless.
+		 */
+		[[nodiscard]]
+		const U32x2 GetHeadlessResolution() const noexcept {
+			return m_headless_resolution;
+		}
+
+		/**
+		 Sets the requested display resolution of the application if it runs 
+		 headless to the given resolution.
+
+		 @param[in]		resolution
+						The requested display resolution.
+		 */
+		void SetHeadlessResolution(const U32x2& resolution) noexcept {
+			m_headless_resolution = resolution;
+		}
+
+		/**
+		 Returns the target frame rate of the application.
+
+		 @return		The target frame rate (in frames per second) of the 
+						application. Zero if the frame rate is not limited.
+		 */
+		[[nodiscard]]
+		F64 GetTargetFrameRate() const noexcept {
+			return m_target_frame_rate;
+		}
+
+		/**
+		 Sets the target frame rate of the application to the given frame 
+		 rate.
+
+		 @param[in]		frame_rate
+						The target frame rate (in frames per second). Zero if 
+						the frame rate must not be limited.
+		 */
+		void SetTargetFrameRate(F64 frame_rate) noexcept {
+			m_target_frame_rate = frame_rate;
+		}
+
+		/**
+		 Returns the background frame rate of the application.
+
+		 @return		The maximum frame rate (in frames per second) of the 
+						application while its window is not active. Zero if 
+						the application is paused while its window is not 
+						active.
+		 */
+		[[nodiscard]]
+		F64 GetBackgroundFrameRate() const noexcept {
+			return m_background_frame_rate;
+		}
+
+		/**
+		 Sets the background frame rate of the application to the given frame 
+		 rate.
+
+		 @param[in]		frame_rate
+						The maximum frame rate (in frames per second) of the 
+						application while its window is not active. Zero if 
+						the application must be paused while its window is 
+						not active.
+		 */
+		void SetBackgroundFrameRate(F64 frame_rate) noexcept {
+			m_background_frame_rate = frame_rate;
+		}
+
+		/**
+		 Checks whether the application updates thread-safe behavior scripts 
+		 in parallel.
+
+		 @return		@c true if the application updates thread-safe 
+						behavior scripts in parallel. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool IsParallelScripts() const noexcept {
+			return m_parallel_scripts;
+		}
+
+		/**
+		 Sets the parallel scripts flag of the application to the given 
+		 value.
+
+		 @param[in]		parallel_scripts
+						@c true if the application must update thread-safe 
+						behavior scripts in parallel. @c false otherwise.
+		 */
+		void SetParallelScripts(bool parallel_scripts) noexcept {
+			m_parallel_scripts = parallel_scripts;
+		}
+
+		/**
+		 Checks whether the application renders each frame on a render 
+		 thread while updating the next frame.
+
+		 @return		@c true if the application renders each frame on a 
+						render thread while updating the next frame. 
+						@c false otherwise.
+		 */
+		[[nodiscard]]
+		bool IsPipelinedRendering() const noexcept {
+			return m_pipelined_rendering;
+		}
+
+		/**
+		 Sets the pipelined rendering flag of the application to the given 
+		 value.
+
+		 @param[in]		pipelined_rendering
+						@c true if the application must render each frame on 
+						a render thread while updating the next frame. 
+						@c false otherwise.
+		 */
+		void SetPipelinedRendering(bool pipelined_rendering) noexcept {
+			m_pipelined_rendering = pipelined_rendering;
+		}
+
+		/**
+		 Checks whether the application records the commands of each frame 
+		 on the main thread and replays them on a render thread.
+
+		 @return		@c true if the application records the commands of 
+						each frame on the main thread and replays them on a 
+						render thread. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool IsCommandRecording() const noexcept {
+			return m_command_recording;
+		}
+
+		/**
+		 Sets the command recording flag of the application to the given 
+		 value. Command recording implies pipelined rendering.
+
+		 @param[in]		command_recording
+						@c true if the application must record the commands 
+						of each frame on the main thread and replay them on a 
+						render thread. @c false otherwise.
+		 */
+		void SetCommandRecording(bool command_recording) noexcept {
+			m_command_recording = command_recording;
+		}
+
+		/**
+		 Checks whether the application runs a benchmark.
+
+		 @return		@c true if the application runs a benchmark. @c false 
+						otherwise.
+		 */
+		[[nodiscard]]
+		bool IsBenchmark() const noexcept {
+			return 0u != m_nb_benchmark_frames;
+		}
+
+		/**
+		 Returns the path of the benchmark report file.
+
+		 @return		A reference to the path of the benchmark report file.
+		 */
+		[[nodiscard]]
+		const std::filesystem::path& GetBenchmarkPath() const noexcept {
+			return m_benchmark_path;
+		}
+
+		/**
+		 Returns the number of frames to run of the benchmark.
+
+		 @return		The number of frames to run of the benchmark.
+		 */
+		[[nodiscard]]
+		U32 GetNumberOfBenchmarkFrames() const noexcept {
+			return m_nb_benchmark_frames;
+		}
+
+		/**
+		 Returns the fixed delta time of each frame of the benchmark.
+
+		 @return		The fixed delta time (in seconds) of each frame of the 
+						benchmark.
+		 */
+		[[nodiscard]]
+		TimeIntervalSeconds GetBenchmarkDeltaTime() const noexcept {
+			return m_benchmark_delta_time;
+		}
+
+		/**
+		 Sets the benchmark of the application.
+
+		 A benchmark runs headless with a hidden window and without 
+		 presenting. Each frame uses the given fixed delta time (and empty 
+		 input if no input frames are replayed). After the given number of 
+		 frames, the benchmark report is exported and the engine terminates.
+
+		 @param[in]		path
+						The path of the benchmark report file.
+		 @param[in]		nb_frames
+						The number of frames to run. Zero disables the 
+						benchmark.
+		 @param[in]		delta_time
+						The fixed delta time (in seconds) of each frame.
+		 */
+		void SetBenchmark(std::filesystem::path path, 
+						  U32 nb_frames, 
+						  TimeIntervalSeconds delta_time = 
+						  TimeIntervalSeconds(1.0 / 60.0)) noexcept {
+
+			m_benchmark_path       = std::move(path);
+			m_nb_benchmark_frames  = nb_frames;
+			m_benchmark_delta_time = delta_time;
+		}
+
 	private:
 
 		//---------------------------------------------------------------------
@@ -122,5 +443,70 @@ namespace mage {
 		 The name of the application.
 		 */
 		std::wstring m_name;
+
+		/**
+		 The path of the input recording file to record the input frames to.
+		 */
+		std::filesystem::path m_input_recording_path;
+
+		/**
+		 The path of the input recording file to replay the input frames from.
+		 */
+		std::filesystem::path m_input_replay_path;
+
+		/**
+		 The requested display resolution of the application if it runs 
+		 headless.
+		 */
+		U32x2 m_headless_resolution;
+
+		/**
+		 Flag indicating whether the application runs headless.
+		 */
+		bool m_headless;
+
+		/**
+		 The path of the benchmark report file.
+		 */
+		std::filesystem::path m_benchmark_path;
+
+		/**
+		 The number of frames to run of the benchmark.
+		 */
+		U32 m_nb_benchmark_frames;
+
+		/**
+		 The fixed delta time (in seconds) of each frame of the benchmark.
+		 */
+		TimeIntervalSeconds m_benchmark_delta_time;
+
+		/**
+		 The target frame rate (in frames per second) of the application.
+		 */
+		F64 m_target_frame_rate;
+
+		/**
+		 The maximum frame rate (in frames per second) of the application 
+		 while its window is not active.
+		 */
+		F64 m_background_frame_rate;
+
+		/**
+		 Flag indicating whether the application updates thread-safe behavior 
+		 scripts in parallel.
+		 */
+		bool m_parallel_scripts;
+
+		/**
+		 Flag indicating whether the application renders each frame on a 
+		 render thread while updating the next frame.
+		 */
+		bool m_pipelined_rendering;
+
+		/**
+		 Flag indicating whether the application records the commands of 
+		 each frame on the main thread and replays them on a render thread.
+		 */
+		bool m_command_recording;
 	};
 }
\ No newline at end of file
@@ -29,9 +29,16 @@ namespace mage {
 	//-------------------------------------------------------------------------
 
 	void Scene::Initialize(Engine& engine) {
+		Preload(engine);
+		Activate(engine);
+	}
+
+	void Scene::Preload(Engine& engine) {
 		// Loads this scene.
 		Load(engine);
+	}
 
+	void Scene::Activate(Engine& engine) {
 		// Loads the behavior scripts of this scene.
 		ForEach< BehaviorScript >([&engine](BehaviorScript& script) {
 			script.Load(engine);
@@ -60,6 +67,8 @@ namespace mage {
 	void Scene::Clear() noexcept {
 		m_nodes.clear();
 		m_scripts.clear();
+
+		Node::SetStructureDirty();
 	}
 
 	//-------------------------------------------------------------------------
@@ -104,6 +113,8 @@ namespace mage {
 						   model_part.m_nb_indices, 
 						   model_part.m_aabb, 
 						   model_part.m_sphere);
+			model->SetLODs(model_part.m_lods);
+			model->SetMeshlets(model_part.m_meshlets);
 			
 			// Set the material of the model component.
 			const auto material = desc.GetMaterial(model_part.m_material);
@@ -70,6 +70,31 @@ namespace mage {
 		 */
 		void Initialize(Engine& engine);
 
+		/**
+		 Preloads this scene (i.e. loads this scene without loading its 
+		 behavior scripts).
+
+		 Preloading may happen on a background thread, as long as the world 
+		 of the rendering manager is bound to a staging world on that thread 
+		 and the engine is only read.
+
+		 @param[in]		engine
+						A reference to the engine.
+		 @throws		Exception
+						Failed to preload this scene.
+		 */
+		void Preload(Engine& engine);
+
+		/**
+		 Activates this preloaded scene (i.e. loads its behavior scripts).
+
+		 @param[in]		engine
+						A reference to the engine.
+		 @throws		Exception
+						Failed to activate this scene.
+		 */
+		void Activate(Engine& engine);
+
 		/**
 		 Uninitializes this scene.
 
@@ -26,6 +26,8 @@ namespace mage {
 	inline typename std::enable_if_t< std::is_base_of_v< BehaviorScript, ElementT >,
 		ProxyPtr< ElementT > > Scene::Create(ConstructorArgsT&&... args) {
 
+		Node::SetStructureDirty();
+
 		return AddElementPtr< ElementT >(m_scripts,
 			                             std::forward< ConstructorArgsT >(args)...);
 	}
@@ -34,4 +34,9 @@ namespace mage {
 	void BehaviorScript::Update([[maybe_unused]] Engine& engine) {}
 
 	void BehaviorScript::Close([[maybe_unused]] Engine& engine) {}
+
+	[[nodiscard]]
+	const ScriptDependencies BehaviorScript::GetDependencies() const noexcept {
+		return ScriptDependencies();
+	}
 }
\ No newline at end of file
@@ -6,6 +6,7 @@
 #pragma region
 
 #include "engine.hpp"
+#include "scene\script\script_dependencies.hpp"
 
 #pragma endregion
 
@@ -14,6 +15,11 @@
 //-----------------------------------------------------------------------------
 namespace mage {
 
+	//-------------------------------------------------------------------------
+	// BehaviorScript
+	//-------------------------------------------------------------------------
+	#pragma region
+
 	/**
 	 A class of behavior scripts.
 	 */
@@ -105,6 +111,24 @@ namespace mage {
 		 */
 		virtual void Close([[maybe_unused]] Engine& engine);
 
+		/**
+		 Returns the script dependencies of this behavior script.
+
+		 If the engine updates scripts in parallel, behavior scripts declared 
+		 thread-safe are updated on worker threads. Such behavior scripts may 
+		 only access the node hierarchy of their owner and the declared 
+		 shared accesses, may only read the engine, and must defer structural 
+		 changes (e.g., creating or destroying nodes, requesting scenes) via 
+		 Engine::Defer. By default, behavior scripts are not thread-safe.
+
+		 Behavior scripts whose script dependencies change after they are 
+		 created, must call SetDependenciesDirty.
+
+		 @return		The script dependencies of this behavior script.
+		 */
+		[[nodiscard]]
+		virtual const ScriptDependencies GetDependencies() const noexcept;
+
 	protected:
 
 		//---------------------------------------------------------------------
@@ -131,5 +155,22 @@ namespace mage {
 						A reference to the behavior script to move.
 		 */
 		BehaviorScript(BehaviorScript&& script) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Marks the script dependencies of this behavior script as changed, 
+		 so that the behavior scripts are rescheduled before their next 
+		 update.
+
+		 This method is thread-safe.
+		 */
+		void SetDependenciesDirty() const noexcept {
+			Node::SetStructureDirty();
+		}
 	};
+
+	#pragma endregion
 }
\ No newline at end of file
@@ -0,0 +1,189 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "type\types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	//-------------------------------------------------------------------------
+	// ScriptAccess
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 An enumeration of the different shared accesses of behavior scripts 
+	 (i.e. the kinds of components a behavior script accesses of nodes outside 
+	 the node hierarchy of its owner).
+
+	 This contains: 
+	 @c None,
+	 @c Transform,
+	 @c Camera,
+	 @c Light,
+	 @c Model,
+	 @c Sprite,
+	 @c Script and
+	 @c All.
+	 */
+	enum class ScriptAccess : U32 {
+		None      = 0u,
+		Transform = 1u,
+		Camera    = 2u,
+		Light     = 4u,
+		Model     = 8u,
+		Sprite    = 16u,
+		Script    = 32u,
+		All       = 0xFFFFFFFFu
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// ScriptDependencies
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A class of script dependencies.
+
+	 The script dependencies of a behavior script declare whether the behavior 
+	 script may be updated in parallel with other behavior scripts, and which 
+	 kinds of components it reads and writes of nodes outside the node 
+	 hierarchy of its owner. The node hierarchy of its owner (i.e. all nodes 
+	 sharing the same root node) is always accessible.
+	 */
+	class ScriptDependencies final {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs script dependencies without shared accesses.
+
+		 @param[in]		thread_safe
+						@c true if the behavior script may be updated in 
+						parallel with other behavior scripts. @c false 
+						otherwise.
+		 */
+		constexpr explicit ScriptDependencies(bool thread_safe = false) noexcept
+			: m_thread_safe(thread_safe),
+			m_reads(0u),
+			m_writes(0u) {}
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Checks whether the behavior script of these script dependencies may 
+		 be updated in parallel with other behavior scripts.
+
+		 @return		@c true if the behavior script of these script 
+						dependencies may be updated in parallel with other 
+						behavior scripts. @c false otherwise.
+		 */
+		[[nodiscard]]
+		constexpr bool IsThreadSafe() const noexcept {
+			return m_thread_safe;
+		}
+
+		/**
+		 Declares a shared read access of these script dependencies.
+
+		 @param[in]		access
+						The shared access.
+		 @return		A reference to these script dependencies.
+		 */
+		constexpr ScriptDependencies& Read(ScriptAccess access) noexcept {
+			m_reads |= static_cast< U32 >(access);
+			return *this;
+		}
+
+		/**
+		 Declares a shared write access of these script dependencies. A 
+		 write access implies a read access.
+
+		 @param[in]		access
+						The shared access.
+		 @return		A reference to these script dependencies.
+		 */
+		constexpr ScriptDependencies& Write(ScriptAccess access) noexcept {
+			m_reads  |= static_cast< U32 >(access);
+			m_writes |= static_cast< U32 >(access);
+			return *this;
+		}
+
+		/**
+		 Merges the shared accesses of the given script dependencies into 
+		 these script dependencies.
+
+		 @param[in]		dependencies
+						A reference to the script dependencies.
+		 @return		A reference to these script dependencies.
+		 */
+		constexpr ScriptDependencies& Merge(
+			const ScriptDependencies& dependencies) noexcept {
+
+			m_reads  |= dependencies.m_reads;
+			m_writes |= dependencies.m_writes;
+			return *this;
+		}
+
+		/**
+		 Checks whether the shared accesses of these script dependencies 
+		 conflict with the shared accesses of the given script dependencies 
+		 (i.e. whether one of both writes what the other one reads).
+
+		 @param[in]		dependencies
+						A reference to the script dependencies.
+		 @return		@c true if the shared accesses of these script 
+						dependencies conflict with the shared accesses of the 
+						given script dependencies. @c false otherwise.
+		 */
+		[[nodiscard]]
+		constexpr bool Conflicts(
+			const ScriptDependencies& dependencies) const noexcept {
+
+			return (0u != (m_writes & dependencies.m_reads))
+				|| (0u != (m_reads & dependencies.m_writes));
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A flag indicating whether the behavior script of these script 
+		 dependencies may be updated in parallel with other behavior scripts.
+		 */
+		bool m_thread_safe;
+
+		/**
+		 The shared read accesses (bit mask of ScriptAccess values) of these 
+		 script dependencies.
+		 */
+		U32 m_reads;
+
+		/**
+		 The shared write accesses (bit mask of ScriptAccess values) of 
+		 these script dependencies.
+		 */
+		U32 m_writes;
+	};
+
+	#pragma endregion
+}
\ No newline at end of file
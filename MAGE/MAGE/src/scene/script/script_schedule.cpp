@@ -0,0 +1,161 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "scene\script\script_schedule.hpp"
+#include "parallel\parallel.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <unordered_map>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	namespace {
+
+		/**
+		 The number of chunks of jobs per system core of each batch. More
+		 chunks balance the load of unequal jobs at the expense of more
+		 scheduling overhead.
+		 */
+		constexpr size_t g_nb_chunks_per_core = 4u;
+
+		/**
+		 The schedule key of the task that is executed on the current thread.
+		 */
+		thread_local size_t t_current_key = 0u;
+	}
+
+	//-------------------------------------------------------------------------
+	// ScriptSchedule
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	[[nodiscard]]
+	size_t ScriptSchedule::GetCurrentKey() noexcept {
+		return t_current_key;
+	}
+
+	ScriptSchedule::ScriptSchedule()
+		: m_tasks(),
+		m_jobs(),
+		m_batches() {}
+
+	ScriptSchedule::ScriptSchedule(const ScriptSchedule& schedule) = default;
+
+	ScriptSchedule::ScriptSchedule(ScriptSchedule&& schedule) noexcept = default;
+
+	ScriptSchedule::~ScriptSchedule() = default;
+
+	ScriptSchedule& ScriptSchedule
+		::operator=(const ScriptSchedule& schedule) = default;
+
+	ScriptSchedule& ScriptSchedule
+		::operator=(ScriptSchedule&& schedule) noexcept = default;
+
+	void ScriptSchedule::Build(const std::vector< Task >& tasks) {
+		m_tasks.clear();
+		m_jobs.clear();
+		m_batches.clear();
+
+		// Group the tasks per group.
+		std::unordered_map< const void*, size_t > job_indices;
+		std::vector< std::vector< size_t > > job_tasks;
+		std::vector< ScriptDependencies > job_dependencies;
+
+		for (size_t task = 0u; task < tasks.size(); ++task) {
+			const auto [it, inserted]
+				= job_indices.try_emplace(tasks[task].m_group, job_tasks.size());
+			if (inserted) {
+				job_tasks.emplace_back();
+				job_dependencies.emplace_back(true);
+			}
+
+			job_tasks[it->second].push_back(task);
+			job_dependencies[it->second].Merge(tasks[task].m_dependencies);
+		}
+
+		// Assign each job to the batch following the last batch with
+		// conflicting shared accesses.
+		std::vector< std::vector< size_t > > batch_jobs;
+		std::vector< ScriptDependencies > batch_dependencies;
+
+		for (size_t job = 0u; job < job_tasks.size(); ++job) {
+			auto batch = batch_jobs.size();
+			while (0u != batch
+				   && !batch_dependencies[batch - 1u].Conflicts(job_dependencies[job])) {
+				--batch;
+			}
+
+			if (batch_jobs.size() == batch) {
+				batch_jobs.emplace_back();
+				batch_dependencies.emplace_back(true);
+			}
+
+			batch_jobs[batch].push_back(job);
+			batch_dependencies[batch].Merge(job_dependencies[job]);
+		}
+
+		// Flatten the batches and jobs.
+		m_tasks.reserve(tasks.size());
+		m_jobs.reserve(job_tasks.size());
+		m_batches.reserve(batch_jobs.size());
+
+		for (const auto& jobs : batch_jobs) {
+			m_batches.push_back({ m_jobs.size(), m_jobs.size() + jobs.size() });
+
+			for (const auto job : jobs) {
+				const auto& job_task_indices = job_tasks[job];
+				m_jobs.push_back({ m_tasks.size(),
+					               m_tasks.size() + job_task_indices.size() });
+				m_tasks.insert(m_tasks.end(),
+							   job_task_indices.cbegin(), job_task_indices.cend());
+			}
+		}
+	}
+
+	void ScriptSchedule::Execute(const std::function< void(size_t) >& action) const {
+		const auto nb_cores
+			= std::max(static_cast< size_t >(NumberOfSystemCores()), size_t(1u));
+
+		for (const auto& batch : m_batches) {
+			const auto nb_jobs   = batch.m_end - batch.m_begin;
+			const auto nb_chunks = std::min(nb_jobs,
+											nb_cores * g_nb_chunks_per_core);
+
+			ParallelFor(0u, nb_chunks, [&](size_t chunk) {
+				const auto begin = batch.m_begin + chunk * nb_jobs / nb_chunks;
+				const auto end   = batch.m_begin + (chunk + 1u) * nb_jobs / nb_chunks;
+
+				try {
+					for (auto job = begin; job < end; ++job) {
+						for (auto i = m_jobs[job].m_begin; i < m_jobs[job].m_end; ++i) {
+							t_current_key = i + 1u;
+							action(m_tasks[i]);
+						}
+					}
+				}
+				catch (...) {
+					t_current_key = 0u;
+					throw;
+				}
+
+				t_current_key = 0u;
+			});
+		}
+	}
+
+	#pragma endregion
+}
\ No newline at end of file
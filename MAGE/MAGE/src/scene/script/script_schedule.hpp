@@ -0,0 +1,413 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "scene\script\script_dependencies.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <functional>
+#include <mutex>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	//-------------------------------------------------------------------------
+	// ScriptSchedule
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A class of script schedules for executing thread-safe tasks (i.e. the
+	 updates of thread-safe behavior scripts) in parallel.
+
+	 The tasks are grouped into jobs per group (i.e. per node hierarchy,
+	 since a transform change propagates through the node hierarchy). A job
+	 executes its tasks one after the other in the order of addition. Jobs
+	 with conflicting shared accesses are assigned to consecutive batches in
+	 the order of addition. The batches are executed one after the other, the
+	 jobs of a batch in parallel.
+
+	 The schedule keys identify the positions of the tasks in the schedule.
+	 The schedule key of the task executed on the current thread is zero
+	 outside task executions and the position of the task in the schedule
+	 plus one otherwise.
+	 */
+	class ScriptSchedule final {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 A struct of tasks.
+		 */
+		struct Task final {
+
+		public:
+
+			/**
+			 A pointer to the group of this task (i.e. the root node of the
+			 node hierarchy of the owner of the behavior script).
+			 */
+			const void* m_group;
+
+			/**
+			 The script dependencies of this task.
+			 */
+			ScriptDependencies m_dependencies;
+		};
+
+		/**
+		 A struct of ranges of schedule elements.
+		 */
+		struct Range final {
+
+		public:
+
+			/**
+			 The first index of this range.
+			 */
+			size_t m_begin;
+
+			/**
+			 The end index (exclusive) of this range.
+			 */
+			size_t m_end;
+		};
+
+		//---------------------------------------------------------------------
+		// Class Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the schedule key of the task executed on the current thread.
+
+		 @return		The schedule key of the task executed on the current
+						thread.
+		 */
+		[[nodiscard]]
+		static size_t GetCurrentKey() noexcept;
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs an empty script schedule.
+		 */
+		ScriptSchedule();
+
+		/**
+		 Constructs a script schedule from the given script schedule.
+
+		 @param[in]		schedule
+						A reference to the script schedule to copy.
+		 */
+		ScriptSchedule(const ScriptSchedule& schedule);
+
+		/**
+		 Constructs a script schedule by moving the given script schedule.
+
+		 @param[in]		schedule
+						A reference to the script schedule to move.
+		 */
+		ScriptSchedule(ScriptSchedule&& schedule) noexcept;
+
+		/**
+		 Destructs this script schedule.
+		 */
+		~ScriptSchedule();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given script schedule to this script schedule.
+
+		 @param[in]		schedule
+						A reference to the script schedule to copy.
+		 @return		A reference to the copy of the given script schedule
+						(i.e. this script schedule).
+		 */
+		ScriptSchedule& operator=(const ScriptSchedule& schedule);
+
+		/**
+		 Moves the given script schedule to this script schedule.
+
+		 @param[in]		schedule
+						A reference to the script schedule to move.
+		 @return		A reference to the moved script schedule (i.e. this
+						script schedule).
+		 */
+		ScriptSchedule& operator=(ScriptSchedule&& schedule) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Rebuilds this script schedule for the given tasks.
+
+		 @param[in]		tasks
+						A reference to a vector containing the tasks.
+		 */
+		void Build(const std::vector< Task >& tasks);
+
+		/**
+		 Returns the tasks (i.e. indices into the tasks this script schedule
+		 is built for) of this script schedule in schedule order.
+
+		 @return		A reference to a vector containing the tasks of this
+						script schedule in schedule order.
+		 */
+		[[nodiscard]]
+		const std::vector< size_t >& GetTasks() const noexcept {
+			return m_tasks;
+		}
+
+		/**
+		 Returns the jobs (i.e. ranges of tasks in schedule order) of this
+		 script schedule.
+
+		 @return		A reference to a vector containing the jobs of this
+						script schedule.
+		 */
+		[[nodiscard]]
+		const std::vector< Range >& GetJobs() const noexcept {
+			return m_jobs;
+		}
+
+		/**
+		 Returns the batches (i.e. ranges of jobs) of this script schedule.
+
+		 @return		A reference to a vector containing the batches of this
+						script schedule.
+		 */
+		[[nodiscard]]
+		const std::vector< Range >& GetBatches() const noexcept {
+			return m_batches;
+		}
+
+		/**
+		 Executes the given action for each task of this script schedule.
+
+		 @param[in]		action
+						A reference to the action, which is called with the
+						task (i.e. the index into the tasks this script
+						schedule is built for).
+		 @throws		Exception
+						Failed to execute the given action for some task (i.e.
+						the first exception thrown by the given action is
+						rethrown after all threads have finished).
+		 */
+		void Execute(const std::function< void(size_t) >& action) const;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The tasks of this script schedule in schedule order.
+		 */
+		std::vector< size_t > m_tasks;
+
+		/**
+		 The jobs (i.e. ranges of tasks) of this script schedule.
+		 */
+		std::vector< Range > m_jobs;
+
+		/**
+		 The batches (i.e. ranges of jobs) of this script schedule.
+		 */
+		std::vector< Range > m_batches;
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// DeferredCommandQueue
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A class of deferred command queues.
+
+	 The commands are ordered by the schedule key of the task that deferred
+	 them (see ScriptSchedule::GetCurrentKey), so their order only depends on
+	 the script schedule (and not on the thread timings). The commands
+	 deferred by a single task are deferred by a single thread and thus keep
+	 their order.
+
+	 @tparam		CommandT
+					The command type.
+	 */
+	template< typename CommandT >
+	class DeferredCommandQueue final {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs an empty deferred command queue.
+		 */
+		DeferredCommandQueue() = default;
+
+		/**
+		 Constructs a deferred command queue from the given deferred command
+		 queue.
+
+		 @param[in]		queue
+						A reference to the deferred command queue to copy.
+		 */
+		DeferredCommandQueue(const DeferredCommandQueue& queue) = delete;
+
+		/**
+		 Constructs a deferred command queue by moving the given deferred
+		 command queue.
+
+		 @param[in]		queue
+						A reference to the deferred command queue to move.
+		 */
+		DeferredCommandQueue(DeferredCommandQueue&& queue) = delete;
+
+		/**
+		 Destructs this deferred command queue.
+		 */
+		~DeferredCommandQueue() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given deferred command queue to this deferred command
+		 queue.
+
+		 @param[in]		queue
+						A reference to the deferred command queue to copy.
+		 @return		A reference to the copy of the given deferred command
+						queue (i.e. this deferred command queue).
+		 */
+		DeferredCommandQueue& operator=(
+			const DeferredCommandQueue& queue) = delete;
+
+		/**
+		 Moves the given deferred command queue to this deferred command
+		 queue.
+
+		 @param[in]		queue
+						A reference to the deferred command queue to move.
+		 @return		A reference to the moved deferred command queue (i.e.
+						this deferred command queue).
+		 */
+		DeferredCommandQueue& operator=(
+			DeferredCommandQueue&& queue) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Defers the given command.
+
+		 This method is thread-safe.
+
+		 @param[in]		command
+						The command.
+		 */
+		void Defer(CommandT command);
+
+		/**
+		 Checks whether this deferred command queue has commands.
+
+		 This method is thread-safe.
+
+		 @return		@c true if this deferred command queue has commands.
+						@c false otherwise.
+		 */
+		[[nodiscard]]
+		bool HasCommands() const;
+
+		/**
+		 Removes all commands of this deferred command queue.
+
+		 This method is thread-safe.
+
+		 @return		A vector containing the removed commands in execution
+						order.
+		 */
+		[[nodiscard]]
+		std::vector< CommandT > Pop();
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 A struct of keyed commands.
+		 */
+		struct KeyedCommand final {
+
+		public:
+
+			/**
+			 The schedule key of the task that deferred this keyed command.
+			 */
+			size_t m_key;
+
+			/**
+			 The command of this keyed command.
+			 */
+			CommandT m_command;
+		};
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The commands of this deferred command queue.
+		 */
+		std::vector< KeyedCommand > m_commands;
+
+		/**
+		 The mutex for accessing the commands of this deferred command queue.
+		 */
+		mutable std::mutex m_mutex;
+	};
+
+	#pragma endregion
+}
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "scene\script\script_schedule.tpp"
+
+#pragma endregion
\ No newline at end of file
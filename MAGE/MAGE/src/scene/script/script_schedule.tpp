@@ -0,0 +1,54 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	template< typename CommandT >
+	void DeferredCommandQueue< CommandT >::Defer(CommandT command) {
+		const auto key = ScriptSchedule::GetCurrentKey();
+
+		const std::lock_guard< std::mutex > lock(m_mutex);
+		m_commands.push_back({ key, std::move(command) });
+	}
+
+	template< typename CommandT >
+	[[nodiscard]]
+	bool DeferredCommandQueue< CommandT >::HasCommands() const {
+		const std::lock_guard< std::mutex > lock(m_mutex);
+		return !m_commands.empty();
+	}
+
+	template< typename CommandT >
+	[[nodiscard]]
+	std::vector< CommandT > DeferredCommandQueue< CommandT >::Pop() {
+		std::vector< KeyedCommand > keyed_commands;
+		{
+			const std::lock_guard< std::mutex > lock(m_mutex);
+			keyed_commands.swap(m_commands);
+		}
+
+		std::stable_sort(keyed_commands.begin(), keyed_commands.end(),
+			[](const KeyedCommand& lhs, const KeyedCommand& rhs) noexcept {
+				return lhs.m_key < rhs.m_key;
+			});
+
+		std::vector< CommandT > commands;
+		commands.reserve(keyed_commands.size());
+		for (auto& keyed_command : keyed_commands) {
+			commands.push_back(std::move(keyed_command.m_command));
+		}
+
+		return commands;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,127 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "scene\script\script_scheduler.hpp"
+#include "scene\scene.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	namespace {
+
+		/**
+		 Returns the root node of the node hierarchy of the owner of the
+		 given behavior script.
+
+		 @param[in]		script
+						A reference to the behavior script.
+		 @return		A pointer to the root node of the node hierarchy of
+						the owner of the given behavior script.
+		 @return		A pointer to the given behavior script if the given
+						behavior script has no owner.
+		 */
+		[[nodiscard]]
+		const void* GetRoot(const BehaviorScript& script) noexcept {
+			if (!script.HasOwner()) {
+				return &script;
+			}
+
+			const Node* node = script.GetOwner().Get();
+			while (node->HasParent()) {
+				node = node->GetParent().Get();
+			}
+
+			return node;
+		}
+	}
+
+	ScriptScheduler::ScriptScheduler()
+		: m_scene(nullptr),
+		m_serial_scripts(),
+		m_parallel_scripts(),
+		m_schedule(),
+		m_commands() {}
+
+	ScriptScheduler::~ScriptScheduler() = default;
+
+	void ScriptScheduler::Update(Scene& scene, Engine& engine,
+								 UpdateMethod update, bool interruptible) {
+		Schedule(scene);
+
+		const auto interrupted = [&engine, interruptible]() noexcept {
+			return interruptible && engine.HasRequestedScene();
+		};
+
+		// Update the non-thread-safe behavior scripts.
+		for (const auto script : m_serial_scripts) {
+			if (interrupted()) {
+				return;
+			}
+
+			if (State::Active == script->GetState()) {
+				(script->*update)(engine);
+			}
+		}
+
+		if (interrupted()) {
+			return;
+		}
+
+		// Update the thread-safe behavior scripts.
+		m_schedule.Execute([this, &engine, update](size_t task) {
+			const auto script = m_parallel_scripts[task];
+			if (State::Active == script->GetState()) {
+				(script->*update)(engine);
+			}
+		});
+	}
+
+	void ScriptScheduler::Defer(Command command) {
+		m_commands.Defer(std::move(command));
+	}
+
+	[[nodiscard]]
+	bool ScriptScheduler::HasCommands() const {
+		return m_commands.HasCommands();
+	}
+
+	void ScriptScheduler::ExecuteCommands(Engine& engine) {
+		for (auto& command : m_commands.Pop()) {
+			command(engine);
+		}
+	}
+
+	void ScriptScheduler::Schedule(Scene& scene) {
+		// The flag is always reset, so that changes made while rebuilding 
+		// are detected by the next call.
+		const auto dirty = Node::ResetStructureDirty();
+		if (&scene == m_scene && !dirty) {
+			return;
+		}
+
+		m_scene = &scene;
+
+		m_serial_scripts.clear();
+		m_parallel_scripts.clear();
+
+		std::vector< ScriptSchedule::Task > tasks;
+		scene.ForEach< BehaviorScript >([&](BehaviorScript& script) {
+			const auto dependencies = script.GetDependencies();
+			if (dependencies.IsThreadSafe()) {
+				m_parallel_scripts.push_back(&script);
+				tasks.push_back({ GetRoot(script), dependencies });
+			}
+			else {
+				m_serial_scripts.push_back(&script);
+			}
+		});
+
+		m_schedule.Build(tasks);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,231 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "scene\script\script_schedule.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <functional>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	// Forward declarations.
+	class BehaviorScript;
+	class Engine;
+	class Scene;
+
+	/**
+	 A class of script schedulers for updating the behavior scripts of a scene
+	 in parallel.
+
+	 Behavior scripts that are not thread-safe are updated first, one after
+	 the other in scene order, on the calling thread. The thread-safe
+	 behavior scripts are updated next according to a script schedule (see
+	 ScriptSchedule) with one task per behavior script in scene order, grouped
+	 per node hierarchy.
+
+	 Deferred commands are executed on the calling thread after all behavior
+	 scripts are updated, in an order that only depends on the schedule (and
+	 not on the thread timings).
+	 */
+	class ScriptScheduler final {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 The type of update methods of behavior scripts.
+		 */
+		using UpdateMethod = void (BehaviorScript::*)(Engine&);
+
+		/**
+		 The type of deferred commands.
+		 */
+		using Command = std::function< void(Engine&) >;
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a script scheduler.
+		 */
+		ScriptScheduler();
+
+		/**
+		 Constructs a script scheduler from the given script scheduler.
+
+		 @param[in]		scheduler
+						A reference to the script scheduler to copy.
+		 */
+		ScriptScheduler(const ScriptScheduler& scheduler) = delete;
+
+		/**
+		 Constructs a script scheduler by moving the given script scheduler.
+
+		 @param[in]		scheduler
+						A reference to the script scheduler to move.
+		 */
+		ScriptScheduler(ScriptScheduler&& scheduler) = delete;
+
+		/**
+		 Destructs this script scheduler.
+		 */
+		~ScriptScheduler();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given script scheduler to this script scheduler.
+
+		 @param[in]		scheduler
+						A reference to the script scheduler to copy.
+		 @return		A reference to the copy of the given script scheduler
+						(i.e. this script scheduler).
+		 */
+		ScriptScheduler& operator=(const ScriptScheduler& scheduler) = delete;
+
+		/**
+		 Moves the given script scheduler to this script scheduler.
+
+		 @param[in]		scheduler
+						A reference to the script scheduler to move.
+		 @return		A reference to the moved script scheduler (i.e. this
+						script scheduler).
+		 */
+		ScriptScheduler& operator=(ScriptScheduler&& scheduler) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Updates the active behavior scripts of the given scene.
+
+		 The schedule is rebuilt if the behavior scripts, their script 
+		 dependencies or the node hierarchies changed since the schedule was 
+		 built (i.e. if the structure of the scenes is marked as changed).
+
+		 @param[in]		scene
+						A reference to the scene.
+		 @param[in]		engine
+						A reference to the engine.
+		 @param[in]		update
+						The update method to call.
+		 @param[in]		interruptible
+						@c true if no further behavior scripts must be updated
+						once the given engine has a requested scene. @c false
+						otherwise.
+		 @throws		Exception
+						Failed to update the behavior scripts (i.e. the first
+						exception thrown by a behavior script is rethrown).
+		 */
+		void Update(Scene& scene, Engine& engine,
+					UpdateMethod update, bool interruptible);
+
+		/**
+		 Defers the given command until all behavior scripts are updated.
+
+		 This method is thread-safe.
+
+		 @param[in]		command
+						The command.
+		 */
+		void Defer(Command command);
+
+		/**
+		 Checks whether this script scheduler has deferred commands.
+
+		 This method is thread-safe.
+
+		 @return		@c true if this script scheduler has deferred 
+						commands. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool HasCommands() const;
+
+		/**
+		 Executes the deferred commands of this script scheduler.
+
+		 @param[in]		engine
+						A reference to the engine.
+		 @throws		Exception
+						Failed to execute the deferred commands.
+		 */
+		void ExecuteCommands(Engine& engine);
+
+		/**
+		 Invalidates the schedule of this script scheduler.
+		 */
+		void Invalidate() noexcept {
+			m_scene = nullptr;
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Rebuilds the schedule of this script scheduler if the given scene is
+		 not the scheduled scene or the structure of the scenes changed.
+
+		 @param[in]		scene
+						A reference to the scene.
+		 */
+		void Schedule(Scene& scene);
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A pointer to the scheduled scene of this script scheduler.
+		 */
+		const Scene* m_scene;
+
+		/**
+		 The behavior scripts which are not thread-safe of this script
+		 scheduler.
+		 */
+		std::vector< BehaviorScript* > m_serial_scripts;
+
+		/**
+		 The thread-safe behavior scripts (i.e. the tasks of the schedule) of
+		 this script scheduler in scene order.
+		 */
+		std::vector< BehaviorScript* > m_parallel_scripts;
+
+		/**
+		 The schedule of the thread-safe behavior scripts of this script
+		 scheduler.
+		 */
+		ScriptSchedule m_schedule;
+
+		/**
+		 The deferred commands of this script scheduler.
+		 */
+		DeferredCommandQueue< Command > m_commands;
+	};
+}
\ No newline at end of file
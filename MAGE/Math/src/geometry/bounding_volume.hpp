@@ -1373,6 +1373,26 @@ namespace mage {
 		[[nodiscard]]
 		bool OverlapsStrict(const BoundingSphere& sphere) const noexcept;
 
+		//---------------------------------------------------------------------
+		// Member Methods: Planes
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the plane of this bounding frustum at the given index.
+
+		 The planes are inward facing, normalized and ordered as follows: 
+		 left, right, bottom, top, near, far.
+
+		 @pre			@a index < 6.
+		 @param[in]		index
+						The index of the plane.
+		 @return		The plane of this bounding frustum at the given index.
+		 */
+		[[nodiscard]]
+		const XMVECTOR XM_CALLCONV GetPlane(size_t index) const noexcept {
+			return m_planes[index];
+		}
+
 		//---------------------------------------------------------------------
 		// Member Methods: Operators
 		//---------------------------------------------------------------------
@@ -0,0 +1,233 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "geometry\triangle_bvh.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	namespace {
+
+		/**
+		 The maximum number of triangles per leaf node.
+		 */
+		constexpr size_t g_max_nb_leaf_triangles = 4u;
+
+		/**
+		 The maximum depth of the traversal stack.
+		 */
+		constexpr size_t g_max_stack_depth = 64u;
+	}
+
+	TriangleBVH::TriangleBVH(std::vector< F32x3 > vertices)
+		: m_vertices(std::move(vertices)),
+		m_indices(),
+		m_nodes() {
+
+		const auto nb_triangles = GetNumberOfTriangles();
+		m_vertices.resize(3u * nb_triangles);
+		if (0u == nb_triangles) {
+			return;
+		}
+
+		std::vector< F32x3 > centroids(nb_triangles);
+		for (size_t i = 0u; i < nb_triangles; ++i) {
+			const auto p0 = XMLoad(m_vertices[3u * i]);
+			const auto p1 = XMLoad(m_vertices[3u * i + 1u]);
+			const auto p2 = XMLoad(m_vertices[3u * i + 2u]);
+			centroids[i]  = XMStore< F32x3 >((p0 + p1 + p2) / 3.0f);
+		}
+
+		m_indices.resize(nb_triangles);
+		std::iota(m_indices.begin(), m_indices.end(), 0u);
+		m_nodes.reserve(2u * nb_triangles / g_max_nb_leaf_triangles + 1u);
+
+		Build(centroids, 0u, nb_triangles);
+	}
+
+	TriangleBVH::TriangleBVH(const TriangleBVH& bvh) = default;
+
+	TriangleBVH::TriangleBVH(TriangleBVH&& bvh) noexcept = default;
+
+	TriangleBVH::~TriangleBVH() = default;
+
+	TriangleBVH& TriangleBVH::operator=(const TriangleBVH& bvh) = default;
+
+	TriangleBVH& TriangleBVH::operator=(TriangleBVH&& bvh) noexcept = default;
+
+	bool XM_CALLCONV TriangleBVH::Intersect(FXMVECTOR origin, 
+											FXMVECTOR direction, 
+											F32 t_max, 
+											Hit& hit) const noexcept {
+
+		return Traverse(origin, direction, t_max, hit, false);
+	}
+
+	bool XM_CALLCONV TriangleBVH::IsOccluded(FXMVECTOR origin, 
+											 FXMVECTOR direction, 
+											 F32 t_max) const noexcept {
+		Hit hit;
+		return Traverse(origin, direction, t_max, hit, true);
+	}
+
+	U32 TriangleBVH::Build(const std::vector< F32x3 >& centroids, 
+						   size_t begin, size_t end) {
+
+		const auto index = static_cast< U32 >(m_nodes.size());
+		m_nodes.emplace_back();
+
+		// Compute the bounds of the triangles and of their centroids.
+		auto p_min = XMVectorReplicate( std::numeric_limits< F32 >::infinity());
+		auto p_max = XMVectorReplicate(-std::numeric_limits< F32 >::infinity());
+		auto c_min = p_min;
+		auto c_max = p_max;
+		for (auto i = begin; i < end; ++i) {
+			const auto t = m_indices[i];
+			for (size_t j = 0u; j < 3u; ++j) {
+				const auto p = XMLoad(m_vertices[3u * t + j]);
+				p_min = XMVectorMin(p_min, p);
+				p_max = XMVectorMax(p_max, p);
+			}
+
+			const auto c = XMLoad(centroids[t]);
+			c_min = XMVectorMin(c_min, c);
+			c_max = XMVectorMax(c_max, c);
+		}
+
+		m_nodes[index].m_min = XMStore< F32x3 >(p_min);
+		m_nodes[index].m_max = XMStore< F32x3 >(p_max);
+
+		// Select the largest axis of the centroid bounds.
+		const auto extent = XMStore< F32x3 >(c_max - c_min);
+		const size_t axis = (extent[0] < extent[1]) 
+			? ((extent[1] < extent[2]) ? 2u : 1u) 
+			: ((extent[0] < extent[2]) ? 2u : 0u);
+
+		if (end - begin <= g_max_nb_leaf_triangles || 0.0f >= extent[axis]) {
+			m_nodes[index].m_offset       = static_cast< U32 >(begin);
+			m_nodes[index].m_nb_triangles = static_cast< U32 >(end - begin);
+			return index;
+		}
+
+		// Split at the median centroid (ties are broken by triangle index to 
+		// obtain a deterministic hierarchy).
+		const auto middle = begin + (end - begin) / 2u;
+		std::nth_element(m_indices.begin() + begin, 
+						 m_indices.begin() + middle, 
+						 m_indices.begin() + end, 
+			[&centroids, axis](U32 lhs, U32 rhs) noexcept {
+				const auto lhs_c = centroids[lhs][axis];
+				const auto rhs_c = centroids[rhs][axis];
+				return (lhs_c < rhs_c) || (lhs_c == rhs_c && lhs < rhs);
+			});
+
+		Build(centroids, begin, middle);
+		const auto second = Build(centroids, middle, end);
+		m_nodes[index].m_offset = second;
+
+		return index;
+	}
+
+	bool XM_CALLCONV TriangleBVH::Traverse(FXMVECTOR origin, 
+										   FXMVECTOR direction, 
+										   F32 t_max, 
+										   Hit& hit, 
+										   bool any_hit) const noexcept {
+		if (m_nodes.empty()) {
+			return false;
+		}
+
+		const auto inv_direction = XMVectorReciprocal(direction);
+		auto t_closest = t_max;
+		auto found     = false;
+
+		U32 stack[g_max_stack_depth];
+		size_t stack_size = 0u;
+		stack[stack_size++] = 0u;
+
+		while (0u != stack_size) {
+			const auto& node = m_nodes[stack[--stack_size]];
+
+			// Slab test against the bounds of the node.
+			const auto t0     = (XMLoad(node.m_min) - origin) * inv_direction;
+			const auto t1     = (XMLoad(node.m_max) - origin) * inv_direction;
+			const auto t_near = XMStore< F32x3 >(XMVectorMin(t0, t1));
+			const auto t_far  = XMStore< F32x3 >(XMVectorMax(t0, t1));
+			const auto t_enter = std::max({ t_near[0], t_near[1], t_near[2], 0.0f });
+			const auto t_exit  = std::min({ t_far[0],  t_far[1],  t_far[2],  t_closest });
+			if (t_exit < t_enter) {
+				continue;
+			}
+
+			if (0u != node.m_nb_triangles) {
+				for (auto i = node.m_offset; 
+					 i < node.m_offset + node.m_nb_triangles; ++i) {
+
+					// Moeller-Trumbore ray-triangle intersection (two-sided).
+					const auto t  = m_indices[i];
+					const auto p0 = XMLoad(m_vertices[3u * t]);
+					const auto e1 = XMLoad(m_vertices[3u * t + 1u]) - p0;
+					const auto e2 = XMLoad(m_vertices[3u * t + 2u]) - p0;
+
+					const auto p   = XMVector3Cross(direction, e2);
+					const auto det = XMVectorGetX(XMVector3Dot(e1, p));
+					if (std::abs(det) < std::numeric_limits< F32 >::min()) {
+						continue;
+					}
+
+					const auto inv_det = 1.0f / det;
+					const auto s = origin - p0;
+					const auto u = XMVectorGetX(XMVector3Dot(s, p)) * inv_det;
+					if (u < 0.0f || 1.0f < u) {
+						continue;
+					}
+
+					const auto q = XMVector3Cross(s, e1);
+					const auto v = XMVectorGetX(XMVector3Dot(direction, q)) * inv_det;
+					if (v < 0.0f || 1.0f < u + v) {
+						continue;
+					}
+
+					const auto t_hit = XMVectorGetX(XMVector3Dot(e2, q)) * inv_det;
+					if (t_hit < 0.0f || t_closest < t_hit) {
+						continue;
+					}
+
+					t_closest         = t_hit;
+					found             = true;
+					hit.m_t           = t_hit;
+					hit.m_triangle    = t;
+					hit.m_barycentric = { u, v };
+					
+					if (any_hit) {
+						return true;
+					}
+				}
+			}
+			else if (stack_size + 2u <= g_max_stack_depth) {
+				stack[stack_size++] = node.m_offset;
+				stack[stack_size++] = static_cast< U32 >(&node - m_nodes.data()) + 1u;
+			}
+		}
+
+		return found;
+	}
+}
\ No newline at end of file
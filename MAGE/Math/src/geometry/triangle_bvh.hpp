@@ -0,0 +1,297 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "geometry\geometry.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 A class of bounding volume hierarchies of triangles for CPU ray casting.
+
+	 The hierarchy is built by recursively splitting the triangles at the 
+	 median of their centroids along the largest axis of the centroid bounds. 
+	 The construction only depends on the given triangles (i.e. is 
+	 deterministic), and all queries are thread-safe.
+	 */
+	class TriangleBVH final {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 A struct of ray-triangle hits.
+		 */
+		struct Hit final {
+
+		public:
+
+			//-----------------------------------------------------------------
+			// Member Variables
+			//-----------------------------------------------------------------
+
+			/**
+			 The ray parameter of this hit.
+			 */
+			F32 m_t = 0.0f;
+
+			/**
+			 The index of the hit triangle of this hit.
+			 */
+			U32 m_triangle = 0u;
+
+			/**
+			 The barycentric coordinates of this hit with regard to the 
+			 second and third vertex of the hit triangle.
+			 */
+			F32x2 m_barycentric = {};
+		};
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a triangle BVH.
+
+		 @param[in]		vertices
+						A vector containing three consecutive vertex positions 
+						per triangle.
+		 */
+		explicit TriangleBVH(std::vector< F32x3 > vertices = {});
+
+		/**
+		 Constructs a triangle BVH from the given triangle BVH.
+
+		 @param[in]		bvh
+						A reference to the triangle BVH to copy.
+		 */
+		TriangleBVH(const TriangleBVH& bvh);
+
+		/**
+		 Constructs a triangle BVH by moving the given triangle BVH.
+
+		 @param[in]		bvh
+						A reference to the triangle BVH to move.
+		 */
+		TriangleBVH(TriangleBVH&& bvh) noexcept;
+
+		/**
+		 Destructs this triangle BVH.
+		 */
+		~TriangleBVH();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given triangle BVH to this triangle BVH.
+
+		 @param[in]		bvh
+						A reference to the triangle BVH to copy.
+		 @return		A reference to the copy of the given triangle BVH 
+						(i.e. this triangle BVH).
+		 */
+		TriangleBVH& operator=(const TriangleBVH& bvh);
+
+		/**
+		 Moves the given triangle BVH to this triangle BVH.
+
+		 @param[in]		bvh
+						A reference to the triangle BVH to move.
+		 @return		A reference to the moved triangle BVH (i.e. this 
+						triangle BVH).
+		 */
+		TriangleBVH& operator=(TriangleBVH&& bvh) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the number of triangles of this triangle BVH.
+
+		 @return		The number of triangles of this triangle BVH.
+		 */
+		[[nodiscard]]
+		size_t GetNumberOfTriangles() const noexcept {
+			return m_vertices.size() / 3u;
+		}
+
+		/**
+		 Returns the vertex positions of this triangle BVH.
+
+		 @return		A reference to a vector containing three consecutive 
+						vertex positions per triangle of this triangle BVH.
+		 */
+		[[nodiscard]]
+		const std::vector< F32x3 >& GetVertices() const noexcept {
+			return m_vertices;
+		}
+
+		/**
+		 Intersects the given ray with the triangles of this triangle BVH.
+
+		 @param[in]		origin
+						The origin of the ray.
+		 @param[in]		direction
+						The direction of the ray.
+		 @param[in]		t_max
+						The maximum ray parameter.
+		 @param[out]	hit
+						A reference to the closest hit (if any).
+		 @return		@c true if the given ray hits a triangle of this 
+						triangle BVH within [0, @a t_max]. @c false 
+						otherwise.
+		 */
+		bool XM_CALLCONV Intersect(FXMVECTOR origin, 
+								   FXMVECTOR direction, 
+								   F32 t_max, 
+								   Hit& hit) const noexcept;
+
+		/**
+		 Checks whether the given ray hits any triangle of this triangle BVH.
+
+		 @param[in]		origin
+						The origin of the ray.
+		 @param[in]		direction
+						The direction of the ray.
+		 @param[in]		t_max
+						The maximum ray parameter.
+		 @return		@c true if the given ray hits a triangle of this 
+						triangle BVH within [0, @a t_max]. @c false 
+						otherwise.
+		 */
+		[[nodiscard]]
+		bool XM_CALLCONV IsOccluded(FXMVECTOR origin, 
+									FXMVECTOR direction, 
+									F32 t_max) const noexcept;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 A struct of BVH nodes.
+		 */
+		struct Node final {
+
+		public:
+
+			//-----------------------------------------------------------------
+			// Member Variables
+			//-----------------------------------------------------------------
+
+			/**
+			 The minimum point of the bounds of this node.
+			 */
+			F32x3 m_min = {};
+
+			/**
+			 The index of the second child node of this interior node (the 
+			 first child node directly follows this node), or the index of 
+			 the first triangle index of this leaf node.
+			 */
+			U32 m_offset = 0u;
+
+			/**
+			 The maximum point of the bounds of this node.
+			 */
+			F32x3 m_max = {};
+
+			/**
+			 The number of triangles of this node (@c 0 for interior nodes).
+			 */
+			U32 m_nb_triangles = 0u;
+		};
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Builds the subtree of this triangle BVH for the given range of 
+		 triangle indices.
+
+		 @param[in]		centroids
+						A reference to a vector containing the centroids of 
+						the triangles.
+		 @param[in]		begin
+						The begin of the range of triangle indices.
+		 @param[in]		end
+						The end of the range of triangle indices.
+		 @return		The index of the root node of the subtree.
+		 */
+		U32 Build(const std::vector< F32x3 >& centroids, 
+				  size_t begin, size_t end);
+
+		/**
+		 Traverses this triangle BVH.
+
+		 @param[in]		origin
+						The origin of the ray.
+		 @param[in]		direction
+						The direction of the ray.
+		 @param[in]		t_max
+						The maximum ray parameter.
+		 @param[out]	hit
+						A reference to the closest hit (if any).
+		 @param[in]		any_hit
+						A flag indicating whether the traversal can terminate 
+						at the first hit.
+		 @return		@c true if the given ray hits a triangle of this 
+						triangle BVH within [0, @a t_max]. @c false 
+						otherwise.
+		 */
+		bool XM_CALLCONV Traverse(FXMVECTOR origin, 
+								  FXMVECTOR direction, 
+								  F32 t_max, 
+								  Hit& hit, 
+								  bool any_hit) const noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A vector containing three consecutive vertex positions per triangle 
+		 of this triangle BVH.
+		 */
+		std::vector< F32x3 > m_vertices;
+
+		/**
+		 A vector containing the triangle indices of this triangle BVH 
+		 ordered by leaf node.
+		 */
+		std::vector< U32 > m_indices;
+
+		/**
+		 A vector containing the nodes of this triangle BVH in depth-first 
+		 order.
+		 */
+		std::vector< Node > m_nodes;
+	};
+}
\ No newline at end of file
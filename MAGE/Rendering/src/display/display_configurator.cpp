@@ -195,6 +195,18 @@ namespace mage::rendering {
 		[[nodiscard]]
 		HRESULT Configure() const;
 
+		/**
+		 Configures the display without user interaction by selecting the 
+		 (windowed, non-vsynced and non-anti-aliased) display mode whose 
+		 resolution is the closest to the given resolution.
+
+		 @param[in]		resolution
+						The requested display resolution.
+		 @return		A success/error value.
+		 */
+		[[nodiscard]]
+		HRESULT ConfigureHeadless(const U32x2& resolution);
+
 		/**
 		 Returns the display configuration of this display configurator.
 
@@ -516,6 +528,46 @@ namespace mage::rendering {
 		return (IDOK == result_dialog) ? S_OK : E_FAIL;
 	}
 	
+	[[nodiscard]]
+	HRESULT DisplayConfigurator::Impl::ConfigureHeadless(const U32x2& resolution) {
+		const auto distance = [&resolution](const DXGI_MODE_DESC& mode) noexcept {
+			const auto dx = static_cast< S64 >(mode.Width)  - resolution[0];
+			const auto dy = static_cast< S64 >(mode.Height) - resolution[1];
+			return dx * dx + dy * dy;
+		};
+
+		// Select the display mode with the closest resolution and (for equal 
+		// resolutions) the highest refresh rate.
+		const DXGI_MODE_DESC* selected_diplay_mode = nullptr;
+		for (const auto& display_mode : m_display_modes) {
+			if (!selected_diplay_mode) {
+				selected_diplay_mode = &display_mode;
+				continue;
+			}
+
+			const auto d0 = distance(*selected_diplay_mode);
+			const auto d1 = distance(display_mode);
+			if (d1 < d0 || (d1 == d0 && ConvertRefreshRate(display_mode) 
+										> ConvertRefreshRate(*selected_diplay_mode))) {
+				selected_diplay_mode = &display_mode;
+			}
+		}
+		
+		if (!selected_diplay_mode) {
+			Error("Headless display mode selection failed.");
+			return E_FAIL;
+		}
+
+		// The default display configuration is windowed, non-vsynced and 
+		// non-anti-aliased.
+		m_display_configuration 
+			= MakeUnique< DisplayConfiguration >(m_adapter, 
+												 m_output, 
+												 *selected_diplay_mode);
+
+		return S_OK;
+	}
+
 	[[nodiscard]]
 	INT_PTR DisplayConfigurator::Impl
 		::DisplayDialogProc(HWND dialog, 
@@ -832,6 +884,11 @@ namespace mage::rendering {
 		return m_impl->Configure();
 	}
 
+	[[nodiscard]]
+	HRESULT DisplayConfigurator::ConfigureHeadless(const U32x2& resolution) {
+		return m_impl->ConfigureHeadless(resolution);
+	}
+
 	[[nodiscard]]
 	const DisplayConfiguration* DisplayConfigurator
 		::GetDisplayConfiguration() const noexcept {
@@ -110,6 +110,18 @@ namespace mage::rendering {
 		[[nodiscard]]
 		HRESULT Configure() const;
 
+		/**
+		 Configures the display without user interaction by selecting the 
+		 (windowed, non-vsynced and non-anti-aliased) display mode whose 
+		 resolution is the closest to the given resolution.
+
+		 @param[in]		resolution
+						The requested display resolution.
+		 @return		A success/error value.
+		 */
+		[[nodiscard]]
+		HRESULT ConfigureHeadless(const U32x2& resolution);
+
 		/**
 		 Returns the display configuration of this display configurator.
 
@@ -7,6 +7,7 @@
 #include "loaders\mtl\mtl_loader.hpp"
 #include "resource\rendering_resource_manager.hpp"
 #include "string\string_utils.hpp"
+#include "system\profiler.hpp"
 
 #pragma endregion
 
@@ -19,6 +20,8 @@ namespace mage::rendering::loader {
 								ResourceManager& resource_manaer, 
 								std::vector< Material >& materials) {
 		
+		MAGE_PROFILE_FUNCTION();
+
 		std::wstring extension(path.extension());
 		TransformToLowerCase(extension);
 
@@ -7,6 +7,7 @@
 
 #include "loaders\mdl\mdl_loader.hpp"
 #include "loaders\obj\obj_loader.hpp"
+#include "system\profiler.hpp"
 
 #pragma endregion
 
@@ -21,6 +22,8 @@ namespace mage::rendering::loader {
 							 ModelOutput< VertexT, IndexT >& model_output, 
 							 const MeshDescriptor< VertexT, IndexT >& mesh_desc) {
 
+		MAGE_PROFILE_FUNCTION();
+
 		std::wstring extension(path.extension());
 		TransformToLowerCase(extension);
 
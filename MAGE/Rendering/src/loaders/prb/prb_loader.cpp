@@ -0,0 +1,30 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "loaders\prb\prb_loader.hpp"
+#include "loaders\prb\prb_reader.hpp"
+#include "loaders\prb\prb_writer.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering::loader {
+
+	void ImportIrradianceVolumeFromFile(const std::filesystem::path& path, 
+										IrradianceVolume& volume) {
+		
+		PRBReader reader(volume);
+		reader.ReadFromFile(path);
+	}
+
+	void ExportIrradianceVolumeToFile(const std::filesystem::path& path, 
+									  const IrradianceVolume& volume) {
+		
+		PRBWriter writer(volume);
+		writer.WriteToFile(path);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,53 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\probe\irradiance_volume.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <filesystem>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations
+//-----------------------------------------------------------------------------
+namespace mage::rendering::loader {
+
+	/**
+	 Imports the irradiance volume from the PRB file associated with the 
+	 given path.
+
+	 @param[in]		path
+					A reference to the path.
+	 @param[out]	volume
+					A reference to the irradiance volume.
+	 @throws		Exception
+					Failed to import the irradiance volume from file.
+	 */
+	void ImportIrradianceVolumeFromFile(const std::filesystem::path& path, 
+										IrradianceVolume& volume);
+
+	/**
+	 Exports the given irradiance volume to the PRB file associated with 
+	 the given path.
+
+	 @param[in]		path
+					A reference to the path.
+	 @param[in]		volume
+					A reference to the irradiance volume.
+	 @throws		Exception
+					Failed to export the irradiance volume to file.
+	 */
+	void ExportIrradianceVolumeToFile(const std::filesystem::path& path, 
+									  const IrradianceVolume& volume);
+}
\ No newline at end of file
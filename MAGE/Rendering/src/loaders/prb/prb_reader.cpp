@@ -0,0 +1,65 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "loaders\prb\prb_reader.hpp"
+#include "loaders\prb\prb_tokens.hpp"
+#include "exception\exception.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering::loader {
+
+	PRBReader::PRBReader(IrradianceVolume& volume)
+		: BigEndianBinaryReader(), 
+		m_volume(volume) {}
+
+	PRBReader::PRBReader(PRBReader&& reader) noexcept = default;
+
+	PRBReader::~PRBReader() = default;
+
+	void PRBReader::ReadData() {
+		
+		// Read the header.
+		{
+			const bool result = IsHeaderValid();
+			ThrowIfFailed(result, 
+						  "%ls: invalid PRB header.", GetPath().c_str());
+		}
+
+		const auto minimum         = Read< F32x3 >();
+		const auto maximum         = Read< F32x3 >();
+		const auto resolution      = Read< U32x3 >();
+		const auto nb_passes       = Read< U32 >();
+		const auto nb_coefficients = Read< U32 >();
+
+		const auto coefficients    = ReadArray< F32x3 >(nb_coefficients);
+
+		std::vector< RGB > rgbs;
+		rgbs.reserve(nb_coefficients);
+		for (U32 i = 0u; i < nb_coefficients; ++i) {
+			rgbs.emplace_back(coefficients[i]);
+		}
+
+		m_volume = IrradianceVolume(minimum, 
+									maximum, 
+									resolution, 
+									nb_passes, 
+									std::move(rgbs));
+	}
+
+	[[nodiscard]]
+	bool PRBReader::IsHeaderValid() {
+		for (auto magic = g_prb_token_magic; *magic != L'\0'; ++magic) {
+			if (*magic != Read< U8 >()) {
+				return false;
+			}
+		}
+
+		return true;
+	}
+}
\ No newline at end of file
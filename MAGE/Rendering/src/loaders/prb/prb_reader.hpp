@@ -0,0 +1,122 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "io\binary_reader.hpp"
+#include "renderer\probe\irradiance_volume.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations
+//-----------------------------------------------------------------------------
+namespace mage::rendering::loader {
+
+	/**
+	 A class of PRB file readers for reading irradiance volumes.
+	 */
+	class PRBReader final : private BigEndianBinaryReader {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a PRB reader.
+
+		 @param[out]	volume
+						A reference to the irradiance volume.
+		 */
+		explicit PRBReader(IrradianceVolume& volume);
+
+		/**
+		 Constructs a PRB reader from the given PRB reader.
+
+		 @param[in]		reader
+						A reference to the PRB reader to copy.
+		 */
+		PRBReader(const PRBReader& reader) = delete;
+
+		/**
+		 Constructs a PRB reader by moving the given PRB reader.
+
+		 @param[in]		reader
+						A reference to the PRB reader to move.
+		 */
+		PRBReader(PRBReader&& reader) noexcept;
+
+		/**
+		 Destructs this PRB reader.
+		 */
+		~PRBReader();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------	
+
+		/**
+		 Copies the given PRB reader to this PRB reader.
+
+		 @param[in]		reader
+						A reference to a PRB reader to copy.
+		 @return		A reference to the copy of the given PRB reader (i.e. 
+						this PRB reader).
+		 */
+		PRBReader& operator=(const PRBReader& reader) = delete;
+
+		/**
+		 Moves the given PRB reader to this PRB reader.
+
+		 @param[in]		reader
+						A reference to a PRB reader to move.
+		 @return		A reference to the moved PRB reader (i.e. this PRB 
+						reader).
+		 */
+		PRBReader& operator=(PRBReader&& reader) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		using BigEndianBinaryReader::ReadFromFile;
+
+		using BigEndianBinaryReader::ReadFromMemory;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Starts reading.
+
+		 @throws		Exception
+						Failed to read from the given file.
+		 */
+		virtual void ReadData() override;
+
+		/**
+		 Checks whether the header of the file is valid.
+
+		 @return		@c true if the header of the file is valid. @c false 
+						otherwise.
+		 */
+		[[nodiscard]]
+		bool IsHeaderValid();
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A reference to the read irradiance volume of this PRB reader.
+		 */
+		IrradianceVolume& m_volume;
+	};
+}
\ No newline at end of file
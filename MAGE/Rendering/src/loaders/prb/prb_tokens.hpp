@@ -0,0 +1,9 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering::loader {
+
+	constexpr const_zstring g_prb_token_magic = "MAGEprb";
+}
\ No newline at end of file
@@ -0,0 +1,40 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "loaders\prb\prb_writer.hpp"
+#include "loaders\prb\prb_tokens.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering::loader {
+
+	PRBWriter::PRBWriter(const IrradianceVolume& volume)
+		: BigEndianBinaryWriter(), 
+		m_volume(volume) {}
+
+	PRBWriter::PRBWriter(PRBWriter&& writer) noexcept = default;
+
+	PRBWriter::~PRBWriter() = default;
+
+	void PRBWriter::WriteData() {
+
+		WriteString(NotNull< const_zstring >(g_prb_token_magic));
+
+		Write< F32x3 >(m_volume.GetMinimum());
+		Write< F32x3 >(m_volume.GetMaximum());
+		Write< U32x3 >(m_volume.GetResolution());
+		Write< U32 >(m_volume.GetNumberOfPasses());
+
+		const auto& coefficients = m_volume.GetCoefficients();
+		Write< U32 >(static_cast< U32 >(coefficients.size()));
+		
+		for (const auto& coefficient : coefficients) {
+			Write< F32x3 >(coefficient);
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,112 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "io\binary_writer.hpp"
+#include "renderer\probe\irradiance_volume.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations
+//-----------------------------------------------------------------------------
+namespace mage::rendering::loader {
+
+	/**
+	 A class of PRB file writers for writing irradiance volumes.
+	 */
+	class PRBWriter final : private BigEndianBinaryWriter {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a PRB writer.
+
+		 @param[in]		volume
+						A reference to the irradiance volume.
+		 */
+		explicit PRBWriter(const IrradianceVolume& volume);
+
+		/**
+		 Constructs a PRB writer from the given PRB writer.
+
+		 @param[in]		writer
+						A reference to the PRB writer to copy.
+		 */
+		PRBWriter(const PRBWriter& writer) = delete;
+
+		/**
+		 Constructs a PRB writer by moving the given PRB writer.
+
+		 @param[in]		writer
+						A reference to the PRB writer to move.
+		 */
+		PRBWriter(PRBWriter&& writer) noexcept;
+
+		/**
+		 Destructs this PRB writer.
+		 */
+		~PRBWriter();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------	
+
+		/**
+		 Copies the given PRB writer to this PRB writer.
+
+		 @param[in]		writer
+						A reference to a PRB writer to copy.
+		 @return		A reference to the copy of the given PRB writer (i.e. 
+						this PRB writer).
+		 */
+		PRBWriter& operator=(const PRBWriter& writer) = delete;
+
+		/**
+		 Moves the given PRB writer to this PRB writer.
+
+		 @param[in]		writer
+						A reference to a PRB writer to move.
+		 @return		A reference to the moved PRB writer (i.e. this PRB 
+						writer).
+		 */
+		PRBWriter& operator=(PRBWriter&& writer) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		using BigEndianBinaryWriter::WriteToFile;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Starts writing.
+
+		 @throws		Exception
+						Failed to write.
+		 */
+		virtual void WriteData() override;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A reference to the irradiance volume to write by this PRB 
+		 writer.
+		 */
+		const IrradianceVolume& m_volume;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,31 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "loaders\pvs\pvs_loader.hpp"
+#include "loaders\pvs\pvs_reader.hpp"
+#include "loaders\pvs\pvs_writer.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering::loader {
+
+	void ImportPVSFromFile(const std::filesystem::path& path, 
+						   PotentiallyVisibleSet& pvs, 
+						   U32 nb_models) {
+		
+		PVSReader reader(pvs, nb_models);
+		reader.ReadFromFile(path);
+	}
+
+	void ExportPVSToFile(const std::filesystem::path& path, 
+						 const PotentiallyVisibleSet& pvs) {
+		
+		PVSWriter writer(pvs);
+		writer.WriteToFile(path);
+	}
+}
\ No newline at end of file
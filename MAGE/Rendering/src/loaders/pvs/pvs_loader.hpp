@@ -0,0 +1,59 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\culling\pvs.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <filesystem>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations
+//-----------------------------------------------------------------------------
+namespace mage::rendering::loader {
+
+	/**
+	 Imports the potentially visible set from the PVS file associated with the 
+	 given path.
+
+	 @param[in]		path
+					A reference to the path.
+	 @param[out]	pvs
+					A reference to the potentially visible set.
+	 @param[in]		nb_models
+					The expected number of models of the potentially visible 
+					set (i.e. the number of static models of the world).
+	 @throws		Exception
+					Failed to import the potentially visible set from file, 
+					or the potentially visible set was baked for a different 
+					number of models.
+	 */
+	void ImportPVSFromFile(const std::filesystem::path& path, 
+						   PotentiallyVisibleSet& pvs, 
+						   U32 nb_models);
+
+	/**
+	 Exports the given potentially visible set to the PVS file associated with 
+	 the given path.
+
+	 @param[in]		path
+					A reference to the path.
+	 @param[in]		pvs
+					A reference to the potentially visible set.
+	 @throws		Exception
+					Failed to export the potentially visible set to file.
+	 */
+	void ExportPVSToFile(const std::filesystem::path& path, 
+						 const PotentiallyVisibleSet& pvs);
+}
\ No newline at end of file
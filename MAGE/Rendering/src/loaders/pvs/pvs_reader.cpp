@@ -0,0 +1,66 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "loaders\pvs\pvs_reader.hpp"
+#include "loaders\pvs\pvs_tokens.hpp"
+#include "exception\exception.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering::loader {
+
+	PVSReader::PVSReader(PotentiallyVisibleSet& pvs, U32 nb_models)
+		: BigEndianBinaryReader(), 
+		m_pvs(pvs), 
+		m_nb_models(nb_models) {}
+
+	PVSReader::PVSReader(PVSReader&& reader) noexcept = default;
+
+	PVSReader::~PVSReader() = default;
+
+	void PVSReader::ReadData() {
+		
+		// Read the header.
+		{
+			const bool result = IsHeaderValid();
+			ThrowIfFailed(result, 
+						  "%ls: invalid PVS header.", GetPath().c_str());
+		}
+
+		const auto p_min      = Read< F32x3 >();
+		const auto p_max      = Read< F32x3 >();
+		const auto resolution = Read< U32x3 >();
+		const auto nb_models  = Read< U32 >();
+		ThrowIfFailed(m_nb_models == nb_models, 
+					  "%ls: PVS baked for %u models instead of %u static models.", 
+					  GetPath().c_str(), nb_models, m_nb_models);
+
+		const auto nb_offsets = Read< U32 >();
+		const auto nb_bytes   = Read< U32 >();
+
+		const auto offsets    = ReadArray< U32 >(nb_offsets);
+		const auto data       = ReadArray< U8 >(nb_bytes);
+
+		m_pvs = PotentiallyVisibleSet(AABB(Point3(p_min), Point3(p_max)), 
+									  resolution, 
+									  nb_models, 
+									  std::vector< U32 >(offsets, offsets + nb_offsets), 
+									  std::vector< U8 >(data, data + nb_bytes));
+	}
+
+	[[nodiscard]]
+	bool PVSReader::IsHeaderValid() {
+		for (auto magic = g_pvs_token_magic; *magic != L'\0'; ++magic) {
+			if (*magic != Read< U8 >()) {
+				return false;
+			}
+		}
+
+		return true;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,131 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "io\binary_reader.hpp"
+#include "renderer\culling\pvs.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations
+//-----------------------------------------------------------------------------
+namespace mage::rendering::loader {
+
+	/**
+	 A class of PVS file readers for reading potentially visible sets.
+	 */
+	class PVSReader final : private BigEndianBinaryReader {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a PVS reader.
+
+		 @param[out]	pvs
+						A reference to the potentially visible set.
+		 @param[in]		nb_models
+						The expected number of models of the potentially 
+						visible set.
+		 */
+		explicit PVSReader(PotentiallyVisibleSet& pvs, U32 nb_models);
+
+		/**
+		 Constructs a PVS reader from the given PVS reader.
+
+		 @param[in]		reader
+						A reference to the PVS reader to copy.
+		 */
+		PVSReader(const PVSReader& reader) = delete;
+
+		/**
+		 Constructs a PVS reader by moving the given PVS reader.
+
+		 @param[in]		reader
+						A reference to the PVS reader to move.
+		 */
+		PVSReader(PVSReader&& reader) noexcept;
+
+		/**
+		 Destructs this PVS reader.
+		 */
+		~PVSReader();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------	
+
+		/**
+		 Copies the given PVS reader to this PVS reader.
+
+		 @param[in]		reader
+						A reference to a PVS reader to copy.
+		 @return		A reference to the copy of the given PVS reader (i.e. 
+						this PVS reader).
+		 */
+		PVSReader& operator=(const PVSReader& reader) = delete;
+
+		/**
+		 Moves the given PVS reader to this PVS reader.
+
+		 @param[in]		reader
+						A reference to a PVS reader to move.
+		 @return		A reference to the moved PVS reader (i.e. this PVS 
+						reader).
+		 */
+		PVSReader& operator=(PVSReader&& reader) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		using BigEndianBinaryReader::ReadFromFile;
+
+		using BigEndianBinaryReader::ReadFromMemory;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Starts reading.
+
+		 @throws		Exception
+						Failed to read from the given file.
+		 */
+		virtual void ReadData() override;
+
+		/**
+		 Checks whether the header of the file is valid.
+
+		 @return		@c true if the header of the file is valid. @c false 
+						otherwise.
+		 */
+		[[nodiscard]]
+		bool IsHeaderValid();
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A reference to the read potentially visible set of this PVS reader.
+		 */
+		PotentiallyVisibleSet& m_pvs;
+
+		/**
+		 The expected number of models of the read potentially visible set of 
+		 this PVS reader.
+		 */
+		U32 m_nb_models;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,9 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering::loader {
+
+	constexpr const_zstring g_pvs_token_magic = "MAGEpvs";
+}
\ No newline at end of file
@@ -0,0 +1,42 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "loaders\pvs\pvs_writer.hpp"
+#include "loaders\pvs\pvs_tokens.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering::loader {
+
+	PVSWriter::PVSWriter(const PotentiallyVisibleSet& pvs)
+		: BigEndianBinaryWriter(), 
+		m_pvs(pvs) {}
+
+	PVSWriter::PVSWriter(PVSWriter&& writer) noexcept = default;
+
+	PVSWriter::~PVSWriter() = default;
+
+	void PVSWriter::WriteData() {
+
+		WriteString(NotNull< const_zstring >(g_pvs_token_magic));
+
+		const auto bounds = m_pvs.GetBounds();
+		Write< F32x3 >(XMStore< F32x3 >(bounds.MinPoint()));
+		Write< F32x3 >(XMStore< F32x3 >(bounds.MaxPoint()));
+		Write< U32x3 >(m_pvs.GetResolution());
+		Write< U32 >(m_pvs.GetNumberOfModels());
+
+		const auto& offsets = m_pvs.GetOffsets();
+		const auto& data    = m_pvs.GetData();
+		Write< U32 >(static_cast< U32 >(offsets.size()));
+		Write< U32 >(static_cast< U32 >(data.size()));
+		
+		WriteArray(gsl::make_span(offsets));
+		WriteArray(gsl::make_span(data));
+	}
+}
\ No newline at end of file
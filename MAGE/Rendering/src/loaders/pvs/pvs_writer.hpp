@@ -0,0 +1,112 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "io\binary_writer.hpp"
+#include "renderer\culling\pvs.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations
+//-----------------------------------------------------------------------------
+namespace mage::rendering::loader {
+
+	/**
+	 A class of PVS file writers for writing potentially visible sets.
+	 */
+	class PVSWriter final : private BigEndianBinaryWriter {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a PVS writer.
+
+		 @param[in]		pvs
+						A reference to the potentially visible set.
+		 */
+		explicit PVSWriter(const PotentiallyVisibleSet& pvs);
+
+		/**
+		 Constructs a PVS writer from the given PVS writer.
+
+		 @param[in]		writer
+						A reference to the PVS writer to copy.
+		 */
+		PVSWriter(const PVSWriter& writer) = delete;
+
+		/**
+		 Constructs a PVS writer by moving the given PVS writer.
+
+		 @param[in]		writer
+						A reference to the PVS writer to move.
+		 */
+		PVSWriter(PVSWriter&& writer) noexcept;
+
+		/**
+		 Destructs this PVS writer.
+		 */
+		~PVSWriter();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------	
+
+		/**
+		 Copies the given PVS writer to this PVS writer.
+
+		 @param[in]		writer
+						A reference to a PVS writer to copy.
+		 @return		A reference to the copy of the given PVS writer (i.e. 
+						this PVS writer).
+		 */
+		PVSWriter& operator=(const PVSWriter& writer) = delete;
+
+		/**
+		 Moves the given PVS writer to this PVS writer.
+
+		 @param[in]		writer
+						A reference to a PVS writer to move.
+		 @return		A reference to the moved PVS writer (i.e. this PVS 
+						writer).
+		 */
+		PVSWriter& operator=(PVSWriter&& writer) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		using BigEndianBinaryWriter::WriteToFile;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Starts writing.
+
+		 @throws		Exception
+						Failed to write.
+		 */
+		virtual void WriteData() override;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A reference to the potentially visible set to write by this PVS 
+		 writer.
+		 */
+		const PotentiallyVisibleSet& m_pvs;
+	};
+}
\ No newline at end of file
@@ -7,6 +7,7 @@
 #include "loaders\font\font_loader.hpp"
 #include "string\string_utils.hpp"
 #include "exception\exception.hpp"
+#include "system\profiler.hpp"
 
 #pragma endregion
 
@@ -20,6 +21,8 @@ namespace mage::rendering::loader {
 		                          SpriteFontOutput& output, 
 		                          const SpriteFontDescriptor& desc) {
 		
+		MAGE_PROFILE_FUNCTION();
+
 		std::wstring extension(path.extension());
 		TransformToLowerCase(extension);
 
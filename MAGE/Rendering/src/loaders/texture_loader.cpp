@@ -9,6 +9,7 @@
 #include "loaders\wic\wic_loader.hpp"
 #include "string\string_utils.hpp"
 #include "exception\exception.hpp"
+#include "system\profiler.hpp"
 
 #pragma endregion
 
@@ -30,6 +31,8 @@ namespace mage::rendering::loader {
 		                       ID3D11Device& device, 
 		                       NotNull< ID3D11ShaderResourceView** > texture_srv) {
 		
+		MAGE_PROFILE_FUNCTION();
+
 		std::wstring extension(path.extension());
 		TransformToLowerCase(extension);
 
@@ -0,0 +1,30 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "loaders\vxb\vxb_loader.hpp"
+#include "loaders\vxb\vxb_reader.hpp"
+#include "loaders\vxb\vxb_writer.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering::loader {
+
+	void ImportSparseVoxelGridFromFile(const std::filesystem::path& path, 
+									   SparseVoxelGrid& grid) {
+		
+		VXBReader reader(grid);
+		reader.ReadFromFile(path);
+	}
+
+	void ExportSparseVoxelGridToFile(const std::filesystem::path& path, 
+									 const SparseVoxelGrid& grid) {
+		
+		VXBWriter writer(grid);
+		writer.WriteToFile(path);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,53 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\voxelization\sparse_voxel_grid.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <filesystem>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations
+//-----------------------------------------------------------------------------
+namespace mage::rendering::loader {
+
+	/**
+	 Imports the sparse voxel grid from the VXB file associated with the 
+	 given path.
+
+	 @param[in]		path
+					A reference to the path.
+	 @param[out]	grid
+					A reference to the sparse voxel grid.
+	 @throws		Exception
+					Failed to import the sparse voxel grid from file.
+	 */
+	void ImportSparseVoxelGridFromFile(const std::filesystem::path& path, 
+									   SparseVoxelGrid& grid);
+
+	/**
+	 Exports the given sparse voxel grid to the VXB file associated with 
+	 the given path.
+
+	 @param[in]		path
+					A reference to the path.
+	 @param[in]		grid
+					A reference to the sparse voxel grid.
+	 @throws		Exception
+					Failed to export the sparse voxel grid to file.
+	 */
+	void ExportSparseVoxelGridToFile(const std::filesystem::path& path, 
+									 const SparseVoxelGrid& grid);
+}
\ No newline at end of file
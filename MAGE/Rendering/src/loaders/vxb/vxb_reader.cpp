@@ -0,0 +1,72 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "loaders\vxb\vxb_reader.hpp"
+#include "loaders\vxb\vxb_tokens.hpp"
+#include "exception\exception.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering::loader {
+
+	VXBReader::VXBReader(SparseVoxelGrid& grid)
+		: BigEndianBinaryReader(), 
+		m_grid(grid) {}
+
+	VXBReader::VXBReader(VXBReader&& reader) noexcept = default;
+
+	VXBReader::~VXBReader() = default;
+
+	void VXBReader::ReadData() {
+		
+		// Read the header.
+		{
+			const bool result = IsHeaderValid();
+			ThrowIfFailed(result, 
+						  "%ls: invalid VXB header.", GetPath().c_str());
+		}
+
+		const auto center     = Read< F32x3 >();
+		const auto resolution = Read< U32 >();
+		const auto voxel_size = Read< F32 >();
+		const auto brick_size = Read< U32 >();
+		const auto nb_bricks  = Read< U32 >();
+		const auto nb_masks   = Read< U32 >();
+		const auto nb_voxels  = Read< U32 >();
+
+		const auto bricks     = ReadArray< U32 >(nb_bricks);
+		const auto masks      = ReadArray< U32 >(nb_masks);
+		const auto data       = ReadArray< U32 >(3u * static_cast< size_t >(nb_voxels));
+
+		std::vector< SparseVoxelGrid::PackedVoxel > voxels(nb_voxels);
+		for (size_t i = 0u; i < voxels.size(); ++i) {
+			voxels[i].m_radiance = data[3u * i];
+			voxels[i].m_albedo   = data[3u * i + 1u];
+			voxels[i].m_normal   = data[3u * i + 2u];
+		}
+
+		m_grid = SparseVoxelGrid(center, 
+								 resolution, 
+								 voxel_size, 
+								 brick_size, 
+								 std::vector< U32 >(bricks, bricks + nb_bricks), 
+								 std::vector< U32 >(masks, masks + nb_masks), 
+								 std::move(voxels));
+	}
+
+	[[nodiscard]]
+	bool VXBReader::IsHeaderValid() {
+		for (auto magic = g_vxb_token_magic; *magic != L'\0'; ++magic) {
+			if (*magic != Read< U8 >()) {
+				return false;
+			}
+		}
+
+		return true;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,122 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "io\binary_reader.hpp"
+#include "renderer\voxelization\sparse_voxel_grid.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations
+//-----------------------------------------------------------------------------
+namespace mage::rendering::loader {
+
+	/**
+	 A class of VXB file readers for reading sparse voxel grids.
+	 */
+	class VXBReader final : private BigEndianBinaryReader {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a VXB reader.
+
+		 @param[out]	grid
+						A reference to the sparse voxel grid.
+		 */
+		explicit VXBReader(SparseVoxelGrid& grid);
+
+		/**
+		 Constructs a VXB reader from the given VXB reader.
+
+		 @param[in]		reader
+						A reference to the VXB reader to copy.
+		 */
+		VXBReader(const VXBReader& reader) = delete;
+
+		/**
+		 Constructs a VXB reader by moving the given VXB reader.
+
+		 @param[in]		reader
+						A reference to the VXB reader to move.
+		 */
+		VXBReader(VXBReader&& reader) noexcept;
+
+		/**
+		 Destructs this VXB reader.
+		 */
+		~VXBReader();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------	
+
+		/**
+		 Copies the given VXB reader to this VXB reader.
+
+		 @param[in]		reader
+						A reference to a VXB reader to copy.
+		 @return		A reference to the copy of the given VXB reader (i.e. 
+						this VXB reader).
+		 */
+		VXBReader& operator=(const VXBReader& reader) = delete;
+
+		/**
+		 Moves the given VXB reader to this VXB reader.
+
+		 @param[in]		reader
+						A reference to a VXB reader to move.
+		 @return		A reference to the moved VXB reader (i.e. this VXB 
+						reader).
+		 */
+		VXBReader& operator=(VXBReader&& reader) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		using BigEndianBinaryReader::ReadFromFile;
+
+		using BigEndianBinaryReader::ReadFromMemory;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Starts reading.
+
+		 @throws		Exception
+						Failed to read from the given file.
+		 */
+		virtual void ReadData() override;
+
+		/**
+		 Checks whether the header of the file is valid.
+
+		 @return		@c true if the header of the file is valid. @c false 
+						otherwise.
+		 */
+		[[nodiscard]]
+		bool IsHeaderValid();
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A reference to the read sparse voxel grid of this VXB reader.
+		 */
+		SparseVoxelGrid& m_grid;
+	};
+}
\ No newline at end of file
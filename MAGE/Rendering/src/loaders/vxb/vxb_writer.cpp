@@ -0,0 +1,48 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "loaders\vxb\vxb_writer.hpp"
+#include "loaders\vxb\vxb_tokens.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering::loader {
+
+	VXBWriter::VXBWriter(const SparseVoxelGrid& grid)
+		: BigEndianBinaryWriter(), 
+		m_grid(grid) {}
+
+	VXBWriter::VXBWriter(VXBWriter&& writer) noexcept = default;
+
+	VXBWriter::~VXBWriter() = default;
+
+	void VXBWriter::WriteData() {
+
+		WriteString(NotNull< const_zstring >(g_vxb_token_magic));
+
+		Write< F32x3 >(m_grid.GetCenter());
+		Write< U32 >(m_grid.GetResolution());
+		Write< F32 >(m_grid.GetVoxelSize());
+		Write< U32 >(m_grid.GetBrickSize());
+
+		const auto& bricks = m_grid.GetBricks();
+		const auto& masks  = m_grid.GetMasks();
+		const auto& voxels = m_grid.GetVoxels();
+		Write< U32 >(static_cast< U32 >(bricks.size()));
+		Write< U32 >(static_cast< U32 >(masks.size()));
+		Write< U32 >(static_cast< U32 >(voxels.size()));
+
+		WriteArray(gsl::make_span(bricks));
+		WriteArray(gsl::make_span(masks));
+		for (const auto& voxel : voxels) {
+			Write< U32 >(voxel.m_radiance);
+			Write< U32 >(voxel.m_albedo);
+			Write< U32 >(voxel.m_normal);
+		}
+	}
+}
\ No newline at end of file
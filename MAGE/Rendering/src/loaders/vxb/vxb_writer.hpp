@@ -0,0 +1,112 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "io\binary_writer.hpp"
+#include "renderer\voxelization\sparse_voxel_grid.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations
+//-----------------------------------------------------------------------------
+namespace mage::rendering::loader {
+
+	/**
+	 A class of VXB file writers for writing sparse voxel grids.
+	 */
+	class VXBWriter final : private BigEndianBinaryWriter {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a VXB writer.
+
+		 @param[in]		grid
+						A reference to the sparse voxel grid.
+		 */
+		explicit VXBWriter(const SparseVoxelGrid& grid);
+
+		/**
+		 Constructs a VXB writer from the given VXB writer.
+
+		 @param[in]		writer
+						A reference to the VXB writer to copy.
+		 */
+		VXBWriter(const VXBWriter& writer) = delete;
+
+		/**
+		 Constructs a VXB writer by moving the given VXB writer.
+
+		 @param[in]		writer
+						A reference to the VXB writer to move.
+		 */
+		VXBWriter(VXBWriter&& writer) noexcept;
+
+		/**
+		 Destructs this VXB writer.
+		 */
+		~VXBWriter();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------	
+
+		/**
+		 Copies the given VXB writer to this VXB writer.
+
+		 @param[in]		writer
+						A reference to a VXB writer to copy.
+		 @return		A reference to the copy of the given VXB writer (i.e. 
+						this VXB writer).
+		 */
+		VXBWriter& operator=(const VXBWriter& writer) = delete;
+
+		/**
+		 Moves the given VXB writer to this VXB writer.
+
+		 @param[in]		writer
+						A reference to a VXB writer to move.
+		 @return		A reference to the moved VXB writer (i.e. this VXB 
+						writer).
+		 */
+		VXBWriter& operator=(VXBWriter&& writer) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		using BigEndianBinaryWriter::WriteToFile;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Starts writing.
+
+		 @throws		Exception
+						Failed to write.
+		 */
+		virtual void WriteData() override;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A reference to the sparse voxel grid to write by this VXB 
+		 writer.
+		 */
+		const SparseVoxelGrid& m_grid;
+	};
+}
\ No newline at end of file
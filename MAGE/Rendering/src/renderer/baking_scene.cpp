@@ -0,0 +1,278 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\baking_scene.hpp"
+#include "exception\exception.hpp"
+
+// Include HLSL bindings.
+#include "hlsl.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	BakingScene::BakingScene(const World& world)
+		: m_materials(),
+		m_normals(),
+		m_triangle_to_material(),
+		m_lights(),
+		m_La(),
+		m_minimum(),
+		m_maximum(),
+		m_shadow_length(0.0f),
+		m_bvh() {
+
+		//---------------------------------------------------------------------
+		// Collect the world space triangles of all static models.
+		//---------------------------------------------------------------------
+		std::vector< F32x3 > vertices;
+		AABB bounds;
+
+		world.ForEach< Model >([&](const Model& model) {
+			const auto& material = model.GetMaterial();
+
+			if (State::Active != model.GetState()
+				|| !model.IsStatic()
+				|| material.GetBaseColor()[3] < TRANSPARENCY_THRESHOLD) {
+				return;
+			}
+
+			const auto triangles = model.GetTriangles();
+			if (triangles.empty()) {
+				return;
+			}
+
+			const auto  index           = static_cast< U32 >(m_materials.size());
+			const auto& transform       = model.GetOwner()->GetTransform();
+			const auto  object_to_world = transform.GetObjectToWorldMatrix();
+
+			Material baking_material;
+			baking_material.m_base_color = material.GetBaseColor();
+			baking_material.m_emissive   = material.IsEmissive();
+			m_materials.push_back(std::move(baking_material));
+
+			for (size_t i = 0u; i + 2u < triangles.size(); i += 3u) {
+				AddTriangle(
+					XMVector3TransformCoord(XMLoad(triangles[i]),      object_to_world),
+					XMVector3TransformCoord(XMLoad(triangles[i + 1u]), object_to_world),
+					XMVector3TransformCoord(XMLoad(triangles[i + 2u]), object_to_world),
+					index, vertices, bounds);
+			}
+		});
+
+		ThrowIfFailed(!vertices.empty(),
+					  "Baking: the world contains no static triangles with a CPU "
+					  "copy.");
+
+		BuildBVH(std::move(vertices), bounds);
+
+		//---------------------------------------------------------------------
+		// Collect the world space lights.
+		//---------------------------------------------------------------------
+		world.ForEach< AmbientLight >([this](const AmbientLight& light) {
+			if (State::Active != light.GetState()) {
+				return;
+			}
+
+			m_La = light.GetRadianceSpectrum();
+		});
+
+		world.ForEach< DirectionalLight >([this](const DirectionalLight& light) {
+			if (State::Active != light.GetState()) {
+				return;
+			}
+
+			const auto& transform = light.GetOwner()->GetTransform();
+
+			Light baking_light;
+			baking_light.m_type    = LightType::Directional;
+			baking_light.m_shadows = light.UseShadows();
+			baking_light.m_neg_d   = XMStore< F32x3 >(-transform.GetWorldAxisZ());
+			baking_light.m_I       = light.GetIrradianceSpectrum();
+			m_lights.push_back(std::move(baking_light));
+		});
+
+		world.ForEach< OmniLight >([this](const OmniLight& light) {
+			if (State::Active != light.GetState()) {
+				return;
+			}
+
+			const auto& transform = light.GetOwner()->GetTransform();
+			const auto  range     = light.GetWorldRange();
+
+			Light baking_light;
+			baking_light.m_type          = LightType::Omni;
+			baking_light.m_shadows       = light.UseShadows();
+			baking_light.m_p             = XMStore< F32x3 >(transform.GetWorldOrigin());
+			baking_light.m_I             = light.GetIntensitySpectrum();
+			baking_light.m_inv_sqr_range = 1.0f / (range * range);
+			m_lights.push_back(std::move(baking_light));
+		});
+
+		world.ForEach< SpotLight >([this](const SpotLight& light) {
+			if (State::Active != light.GetState()) {
+				return;
+			}
+
+			const auto& transform = light.GetOwner()->GetTransform();
+			const auto  range     = light.GetWorldRange();
+
+			Light baking_light;
+			baking_light.m_type          = LightType::Spot;
+			baking_light.m_shadows       = light.UseShadows();
+			baking_light.m_p             = XMStore< F32x3 >(transform.GetWorldOrigin());
+			baking_light.m_neg_d         = XMStore< F32x3 >(-transform.GetWorldAxisZ());
+			baking_light.m_I             = light.GetIntensitySpectrum();
+			baking_light.m_inv_sqr_range = 1.0f / (range * range);
+			baking_light.m_cos_umbra     = light.GetEndAngularCutoff();
+			baking_light.m_cos_inv_range = 1.0f / light.GetRangeAngularCutoff();
+			m_lights.push_back(std::move(baking_light));
+		});
+	}
+
+	BakingScene::BakingScene(const std::vector< F32x3 >& vertices,
+							 const Material& material)
+		: m_materials(1u, material),
+		m_normals(),
+		m_triangle_to_material(),
+		m_lights(),
+		m_La(),
+		m_minimum(),
+		m_maximum(),
+		m_shadow_length(0.0f),
+		m_bvh() {
+
+		std::vector< F32x3 > scene_vertices;
+		AABB bounds;
+
+		for (size_t i = 0u; i + 2u < vertices.size(); i += 3u) {
+			AddTriangle(XMLoad(vertices[i]), 
+						XMLoad(vertices[i + 1u]), 
+						XMLoad(vertices[i + 2u]), 
+						0u, scene_vertices, bounds);
+		}
+
+		ThrowIfFailed(!scene_vertices.empty(),
+					  "Baking: no non-degenerate triangles.");
+
+		BuildBVH(std::move(scene_vertices), bounds);
+	}
+
+	BakingScene::BakingScene(BakingScene&& scene) noexcept = default;
+
+	BakingScene::~BakingScene() = default;
+
+	BakingScene& BakingScene::operator=(BakingScene&& scene) noexcept = default;
+
+	void XM_CALLCONV BakingScene::AddTriangle(FXMVECTOR p0, 
+											  FXMVECTOR p1, 
+											  FXMVECTOR p2, 
+											  U32 material, 
+											  std::vector< F32x3 >& vertices, 
+											  AABB& bounds) {
+
+		const auto n = XMVector3Cross(p1 - p0, p2 - p0);
+
+		// Skip degenerate triangles.
+		if (0.0f >= XMVectorGetX(XMVector3LengthSq(n))) {
+			return;
+		}
+
+		vertices.push_back(XMStore< F32x3 >(p0));
+		vertices.push_back(XMStore< F32x3 >(p1));
+		vertices.push_back(XMStore< F32x3 >(p2));
+		m_normals.push_back(XMStore< F32x3 >(XMVector3Normalize(n)));
+		m_triangle_to_material.push_back(material);
+
+		bounds = AABB::Union(bounds, AABB(p0));
+		bounds = AABB::Union(bounds, AABB(p1));
+		bounds = AABB::Union(bounds, AABB(p2));
+	}
+
+	void BakingScene::BuildBVH(std::vector< F32x3 > vertices, 
+							   const AABB& bounds) {
+
+		m_minimum       = XMStore< F32x3 >(bounds.MinPoint());
+		m_maximum       = XMStore< F32x3 >(bounds.MaxPoint());
+		m_shadow_length = 2.0f * XMVectorGetX(XMVector3Length(bounds.Diagonal()));
+		m_bvh           = TriangleBVH(std::move(vertices));
+	}
+
+	[[nodiscard]]
+	const XMVECTOR XM_CALLCONV BakingScene
+		::GetRadiance(FXMVECTOR p,
+					  FXMVECTOR n,
+					  const Material& material,
+					  F32 bias) const noexcept {
+
+		const auto base_color = XMLoad(material.m_base_color);
+		if (material.m_emissive) {
+			return base_color;
+		}
+
+		const auto origin = p + bias * n;
+		auto L = XMVectorZero();
+
+		for (const auto& light : m_lights) {
+			XMVECTOR l, direction;
+			F32 attenuation = 1.0f;
+
+			if (LightType::Directional == light.m_type) {
+				l         = XMLoad(light.m_neg_d);
+				direction = m_shadow_length * l;
+			}
+			else {
+				const auto light_p  = XMLoad(light.m_p);
+				const auto sqr_dist = XMVectorGetX(
+					XMVector3LengthSq(light_p - p));
+				l         = XMVector3Normalize(light_p - p);
+				direction = light_p - origin;
+
+				// Distance attenuation (as in light.hlsli)
+				const auto smoothing = std::clamp(
+					1.0f - sqr_dist * light.m_inv_sqr_range, 0.0f, 1.0f);
+				attenuation = smoothing * smoothing
+					        / std::max(sqr_dist, 0.0001f);
+
+				if (LightType::Spot == light.m_type) {
+					// Angular attenuation (as in light.hlsli)
+					const auto cos_theta = XMVectorGetX(
+						XMVector3Dot(XMLoad(light.m_neg_d), l));
+					const auto aa = std::clamp(
+						(cos_theta - light.m_cos_umbra) * light.m_cos_inv_range,
+						0.0f, 1.0f);
+					attenuation *= aa * aa;
+				}
+			}
+
+			const auto n_dot_l = XMVectorGetX(XMVector3Dot(n, l));
+			if (0.0f >= n_dot_l || 0.0f >= attenuation) {
+				continue;
+			}
+
+			if (light.m_shadows && m_bvh.IsOccluded(origin, direction, 1.0f)) {
+				continue;
+			}
+
+			// Lambertian BRDF
+			L += (attenuation * n_dot_l * XM_1DIVPI)
+			   * base_color * XMLoad(light.m_I);
+		}
+
+		return L;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,410 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "scene\rendering_world.hpp"
+#include "geometry\triangle_bvh.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 A class of baking scenes containing the world space triangles, materials
+	 and lights of a world for baking on the CPU.
+
+	 Only the active, opaque and static (see World::MakeStatic) models whose 
+	 meshes have a CPU copy are included. All active lights are included, 
+	 since lights have no notion of being static: worlds with moving lights 
+	 should be baked before these lights are created. The direct lighting matches the Lambertian shading of the
+	 renderer, but uses ray-traced shadows (against a bounding volume
+	 hierarchy of all triangles) for the lights using shadows. All queries
+	 are thread-safe.
+	 */
+	class BakingScene final {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 A struct of baking materials.
+		 */
+		struct Material final {
+
+		public:
+
+			//-----------------------------------------------------------------
+			// Member Variables
+			//-----------------------------------------------------------------
+
+			/**
+			 The base color of this baking material.
+			 */
+			RGBA m_base_color;
+
+			/**
+			 A flag indicating whether this baking material is emissive.
+			 */
+			bool m_emissive = false;
+		};
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a baking scene.
+
+		 @param[in]		world
+						A reference to the world.
+		 @throws		Exception
+						The given world contains no static triangles with a 
+						CPU copy.
+		 */
+		explicit BakingScene(const World& world);
+
+		/**
+		 Constructs a baking scene of the given triangles without lights.
+
+		 @param[in]		vertices
+						A reference to a vector containing three consecutive 
+						(world space) vertex positions per triangle.
+		 @param[in]		material
+						A reference to the material of all triangles.
+		 @throws		Exception
+						The given triangles are all degenerate.
+		 */
+		explicit BakingScene(const std::vector< F32x3 >& vertices, 
+							 const Material& material);
+
+		/**
+		 Constructs a baking scene from the given baking scene.
+
+		 @param[in]		scene
+						A reference to the baking scene to copy.
+		 */
+		BakingScene(const BakingScene& scene) = delete;
+
+		/**
+		 Constructs a baking scene by moving the given baking scene.
+
+		 @param[in]		scene
+						A reference to the baking scene to move.
+		 */
+		BakingScene(BakingScene&& scene) noexcept;
+
+		/**
+		 Destructs this baking scene.
+		 */
+		~BakingScene();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given baking scene to this baking scene.
+
+		 @param[in]		scene
+						A reference to the baking scene to copy.
+		 @return		A reference to the copy of the given baking scene
+						(i.e. this baking scene).
+		 */
+		BakingScene& operator=(const BakingScene& scene) = delete;
+
+		/**
+		 Moves the given baking scene to this baking scene.
+
+		 @param[in]		scene
+						A reference to the baking scene to move.
+		 @return		A reference to the moved baking scene (i.e. this
+						baking scene).
+		 */
+		BakingScene& operator=(BakingScene&& scene) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the number of triangles of this baking scene.
+
+		 @return		The number of triangles of this baking scene.
+		 */
+		[[nodiscard]]
+		size_t GetNumberOfTriangles() const noexcept {
+			return m_bvh.GetNumberOfTriangles();
+		}
+
+		/**
+		 Returns the vertex positions of this baking scene.
+
+		 @return		A reference to a vector containing three consecutive
+						(world space) vertex positions per triangle of this
+						baking scene.
+		 */
+		[[nodiscard]]
+		const std::vector< F32x3 >& GetVertices() const noexcept {
+			return m_bvh.GetVertices();
+		}
+
+		/**
+		 Returns the normal of the given triangle of this baking scene.
+
+		 @pre			@a triangle < @c GetNumberOfTriangles().
+		 @param[in]		triangle
+						The index of the triangle.
+		 @return		A reference to the (normalized, world space) normal
+						of the given triangle of this baking scene.
+		 */
+		[[nodiscard]]
+		const F32x3& GetNormal(size_t triangle) const noexcept {
+			return m_normals[triangle];
+		}
+
+		/**
+		 Returns the material of the given triangle of this baking scene.
+
+		 @pre			@a triangle < @c GetNumberOfTriangles().
+		 @param[in]		triangle
+						The index of the triangle.
+		 @return		A reference to the material of the given triangle of
+						this baking scene.
+		 */
+		[[nodiscard]]
+		const Material& GetMaterial(size_t triangle) const noexcept {
+			return m_materials[m_triangle_to_material[triangle]];
+		}
+
+		/**
+		 Returns the (world space) minimum point of the AABB of this baking
+		 scene.
+
+		 @return		A reference to the (world space) minimum point of the
+						AABB of this baking scene.
+		 */
+		[[nodiscard]]
+		const F32x3& GetMinimum() const noexcept {
+			return m_minimum;
+		}
+
+		/**
+		 Returns the (world space) maximum point of the AABB of this baking
+		 scene.
+
+		 @return		A reference to the (world space) maximum point of the
+						AABB of this baking scene.
+		 */
+		[[nodiscard]]
+		const F32x3& GetMaximum() const noexcept {
+			return m_maximum;
+		}
+
+		/**
+		 Returns the ambient radiance of this baking scene.
+
+		 @return		A reference to the ambient radiance of this baking
+						scene.
+		 */
+		[[nodiscard]]
+		const RGB& GetAmbientRadiance() const noexcept {
+			return m_La;
+		}
+
+		/**
+		 Intersects the given ray with the triangles of this baking scene.
+
+		 @param[in]		origin
+						The origin of the ray.
+		 @param[in]		direction
+						The direction of the ray.
+		 @param[in]		t_max
+						The maximum ray parameter.
+		 @param[out]	hit
+						A reference to the closest hit (if any).
+		 @return		@c true if the given ray hits a triangle of this
+						baking scene within [0, @a t_max]. @c false
+						otherwise.
+		 */
+		bool XM_CALLCONV Intersect(FXMVECTOR origin,
+								   FXMVECTOR direction,
+								   F32 t_max,
+								   TriangleBVH::Hit& hit) const noexcept {
+
+			return m_bvh.Intersect(origin, direction, t_max, hit);
+		}
+
+		/**
+		 Returns the radiance leaving the given surface point due to emission
+		 and direct lighting.
+
+		 @param[in]		p
+						The surface position expressed in world space.
+		 @param[in]		n
+						The (normalized) surface normal expressed in world
+						space.
+		 @param[in]		material
+						A reference to the material.
+		 @param[in]		bias
+						The offset of the origin of shadow rays along the
+						surface normal.
+		 @return		The radiance leaving the given surface point due to
+						emission and direct lighting.
+		 */
+		[[nodiscard]]
+		const XMVECTOR XM_CALLCONV GetRadiance(FXMVECTOR p,
+											   FXMVECTOR n,
+											   const Material& material,
+											   F32 bias) const noexcept;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 An enumeration of the different baking light types.
+		 */
+		enum class LightType : U8 {
+			Directional,
+			Omni,
+			Spot
+		};
+
+		/**
+		 A struct of baking lights containing the world space data of a light.
+		 */
+		struct Light final {
+
+		public:
+
+			//-----------------------------------------------------------------
+			// Member Variables
+			//-----------------------------------------------------------------
+
+			/**
+			 The type of this baking light.
+			 */
+			LightType m_type = LightType::Directional;
+
+			/**
+			 A flag indicating whether this baking light casts shadows.
+			 */
+			bool m_shadows = false;
+
+			/**
+			 The position of this (omni or spot) baking light.
+			 */
+			F32x3 m_p = {};
+
+			/**
+			 The negated direction of this (directional or spot) baking light.
+			 */
+			F32x3 m_neg_d = {};
+
+			/**
+			 The irradiance (directional) or intensity (omni or spot) of this
+			 baking light.
+			 */
+			RGB m_I;
+
+			/**
+			 The inverse squared range of this (omni or spot) baking light.
+			 */
+			F32 m_inv_sqr_range = 0.0f;
+
+			/**
+			 The cosine of the umbra angle of this (spot) baking light.
+			 */
+			F32 m_cos_umbra = 0.0f;
+
+			/**
+			 The inverse cosine range of this (spot) baking light.
+			 */
+			F32 m_cos_inv_range = 0.0f;
+		};
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		void XM_CALLCONV AddTriangle(FXMVECTOR p0, 
+									 FXMVECTOR p1, 
+									 FXMVECTOR p2, 
+									 U32 material, 
+									 std::vector< F32x3 >& vertices, 
+									 AABB& bounds);
+		void BuildBVH(std::vector< F32x3 > vertices, const AABB& bounds);
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A vector containing the materials of this baking scene.
+		 */
+		std::vector< Material > m_materials;
+
+		/**
+		 A vector containing the (normalized, world space) normal of each
+		 triangle of this baking scene.
+		 */
+		std::vector< F32x3 > m_normals;
+
+		/**
+		 A vector containing the material index of each triangle of this
+		 baking scene.
+		 */
+		std::vector< U32 > m_triangle_to_material;
+
+		/**
+		 A vector containing the lights of this baking scene.
+		 */
+		std::vector< Light > m_lights;
+
+		/**
+		 The ambient radiance of this baking scene.
+		 */
+		RGB m_La;
+
+		/**
+		 The (world space) minimum point of the AABB of this baking scene.
+		 */
+		F32x3 m_minimum;
+
+		/**
+		 The (world space) maximum point of the AABB of this baking scene.
+		 */
+		F32x3 m_maximum;
+
+		/**
+		 The length of the shadow rays of directional lights of this baking
+		 scene.
+		 */
+		F32 m_shadow_length;
+
+		/**
+		 The triangle BVH of this baking scene.
+		 */
+		TriangleBVH m_bvh;
+	};
+}
\ No newline at end of file
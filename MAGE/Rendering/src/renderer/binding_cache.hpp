@@ -0,0 +1,177 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "type\types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <array>
+#include <bitset>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 A class of binding caches.
+
+	 A binding cache holds a shadow copy of the values bound to a number of
+	 slots of a device context, in order to detect redundant bindings. A
+	 binding cache does not depend on the device context itself.
+
+	 @tparam		T
+					The value type.
+	 @tparam		N
+					The number of slots.
+	 */
+	template< typename T, size_t N >
+	class BindingCache final {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a binding cache with all slots invalidated.
+		 */
+		BindingCache() noexcept
+			: m_values{},
+			m_valid() {}
+
+		/**
+		 Constructs a binding cache from the given binding cache.
+
+		 @param[in]		cache
+						A reference to the binding cache to copy.
+		 */
+		BindingCache(const BindingCache& cache) noexcept = default;
+
+		/**
+		 Constructs a binding cache by moving the given binding cache.
+
+		 @param[in]		cache
+						A reference to the binding cache to move.
+		 */
+		BindingCache(BindingCache&& cache) noexcept = default;
+
+		/**
+		 Destructs this binding cache.
+		 */
+		~BindingCache() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given binding cache to this binding cache.
+
+		 @param[in]		cache
+						A reference to the binding cache to copy.
+		 @return		A reference to the copy of the given binding cache
+						(i.e. this binding cache).
+		 */
+		BindingCache& operator=(const BindingCache& cache) noexcept = default;
+
+		/**
+		 Moves the given binding cache to this binding cache.
+
+		 @param[in]		cache
+						A reference to the binding cache to move.
+		 @return		A reference to the moved binding cache (i.e. this
+						binding cache).
+		 */
+		BindingCache& operator=(BindingCache&& cache) noexcept = default;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Updates the value of the given slot of this binding cache.
+
+		 @pre			@a slot < @a N.
+		 @param[in]		slot
+						The slot.
+		 @param[in]		value
+						A reference to the value.
+		 @return		@c true if the given value differs from the cached
+						value or the slot was invalidated (i.e. the binding
+						must be issued). @c false otherwise (i.e. the binding
+						is redundant).
+		 */
+		[[nodiscard]]
+		bool Update(size_t slot, const T& value) noexcept {
+			return Update(slot, 1u, &value);
+		}
+
+		/**
+		 Updates the values of the given slots of this binding cache.
+
+		 @pre			@a slot + @a nb_values <= @a N.
+		 @pre			@a values points to an array containing at least
+						@a nb_values values.
+		 @param[in]		slot
+						The first slot.
+		 @param[in]		nb_values
+						The number of values.
+		 @param[in]		values
+						A pointer to the array of values.
+		 @return		@c true if any of the given values differs from the
+						cached value or its slot was invalidated (i.e. the
+						binding must be issued). @c false otherwise (i.e. the
+						binding is redundant).
+		 */
+		[[nodiscard]]
+		bool Update(size_t slot, size_t nb_values, const T* values) noexcept {
+			bool changed = false;
+			for (size_t i = 0u; i < nb_values; ++i) {
+				const auto index = slot + i;
+				if (!m_valid[index] || !(m_values[index] == values[i])) {
+					m_values[index] = values[i];
+					m_valid.set(index);
+					changed = true;
+				}
+			}
+
+			return changed;
+		}
+
+		/**
+		 Invalidates all slots of this binding cache.
+		 */
+		void Invalidate() noexcept {
+			m_valid.reset();
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The cached values of this binding cache.
+		 */
+		std::array< T, N > m_values;
+
+		/**
+		 The valid flags of the slots of this binding cache.
+		 */
+		std::bitset< N > m_valid;
+	};
+}
\ No newline at end of file
@@ -7,6 +7,7 @@
 
 #include "geometry\geometry.hpp"
 #include "spectrum\spectrum.hpp"
+#include "renderer\shadow\shadow_cascades.hpp"
 
 #pragma endregion
 
@@ -44,7 +45,13 @@ namespace mage::rendering {
 			m_nb_sm_spot_lights(0u), 
 			m_padding1(0u), 
 			m_La(),
-			m_padding2(0.0f) {}
+			m_padding2(0.0f), 
+			m_probe_volume_minimum(), 
+			m_padding3(0u), 
+			m_probe_volume_scale(), 
+			m_padding4(0u), 
+			m_probe_volume_resolution(), 
+			m_padding5(0u) {}
 		
 		/**
 		 Constructs a light buffer from the given light buffer.
@@ -153,9 +160,46 @@ namespace mage::rendering {
 		 The padding of this light buffer.
 		 */
 		F32 m_padding2;
+
+		//---------------------------------------------------------------------
+		// Member Variables: Irradiance Probes
+		//---------------------------------------------------------------------
+
+		/**
+		 The (world space) minimum point of the irradiance volume of this 
+		 light buffer.
+		 */
+		F32x3 m_probe_volume_minimum;
+
+		/**
+		 The padding of this light buffer.
+		 */
+		U32 m_padding3;
+
+		/**
+		 The scaling factors from world space to the grid space of the 
+		 irradiance volume of this light buffer.
+		 */
+		F32x3 m_probe_volume_scale;
+
+		/**
+		 The padding of this light buffer.
+		 */
+		U32 m_padding4;
+
+		/**
+		 The number of probes along each axis of the irradiance volume of this 
+		 light buffer (or zero if no irradiance volume is available).
+		 */
+		U32x3 m_probe_volume_resolution;
+
+		/**
+		 The padding of this light buffer.
+		 */
+		U32 m_padding5;
 	};
 
-	static_assert(48 == sizeof(LightBuffer), 
+	static_assert(96 == sizeof(LightBuffer), 
 				  "CPU/GPU struct mismatch");
 
 	#pragma endregion
@@ -504,6 +548,139 @@ namespace mage::rendering {
 
 	#pragma endregion
 
+	//-------------------------------------------------------------------------
+	// ShadowMappedDirectionalLightBuffer
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A struct of shadow mapped directional light buffers used by shaders.
+	 */
+	struct alignas(16) ShadowMappedDirectionalLightBuffer final {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a shadow mapped directional light buffer.
+		 */
+		ShadowMappedDirectionalLightBuffer() noexcept
+			: m_light(), 
+			m_cascade_world_to_projection{}, 
+			m_cascade_tiles{}, 
+			m_nb_cascades(0u), 
+			m_padding0{} {}
+		
+		/**
+		 Constructs a shadow mapped directional light buffer from the given 
+		 shadow mapped directional light buffer.
+
+		 @param[in]		buffer
+						A reference to the shadow mapped directional light 
+						buffer to copy.
+		 */
+		ShadowMappedDirectionalLightBuffer(
+			const ShadowMappedDirectionalLightBuffer& buffer) noexcept = default;
+
+		/**
+		 Constructs a shadow mapped directional light buffer by moving the 
+		 given shadow mapped directional light buffer.
+
+		 @param[in]		buffer
+						A reference to the shadow mapped directional light 
+						buffer to move.
+		 */
+		ShadowMappedDirectionalLightBuffer(
+			ShadowMappedDirectionalLightBuffer&& buffer) noexcept = default;
+		
+		/**
+		 Destructs this shadow mapped directional light buffer.
+		 */
+		~ShadowMappedDirectionalLightBuffer() = default;
+		
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given shadow mapped directional light buffer to this 
+		 shadow mapped directional light buffer.
+
+		 @param[in]		buffer
+						A reference to the shadow mapped directional light 
+						buffer to copy.
+		 @return		A reference to the copy of the given shadow mapped 
+						directional light buffer (i.e. this shadow mapped 
+						directional light buffer).
+		 */
+		ShadowMappedDirectionalLightBuffer& operator=(
+			const ShadowMappedDirectionalLightBuffer& buffer) = default;
+
+		/**
+		 Moves the given shadow mapped directional light buffer to this shadow 
+		 mapped directional light buffer.
+
+		 @param[in]		buffer
+						A reference to the shadow mapped directional light 
+						buffer to move.
+		 @return		A reference to the moved shadow mapped directional 
+						light buffer (i.e. this shadow mapped directional light 
+						buffer).
+		 */
+		ShadowMappedDirectionalLightBuffer& operator=(
+			ShadowMappedDirectionalLightBuffer&& buffer) = default;
+
+		//---------------------------------------------------------------------
+		// Member Variables: Light
+		//---------------------------------------------------------------------
+
+		/**
+		 The directional light buffer of this shadow mapped directional light 
+		 buffer.
+		 */
+		DirectionalLightBuffer m_light;
+
+		//---------------------------------------------------------------------
+		// Member Variables: Shadow Cascades
+		//---------------------------------------------------------------------
+
+		// HLSL expects column-major packed matrices by default.
+		// DirectXMath expects row-major packed matrices.
+
+		/**
+		 The (column-major packed, row-major matrix) world-to-projection 
+		 matrices of the shadow cascades of this shadow mapped directional 
+		 light buffer.
+		 */
+		XMMATRIX m_cascade_world_to_projection[MAGE_MAX_NB_SHADOW_CASCADES];
+
+		/**
+		 The shadow atlas tile transforms of the shadow cascades of this 
+		 shadow mapped directional light buffer: [offset_u, offset_v, 
+		 scale_u, scale_v]. A zero scale indicates that no tile is allocated.
+		 */
+		F32x4 m_cascade_tiles[MAGE_MAX_NB_SHADOW_CASCADES];
+
+		/**
+		 The number of shadow cascades of this shadow mapped directional light 
+		 buffer.
+		 */
+		U32 m_nb_cascades;
+
+		/**
+		 The padding of this shadow mapped directional light buffer.
+		 */
+		U32 m_padding0[3];
+	};
+
+	static_assert(432 == sizeof(ShadowMappedDirectionalLightBuffer), 
+				  "CPU/GPU struct mismatch");
+
+	#pragma endregion
+
 	//-------------------------------------------------------------------------
 	// ShadowMappedOmniLightBuffer
 	//-------------------------------------------------------------------------
@@ -527,7 +704,8 @@ namespace mage::rendering {
 			: m_light(), 
 			m_world_to_light{}, 
 			m_projection_values(), 
-			m_padding0() {}
+			m_padding0(), 
+			m_shadow_tiles{} {}
 		
 		/**
 		 Constructs a shadow mapped omni light buffer from the given shadow 
@@ -619,9 +797,20 @@ namespace mage::rendering {
 		 The padding of this shadow mapped omni light buffer. 
 		 */
 		U32 m_padding0[2];
+
+		//---------------------------------------------------------------------
+		// Member Variables: Shadow Map
+		//---------------------------------------------------------------------
+
+		/**
+		 The shadow atlas tile transforms of the six faces (+x, -x, +y, -y, +z, 
+		 -z) of this shadow mapped omni light buffer: [offset_u, offset_v, 
+		 scale_u, scale_v]. A zero scale indicates that no tile is allocated.
+		 */
+		F32x4 m_shadow_tiles[6];
 	};
 
-	static_assert(112 == sizeof(ShadowMappedOmniLightBuffer), 
+	static_assert(208 == sizeof(ShadowMappedOmniLightBuffer), 
 				  "CPU/GPU struct mismatch");
 
 	#pragma endregion
@@ -647,7 +836,8 @@ namespace mage::rendering {
 		 */
 		ShadowMappedSpotLightBuffer() noexcept
 			: m_light(), 
-			m_world_to_projection{} {}
+			m_world_to_projection{}, 
+			m_shadow_tile() {}
 		
 		/**
 		 Constructs a shadow mapped spotlight buffer from the given shadow 
@@ -728,9 +918,112 @@ namespace mage::rendering {
 		 matrix of this shadow mapped spotlight buffer.
 		 */
 		XMMATRIX m_world_to_projection;
+
+		//---------------------------------------------------------------------
+		// Member Variables: Shadow Map
+		//---------------------------------------------------------------------
+
+		/**
+		 The shadow atlas tile transform of this shadow mapped spotlight 
+		 buffer: [offset_u, offset_v, scale_u, scale_v]. A zero scale 
+		 indicates that no tile is allocated.
+		 */
+		F32x4 m_shadow_tile;
+	};
+
+	static_assert(128 == sizeof(ShadowMappedSpotLightBuffer), 
+				  "CPU/GPU struct mismatch");
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// IrradianceProbeBuffer
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A struct of irradiance probe buffers used by shaders.
+	 */
+	struct IrradianceProbeBuffer final {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs an irradiance probe buffer.
+		 */
+		IrradianceProbeBuffer() noexcept
+			: m_E{} {}
+		
+		/**
+		 Constructs an irradiance probe buffer from the given irradiance probe 
+		 buffer.
+
+		 @param[in]		buffer
+						A reference to the irradiance probe buffer to copy.
+		 */
+		IrradianceProbeBuffer(
+			const IrradianceProbeBuffer& buffer) noexcept = default;
+
+		/**
+		 Constructs an irradiance probe buffer by moving the given irradiance 
+		 probe buffer.
+
+		 @param[in]		buffer
+						A reference to the irradiance probe buffer to move.
+		 */
+		IrradianceProbeBuffer(
+			IrradianceProbeBuffer&& buffer) noexcept = default;
+		
+		/**
+		 Destructs this irradiance probe buffer.
+		 */
+		~IrradianceProbeBuffer() = default;
+		
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given irradiance probe buffer to this irradiance probe 
+		 buffer.
+
+		 @param[in]		buffer
+						A reference to the irradiance probe buffer to copy.
+		 @return		A reference to the copy of the given irradiance probe 
+						buffer (i.e. this irradiance probe buffer).
+		 */
+		IrradianceProbeBuffer& operator=(
+			const IrradianceProbeBuffer& buffer) = default;
+
+		/**
+		 Moves the given irradiance probe buffer to this irradiance probe 
+		 buffer.
+
+		 @param[in]		buffer
+						A reference to the irradiance probe buffer to move.
+		 @return		A reference to the moved irradiance probe buffer (i.e. 
+						this irradiance probe buffer).
+		 */
+		IrradianceProbeBuffer& operator=(
+			IrradianceProbeBuffer&& buffer) = default;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The second-order spherical harmonics coefficients of the irradiance 
+		 in watts per square meter of the probe of this irradiance probe 
+		 buffer.
+		 */
+		RGB m_E[9];
 	};
 
-	static_assert(112 == sizeof(ShadowMappedSpotLightBuffer), 
+	static_assert(108 == sizeof(IrradianceProbeBuffer), 
 				  "CPU/GPU struct mismatch");
 
 	#pragma endregion
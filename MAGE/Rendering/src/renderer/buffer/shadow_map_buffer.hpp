@@ -5,19 +5,11 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
+#include "renderer\shadow\shadow_atlas_allocator.hpp"
 #include "scene\camera\viewport.hpp"
 
 #pragma endregion
 
-//-----------------------------------------------------------------------------
-// System Includes
-//-----------------------------------------------------------------------------
-#pragma region
-
-#include <vector>
-
-#pragma endregion
-
 //-----------------------------------------------------------------------------
 // Engine Defines
 //-----------------------------------------------------------------------------
@@ -28,6 +20,10 @@
 #define MAGE_DEFAULT_SLOPE_SCALED_DEPTH_BIAS  1.0f
 #define MAGE_DEFAULT_DEPTH_BIAS_CLAMP         0.0f
 
+#define MAGE_DEFAULT_SHADOW_ATLAS_RESOLUTION  4096u
+#define MAGE_DEFAULT_MIN_SHADOW_MAP_SIZE      128u
+#define MAGE_DEFAULT_MAX_SHADOW_MAP_SIZE      1024u
+
 #pragma endregion
 
 //-----------------------------------------------------------------------------
@@ -45,105 +41,18 @@ namespace mage::rendering {
 	};
 
 	//-------------------------------------------------------------------------
-	// ShadowMapBuffer
+	// ShadowAtlasBuffer
 	//-------------------------------------------------------------------------
 	#pragma region
 
-	class ShadowMapBuffer final {
-
-	public:
-
-		//---------------------------------------------------------------------
-		// Constructors and Destructors
-		//---------------------------------------------------------------------
-
-		explicit ShadowMapBuffer(ID3D11Device& device,
-			                     size_t nb_shadow_maps, 
-								 const U32x2& resolution = { 512u, 512u }, 
-			                     DepthFormat format = DepthFormat::D16);
-		ShadowMapBuffer(const ShadowMapBuffer& buffer) = delete;
-		ShadowMapBuffer(ShadowMapBuffer&& buffer) noexcept;
-		~ShadowMapBuffer();
-
-		//---------------------------------------------------------------------
-		// Assignment Operators
-		//---------------------------------------------------------------------
-
-		ShadowMapBuffer& operator=(const ShadowMapBuffer& buffer) = delete;
-		ShadowMapBuffer& operator=(ShadowMapBuffer&& buffer) noexcept;
-
-		//---------------------------------------------------------------------
-		// Member Methods
-		//---------------------------------------------------------------------
-
-		[[nodiscard]]
-		size_t GetNumberOfShadowMaps() const noexcept {
-			using std::size;
-			return size(m_dsvs);
-		}
-
-		void Bind(ID3D11DeviceContext& device_context) const noexcept {
-			m_viewport.Bind(device_context);
-		}
-		void BindRasterizerState(ID3D11DeviceContext& device_context) const noexcept {
-			Pipeline::RS::BindState(device_context, m_rasterizer_state.Get());
-		}
-		
-		void ClearDSVs(ID3D11DeviceContext& device_context) const noexcept {
-			for (const auto& dsv : m_dsvs) {
-				Pipeline::OM::ClearDepthOfDSV(device_context, dsv.Get());
-			}
-		}
-		void BindDSV(ID3D11DeviceContext& device_context, 
-			         size_t dsv_index) const noexcept {
-
-			Pipeline::OM::BindRTVAndDSV(device_context, nullptr, m_dsvs[dsv_index].Get());
-		}
-		[[nodiscard]]
-		ID3D11DepthStencilView& GetDSV(size_t dsv_index) const noexcept {
-			return *m_dsvs[dsv_index].Get();
-		}
-		[[nodiscard]]
-		ID3D11ShaderResourceView& GetSRV() const noexcept {
-			return *m_srv.Get();
-		}
-
-	private:
+	/**
+	 A class of shadow atlas buffers.
 
-		//---------------------------------------------------------------------
-		// Member Methods
-		//---------------------------------------------------------------------
-
-		void SetupRasterizerState(ID3D11Device& device);
-
-		void SetupShadowMapBuffer(ID3D11Device& device,
-			                      size_t nb_shadow_maps);
-		void SetupShadowMapArray(ID3D11Device& device,
-			                     size_t nb_shadow_maps, 
-			                     DXGI_FORMAT texture_format,
-			                     DXGI_FORMAT dsv_format, 
-			                     DXGI_FORMAT srv_format);
-
-		//---------------------------------------------------------------------
-		// Member Variables
-		//---------------------------------------------------------------------
-
-		DepthFormat m_format;
-		Viewport m_viewport;
-		ComPtr< ID3D11RasterizerState > m_rasterizer_state;
-		
-		std::vector< ComPtr< ID3D11DepthStencilView > > m_dsvs;
-		ComPtr< ID3D11ShaderResourceView > m_srv;
-	};
-
-	#pragma endregion
-
-	//-------------------------------------------------------------------------
-	// ShadowCubeMapBuffer
-	//-------------------------------------------------------------------------
-	#pragma region
-
-	class ShadowCubeMapBuffer final {
+	 A shadow atlas buffer contains the shadow maps of all shadow mapped 
+	 lights (including the six faces of the omni lights) as tiles of a single 
+	 depth texture. The tiles are assigned by a shadow atlas allocator.
+	 */
+	class ShadowAtlasBuffer final {
 
 	public:
 
@@ -151,56 +60,55 @@ namespace mage::rendering {
 		// Constructors and Destructors
 		//---------------------------------------------------------------------
 
-		explicit ShadowCubeMapBuffer(ID3D11Device& device,
-			                         size_t nb_shadow_cube_maps,
-									 const U32x2& resolution = { 512u, 512u },
-			                         DepthFormat format = DepthFormat::D16);
-		ShadowCubeMapBuffer(const ShadowCubeMapBuffer& buffer) = delete;
-		ShadowCubeMapBuffer(ShadowCubeMapBuffer&& buffer) noexcept;
-		~ShadowCubeMapBuffer();
+		explicit ShadowAtlasBuffer(ID3D11Device& device,
+			                       U32 resolution = MAGE_DEFAULT_SHADOW_ATLAS_RESOLUTION, 
+			                       DepthFormat format = DepthFormat::D16);
+		ShadowAtlasBuffer(const ShadowAtlasBuffer& buffer) = delete;
+		ShadowAtlasBuffer(ShadowAtlasBuffer&& buffer) noexcept;
+		~ShadowAtlasBuffer();
 
 		//---------------------------------------------------------------------
 		// Assignment Operators
 		//---------------------------------------------------------------------
 
-		ShadowCubeMapBuffer& operator=(const ShadowCubeMapBuffer& buffer) = delete;
-		ShadowCubeMapBuffer& operator=(ShadowCubeMapBuffer&& buffer) noexcept;
+		ShadowAtlasBuffer& operator=(const ShadowAtlasBuffer& buffer) = delete;
+		ShadowAtlasBuffer& operator=(ShadowAtlasBuffer&& buffer) noexcept;
 
 		//---------------------------------------------------------------------
 		// Member Methods
 		//---------------------------------------------------------------------
 
 		[[nodiscard]]
-		size_t GetNumberOfShadowMaps() const noexcept {
-			using std::size;
-			return size(m_dsvs);
-		}
-		[[nodiscard]]
-		size_t GetNumberOfShadowCubeMaps() const noexcept {
-			using std::size;
-			return size(m_dsvs) / 6u;
+		U32 GetResolution() const noexcept {
+			return m_resolution;
 		}
 
-		void Bind(ID3D11DeviceContext& device_context) const noexcept {
-			m_viewport.Bind(device_context);
+		void BindViewport(ID3D11DeviceContext& device_context, 
+			              const ShadowAtlasTile& tile) const noexcept {
+
+			D3D11_VIEWPORT viewport = {};
+			viewport.TopLeftX = static_cast< F32 >(tile.m_position[0]);
+			viewport.TopLeftY = static_cast< F32 >(tile.m_position[1]);
+			viewport.Width    = static_cast< F32 >(tile.m_size);
+			viewport.Height   = static_cast< F32 >(tile.m_size);
+			viewport.MinDepth = 0.0f;
+			viewport.MaxDepth = 1.0f;
+			
+			Viewport(viewport).Bind(device_context);
 		}
 		void BindRasterizerState(ID3D11DeviceContext& device_context) const noexcept {
 			Pipeline::RS::BindState(device_context, m_rasterizer_state.Get());
 		}
 		
-		void ClearDSVs(ID3D11DeviceContext& device_context) const noexcept {
-			for (const auto& dsv : m_dsvs) {
-				Pipeline::OM::ClearDepthOfDSV(device_context, dsv.Get());
-			}
+		void ClearDSV(ID3D11DeviceContext& device_context) const noexcept {
+			Pipeline::OM::ClearDepthOfDSV(device_context, m_dsv.Get());
 		}
-		void BindDSV(ID3D11DeviceContext& device_context, 
-			         size_t dsv_index) const noexcept {
-
-			Pipeline::OM::BindRTVAndDSV(device_context, nullptr, m_dsvs[dsv_index].Get());
+		void BindDSV(ID3D11DeviceContext& device_context) const noexcept {
+			Pipeline::OM::BindRTVAndDSV(device_context, nullptr, m_dsv.Get());
 		}
 		[[nodiscard]]
-		ID3D11DepthStencilView& GetDSV(size_t dsv_index) const noexcept {
-			return *m_dsvs[dsv_index].Get();
+		ID3D11DepthStencilView& GetDSV() const noexcept {
+			return *m_dsv.Get();
 		}
 		[[nodiscard]]
 		ID3D11ShaderResourceView& GetSRV() const noexcept {
@@ -215,23 +123,21 @@ namespace mage::rendering {
 
 		void SetupRasterizerState(ID3D11Device& device);
 
-		void SetupShadowCubeMapBuffer(ID3D11Device& device,
-			                          size_t nb_shadow_cube_maps);
-		void SetupShadowCubeMapArray(ID3D11Device& device,
-			                         size_t nb_shadow_cube_maps, 
-			                         DXGI_FORMAT texture_format,
-			                         DXGI_FORMAT dsv_format, 
-			                         DXGI_FORMAT srv_format);
+		void SetupShadowAtlasBuffer(ID3D11Device& device);
+		void SetupShadowAtlas(ID3D11Device& device,
+			                  DXGI_FORMAT texture_format,
+			                  DXGI_FORMAT dsv_format, 
+			                  DXGI_FORMAT srv_format);
 
 		//---------------------------------------------------------------------
 		// Member Variables
 		//---------------------------------------------------------------------
 
 		DepthFormat m_format;
-		Viewport m_viewport;
+		U32 m_resolution;
 		ComPtr< ID3D11RasterizerState > m_rasterizer_state;
 		
-		std::vector< ComPtr< ID3D11DepthStencilView > > m_dsvs;
+		ComPtr< ID3D11DepthStencilView > m_dsv;
 		ComPtr< ID3D11ShaderResourceView > m_srv;
 	};
 
@@ -12,6 +12,15 @@
 
 #pragma endregion
 
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <DirectXPackedVector.h>
+
+#pragma endregion
+
 //-----------------------------------------------------------------------------
 // Engine Definitions
 //-----------------------------------------------------------------------------
@@ -24,7 +33,9 @@ namespace mage::rendering {
 		m_buffer_srv(), 
 		m_buffer_uav(), 
 		m_texture_srv(), 
-		m_texture_uav() {
+		m_texture_uav(), 
+		m_mip_srvs(), 
+		m_mip_uavs() {
 
 		SetupVoxelGrid(device);
 	}
@@ -136,6 +147,37 @@ namespace mage::rendering {
 				texture.Get(), nullptr, m_texture_uav.ReleaseAndGetAddressOf());
 			ThrowIfFailed(result, "UAV creation failed: %08X.", result);
 		}
+
+		D3D11_TEXTURE3D_DESC texture_desc;
+		texture->GetDesc(&texture_desc);
+		m_mip_srvs.resize(texture_desc.MipLevels);
+		m_mip_uavs.resize(texture_desc.MipLevels);
+
+		// Create the SRV and UAV of each mip level.
+		for (U32 i = 0u; i < texture_desc.MipLevels; ++i) {
+			// Create the SRV descriptor.
+			D3D11_SHADER_RESOURCE_VIEW_DESC srv_desc = {};
+			srv_desc.Format                    = texture_desc.Format;
+			srv_desc.ViewDimension             = D3D11_SRV_DIMENSION_TEXTURE3D;
+			srv_desc.Texture3D.MostDetailedMip = i;
+			srv_desc.Texture3D.MipLevels       = 1u;
+
+			const HRESULT srv_result = device.CreateShaderResourceView(
+				texture.Get(), &srv_desc, m_mip_srvs[i].ReleaseAndGetAddressOf());
+			ThrowIfFailed(srv_result, "SRV creation failed: %08X.", srv_result);
+
+			// Create the UAV descriptor.
+			D3D11_UNORDERED_ACCESS_VIEW_DESC uav_desc = {};
+			uav_desc.Format                = texture_desc.Format;
+			uav_desc.ViewDimension         = D3D11_UAV_DIMENSION_TEXTURE3D;
+			uav_desc.Texture3D.MipSlice    = i;
+			uav_desc.Texture3D.FirstWSlice = 0u;
+			uav_desc.Texture3D.WSize       = static_cast< U32 >(-1);
+
+			const HRESULT uav_result = device.CreateUnorderedAccessView(
+				texture.Get(), &uav_desc, m_mip_uavs[i].ReleaseAndGetAddressOf());
+			ThrowIfFailed(uav_result, "UAV creation failed: %08X.", uav_result);
+		}
 	}
 
 	void VoxelGrid::BindBeginVoxelizationBuffer(
@@ -179,8 +221,35 @@ namespace mage::rendering {
 							  nullptr);
 		Pipeline::CS::BindUAV(device_context, SLOT_UAV_VOXEL_TEXTURE, 
 							  nullptr);
+	}
+
+	void VoxelGrid::BindBeginVoxelizationMip(
+		ID3D11DeviceContext& device_context, U32 mip_level) const noexcept {
+
+		// Bind the UAV first to replace the UAV of the previous mip level.
+		Pipeline::CS::BindUAV(device_context, SLOT_UAV_VOXEL_TEXTURE, 
+							  m_mip_uavs[mip_level].Get());
+		Pipeline::CS::BindSRV(device_context, SLOT_SRV_VOXEL_MIP, 
+							  m_mip_srvs[mip_level - 1u].Get());
+	}
+
+	void VoxelGrid::BindEndVoxelizationMip(
+		ID3D11DeviceContext& device_context) const noexcept {
+
+		Pipeline::CS::BindUAV(device_context, SLOT_UAV_VOXEL_TEXTURE, 
+							  nullptr);
+		Pipeline::CS::BindSRV(device_context, SLOT_SRV_VOXEL_MIP, 
+							  nullptr);
+	}
+
+	void VoxelGrid::GenerateMips(
+		ID3D11DeviceContext& device_context) const noexcept {
 
 		device_context.GenerateMips(m_texture_srv.Get());
+	}
+
+	void VoxelGrid::BindVoxelTexture(
+		ID3D11DeviceContext& device_context) const noexcept {
 
 		Pipeline::VS::BindSRV(device_context, SLOT_SRV_VOXEL_TEXTURE, 
 							  m_texture_srv.Get());
@@ -189,4 +258,59 @@ namespace mage::rendering {
 		Pipeline::CS::BindSRV(device_context, SLOT_SRV_VOXEL_TEXTURE,
 							  m_texture_srv.Get());
 	}
+
+	void VoxelGrid::UploadVoxelTexture(ID3D11DeviceContext& device_context, 
+									   const SparseVoxelGrid& grid) const {
+
+		using DirectX::PackedVector::XMConvertFloatToHalf;
+
+		ThrowIfFailed(grid.GetResolution() == m_resolution, 
+					  "Voxel grid resolution mismatch: %u != %zu.", 
+					  grid.GetResolution(), m_resolution);
+
+		const size_t resolution = m_resolution;
+		const size_t brick_size = grid.GetBrickSize();
+		const auto   nb_words   = grid.GetNumberOfMaskWords();
+		const auto&  bricks     = grid.GetBricks();
+		const auto&  masks      = grid.GetMasks();
+		const auto&  voxels     = grid.GetVoxels();
+		const auto   nb_voxels_per_brick = brick_size * brick_size * brick_size;
+
+		// R16G16B16A16_FLOAT texels (empty voxels are zero).
+		std::vector< U16 > data(4u * resolution * resolution * resolution, 0u);
+
+		for (size_t b = 0u; b < bricks.size(); ++b) {
+			const auto brick = SparseVoxelGrid::UnpackBrick(bricks[b]);
+			auto offset = grid.GetVoxelOffset(b);
+
+			for (size_t i = 0u; i < nb_voxels_per_brick; ++i) {
+				if (0u == (masks[b * nb_words + (i >> 5u)] & (1u << (i & 31u)))) {
+					continue;
+				}
+
+				const auto voxel = SparseVoxelGrid::Unpack(voxels[offset++]);
+				const auto x = brick[0] * brick_size + i % brick_size;
+				const auto y = brick[1] * brick_size + (i / brick_size) % brick_size;
+				const auto z = brick[2] * brick_size + i / (brick_size * brick_size);
+
+				// The rows of the voxel texture are stored top-down.
+				const auto texel = 4u * (x + resolution 
+								 * ((resolution - 1u - y) + resolution * z));
+				data[texel]      = XMConvertFloatToHalf(voxel.m_radiance[0]);
+				data[texel + 1u] = XMConvertFloatToHalf(voxel.m_radiance[1]);
+				data[texel + 2u] = XMConvertFloatToHalf(voxel.m_radiance[2]);
+				data[texel + 3u] = XMConvertFloatToHalf(1.0f);
+			}
+		}
+
+		ComPtr< ID3D11Resource > texture;
+		m_texture_srv->GetResource(texture.ReleaseAndGetAddressOf());
+
+		const auto row_pitch = static_cast< U32 >(4u * sizeof(U16) * resolution);
+		Pipeline::UpdateSubresource(device_context, *texture.Get(), 0u, 
+									data.data(), row_pitch, 
+									row_pitch * static_cast< U32 >(resolution));
+
+		GenerateMips(device_context);
+	}
 }
\ No newline at end of file
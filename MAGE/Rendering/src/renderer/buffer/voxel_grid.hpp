@@ -6,6 +6,16 @@
 #pragma region
 
 #include "scene\camera\viewport.hpp"
+#include "renderer\voxelization\sparse_voxel_grid.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <vector>
 
 #pragma endregion
 
@@ -31,6 +41,11 @@ namespace mage::rendering {
 			return m_resolution;
 		}
 
+		[[nodiscard]]
+		U32 GetNumberOfMipLevels() const noexcept {
+			return static_cast< U32 >(m_mip_uavs.size());
+		}
+
 		void BindBeginVoxelizationBuffer(
 			ID3D11DeviceContext& device_context) const noexcept;
 		void BindEndVoxelizationBuffer(
@@ -39,6 +54,17 @@ namespace mage::rendering {
 			ID3D11DeviceContext& device_context) const noexcept;
 		void BindEndVoxelizationTexture(
 			ID3D11DeviceContext& device_context) const noexcept;
+		void BindBeginVoxelizationMip(
+			ID3D11DeviceContext& device_context, U32 mip_level) const noexcept;
+		void BindEndVoxelizationMip(
+			ID3D11DeviceContext& device_context) const noexcept;
+		void GenerateMips(
+			ID3D11DeviceContext& device_context) const noexcept;
+		void BindVoxelTexture(
+			ID3D11DeviceContext& device_context) const noexcept;
+		void UploadVoxelTexture(
+			ID3D11DeviceContext& device_context, 
+			const SparseVoxelGrid& grid) const;
 
 	private:
 
@@ -55,5 +81,8 @@ namespace mage::rendering {
 
 		ComPtr< ID3D11ShaderResourceView > m_texture_srv;
 		ComPtr< ID3D11UnorderedAccessView > m_texture_uav;
+
+		std::vector< ComPtr< ID3D11ShaderResourceView > > m_mip_srvs;
+		std::vector< ComPtr< ID3D11UnorderedAccessView > > m_mip_uavs;
 	};
 }
\ No newline at end of file
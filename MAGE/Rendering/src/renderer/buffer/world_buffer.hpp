@@ -41,7 +41,9 @@ namespace mage::rendering {
 			m_voxel_inv_size(0.0f), 
 			m_time(0.0f), 
 			m_inv_gamma(1.0f), 
-			m_padding() {}
+			m_padding0(), 
+			m_voxel_texture_offset(), 
+			m_padding1(0u) {}
 
 		/**
 		 Constructs a world buffer from the given world buffer.
@@ -169,10 +171,25 @@ namespace mage::rendering {
 		F32 m_inv_gamma;
 
 		/**
-		 The passing of this world buffer.
+		 The padding of this world buffer.
 		 */
-		U32x2 m_padding;
+		U32x2 m_padding0;
+
+		//---------------------------------------------------------------------
+		// Member Variables: Voxelization (Clipmap)
+		//---------------------------------------------------------------------
+
+		/**
+		 The offset of the voxel grid in the (toroidally addressed) voxel 
+		 texture expressed in voxels of this world buffer.
+		 */
+		U32x3 m_voxel_texture_offset;
+
+		/**
+		 The padding of this world buffer.
+		 */
+		U32 m_padding1;
 	};
 
-	static_assert(80 == sizeof(WorldBuffer), "CPU/GPU struct mismatch");
+	static_assert(96 == sizeof(WorldBuffer), "CPU/GPU struct mismatch");
 }
\ No newline at end of file
@@ -0,0 +1,1287 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\command\command_recorder.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	namespace {
+
+		/**
+		 The interface identifier of command recorders.
+		 */
+		constexpr GUID g_command_recorder_iid = {
+			0x6d4a5c2e, 0x1f3b, 0x4e8a,
+			{ 0x9c, 0x7d, 0x2b, 0x5e, 0x8f, 0x41, 0xa3, 0x06 }
+		};
+
+		/**
+		 Converts the given array of device objects to an array of handles.
+
+		 @tparam		T
+						The device object type.
+		 @param[in]		objects
+						A pointer to the array of device objects.
+		 @return		A pointer to the array of handles.
+		 */
+		template< typename T >
+		[[nodiscard]]
+		inline const CommandHandle* Convert(T* const* objects) noexcept {
+			return reinterpret_cast< const CommandHandle* >(objects);
+		}
+
+		/**
+		 Returns the size of the data of an update of the given subresource.
+
+		 @param[in]		resource
+						A reference to the resource.
+		 @param[in]		subresource
+						The index of the subresource.
+		 @param[in]		box
+						A pointer to the box of the subresource to update
+						(or @c nullptr to update the complete subresource).
+		 @param[in]		row_pitch
+						The size (in bytes) of one row of the data.
+		 @param[in]		depth_pitch
+						The size (in bytes) of one depth slice of the data.
+		 @return		The size (in bytes) of the data of an update of the
+						given subresource.
+		 @return		Zero if the given resource is not a buffer, an
+						uncompressed 2D texture or an uncompressed 3D
+						texture.
+		 */
+		[[nodiscard]]
+		U32 GetUpdateSize(ID3D11Resource& resource, U32 subresource,
+						  const D3D11_BOX* box,
+						  U32 row_pitch, U32 depth_pitch) noexcept {
+
+			D3D11_RESOURCE_DIMENSION dimension;
+			resource.GetType(&dimension);
+
+			switch (dimension) {
+
+			case D3D11_RESOURCE_DIMENSION_BUFFER: {
+				D3D11_BUFFER_DESC desc;
+				static_cast< ID3D11Buffer& >(resource).GetDesc(&desc);
+				return box ? box->right - box->left : desc.ByteWidth;
+			}
+			case D3D11_RESOURCE_DIMENSION_TEXTURE2D: {
+				D3D11_TEXTURE2D_DESC desc;
+				static_cast< ID3D11Texture2D& >(resource).GetDesc(&desc);
+				const auto mip    = subresource % desc.MipLevels;
+				const auto height = box ? box->bottom - box->top
+					                    : std::max(desc.Height >> mip, 1u);
+				return row_pitch * height;
+			}
+			case D3D11_RESOURCE_DIMENSION_TEXTURE3D: {
+				D3D11_TEXTURE3D_DESC desc;
+				static_cast< ID3D11Texture3D& >(resource).GetDesc(&desc);
+				const auto mip    = subresource % desc.MipLevels;
+				const auto height = box ? box->bottom - box->top
+					                    : std::max(desc.Height >> mip, 1u);
+				const auto depth  = box ? box->back - box->front
+					                    : std::max(desc.Depth >> mip, 1u);
+				return depth_pitch * (depth - 1u) + row_pitch * height;
+			}
+			default: {
+				return 0u;
+			}
+			}
+		}
+	}
+
+	[[nodiscard]]
+	CommandRecorder* CommandRecorder::Get(
+		ID3D11DeviceContext& device_context) noexcept {
+
+		void* recorder = nullptr;
+		if (FAILED(device_context.QueryInterface(g_command_recorder_iid,
+												 &recorder))) {
+			return nullptr;
+		}
+
+		device_context.Release();
+		return static_cast< CommandRecorder* >(recorder);
+	}
+
+	CommandRecorder::CommandRecorder(ID3D11Device& device,
+									 CommandStream& stream)
+		: ID3D11DeviceContext(),
+		m_device(device),
+		m_stream(stream),
+		m_nb_references(1u),
+		m_mapped_buffer(nullptr),
+		m_mapped_data(nullptr),
+		m_mapped_size(0u),
+		m_mapped_type(D3D11_MAP_WRITE_DISCARD),
+		m_mapped_copy(),
+		m_copies() {}
+
+	CommandRecorder::~CommandRecorder() = default;
+
+	void CommandRecorder::BindShader(CommandStage stage, IUnknown* shader,
+									 [[maybe_unused]] UINT nb_class_instances) {
+		// Class instances are not supported.
+		Assert(0u == nb_class_instances);
+		m_stream.get().BindShader(stage, shader);
+	}
+
+	[[nodiscard]]
+	CommandRecorder::BufferCopy* CommandRecorder
+		::GetCopy(ID3D11Resource& buffer) noexcept {
+
+		for (auto& copy : m_copies) {
+			if (&buffer == copy.m_buffer.Get()) {
+				return &copy;
+			}
+		}
+
+		return nullptr;
+	}
+
+	//-------------------------------------------------------------------------
+	// IUnknown
+	//-------------------------------------------------------------------------
+
+	HRESULT STDMETHODCALLTYPE CommandRecorder::QueryInterface(
+		REFIID riid, void** ppvObject) {
+
+		if (nullptr == ppvObject) {
+			return E_POINTER;
+		}
+
+		if (__uuidof(IUnknown) == riid
+			|| __uuidof(ID3D11DeviceChild) == riid
+			|| __uuidof(ID3D11DeviceContext) == riid
+			|| g_command_recorder_iid == riid) {
+
+			*ppvObject = static_cast< ID3D11DeviceContext* >(this);
+			AddRef();
+			return S_OK;
+		}
+
+		*ppvObject = nullptr;
+		return E_NOINTERFACE;
+	}
+
+	ULONG STDMETHODCALLTYPE CommandRecorder::AddRef() {
+		return ++m_nb_references;
+	}
+
+	ULONG STDMETHODCALLTYPE CommandRecorder::Release() {
+		return --m_nb_references;
+	}
+
+	//-------------------------------------------------------------------------
+	// ID3D11DeviceChild
+	//-------------------------------------------------------------------------
+
+	void STDMETHODCALLTYPE CommandRecorder::GetDevice(ID3D11Device** ppDevice) {
+		*ppDevice = &m_device.get();
+		(*ppDevice)->AddRef();
+	}
+
+	HRESULT STDMETHODCALLTYPE CommandRecorder::GetPrivateData(
+		[[maybe_unused]] REFGUID guid,
+		[[maybe_unused]] UINT* pDataSize,
+		[[maybe_unused]] void* pData) {
+
+		return DXGI_ERROR_NOT_FOUND;
+	}
+
+	HRESULT STDMETHODCALLTYPE CommandRecorder::SetPrivateData(
+		[[maybe_unused]] REFGUID guid,
+		[[maybe_unused]] UINT DataSize,
+		[[maybe_unused]] const void* pData) {
+
+		return E_NOTIMPL;
+	}
+
+	HRESULT STDMETHODCALLTYPE CommandRecorder::SetPrivateDataInterface(
+		[[maybe_unused]] REFGUID guid, [[maybe_unused]] const IUnknown* pData) {
+
+		return E_NOTIMPL;
+	}
+
+	//-------------------------------------------------------------------------
+	// ID3D11DeviceContext: Input Assembler
+	//-------------------------------------------------------------------------
+
+	void STDMETHODCALLTYPE CommandRecorder::IASetInputLayout(
+		ID3D11InputLayout* pInputLayout) {
+
+		m_stream.get().BindInputLayout(pInputLayout);
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::IASetVertexBuffers(
+		UINT StartSlot, UINT NumBuffers,
+		ID3D11Buffer* const* ppVertexBuffers,
+		const UINT* pStrides, const UINT* pOffsets) {
+
+		m_stream.get().BindVertexBuffers(StartSlot, NumBuffers,
+										 Convert(ppVertexBuffers),
+										 pStrides, pOffsets);
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::IASetIndexBuffer(
+		ID3D11Buffer* pIndexBuffer, DXGI_FORMAT Format, UINT Offset) {
+
+		m_stream.get().BindIndexBuffer(pIndexBuffer,
+									   static_cast< U32 >(Format), Offset);
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::IASetPrimitiveTopology(
+		D3D11_PRIMITIVE_TOPOLOGY Topology) {
+
+		m_stream.get().BindPrimitiveTopology(static_cast< U32 >(Topology));
+	}
+
+	//-------------------------------------------------------------------------
+	// ID3D11DeviceContext: Shader Stages
+	//-------------------------------------------------------------------------
+
+	void STDMETHODCALLTYPE CommandRecorder::VSSetShader(
+		ID3D11VertexShader* pVertexShader,
+		[[maybe_unused]] ID3D11ClassInstance* const* ppClassInstances,
+		UINT NumClassInstances) {
+
+		BindShader(CommandStage::VS, pVertexShader, NumClassInstances);
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::HSSetShader(
+		ID3D11HullShader* pHullShader,
+		[[maybe_unused]] ID3D11ClassInstance* const* ppClassInstances,
+		UINT NumClassInstances) {
+
+		BindShader(CommandStage::HS, pHullShader, NumClassInstances);
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::DSSetShader(
+		ID3D11DomainShader* pDomainShader,
+		[[maybe_unused]] ID3D11ClassInstance* const* ppClassInstances,
+		UINT NumClassInstances) {
+
+		BindShader(CommandStage::DS, pDomainShader, NumClassInstances);
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::GSSetShader(
+		ID3D11GeometryShader* pShader,
+		[[maybe_unused]] ID3D11ClassInstance* const* ppClassInstances,
+		UINT NumClassInstances) {
+
+		BindShader(CommandStage::GS, pShader, NumClassInstances);
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::PSSetShader(
+		ID3D11PixelShader* pPixelShader,
+		[[maybe_unused]] ID3D11ClassInstance* const* ppClassInstances,
+		UINT NumClassInstances) {
+
+		BindShader(CommandStage::PS, pPixelShader, NumClassInstances);
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::CSSetShader(
+		ID3D11ComputeShader* pComputeShader,
+		[[maybe_unused]] ID3D11ClassInstance* const* ppClassInstances,
+		UINT NumClassInstances) {
+
+		BindShader(CommandStage::CS, pComputeShader, NumClassInstances);
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::VSSetConstantBuffers(
+		UINT StartSlot, UINT NumBuffers,
+		ID3D11Buffer* const* ppConstantBuffers) {
+
+		m_stream.get().BindConstantBuffers(CommandStage::VS, StartSlot,
+										   NumBuffers,
+										   Convert(ppConstantBuffers));
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::HSSetConstantBuffers(
+		UINT StartSlot, UINT NumBuffers,
+		ID3D11Buffer* const* ppConstantBuffers) {
+
+		m_stream.get().BindConstantBuffers(CommandStage::HS, StartSlot,
+										   NumBuffers,
+										   Convert(ppConstantBuffers));
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::DSSetConstantBuffers(
+		UINT StartSlot, UINT NumBuffers,
+		ID3D11Buffer* const* ppConstantBuffers) {
+
+		m_stream.get().BindConstantBuffers(CommandStage::DS, StartSlot,
+										   NumBuffers,
+										   Convert(ppConstantBuffers));
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::GSSetConstantBuffers(
+		UINT StartSlot, UINT NumBuffers,
+		ID3D11Buffer* const* ppConstantBuffers) {
+
+		m_stream.get().BindConstantBuffers(CommandStage::GS, StartSlot,
+										   NumBuffers,
+										   Convert(ppConstantBuffers));
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::PSSetConstantBuffers(
+		UINT StartSlot, UINT NumBuffers,
+		ID3D11Buffer* const* ppConstantBuffers) {
+
+		m_stream.get().BindConstantBuffers(CommandStage::PS, StartSlot,
+										   NumBuffers,
+										   Convert(ppConstantBuffers));
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::CSSetConstantBuffers(
+		UINT StartSlot, UINT NumBuffers,
+		ID3D11Buffer* const* ppConstantBuffers) {
+
+		m_stream.get().BindConstantBuffers(CommandStage::CS, StartSlot,
+										   NumBuffers,
+										   Convert(ppConstantBuffers));
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::VSSetShaderResources(
+		UINT StartSlot, UINT NumViews,
+		ID3D11ShaderResourceView* const* ppShaderResourceViews) {
+
+		m_stream.get().BindShaderResourceViews(CommandStage::VS, StartSlot,
+											   NumViews,
+											   Convert(ppShaderResourceViews));
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::HSSetShaderResources(
+		UINT StartSlot, UINT NumViews,
+		ID3D11ShaderResourceView* const* ppShaderResourceViews) {
+
+		m_stream.get().BindShaderResourceViews(CommandStage::HS, StartSlot,
+											   NumViews,
+											   Convert(ppShaderResourceViews));
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::DSSetShaderResources(
+		UINT StartSlot, UINT NumViews,
+		ID3D11ShaderResourceView* const* ppShaderResourceViews) {
+
+		m_stream.get().BindShaderResourceViews(CommandStage::DS, StartSlot,
+											   NumViews,
+											   Convert(ppShaderResourceViews));
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::GSSetShaderResources(
+		UINT StartSlot, UINT NumViews,
+		ID3D11ShaderResourceView* const* ppShaderResourceViews) {
+
+		m_stream.get().BindShaderResourceViews(CommandStage::GS, StartSlot,
+											   NumViews,
+											   Convert(ppShaderResourceViews));
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::PSSetShaderResources(
+		UINT StartSlot, UINT NumViews,
+		ID3D11ShaderResourceView* const* ppShaderResourceViews) {
+
+		m_stream.get().BindShaderResourceViews(CommandStage::PS, StartSlot,
+											   NumViews,
+											   Convert(ppShaderResourceViews));
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::CSSetShaderResources(
+		UINT StartSlot, UINT NumViews,
+		ID3D11ShaderResourceView* const* ppShaderResourceViews) {
+
+		m_stream.get().BindShaderResourceViews(CommandStage::CS, StartSlot,
+											   NumViews,
+											   Convert(ppShaderResourceViews));
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::VSSetSamplers(
+		UINT StartSlot, UINT NumSamplers,
+		ID3D11SamplerState* const* ppSamplers) {
+
+		m_stream.get().BindSamplers(CommandStage::VS, StartSlot,
+									NumSamplers, Convert(ppSamplers));
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::HSSetSamplers(
+		UINT StartSlot, UINT NumSamplers,
+		ID3D11SamplerState* const* ppSamplers) {
+
+		m_stream.get().BindSamplers(CommandStage::HS, StartSlot,
+									NumSamplers, Convert(ppSamplers));
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::DSSetSamplers(
+		UINT StartSlot, UINT NumSamplers,
+		ID3D11SamplerState* const* ppSamplers) {
+
+		m_stream.get().BindSamplers(CommandStage::DS, StartSlot,
+									NumSamplers, Convert(ppSamplers));
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::GSSetSamplers(
+		UINT StartSlot, UINT NumSamplers,
+		ID3D11SamplerState* const* ppSamplers) {
+
+		m_stream.get().BindSamplers(CommandStage::GS, StartSlot,
+									NumSamplers, Convert(ppSamplers));
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::PSSetSamplers(
+		UINT StartSlot, UINT NumSamplers,
+		ID3D11SamplerState* const* ppSamplers) {
+
+		m_stream.get().BindSamplers(CommandStage::PS, StartSlot,
+									NumSamplers, Convert(ppSamplers));
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::CSSetSamplers(
+		UINT StartSlot, UINT NumSamplers,
+		ID3D11SamplerState* const* ppSamplers) {
+
+		m_stream.get().BindSamplers(CommandStage::CS, StartSlot,
+									NumSamplers, Convert(ppSamplers));
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::CSSetUnorderedAccessViews(
+		UINT StartSlot, UINT NumUAVs,
+		ID3D11UnorderedAccessView* const* ppUnorderedAccessViews,
+		const UINT* pUAVInitialCounts) {
+
+		m_stream.get().BindUnorderedAccessViews(StartSlot, NumUAVs,
+												Convert(ppUnorderedAccessViews),
+												pUAVInitialCounts);
+	}
+
+	//-------------------------------------------------------------------------
+	// ID3D11DeviceContext: Rasterizer Stage
+	//-------------------------------------------------------------------------
+
+	void STDMETHODCALLTYPE CommandRecorder::RSSetState(
+		ID3D11RasterizerState* pRasterizerState) {
+
+		m_stream.get().BindRasterizerState(pRasterizerState);
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::RSSetViewports(
+		UINT NumViewports, const D3D11_VIEWPORT* pViewports) {
+
+		m_stream.get().BindViewports(NumViewports,
+			reinterpret_cast< const CommandViewport* >(pViewports));
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::RSSetScissorRects(
+		UINT NumRects, const D3D11_RECT* pRects) {
+
+		m_stream.get().BindScissorRectangles(NumRects,
+			reinterpret_cast< const CommandRectangle* >(pRects));
+	}
+
+	//-------------------------------------------------------------------------
+	// ID3D11DeviceContext: Output Merger Stage
+	//-------------------------------------------------------------------------
+
+	void STDMETHODCALLTYPE CommandRecorder::OMSetRenderTargets(
+		UINT NumViews,
+		ID3D11RenderTargetView* const* ppRenderTargetViews,
+		ID3D11DepthStencilView* pDepthStencilView) {
+
+		m_stream.get().BindRenderTargets(NumViews,
+										 Convert(ppRenderTargetViews),
+										 pDepthStencilView,
+										 0u,
+										 D3D11_KEEP_UNORDERED_ACCESS_VIEWS,
+										 nullptr,
+										 nullptr);
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::OMSetRenderTargetsAndUnorderedAccessViews(
+		UINT NumRTVs,
+		ID3D11RenderTargetView* const* ppRenderTargetViews,
+		ID3D11DepthStencilView* pDepthStencilView,
+		UINT UAVStartSlot, UINT NumUAVs,
+		ID3D11UnorderedAccessView* const* ppUnorderedAccessViews,
+		const UINT* pUAVInitialCounts) {
+
+		// The arrays are ignored if the bound views must be kept.
+		const auto keep_rtvs = (D3D11_KEEP_RENDER_TARGETS_AND_DEPTH_STENCIL == NumRTVs);
+		const auto keep_uavs = (D3D11_KEEP_UNORDERED_ACCESS_VIEWS == NumUAVs);
+
+		m_stream.get().BindRenderTargets(
+			NumRTVs,
+			keep_rtvs ? nullptr : Convert(ppRenderTargetViews),
+			keep_rtvs ? nullptr : pDepthStencilView,
+			UAVStartSlot,
+			NumUAVs,
+			keep_uavs ? nullptr : Convert(ppUnorderedAccessViews),
+			keep_uavs ? nullptr : pUAVInitialCounts);
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::OMSetBlendState(
+		ID3D11BlendState* pBlendState, const FLOAT BlendFactor[4],
+		UINT SampleMask) {
+
+		m_stream.get().BindBlendState(pBlendState, BlendFactor, SampleMask);
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::OMSetDepthStencilState(
+		ID3D11DepthStencilState* pDepthStencilState, UINT StencilRef) {
+
+		m_stream.get().BindDepthStencilState(pDepthStencilState, StencilRef);
+	}
+
+	//-------------------------------------------------------------------------
+	// ID3D11DeviceContext: Resources
+	//-------------------------------------------------------------------------
+
+	HRESULT STDMETHODCALLTYPE CommandRecorder::Map(
+		ID3D11Resource* pResource, [[maybe_unused]] UINT Subresource,
+		D3D11_MAP MapType, [[maybe_unused]] UINT MapFlags,
+		D3D11_MAPPED_SUBRESOURCE* pMappedResource) {
+
+		Assert(nullptr == m_mapped_buffer);
+
+		D3D11_RESOURCE_DIMENSION dimension;
+		pResource->GetType(&dimension);
+
+		// Only buffers can be mapped for writing.
+		if (D3D11_RESOURCE_DIMENSION_BUFFER != dimension
+			|| (D3D11_MAP_WRITE_DISCARD != MapType
+				&& D3D11_MAP_WRITE_NO_OVERWRITE != MapType)) {
+
+			Assert(false);
+			return E_INVALIDARG;
+		}
+
+		D3D11_BUFFER_DESC desc;
+		static_cast< ID3D11Buffer* >(pResource)->GetDesc(&desc);
+
+		m_mapped_buffer = pResource;
+		m_mapped_size   = desc.ByteWidth;
+		m_mapped_type   = MapType;
+
+		if (D3D11_MAP_WRITE_DISCARD == MapType) {
+			// The previous data is discarded: write to the command stream.
+			m_mapped_data = static_cast< U8* >(
+				m_stream.get().UpdateBuffer(pResource, 0u, m_mapped_size, false));
+		}
+		else {
+			// The previous data is preserved: write to a copy of the buffer.
+			const auto copy = GetCopy(*pResource);
+			if (copy) {
+				m_mapped_copy.assign(copy->m_data.cbegin(), copy->m_data.cend());
+			}
+			else {
+				m_mapped_copy.resize(m_mapped_size);
+			}
+
+			m_mapped_data = m_mapped_copy.data();
+		}
+
+		pMappedResource->pData      = m_mapped_data;
+		pMappedResource->RowPitch   = m_mapped_size;
+		pMappedResource->DepthPitch = m_mapped_size;
+
+		return S_OK;
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::Unmap(
+		ID3D11Resource* pResource, [[maybe_unused]] UINT Subresource) {
+
+		Assert(pResource == m_mapped_buffer);
+
+		const auto copy = GetCopy(*pResource);
+
+		if (D3D11_MAP_WRITE_DISCARD == m_mapped_type) {
+			if (copy) {
+				std::memcpy(copy->m_data.data(), m_mapped_data, m_mapped_size);
+			}
+		}
+		else if (nullptr == copy) {
+			// The data of the buffer is not known: discard the previous data
+			// (the commands recorded before still use the previous data).
+			const auto data
+				= m_stream.get().UpdateBuffer(pResource, 0u, m_mapped_size, false);
+			std::memcpy(data, m_mapped_data, m_mapped_size);
+
+			m_copies.push_back({ pResource, m_mapped_copy });
+		}
+		else {
+			// Only record the written data.
+			const auto begin = m_mapped_data;
+			const auto end   = m_mapped_data + m_mapped_size;
+			const auto first = std::mismatch(begin, end,
+											 copy->m_data.cbegin()).first;
+			if (first != end) {
+				const auto last = std::mismatch(
+					std::make_reverse_iterator(end),
+					std::make_reverse_iterator(first),
+					copy->m_data.crbegin()).first.base();
+
+				const auto offset = static_cast< U32 >(first - begin);
+				const auto size   = static_cast< U32 >(last - first);
+				const auto data
+					= m_stream.get().UpdateBuffer(pResource, offset, size, true);
+				std::memcpy(data, first, size);
+				std::memcpy(copy->m_data.data() + offset, first, size);
+			}
+		}
+
+		m_mapped_buffer = nullptr;
+		m_mapped_data   = nullptr;
+		m_mapped_size   = 0u;
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::UpdateSubresource(
+		ID3D11Resource* pDstResource, UINT DstSubresource,
+		const D3D11_BOX* pDstBox, const void* pSrcData,
+		UINT SrcRowPitch, UINT SrcDepthPitch) {
+
+		const auto size = GetUpdateSize(*pDstResource, DstSubresource,
+										 pDstBox, SrcRowPitch, SrcDepthPitch);
+		Assert(0u != size);
+
+		m_stream.get().UpdateSubresource(
+			pDstResource, DstSubresource,
+			reinterpret_cast< const CommandBox* >(pDstBox),
+			pSrcData, size, SrcRowPitch, SrcDepthPitch);
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::ClearRenderTargetView(
+		ID3D11RenderTargetView* pRenderTargetView,
+		const FLOAT ColorRGBA[4]) {
+
+		m_stream.get().ClearRenderTargetView(pRenderTargetView, ColorRGBA);
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::ClearUnorderedAccessViewUint(
+		ID3D11UnorderedAccessView* pUnorderedAccessView,
+		const UINT Values[4]) {
+
+		m_stream.get().ClearUnorderedAccessView(pUnorderedAccessView,
+												static_cast< const U32* >(Values));
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::ClearUnorderedAccessViewFloat(
+		ID3D11UnorderedAccessView* pUnorderedAccessView,
+		const FLOAT Values[4]) {
+
+		m_stream.get().ClearUnorderedAccessView(pUnorderedAccessView,
+												static_cast< const F32* >(Values));
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::ClearDepthStencilView(
+		ID3D11DepthStencilView* pDepthStencilView, UINT ClearFlags,
+		FLOAT Depth, UINT8 Stencil) {
+
+		m_stream.get().ClearDepthStencilView(pDepthStencilView, ClearFlags,
+											 Depth, Stencil);
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::GenerateMips(
+		ID3D11ShaderResourceView* pShaderResourceView) {
+
+		m_stream.get().GenerateMips(pShaderResourceView);
+	}
+
+	//-------------------------------------------------------------------------
+	// ID3D11DeviceContext: Drawing and Dispatching
+	//-------------------------------------------------------------------------
+
+	void STDMETHODCALLTYPE CommandRecorder::Draw(
+		UINT VertexCount, UINT StartVertexLocation) {
+
+		m_stream.get().Draw(VertexCount, StartVertexLocation);
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::DrawIndexed(
+		UINT IndexCount, UINT StartIndexLocation, INT BaseVertexLocation) {
+
+		m_stream.get().DrawIndexed(IndexCount, StartIndexLocation,
+								   BaseVertexLocation);
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::DrawInstanced(
+		UINT VertexCountPerInstance, UINT InstanceCount,
+		UINT StartVertexLocation, UINT StartInstanceLocation) {
+
+		m_stream.get().DrawInstanced(VertexCountPerInstance, InstanceCount,
+									 StartVertexLocation,
+									 StartInstanceLocation);
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::DrawIndexedInstanced(
+		UINT IndexCountPerInstance, UINT InstanceCount,
+		UINT StartIndexLocation, INT BaseVertexLocation,
+		UINT StartInstanceLocation) {
+
+		m_stream.get().DrawIndexedInstanced(IndexCountPerInstance,
+											InstanceCount,
+											StartIndexLocation,
+											BaseVertexLocation,
+											StartInstanceLocation);
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::DrawAuto() {
+		m_stream.get().DrawAuto();
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::DrawInstancedIndirect(
+		ID3D11Buffer* pBufferForArgs, UINT AlignedByteOffsetForArgs) {
+
+		m_stream.get().DrawInstancedIndirect(pBufferForArgs,
+											 AlignedByteOffsetForArgs);
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::DrawIndexedInstancedIndirect(
+		ID3D11Buffer* pBufferForArgs, UINT AlignedByteOffsetForArgs) {
+
+		m_stream.get().DrawIndexedInstancedIndirect(pBufferForArgs,
+													AlignedByteOffsetForArgs);
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::Dispatch(
+		UINT ThreadGroupCountX, UINT ThreadGroupCountY,
+		UINT ThreadGroupCountZ) {
+
+		m_stream.get().Dispatch(ThreadGroupCountX, ThreadGroupCountY,
+								ThreadGroupCountZ);
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::DispatchIndirect(
+		ID3D11Buffer* pBufferForArgs, UINT AlignedByteOffsetForArgs) {
+
+		m_stream.get().DispatchIndirect(pBufferForArgs,
+										AlignedByteOffsetForArgs);
+	}
+
+	//-------------------------------------------------------------------------
+	// ID3D11DeviceContext: Context
+	//-------------------------------------------------------------------------
+
+	void STDMETHODCALLTYPE CommandRecorder::Flush() {
+		// The commands are submitted when the command stream is replayed.
+	}
+
+	D3D11_DEVICE_CONTEXT_TYPE STDMETHODCALLTYPE CommandRecorder::GetType() {
+		return D3D11_DEVICE_CONTEXT_DEFERRED;
+	}
+
+	UINT STDMETHODCALLTYPE CommandRecorder::GetContextFlags() {
+		return 0u;
+	}
+
+	//-------------------------------------------------------------------------
+	// ID3D11DeviceContext: Not Supported
+	//-------------------------------------------------------------------------
+
+	void STDMETHODCALLTYPE CommandRecorder::Begin(
+		[[maybe_unused]] ID3D11Asynchronous* pAsync) {
+		Assert(false);
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::End(
+		[[maybe_unused]] ID3D11Asynchronous* pAsync) {
+		Assert(false);
+	}
+
+	HRESULT STDMETHODCALLTYPE CommandRecorder::GetData(
+		[[maybe_unused]] ID3D11Asynchronous* pAsync,
+		[[maybe_unused]] void* pData,
+		[[maybe_unused]] UINT DataSize,
+		[[maybe_unused]] UINT GetDataFlags) {
+
+		Assert(false);
+		return E_NOTIMPL;
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::SetPredication(
+		[[maybe_unused]] ID3D11Predicate* pPredicate,
+		[[maybe_unused]] BOOL PredicateValue) {
+
+		Assert(false);
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::SOSetTargets(
+		[[maybe_unused]] UINT NumBuffers,
+		[[maybe_unused]] ID3D11Buffer* const* ppSOTargets,
+		[[maybe_unused]] const UINT* pOffsets) {
+
+		Assert(false);
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::CopySubresourceRegion(
+		[[maybe_unused]] ID3D11Resource* pDstResource,
+		[[maybe_unused]] UINT DstSubresource,
+		[[maybe_unused]] UINT DstX,
+		[[maybe_unused]] UINT DstY,
+		[[maybe_unused]] UINT DstZ,
+		[[maybe_unused]] ID3D11Resource* pSrcResource,
+		[[maybe_unused]] UINT SrcSubresource,
+		[[maybe_unused]] const D3D11_BOX* pSrcBox) {
+
+		Assert(false);
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::CopyResource(
+		[[maybe_unused]] ID3D11Resource* pDstResource,
+		[[maybe_unused]] ID3D11Resource* pSrcResource) {
+
+		Assert(false);
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::CopyStructureCount(
+		[[maybe_unused]] ID3D11Buffer* pDstBuffer,
+		[[maybe_unused]] UINT DstAlignedByteOffset,
+		[[maybe_unused]] ID3D11UnorderedAccessView* pSrcView) {
+
+		Assert(false);
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::SetResourceMinLOD(
+		[[maybe_unused]] ID3D11Resource* pResource,
+		[[maybe_unused]] FLOAT MinLOD) {
+
+		Assert(false);
+	}
+
+	FLOAT STDMETHODCALLTYPE CommandRecorder::GetResourceMinLOD(
+		[[maybe_unused]] ID3D11Resource* pResource) {
+
+		Assert(false);
+		return 0.0f;
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::ResolveSubresource(
+		[[maybe_unused]] ID3D11Resource* pDstResource,
+		[[maybe_unused]] UINT DstSubresource,
+		[[maybe_unused]] ID3D11Resource* pSrcResource,
+		[[maybe_unused]] UINT SrcSubresource,
+		[[maybe_unused]] DXGI_FORMAT Format) {
+
+		Assert(false);
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::ExecuteCommandList(
+		[[maybe_unused]] ID3D11CommandList* pCommandList,
+		[[maybe_unused]] BOOL RestoreContextState) {
+
+		Assert(false);
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::VSGetConstantBuffers(
+		[[maybe_unused]] UINT StartSlot,
+		UINT NumBuffers,
+		ID3D11Buffer** ppConstantBuffers) {
+
+		Assert(false);
+		std::fill_n(ppConstantBuffers, NumBuffers, nullptr);
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::PSGetShaderResources(
+		[[maybe_unused]] UINT StartSlot, UINT NumViews,
+		ID3D11ShaderResourceView** ppShaderResourceViews) {
+
+		Assert(false);
+		std::fill_n(ppShaderResourceViews, NumViews, nullptr);
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::PSGetShader(
+		ID3D11PixelShader** ppPixelShader,
+		[[maybe_unused]] ID3D11ClassInstance** ppClassInstances,
+		UINT* pNumClassInstances) {
+
+		Assert(false);
+		*ppPixelShader = nullptr;
+		if (pNumClassInstances) {
+			*pNumClassInstances = 0u;
+		}
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::PSGetSamplers(
+		[[maybe_unused]] UINT StartSlot,
+		UINT NumSamplers,
+		ID3D11SamplerState** ppSamplers) {
+
+		Assert(false);
+		std::fill_n(ppSamplers, NumSamplers, nullptr);
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::VSGetShader(
+		ID3D11VertexShader** ppVertexShader,
+		[[maybe_unused]] ID3D11ClassInstance** ppClassInstances,
+		UINT* pNumClassInstances) {
+
+		Assert(false);
+		*ppVertexShader = nullptr;
+		if (pNumClassInstances) {
+			*pNumClassInstances = 0u;
+		}
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::PSGetConstantBuffers(
+		[[maybe_unused]] UINT StartSlot,
+		UINT NumBuffers,
+		ID3D11Buffer** ppConstantBuffers) {
+
+		Assert(false);
+		std::fill_n(ppConstantBuffers, NumBuffers, nullptr);
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::IAGetInputLayout(
+		ID3D11InputLayout** ppInputLayout) {
+
+		Assert(false);
+		*ppInputLayout = nullptr;
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::IAGetVertexBuffers(
+		[[maybe_unused]] UINT StartSlot,
+		UINT NumBuffers,
+		ID3D11Buffer** ppVertexBuffers,
+		UINT* pStrides,
+		UINT* pOffsets) {
+
+		Assert(false);
+		if (ppVertexBuffers) {
+			std::fill_n(ppVertexBuffers, NumBuffers, nullptr);
+		}
+		if (pStrides) {
+			std::fill_n(pStrides, NumBuffers, 0u);
+		}
+		if (pOffsets) {
+			std::fill_n(pOffsets, NumBuffers, 0u);
+		}
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::IAGetIndexBuffer(
+		ID3D11Buffer** pIndexBuffer, DXGI_FORMAT* Format, UINT* Offset) {
+
+		Assert(false);
+		if (pIndexBuffer) {
+			*pIndexBuffer = nullptr;
+		}
+		if (Format) {
+			*Format = DXGI_FORMAT_UNKNOWN;
+		}
+		if (Offset) {
+			*Offset = 0u;
+		}
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::GSGetConstantBuffers(
+		[[maybe_unused]] UINT StartSlot,
+		UINT NumBuffers,
+		ID3D11Buffer** ppConstantBuffers) {
+
+		Assert(false);
+		std::fill_n(ppConstantBuffers, NumBuffers, nullptr);
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::GSGetShader(
+		ID3D11GeometryShader** ppGeometryShader,
+		[[maybe_unused]] ID3D11ClassInstance** ppClassInstances,
+		UINT* pNumClassInstances) {
+
+		Assert(false);
+		*ppGeometryShader = nullptr;
+		if (pNumClassInstances) {
+			*pNumClassInstances = 0u;
+		}
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::IAGetPrimitiveTopology(
+		D3D11_PRIMITIVE_TOPOLOGY* pTopology) {
+
+		Assert(false);
+		*pTopology = D3D11_PRIMITIVE_TOPOLOGY_UNDEFINED;
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::VSGetShaderResources(
+		[[maybe_unused]] UINT StartSlot, UINT NumViews,
+		ID3D11ShaderResourceView** ppShaderResourceViews) {
+
+		Assert(false);
+		std::fill_n(ppShaderResourceViews, NumViews, nullptr);
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::VSGetSamplers(
+		[[maybe_unused]] UINT StartSlot,
+		UINT NumSamplers,
+		ID3D11SamplerState** ppSamplers) {
+
+		Assert(false);
+		std::fill_n(ppSamplers, NumSamplers, nullptr);
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::GetPredication(
+		ID3D11Predicate** ppPredicate, BOOL* pPredicateValue) {
+
+		Assert(false);
+		if (ppPredicate) {
+			*ppPredicate = nullptr;
+		}
+		if (pPredicateValue) {
+			*pPredicateValue = FALSE;
+		}
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::GSGetShaderResources(
+		[[maybe_unused]] UINT StartSlot, UINT NumViews,
+		ID3D11ShaderResourceView** ppShaderResourceViews) {
+
+		Assert(false);
+		std::fill_n(ppShaderResourceViews, NumViews, nullptr);
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::GSGetSamplers(
+		[[maybe_unused]] UINT StartSlot,
+		UINT NumSamplers,
+		ID3D11SamplerState** ppSamplers) {
+
+		Assert(false);
+		std::fill_n(ppSamplers, NumSamplers, nullptr);
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::OMGetRenderTargets(
+		UINT NumViews, ID3D11RenderTargetView** ppRenderTargetViews,
+		ID3D11DepthStencilView** ppDepthStencilView) {
+
+		Assert(false);
+		if (ppRenderTargetViews) {
+			std::fill_n(ppRenderTargetViews, NumViews, nullptr);
+		}
+		if (ppDepthStencilView) {
+			*ppDepthStencilView = nullptr;
+		}
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::OMGetRenderTargetsAndUnorderedAccessViews(
+		UINT NumRTVs,
+		ID3D11RenderTargetView** ppRenderTargetViews,
+		ID3D11DepthStencilView** ppDepthStencilView,
+		[[maybe_unused]] UINT UAVStartSlot,
+		UINT NumUAVs,
+		ID3D11UnorderedAccessView** ppUnorderedAccessViews) {
+
+		Assert(false);
+		if (ppRenderTargetViews) {
+			std::fill_n(ppRenderTargetViews, NumRTVs, nullptr);
+		}
+		if (ppDepthStencilView) {
+			*ppDepthStencilView = nullptr;
+		}
+		if (ppUnorderedAccessViews) {
+			std::fill_n(ppUnorderedAccessViews, NumUAVs, nullptr);
+		}
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::OMGetBlendState(
+		ID3D11BlendState** ppBlendState, FLOAT BlendFactor[4],
+		UINT* pSampleMask) {
+
+		Assert(false);
+		if (ppBlendState) {
+			*ppBlendState = nullptr;
+		}
+		if (BlendFactor) {
+			std::fill_n(BlendFactor, 4u, 1.0f);
+		}
+		if (pSampleMask) {
+			*pSampleMask = 0xFFFFFFFFu;
+		}
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::OMGetDepthStencilState(
+		ID3D11DepthStencilState** ppDepthStencilState, UINT* pStencilRef) {
+
+		Assert(false);
+		if (ppDepthStencilState) {
+			*ppDepthStencilState = nullptr;
+		}
+		if (pStencilRef) {
+			*pStencilRef = 0u;
+		}
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::SOGetTargets(
+		UINT NumBuffers, ID3D11Buffer** ppSOTargets) {
+
+		Assert(false);
+		std::fill_n(ppSOTargets, NumBuffers, nullptr);
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::RSGetState(
+		ID3D11RasterizerState** ppRasterizerState) {
+
+		Assert(false);
+		*ppRasterizerState = nullptr;
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::RSGetViewports(
+		UINT* pNumViewports, [[maybe_unused]] D3D11_VIEWPORT* pViewports) {
+
+		Assert(false);
+		*pNumViewports = 0u;
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::RSGetScissorRects(
+		UINT* pNumRects, [[maybe_unused]] D3D11_RECT* pRects) {
+
+		Assert(false);
+		*pNumRects = 0u;
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::HSGetShaderResources(
+		[[maybe_unused]] UINT StartSlot, UINT NumViews,
+		ID3D11ShaderResourceView** ppShaderResourceViews) {
+
+		Assert(false);
+		std::fill_n(ppShaderResourceViews, NumViews, nullptr);
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::HSGetShader(
+		ID3D11HullShader** ppHullShader,
+		[[maybe_unused]] ID3D11ClassInstance** ppClassInstances,
+		UINT* pNumClassInstances) {
+
+		Assert(false);
+		*ppHullShader = nullptr;
+		if (pNumClassInstances) {
+			*pNumClassInstances = 0u;
+		}
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::HSGetSamplers(
+		[[maybe_unused]] UINT StartSlot,
+		UINT NumSamplers,
+		ID3D11SamplerState** ppSamplers) {
+
+		Assert(false);
+		std::fill_n(ppSamplers, NumSamplers, nullptr);
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::HSGetConstantBuffers(
+		[[maybe_unused]] UINT StartSlot,
+		UINT NumBuffers,
+		ID3D11Buffer** ppConstantBuffers) {
+
+		Assert(false);
+		std::fill_n(ppConstantBuffers, NumBuffers, nullptr);
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::DSGetShaderResources(
+		[[maybe_unused]] UINT StartSlot, UINT NumViews,
+		ID3D11ShaderResourceView** ppShaderResourceViews) {
+
+		Assert(false);
+		std::fill_n(ppShaderResourceViews, NumViews, nullptr);
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::DSGetShader(
+		ID3D11DomainShader** ppDomainShader,
+		[[maybe_unused]] ID3D11ClassInstance** ppClassInstances,
+		UINT* pNumClassInstances) {
+
+		Assert(false);
+		*ppDomainShader = nullptr;
+		if (pNumClassInstances) {
+			*pNumClassInstances = 0u;
+		}
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::DSGetSamplers(
+		[[maybe_unused]] UINT StartSlot,
+		UINT NumSamplers,
+		ID3D11SamplerState** ppSamplers) {
+
+		Assert(false);
+		std::fill_n(ppSamplers, NumSamplers, nullptr);
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::DSGetConstantBuffers(
+		[[maybe_unused]] UINT StartSlot,
+		UINT NumBuffers,
+		ID3D11Buffer** ppConstantBuffers) {
+
+		Assert(false);
+		std::fill_n(ppConstantBuffers, NumBuffers, nullptr);
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::CSGetShaderResources(
+		[[maybe_unused]] UINT StartSlot, UINT NumViews,
+		ID3D11ShaderResourceView** ppShaderResourceViews) {
+
+		Assert(false);
+		std::fill_n(ppShaderResourceViews, NumViews, nullptr);
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::CSGetUnorderedAccessViews(
+		[[maybe_unused]] UINT StartSlot, UINT NumUAVs,
+		ID3D11UnorderedAccessView** ppUnorderedAccessViews) {
+
+		Assert(false);
+		std::fill_n(ppUnorderedAccessViews, NumUAVs, nullptr);
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::CSGetShader(
+		ID3D11ComputeShader** ppComputeShader,
+		[[maybe_unused]] ID3D11ClassInstance** ppClassInstances,
+		UINT* pNumClassInstances) {
+
+		Assert(false);
+		*ppComputeShader = nullptr;
+		if (pNumClassInstances) {
+			*pNumClassInstances = 0u;
+		}
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::CSGetSamplers(
+		[[maybe_unused]] UINT StartSlot,
+		UINT NumSamplers,
+		ID3D11SamplerState** ppSamplers) {
+
+		Assert(false);
+		std::fill_n(ppSamplers, NumSamplers, nullptr);
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::CSGetConstantBuffers(
+		[[maybe_unused]] UINT StartSlot,
+		UINT NumBuffers,
+		ID3D11Buffer** ppConstantBuffers) {
+
+		Assert(false);
+		std::fill_n(ppConstantBuffers, NumBuffers, nullptr);
+	}
+
+	void STDMETHODCALLTYPE CommandRecorder::ClearState() {
+		Assert(false);
+	}
+
+	HRESULT STDMETHODCALLTYPE CommandRecorder::FinishCommandList(
+		[[maybe_unused]] BOOL RestoreDeferredContextState,
+		[[maybe_unused]] ID3D11CommandList** ppCommandList) {
+
+		Assert(false);
+		return E_NOTIMPL;
+	}
+}
\ No newline at end of file
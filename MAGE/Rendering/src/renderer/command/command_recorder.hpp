@@ -0,0 +1,630 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\command\command_stream.hpp"
+#include "direct3d11.hpp"
+#include "logging\error.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <functional>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 A class of command recorders for recording the calls of a D3D11 device
+	 context to a command stream.
+
+	 A command recorder records the binds, updates, clears, draws and
+	 dispatches issued through the device context interface. Only buffers
+	 can be mapped (with @c D3D11_MAP_WRITE_DISCARD or
+	 @c D3D11_MAP_WRITE_NO_OVERWRITE): the mapped memory is located in the
+	 command stream. For buffers mapped with @c D3D11_MAP_WRITE_NO_OVERWRITE,
+	 a copy of the buffer is maintained to only record the written data.
+	 Queries, copies, stream output and the getters of the device context
+	 interface are not supported.
+
+	 The device objects referenced by the recorded commands are not retained.
+	 */
+	class CommandRecorder final : public ID3D11DeviceContext {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the command recorder of the given device context.
+
+		 @param[in]		device_context
+						A reference to the device context.
+		 @return		A pointer to the command recorder of the given device
+						context.
+		 @return		@c nullptr if the given device context is not a
+						command recorder.
+		 */
+		[[nodiscard]]
+		static CommandRecorder* Get(
+			ID3D11DeviceContext& device_context) noexcept;
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a command recorder.
+
+		 @param[in]		device
+						A reference to the device.
+		 @param[in]		stream
+						A reference to the command stream to record to.
+		 */
+		explicit CommandRecorder(ID3D11Device& device,
+								 CommandStream& stream);
+
+		/**
+		 Constructs a command recorder from the given command recorder.
+
+		 @param[in]		recorder
+						A reference to the command recorder to copy.
+		 */
+		CommandRecorder(const CommandRecorder& recorder) = delete;
+
+		/**
+		 Constructs a command recorder by moving the given command recorder.
+
+		 @param[in]		recorder
+						A reference to the command recorder to move.
+		 */
+		CommandRecorder(CommandRecorder&& recorder) = delete;
+
+		/**
+		 Destructs this command recorder.
+		 */
+		virtual ~CommandRecorder();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given command recorder to this command recorder.
+
+		 @param[in]		recorder
+						A reference to the command recorder to copy.
+		 @return		A reference to the copy of the given command recorder
+						(i.e. this command recorder).
+		 */
+		CommandRecorder& operator=(const CommandRecorder& recorder) = delete;
+
+		/**
+		 Moves the given command recorder to this command recorder.
+
+		 @param[in]		recorder
+						A reference to the command recorder to move.
+		 @return		A reference to the moved command recorder (i.e. this
+						command recorder).
+		 */
+		CommandRecorder& operator=(CommandRecorder&& recorder) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the command stream of this command recorder.
+
+		 @return		A reference to the command stream of this command
+						recorder.
+		 */
+		[[nodiscard]]
+		CommandStream& GetStream() const noexcept {
+			return m_stream;
+		}
+
+		/**
+		 Sets the command stream of this command recorder to the given
+		 command stream.
+
+		 @pre			No buffer is mapped.
+		 @param[in]		stream
+						A reference to the command stream to record to.
+		 */
+		void SetStream(CommandStream& stream) noexcept {
+			Assert(nullptr == m_mapped_buffer);
+			m_stream = stream;
+		}
+
+		/**
+		 Records a call of the given callback with the given data (e.g., to
+		 issue calls that cannot be recorded at replay time).
+
+		 @param[in]		callback
+						The callback.
+		 @param[in]		data
+						A pointer to the data of the callback.
+		 */
+		void Callback(CommandCallback callback, void* data) {
+			m_stream.get().Callback(callback, data);
+		}
+
+		//---------------------------------------------------------------------
+		// Member Methods: IUnknown
+		//---------------------------------------------------------------------
+
+		virtual HRESULT STDMETHODCALLTYPE QueryInterface(
+			REFIID riid, void** ppvObject) override;
+		virtual ULONG STDMETHODCALLTYPE AddRef() override;
+		virtual ULONG STDMETHODCALLTYPE Release() override;
+
+		//---------------------------------------------------------------------
+		// Member Methods: ID3D11DeviceChild
+		//---------------------------------------------------------------------
+
+		virtual void STDMETHODCALLTYPE GetDevice(
+			ID3D11Device** ppDevice) override;
+		virtual HRESULT STDMETHODCALLTYPE GetPrivateData(
+			REFGUID guid, UINT* pDataSize, void* pData) override;
+		virtual HRESULT STDMETHODCALLTYPE SetPrivateData(
+			REFGUID guid, UINT DataSize, const void* pData) override;
+		virtual HRESULT STDMETHODCALLTYPE SetPrivateDataInterface(
+			REFGUID guid, const IUnknown* pData) override;
+
+		//---------------------------------------------------------------------
+		// Member Methods: ID3D11DeviceContext (Recorded)
+		//---------------------------------------------------------------------
+
+		virtual void STDMETHODCALLTYPE VSSetConstantBuffers(
+			UINT StartSlot, UINT NumBuffers,
+			ID3D11Buffer* const* ppConstantBuffers) override;
+		virtual void STDMETHODCALLTYPE PSSetShaderResources(
+			UINT StartSlot, UINT NumViews,
+			ID3D11ShaderResourceView* const* ppShaderResourceViews) override;
+		virtual void STDMETHODCALLTYPE PSSetShader(
+			ID3D11PixelShader* pPixelShader,
+			ID3D11ClassInstance* const* ppClassInstances,
+			UINT NumClassInstances) override;
+		virtual void STDMETHODCALLTYPE PSSetSamplers(
+			UINT StartSlot, UINT NumSamplers,
+			ID3D11SamplerState* const* ppSamplers) override;
+		virtual void STDMETHODCALLTYPE VSSetShader(
+			ID3D11VertexShader* pVertexShader,
+			ID3D11ClassInstance* const* ppClassInstances,
+			UINT NumClassInstances) override;
+		virtual void STDMETHODCALLTYPE DrawIndexed(
+			UINT IndexCount, UINT StartIndexLocation,
+			INT BaseVertexLocation) override;
+		virtual void STDMETHODCALLTYPE Draw(
+			UINT VertexCount, UINT StartVertexLocation) override;
+		virtual HRESULT STDMETHODCALLTYPE Map(
+			ID3D11Resource* pResource, UINT Subresource,
+			D3D11_MAP MapType, UINT MapFlags,
+			D3D11_MAPPED_SUBRESOURCE* pMappedResource) override;
+		virtual void STDMETHODCALLTYPE Unmap(
+			ID3D11Resource* pResource, UINT Subresource) override;
+		virtual void STDMETHODCALLTYPE PSSetConstantBuffers(
+			UINT StartSlot, UINT NumBuffers,
+			ID3D11Buffer* const* ppConstantBuffers) override;
+		virtual void STDMETHODCALLTYPE IASetInputLayout(
+			ID3D11InputLayout* pInputLayout) override;
+		virtual void STDMETHODCALLTYPE IASetVertexBuffers(
+			UINT StartSlot, UINT NumBuffers,
+			ID3D11Buffer* const* ppVertexBuffers,
+			const UINT* pStrides, const UINT* pOffsets) override;
+		virtual void STDMETHODCALLTYPE IASetIndexBuffer(
+			ID3D11Buffer* pIndexBuffer, DXGI_FORMAT Format,
+			UINT Offset) override;
+		virtual void STDMETHODCALLTYPE DrawIndexedInstanced(
+			UINT IndexCountPerInstance, UINT InstanceCount,
+			UINT StartIndexLocation, INT BaseVertexLocation,
+			UINT StartInstanceLocation) override;
+		virtual void STDMETHODCALLTYPE DrawInstanced(
+			UINT VertexCountPerInstance, UINT InstanceCount,
+			UINT StartVertexLocation, UINT StartInstanceLocation) override;
+		virtual void STDMETHODCALLTYPE GSSetConstantBuffers(
+			UINT StartSlot, UINT NumBuffers,
+			ID3D11Buffer* const* ppConstantBuffers) override;
+		virtual void STDMETHODCALLTYPE GSSetShader(
+			ID3D11GeometryShader* pShader,
+			ID3D11ClassInstance* const* ppClassInstances,
+			UINT NumClassInstances) override;
+		virtual void STDMETHODCALLTYPE IASetPrimitiveTopology(
+			D3D11_PRIMITIVE_TOPOLOGY Topology) override;
+		virtual void STDMETHODCALLTYPE VSSetShaderResources(
+			UINT StartSlot, UINT NumViews,
+			ID3D11ShaderResourceView* const* ppShaderResourceViews) override;
+		virtual void STDMETHODCALLTYPE VSSetSamplers(
+			UINT StartSlot, UINT NumSamplers,
+			ID3D11SamplerState* const* ppSamplers) override;
+		virtual void STDMETHODCALLTYPE GSSetShaderResources(
+			UINT StartSlot, UINT NumViews,
+			ID3D11ShaderResourceView* const* ppShaderResourceViews) override;
+		virtual void STDMETHODCALLTYPE GSSetSamplers(
+			UINT StartSlot, UINT NumSamplers,
+			ID3D11SamplerState* const* ppSamplers) override;
+		virtual void STDMETHODCALLTYPE OMSetRenderTargets(
+			UINT NumViews,
+			ID3D11RenderTargetView* const* ppRenderTargetViews,
+			ID3D11DepthStencilView* pDepthStencilView) override;
+		virtual void STDMETHODCALLTYPE OMSetRenderTargetsAndUnorderedAccessViews(
+			UINT NumRTVs,
+			ID3D11RenderTargetView* const* ppRenderTargetViews,
+			ID3D11DepthStencilView* pDepthStencilView,
+			UINT UAVStartSlot, UINT NumUAVs,
+			ID3D11UnorderedAccessView* const* ppUnorderedAccessViews,
+			const UINT* pUAVInitialCounts) override;
+		virtual void STDMETHODCALLTYPE OMSetBlendState(
+			ID3D11BlendState* pBlendState, const FLOAT BlendFactor[4],
+			UINT SampleMask) override;
+		virtual void STDMETHODCALLTYPE OMSetDepthStencilState(
+			ID3D11DepthStencilState* pDepthStencilState,
+			UINT StencilRef) override;
+		virtual void STDMETHODCALLTYPE DrawAuto() override;
+		virtual void STDMETHODCALLTYPE DrawIndexedInstancedIndirect(
+			ID3D11Buffer* pBufferForArgs,
+			UINT AlignedByteOffsetForArgs) override;
+		virtual void STDMETHODCALLTYPE DrawInstancedIndirect(
+			ID3D11Buffer* pBufferForArgs,
+			UINT AlignedByteOffsetForArgs) override;
+		virtual void STDMETHODCALLTYPE Dispatch(
+			UINT ThreadGroupCountX, UINT ThreadGroupCountY,
+			UINT ThreadGroupCountZ) override;
+		virtual void STDMETHODCALLTYPE DispatchIndirect(
+			ID3D11Buffer* pBufferForArgs,
+			UINT AlignedByteOffsetForArgs) override;
+		virtual void STDMETHODCALLTYPE RSSetState(
+			ID3D11RasterizerState* pRasterizerState) override;
+		virtual void STDMETHODCALLTYPE RSSetViewports(
+			UINT NumViewports, const D3D11_VIEWPORT* pViewports) override;
+		virtual void STDMETHODCALLTYPE RSSetScissorRects(
+			UINT NumRects, const D3D11_RECT* pRects) override;
+		virtual void STDMETHODCALLTYPE UpdateSubresource(
+			ID3D11Resource* pDstResource, UINT DstSubresource,
+			const D3D11_BOX* pDstBox, const void* pSrcData,
+			UINT SrcRowPitch, UINT SrcDepthPitch) override;
+		virtual void STDMETHODCALLTYPE ClearRenderTargetView(
+			ID3D11RenderTargetView* pRenderTargetView,
+			const FLOAT ColorRGBA[4]) override;
+		virtual void STDMETHODCALLTYPE ClearUnorderedAccessViewUint(
+			ID3D11UnorderedAccessView* pUnorderedAccessView,
+			const UINT Values[4]) override;
+		virtual void STDMETHODCALLTYPE ClearUnorderedAccessViewFloat(
+			ID3D11UnorderedAccessView* pUnorderedAccessView,
+			const FLOAT Values[4]) override;
+		virtual void STDMETHODCALLTYPE ClearDepthStencilView(
+			ID3D11DepthStencilView* pDepthStencilView, UINT ClearFlags,
+			FLOAT Depth, UINT8 Stencil) override;
+		virtual void STDMETHODCALLTYPE GenerateMips(
+			ID3D11ShaderResourceView* pShaderResourceView) override;
+		virtual void STDMETHODCALLTYPE HSSetShaderResources(
+			UINT StartSlot, UINT NumViews,
+			ID3D11ShaderResourceView* const* ppShaderResourceViews) override;
+		virtual void STDMETHODCALLTYPE HSSetShader(
+			ID3D11HullShader* pHullShader,
+			ID3D11ClassInstance* const* ppClassInstances,
+			UINT NumClassInstances) override;
+		virtual void STDMETHODCALLTYPE HSSetSamplers(
+			UINT StartSlot, UINT NumSamplers,
+			ID3D11SamplerState* const* ppSamplers) override;
+		virtual void STDMETHODCALLTYPE HSSetConstantBuffers(
+			UINT StartSlot, UINT NumBuffers,
+			ID3D11Buffer* const* ppConstantBuffers) override;
+		virtual void STDMETHODCALLTYPE DSSetShaderResources(
+			UINT StartSlot, UINT NumViews,
+			ID3D11ShaderResourceView* const* ppShaderResourceViews) override;
+		virtual void STDMETHODCALLTYPE DSSetShader(
+			ID3D11DomainShader* pDomainShader,
+			ID3D11ClassInstance* const* ppClassInstances,
+			UINT NumClassInstances) override;
+		virtual void STDMETHODCALLTYPE DSSetSamplers(
+			UINT StartSlot, UINT NumSamplers,
+			ID3D11SamplerState* const* ppSamplers) override;
+		virtual void STDMETHODCALLTYPE DSSetConstantBuffers(
+			UINT StartSlot, UINT NumBuffers,
+			ID3D11Buffer* const* ppConstantBuffers) override;
+		virtual void STDMETHODCALLTYPE CSSetShaderResources(
+			UINT StartSlot, UINT NumViews,
+			ID3D11ShaderResourceView* const* ppShaderResourceViews) override;
+		virtual void STDMETHODCALLTYPE CSSetUnorderedAccessViews(
+			UINT StartSlot, UINT NumUAVs,
+			ID3D11UnorderedAccessView* const* ppUnorderedAccessViews,
+			const UINT* pUAVInitialCounts) override;
+		virtual void STDMETHODCALLTYPE CSSetShader(
+			ID3D11ComputeShader* pComputeShader,
+			ID3D11ClassInstance* const* ppClassInstances,
+			UINT NumClassInstances) override;
+		virtual void STDMETHODCALLTYPE CSSetSamplers(
+			UINT StartSlot, UINT NumSamplers,
+			ID3D11SamplerState* const* ppSamplers) override;
+		virtual void STDMETHODCALLTYPE CSSetConstantBuffers(
+			UINT StartSlot, UINT NumBuffers,
+			ID3D11Buffer* const* ppConstantBuffers) override;
+		virtual void STDMETHODCALLTYPE Flush() override;
+		virtual D3D11_DEVICE_CONTEXT_TYPE STDMETHODCALLTYPE GetType() override;
+		virtual UINT STDMETHODCALLTYPE GetContextFlags() override;
+
+		//---------------------------------------------------------------------
+		// Member Methods: ID3D11DeviceContext (Not Supported)
+		//---------------------------------------------------------------------
+
+		virtual void STDMETHODCALLTYPE Begin(
+			ID3D11Asynchronous* pAsync) override;
+		virtual void STDMETHODCALLTYPE End(
+			ID3D11Asynchronous* pAsync) override;
+		virtual HRESULT STDMETHODCALLTYPE GetData(
+			ID3D11Asynchronous* pAsync, void* pData,
+			UINT DataSize, UINT GetDataFlags) override;
+		virtual void STDMETHODCALLTYPE SetPredication(
+			ID3D11Predicate* pPredicate, BOOL PredicateValue) override;
+		virtual void STDMETHODCALLTYPE SOSetTargets(
+			UINT NumBuffers, ID3D11Buffer* const* ppSOTargets,
+			const UINT* pOffsets) override;
+		virtual void STDMETHODCALLTYPE CopySubresourceRegion(
+			ID3D11Resource* pDstResource, UINT DstSubresource,
+			UINT DstX, UINT DstY, UINT DstZ,
+			ID3D11Resource* pSrcResource, UINT SrcSubresource,
+			const D3D11_BOX* pSrcBox) override;
+		virtual void STDMETHODCALLTYPE CopyResource(
+			ID3D11Resource* pDstResource,
+			ID3D11Resource* pSrcResource) override;
+		virtual void STDMETHODCALLTYPE CopyStructureCount(
+			ID3D11Buffer* pDstBuffer, UINT DstAlignedByteOffset,
+			ID3D11UnorderedAccessView* pSrcView) override;
+		virtual void STDMETHODCALLTYPE SetResourceMinLOD(
+			ID3D11Resource* pResource, FLOAT MinLOD) override;
+		virtual FLOAT STDMETHODCALLTYPE GetResourceMinLOD(
+			ID3D11Resource* pResource) override;
+		virtual void STDMETHODCALLTYPE ResolveSubresource(
+			ID3D11Resource* pDstResource, UINT DstSubresource,
+			ID3D11Resource* pSrcResource, UINT SrcSubresource,
+			DXGI_FORMAT Format) override;
+		virtual void STDMETHODCALLTYPE ExecuteCommandList(
+			ID3D11CommandList* pCommandList,
+			BOOL RestoreContextState) override;
+		virtual void STDMETHODCALLTYPE VSGetConstantBuffers(
+			UINT StartSlot, UINT NumBuffers,
+			ID3D11Buffer** ppConstantBuffers) override;
+		virtual void STDMETHODCALLTYPE PSGetShaderResources(
+			UINT StartSlot, UINT NumViews,
+			ID3D11ShaderResourceView** ppShaderResourceViews) override;
+		virtual void STDMETHODCALLTYPE PSGetShader(
+			ID3D11PixelShader** ppPixelShader,
+			ID3D11ClassInstance** ppClassInstances,
+			UINT* pNumClassInstances) override;
+		virtual void STDMETHODCALLTYPE PSGetSamplers(
+			UINT StartSlot, UINT NumSamplers,
+			ID3D11SamplerState** ppSamplers) override;
+		virtual void STDMETHODCALLTYPE VSGetShader(
+			ID3D11VertexShader** ppVertexShader,
+			ID3D11ClassInstance** ppClassInstances,
+			UINT* pNumClassInstances) override;
+		virtual void STDMETHODCALLTYPE PSGetConstantBuffers(
+			UINT StartSlot, UINT NumBuffers,
+			ID3D11Buffer** ppConstantBuffers) override;
+		virtual void STDMETHODCALLTYPE IAGetInputLayout(
+			ID3D11InputLayout** ppInputLayout) override;
+		virtual void STDMETHODCALLTYPE IAGetVertexBuffers(
+			UINT StartSlot, UINT NumBuffers,
+			ID3D11Buffer** ppVertexBuffers,
+			UINT* pStrides, UINT* pOffsets) override;
+		virtual void STDMETHODCALLTYPE IAGetIndexBuffer(
+			ID3D11Buffer** pIndexBuffer, DXGI_FORMAT* Format,
+			UINT* Offset) override;
+		virtual void STDMETHODCALLTYPE GSGetConstantBuffers(
+			UINT StartSlot, UINT NumBuffers,
+			ID3D11Buffer** ppConstantBuffers) override;
+		virtual void STDMETHODCALLTYPE GSGetShader(
+			ID3D11GeometryShader** ppGeometryShader,
+			ID3D11ClassInstance** ppClassInstances,
+			UINT* pNumClassInstances) override;
+		virtual void STDMETHODCALLTYPE IAGetPrimitiveTopology(
+			D3D11_PRIMITIVE_TOPOLOGY* pTopology) override;
+		virtual void STDMETHODCALLTYPE VSGetShaderResources(
+			UINT StartSlot, UINT NumViews,
+			ID3D11ShaderResourceView** ppShaderResourceViews) override;
+		virtual void STDMETHODCALLTYPE VSGetSamplers(
+			UINT StartSlot, UINT NumSamplers,
+			ID3D11SamplerState** ppSamplers) override;
+		virtual void STDMETHODCALLTYPE GetPredication(
+			ID3D11Predicate** ppPredicate, BOOL* pPredicateValue) override;
+		virtual void STDMETHODCALLTYPE GSGetShaderResources(
+			UINT StartSlot, UINT NumViews,
+			ID3D11ShaderResourceView** ppShaderResourceViews) override;
+		virtual void STDMETHODCALLTYPE GSGetSamplers(
+			UINT StartSlot, UINT NumSamplers,
+			ID3D11SamplerState** ppSamplers) override;
+		virtual void STDMETHODCALLTYPE OMGetRenderTargets(
+			UINT NumViews,
+			ID3D11RenderTargetView** ppRenderTargetViews,
+			ID3D11DepthStencilView** ppDepthStencilView) override;
+		virtual void STDMETHODCALLTYPE OMGetRenderTargetsAndUnorderedAccessViews(
+			UINT NumRTVs,
+			ID3D11RenderTargetView** ppRenderTargetViews,
+			ID3D11DepthStencilView** ppDepthStencilView,
+			UINT UAVStartSlot, UINT NumUAVs,
+			ID3D11UnorderedAccessView** ppUnorderedAccessViews) override;
+		virtual void STDMETHODCALLTYPE OMGetBlendState(
+			ID3D11BlendState** ppBlendState, FLOAT BlendFactor[4],
+			UINT* pSampleMask) override;
+		virtual void STDMETHODCALLTYPE OMGetDepthStencilState(
+			ID3D11DepthStencilState** ppDepthStencilState,
+			UINT* pStencilRef) override;
+		virtual void STDMETHODCALLTYPE SOGetTargets(
+			UINT NumBuffers, ID3D11Buffer** ppSOTargets) override;
+		virtual void STDMETHODCALLTYPE RSGetState(
+			ID3D11RasterizerState** ppRasterizerState) override;
+		virtual void STDMETHODCALLTYPE RSGetViewports(
+			UINT* pNumViewports, D3D11_VIEWPORT* pViewports) override;
+		virtual void STDMETHODCALLTYPE RSGetScissorRects(
+			UINT* pNumRects, D3D11_RECT* pRects) override;
+		virtual void STDMETHODCALLTYPE HSGetShaderResources(
+			UINT StartSlot, UINT NumViews,
+			ID3D11ShaderResourceView** ppShaderResourceViews) override;
+		virtual void STDMETHODCALLTYPE HSGetShader(
+			ID3D11HullShader** ppHullShader,
+			ID3D11ClassInstance** ppClassInstances,
+			UINT* pNumClassInstances) override;
+		virtual void STDMETHODCALLTYPE HSGetSamplers(
+			UINT StartSlot, UINT NumSamplers,
+			ID3D11SamplerState** ppSamplers) override;
+		virtual void STDMETHODCALLTYPE HSGetConstantBuffers(
+			UINT StartSlot, UINT NumBuffers,
+			ID3D11Buffer** ppConstantBuffers) override;
+		virtual void STDMETHODCALLTYPE DSGetShaderResources(
+			UINT StartSlot, UINT NumViews,
+			ID3D11ShaderResourceView** ppShaderResourceViews) override;
+		virtual void STDMETHODCALLTYPE DSGetShader(
+			ID3D11DomainShader** ppDomainShader,
+			ID3D11ClassInstance** ppClassInstances,
+			UINT* pNumClassInstances) override;
+		virtual void STDMETHODCALLTYPE DSGetSamplers(
+			UINT StartSlot, UINT NumSamplers,
+			ID3D11SamplerState** ppSamplers) override;
+		virtual void STDMETHODCALLTYPE DSGetConstantBuffers(
+			UINT StartSlot, UINT NumBuffers,
+			ID3D11Buffer** ppConstantBuffers) override;
+		virtual void STDMETHODCALLTYPE CSGetShaderResources(
+			UINT StartSlot, UINT NumViews,
+			ID3D11ShaderResourceView** ppShaderResourceViews) override;
+		virtual void STDMETHODCALLTYPE CSGetUnorderedAccessViews(
+			UINT StartSlot, UINT NumUAVs,
+			ID3D11UnorderedAccessView** ppUnorderedAccessViews) override;
+		virtual void STDMETHODCALLTYPE CSGetShader(
+			ID3D11ComputeShader** ppComputeShader,
+			ID3D11ClassInstance** ppClassInstances,
+			UINT* pNumClassInstances) override;
+		virtual void STDMETHODCALLTYPE CSGetSamplers(
+			UINT StartSlot, UINT NumSamplers,
+			ID3D11SamplerState** ppSamplers) override;
+		virtual void STDMETHODCALLTYPE CSGetConstantBuffers(
+			UINT StartSlot, UINT NumBuffers,
+			ID3D11Buffer** ppConstantBuffers) override;
+		virtual void STDMETHODCALLTYPE ClearState() override;
+		virtual HRESULT STDMETHODCALLTYPE FinishCommandList(
+			BOOL RestoreDeferredContextState,
+			ID3D11CommandList** ppCommandList) override;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 A struct of copies of buffers mapped with
+		 @c D3D11_MAP_WRITE_NO_OVERWRITE.
+		 */
+		struct BufferCopy final {
+
+		public:
+
+			/**
+			 A pointer to the buffer of this buffer copy. The buffer is
+			 retained to keep this buffer copy unambiguous.
+			 */
+			ComPtr< ID3D11Resource > m_buffer;
+
+			/**
+			 The data of this buffer copy.
+			 */
+			std::vector< U8 > m_data;
+		};
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Records the binding of the given shader.
+
+		 @pre			@a nb_class_instances is equal to zero.
+		 @param[in]		stage
+						The shader stage.
+		 @param[in]		shader
+						A pointer to the shader.
+		 @param[in]		nb_class_instances
+						The number of class instances.
+		 */
+		void BindShader(CommandStage stage, IUnknown* shader,
+						UINT nb_class_instances);
+
+		/**
+		 Returns the copy of the given buffer.
+
+		 @param[in]		buffer
+						A reference to the buffer.
+		 @return		A pointer to the copy of the given buffer.
+		 @return		@c nullptr if the given buffer has no copy.
+		 */
+		[[nodiscard]]
+		BufferCopy* GetCopy(ID3D11Resource& buffer) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A reference to the device of this command recorder.
+		 */
+		std::reference_wrapper< ID3D11Device > m_device;
+
+		/**
+		 A reference to the command stream of this command recorder.
+		 */
+		std::reference_wrapper< CommandStream > m_stream;
+
+		/**
+		 The reference count of this command recorder. The lifetime of this
+		 command recorder is not controlled by its reference count.
+		 */
+		ULONG m_nb_references;
+
+		/**
+		 A pointer to the mapped buffer of this command recorder.
+		 */
+		ID3D11Resource* m_mapped_buffer;
+
+		/**
+		 A pointer to the mapped memory of this command recorder.
+		 */
+		U8* m_mapped_data;
+
+		/**
+		 The size (in bytes) of the mapped buffer of this command recorder.
+		 */
+		U32 m_mapped_size;
+
+		/**
+		 The map type of the mapped buffer of this command recorder.
+		 */
+		D3D11_MAP m_mapped_type;
+
+		/**
+		 The mapped memory of this command recorder for buffers mapped with
+		 @c D3D11_MAP_WRITE_NO_OVERWRITE.
+		 */
+		std::vector< U8 > m_mapped_copy;
+
+		/**
+		 The copies of the buffers mapped with @c D3D11_MAP_WRITE_NO_OVERWRITE
+		 of this command recorder.
+		 */
+		std::vector< BufferCopy > m_copies;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,415 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\command\command_replayer.hpp"
+#include "exception\exception.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <cstddef>
+#include <cstring>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	// The viewports, rectangles and boxes of commands are replayed as is.
+	static_assert(sizeof(CommandViewport) == sizeof(D3D11_VIEWPORT));
+	static_assert(offsetof(CommandViewport, m_max_depth)
+				  == offsetof(D3D11_VIEWPORT, MaxDepth));
+	static_assert(sizeof(CommandRectangle) == sizeof(D3D11_RECT));
+	static_assert(offsetof(CommandRectangle, m_bottom)
+				  == offsetof(D3D11_RECT, bottom));
+	static_assert(sizeof(CommandBox) == sizeof(D3D11_BOX));
+	static_assert(offsetof(CommandBox, m_back) == offsetof(D3D11_BOX, back));
+
+	namespace {
+
+		/**
+		 Converts the given array of handles to an array of device objects.
+
+		 @tparam		T
+						The device object type.
+		 @param[in]		handles
+						A pointer to the array of handles.
+		 @return		A pointer to the array of device objects.
+		 */
+		template< typename T >
+		[[nodiscard]]
+		inline T* const* Convert(const CommandHandle* handles) noexcept {
+			return reinterpret_cast< T* const* >(handles);
+		}
+	}
+
+	CommandReplayer::CommandReplayer(ID3D11DeviceContext& device_context) noexcept
+		: m_device_context(device_context) {}
+
+	CommandReplayer::CommandReplayer(
+		const CommandReplayer& replayer) noexcept = default;
+
+	CommandReplayer::CommandReplayer(
+		CommandReplayer&& replayer) noexcept = default;
+
+	CommandReplayer::~CommandReplayer() = default;
+
+	CommandReplayer& CommandReplayer
+		::operator=(const CommandReplayer& replayer) noexcept = default;
+
+	CommandReplayer& CommandReplayer
+		::operator=(CommandReplayer&& replayer) noexcept = default;
+
+	void CommandReplayer::BindShader(CommandStage stage,
+									 CommandHandle shader) noexcept {
+
+		auto& device_context = m_device_context.get();
+		switch (stage) {
+
+		case CommandStage::VS:
+			device_context.VSSetShader(
+				static_cast< ID3D11VertexShader* >(shader), nullptr, 0u);
+			break;
+		case CommandStage::HS:
+			device_context.HSSetShader(
+				static_cast< ID3D11HullShader* >(shader), nullptr, 0u);
+			break;
+		case CommandStage::DS:
+			device_context.DSSetShader(
+				static_cast< ID3D11DomainShader* >(shader), nullptr, 0u);
+			break;
+		case CommandStage::GS:
+			device_context.GSSetShader(
+				static_cast< ID3D11GeometryShader* >(shader), nullptr, 0u);
+			break;
+		case CommandStage::PS:
+			device_context.PSSetShader(
+				static_cast< ID3D11PixelShader* >(shader), nullptr, 0u);
+			break;
+		case CommandStage::CS:
+			device_context.CSSetShader(
+				static_cast< ID3D11ComputeShader* >(shader), nullptr, 0u);
+			break;
+		}
+	}
+
+	void CommandReplayer::BindConstantBuffers(CommandStage stage, U32 slot,
+											  U32 nb_buffers,
+											  const CommandHandle* buffers) noexcept {
+
+		auto& device_context = m_device_context.get();
+		const auto ptr = Convert< ID3D11Buffer >(buffers);
+		switch (stage) {
+
+		case CommandStage::VS:
+			device_context.VSSetConstantBuffers(slot, nb_buffers, ptr);
+			break;
+		case CommandStage::HS:
+			device_context.HSSetConstantBuffers(slot, nb_buffers, ptr);
+			break;
+		case CommandStage::DS:
+			device_context.DSSetConstantBuffers(slot, nb_buffers, ptr);
+			break;
+		case CommandStage::GS:
+			device_context.GSSetConstantBuffers(slot, nb_buffers, ptr);
+			break;
+		case CommandStage::PS:
+			device_context.PSSetConstantBuffers(slot, nb_buffers, ptr);
+			break;
+		case CommandStage::CS:
+			device_context.CSSetConstantBuffers(slot, nb_buffers, ptr);
+			break;
+		}
+	}
+
+	void CommandReplayer::BindShaderResourceViews(CommandStage stage, U32 slot,
+												  U32 nb_srvs,
+												  const CommandHandle* srvs) noexcept {
+
+		auto& device_context = m_device_context.get();
+		const auto ptr = Convert< ID3D11ShaderResourceView >(srvs);
+		switch (stage) {
+
+		case CommandStage::VS:
+			device_context.VSSetShaderResources(slot, nb_srvs, ptr);
+			break;
+		case CommandStage::HS:
+			device_context.HSSetShaderResources(slot, nb_srvs, ptr);
+			break;
+		case CommandStage::DS:
+			device_context.DSSetShaderResources(slot, nb_srvs, ptr);
+			break;
+		case CommandStage::GS:
+			device_context.GSSetShaderResources(slot, nb_srvs, ptr);
+			break;
+		case CommandStage::PS:
+			device_context.PSSetShaderResources(slot, nb_srvs, ptr);
+			break;
+		case CommandStage::CS:
+			device_context.CSSetShaderResources(slot, nb_srvs, ptr);
+			break;
+		}
+	}
+
+	void CommandReplayer::BindSamplers(CommandStage stage, U32 slot,
+									   U32 nb_samplers,
+									   const CommandHandle* samplers) noexcept {
+
+		auto& device_context = m_device_context.get();
+		const auto ptr = Convert< ID3D11SamplerState >(samplers);
+		switch (stage) {
+
+		case CommandStage::VS:
+			device_context.VSSetSamplers(slot, nb_samplers, ptr);
+			break;
+		case CommandStage::HS:
+			device_context.HSSetSamplers(slot, nb_samplers, ptr);
+			break;
+		case CommandStage::DS:
+			device_context.DSSetSamplers(slot, nb_samplers, ptr);
+			break;
+		case CommandStage::GS:
+			device_context.GSSetSamplers(slot, nb_samplers, ptr);
+			break;
+		case CommandStage::PS:
+			device_context.PSSetSamplers(slot, nb_samplers, ptr);
+			break;
+		case CommandStage::CS:
+			device_context.CSSetSamplers(slot, nb_samplers, ptr);
+			break;
+		}
+	}
+
+	void CommandReplayer::BindUnorderedAccessViews(U32 slot, U32 nb_uavs,
+												   const CommandHandle* uavs,
+												   const U32* initial_counts) noexcept {
+
+		m_device_context.get().CSSetUnorderedAccessViews(
+			slot, nb_uavs, Convert< ID3D11UnorderedAccessView >(uavs),
+			initial_counts);
+	}
+
+	void CommandReplayer::BindInputLayout(CommandHandle input_layout) noexcept {
+		m_device_context.get().IASetInputLayout(
+			static_cast< ID3D11InputLayout* >(input_layout));
+	}
+
+	void CommandReplayer::BindPrimitiveTopology(U32 topology) noexcept {
+		m_device_context.get().IASetPrimitiveTopology(
+			static_cast< D3D11_PRIMITIVE_TOPOLOGY >(topology));
+	}
+
+	void CommandReplayer::BindVertexBuffers(U32 slot, U32 nb_buffers,
+											const CommandHandle* buffers,
+											const U32* strides,
+											const U32* offsets) noexcept {
+
+		m_device_context.get().IASetVertexBuffers(
+			slot, nb_buffers, Convert< ID3D11Buffer >(buffers),
+			strides, offsets);
+	}
+
+	void CommandReplayer::BindIndexBuffer(CommandHandle buffer,
+										  U32 format, U32 offset) noexcept {
+
+		m_device_context.get().IASetIndexBuffer(
+			static_cast< ID3D11Buffer* >(buffer),
+			static_cast< DXGI_FORMAT >(format), offset);
+	}
+
+	void CommandReplayer::BindRasterizerState(CommandHandle state) noexcept {
+		m_device_context.get().RSSetState(
+			static_cast< ID3D11RasterizerState* >(state));
+	}
+
+	void CommandReplayer::BindViewports(U32 nb_viewports,
+										const CommandViewport* viewports) noexcept {
+
+		m_device_context.get().RSSetViewports(
+			nb_viewports, reinterpret_cast< const D3D11_VIEWPORT* >(viewports));
+	}
+
+	void CommandReplayer::BindScissorRectangles(U32 nb_rectangles,
+												const CommandRectangle* rectangles) noexcept {
+
+		m_device_context.get().RSSetScissorRects(
+			nb_rectangles, reinterpret_cast< const D3D11_RECT* >(rectangles));
+	}
+
+	void CommandReplayer::BindBlendState(CommandHandle state,
+										 const F32* factor,
+										 U32 sample_mask) noexcept {
+
+		m_device_context.get().OMSetBlendState(
+			static_cast< ID3D11BlendState* >(state), factor, sample_mask);
+	}
+
+	void CommandReplayer::BindDepthStencilState(CommandHandle state,
+												U32 stencil_ref) noexcept {
+
+		m_device_context.get().OMSetDepthStencilState(
+			static_cast< ID3D11DepthStencilState* >(state), stencil_ref);
+	}
+
+	void CommandReplayer::BindRenderTargets(U32 nb_rtvs,
+											const CommandHandle* rtvs,
+											CommandHandle dsv,
+											U32 slot,
+											U32 nb_uavs,
+											const CommandHandle* uavs,
+											const U32* initial_counts) noexcept {
+
+		// Plain render target bindings keep the bound UAVs.
+		if (D3D11_KEEP_UNORDERED_ACCESS_VIEWS == nb_uavs && 0u == slot) {
+			m_device_context.get().OMSetRenderTargets(
+				nb_rtvs, Convert< ID3D11RenderTargetView >(rtvs),
+				static_cast< ID3D11DepthStencilView* >(dsv));
+			return;
+		}
+
+		m_device_context.get().OMSetRenderTargetsAndUnorderedAccessViews(
+			nb_rtvs, Convert< ID3D11RenderTargetView >(rtvs),
+			static_cast< ID3D11DepthStencilView* >(dsv),
+			slot, nb_uavs, Convert< ID3D11UnorderedAccessView >(uavs),
+			initial_counts);
+	}
+
+	void CommandReplayer::UpdateBuffer(CommandHandle buffer, U32 offset,
+									   U32 size, bool no_overwrite,
+									   const void* data) {
+
+		auto& device_context = m_device_context.get();
+		const auto resource  = static_cast< ID3D11Buffer* >(buffer);
+		const auto map_type  = no_overwrite ? D3D11_MAP_WRITE_NO_OVERWRITE
+							                : D3D11_MAP_WRITE_DISCARD;
+
+		D3D11_MAPPED_SUBRESOURCE mapped_buffer;
+		{
+			const HRESULT result = device_context.Map(resource, 0u, map_type,
+													  0u, &mapped_buffer);
+			ThrowIfFailed(result, "Buffer mapping failed: %08X.", result);
+		}
+
+		std::memcpy(static_cast< U8* >(mapped_buffer.pData) + offset,
+					data, size);
+
+		device_context.Unmap(resource, 0u);
+	}
+
+	void CommandReplayer::UpdateSubresource(CommandHandle resource,
+											U32 subresource,
+											const CommandBox* box,
+											const void* data,
+											[[maybe_unused]] U32 size,
+											U32 row_pitch,
+											U32 depth_pitch) noexcept {
+
+		m_device_context.get().UpdateSubresource(
+			static_cast< ID3D11Resource* >(resource), subresource,
+			reinterpret_cast< const D3D11_BOX* >(box),
+			data, row_pitch, depth_pitch);
+	}
+
+	void CommandReplayer::ClearRenderTargetView(CommandHandle rtv,
+												const F32* rgba) noexcept {
+
+		m_device_context.get().ClearRenderTargetView(
+			static_cast< ID3D11RenderTargetView* >(rtv), rgba);
+	}
+
+	void CommandReplayer::ClearDepthStencilView(CommandHandle dsv, U32 flags,
+												F32 depth, U8 stencil) noexcept {
+
+		m_device_context.get().ClearDepthStencilView(
+			static_cast< ID3D11DepthStencilView* >(dsv), flags, depth, stencil);
+	}
+
+	void CommandReplayer::ClearUnorderedAccessView(CommandHandle uav,
+												   const U32* values) noexcept {
+
+		m_device_context.get().ClearUnorderedAccessViewUint(
+			static_cast< ID3D11UnorderedAccessView* >(uav), values);
+	}
+
+	void CommandReplayer::ClearUnorderedAccessView(CommandHandle uav,
+												   const F32* values) noexcept {
+
+		m_device_context.get().ClearUnorderedAccessViewFloat(
+			static_cast< ID3D11UnorderedAccessView* >(uav), values);
+	}
+
+	void CommandReplayer::GenerateMips(CommandHandle srv) noexcept {
+		m_device_context.get().GenerateMips(
+			static_cast< ID3D11ShaderResourceView* >(srv));
+	}
+
+	void CommandReplayer::Draw(U32 nb_vertices, U32 start_vertex) noexcept {
+		m_device_context.get().Draw(nb_vertices, start_vertex);
+	}
+
+	void CommandReplayer::DrawIndexed(U32 nb_indices, U32 start_index,
+									  S32 base_vertex) noexcept {
+
+		m_device_context.get().DrawIndexed(nb_indices, start_index,
+										   base_vertex);
+	}
+
+	void CommandReplayer::DrawInstanced(U32 nb_vertices, U32 nb_instances,
+										U32 start_vertex,
+										U32 start_instance) noexcept {
+
+		m_device_context.get().DrawInstanced(nb_vertices, nb_instances,
+											 start_vertex, start_instance);
+	}
+
+	void CommandReplayer::DrawIndexedInstanced(U32 nb_indices,
+											   U32 nb_instances,
+											   U32 start_index,
+											   S32 base_vertex,
+											   U32 start_instance) noexcept {
+
+		m_device_context.get().DrawIndexedInstanced(nb_indices, nb_instances,
+													start_index, base_vertex,
+													start_instance);
+	}
+
+	void CommandReplayer::DrawAuto() noexcept {
+		m_device_context.get().DrawAuto();
+	}
+
+	void CommandReplayer::DrawInstancedIndirect(CommandHandle buffer,
+												U32 offset) noexcept {
+
+		m_device_context.get().DrawInstancedIndirect(
+			static_cast< ID3D11Buffer* >(buffer), offset);
+	}
+
+	void CommandReplayer::DrawIndexedInstancedIndirect(CommandHandle buffer,
+													   U32 offset) noexcept {
+
+		m_device_context.get().DrawIndexedInstancedIndirect(
+			static_cast< ID3D11Buffer* >(buffer), offset);
+	}
+
+	void CommandReplayer::Dispatch(U32 nb_groups_x, U32 nb_groups_y,
+								   U32 nb_groups_z) noexcept {
+
+		m_device_context.get().Dispatch(nb_groups_x, nb_groups_y,
+										nb_groups_z);
+	}
+
+	void CommandReplayer::DispatchIndirect(CommandHandle buffer,
+										   U32 offset) noexcept {
+
+		m_device_context.get().DispatchIndirect(
+			static_cast< ID3D11Buffer* >(buffer), offset);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,240 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\command\command_stream.hpp"
+#include "direct3d11.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <functional>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 A class of command replayers for replaying command streams to a D3D11
+	 device context.
+	 */
+	class CommandReplayer final {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a command replayer.
+
+		 @param[in]		device_context
+						A reference to the device context.
+		 */
+		explicit CommandReplayer(ID3D11DeviceContext& device_context) noexcept;
+
+		/**
+		 Constructs a command replayer from the given command replayer.
+
+		 @param[in]		replayer
+						A reference to the command replayer to copy.
+		 */
+		CommandReplayer(const CommandReplayer& replayer) noexcept;
+
+		/**
+		 Constructs a command replayer by moving the given command replayer.
+
+		 @param[in]		replayer
+						A reference to the command replayer to move.
+		 */
+		CommandReplayer(CommandReplayer&& replayer) noexcept;
+
+		/**
+		 Destructs this command replayer.
+		 */
+		~CommandReplayer();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given command replayer to this command replayer.
+
+		 @param[in]		replayer
+						A reference to the command replayer to copy.
+		 @return		A reference to the copy of the given command replayer
+						(i.e. this command replayer).
+		 */
+		CommandReplayer& operator=(const CommandReplayer& replayer) noexcept;
+
+		/**
+		 Moves the given command replayer to this command replayer.
+
+		 @param[in]		replayer
+						A reference to the command replayer to move.
+		 @return		A reference to the moved command replayer (i.e. this
+						command replayer).
+		 */
+		CommandReplayer& operator=(CommandReplayer&& replayer) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Replays the given command stream.
+
+		 @param[in]		stream
+						A reference to the command stream.
+		 @throws		Exception
+						Failed to replay the given command stream.
+		 */
+		void Replay(const CommandStream& stream) {
+			stream.Replay(*this);
+		}
+
+		//---------------------------------------------------------------------
+		// Member Methods: Command Context
+		//---------------------------------------------------------------------
+
+		void BindShader(CommandStage stage, CommandHandle shader) noexcept;
+
+		void BindConstantBuffers(CommandStage stage, U32 slot,
+								 U32 nb_buffers,
+								 const CommandHandle* buffers) noexcept;
+
+		void BindShaderResourceViews(CommandStage stage, U32 slot,
+									 U32 nb_srvs,
+									 const CommandHandle* srvs) noexcept;
+
+		void BindSamplers(CommandStage stage, U32 slot,
+						  U32 nb_samplers,
+						  const CommandHandle* samplers) noexcept;
+
+		void BindUnorderedAccessViews(U32 slot, U32 nb_uavs,
+									  const CommandHandle* uavs,
+									  const U32* initial_counts) noexcept;
+
+		void BindInputLayout(CommandHandle input_layout) noexcept;
+
+		void BindPrimitiveTopology(U32 topology) noexcept;
+
+		void BindVertexBuffers(U32 slot, U32 nb_buffers,
+							   const CommandHandle* buffers,
+							   const U32* strides,
+							   const U32* offsets) noexcept;
+
+		void BindIndexBuffer(CommandHandle buffer,
+							 U32 format, U32 offset) noexcept;
+
+		void BindRasterizerState(CommandHandle state) noexcept;
+
+		void BindViewports(U32 nb_viewports,
+						   const CommandViewport* viewports) noexcept;
+
+		void BindScissorRectangles(U32 nb_rectangles,
+								   const CommandRectangle* rectangles) noexcept;
+
+		void BindBlendState(CommandHandle state,
+							const F32* factor,
+							U32 sample_mask) noexcept;
+
+		void BindDepthStencilState(CommandHandle state,
+								   U32 stencil_ref) noexcept;
+
+		void BindRenderTargets(U32 nb_rtvs,
+							   const CommandHandle* rtvs,
+							   CommandHandle dsv,
+							   U32 slot,
+							   U32 nb_uavs,
+							   const CommandHandle* uavs,
+							   const U32* initial_counts) noexcept;
+
+		/**
+		 Updates the given buffer.
+
+		 @param[in]		buffer
+						The buffer.
+		 @param[in]		offset
+						The offset (in bytes) into the buffer.
+		 @param[in]		size
+						The size (in bytes) of the update.
+		 @param[in]		no_overwrite
+						@c true if the update does not overwrite data in use.
+						@c false otherwise.
+		 @param[in]		data
+						A pointer to the data of the update.
+		 @throws		Exception
+						Failed to map the given buffer.
+		 */
+		void UpdateBuffer(CommandHandle buffer, U32 offset, U32 size,
+						  bool no_overwrite, const void* data);
+
+		void UpdateSubresource(CommandHandle resource, U32 subresource,
+							   const CommandBox* box,
+							   const void* data, U32 size,
+							   U32 row_pitch, U32 depth_pitch) noexcept;
+
+		void ClearRenderTargetView(CommandHandle rtv,
+								   const F32* rgba) noexcept;
+
+		void ClearDepthStencilView(CommandHandle dsv, U32 flags,
+								   F32 depth, U8 stencil) noexcept;
+
+		void ClearUnorderedAccessView(CommandHandle uav,
+									  const U32* values) noexcept;
+
+		void ClearUnorderedAccessView(CommandHandle uav,
+									  const F32* values) noexcept;
+
+		void GenerateMips(CommandHandle srv) noexcept;
+
+		void Draw(U32 nb_vertices, U32 start_vertex) noexcept;
+
+		void DrawIndexed(U32 nb_indices, U32 start_index,
+						 S32 base_vertex) noexcept;
+
+		void DrawInstanced(U32 nb_vertices, U32 nb_instances,
+						   U32 start_vertex, U32 start_instance) noexcept;
+
+		void DrawIndexedInstanced(U32 nb_indices, U32 nb_instances,
+								  U32 start_index, S32 base_vertex,
+								  U32 start_instance) noexcept;
+
+		void DrawAuto() noexcept;
+
+		void DrawInstancedIndirect(CommandHandle buffer,
+								   U32 offset) noexcept;
+
+		void DrawIndexedInstancedIndirect(CommandHandle buffer,
+										  U32 offset) noexcept;
+
+		void Dispatch(U32 nb_groups_x, U32 nb_groups_y,
+					  U32 nb_groups_z) noexcept;
+
+		void DispatchIndirect(CommandHandle buffer, U32 offset) noexcept;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A reference to the device context of this command replayer.
+		 */
+		std::reference_wrapper< ID3D11DeviceContext > m_device_context;
+	};
+}
\ No newline at end of file
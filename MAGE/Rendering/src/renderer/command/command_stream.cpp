@@ -0,0 +1,335 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\command\command_stream.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	CommandStream::CommandStream()
+		: m_data(),
+		m_nb_commands(0u) {}
+
+	CommandStream::CommandStream(CommandStream&& stream) noexcept = default;
+
+	CommandStream::~CommandStream() = default;
+
+	CommandStream& CommandStream
+		::operator=(CommandStream&& stream) noexcept = default;
+
+	void CommandStream::Clear() noexcept {
+		m_data.clear();
+		m_nb_commands = 0u;
+	}
+
+	size_t CommandStream::Allocate(size_t size, size_t alignment) {
+		const auto offset = (m_data.size() + alignment - 1u) & ~(alignment - 1u);
+		m_data.resize(offset + size);
+		return offset;
+	}
+
+	void CommandStream::Begin(CommandType type) {
+		Write(type);
+		++m_nb_commands;
+	}
+
+	[[nodiscard]]
+	const void* CommandStream::ReadData(size_t& position,
+										size_t size) const noexcept {
+
+		position = (position + s_data_alignment - 1u) & ~(s_data_alignment - 1u);
+
+		const auto data = m_data.data() + position;
+		position += size;
+
+		return data;
+	}
+
+	//-------------------------------------------------------------------------
+	// Binding
+	//-------------------------------------------------------------------------
+
+	void CommandStream::BindShader(CommandStage stage, CommandHandle shader) {
+		Begin(CommandType::BindShader);
+		Write(stage);
+		Write(shader);
+	}
+
+	void CommandStream::BindConstantBuffers(CommandStage stage, U32 slot,
+											U32 nb_buffers,
+											const CommandHandle* buffers) {
+		Begin(CommandType::BindConstantBuffers);
+		Write(stage);
+		Write(slot);
+		Write(nb_buffers);
+		WriteArray(buffers, nb_buffers);
+	}
+
+	void CommandStream::BindShaderResourceViews(CommandStage stage, U32 slot,
+												U32 nb_srvs,
+												const CommandHandle* srvs) {
+		Begin(CommandType::BindShaderResourceViews);
+		Write(stage);
+		Write(slot);
+		Write(nb_srvs);
+		WriteArray(srvs, nb_srvs);
+	}
+
+	void CommandStream::BindSamplers(CommandStage stage, U32 slot,
+									 U32 nb_samplers,
+									 const CommandHandle* samplers) {
+		Begin(CommandType::BindSamplers);
+		Write(stage);
+		Write(slot);
+		Write(nb_samplers);
+		WriteArray(samplers, nb_samplers);
+	}
+
+	void CommandStream::BindUnorderedAccessViews(U32 slot, U32 nb_uavs,
+												 const CommandHandle* uavs,
+												 const U32* initial_counts) {
+		Begin(CommandType::BindUnorderedAccessViews);
+		Write(slot);
+		Write(nb_uavs);
+		WriteArray(uavs, nb_uavs);
+		WriteArray(initial_counts, nb_uavs);
+	}
+
+	void CommandStream::BindInputLayout(CommandHandle input_layout) {
+		Begin(CommandType::BindInputLayout);
+		Write(input_layout);
+	}
+
+	void CommandStream::BindPrimitiveTopology(U32 topology) {
+		Begin(CommandType::BindPrimitiveTopology);
+		Write(topology);
+	}
+
+	void CommandStream::BindVertexBuffers(U32 slot, U32 nb_buffers,
+										  const CommandHandle* buffers,
+										  const U32* strides,
+										  const U32* offsets) {
+		Begin(CommandType::BindVertexBuffers);
+		Write(slot);
+		Write(nb_buffers);
+		WriteArray(buffers, nb_buffers);
+		WriteArray(strides, nb_buffers);
+		WriteArray(offsets, nb_buffers);
+	}
+
+	void CommandStream::BindIndexBuffer(CommandHandle buffer,
+										U32 format, U32 offset) {
+		Begin(CommandType::BindIndexBuffer);
+		Write(buffer);
+		Write(format);
+		Write(offset);
+	}
+
+	void CommandStream::BindRasterizerState(CommandHandle state) {
+		Begin(CommandType::BindRasterizerState);
+		Write(state);
+	}
+
+	void CommandStream::BindViewports(U32 nb_viewports,
+									  const CommandViewport* viewports) {
+		Begin(CommandType::BindViewports);
+		Write(nb_viewports);
+		WriteArray(viewports, nb_viewports);
+	}
+
+	void CommandStream::BindScissorRectangles(U32 nb_rectangles,
+											  const CommandRectangle* rectangles) {
+		Begin(CommandType::BindScissorRectangles);
+		Write(nb_rectangles);
+		WriteArray(rectangles, nb_rectangles);
+	}
+
+	void CommandStream::BindBlendState(CommandHandle state,
+									   const F32* factor,
+									   U32 sample_mask) {
+		Begin(CommandType::BindBlendState);
+		Write(state);
+		WriteArray(factor, 4u);
+		Write(sample_mask);
+	}
+
+	void CommandStream::BindDepthStencilState(CommandHandle state,
+											  U32 stencil_ref) {
+		Begin(CommandType::BindDepthStencilState);
+		Write(state);
+		Write(stencil_ref);
+	}
+
+	void CommandStream::BindRenderTargets(U32 nb_rtvs,
+										  const CommandHandle* rtvs,
+										  CommandHandle dsv,
+										  U32 slot,
+										  U32 nb_uavs,
+										  const CommandHandle* uavs,
+										  const U32* initial_counts) {
+		Begin(CommandType::BindRenderTargets);
+		Write(nb_rtvs);
+		WriteArray(rtvs, nb_rtvs);
+		Write(dsv);
+		Write(slot);
+		Write(nb_uavs);
+		WriteArray(uavs, nb_uavs);
+		WriteArray(initial_counts, nb_uavs);
+	}
+
+	//-------------------------------------------------------------------------
+	// Updating
+	//-------------------------------------------------------------------------
+
+	[[nodiscard]]
+	void* CommandStream::UpdateBuffer(CommandHandle buffer, U32 offset,
+									  U32 size, bool no_overwrite) {
+		Begin(CommandType::UpdateBuffer);
+		Write(buffer);
+		Write(offset);
+		Write(size);
+		Write(no_overwrite);
+		// Allocate may reallocate the data of this command stream.
+		const auto position = Allocate(size, s_data_alignment);
+		return m_data.data() + position;
+	}
+
+	void CommandStream::UpdateSubresource(CommandHandle resource,
+										  U32 subresource,
+										  const CommandBox* box,
+										  const void* data, U32 size,
+										  U32 row_pitch, U32 depth_pitch) {
+		Begin(CommandType::UpdateSubresource);
+		Write(resource);
+		Write(subresource);
+		WriteArray(box, 1u);
+		Write(size);
+		Write(row_pitch);
+		Write(depth_pitch);
+		const auto offset = Allocate(size, s_data_alignment);
+		if (0u != size) {
+			std::memcpy(m_data.data() + offset, data, size);
+		}
+	}
+
+	//-------------------------------------------------------------------------
+	// Clearing
+	//-------------------------------------------------------------------------
+
+	void CommandStream::ClearRenderTargetView(CommandHandle rtv,
+											  const F32* rgba) {
+		Begin(CommandType::ClearRenderTargetView);
+		Write(rtv);
+		WriteArray(rgba, 4u);
+	}
+
+	void CommandStream::ClearDepthStencilView(CommandHandle dsv, U32 flags,
+											  F32 depth, U8 stencil) {
+		Begin(CommandType::ClearDepthStencilView);
+		Write(dsv);
+		Write(flags);
+		Write(depth);
+		Write(stencil);
+	}
+
+	void CommandStream::ClearUnorderedAccessView(CommandHandle uav,
+												 const U32* values) {
+		Begin(CommandType::ClearUnorderedAccessViewUint);
+		Write(uav);
+		WriteArray(values, 4u);
+	}
+
+	void CommandStream::ClearUnorderedAccessView(CommandHandle uav,
+												 const F32* values) {
+		Begin(CommandType::ClearUnorderedAccessViewFloat);
+		Write(uav);
+		WriteArray(values, 4u);
+	}
+
+	void CommandStream::GenerateMips(CommandHandle srv) {
+		Begin(CommandType::GenerateMips);
+		Write(srv);
+	}
+
+	//-------------------------------------------------------------------------
+	// Drawing and Dispatching
+	//-------------------------------------------------------------------------
+
+	void CommandStream::Draw(U32 nb_vertices, U32 start_vertex) {
+		Begin(CommandType::Draw);
+		Write(nb_vertices);
+		Write(start_vertex);
+	}
+
+	void CommandStream::DrawIndexed(U32 nb_indices, U32 start_index,
+									S32 base_vertex) {
+		Begin(CommandType::DrawIndexed);
+		Write(nb_indices);
+		Write(start_index);
+		Write(base_vertex);
+	}
+
+	void CommandStream::DrawInstanced(U32 nb_vertices, U32 nb_instances,
+									  U32 start_vertex, U32 start_instance) {
+		Begin(CommandType::DrawInstanced);
+		Write(nb_vertices);
+		Write(nb_instances);
+		Write(start_vertex);
+		Write(start_instance);
+	}
+
+	void CommandStream::DrawIndexedInstanced(U32 nb_indices, U32 nb_instances,
+											 U32 start_index, S32 base_vertex,
+											 U32 start_instance) {
+		Begin(CommandType::DrawIndexedInstanced);
+		Write(nb_indices);
+		Write(nb_instances);
+		Write(start_index);
+		Write(base_vertex);
+		Write(start_instance);
+	}
+
+	void CommandStream::DrawAuto() {
+		Begin(CommandType::DrawAuto);
+	}
+
+	void CommandStream::DrawInstancedIndirect(CommandHandle buffer,
+											  U32 offset) {
+		Begin(CommandType::DrawInstancedIndirect);
+		Write(buffer);
+		Write(offset);
+	}
+
+	void CommandStream::DrawIndexedInstancedIndirect(CommandHandle buffer,
+													 U32 offset) {
+		Begin(CommandType::DrawIndexedInstancedIndirect);
+		Write(buffer);
+		Write(offset);
+	}
+
+	void CommandStream::Dispatch(U32 nb_groups_x, U32 nb_groups_y,
+								 U32 nb_groups_z) {
+		Begin(CommandType::Dispatch);
+		Write(nb_groups_x);
+		Write(nb_groups_y);
+		Write(nb_groups_z);
+	}
+
+	void CommandStream::DispatchIndirect(CommandHandle buffer, U32 offset) {
+		Begin(CommandType::DispatchIndirect);
+		Write(buffer);
+		Write(offset);
+	}
+
+	void CommandStream::Callback(CommandCallback callback, void* data) {
+		Begin(CommandType::Callback);
+		Write(callback);
+		Write(data);
+	}
+}
\ No newline at end of file
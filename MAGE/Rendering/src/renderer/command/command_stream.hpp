@@ -0,0 +1,588 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "type\types.hpp"
+#include "memory\allocation.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	//-------------------------------------------------------------------------
+	// Command Types
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 An enumeration of the different shader stages of commands.
+	 */
+	enum class CommandStage : U8 {
+		VS = 0, // Vertex Shader stage
+		HS,     // Hull Shader stage
+		DS,     // Domain Shader stage
+		GS,     // Geometry Shader stage
+		PS,     // Pixel Shader stage
+		CS      // Compute Shader stage
+	};
+
+	/**
+	 The type of (opaque) handles to the device objects referenced by
+	 commands.
+	 */
+	using CommandHandle = void*;
+
+	/**
+	 The type of callbacks of commands.
+	 */
+	using CommandCallback = void (*)(void* data);
+
+	/**
+	 A struct of viewports of commands.
+	 */
+	struct CommandViewport final {
+
+	public:
+
+		F32 m_top_left_x;
+		F32 m_top_left_y;
+		F32 m_width;
+		F32 m_height;
+		F32 m_min_depth;
+		F32 m_max_depth;
+	};
+
+	/**
+	 A struct of rectangles of commands.
+	 */
+	struct CommandRectangle final {
+
+	public:
+
+		S32 m_left;
+		S32 m_top;
+		S32 m_right;
+		S32 m_bottom;
+	};
+
+	/**
+	 A struct of boxes of commands.
+	 */
+	struct CommandBox final {
+
+	public:
+
+		U32 m_left;
+		U32 m_top;
+		U32 m_front;
+		U32 m_right;
+		U32 m_bottom;
+		U32 m_back;
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// CommandStream
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A class of command streams.
+
+	 A command stream records a compact, backend-agnostic sequence of
+	 commands (binds, updates, clears, draws and dispatches) into a single
+	 block of memory, and replays these commands to a command context. The
+	 device objects referenced by the commands are not retained by a command
+	 stream. The data of buffer and subresource updates is stored inline.
+
+	 A command context provides the methods @c BindShader,
+	 @c BindConstantBuffers, @c BindShaderResourceViews, @c BindSamplers,
+	 @c BindUnorderedAccessViews, @c BindInputLayout,
+	 @c BindPrimitiveTopology, @c BindVertexBuffers, @c BindIndexBuffer,
+	 @c BindRasterizerState, @c BindViewports, @c BindScissorRectangles,
+	 @c BindBlendState, @c BindDepthStencilState, @c BindRenderTargets,
+	 @c UpdateBuffer, @c UpdateSubresource, @c ClearRenderTargetView,
+	 @c ClearDepthStencilView, @c ClearUnorderedAccessView, @c GenerateMips,
+	 @c Draw, @c DrawIndexed, @c DrawInstanced, @c DrawIndexedInstanced,
+	 @c DrawAuto, @c DrawInstancedIndirect, @c DrawIndexedInstancedIndirect,
+	 @c Dispatch and @c DispatchIndirect with the same arguments as the
+	 recording methods of command streams (@c UpdateBuffer additionally
+	 receives a pointer to the data). (Optional) arrays are passed as
+	 (possibly @c nullptr) pointers into the command stream.
+	 */
+	class CommandStream final {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a command stream.
+		 */
+		CommandStream();
+
+		/**
+		 Constructs a command stream from the given command stream.
+
+		 @param[in]		stream
+						A reference to the command stream to copy.
+		 */
+		CommandStream(const CommandStream& stream) = delete;
+
+		/**
+		 Constructs a command stream by moving the given command stream.
+
+		 @param[in]		stream
+						A reference to the command stream to move.
+		 */
+		CommandStream(CommandStream&& stream) noexcept;
+
+		/**
+		 Destructs this command stream.
+		 */
+		~CommandStream();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given command stream to this command stream.
+
+		 @param[in]		stream
+						A reference to the command stream to copy.
+		 @return		A reference to the copy of the given command stream
+						(i.e. this command stream).
+		 */
+		CommandStream& operator=(const CommandStream& stream) = delete;
+
+		/**
+		 Moves the given command stream to this command stream.
+
+		 @param[in]		stream
+						A reference to the command stream to move.
+		 @return		A reference to the moved command stream (i.e. this
+						command stream).
+		 */
+		CommandStream& operator=(CommandStream&& stream) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Checks whether this command stream contains no commands.
+
+		 @return		@c true if this command stream contains no commands.
+						@c false otherwise.
+		 */
+		[[nodiscard]]
+		bool IsEmpty() const noexcept {
+			return m_data.empty();
+		}
+
+		/**
+		 Returns the number of commands of this command stream.
+
+		 @return		The number of commands of this command stream.
+		 */
+		[[nodiscard]]
+		size_t GetNumberOfCommands() const noexcept {
+			return m_nb_commands;
+		}
+
+		/**
+		 Returns the size of this command stream.
+
+		 @return		The size (in bytes) of this command stream.
+		 */
+		[[nodiscard]]
+		size_t GetSize() const noexcept {
+			return m_data.size();
+		}
+
+		/**
+		 Removes all commands of this command stream. The memory of this
+		 command stream is retained for recording the next commands.
+		 */
+		void Clear() noexcept;
+
+		/**
+		 Replays the commands of this command stream to the given command
+		 context.
+
+		 @tparam		ContextT
+						The command context type.
+		 @param[in]		context
+						A reference to the command context.
+		 */
+		template< typename ContextT >
+		void Replay(ContextT& context) const;
+
+		//---------------------------------------------------------------------
+		// Member Methods: Binding
+		//---------------------------------------------------------------------
+
+		void BindShader(CommandStage stage, CommandHandle shader);
+
+		void BindConstantBuffers(CommandStage stage, U32 slot,
+								 U32 nb_buffers,
+								 const CommandHandle* buffers);
+
+		void BindShaderResourceViews(CommandStage stage, U32 slot,
+									 U32 nb_srvs,
+									 const CommandHandle* srvs);
+
+		void BindSamplers(CommandStage stage, U32 slot,
+						  U32 nb_samplers,
+						  const CommandHandle* samplers);
+
+		void BindUnorderedAccessViews(U32 slot, U32 nb_uavs,
+									  const CommandHandle* uavs,
+									  const U32* initial_counts);
+
+		void BindInputLayout(CommandHandle input_layout);
+
+		void BindPrimitiveTopology(U32 topology);
+
+		void BindVertexBuffers(U32 slot, U32 nb_buffers,
+							   const CommandHandle* buffers,
+							   const U32* strides,
+							   const U32* offsets);
+
+		void BindIndexBuffer(CommandHandle buffer, U32 format, U32 offset);
+
+		void BindRasterizerState(CommandHandle state);
+
+		void BindViewports(U32 nb_viewports,
+						   const CommandViewport* viewports);
+
+		void BindScissorRectangles(U32 nb_rectangles,
+								   const CommandRectangle* rectangles);
+
+		void BindBlendState(CommandHandle state,
+							const F32* factor,
+							U32 sample_mask);
+
+		void BindDepthStencilState(CommandHandle state, U32 stencil_ref);
+
+		/**
+		 Binds the given render target views, depth stencil view and
+		 unordered access views.
+
+		 @param[in]		nb_rtvs
+						The number of render target views.
+		 @param[in]		rtvs
+						A pointer to @a nb_rtvs render target views (or
+						@c nullptr if no render target views are recorded).
+		 @param[in]		dsv
+						The depth stencil view.
+		 @param[in]		slot
+						The first unordered access view slot.
+		 @param[in]		nb_uavs
+						The number of unordered access views.
+		 @param[in]		uavs
+						A pointer to @a nb_uavs unordered access views (or
+						@c nullptr if no unordered access views are
+						recorded).
+		 @param[in]		initial_counts
+						A pointer to @a nb_uavs initial counts (or
+						@c nullptr if no initial counts are recorded).
+		 */
+		void BindRenderTargets(U32 nb_rtvs,
+							   const CommandHandle* rtvs,
+							   CommandHandle dsv,
+							   U32 slot,
+							   U32 nb_uavs,
+							   const CommandHandle* uavs,
+							   const U32* initial_counts);
+
+		//---------------------------------------------------------------------
+		// Member Methods: Updating
+		//---------------------------------------------------------------------
+
+		/**
+		 Records an update of the given buffer.
+
+		 @param[in]		buffer
+						The buffer.
+		 @param[in]		offset
+						The offset (in bytes) into the buffer.
+		 @param[in]		size
+						The size (in bytes) of the update.
+		 @param[in]		no_overwrite
+						@c true if the update does not overwrite data in use
+						(i.e. the data outside the update is preserved).
+						@c false otherwise (i.e. the previous data of the
+						buffer is discarded).
+		 @return		A pointer to the (16-byte aligned) memory of size
+						@a size to write the data of the update to. This
+						pointer is only valid until the next command is
+						recorded.
+		 */
+		[[nodiscard]]
+		void* UpdateBuffer(CommandHandle buffer, U32 offset, U32 size,
+						   bool no_overwrite);
+
+		/**
+		 Records an update of the given subresource.
+
+		 @param[in]		resource
+						The resource.
+		 @param[in]		subresource
+						The index of the subresource.
+		 @param[in]		box
+						A pointer to the box of the subresource to update
+						(or @c nullptr to update the complete subresource).
+		 @param[in]		data
+						A pointer to the data.
+		 @param[in]		size
+						The size (in bytes) of the data.
+		 @param[in]		row_pitch
+						The size (in bytes) of one row of the data.
+		 @param[in]		depth_pitch
+						The size (in bytes) of one depth slice of the data.
+		 */
+		void UpdateSubresource(CommandHandle resource, U32 subresource,
+							   const CommandBox* box,
+							   const void* data, U32 size,
+							   U32 row_pitch, U32 depth_pitch);
+
+		//---------------------------------------------------------------------
+		// Member Methods: Clearing
+		//---------------------------------------------------------------------
+
+		void ClearRenderTargetView(CommandHandle rtv, const F32* rgba);
+
+		void ClearDepthStencilView(CommandHandle dsv, U32 flags,
+								   F32 depth, U8 stencil);
+
+		void ClearUnorderedAccessView(CommandHandle uav, const U32* values);
+
+		void ClearUnorderedAccessView(CommandHandle uav, const F32* values);
+
+		void GenerateMips(CommandHandle srv);
+
+		//---------------------------------------------------------------------
+		// Member Methods: Drawing and Dispatching
+		//---------------------------------------------------------------------
+
+		void Draw(U32 nb_vertices, U32 start_vertex);
+
+		void DrawIndexed(U32 nb_indices, U32 start_index, S32 base_vertex);
+
+		void DrawInstanced(U32 nb_vertices, U32 nb_instances,
+						   U32 start_vertex, U32 start_instance);
+
+		void DrawIndexedInstanced(U32 nb_indices, U32 nb_instances,
+								  U32 start_index, S32 base_vertex,
+								  U32 start_instance);
+
+		void DrawAuto();
+
+		void DrawInstancedIndirect(CommandHandle buffer, U32 offset);
+
+		void DrawIndexedInstancedIndirect(CommandHandle buffer, U32 offset);
+
+		void Dispatch(U32 nb_groups_x, U32 nb_groups_y, U32 nb_groups_z);
+
+		void DispatchIndirect(CommandHandle buffer, U32 offset);
+
+		/**
+		 Records a call of the given callback with the given data. The
+		 callback is called on the replaying thread, in command order.
+
+		 @param[in]		callback
+						The callback.
+		 @param[in]		data
+						A pointer to the data of the callback.
+		 */
+		void Callback(CommandCallback callback, void* data);
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 An enumeration of the different types of commands.
+		 */
+		enum class CommandType : U8 {
+			BindShader = 0,
+			BindConstantBuffers,
+			BindShaderResourceViews,
+			BindSamplers,
+			BindUnorderedAccessViews,
+			BindInputLayout,
+			BindPrimitiveTopology,
+			BindVertexBuffers,
+			BindIndexBuffer,
+			BindRasterizerState,
+			BindViewports,
+			BindScissorRectangles,
+			BindBlendState,
+			BindDepthStencilState,
+			BindRenderTargets,
+			UpdateBuffer,
+			UpdateSubresource,
+			ClearRenderTargetView,
+			ClearDepthStencilView,
+			ClearUnorderedAccessViewUint,
+			ClearUnorderedAccessViewFloat,
+			GenerateMips,
+			Draw,
+			DrawIndexed,
+			DrawInstanced,
+			DrawIndexedInstanced,
+			DrawAuto,
+			DrawInstancedIndirect,
+			DrawIndexedInstancedIndirect,
+			Dispatch,
+			DispatchIndirect,
+			Callback
+		};
+
+		/**
+		 The alignment (in bytes) of the inline data of updates.
+		 */
+		static constexpr size_t s_data_alignment = 16u;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Allocates the given number of bytes at the end of this command
+		 stream.
+
+		 @param[in]		size
+						The size (in bytes).
+		 @param[in]		alignment
+						The alignment (in bytes).
+		 @return		The offset (in bytes) of the allocated memory in this
+						command stream.
+		 */
+		size_t Allocate(size_t size, size_t alignment);
+
+		/**
+		 Begins recording a command of the given type.
+
+		 @param[in]		type
+						The command type.
+		 */
+		void Begin(CommandType type);
+
+		/**
+		 Writes the given value.
+
+		 @tparam		T
+						The value type.
+		 @param[in]		value
+						A reference to the value.
+		 */
+		template< typename T >
+		void Write(const T& value);
+
+		/**
+		 Writes the given (optional) array.
+
+		 @tparam		T
+						The element type.
+		 @param[in]		values
+						A pointer to the values (or @c nullptr if no array
+						must be recorded).
+		 @param[in]		count
+						The number of values.
+		 */
+		template< typename T >
+		void WriteArray(const T* values, size_t count);
+
+		/**
+		 Reads a value.
+
+		 @tparam		T
+						The value type.
+		 @param[in,out]	position
+						A reference to the read position in this command
+						stream.
+		 @return		The value.
+		 */
+		template< typename T >
+		[[nodiscard]]
+		const T Read(size_t& position) const noexcept;
+
+		/**
+		 Reads an (optional) array.
+
+		 @tparam		T
+						The element type.
+		 @param[in,out]	position
+						A reference to the read position in this command
+						stream.
+		 @param[in]		count
+						The number of values.
+		 @return		A pointer to the values in this command stream.
+		 @return		@c nullptr if no array was recorded.
+		 */
+		template< typename T >
+		[[nodiscard]]
+		const T* ReadArray(size_t& position, size_t count) const noexcept;
+
+		/**
+		 Reads the inline data of an update.
+
+		 @param[in,out]	position
+						A reference to the read position in this command
+						stream.
+		 @param[in]		size
+						The size (in bytes) of the data.
+		 @return		A pointer to the data in this command stream.
+		 */
+		[[nodiscard]]
+		const void* ReadData(size_t& position, size_t size) const noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The recorded commands of this command stream.
+		 */
+		std::vector< U8, AlignedAllocator< U8, s_data_alignment > > m_data;
+
+		/**
+		 The number of recorded commands of this command stream.
+		 */
+		size_t m_nb_commands;
+	};
+
+	#pragma endregion
+}
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\command\command_stream.tpp"
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,300 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <cstring>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	template< typename ContextT >
+	void CommandStream::Replay(ContextT& context) const {
+		size_t position = 0u;
+		while (position < m_data.size()) {
+
+			switch (Read< CommandType >(position)) {
+
+			case CommandType::BindShader: {
+				const auto stage  = Read< CommandStage >(position);
+				const auto shader = Read< CommandHandle >(position);
+				context.BindShader(stage, shader);
+				break;
+			}
+			case CommandType::BindConstantBuffers: {
+				const auto stage      = Read< CommandStage >(position);
+				const auto slot       = Read< U32 >(position);
+				const auto nb_buffers = Read< U32 >(position);
+				const auto buffers    = ReadArray< CommandHandle >(position, nb_buffers);
+				context.BindConstantBuffers(stage, slot, nb_buffers, buffers);
+				break;
+			}
+			case CommandType::BindShaderResourceViews: {
+				const auto stage   = Read< CommandStage >(position);
+				const auto slot    = Read< U32 >(position);
+				const auto nb_srvs = Read< U32 >(position);
+				const auto srvs    = ReadArray< CommandHandle >(position, nb_srvs);
+				context.BindShaderResourceViews(stage, slot, nb_srvs, srvs);
+				break;
+			}
+			case CommandType::BindSamplers: {
+				const auto stage       = Read< CommandStage >(position);
+				const auto slot        = Read< U32 >(position);
+				const auto nb_samplers = Read< U32 >(position);
+				const auto samplers    = ReadArray< CommandHandle >(position, nb_samplers);
+				context.BindSamplers(stage, slot, nb_samplers, samplers);
+				break;
+			}
+			case CommandType::BindUnorderedAccessViews: {
+				const auto slot           = Read< U32 >(position);
+				const auto nb_uavs        = Read< U32 >(position);
+				const auto uavs           = ReadArray< CommandHandle >(position, nb_uavs);
+				const auto initial_counts = ReadArray< U32 >(position, nb_uavs);
+				context.BindUnorderedAccessViews(slot, nb_uavs, uavs,
+												 initial_counts);
+				break;
+			}
+			case CommandType::BindInputLayout: {
+				context.BindInputLayout(Read< CommandHandle >(position));
+				break;
+			}
+			case CommandType::BindPrimitiveTopology: {
+				context.BindPrimitiveTopology(Read< U32 >(position));
+				break;
+			}
+			case CommandType::BindVertexBuffers: {
+				const auto slot       = Read< U32 >(position);
+				const auto nb_buffers = Read< U32 >(position);
+				const auto buffers    = ReadArray< CommandHandle >(position, nb_buffers);
+				const auto strides    = ReadArray< U32 >(position, nb_buffers);
+				const auto offsets    = ReadArray< U32 >(position, nb_buffers);
+				context.BindVertexBuffers(slot, nb_buffers,
+										  buffers, strides, offsets);
+				break;
+			}
+			case CommandType::BindIndexBuffer: {
+				const auto buffer = Read< CommandHandle >(position);
+				const auto format = Read< U32 >(position);
+				const auto offset = Read< U32 >(position);
+				context.BindIndexBuffer(buffer, format, offset);
+				break;
+			}
+			case CommandType::BindRasterizerState: {
+				context.BindRasterizerState(Read< CommandHandle >(position));
+				break;
+			}
+			case CommandType::BindViewports: {
+				const auto nb_viewports = Read< U32 >(position);
+				const auto viewports    = ReadArray< CommandViewport >(position, nb_viewports);
+				context.BindViewports(nb_viewports, viewports);
+				break;
+			}
+			case CommandType::BindScissorRectangles: {
+				const auto nb_rectangles = Read< U32 >(position);
+				const auto rectangles    = ReadArray< CommandRectangle >(position, nb_rectangles);
+				context.BindScissorRectangles(nb_rectangles, rectangles);
+				break;
+			}
+			case CommandType::BindBlendState: {
+				const auto state       = Read< CommandHandle >(position);
+				const auto factor      = ReadArray< F32 >(position, 4u);
+				const auto sample_mask = Read< U32 >(position);
+				context.BindBlendState(state, factor, sample_mask);
+				break;
+			}
+			case CommandType::BindDepthStencilState: {
+				const auto state       = Read< CommandHandle >(position);
+				const auto stencil_ref = Read< U32 >(position);
+				context.BindDepthStencilState(state, stencil_ref);
+				break;
+			}
+			case CommandType::BindRenderTargets: {
+				const auto nb_rtvs        = Read< U32 >(position);
+				const auto rtvs           = ReadArray< CommandHandle >(position, nb_rtvs);
+				const auto dsv            = Read< CommandHandle >(position);
+				const auto slot           = Read< U32 >(position);
+				const auto nb_uavs        = Read< U32 >(position);
+				const auto uavs           = ReadArray< CommandHandle >(position, nb_uavs);
+				const auto initial_counts = ReadArray< U32 >(position, nb_uavs);
+				context.BindRenderTargets(nb_rtvs, rtvs, dsv,
+										  slot, nb_uavs, uavs, initial_counts);
+				break;
+			}
+			case CommandType::UpdateBuffer: {
+				const auto buffer       = Read< CommandHandle >(position);
+				const auto offset       = Read< U32 >(position);
+				const auto size         = Read< U32 >(position);
+				const auto no_overwrite = Read< bool >(position);
+				const auto data         = ReadData(position, size);
+				context.UpdateBuffer(buffer, offset, size, no_overwrite, data);
+				break;
+			}
+			case CommandType::UpdateSubresource: {
+				const auto resource    = Read< CommandHandle >(position);
+				const auto subresource = Read< U32 >(position);
+				const auto box         = ReadArray< CommandBox >(position, 1u);
+				const auto size        = Read< U32 >(position);
+				const auto row_pitch   = Read< U32 >(position);
+				const auto depth_pitch = Read< U32 >(position);
+				const auto data        = ReadData(position, size);
+				context.UpdateSubresource(resource, subresource, box,
+										  data, size, row_pitch, depth_pitch);
+				break;
+			}
+			case CommandType::ClearRenderTargetView: {
+				const auto rtv  = Read< CommandHandle >(position);
+				const auto rgba = ReadArray< F32 >(position, 4u);
+				context.ClearRenderTargetView(rtv, rgba);
+				break;
+			}
+			case CommandType::ClearDepthStencilView: {
+				const auto dsv     = Read< CommandHandle >(position);
+				const auto flags   = Read< U32 >(position);
+				const auto depth   = Read< F32 >(position);
+				const auto stencil = Read< U8 >(position);
+				context.ClearDepthStencilView(dsv, flags, depth, stencil);
+				break;
+			}
+			case CommandType::ClearUnorderedAccessViewUint: {
+				const auto uav    = Read< CommandHandle >(position);
+				const auto values = ReadArray< U32 >(position, 4u);
+				context.ClearUnorderedAccessView(uav, values);
+				break;
+			}
+			case CommandType::ClearUnorderedAccessViewFloat: {
+				const auto uav    = Read< CommandHandle >(position);
+				const auto values = ReadArray< F32 >(position, 4u);
+				context.ClearUnorderedAccessView(uav, values);
+				break;
+			}
+			case CommandType::GenerateMips: {
+				context.GenerateMips(Read< CommandHandle >(position));
+				break;
+			}
+			case CommandType::Draw: {
+				const auto nb_vertices  = Read< U32 >(position);
+				const auto start_vertex = Read< U32 >(position);
+				context.Draw(nb_vertices, start_vertex);
+				break;
+			}
+			case CommandType::DrawIndexed: {
+				const auto nb_indices  = Read< U32 >(position);
+				const auto start_index = Read< U32 >(position);
+				const auto base_vertex = Read< S32 >(position);
+				context.DrawIndexed(nb_indices, start_index, base_vertex);
+				break;
+			}
+			case CommandType::DrawInstanced: {
+				const auto nb_vertices    = Read< U32 >(position);
+				const auto nb_instances   = Read< U32 >(position);
+				const auto start_vertex   = Read< U32 >(position);
+				const auto start_instance = Read< U32 >(position);
+				context.DrawInstanced(nb_vertices, nb_instances,
+									  start_vertex, start_instance);
+				break;
+			}
+			case CommandType::DrawIndexedInstanced: {
+				const auto nb_indices     = Read< U32 >(position);
+				const auto nb_instances   = Read< U32 >(position);
+				const auto start_index    = Read< U32 >(position);
+				const auto base_vertex    = Read< S32 >(position);
+				const auto start_instance = Read< U32 >(position);
+				context.DrawIndexedInstanced(nb_indices, nb_instances,
+											 start_index, base_vertex,
+											 start_instance);
+				break;
+			}
+			case CommandType::DrawAuto: {
+				context.DrawAuto();
+				break;
+			}
+			case CommandType::DrawInstancedIndirect: {
+				const auto buffer = Read< CommandHandle >(position);
+				const auto offset = Read< U32 >(position);
+				context.DrawInstancedIndirect(buffer, offset);
+				break;
+			}
+			case CommandType::DrawIndexedInstancedIndirect: {
+				const auto buffer = Read< CommandHandle >(position);
+				const auto offset = Read< U32 >(position);
+				context.DrawIndexedInstancedIndirect(buffer, offset);
+				break;
+			}
+			case CommandType::Dispatch: {
+				const auto nb_groups_x = Read< U32 >(position);
+				const auto nb_groups_y = Read< U32 >(position);
+				const auto nb_groups_z = Read< U32 >(position);
+				context.Dispatch(nb_groups_x, nb_groups_y, nb_groups_z);
+				break;
+			}
+			case CommandType::DispatchIndirect: {
+				const auto buffer = Read< CommandHandle >(position);
+				const auto offset = Read< U32 >(position);
+				context.DispatchIndirect(buffer, offset);
+				break;
+			}
+			case CommandType::Callback: {
+				const auto callback = Read< CommandCallback >(position);
+				const auto data     = Read< void* >(position);
+				callback(data);
+				break;
+			}
+			}
+		}
+	}
+
+	template< typename T >
+	inline void CommandStream::Write(const T& value) {
+		const auto offset = Allocate(sizeof(T), alignof(T));
+		std::memcpy(m_data.data() + offset, &value, sizeof(T));
+	}
+
+	template< typename T >
+	void CommandStream::WriteArray(const T* values, size_t count) {
+		Write(nullptr != values);
+		if (nullptr == values) {
+			return;
+		}
+
+		const auto offset = Allocate(sizeof(T) * count, alignof(T));
+		if (0u != count) {
+			std::memcpy(m_data.data() + offset, values, sizeof(T) * count);
+		}
+	}
+
+	template< typename T >
+	[[nodiscard]]
+	inline const T CommandStream::Read(size_t& position) const noexcept {
+		position = (position + alignof(T) - 1u) & ~(alignof(T) - 1u);
+
+		T value;
+		std::memcpy(&value, m_data.data() + position, sizeof(T));
+		position += sizeof(T);
+
+		return value;
+	}
+
+	template< typename T >
+	[[nodiscard]]
+	const T* CommandStream::ReadArray(size_t& position,
+									  size_t count) const noexcept {
+
+		if (!Read< bool >(position)) {
+			return nullptr;
+		}
+
+		position = (position + alignof(T) - 1u) & ~(alignof(T) - 1u);
+
+		const auto values
+			= reinterpret_cast< const T* >(m_data.data() + position);
+		position += sizeof(T) * count;
+
+		return values;
+	}
+}
\ No newline at end of file
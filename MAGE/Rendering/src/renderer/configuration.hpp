@@ -164,13 +164,15 @@ namespace mage::rendering {
 
 	 This contains:
 	 @c None,
-	 @c Wireframe, and
-	 @c AABB.
+	 @c Wireframe,
+	 @c AABB, and
+	 @c ShadowAtlas.
 	 */
 	enum class RenderLayer : U32 {
-		None      = 0, // No layer.
-		Wireframe = 1, // Wirframe layer.
-		AABB      = 2, // AABB layer.
+		None        = 0, // No layer.
+		Wireframe   = 1, // Wirframe layer.
+		AABB        = 2, // AABB layer.
+		ShadowAtlas = 4, // Shadow atlas overlay layer.
 	};
 
 	#pragma endregion
@@ -0,0 +1,351 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\culling\occlusion_buffer.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	namespace {
+
+		/**
+		 The minimum homogeneous w value of rasterized vertices (i.e. the 
+		 near clipping plane of occlusion buffers).
+		 */
+		constexpr F32 g_min_w = 0.01f;
+
+		/**
+		 The number of pixel packets per row of the depth buffer.
+		 */
+		constexpr U32 g_nb_packets_per_row = OcclusionBuffer::s_width / 4u;
+
+		/**
+		 The number of tiles per row of the hierarchical depth buffer.
+		 */
+		constexpr U32 g_nb_tiles_per_row 
+			= OcclusionBuffer::s_width / OcclusionBuffer::s_tile_size;
+
+		/**
+		 The number of tiles per column of the hierarchical depth buffer.
+		 */
+		constexpr U32 g_nb_tiles_per_column 
+			= OcclusionBuffer::s_height / OcclusionBuffer::s_tile_size;
+
+		static_assert(0u == OcclusionBuffer::s_width  % OcclusionBuffer::s_tile_size);
+		static_assert(0u == OcclusionBuffer::s_height % OcclusionBuffer::s_tile_size);
+		static_assert(0u == OcclusionBuffer::s_tile_size % 4u);
+
+		/**
+		 Converts the given vertex from homogeneous projection space to 
+		 screen space.
+
+		 @pre			The homogeneous w value of the given vertex is 
+						positive.
+		 @param[in]		p
+						The vertex expressed in homogeneous projection space.
+		 @return		The vertex expressed in screen space (x and y in 
+						pixels, z the reciprocal homogeneous w).
+		 */
+		[[nodiscard]]
+		const XMVECTOR XM_CALLCONV ProjectionToScreen(FXMVECTOR p) noexcept {
+			static const XMVECTORF32 s_scale = { 
+				0.5f * OcclusionBuffer::s_width, 
+			   -0.5f * OcclusionBuffer::s_height, 
+				1.0f, 
+				0.0f 
+			};
+			static const XMVECTORF32 s_offset = { 
+				0.5f * OcclusionBuffer::s_width, 
+				0.5f * OcclusionBuffer::s_height, 
+				0.0f, 
+				0.0f 
+			};
+
+			const auto inv_w = XMVectorReciprocal(XMVectorSplatW(p));
+			const auto ndc   = XMVectorSelect(inv_w, p * inv_w, g_XMSelect1100);
+			return XMVectorMultiplyAdd(ndc, s_scale, s_offset);
+		}
+	}
+
+	OcclusionBuffer::OcclusionBuffer()
+		: m_depth(g_nb_packets_per_row * s_height),
+		m_hiz(g_nb_tiles_per_row * g_nb_tiles_per_column) {}
+
+	OcclusionBuffer::OcclusionBuffer(const OcclusionBuffer& buffer) = default;
+
+	OcclusionBuffer::OcclusionBuffer(OcclusionBuffer&& buffer) noexcept = default;
+
+	OcclusionBuffer::~OcclusionBuffer() = default;
+
+	OcclusionBuffer& OcclusionBuffer
+		::operator=(const OcclusionBuffer& buffer) = default;
+
+	OcclusionBuffer& OcclusionBuffer
+		::operator=(OcclusionBuffer&& buffer) noexcept = default;
+
+	void OcclusionBuffer::Clear() noexcept {
+		std::fill(m_depth.begin(), m_depth.end(), XMVectorZero());
+	}
+
+	void XM_CALLCONV OcclusionBuffer::RasterizeTriangle(FXMVECTOR p0, 
+														FXMVECTOR p1, 
+														FXMVECTOR p2) noexcept {
+
+		const XMVECTOR vertices[] = { p0, p1, p2 };
+		
+		// Clip the triangle against the near plane (w >= g_min_w).
+		XMVECTOR clipped[4];
+		size_t nb_clipped = 0u;
+		for (size_t i = 0u; i < 3u; ++i) {
+			const auto& a = vertices[i];
+			const auto& b = vertices[(i + 1u) % 3u];
+			const auto  a_w = XMVectorGetW(a);
+			const auto  b_w = XMVectorGetW(b);
+
+			if (g_min_w <= a_w) {
+				clipped[nb_clipped++] = a;
+			}
+			if ((g_min_w <= a_w) != (g_min_w <= b_w)) {
+				clipped[nb_clipped++] 
+					= XMVectorLerp(a, b, (g_min_w - a_w) / (b_w - a_w));
+			}
+		}
+
+		if (nb_clipped < 3u) {
+			return;
+		}
+
+		// Rasterize the triangle fan of the clipped polygon.
+		const auto s0 = ProjectionToScreen(clipped[0]);
+		auto       s1 = ProjectionToScreen(clipped[1]);
+		for (size_t i = 2u; i < nb_clipped; ++i) {
+			const auto s2 = ProjectionToScreen(clipped[i]);
+			RasterizeScreenTriangle(s0, s1, s2);
+			s1 = s2;
+		}
+	}
+
+	void XM_CALLCONV OcclusionBuffer::RasterizeScreenTriangle(FXMVECTOR p0, 
+															  FXMVECTOR p1, 
+															  FXMVECTOR p2) noexcept {
+		F32x3 v[] = { 
+			XMStore< F32x3 >(p0), 
+			XMStore< F32x3 >(p1), 
+			XMStore< F32x3 >(p2) 
+		};
+
+		// Both faces of the occluders are rasterized: orient the triangle 
+		// such that its (doubled) signed area is positive.
+		auto area = (v[1][0] - v[0][0]) * (v[2][1] - v[0][1])
+			      - (v[2][0] - v[0][0]) * (v[1][1] - v[0][1]);
+		if (std::abs(area) < std::numeric_limits< F32 >::epsilon()) {
+			return;
+		}
+		if (area < 0.0f) {
+			std::swap(v[1], v[2]);
+			area = -area;
+		}
+
+		// Determine the bounding rectangle of the triangle.
+		const auto min_x = std::max(0, static_cast< S32 >(std::floor(
+			std::min({ v[0][0], v[1][0], v[2][0] }))));
+		const auto max_x = std::min(static_cast< S32 >(s_width) - 1, 
+			static_cast< S32 >(std::ceil(std::max({ v[0][0], v[1][0], v[2][0] }))));
+		const auto min_y = std::max(0, static_cast< S32 >(std::floor(
+			std::min({ v[0][1], v[1][1], v[2][1] }))));
+		const auto max_y = std::min(static_cast< S32 >(s_height) - 1, 
+			static_cast< S32 >(std::ceil(std::max({ v[0][1], v[1][1], v[2][1] }))));
+		if (max_x < min_x || max_y < min_y) {
+			return;
+		}
+
+		// Set up the edge functions E_i(x, y) = a_i x + b_i y + c_i of the 
+		// edges opposite to each vertex and the (screen space linear) 
+		// reciprocal w plane equation.
+		const auto inv_area = 1.0f / area;
+		F32 a[3], b[3], c[3];
+		F32 z_a = 0.0f, z_b = 0.0f, z_c = 0.0f;
+		for (size_t i = 0u; i < 3u; ++i) {
+			const auto& s = v[(i + 1u) % 3u];
+			const auto& e = v[(i + 2u) % 3u];
+			a[i] = s[1] - e[1];
+			b[i] = e[0] - s[0];
+			c[i] = -a[i] * s[0] - b[i] * s[1];
+
+			const auto z = v[i][2] * inv_area;
+			z_a += a[i] * z;
+			z_b += b[i] * z;
+			z_c += c[i] * z;
+		}
+
+		const XMVECTOR edge_a[] = { 
+			XMVectorReplicate(a[0]), 
+			XMVectorReplicate(a[1]), 
+			XMVectorReplicate(a[2]) 
+		};
+		const auto z_dx    = XMVectorReplicate(z_a);
+		const auto offsets = XMVectorSet(0.5f, 1.5f, 2.5f, 3.5f);
+		const auto zero    = XMVectorZero();
+
+		for (auto y = min_y; y <= max_y; ++y) {
+			const auto py = static_cast< F32 >(y) + 0.5f;
+			const XMVECTOR edge_row[] = {
+				XMVectorReplicate(b[0] * py + c[0]),
+				XMVectorReplicate(b[1] * py + c[1]),
+				XMVectorReplicate(b[2] * py + c[2])
+			};
+			const auto z_row = XMVectorReplicate(z_b * py + z_c);
+
+			auto* const row = &m_depth[y * g_nb_packets_per_row];
+			for (auto x = min_x / 4; x <= max_x / 4; ++x) {
+				const auto px = XMVectorReplicate(static_cast< F32 >(4 * x)) 
+					          + offsets;
+
+				auto inside = XMVectorGreaterOrEqual(
+					XMVectorMultiplyAdd(px, edge_a[0], edge_row[0]), zero);
+				inside = XMVectorAndInt(inside, XMVectorGreaterOrEqual(
+					XMVectorMultiplyAdd(px, edge_a[1], edge_row[1]), zero));
+				inside = XMVectorAndInt(inside, XMVectorGreaterOrEqual(
+					XMVectorMultiplyAdd(px, edge_a[2], edge_row[2]), zero));
+				if (XMVector4EqualInt(inside, XMVectorFalseInt())) {
+					continue;
+				}
+
+				const auto z = XMVectorMultiplyAdd(px, z_dx, z_row);
+				row[x] = XMVectorSelect(row[x], XMVectorMax(row[x], z), inside);
+			}
+		}
+	}
+
+	void OcclusionBuffer::BuildHiZ() noexcept {
+		constexpr U32 nb_packets_per_tile_row = s_tile_size / 4u;
+		
+		for (U32 ty = 0u; ty < g_nb_tiles_per_column; ++ty) {
+			for (U32 tx = 0u; tx < g_nb_tiles_per_row; ++tx) {
+				const auto first = ty * s_tile_size * g_nb_packets_per_row 
+					             + tx * nb_packets_per_tile_row;
+				
+				auto depth = m_depth[first];
+				for (U32 y = 0u; y < s_tile_size; ++y) {
+					for (U32 x = 0u; x < nb_packets_per_tile_row; ++x) {
+						depth = XMVectorMin(depth, 
+							m_depth[first + y * g_nb_packets_per_row + x]);
+					}
+				}
+
+				depth = XMVectorMin(depth, XMVectorSwizzle< 2, 3, 0, 1 >(depth));
+				depth = XMVectorMin(depth, XMVectorSwizzle< 1, 0, 3, 2 >(depth));
+				m_hiz[ty * g_nb_tiles_per_row + tx] = XMVectorGetX(depth);
+			}
+		}
+	}
+
+	bool XM_CALLCONV OcclusionBuffer::IsOccluded(FXMMATRIX object_to_projection, 
+												 const AABB& aabb) const noexcept {
+		
+		const auto p_min = aabb.MinPoint();
+		const auto p_max = aabb.MaxPoint();
+		if (XMVector3Greater(p_min, p_max)) {
+			return false;
+		}
+
+		// Project the corners of the AABB.
+		auto s_min = XMVectorReplicate( std::numeric_limits< F32 >::infinity());
+		auto s_max = XMVectorReplicate(-std::numeric_limits< F32 >::infinity());
+		for (U32 i = 0u; i < 8u; ++i) {
+			const auto control = XMVectorSelectControl(i & 1u, (i >> 1u) & 1u, 
+													   (i >> 2u) & 1u, 0u);
+			const auto corner  = XMVectorSelect(p_min, p_max, control);
+			const auto p       = XMVector3Transform(corner, object_to_projection);
+			
+			// The camera is (nearly) inside the AABB.
+			if (XMVectorGetW(p) < g_min_w) {
+				return false;
+			}
+
+			const auto s = ProjectionToScreen(p);
+			s_min = XMVectorMin(s_min, s);
+			s_max = XMVectorMax(s_max, s);
+		}
+
+		const auto bounds_min = XMStore< F32x3 >(s_min);
+		const auto bounds_max = XMStore< F32x3 >(s_max);
+		// The largest reciprocal w value (i.e. the nearest depth) of the AABB.
+		const auto z_max      = XMVectorReplicate(bounds_max[2]);
+
+		const auto min_x = std::max(0, 
+			static_cast< S32 >(std::floor(bounds_min[0])));
+		const auto max_x = std::min(static_cast< S32 >(s_width) - 1, 
+			static_cast< S32 >(std::ceil(bounds_max[0])));
+		const auto min_y = std::max(0, 
+			static_cast< S32 >(std::floor(bounds_min[1])));
+		const auto max_y = std::min(static_cast< S32 >(s_height) - 1, 
+			static_cast< S32 >(std::ceil(bounds_max[1])));
+		if (max_x < min_x || max_y < min_y) {
+			// The AABB lies outside the view frustum.
+			return false;
+		}
+
+		const auto offsets = XMVectorSet(0.0f, 1.0f, 2.0f, 3.0f);
+		const auto tile    = static_cast< S32 >(s_tile_size);
+
+		for (auto ty = min_y / tile; ty <= max_y / tile; ++ty) {
+			for (auto tx = min_x / tile; tx <= max_x / tile; ++tx) {
+				// Coarse test against the nearest occluder depth of the tile.
+				if (bounds_max[2] < m_hiz[ty * g_nb_tiles_per_row + tx]) {
+					continue;
+				}
+
+				// Fine test against the occluder depth of each pixel.
+				const auto x0 = std::max(min_x, tx * tile);
+				const auto x1 = std::min(max_x, tx * tile + tile - 1);
+				const auto y0 = std::max(min_y, ty * tile);
+				const auto y1 = std::min(max_y, ty * tile + tile - 1);
+				const auto lo = XMVectorReplicate(static_cast< F32 >(x0));
+				const auto hi = XMVectorReplicate(static_cast< F32 >(x1));
+
+				for (auto y = y0; y <= y1; ++y) {
+					const auto* const row = &m_depth[y * g_nb_packets_per_row];
+					for (auto x = x0 / 4; x <= x1 / 4; ++x) {
+						const auto px = XMVectorReplicate(static_cast< F32 >(4 * x)) 
+							          + offsets;
+						
+						auto visible = XMVectorLessOrEqual(row[x], z_max);
+						visible = XMVectorAndInt(visible, 
+												 XMVectorGreaterOrEqual(px, lo));
+						visible = XMVectorAndInt(visible, 
+												 XMVectorLessOrEqual(px, hi));
+						if (!XMVector4EqualInt(visible, XMVectorFalseInt())) {
+							return false;
+						}
+					}
+				}
+			}
+		}
+
+		return true;
+	}
+
+	[[nodiscard]]
+	F32 OcclusionBuffer::GetDepth(U32 x, U32 y) const noexcept {
+		const auto& packet = m_depth[y * g_nb_packets_per_row + x / 4u];
+		return XMVectorGetByIndex(packet, x % 4u);
+	}
+}
\ No newline at end of file
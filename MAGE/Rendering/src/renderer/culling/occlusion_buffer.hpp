@@ -0,0 +1,219 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "geometry\bounding_volume.hpp"
+#include "collection\vector.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 A class of occlusion buffers.
+
+	 An occlusion buffer is a low resolution software depth buffer with a 
+	 hierarchical depth buffer of tiles. The depth buffer stores reciprocal 
+	 homogeneous w values (i.e. larger values are closer), which makes it 
+	 independent of the depth convention of the projection.
+	 */
+	class OcclusionBuffer final {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The width in pixels of the depth buffer of occlusion buffers.
+		 */
+		static constexpr U32 s_width = 256u;
+
+		/**
+		 The height in pixels of the depth buffer of occlusion buffers.
+		 */
+		static constexpr U32 s_height = 128u;
+
+		/**
+		 The width and height in pixels of the tiles of the hierarchical depth 
+		 buffer of occlusion buffers.
+		 */
+		static constexpr U32 s_tile_size = 8u;
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs an occlusion buffer.
+		 */
+		OcclusionBuffer();
+
+		/**
+		 Constructs an occlusion buffer from the given occlusion buffer.
+
+		 @param[in]		buffer
+						A reference to the occlusion buffer to copy.
+		 */
+		OcclusionBuffer(const OcclusionBuffer& buffer);
+
+		/**
+		 Constructs an occlusion buffer by moving the given occlusion buffer.
+
+		 @param[in]		buffer
+						A reference to the occlusion buffer to move.
+		 */
+		OcclusionBuffer(OcclusionBuffer&& buffer) noexcept;
+
+		/**
+		 Destructs this occlusion buffer.
+		 */
+		~OcclusionBuffer();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given occlusion buffer to this occlusion buffer.
+
+		 @param[in]		buffer
+						A reference to the occlusion buffer to copy.
+		 @return		A reference to the copy of the given occlusion buffer 
+						(i.e. this occlusion buffer).
+		 */
+		OcclusionBuffer& operator=(const OcclusionBuffer& buffer);
+
+		/**
+		 Moves the given occlusion buffer to this occlusion buffer.
+
+		 @param[in]		buffer
+						A reference to the occlusion buffer to move.
+		 @return		A reference to the moved occlusion buffer (i.e. this 
+						occlusion buffer).
+		 */
+		OcclusionBuffer& operator=(OcclusionBuffer&& buffer) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Clears the depth buffer of this occlusion buffer.
+		 */
+		void Clear() noexcept;
+
+		/**
+		 Rasterizes the given triangle. Both faces of the triangle are 
+		 rasterized. The triangle is clipped against the near plane of this 
+		 occlusion buffer.
+
+		 @param[in]		p0
+						The first vertex of the triangle expressed in 
+						homogeneous projection space.
+		 @param[in]		p1
+						The second vertex of the triangle expressed in 
+						homogeneous projection space.
+		 @param[in]		p2
+						The third vertex of the triangle expressed in 
+						homogeneous projection space.
+		 */
+		void XM_CALLCONV RasterizeTriangle(FXMVECTOR p0, 
+										   FXMVECTOR p1, 
+										   FXMVECTOR p2) noexcept;
+
+		/**
+		 Builds the hierarchical depth buffer of this occlusion buffer.
+		 */
+		void BuildHiZ() noexcept;
+
+		/**
+		 Checks whether the given axis-aligned bounding box is occluded.
+
+		 @pre			The hierarchical depth buffer of this occlusion buffer 
+						is built after the last rasterized triangle.
+		 @param[in]		object_to_projection
+						The object-to-projection transformation matrix.
+		 @param[in]		aabb
+						A reference to the axis-aligned bounding box expressed 
+						in object space.
+		 @return		@c true if the given axis-aligned bounding box is 
+						occluded. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool XM_CALLCONV IsOccluded(FXMMATRIX object_to_projection, 
+									const AABB& aabb) const noexcept;
+
+		/**
+		 Returns the depth (i.e. the reciprocal homogeneous w value) of the 
+		 given pixel of this occlusion buffer.
+
+		 @pre			@a x is smaller than @c s_width.
+		 @pre			@a y is smaller than @c s_height.
+		 @param[in]		x
+						The x coordinate of the pixel.
+		 @param[in]		y
+						The y coordinate of the pixel.
+		 @return		The depth of the given pixel of this occlusion buffer.
+		 */
+		[[nodiscard]]
+		F32 GetDepth(U32 x, U32 y) const noexcept;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Rasterizes the given triangle expressed in screen space.
+
+		 @param[in]		p0
+						The first vertex of the triangle (x and y in pixels, 
+						z the reciprocal homogeneous w).
+		 @param[in]		p1
+						The second vertex of the triangle (x and y in pixels, 
+						z the reciprocal homogeneous w).
+		 @param[in]		p2
+						The third vertex of the triangle (x and y in pixels, 
+						z the reciprocal homogeneous w).
+		 */
+		void XM_CALLCONV RasterizeScreenTriangle(FXMVECTOR p0, 
+												 FXMVECTOR p1, 
+												 FXMVECTOR p2) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A vector containing the depth buffer (i.e. the reciprocal homogeneous 
+		 w values) of this occlusion buffer in packets of four horizontally 
+		 adjacent pixels.
+		 */
+		AlignedVector< XMVECTOR > m_depth;
+
+		/**
+		 A vector containing the hierarchical depth buffer (i.e. the minimum 
+		 reciprocal homogeneous w value of each tile) of this occlusion 
+		 buffer.
+		 */
+		std::vector< F32 > m_hiz;
+	};
+}
\ No newline at end of file
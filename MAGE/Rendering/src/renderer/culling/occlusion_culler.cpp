@@ -0,0 +1,157 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\culling\occlusion_culler.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <limits>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	U32 OcclusionCuller::s_nb_occluders = 0u;
+
+	U32 OcclusionCuller::s_nb_tests = 0u;
+
+	U32 OcclusionCuller::s_nb_culled = 0u;
+
+	OcclusionCuller::OcclusionCuller()
+		: m_buffer(),
+		m_occluders() {
+
+		m_occluders.reserve(s_max_nb_occluders);
+	}
+
+	OcclusionCuller::OcclusionCuller(const OcclusionCuller& culler) = default;
+
+	OcclusionCuller::OcclusionCuller(OcclusionCuller&& culler) noexcept = default;
+
+	OcclusionCuller::~OcclusionCuller() = default;
+
+	OcclusionCuller& OcclusionCuller
+		::operator=(const OcclusionCuller& culler) = default;
+
+	OcclusionCuller& OcclusionCuller
+		::operator=(OcclusionCuller&& culler) noexcept = default;
+
+	void XM_CALLCONV OcclusionCuller::Cull(const World& world, 
+										   FXMMATRIX world_to_projection) {
+		m_buffer.Clear();
+		m_occluders.clear();
+
+		// Collect the occluders intersecting the view frustum and prioritize 
+		// them by their projected size.
+		world.ForEach< Model >([this, world_to_projection](const Model& model) {
+			if (State::Active != model.GetState()
+				|| model.IsOccluded()
+				|| !model.OccludesGeometry()
+				|| model.GetMaterial().IsTransparant()) {
+				return;
+			}
+
+			const auto& transform            = model.GetOwner()->GetTransform();
+			const auto  object_to_world      = transform.GetObjectToWorldMatrix();
+			const auto  object_to_projection = object_to_world * world_to_projection;
+
+			if (BoundingFrustum::Cull(object_to_projection, model.GetAABB())) {
+				return;
+			}
+
+			const auto& sphere = model.GetBoundingSphere();
+			const auto  scale  = std::max({
+				XMVectorGetX(XMVector3Length(object_to_world.r[0])),
+				XMVectorGetX(XMVector3Length(object_to_world.r[1])),
+				XMVectorGetX(XMVector3Length(object_to_world.r[2])) });
+			const auto  radius = sphere.Radius() * scale;
+			const auto  w      = XMVectorGetW(XMVector3Transform(
+				sphere.Centroid(), object_to_projection));
+
+			const auto priority = (w <= radius) 
+				? std::numeric_limits< F32 >::infinity() : radius / w;
+			m_occluders.emplace_back(priority, &model);
+		});
+
+		if (m_occluders.empty()) {
+			return;
+		}
+
+		// Rasterize the largest occluders within the triangle budget.
+		std::stable_sort(m_occluders.begin(), m_occluders.end(), 
+			[](const auto& lhs, const auto& rhs) noexcept {
+				return lhs.first > rhs.first;
+			});
+
+		size_t nb_occluders = 0u;
+		size_t nb_triangles = 0u;
+		for (const auto& [priority, occluder] : m_occluders) {
+			if (s_max_nb_occluders          <= nb_occluders
+				|| s_max_nb_occluder_triangles <= nb_triangles) {
+				break;
+			}
+
+			const auto& transform            = occluder->GetOwner()->GetTransform();
+			const auto  object_to_projection = transform.GetObjectToWorldMatrix() 
+				                             * world_to_projection;
+
+			nb_triangles += RasterizeOccluder(*occluder, object_to_projection);
+			++nb_occluders;
+		}
+
+		s_nb_occluders += static_cast< U32 >(nb_occluders);
+
+		m_buffer.BuildHiZ();
+
+		// Test the models against the hierarchical depth buffer.
+		world.ForEach< Model >([this, world_to_projection](const Model& model) {
+			if (State::Active != model.GetState() || model.IsOccluded()) {
+				return;
+			}
+
+			const auto& transform            = model.GetOwner()->GetTransform();
+			const auto  object_to_projection = transform.GetObjectToWorldMatrix() 
+				                             * world_to_projection;
+
+			++s_nb_tests;
+			if (m_buffer.IsOccluded(object_to_projection, model.GetAABB())) {
+				model.SetOccluded(true);
+				++s_nb_culled;
+			}
+		});
+	}
+
+	void OcclusionCuller::Reset(const World& world) noexcept {
+		world.ForEach< Model >([](const Model& model) noexcept {
+			model.SetOccluded(false);
+		});
+	}
+
+	size_t XM_CALLCONV OcclusionCuller::RasterizeOccluder(
+		const Model& model, FXMMATRIX object_to_projection) {
+
+		const auto& triangles = model.GetOccluderTriangles();
+		for (size_t i = 0u; i + 2u < triangles.size(); i += 3u) {
+			const auto p0 = XMVector3Transform(XMLoad(triangles[i]), 
+											   object_to_projection);
+			const auto p1 = XMVector3Transform(XMLoad(triangles[i + 1u]), 
+											   object_to_projection);
+			const auto p2 = XMVector3Transform(XMLoad(triangles[i + 2u]), 
+											   object_to_projection);
+			m_buffer.RasterizeTriangle(p0, p1, p2);
+		}
+
+		return triangles.size() / 3u;
+	}
+}
\ No newline at end of file
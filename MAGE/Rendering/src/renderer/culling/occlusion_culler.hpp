@@ -0,0 +1,185 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\culling\occlusion_buffer.hpp"
+#include "scene\rendering_world.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <utility>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 A class of occlusion cullers.
+
+	 An occlusion culler rasterizes the (coarsest level of detail of the) 
+	 triangles of the largest opaque occluders of a world into an occlusion 
+	 buffer, and marks each model whose projected axis-aligned bounding box 
+	 lies completely behind that occlusion buffer as occluded.
+	 */
+	class OcclusionCuller final {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The maximum number of occluders rasterized per frame.
+		 */
+		static constexpr size_t s_max_nb_occluders = 64u;
+
+		/**
+		 The maximum number of occluder triangles rasterized per frame.
+		 */
+		static constexpr size_t s_max_nb_occluder_triangles = 32768u;
+
+		/**
+		 The number of rasterized occluders.
+		 */
+		static U32 s_nb_occluders;
+
+		/**
+		 The number of occlusion tests.
+		 */
+		static U32 s_nb_tests;
+
+		/**
+		 The number of occlusion tests that culled a model.
+		 */
+		static U32 s_nb_culled;
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs an occlusion culler.
+		 */
+		OcclusionCuller();
+
+		/**
+		 Constructs an occlusion culler from the given occlusion culler.
+
+		 @param[in]		culler
+						A reference to the occlusion culler to copy.
+		 */
+		OcclusionCuller(const OcclusionCuller& culler);
+
+		/**
+		 Constructs an occlusion culler by moving the given occlusion culler.
+
+		 @param[in]		culler
+						A reference to the occlusion culler to move.
+		 */
+		OcclusionCuller(OcclusionCuller&& culler) noexcept;
+
+		/**
+		 Destructs this occlusion culler.
+		 */
+		~OcclusionCuller();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given occlusion culler to this occlusion culler.
+
+		 @param[in]		culler
+						A reference to the occlusion culler to copy.
+		 @return		A reference to the copy of the given occlusion culler 
+						(i.e. this occlusion culler).
+		 */
+		OcclusionCuller& operator=(const OcclusionCuller& culler);
+
+		/**
+		 Moves the given occlusion culler to this occlusion culler.
+
+		 @param[in]		culler
+						A reference to the occlusion culler to move.
+		 @return		A reference to the moved occlusion culler (i.e. this 
+						occlusion culler).
+		 */
+		OcclusionCuller& operator=(OcclusionCuller&& culler) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Culls the models of the given world against the occluders of the 
+		 given world.
+
+		 Models which are already marked as occluded are neither used as 
+		 occluders nor tested.
+
+		 @pre			The given world-to-projection transformation matrix 
+						corresponds to a perspective projection.
+		 @param[in]		world
+						A reference to the world.
+		 @param[in]		world_to_projection
+						The world-to-projection transformation matrix.
+		 */
+		void XM_CALLCONV Cull(const World& world, FXMMATRIX world_to_projection);
+
+		/**
+		 Resets the occlusion state of the models of the given world.
+
+		 @param[in]		world
+						A reference to the world.
+		 */
+		static void Reset(const World& world) noexcept;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Rasterizes the occluder triangles of the given model.
+
+		 @param[in]		model
+						A reference to the model.
+		 @param[in]		object_to_projection
+						The object-to-projection transformation matrix of the 
+						given model.
+		 @return		The number of rasterized triangles.
+		 */
+		size_t XM_CALLCONV RasterizeOccluder(const Model& model, 
+											 FXMMATRIX object_to_projection);
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The occlusion buffer of this occlusion culler.
+		 */
+		OcclusionBuffer m_buffer;
+
+		/**
+		 A vector containing the candidate occluders (and their priorities) 
+		 of this occlusion culler.
+		 */
+		std::vector< std::pair< F32, const Model* > > m_occluders;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,187 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\culling\pvs.hpp"
+#include "exception\exception.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <iterator>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	const std::vector< U8 > PotentiallyVisibleSet
+		::Compress(const std::vector< U8 >& bitset) {
+
+		std::vector< U8 > compressed;
+		compressed.reserve(bitset.size() / 4u);
+
+		for (size_t i = 0u; i < bitset.size();) {
+			const auto value = bitset[i];
+			if (0x00u != value && 0xFFu != value) {
+				compressed.push_back(value);
+				++i;
+				continue;
+			}
+
+			size_t length = 1u;
+			while (i + length < bitset.size() 
+				   && value == bitset[i + length] 
+				   && length < 0xFFu) {
+				++length;
+			}
+
+			compressed.push_back(value);
+			compressed.push_back(static_cast< U8 >(length));
+			i += length;
+		}
+
+		return compressed;
+	}
+
+	void PotentiallyVisibleSet::Decompress(const U8* begin, 
+										   const U8* end, 
+										   std::vector< U8 >& bitset) {
+		bitset.clear();
+
+		for (auto it = begin; it != end; ++it) {
+			const auto value = *it;
+			if ((0x00u == value || 0xFFu == value) && std::next(it) != end) {
+				bitset.insert(bitset.end(), *(++it), value);
+			}
+			else {
+				bitset.push_back(value);
+			}
+		}
+	}
+
+	PotentiallyVisibleSet::PotentiallyVisibleSet() noexcept
+		: m_minimum(), 
+		m_maximum(), 
+		m_resolution(), 
+		m_nb_models(0u), 
+		m_offsets(), 
+		m_data(), 
+		m_cached_cell(s_no_cell), 
+		m_cached_bitset() {}
+
+	PotentiallyVisibleSet::PotentiallyVisibleSet(
+		const AABB& bounds, 
+		const U32x3& resolution, 
+		U32 nb_models, 
+		const std::vector< std::vector< U8 > >& bitsets)
+		: PotentiallyVisibleSet() {
+
+		m_minimum    = XMStore< F32x3 >(bounds.MinPoint());
+		m_maximum    = XMStore< F32x3 >(bounds.MaxPoint());
+		m_resolution = resolution;
+		m_nb_models  = nb_models;
+
+		ThrowIfFailed(bitsets.size() == static_cast< size_t >(resolution[0]) 
+					                  * resolution[1] * resolution[2], 
+					  "PVS: invalid number of cells.");
+
+		m_offsets.reserve(bitsets.size() + 1u);
+		for (const auto& bitset : bitsets) {
+			m_offsets.push_back(static_cast< U32 >(m_data.size()));
+			const auto compressed = Compress(bitset);
+			m_data.insert(m_data.end(), compressed.cbegin(), compressed.cend());
+		}
+		m_offsets.push_back(static_cast< U32 >(m_data.size()));
+	}
+
+	PotentiallyVisibleSet::PotentiallyVisibleSet(const AABB& bounds, 
+												 const U32x3& resolution, 
+												 U32 nb_models, 
+												 std::vector< U32 > offsets, 
+												 std::vector< U8 > data)
+		: PotentiallyVisibleSet() {
+
+		m_minimum    = XMStore< F32x3 >(bounds.MinPoint());
+		m_maximum    = XMStore< F32x3 >(bounds.MaxPoint());
+		m_resolution = resolution;
+		m_nb_models  = nb_models;
+		m_offsets    = std::move(offsets);
+		m_data       = std::move(data);
+
+		ThrowIfFailed(m_offsets.size() == static_cast< size_t >(resolution[0]) 
+					                    * resolution[1] * resolution[2] + 1u, 
+					  "PVS: invalid number of cells.");
+		ThrowIfFailed(std::is_sorted(m_offsets.cbegin(), m_offsets.cend()) 
+					  && m_data.size() == m_offsets.back(), 
+					  "PVS: invalid cell offsets.");
+	}
+
+	PotentiallyVisibleSet::PotentiallyVisibleSet(
+		const PotentiallyVisibleSet& pvs) = default;
+
+	PotentiallyVisibleSet::PotentiallyVisibleSet(
+		PotentiallyVisibleSet&& pvs) noexcept = default;
+
+	PotentiallyVisibleSet::~PotentiallyVisibleSet() = default;
+
+	PotentiallyVisibleSet& PotentiallyVisibleSet
+		::operator=(const PotentiallyVisibleSet& pvs) = default;
+
+	PotentiallyVisibleSet& PotentiallyVisibleSet
+		::operator=(PotentiallyVisibleSet&& pvs) noexcept = default;
+
+	size_t XM_CALLCONV PotentiallyVisibleSet
+		::GetCell(FXMVECTOR position) const noexcept {
+
+		if (empty()) {
+			return s_no_cell;
+		}
+
+		const auto p_min      = XMLoad(m_minimum);
+		const auto p_max      = XMLoad(m_maximum);
+		const auto resolution = XMVectorSet(static_cast< F32 >(m_resolution[0]), 
+											static_cast< F32 >(m_resolution[1]), 
+											static_cast< F32 >(m_resolution[2]), 
+											1.0f);
+		const auto uvw  = XMVectorDivide(position - p_min, p_max - p_min);
+		const auto cell = XMStore< F32x3 >(XMVectorFloor(uvw * resolution));
+
+		size_t index[3];
+		for (size_t i = 0u; i < 3u; ++i) {
+			if (cell[i] < 0.0f || static_cast< F32 >(m_resolution[i]) <= cell[i]) {
+				return s_no_cell;
+			}
+			index[i] = static_cast< size_t >(cell[i]);
+		}
+
+		return index[0] + m_resolution[0] * (index[1] + m_resolution[1] * index[2]);
+	}
+
+	bool PotentiallyVisibleSet::IsVisible(size_t cell, size_t model) const {
+		if (s_no_cell == cell 
+			|| m_offsets.size() <= cell + 1u 
+			|| m_nb_models <= model) {
+			return true;
+		}
+
+		if (m_cached_cell != cell) {
+			Decompress(m_data.data() + m_offsets[cell], 
+					   m_data.data() + m_offsets[cell + 1u], 
+					   m_cached_bitset);
+			m_cached_cell = cell;
+		}
+
+		const auto byte = model >> 3u;
+		return (m_cached_bitset.size() <= byte) 
+			|| (0u != (m_cached_bitset[byte] & (1u << (model & 7u))));
+	}
+}
\ No newline at end of file
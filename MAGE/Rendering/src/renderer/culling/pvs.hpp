@@ -0,0 +1,337 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "geometry\bounding_volume.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <limits>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 A class of potentially visible sets (PVSs).
+
+	 A potentially visible set partitions the bounds of the static models of a 
+	 world into a regular grid of cells, and stores for each cell a 
+	 (run-length) compressed bitset containing the models that may be visible 
+	 from that cell. Models are identified by their PVS index (see 
+	 Model::GetPVSIndex).
+	 */
+	class PotentiallyVisibleSet final {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The cell index of positions outside the bounds of potentially visible 
+		 sets.
+		 */
+		static constexpr size_t s_no_cell = std::numeric_limits< size_t >::max();
+
+		//---------------------------------------------------------------------
+		// Class Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Compresses the given bitset.
+
+		 Runs of @c 0x00 and @c 0xFF bytes are encoded as the byte value 
+		 followed by the length of the run (at most 255). All other bytes are 
+		 stored as is.
+
+		 @param[in]		bitset
+						A reference to a vector containing the bitset.
+		 @return		A vector containing the compressed bitset.
+		 */
+		[[nodiscard]]
+		static const std::vector< U8 > Compress(const std::vector< U8 >& bitset);
+
+		/**
+		 Decompresses the given compressed bitset.
+
+		 @param[in]		begin
+						A pointer to the first byte of the compressed bitset.
+		 @param[in]		end
+						A pointer past the last byte of the compressed bitset.
+		 @param[out]	bitset
+						A reference to a vector for storing the bitset.
+		 */
+		static void Decompress(const U8* begin, 
+							   const U8* end, 
+							   std::vector< U8 >& bitset);
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs an (empty) potentially visible set.
+		 */
+		PotentiallyVisibleSet() noexcept;
+
+		/**
+		 Constructs a potentially visible set.
+
+		 @param[in]		bounds
+						A reference to the bounds of the grid of cells.
+		 @param[in]		resolution
+						The number of cells along each axis.
+		 @param[in]		nb_models
+						The number of models.
+		 @param[in]		bitsets
+						A reference to a vector containing the (uncompressed) 
+						bitsets of the potentially visible models of all 
+						cells.
+		 */
+		explicit PotentiallyVisibleSet(const AABB& bounds, 
+									   const U32x3& resolution, 
+									   U32 nb_models, 
+									   const std::vector< std::vector< U8 > >& bitsets);
+
+		/**
+		 Constructs a potentially visible set.
+
+		 @param[in]		bounds
+						A reference to the bounds of the grid of cells.
+		 @param[in]		resolution
+						The number of cells along each axis.
+		 @param[in]		nb_models
+						The number of models.
+		 @param[in]		offsets
+						A vector containing the offsets of the compressed 
+						bitsets of all cells in the given data (followed by 
+						the size of the given data).
+		 @param[in]		data
+						A vector containing the compressed bitsets of all 
+						cells.
+		 */
+		explicit PotentiallyVisibleSet(const AABB& bounds, 
+									   const U32x3& resolution, 
+									   U32 nb_models, 
+									   std::vector< U32 > offsets, 
+									   std::vector< U8 > data);
+
+		/**
+		 Constructs a potentially visible set from the given potentially 
+		 visible set.
+
+		 @param[in]		pvs
+						A reference to the potentially visible set to copy.
+		 */
+		PotentiallyVisibleSet(const PotentiallyVisibleSet& pvs);
+
+		/**
+		 Constructs a potentially visible set by moving the given potentially 
+		 visible set.
+
+		 @param[in]		pvs
+						A reference to the potentially visible set to move.
+		 */
+		PotentiallyVisibleSet(PotentiallyVisibleSet&& pvs) noexcept;
+
+		/**
+		 Destructs this potentially visible set.
+		 */
+		~PotentiallyVisibleSet();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given potentially visible set to this potentially visible 
+		 set.
+
+		 @param[in]		pvs
+						A reference to the potentially visible set to copy.
+		 @return		A reference to the copy of the given potentially 
+						visible set (i.e. this potentially visible set).
+		 */
+		PotentiallyVisibleSet& operator=(const PotentiallyVisibleSet& pvs);
+
+		/**
+		 Moves the given potentially visible set to this potentially visible 
+		 set.
+
+		 @param[in]		pvs
+						A reference to the potentially visible set to move.
+		 @return		A reference to the moved potentially visible set (i.e. 
+						this potentially visible set).
+		 */
+		PotentiallyVisibleSet& operator=(PotentiallyVisibleSet&& pvs) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Checks whether this potentially visible set is empty.
+
+		 @return		@c true if this potentially visible set contains no 
+						cells. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool empty() const noexcept {
+			return m_offsets.size() <= 1u;
+		}
+
+		/**
+		 Returns the bounds of the grid of cells of this potentially visible 
+		 set.
+
+		 @return		The bounds of the grid of cells of this potentially 
+						visible set.
+		 */
+		[[nodiscard]]
+		const AABB GetBounds() const noexcept {
+			return AABB(Point3(m_minimum), Point3(m_maximum));
+		}
+
+		/**
+		 Returns the number of cells along each axis of this potentially 
+		 visible set.
+
+		 @return		The number of cells along each axis of this 
+						potentially visible set.
+		 */
+		[[nodiscard]]
+		const U32x3& GetResolution() const noexcept {
+			return m_resolution;
+		}
+
+		/**
+		 Returns the number of models of this potentially visible set.
+
+		 @return		The number of models of this potentially visible set.
+		 */
+		[[nodiscard]]
+		U32 GetNumberOfModels() const noexcept {
+			return m_nb_models;
+		}
+
+		/**
+		 Returns the offsets of the compressed bitsets of this potentially 
+		 visible set.
+
+		 @return		A reference to a vector containing the offsets of the 
+						compressed bitsets of all cells (followed by the size 
+						of the compressed data) of this potentially visible 
+						set.
+		 */
+		[[nodiscard]]
+		const std::vector< U32 >& GetOffsets() const noexcept {
+			return m_offsets;
+		}
+
+		/**
+		 Returns the compressed bitsets of this potentially visible set.
+
+		 @return		A reference to a vector containing the compressed 
+						bitsets of all cells of this potentially visible set.
+		 */
+		[[nodiscard]]
+		const std::vector< U8 >& GetData() const noexcept {
+			return m_data;
+		}
+
+		/**
+		 Returns the index of the cell containing the given position.
+
+		 @param[in]		position
+						The position expressed in world space.
+		 @return		The index of the cell containing the given position, 
+						or @c s_no_cell if the given position lies outside 
+						the bounds of this potentially visible set.
+		 */
+		[[nodiscard]]
+		size_t XM_CALLCONV GetCell(FXMVECTOR position) const noexcept;
+
+		/**
+		 Checks whether the given model is potentially visible from the given 
+		 cell.
+
+		 @param[in]		cell
+						The index of the cell.
+		 @param[in]		model
+						The index of the model.
+		 @return		@c true if the given model is potentially visible 
+						from the given cell, or the given cell or model is 
+						not covered by this potentially visible set. 
+						@c false otherwise.
+		 */
+		[[nodiscard]]
+		bool IsVisible(size_t cell, size_t model) const;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The minimum point of the bounds of the grid of cells of this 
+		 potentially visible set.
+		 */
+		F32x3 m_minimum;
+
+		/**
+		 The maximum point of the bounds of the grid of cells of this 
+		 potentially visible set.
+		 */
+		F32x3 m_maximum;
+
+		/**
+		 The number of cells along each axis of this potentially visible set.
+		 */
+		U32x3 m_resolution;
+
+		/**
+		 The number of models of this potentially visible set.
+		 */
+		U32 m_nb_models;
+
+		/**
+		 A vector containing the offsets of the compressed bitsets of all 
+		 cells (followed by the size of the compressed data) of this 
+		 potentially visible set.
+		 */
+		std::vector< U32 > m_offsets;
+
+		/**
+		 A vector containing the compressed bitsets of all cells of this 
+		 potentially visible set.
+		 */
+		std::vector< U8 > m_data;
+
+		/**
+		 The index of the cell of the decompressed bitset of this potentially 
+		 visible set.
+		 */
+		mutable size_t m_cached_cell;
+
+		/**
+		 A vector containing the decompressed bitset of the most recently 
+		 queried cell of this potentially visible set.
+		 */
+		mutable std::vector< U8 > m_cached_bitset;
+	};
+}
\ No newline at end of file
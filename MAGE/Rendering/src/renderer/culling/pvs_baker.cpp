@@ -0,0 +1,267 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\culling\pvs_baker.hpp"
+#include "geometry\triangle_bvh.hpp"
+#include "parallel\parallel.hpp"
+#include "sampling\qmc.hpp"
+#include "collection\vector.hpp"
+#include "exception\exception.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cmath>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	namespace {
+
+		/**
+		 A struct of PVS models containing the baking data of a model.
+		 */
+		struct PVSModel final {
+
+		public:
+
+			//-----------------------------------------------------------------
+			// Member Variables
+			//-----------------------------------------------------------------
+
+			/**
+			 The minimum point of the world space AABB of this PVS model.
+			 */
+			F32x3 m_minimum = {};
+
+			/**
+			 The maximum point of the world space AABB of this PVS model.
+			 */
+			F32x3 m_maximum = {};
+
+			/**
+			 A vector containing the world space ray targets of this PVS 
+			 model.
+			 */
+			std::vector< F32x3 > m_targets;
+		};
+
+		/**
+		 Samples the given number of ray targets on the given triangles.
+
+		 The targets are distributed over the triangles proportional to their 
+		 areas, using a low-discrepancy sequence for the positions within the 
+		 triangles.
+
+		 @param[in]		vertices
+						A reference to a vector containing three consecutive 
+						vertex positions per triangle.
+		 @param[in]		begin
+						The index of the first vertex.
+		 @param[in]		end
+						The index past the last vertex.
+		 @param[in]		nb_samples
+						The number of samples.
+		 @return		A vector containing the ray targets.
+		 */
+		[[nodiscard]]
+		const std::vector< F32x3 > SampleTargets(const std::vector< F32x3 >& vertices, 
+												 size_t begin, 
+												 size_t end, 
+												 size_t nb_samples) {
+			std::vector< F32 > cdf;
+			cdf.reserve((end - begin) / 3u);
+
+			F32 total_area = 0.0f;
+			for (auto i = begin; i + 2u < end; i += 3u) {
+				const auto p0 = XMLoad(vertices[i]);
+				const auto e1 = XMLoad(vertices[i + 1u]) - p0;
+				const auto e2 = XMLoad(vertices[i + 2u]) - p0;
+				total_area += XMVectorGetX(XMVector3Length(XMVector3Cross(e1, e2)));
+				cdf.push_back(total_area);
+			}
+
+			std::vector< F32x3 > targets;
+			if (cdf.empty() || 0.0f >= total_area) {
+				return targets;
+			}
+
+			targets.reserve(nb_samples);
+			for (size_t k = 0u; k < nb_samples; ++k) {
+				const auto u = (static_cast< F32 >(k) + 0.5f) 
+					         / static_cast< F32 >(nb_samples) * total_area;
+				const auto t = std::min(static_cast< size_t >(
+					std::upper_bound(cdf.cbegin(), cdf.cend(), u) - cdf.cbegin()), 
+					cdf.size() - 1u);
+
+				auto uv = Halton2D(k + 1u);
+				if (1.0f < uv[0] + uv[1]) {
+					uv = { 1.0f - uv[0], 1.0f - uv[1] };
+				}
+
+				const auto p0 = XMLoad(vertices[begin + 3u * t]);
+				const auto e1 = XMLoad(vertices[begin + 3u * t + 1u]) - p0;
+				const auto e2 = XMLoad(vertices[begin + 3u * t + 2u]) - p0;
+				targets.push_back(XMStore< F32x3 >(p0 + uv[0] * e1 + uv[1] * e2));
+			}
+
+			return targets;
+		}
+	}
+
+	const PotentiallyVisibleSet BakePVS(const World& world, 
+										const PVSDescriptor& desc) {
+
+		//---------------------------------------------------------------------
+		// Collect the world space triangles of all static models.
+		//---------------------------------------------------------------------
+		std::vector< PVSModel > models(world.GetNumberOfStaticModels());
+		std::vector< F32x3 > vertices;
+		std::vector< U32 > triangle_to_model;
+		AABB bounds;
+
+		world.ForEach< Model >([&](const Model& model) {
+			// Dynamic models are never culled by the potentially visible set 
+			// and do not occlude static models.
+			if (State::Terminated == model.GetState() || !model.IsStatic()) {
+				return;
+			}
+
+			const auto  index           = model.GetPVSIndex();
+			const auto& transform       = model.GetOwner()->GetTransform();
+			const auto  object_to_world = transform.GetObjectToWorldMatrix();
+			const auto  triangles       = model.GetTriangles();
+			const auto  begin           = vertices.size();
+
+			AABB aabb;
+			for (const auto& p : triangles) {
+				const auto p_world = XMVector3TransformCoord(XMLoad(p), 
+															 object_to_world);
+				vertices.push_back(XMStore< F32x3 >(p_world));
+				aabb = AABB::Union(aabb, AABB(p_world));
+			}
+			triangle_to_model.insert(triangle_to_model.end(), 
+									 triangles.size() / 3u, index);
+
+			auto& pvs_model = models[index];
+			pvs_model.m_minimum = XMStore< F32x3 >(aabb.MinPoint());
+			pvs_model.m_maximum = XMStore< F32x3 >(aabb.MaxPoint());
+			pvs_model.m_targets = SampleTargets(vertices, begin, vertices.size(), 
+												desc.GetNumberOfModelSamples());
+
+			if (!triangles.empty()) {
+				bounds = AABB::Union(bounds, aabb);
+			}
+		});
+
+		ThrowIfFailed(!vertices.empty(), 
+					  "PVS: the world contains no static triangles with a CPU copy.");
+
+		//---------------------------------------------------------------------
+		// Set up the grid of cells.
+		//---------------------------------------------------------------------
+		const auto margin = XMVectorReplicate(0.01f);
+		bounds = AABB(bounds.MinPoint() - margin, bounds.MaxPoint() + margin);
+
+		const auto extent = XMStore< F32x3 >(bounds.Diagonal());
+		U32x3 resolution;
+		F32x3 cell_size;
+		for (size_t i = 0u; i < 3u; ++i) {
+			resolution[i] = std::clamp(static_cast< U32 >(
+				std::ceil(extent[i] / desc.GetCellSize())), 
+				1u, desc.GetMaximumNumberOfCells());
+			cell_size[i]  = extent[i] / static_cast< F32 >(resolution[i]);
+		}
+		const auto nb_cells = static_cast< size_t >(resolution[0]) 
+			                * resolution[1] * resolution[2];
+
+		const TriangleBVH bvh(std::move(vertices));
+		
+		//---------------------------------------------------------------------
+		// Bake the potentially visible models of each cell.
+		//---------------------------------------------------------------------
+		const auto nb_models      = models.size();
+		const auto bitset_size    = (nb_models + 7u) / 8u;
+		const auto nb_samples     = desc.GetNumberOfCellSamples();
+		const auto bounds_min     = bounds.MinPoint();
+		std::vector< std::vector< U8 > > bitsets(nb_cells);
+
+		ParallelFor(0u, nb_cells, [&](size_t cell) {
+			const auto x = cell % resolution[0];
+			const auto y = (cell / resolution[0]) % resolution[1];
+			const auto z = cell / (static_cast< size_t >(resolution[0]) * resolution[1]);
+
+			const auto cell_extent = XMLoad(cell_size);
+			const auto cell_min    = bounds_min + XMVectorSet(
+				static_cast< F32 >(x), static_cast< F32 >(y), 
+				static_cast< F32 >(z), 0.0f) * cell_extent;
+			const AABB cell_aabb(cell_min, cell_min + cell_extent);
+
+			auto& bitset = bitsets[cell];
+			bitset.assign(bitset_size, 0u);
+			const auto set_visible = [&bitset](size_t model) noexcept {
+				bitset[model >> 3u] |= static_cast< U8 >(1u << (model & 7u));
+			};
+			const auto is_visible = [&bitset](size_t model) noexcept {
+				return 0u != (bitset[model >> 3u] & (1u << (model & 7u)));
+			};
+
+			// Sample the ray origins inside the cell.
+			AlignedVector< XMVECTOR > origins(nb_samples);
+			for (U32 k = 0u; k < nb_samples; ++k) {
+				origins[k] = cell_min + XMLoad(Halton3D(k + 1u)) * cell_extent;
+			}
+
+			for (size_t m = 0u; m < nb_models; ++m) {
+				if (is_visible(m)) {
+					continue;
+				}
+
+				const auto& model = models[m];
+				const AABB model_aabb(XMLoad(model.m_minimum), 
+									  XMLoad(model.m_maximum));
+				if (model.m_targets.empty() || cell_aabb.Overlaps(model_aabb)) {
+					set_visible(m);
+					continue;
+				}
+
+				for (const auto& origin : origins) {
+					for (const auto& target : model.m_targets) {
+						const auto direction = XMLoad(target) - origin;
+						
+						TriangleBVH::Hit hit;
+						if (!bvh.Intersect(origin, direction, 1.001f, hit)) {
+							set_visible(m);
+							break;
+						}
+
+						// The first model hit by the ray is visible.
+						const auto hit_model = triangle_to_model[hit.m_triangle];
+						set_visible(hit_model);
+						if (m == hit_model) {
+							break;
+						}
+					}
+
+					if (is_visible(m)) {
+						break;
+					}
+				}
+			}
+		});
+
+		return PotentiallyVisibleSet(bounds, resolution, 
+									 static_cast< U32 >(nb_models), bitsets);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,48 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\culling\pvs.hpp"
+#include "renderer\culling\pvs_descriptor.hpp"
+#include "scene\rendering_world.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 Bakes the potentially visible set of the given world.
+
+	 Only the (non-terminated) static models of the given world are baked 
+	 (see World::MakeStatic), and each model is identified by its PVS index. 
+	 The bounds of these models are partitioned into a regular grid of cells. 
+	 For each cell, rays are cast from stratified sample points inside the 
+	 cell towards area-weighted sample points on the triangles of each model, 
+	 against a bounding volume hierarchy of all static triangles. A model is 
+	 potentially visible from a cell if one of these rays hits the model 
+	 first, or if the model overlaps the cell. Models whose meshes have no 
+	 CPU copy are always potentially visible. Dynamic models neither occlude 
+	 nor are culled.
+
+	 The cells are baked in parallel, and all samples only depend on the cell 
+	 and model indices, so the result is deterministic.
+
+	 @param[in]		world
+					A reference to the world.
+	 @param[in]		desc
+					A reference to the PVS descriptor.
+	 @return		The potentially visible set of the given world.
+	 @throws		Exception
+					Failed to bake the potentially visible set.
+	 */
+	[[nodiscard]]
+	const PotentiallyVisibleSet BakePVS(const World& world, 
+										const PVSDescriptor& desc 
+										= PVSDescriptor());
+}
\ No newline at end of file
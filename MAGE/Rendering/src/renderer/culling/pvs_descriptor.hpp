@@ -0,0 +1,183 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "type\scalar_types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 A class of PVS descriptors describing how the potentially visible set of 
+	 a world must be baked.
+	 */
+	class PVSDescriptor final {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a PVS descriptor.
+
+		 @param[in]		cell_size
+						The (world space) size of the cells.
+		 @param[in]		nb_cell_samples
+						The number of ray origins sampled per cell.
+		 @param[in]		nb_model_samples
+						The number of ray targets sampled per model.
+		 @param[in]		max_nb_cells
+						The maximum number of cells along each axis.
+		 */
+		constexpr explicit PVSDescriptor(F32 cell_size        = 4.0f, 
+										 U32 nb_cell_samples  = 8u, 
+										 U32 nb_model_samples = 16u, 
+										 U32 max_nb_cells     = 64u) noexcept
+			: m_cell_size(std::max(0.01f, cell_size)),
+			m_nb_cell_samples(std::max(1u, nb_cell_samples)),
+			m_nb_model_samples(std::max(1u, nb_model_samples)),
+			m_max_nb_cells(std::max(1u, max_nb_cells)) {}
+
+		/**
+		 Constructs a PVS descriptor from the given PVS descriptor.
+
+		 @param[in]		desc
+						A reference to the PVS descriptor to copy.
+		 */
+		constexpr PVSDescriptor(const PVSDescriptor& desc) noexcept = default;
+
+		/**
+		 Constructs a PVS descriptor by moving the given PVS descriptor.
+
+		 @param[in]		desc
+						A reference to the PVS descriptor to move.
+		 */
+		constexpr PVSDescriptor(PVSDescriptor&& desc) noexcept = default;
+
+		/**
+		 Destructs this PVS descriptor.
+		 */
+		~PVSDescriptor() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given PVS descriptor to this PVS descriptor.
+
+		 @param[in]		desc
+						A reference to the PVS descriptor to copy.
+		 @return		A reference to the copy of the given PVS descriptor 
+						(i.e. this PVS descriptor).
+		 */
+		constexpr PVSDescriptor& operator=(
+			const PVSDescriptor& desc) noexcept = default;
+
+		/**
+		 Moves the given PVS descriptor to this PVS descriptor.
+
+		 @param[in]		desc
+						A reference to the PVS descriptor to move.
+		 @return		A reference to the moved PVS descriptor (i.e. this PVS 
+						descriptor).
+		 */
+		constexpr PVSDescriptor& operator=(
+			PVSDescriptor&& desc) noexcept = default;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the (world space) size of the cells of this PVS descriptor.
+
+		 @return		The (world space) size of the cells of this PVS 
+						descriptor.
+		 */
+		[[nodiscard]]
+		constexpr F32 GetCellSize() const noexcept {
+			return m_cell_size;
+		}
+
+		/**
+		 Returns the number of ray origins sampled per cell of this PVS 
+		 descriptor.
+
+		 @return		The number of ray origins sampled per cell of this PVS 
+						descriptor.
+		 */
+		[[nodiscard]]
+		constexpr U32 GetNumberOfCellSamples() const noexcept {
+			return m_nb_cell_samples;
+		}
+
+		/**
+		 Returns the number of ray targets sampled per model of this PVS 
+		 descriptor.
+
+		 @return		The number of ray targets sampled per model of this 
+						PVS descriptor.
+		 */
+		[[nodiscard]]
+		constexpr U32 GetNumberOfModelSamples() const noexcept {
+			return m_nb_model_samples;
+		}
+
+		/**
+		 Returns the maximum number of cells along each axis of this PVS 
+		 descriptor.
+
+		 @return		The maximum number of cells along each axis of this 
+						PVS descriptor.
+		 */
+		[[nodiscard]]
+		constexpr U32 GetMaximumNumberOfCells() const noexcept {
+			return m_max_nb_cells;
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The (world space) size of the cells of this PVS descriptor.
+		 */
+		F32 m_cell_size;
+
+		/**
+		 The number of ray origins sampled per cell of this PVS descriptor.
+		 */
+		U32 m_nb_cell_samples;
+
+		/**
+		 The number of ray targets sampled per model of this PVS descriptor.
+		 */
+		U32 m_nb_model_samples;
+
+		/**
+		 The maximum number of cells along each axis of this PVS descriptor.
+		 */
+		U32 m_max_nb_cells;
+	};
+}
\ No newline at end of file
@@ -12,11 +12,68 @@
 
 #pragma endregion
 
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <iterator>
+
+#pragma endregion
+
 //-----------------------------------------------------------------------------
 // Engine Definitions
 //-----------------------------------------------------------------------------
 namespace mage::rendering {
 
+	namespace {
+
+		/**
+		 The handle of undeclared render graph passes.
+		 */
+		constexpr auto g_no_pass 
+			= static_cast< RenderGraph::PassHandle >(0xFFFFFFFFu);
+
+		/**
+		 The handle of undeclared render graph textures.
+		 */
+		constexpr auto g_no_texture
+			= static_cast< RenderGraph::TextureHandle >(0xFFFFFFFFu);
+
+		/**
+		 Returns the texture descriptor for the given resolution, format and 
+		 bind flags.
+
+		 @param[in]		resolution
+						A reference to the resolution (width, height, number 
+						of samples).
+		 @param[in]		format
+						The format.
+		 @param[in]		bind_flags
+						The bind flags.
+		 @param[in]		texel_size
+						The size in bytes of a sample.
+		 @return		The texture descriptor.
+		 */
+		[[nodiscard]]
+		const RenderGraph::TextureDescriptor 
+			GetTextureDescriptor(const U32x3& resolution, 
+								 DXGI_FORMAT format, 
+								 U32 bind_flags, 
+								 U32 texel_size) noexcept {
+
+			RenderGraph::TextureDescriptor desc;
+			desc.m_width      = resolution[0];
+			desc.m_height     = resolution[1];
+			desc.m_nb_samples = resolution[2];
+			desc.m_format     = static_cast< U32 >(format);
+			desc.m_bind_flags = bind_flags;
+			desc.m_texel_size = texel_size;
+			return desc;
+		}
+	}
+
 	OutputManager::OutputManager(ID3D11Device& device, 
 								 DisplayConfiguration& display_configuration, 
 								 SwapChain& swap_chain)
@@ -27,7 +84,13 @@ namespace mage::rendering {
 		m_rtvs{}, 
 		m_uavs{}, 
 		m_dsv(), 
+		m_graph(),
+		m_texture_handles{},
+		m_pass_handles{},
+		m_texture_pool(),
+		m_physical_textures(),
 		m_hdr0_to_hdr1(true), 
+		m_nb_ping_pongs(0u),
 		m_msaa(m_display_configuration.get().UsesMSAA()),
 		m_ssaa(m_display_configuration.get().UsesSSAA()) {
 
@@ -44,97 +107,352 @@ namespace mage::rendering {
 	void OutputManager::SetupBuffers() {
 		const auto display_resolution 
 			= m_display_configuration.get().GetDisplayResolution();
-		const auto ss_display_resolution
-			= m_display_configuration.get().GetSSDisplayResolution();
-		const auto nb_samples = GetSampleMultiplier(
-			m_display_configuration.get().GetAA());
 		
+		const U32x3 setup(display_resolution, 1u);
+
+		// Setup the LDR buffer. The LDR buffer is shared by all viewports 
+		// and persists until the end of the frame. All other buffers are 
+		// allocated per viewport from the render graph.
+		SetupBuffer(setup,
+					DXGI_FORMAT_R16G16B16A16_FLOAT,
+					ReleaseAndGetAddressOfSRV(SRVIndex::LDR),
+					ReleaseAndGetAddressOfRTV(RTVIndex::LDR),
+					ReleaseAndGetAddressOfUAV(UAVIndex::LDR));
+	}
+
+	void OutputManager::DeclareViewport(bool deferred, bool depth_of_field) {
+		const auto& config = m_display_configuration.get();
+		const auto display_resolution    = config.GetDisplayResolution();
+		const auto ss_display_resolution = config.GetSSDisplayResolution();
+		const auto nb_samples            = GetSampleMultiplier(config.GetAA());
+		const auto fxaa                  = AntiAliasing::FXAA == config.GetAA();
+
 		const U32x3 setup(display_resolution, 1u);
 		const U32x3 ss_setup(ss_display_resolution, nb_samples);
-		
-		// Setup the depth buffer.
-		SetupDepthBuffer(ss_setup);
-
-		// Setup the GBuffer buffers.
-		SetupBuffer(ss_setup,
-			        DXGI_FORMAT_R8G8B8A8_UNORM_SRGB,
-			        ReleaseAndGetAddressOfSRV(SRVIndex::GBuffer_BaseColor),
-			        ReleaseAndGetAddressOfRTV(RTVIndex::GBuffer_BaseColor),
-			        nullptr);
-		SetupBuffer(ss_setup,
-			        DXGI_FORMAT_R8G8B8A8_UNORM,
-			        ReleaseAndGetAddressOfSRV(SRVIndex::GBuffer_Material),
-			        ReleaseAndGetAddressOfRTV(RTVIndex::GBuffer_Material),
-			        nullptr);
-		SetupBuffer(ss_setup,
-					DXGI_FORMAT_R16G16_UNORM,
-			        ReleaseAndGetAddressOfSRV(SRVIndex::GBuffer_Normal),
-			        ReleaseAndGetAddressOfRTV(RTVIndex::GBuffer_Normal),
-			        nullptr);
-
-		// Setup the HDR buffer.
-		if (m_msaa) {
-			SetupBuffer(ss_setup,
-				        DXGI_FORMAT_R16G16B16A16_FLOAT,
-				        ReleaseAndGetAddressOfSRV(SRVIndex::HDR),
-				        ReleaseAndGetAddressOfRTV(RTVIndex::HDR),
-				        nullptr);
+
+		constexpr U32 srv_rtv     = D3D11_BIND_SHADER_RESOURCE 
+			                      | D3D11_BIND_RENDER_TARGET;
+		constexpr U32 srv_uav     = D3D11_BIND_SHADER_RESOURCE 
+			                      | D3D11_BIND_UNORDERED_ACCESS;
+		constexpr U32 srv_rtv_uav = srv_rtv | D3D11_BIND_UNORDERED_ACCESS;
+
+		auto& graph    = m_graph;
+		auto& textures = m_texture_handles;
+		auto& passes   = m_pass_handles;
+		const auto texture = [&textures](TextureIndex index) noexcept 
+			-> RenderGraph::TextureHandle& {
+			return textures[static_cast< size_t >(index)];
+		};
+		const auto pass = [&passes](PassIndex index) noexcept 
+			-> RenderGraph::PassHandle& {
+			return passes[static_cast< size_t >(index)];
+		};
+
+		graph.Clear();
+		std::fill(std::begin(textures), std::end(textures), g_no_texture);
+		std::fill(std::begin(passes),   std::end(passes),   g_no_pass);
+
+		//---------------------------------------------------------------------
+		// Textures
+		//---------------------------------------------------------------------
+		const auto depth = texture(TextureIndex::Depth) 
+			= graph.CreateTexture(GetTextureDescriptor(ss_setup,
+				DXGI_FORMAT_R32_TYPELESS, 
+				D3D11_BIND_SHADER_RESOURCE | D3D11_BIND_DEPTH_STENCIL, 4u));
+		const auto base_color = texture(TextureIndex::GBuffer_BaseColor)
+			= graph.CreateTexture(GetTextureDescriptor(ss_setup, 
+				DXGI_FORMAT_R8G8B8A8_UNORM_SRGB, srv_rtv, 4u));
+		const auto material = texture(TextureIndex::GBuffer_Material)
+			= graph.CreateTexture(GetTextureDescriptor(ss_setup, 
+				DXGI_FORMAT_R8G8B8A8_UNORM, srv_rtv, 4u));
+		const auto normal = texture(TextureIndex::GBuffer_Normal)
+			= graph.CreateTexture(GetTextureDescriptor(ss_setup, 
+				DXGI_FORMAT_R16G16_UNORM, srv_rtv, 4u));
+		const auto hdr = texture(TextureIndex::HDR)
+			= graph.CreateTexture(GetTextureDescriptor(ss_setup, 
+				DXGI_FORMAT_R16G16B16A16_FLOAT, 
+				m_msaa ? srv_rtv : srv_rtv_uav, 8u));
+		const auto ldr = texture(TextureIndex::LDR) = graph.ImportTexture();
+
+		// The passes are declared in the fixed order in which the renderer
+		// executes them. Since all dependencies point to preceding passes and
+		// ties are broken by the declaration order, the compiled schedule
+		// equals this order: the render graph only drives the culling, the
+		// texture aliasing and the hazard unbinding, not the pass execution.
+
+		//---------------------------------------------------------------------
+		// GBuffer and Deferred
+		//---------------------------------------------------------------------
+		// These passes are culled unless the forward pass accumulates into 
+		// their output.
+		const auto gbuffer_pass = pass(PassIndex::GBuffer) = graph.AddPass();
+		graph.Write(gbuffer_pass, base_color);
+		graph.Write(gbuffer_pass, material);
+		graph.Write(gbuffer_pass, normal);
+		graph.Write(gbuffer_pass, depth);
+
+		const auto deferred_pass = pass(PassIndex::Deferred) = graph.AddPass();
+		graph.Read(deferred_pass, base_color);
+		graph.Read(deferred_pass, material);
+		graph.Read(deferred_pass, normal);
+		graph.Read(deferred_pass, depth);
+		graph.Write(deferred_pass, hdr);
+
+		//---------------------------------------------------------------------
+		// Forward
+		//---------------------------------------------------------------------
+		const auto forward_pass = pass(PassIndex::Forward) = graph.AddPass();
+		if (deferred) {
+			graph.Read(forward_pass, hdr);
+			graph.Read(forward_pass, normal);
+			graph.Read(forward_pass, depth);
+		}
+		graph.Write(forward_pass, hdr);
+		graph.Write(forward_pass, normal);
+		graph.Write(forward_pass, depth);
+
+		//---------------------------------------------------------------------
+		// Anti-aliasing
+		//---------------------------------------------------------------------
+		if (config.UsesAA()) {
+			const auto resolve_pass = pass(PassIndex::Resolve) = graph.AddPass();
+			graph.Read(resolve_pass, hdr);
+			graph.Read(resolve_pass, normal);
+			graph.Read(resolve_pass, depth);
+
+			texture(TextureIndex::PostProcessing_HDR0)
+				= graph.CreateTexture(GetTextureDescriptor(setup, 
+					DXGI_FORMAT_R16G16B16A16_FLOAT, srv_rtv_uav, 8u));
+			graph.Write(resolve_pass, texture(TextureIndex::PostProcessing_HDR0));
+
+			if (m_msaa || m_ssaa) {
+				texture(TextureIndex::PostProcessing_Normal)
+					= graph.CreateTexture(GetTextureDescriptor(setup, 
+						DXGI_FORMAT_R16G16_UNORM, srv_uav, 4u));
+				texture(TextureIndex::PostProcessing_Depth)
+					= graph.CreateTexture(GetTextureDescriptor(setup, 
+						DXGI_FORMAT_R32_FLOAT, srv_uav, 4u));
+				graph.Write(resolve_pass, texture(TextureIndex::PostProcessing_Normal));
+				graph.Write(resolve_pass, texture(TextureIndex::PostProcessing_Depth));
+			}
 		}
 		else {
-			SetupBuffer(ss_setup,
-				        DXGI_FORMAT_R16G16B16A16_FLOAT,
-				        ReleaseAndGetAddressOfSRV(SRVIndex::HDR),
-				        ReleaseAndGetAddressOfRTV(RTVIndex::HDR),
-				        ReleaseAndGetAddressOfUAV(UAVIndex::HDR));
+			texture(TextureIndex::PostProcessing_HDR0) = hdr;
 		}
-		
-		if (m_display_configuration.get().UsesAA()) {
-			SetupBuffer(setup,
-				        DXGI_FORMAT_R16G16B16A16_FLOAT,
-				        ReleaseAndGetAddressOfSRV(SRVIndex::PostProcessing_HDR0),
-				        ReleaseAndGetAddressOfRTV(RTVIndex::PostProcessing_HDR0),
-				        ReleaseAndGetAddressOfUAV(UAVIndex::PostProcessing_HDR0));
+
+		if (g_no_texture == texture(TextureIndex::PostProcessing_Normal)) {
+			texture(TextureIndex::PostProcessing_Normal) = normal;
+			texture(TextureIndex::PostProcessing_Depth)  = depth;
 		}
-		else {
-			m_srvs[static_cast< size_t >(SRVIndex::PostProcessing_HDR0)]
-				= m_srvs[static_cast< size_t >(SRVIndex::HDR)];
-			m_rtvs[static_cast< size_t >(RTVIndex::PostProcessing_HDR0)]
-				= m_rtvs[static_cast< size_t >(RTVIndex::HDR)];
-			m_uavs[static_cast< size_t >(UAVIndex::PostProcessing_HDR0)]
-				= m_uavs[static_cast< size_t >(UAVIndex::HDR)];
+
+		//---------------------------------------------------------------------
+		// Post-processing
+		//---------------------------------------------------------------------
+		if (fxaa || depth_of_field) {
+			texture(TextureIndex::PostProcessing_HDR1)
+				= graph.CreateTexture(GetTextureDescriptor(setup, 
+					DXGI_FORMAT_R16G16B16A16_FLOAT, srv_rtv_uav, 8u));
 		}
 
-		SetupBuffer(setup,
-			        DXGI_FORMAT_R16G16B16A16_FLOAT,
-			        ReleaseAndGetAddressOfSRV(SRVIndex::PostProcessing_HDR1),
-			        ReleaseAndGetAddressOfRTV(RTVIndex::PostProcessing_HDR1),
-			        ReleaseAndGetAddressOfUAV(UAVIndex::PostProcessing_HDR1));
-
-		if (m_msaa || m_ssaa) {
-			SetupBuffer(setup,
-				        DXGI_FORMAT_R32_FLOAT,
-				        ReleaseAndGetAddressOfSRV(SRVIndex::PostProcessing_Depth),
-				        nullptr,
-				        ReleaseAndGetAddressOfUAV(UAVIndex::PostProcessing_Depth));
+		auto input  = texture(TextureIndex::PostProcessing_HDR0);
+		auto output = texture(TextureIndex::PostProcessing_HDR1);
+		auto ping_pong = PassIndex::PingPong0;
+
+		if (fxaa) {
+			const auto fxaa_pass = pass(ping_pong) = graph.AddPass();
+			graph.Read(fxaa_pass, input);
+			graph.Write(fxaa_pass, output);
+
+			std::swap(input, output);
+			ping_pong = PassIndex::PingPong1;
+		}
+
+		if (depth_of_field) {
+			const auto dof_pass = pass(ping_pong) = graph.AddPass();
+			graph.Read(dof_pass, input);
+			graph.Read(dof_pass, texture(TextureIndex::PostProcessing_Depth));
+			graph.Write(dof_pass, output);
+
+			std::swap(input, output);
+		}
+
+		const auto tone_mapping_pass = pass(PassIndex::ToneMapping) 
+			                         = graph.AddPass();
+		graph.Read(tone_mapping_pass, input);
+		graph.Write(tone_mapping_pass, ldr);
+
+		graph.Compile();
+	}
+
+	[[nodiscard]]
+	const OutputManager::PooledTexture* OutputManager
+		::GetPooledTexture(TextureIndex index) const noexcept {
+
+		const auto texture = GetTexture(index);
+		if (g_no_texture == texture) {
+			return nullptr;
+		}
+
+		const auto physical_index = m_graph.GetPhysicalIndex(texture);
+		if (RenderGraph::s_no_physical_index == physical_index) {
+			return nullptr;
+		}
+
+		return &m_texture_pool[m_physical_textures[physical_index]];
+	}
+
+	void OutputManager::AcquireTextures() {
+		const auto& descs = m_graph.GetPhysicalDescriptors();
+		
+		// Pooled textures can only be acquired once per viewport.
+		std::vector< bool > acquired(m_texture_pool.size(), false);
+		
+		m_physical_textures.clear();
+		for (const auto& desc : descs) {
+			size_t index = 0u;
+			for (; index < m_texture_pool.size(); ++index) {
+				if (!acquired[index] && desc == m_texture_pool[index].m_desc) {
+					break;
+				}
+			}
+
+			if (m_texture_pool.size() == index) {
+				PooledTexture texture;
+				texture.m_desc = desc;
+
+				const U32x3 resolution(desc.m_width, 
+									   desc.m_height, 
+									   desc.m_nb_samples);
+				if (D3D11_BIND_DEPTH_STENCIL & desc.m_bind_flags) {
+					SetupDepthBuffer(resolution, 
+									 texture.m_srv.ReleaseAndGetAddressOf(), 
+									 texture.m_dsv.ReleaseAndGetAddressOf());
+				}
+				else {
+					const auto rtv = D3D11_BIND_RENDER_TARGET & desc.m_bind_flags;
+					const auto uav = D3D11_BIND_UNORDERED_ACCESS & desc.m_bind_flags;
+					SetupBuffer(resolution, 
+								static_cast< DXGI_FORMAT >(desc.m_format),
+								texture.m_srv.ReleaseAndGetAddressOf(),
+								rtv ? texture.m_rtv.ReleaseAndGetAddressOf() : nullptr,
+								uav ? texture.m_uav.ReleaseAndGetAddressOf() : nullptr);
+				}
+
+				m_texture_pool.push_back(std::move(texture));
+				acquired.push_back(false);
+			}
+
+			acquired[index] = true;
+			m_texture_pool[index].m_used = true;
+			m_physical_textures.push_back(index);
+		}
+	}
+
+	void OutputManager::AssignViews() noexcept {
+		const auto assign = [this](TextureIndex texture, 
+								   SRVIndex srv, 
+								   RTVIndex rtv, 
+								   UAVIndex uav) noexcept {
+
+			const auto pooled_texture = GetPooledTexture(texture);
 			
-			SetupBuffer(setup,
-				        DXGI_FORMAT_R16G16_UNORM,
-				        ReleaseAndGetAddressOfSRV(SRVIndex::PostProcessing_Normal),
-				        nullptr,
-				        ReleaseAndGetAddressOfUAV(UAVIndex::PostProcessing_Normal));
+			m_srvs[static_cast< size_t >(srv)] 
+				= pooled_texture ? pooled_texture->m_srv : nullptr;
+			if (RTVIndex::Count != rtv) {
+				m_rtvs[static_cast< size_t >(rtv)] 
+					= pooled_texture ? pooled_texture->m_rtv : nullptr;
+			}
+			if (UAVIndex::Count != uav) {
+				m_uavs[static_cast< size_t >(uav)] 
+					= pooled_texture ? pooled_texture->m_uav : nullptr;
+			}
+		};
+
+		assign(TextureIndex::Depth, 
+			   SRVIndex::GBuffer_Depth, 
+			   RTVIndex::Count, 
+			   UAVIndex::Count);
+		assign(TextureIndex::GBuffer_BaseColor, 
+			   SRVIndex::GBuffer_BaseColor, 
+			   RTVIndex::GBuffer_BaseColor, 
+			   UAVIndex::Count);
+		assign(TextureIndex::GBuffer_Material, 
+			   SRVIndex::GBuffer_Material, 
+			   RTVIndex::GBuffer_Material, 
+			   UAVIndex::Count);
+		assign(TextureIndex::GBuffer_Normal, 
+			   SRVIndex::GBuffer_Normal, 
+			   RTVIndex::GBuffer_Normal, 
+			   UAVIndex::Count);
+		assign(TextureIndex::HDR, 
+			   SRVIndex::HDR, 
+			   RTVIndex::HDR, 
+			   UAVIndex::HDR);
+		assign(TextureIndex::PostProcessing_HDR0, 
+			   SRVIndex::PostProcessing_HDR0, 
+			   RTVIndex::PostProcessing_HDR0, 
+			   UAVIndex::PostProcessing_HDR0);
+		assign(TextureIndex::PostProcessing_HDR1, 
+			   SRVIndex::PostProcessing_HDR1, 
+			   RTVIndex::PostProcessing_HDR1, 
+			   UAVIndex::PostProcessing_HDR1);
+		assign(TextureIndex::PostProcessing_Normal, 
+			   SRVIndex::PostProcessing_Normal, 
+			   RTVIndex::Count, 
+			   UAVIndex::PostProcessing_Normal);
+		assign(TextureIndex::PostProcessing_Depth, 
+			   SRVIndex::PostProcessing_Depth, 
+			   RTVIndex::Count, 
+			   UAVIndex::PostProcessing_Depth);
+
+		const auto depth = GetPooledTexture(TextureIndex::Depth);
+		m_dsv = depth ? depth->m_dsv : nullptr;
+	}
+
+	void OutputManager::Unbind(ID3D11DeviceContext& device_context, 
+							   PassIndex index) const noexcept {
+
+		const auto pass = m_pass_handles[static_cast< size_t >(index)];
+		if (g_no_pass == pass || m_graph.IsCulled(pass)) {
+			return;
 		}
-		else {
-			m_srvs[static_cast< size_t >(SRVIndex::PostProcessing_Depth)]
-				= m_srvs[static_cast< size_t >(SRVIndex::GBuffer_Depth)];
-			m_srvs[static_cast< size_t >(SRVIndex::PostProcessing_Normal)]
-				= m_srvs[static_cast< size_t >(SRVIndex::GBuffer_Normal)];
+
+		static constexpr U32 srv_slots[] = {
+			SLOT_SRV_DEPTH,          // Depth
+			SLOT_SRV_BASE_COLOR,     // GBuffer_BaseColor
+			SLOT_SRV_MATERIAL,       // GBuffer_Material
+			SLOT_SRV_NORMAL,         // GBuffer_Normal
+			SLOT_SRV_IMAGE,          // HDR
+			SLOT_SRV_IMAGE,          // PostProcessing_HDR0
+			SLOT_SRV_IMAGE,          // PostProcessing_HDR1
+			SLOT_SRV_NORMAL,         // PostProcessing_Normal
+			SLOT_SRV_DEPTH,          // PostProcessing_Depth
+			SLOT_SRV_IMAGE,          // LDR
+		};
+		static_assert(std::size(srv_slots) 
+					  == static_cast< size_t >(TextureIndex::Count));
+
+		// Unbind the SRVs of the textures written by this pass.
+		for (const auto texture : m_graph.GetInputUnbinds(pass)) {
+			for (size_t i = 0u; i < std::size(m_texture_handles); ++i) {
+				if (texture == m_texture_handles[i]) {
+					Pipeline::PS::BindSRV(device_context, srv_slots[i], nullptr);
+					Pipeline::CS::BindSRV(device_context, srv_slots[i], nullptr);
+				}
+			}
+		}
+
+		// Unbind the RTVs, DSV and UAVs of the textures read by this pass.
+		if (!m_graph.GetOutputUnbinds(pass).empty()) {
+			ID3D11UnorderedAccessView* const uavs[3] = {};
+
+			static_assert(SLOT_UAV_NORMAL == SLOT_UAV_IMAGE + 1);
+			static_assert(SLOT_UAV_DEPTH  == SLOT_UAV_IMAGE + 2);
+
+			Pipeline::OM::BindRTVAndDSV(device_context, nullptr, nullptr);
+			Pipeline::CS::BindUAVs(device_context, SLOT_UAV_IMAGE,
+								   static_cast< U32 >(std::size(uavs)), uavs);
 		}
-	
-		SetupBuffer(setup,
-					DXGI_FORMAT_R16G16B16A16_FLOAT,
-					ReleaseAndGetAddressOfSRV(SRVIndex::LDR),
-					ReleaseAndGetAddressOfRTV(RTVIndex::LDR),
-					ReleaseAndGetAddressOfUAV(UAVIndex::LDR));
 	}
 
 	void OutputManager::SetupBuffer(const U32x3& resolution, 
@@ -206,7 +524,9 @@ namespace mage::rendering {
 		}
 	}
 
-	void OutputManager::SetupDepthBuffer(const U32x3& resolution) {
+	void OutputManager::SetupDepthBuffer(const U32x3& resolution,
+										 ID3D11ShaderResourceView** srv,
+										 ID3D11DepthStencilView** dsv) {
 
 		// Create the texture descriptor.
 		D3D11_TEXTURE2D_DESC texture_desc = {};
@@ -257,8 +577,7 @@ namespace mage::rendering {
 			
 			// Create the SRV.
 			const HRESULT result = m_device.get().CreateShaderResourceView(
-				texture.Get(), &srv_desc,
-				ReleaseAndGetAddressOfSRV(SRVIndex::GBuffer_Depth));
+				texture.Get(), &srv_desc, srv);
 			ThrowIfFailed(result, "SRV creation failed: %08X.", result);
 		}
 
@@ -273,14 +592,23 @@ namespace mage::rendering {
 
 			// Create the DSV.
 			const HRESULT result = m_device.get().CreateDepthStencilView(
-				texture.Get(), &dsv_desc,
-				m_dsv.ReleaseAndGetAddressOf());
+				texture.Get(), &dsv_desc, dsv);
 			ThrowIfFailed(result, "DSV creation failed: %08X.", result);
 		}
 	}
 
-	void OutputManager::BindBegin(
-		ID3D11DeviceContext& device_context) const noexcept {
+	void OutputManager::BindBegin(ID3D11DeviceContext& device_context) {
+		// Release the pooled textures which were not used during the 
+		// previous frame.
+		m_texture_pool.erase(std::remove_if(m_texture_pool.begin(), 
+											m_texture_pool.end(),
+			[](const PooledTexture& texture) noexcept {
+				return !texture.m_used;
+			}), m_texture_pool.end());
+		for (auto& texture : m_texture_pool) {
+			texture.m_used = false;
+		}
+
 
 		// Bind no LDR SRV.
 		Pipeline::PS::BindSRV(device_context, SLOT_SRV_IMAGE, nullptr);
@@ -289,7 +617,15 @@ namespace mage::rendering {
 	}
 
 	void OutputManager::BindBeginViewport(
-		ID3D11DeviceContext& device_context) const noexcept {
+		ID3D11DeviceContext& device_context, 
+		bool deferred, 
+		bool depth_of_field) {
+
+		// Declare and compile the render graph of the viewport, and 
+		// acquire its physical textures.
+		DeclareViewport(deferred, depth_of_field);
+		AcquireTextures();
+		AssignViews();
 
 		// Bind no LDR UAV.
 		Pipeline::CS::BindUAV(device_context, SLOT_UAV_IMAGE, nullptr);
@@ -297,10 +633,14 @@ namespace mage::rendering {
 		Pipeline::CS::BindSRV(device_context, SLOT_SRV_IMAGE, nullptr);
 
 		// Clear the GBuffer RTVs.
-		Pipeline::OM::ClearRTV(device_context, 
-							   GetRTV(RTVIndex::GBuffer_BaseColor));
-		Pipeline::OM::ClearRTV(device_context, 
-							   GetRTV(RTVIndex::GBuffer_Material));
+		if (!m_graph.IsCulled(m_pass_handles[
+			static_cast< size_t >(PassIndex::GBuffer)])) {
+
+			Pipeline::OM::ClearRTV(device_context, 
+								   GetRTV(RTVIndex::GBuffer_BaseColor));
+			Pipeline::OM::ClearRTV(device_context, 
+								   GetRTV(RTVIndex::GBuffer_Material));
+		}
 		Pipeline::OM::ClearRTV(device_context, 
 							   GetRTV(RTVIndex::GBuffer_Normal));
 		// Clear the GBuffer DSV.
@@ -309,12 +649,15 @@ namespace mage::rendering {
 		// Clear the HDR RTV.
 		Pipeline::OM::ClearRTV(device_context, GetRTV(RTVIndex::HDR));
 
-		m_hdr0_to_hdr1 = true;
+		m_hdr0_to_hdr1  = true;
+		m_nb_ping_pongs = 0u;
 	}
 
 	void OutputManager::BindBeginGBuffer(
 		ID3D11DeviceContext& device_context) const noexcept {
 		
+		Unbind(device_context, PassIndex::GBuffer);
+
 		// Collect the GBuffer RTVs.
 		ID3D11RenderTargetView* const rtvs[] = {
 			GetRTV(RTVIndex::GBuffer_BaseColor),
@@ -338,6 +681,8 @@ namespace mage::rendering {
 	void OutputManager::BindBeginDeferred(
 		ID3D11DeviceContext& device_context) const noexcept {
 
+		Unbind(device_context, PassIndex::Deferred);
+
 		static_assert(SLOT_SRV_MATERIAL == SLOT_SRV_BASE_COLOR + 1);
 		static_assert(SLOT_SRV_NORMAL   == SLOT_SRV_BASE_COLOR + 2);
 		static_assert(SLOT_SRV_DEPTH    == SLOT_SRV_BASE_COLOR + 3);
@@ -401,6 +746,8 @@ namespace mage::rendering {
 	void OutputManager::BindBeginForward(
 		ID3D11DeviceContext& device_context) const noexcept {
 
+		Unbind(device_context, PassIndex::Forward);
+
 		// Collect the RTVs.
 		ID3D11RenderTargetView* const rtvs[] = {
 			GetRTV(RTVIndex::HDR),
@@ -423,6 +770,8 @@ namespace mage::rendering {
 	void OutputManager::BindBeginResolve(
 		ID3D11DeviceContext& device_context) const noexcept {
 
+		Unbind(device_context, PassIndex::Resolve);
+
 		// Bind the SRVs.
 		Pipeline::CS::BindSRV(device_context, SLOT_SRV_IMAGE,  
 							  GetSRV(SRVIndex::HDR));
@@ -477,6 +826,9 @@ namespace mage::rendering {
 	void OutputManager::BindPingPong(
 		ID3D11DeviceContext& device_context) const noexcept {
 
+		Unbind(device_context, (0u == m_nb_ping_pongs++) ? PassIndex::PingPong0
+			                                             : PassIndex::PingPong1);
+
 		// Bind no HDR UAV.
 		Pipeline::CS::BindUAV(device_context, SLOT_UAV_IMAGE, nullptr);
 		
@@ -510,6 +862,8 @@ namespace mage::rendering {
 	void OutputManager::BindEndViewport(
 		ID3D11DeviceContext& device_context) const noexcept {
 
+		Unbind(device_context, PassIndex::ToneMapping);
+
 		// Bind LDR UAV.
 		Pipeline::CS::BindUAV(device_context, SLOT_UAV_IMAGE,
 							  GetUAV(UAVIndex::LDR));
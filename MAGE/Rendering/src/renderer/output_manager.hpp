@@ -5,10 +5,20 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
+#include "renderer\render_graph.hpp"
 #include "renderer\swap_chain.hpp"
 
 #pragma endregion
 
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <vector>
+
+#pragma endregion
+
 //-----------------------------------------------------------------------------
 // Engine Declarations and Definitions
 //-----------------------------------------------------------------------------
@@ -16,6 +26,11 @@ namespace mage::rendering {
 
 	/**
 	 A class of output managers.
+
+	 The textures of each viewport are declared in a render graph. Only the 
+	 textures of the non-culled passes are allocated, and textures with 
+	 disjoint lifetimes share the same physical texture. The physical 
+	 textures are pooled across viewports and frames.
 	 */
 	class OutputManager final {
 
@@ -91,8 +106,26 @@ namespace mage::rendering {
 		// Member Methods
 		//---------------------------------------------------------------------
 
-		void BindBegin(ID3D11DeviceContext& device_context) const noexcept;
-		void BindBeginViewport(ID3D11DeviceContext& device_context) const noexcept;
+		void BindBegin(ID3D11DeviceContext& device_context);
+
+		/**
+		 Declares, compiles and binds the render graph of a viewport.
+
+		 @param[in]		device_context
+						A reference to the device context.
+		 @param[in]		deferred
+						@c true if the viewport uses deferred shading. 
+						@c false otherwise.
+		 @param[in]		depth_of_field
+						@c true if the viewport uses depth-of-field. 
+						@c false otherwise.
+		 @throws		Exception
+						Failed to create the textures of the viewport.
+		 */
+		void BindBeginViewport(ID3D11DeviceContext& device_context, 
+							   bool deferred, 
+							   bool depth_of_field);
+
 		void BindBeginGBuffer(ID3D11DeviceContext& device_context) const noexcept;
 		void BindEndGBuffer(ID3D11DeviceContext& device_context) const noexcept;
 		void BindBeginDeferred(ID3D11DeviceContext& device_context) const noexcept;
@@ -114,6 +147,40 @@ namespace mage::rendering {
 		// Member Methods
 		//---------------------------------------------------------------------
 
+		enum class TextureIndex : U8 {
+			Depth = 0,
+			GBuffer_BaseColor,
+			GBuffer_Material,
+			GBuffer_Normal,
+			HDR,
+			PostProcessing_HDR0,
+			PostProcessing_HDR1,
+			PostProcessing_Normal,
+			PostProcessing_Depth,
+			LDR,
+			Count
+		};
+
+		enum class PassIndex : U8 {
+			GBuffer = 0,
+			Deferred,
+			Forward,
+			Resolve,
+			PingPong0,
+			PingPong1,
+			ToneMapping,
+			Count
+		};
+
+		struct PooledTexture final {
+			RenderGraph::TextureDescriptor m_desc;
+			ComPtr< ID3D11ShaderResourceView > m_srv;
+			ComPtr< ID3D11RenderTargetView > m_rtv;
+			ComPtr< ID3D11UnorderedAccessView > m_uav;
+			ComPtr< ID3D11DepthStencilView > m_dsv;
+			bool m_used = false;
+		};
+
 		enum class SRVIndex : U8 {
 			HDR = 0,
 			GBuffer_BaseColor,
@@ -188,6 +255,23 @@ namespace mage::rendering {
 			return NotNull< ID3D11UnorderedAccessView** >(uav.ReleaseAndGetAddressOf());
 		}
 
+		[[nodiscard]]
+		RenderGraph::TextureHandle GetTexture(TextureIndex index) const noexcept {
+			return m_texture_handles[static_cast< size_t >(index)];
+		}
+
+		[[nodiscard]]
+		const PooledTexture* GetPooledTexture(TextureIndex index) const noexcept;
+
+		void DeclareViewport(bool deferred, bool depth_of_field);
+
+		void AcquireTextures();
+
+		void AssignViews() noexcept;
+
+		void Unbind(ID3D11DeviceContext& device_context, 
+					PassIndex index) const noexcept;
+
 		void SetupBuffers();
 
 		void SetupBuffer(const U32x3& resolution, 
@@ -196,7 +280,9 @@ namespace mage::rendering {
 			             ID3D11RenderTargetView** rtv, 
 			             ID3D11UnorderedAccessView** uav);
 
-		void SetupDepthBuffer(const U32x3& resolution);
+		void SetupDepthBuffer(const U32x3& resolution,
+							  ID3D11ShaderResourceView** srv,
+							  ID3D11DepthStencilView** dsv);
 
 		//---------------------------------------------------------------------
 		// Member Variables
@@ -217,8 +303,22 @@ namespace mage::rendering {
 
 		ComPtr< ID3D11DepthStencilView > m_dsv;
 
+		RenderGraph m_graph;
+
+		RenderGraph::TextureHandle m_texture_handles[
+			static_cast< size_t >(TextureIndex::Count)];
+
+		RenderGraph::PassHandle m_pass_handles[
+			static_cast< size_t >(PassIndex::Count)];
+
+		std::vector< PooledTexture > m_texture_pool;
+
+		std::vector< size_t > m_physical_textures;
+
 		mutable bool m_hdr0_to_hdr1;
 
+		mutable U8 m_nb_ping_pongs;
+
 		bool m_msaa;
 		bool m_ssaa;
 	};
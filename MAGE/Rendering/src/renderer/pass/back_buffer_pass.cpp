@@ -5,6 +5,7 @@
 
 #include "renderer\pass\back_buffer_pass.hpp"
 #include "resource\shader\shader_factory.hpp"
+#include "system\profiler.hpp"
 
 #pragma endregion
 
@@ -54,6 +55,8 @@ namespace mage::rendering {
 	}
 
 	void BackBufferPass::Render() {
+		MAGE_PROFILE_FUNCTION();
+
 		// Bind the fixed state.
 		BindFixedState();
 		
@@ -5,6 +5,7 @@
 
 #include "renderer\pass\bounding_volume_pass.hpp"
 #include "resource\shader\shader_factory.hpp"
+#include "system\profiler.hpp"
 
 // Include HLSL bindings.
 #include "hlsl.hpp"
@@ -97,6 +98,8 @@ namespace mage::rendering {
 
 	void XM_CALLCONV BoundingVolumePass::Render(const World& world, 
 												FXMMATRIX world_to_projection) {
+		MAGE_PROFILE_FUNCTION();
+
 		// Bind the fixed state.
 		BindFixedState();
 		
@@ -164,7 +167,7 @@ namespace mage::rendering {
 
 		// Process the models.
 		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-			if (State::Active != model.GetState()) {
+			if (State::Active != model.GetState() || model.IsOccluded()) {
 				return;
 			}
 			
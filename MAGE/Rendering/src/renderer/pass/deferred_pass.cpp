@@ -5,6 +5,7 @@
 
 #include "renderer\pass\deferred_pass.hpp"
 #include "resource\shader\shader_factory.hpp"
+#include "system\profiler.hpp"
 
 // Include HLSL bindings.
 #include "hlsl.hpp"
@@ -22,7 +23,13 @@ namespace mage::rendering {
 		: m_device_context(device_context),
 		m_state_manager(state_manager), 
 		m_resource_manager(resource_manager),
-		m_msaa_vs(CreateNearFullscreenTriangleVS(resource_manager)) {}
+		m_msaa_vs(CreateNearFullscreenTriangleVS(resource_manager)),
+		m_msaa_ps(resource_manager, CreateDeferredMSAAPS,
+				  ShaderPermutation::s_brdf_mask
+				  | ShaderPermutation::s_vct_mask),
+		m_cs(resource_manager, CreateDeferredCS,
+			 ShaderPermutation::s_brdf_mask
+			 | ShaderPermutation::s_vct_mask) {}
 
 	DeferredPass::DeferredPass(DeferredPass&& pass) noexcept = default;
 
@@ -54,10 +61,14 @@ namespace mage::rendering {
 	}
 
 	void DeferredPass::Render(BRDF brdf, bool vct) {
+		MAGE_PROFILE_FUNCTION();
+
 		// Binds the fixed state.
 		BindFixedState();
 
-		const auto ps = CreateDeferredMSAAPS(m_resource_manager, brdf, vct);
+		const ShaderPermutation permutation(brdf, ToneMapping::None,
+											false, vct, false, true);
+		const auto& ps = m_msaa_ps.Get(permutation);
 		// PS: Bind the pixel shader.
 		ps->BindShader(m_device_context);
 		
@@ -68,7 +79,11 @@ namespace mage::rendering {
 	void DeferredPass::Dispatch(const U32x2& viewport_size,
 								BRDF brdf, bool vct) {
 		
-		const auto cs = CreateDeferredCS(m_resource_manager, brdf, vct);
+		MAGE_PROFILE_FUNCTION();
+
+		const ShaderPermutation permutation(brdf, ToneMapping::None,
+											false, vct);
+		const auto& cs = m_cs.Get(permutation);
 		// CS: Bind the compute shader.
 		cs->BindShader(m_device_context);
 		
@@ -5,6 +5,7 @@
 
 #include "renderer\pass\depth_pass.hpp"
 #include "resource\shader\shader_factory.hpp"
+#include "system\profiler.hpp"
 
 // Include HLSL bindings.
 #include "hlsl.hpp"
@@ -83,6 +84,8 @@ namespace mage::rendering {
 	void XM_CALLCONV DepthPass::Render(const World& world, 
 									   FXMMATRIX world_to_camera, 
 									   CXMMATRIX camera_to_projection) {
+		MAGE_PROFILE_FUNCTION();
+
 		// Bind the projection data.
 		BindCamera(world_to_camera, camera_to_projection);
 
@@ -98,6 +101,7 @@ namespace mage::rendering {
 		// Process the opaque models.
 		world.ForEach< Model >([this, world_to_projection](const Model& model) {
 			if (State::Active != model.GetState()
+				|| model.IsOccluded()
 				|| model.GetMaterial().IsTransparant()) {
 				return;
 			}
@@ -118,6 +122,7 @@ namespace mage::rendering {
 			const auto& material = model.GetMaterial();
 			
 			if (State::Active != model.GetState()
+				|| model.IsOccluded()
 				|| !material.IsTransparant()
 				|| material.GetBaseColor()[3] < TRANSPARENCY_SHADOW_THRESHOLD) {
 				return;
@@ -130,6 +135,8 @@ namespace mage::rendering {
 	void XM_CALLCONV DepthPass::RenderOccluders(const World& world, 
 												FXMMATRIX world_to_camera, 
 												CXMMATRIX camera_to_projection) {
+		MAGE_PROFILE_FUNCTION();
+
 		// Bind the projection data.
 		BindCamera(world_to_camera, camera_to_projection);
 
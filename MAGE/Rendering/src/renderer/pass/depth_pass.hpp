@@ -102,7 +102,9 @@ namespace mage::rendering {
 		void BindFixedState() const noexcept;
 
 		/**
-		 Renders the world.
+		 Renders the world from the current camera.
+
+		 Models culled for the current camera are skipped.
 
 		 @param[in]		world
 						A reference to the world.
@@ -118,7 +120,10 @@ namespace mage::rendering {
 								CXMMATRIX camera_to_projection);
 
 		/**
-		 Renders the occluders of the world.
+		 Renders the occluders of the world from a light.
+
+		 The culling state of the current camera is ignored, since models 
+		 culled for the camera may still cast shadows onto visible models.
 
 		 @param[in]		world
 						A reference to the world.
@@ -6,6 +6,7 @@
 #include "renderer\pass\forward_pass.hpp"
 #include "resource\shader\shader_factory.hpp"
 #include "resource\texture\texture_factory.hpp"
+#include "system\profiler.hpp"
 
 // Include HLSL bindings.
 #include "hlsl.hpp"
@@ -25,6 +26,15 @@ namespace mage::rendering {
 		m_state_manager(state_manager),
 		m_resource_manager(resource_manager),
 		m_vs(CreateTransformVS(resource_manager)),
+		m_forward_ps(resource_manager, CreateForwardPS,
+					 ShaderPermutation::s_brdf_mask
+					 | ShaderPermutation::s_tsnm_mask
+					 | ShaderPermutation::s_vct_mask
+					 | ShaderPermutation::s_transparency_mask),
+		m_forward_emissive_ps(resource_manager, CreateForwardEmissivePS,
+							  ShaderPermutation::s_transparency_mask),
+		m_gbuffer_ps(resource_manager, CreateGBufferPS,
+					 ShaderPermutation::s_tsnm_mask),
 		m_uv(CreateReferenceTexture(resource_manager)),
 		m_color_buffer(device) {}
 
@@ -119,6 +129,8 @@ namespace mage::rendering {
 	void XM_CALLCONV ForwardPass::Render(const World& world, 
 										 FXMMATRIX world_to_projection, 
 										 BRDF brdf, bool vct) const {
+		MAGE_PROFILE_FUNCTION();
+
 		// Bind the fixed opaque state.
 		BindFixedOpaqueState();
 
@@ -128,8 +140,9 @@ namespace mage::rendering {
 		// All emissive models.
 		//---------------------------------------------------------------------
 		{
-			const PixelShaderPtr ps = CreateForwardEmissivePS(m_resource_manager, 
-															  transparency);
+			const ShaderPermutation permutation(BRDF::Lambertian, ToneMapping::None,
+												false, false, transparency);
+			const auto& ps = m_forward_emissive_ps.Get(permutation);
 			// PS: Bind the pixel shader.
 			ps->BindShader(m_device_context);
 		}
@@ -153,8 +166,9 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 		{
 			constexpr bool tsnm = false;
-			const PixelShaderPtr ps = CreateForwardPS(m_resource_manager, 
-													  brdf, transparency, vct, tsnm);
+			const ShaderPermutation permutation(brdf, ToneMapping::None,
+												tsnm, vct, transparency);
+			const auto& ps = m_forward_ps.Get(permutation);
 			// PS: Bind the pixel shader.
 			ps->BindShader(m_device_context);
 		}
@@ -179,8 +193,9 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 		{
 			constexpr bool tsnm = true;
-			const PixelShaderPtr ps = CreateForwardPS(m_resource_manager, 
-													  brdf, transparency, vct, tsnm);
+			const ShaderPermutation permutation(brdf, ToneMapping::None,
+												tsnm, vct, transparency);
+			const auto& ps = m_forward_ps.Get(permutation);
 			// PS: Bind the pixel shader.
 			ps->BindShader(m_device_context);
 		}
@@ -203,6 +218,8 @@ namespace mage::rendering {
 
 	void XM_CALLCONV ForwardPass::RenderSolid(const World& world, 
 											  FXMMATRIX world_to_projection) const {
+		MAGE_PROFILE_FUNCTION();
+
 		// Bind the fixed opaque state.
 		BindFixedOpaqueState();
 
@@ -227,6 +244,8 @@ namespace mage::rendering {
 
 	void XM_CALLCONV ForwardPass::RenderGBuffer(const World& world, 
 												FXMMATRIX world_to_projection) const {
+		MAGE_PROFILE_FUNCTION();
+
 		// Bind the fixed opaque state.
 		BindFixedOpaqueState();
 		
@@ -235,7 +254,9 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 		{
 			constexpr bool tsnm = false;
-			const PixelShaderPtr ps = CreateGBufferPS(m_resource_manager, tsnm);
+			const ShaderPermutation permutation(BRDF::Lambertian, ToneMapping::None,
+												tsnm);
+			const auto& ps = m_gbuffer_ps.Get(permutation);
 			// PS: Bind the pixel shader.
 			ps->BindShader(m_device_context);
 		}
@@ -260,7 +281,9 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 		{
 			constexpr bool tsnm = true;
-			const PixelShaderPtr ps = CreateGBufferPS(m_resource_manager, tsnm);
+			const ShaderPermutation permutation(BRDF::Lambertian, ToneMapping::None,
+												tsnm);
+			const auto& ps = m_gbuffer_ps.Get(permutation);
 			// PS: Bind the pixel shader.
 			ps->BindShader(m_device_context);
 		}
@@ -283,6 +306,8 @@ namespace mage::rendering {
 
 	void XM_CALLCONV ForwardPass::RenderEmissive(const World& world, 
 												 FXMMATRIX world_to_projection) const {
+		MAGE_PROFILE_FUNCTION();
+
 		constexpr bool transparency = false;
 
 		// Bind the fixed opaque state.
@@ -292,8 +317,9 @@ namespace mage::rendering {
 		// All emissive models.
 		//---------------------------------------------------------------------
 		{
-			const PixelShaderPtr ps = CreateForwardEmissivePS(m_resource_manager, 
-															  transparency);
+			const ShaderPermutation permutation(BRDF::Lambertian, ToneMapping::None,
+												false, false, transparency);
+			const auto& ps = m_forward_emissive_ps.Get(permutation);
 			// PS: Bind the pixel shader.
 			ps->BindShader(m_device_context);
 		}
@@ -317,6 +343,8 @@ namespace mage::rendering {
 													FXMMATRIX world_to_projection, 
 													BRDF brdf, 
 													bool vct) const {
+		MAGE_PROFILE_FUNCTION();
+
 		// Bind the fixed transparent state.
 		BindFixedTransparentState();
 
@@ -326,8 +354,9 @@ namespace mage::rendering {
 		// All transparent emissive models.
 		//---------------------------------------------------------------------
 		{
-			const PixelShaderPtr ps = CreateForwardEmissivePS(m_resource_manager, 
-															  transparency);
+			const ShaderPermutation permutation(BRDF::Lambertian, ToneMapping::None,
+												false, false, transparency);
+			const auto& ps = m_forward_emissive_ps.Get(permutation);
 			// PS: Bind the pixel shader.
 			ps->BindShader(m_device_context);
 		}
@@ -352,8 +381,9 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 		{
 			constexpr bool tsnm = false;
-			const PixelShaderPtr ps = CreateForwardPS(m_resource_manager, 
-													  brdf, transparency, vct, tsnm);
+			const ShaderPermutation permutation(brdf, ToneMapping::None,
+												tsnm, vct, transparency);
+			const auto& ps = m_forward_ps.Get(permutation);
 			// PS: Bind the pixel shader.
 			ps->BindShader(m_device_context);
 		}
@@ -379,8 +409,9 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 		{
 			constexpr bool tsnm = true;
-			const PixelShaderPtr ps = CreateForwardPS(m_resource_manager, 
-													  brdf, transparency, vct, tsnm);
+			const ShaderPermutation permutation(brdf, ToneMapping::None,
+												tsnm, vct, transparency);
+			const auto& ps = m_forward_ps.Get(permutation);
 			// PS: Bind the pixel shader.
 			ps->BindShader(m_device_context);
 		}
@@ -405,6 +436,8 @@ namespace mage::rendering {
 	void XM_CALLCONV ForwardPass::RenderFalseColor(const World& world, 
 												   FXMMATRIX world_to_projection, 
 												   FalseColor false_color) const {
+		MAGE_PROFILE_FUNCTION();
+
 		// Bind the fixed opaque state.
 		BindFixedOpaqueState();
 
@@ -434,6 +467,8 @@ namespace mage::rendering {
 
 	void XM_CALLCONV ForwardPass::RenderWireframe(const World& world, 
 												  FXMMATRIX world_to_projection) {
+		MAGE_PROFILE_FUNCTION();
+
 		// Bind the fixed opaque state.
 		BindFixedWireframeState();
 
@@ -464,6 +499,11 @@ namespace mage::rendering {
 	void XM_CALLCONV ForwardPass::Render(const Model& model, 
 										 FXMMATRIX world_to_projection) const noexcept {
 
+		// Apply occlusion culling.
+		if (model.IsOccluded()) {
+			return;
+		}
+
 		const auto& transform            = model.GetOwner()->GetTransform();
 		const auto  object_to_world      = transform.GetObjectToWorldMatrix();
 		const auto  object_to_projection = object_to_world * world_to_projection;
@@ -490,7 +530,7 @@ namespace mage::rendering {
 							   static_cast< U32 >(std::size(srvs)), srvs);
 		// Bind the mesh of the model.
 		model.BindMesh(m_device_context);
-		// Draw the model.
-		model.Draw(m_device_context);
+		// Draw the (visible meshlets of the) model.
+		model.DrawVisible(m_device_context);
 	}
 }
\ No newline at end of file
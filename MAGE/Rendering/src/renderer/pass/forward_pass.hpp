@@ -8,6 +8,7 @@
 #include "renderer\configuration.hpp"
 #include "renderer\state_manager.hpp"
 #include "resource\rendering_resource_manager.hpp"
+#include "resource\shader\shader_permutation.hpp"
 #include "scene\rendering_world.hpp"
 
 #pragma endregion
@@ -268,6 +269,21 @@ namespace mage::rendering {
 		 */
 		VertexShaderPtr m_vs;
 
+		/**
+		 The forward pixel shader permutations of this forward pass.
+		 */
+		ShaderPermutationTable< PixelShader > m_forward_ps;
+
+		/**
+		 The forward emissive pixel shader permutations of this forward pass.
+		 */
+		ShaderPermutationTable< PixelShader > m_forward_emissive_ps;
+
+		/**
+		 The GBuffer pixel shader permutations of this forward pass.
+		 */
+		ShaderPermutationTable< PixelShader > m_gbuffer_ps;
+
 		/**
 		 A pointer to the UV reference texture of this forward pass. 
 		 */
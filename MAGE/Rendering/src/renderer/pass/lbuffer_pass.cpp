@@ -4,17 +4,141 @@
 #pragma region
 
 #include "renderer\pass\lbuffer_pass.hpp"
+#include "imgui.hpp"
+#include "system\profiler.hpp"
 
 // Include HLSL bindings.
 #include "hlsl.hpp"
 
 #pragma endregion
 
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cmath>
+
+#pragma endregion
+
 //-----------------------------------------------------------------------------
 // Engine Definitions
 //-----------------------------------------------------------------------------
 namespace mage::rendering {
 
+	namespace {
+
+		/**
+		 Computes the shadow priority of a light.
+
+		 @param[in]		light_to_projection
+						The light-to-projection transformation matrix of the 
+						camera.
+		 @param[in]		aabb
+						A reference to the AABB of the light expressed in light 
+						space.
+		 @param[in]		range
+						The range of the light (or zero for directional 
+						lights).
+		 @param[in]		importance
+						The shadow importance of the light.
+		 @return		The shadow priority of the light.
+		 */
+		[[nodiscard]]
+		F32 XM_CALLCONV ComputeShadowPriority(FXMMATRIX light_to_projection, 
+											  const AABB& aabb, 
+											  F32 range, 
+											  F32 importance) noexcept {
+			
+			const auto p_min = aabb.MinPoint();
+			const auto p_max = aabb.MaxPoint();
+
+			// Project the corners of the AABB to estimate the screen coverage.
+			auto ndc_min = XMVectorReplicate( 1.0f);
+			auto ndc_max = XMVectorReplicate(-1.0f);
+			auto clipped = false;
+			for (U32 i = 0u; i < 8u; ++i) {
+				const auto control = XMVectorSelectControl(i & 1u, 
+														   (i >> 1u) & 1u, 
+														   (i >> 2u) & 1u, 
+														   0u);
+				const auto p      = XMVectorSelect(p_min, p_max, control);
+				const auto p_proj = XMVector3Transform(p, light_to_projection);
+				const auto w      = XMVectorGetW(p_proj);
+				if (0.0f >= w) {
+					// The AABB intersects the plane of the eye.
+					clipped = true;
+					break;
+				}
+
+				const auto p_ndc = p_proj / w;
+				ndc_min = XMVectorMin(ndc_min, p_ndc);
+				ndc_max = XMVectorMax(ndc_max, p_ndc);
+			}
+
+			auto coverage = 1.0f;
+			if (!clipped) {
+				const auto one    = XMVectorReplicate(1.0f);
+				const auto extent = XMVectorClamp(ndc_max, -one, one)
+					              - XMVectorClamp(ndc_min, -one, one);
+				// The (relative) side of the covered square of the screen.
+				coverage = std::sqrt(std::max(0.0f, 0.25f 
+					* XMVectorGetX(extent) * XMVectorGetY(extent)));
+			}
+
+			const auto center   = 0.5f * (p_min + p_max);
+			const auto radius   = 0.5f * XMVectorGetX(XMVector3Length(p_max - p_min));
+			const auto w_center = XMVectorGetW(
+				XMVector3Transform(center, light_to_projection));
+
+			return GetShadowPriority(coverage, w_center - radius, 
+									 range, importance);
+		}
+
+		/**
+		 Returns the shadow atlas tile transform of the given tile.
+
+		 @param[in]		tile
+						A reference to the tile.
+		 @param[in]		resolution
+						The resolution of the shadow atlas.
+		 @return		The shadow atlas tile transform of the given tile: 
+						[offset_u, offset_v, scale_u, scale_v]. The transform 
+						is zero if the given tile is not allocated.
+		 */
+		[[nodiscard]]
+		const F32x4 GetShadowTileTransform(const ShadowAtlasTile& tile, 
+										   U32 resolution) noexcept {
+			
+			if (!tile.IsAllocated()) {
+				return F32x4();
+			}
+
+			// Inset the tile by half a texel to avoid filtering across tiles.
+			const auto inv_resolution = 1.0f / resolution;
+			const auto offset_u = (tile.m_position[0] + 0.5f) * inv_resolution;
+			const auto offset_v = (tile.m_position[1] + 0.5f) * inv_resolution;
+			const auto scale    = (tile.m_size        - 1.0f) * inv_resolution;
+			return F32x4(offset_u, offset_v, scale, scale);
+		}
+
+		/**
+		 Returns the shadow atlas key of the given light and face.
+
+		 @param[in]		light
+						A reference to the light.
+		 @param[in]		face
+						The index of the face (or zero for lights with a 
+						single shadow map).
+		 @return		The shadow atlas key of the given light and face.
+		 */
+		[[nodiscard]]
+		U64 GetShadowAtlasKey(const Component& light, U64 face) noexcept {
+			return (light.GetGuid() << 3u) | face;
+		}
+	}
+
 	LBufferPass::LBufferPass(ID3D11Device& device,
 							 ID3D11DeviceContext& device_context,
 							 StateManager& state_manager,
@@ -27,9 +151,17 @@ namespace mage::rendering {
 		m_sm_directional_lights(device, 1u),
 		m_sm_omni_lights(device, 1u),
 		m_sm_spot_lights(device, 1u),
-		m_directional_sms(MakeUnique< ShadowMapBuffer >(device, 1u)),
-		m_omni_sms(MakeUnique< ShadowCubeMapBuffer >(device, 1u)),
-		m_spot_sms(MakeUnique< ShadowMapBuffer >(device, 1u)),
+		m_irradiance_probes(device, 1u),
+		m_irradiance_volume_data(nullptr),
+		m_irradiance_volume_nb_passes(0u),
+		m_shadow_atlas(MakeUnique< ShadowAtlasBuffer >(device)),
+		m_shadow_atlas_allocator(m_shadow_atlas->GetResolution(), 
+								 MAGE_DEFAULT_MIN_SHADOW_MAP_SIZE),
+		m_shadow_atlas_requests(),
+		m_shadow_atlas_tiles(),
+		m_sm_directional_light_buffers(),
+		m_sm_omni_light_buffers(),
+		m_sm_spot_light_buffers(),
 		m_directional_light_cameras(),
 		m_omni_light_cameras(),
 		m_spot_light_cameras(), 
@@ -46,12 +178,20 @@ namespace mage::rendering {
 
 	void XM_CALLCONV LBufferPass
 		::Render(const World& world, 
-				 FXMMATRIX world_to_projection) {
+				 FXMMATRIX world_to_camera, 
+				 CXMMATRIX camera_to_projection) {
+
+		MAGE_PROFILE_FUNCTION();
+
+		const auto world_to_projection = world_to_camera * camera_to_projection;
 
 		// Process the lights.
-		ProcessDirectionalLights(world, world_to_projection);
+		ProcessDirectionalLights(world, world_to_camera, camera_to_projection);
 		ProcessOmniLights(world, world_to_projection);
 		ProcessSpotLights(world, world_to_projection);
+
+		// Allocate the shadow maps in the shadow atlas.
+		AllocateShadowMaps();
 		
 		// Unbind the shadow map SRVs.
 		UnbindShadowMaps();
@@ -68,16 +208,9 @@ namespace mage::rendering {
 	}
 
 	void LBufferPass::UnbindShadowMaps() const noexcept {
-		static_assert(SLOT_SRV_OMNI_SHADOW_MAPS == SLOT_SRV_DIRECTIONAL_SHADOW_MAPS + 1);
-		static_assert(SLOT_SRV_SPOT_SHADOW_MAPS == SLOT_SRV_DIRECTIONAL_SHADOW_MAPS + 2);
-		
-		ID3D11ShaderResourceView* const srvs[3] = {};
-
-		// Unbind the shadow map SRVs.
-		Pipeline::PS::BindSRVs(m_device_context, SLOT_SRV_DIRECTIONAL_SHADOW_MAPS, 
-							   static_cast< U32 >(std::size(srvs)), srvs);
-		Pipeline::CS::BindSRVs(m_device_context, SLOT_SRV_DIRECTIONAL_SHADOW_MAPS, 
-							   static_cast< U32 >(std::size(srvs)), srvs);
+		// Unbind the shadow atlas SRV.
+		Pipeline::PS::BindSRV(m_device_context, SLOT_SRV_SHADOW_ATLAS, nullptr);
+		Pipeline::CS::BindSRV(m_device_context, SLOT_SRV_SHADOW_ATLAS, nullptr);
 	}
 
 	void LBufferPass::BindLBuffer() const noexcept {
@@ -86,9 +219,8 @@ namespace mage::rendering {
 		static_assert(SLOT_SRV_SHADOW_MAPPED_DIRECTIONAL_LIGHTS == SLOT_SRV_DIRECTIONAL_LIGHTS + 3);
 		static_assert(SLOT_SRV_SHADOW_MAPPED_OMNI_LIGHTS        == SLOT_SRV_DIRECTIONAL_LIGHTS + 4);
 		static_assert(SLOT_SRV_SHADOW_MAPPED_SPOT_LIGHTS        == SLOT_SRV_DIRECTIONAL_LIGHTS + 5);
-		static_assert(SLOT_SRV_DIRECTIONAL_SHADOW_MAPS          == SLOT_SRV_DIRECTIONAL_LIGHTS + 6);
-		static_assert(SLOT_SRV_OMNI_SHADOW_MAPS                 == SLOT_SRV_DIRECTIONAL_LIGHTS + 7);
-		static_assert(SLOT_SRV_SPOT_SHADOW_MAPS                 == SLOT_SRV_DIRECTIONAL_LIGHTS + 8);
+		static_assert(SLOT_SRV_SHADOW_ATLAS                     == SLOT_SRV_DIRECTIONAL_LIGHTS + 6);
+		static_assert(MAX_NB_SHADOW_CASCADES                    == MAGE_MAX_NB_SHADOW_CASCADES);
 		
 		ID3D11ShaderResourceView* const srvs[] = {
 			&m_directional_lights.Get(),
@@ -97,9 +229,7 @@ namespace mage::rendering {
 			&m_sm_directional_lights.Get(),
 			&m_sm_omni_lights.Get(),
 			&m_sm_spot_lights.Get(),
-			&m_directional_sms->GetSRV(),
-			&m_omni_sms->GetSRV(),
-			&m_spot_sms->GetSRV()
+			&m_shadow_atlas->GetSRV()
 		};
 
 		// Bind no RTV and DSV.
@@ -116,6 +246,12 @@ namespace mage::rendering {
 							   static_cast< U32 >(std::size(srvs)), srvs);
 		Pipeline::CS::BindSRVs(m_device_context, SLOT_SRV_DIRECTIONAL_LIGHTS, 
 							   static_cast< U32 >(std::size(srvs)), srvs);
+		
+		// Bind the irradiance probes SRV.
+		m_irradiance_probes.Bind< Pipeline::PS >(m_device_context, 
+												 SLOT_SRV_IRRADIANCE_PROBES);
+		m_irradiance_probes.Bind< Pipeline::CS >(m_device_context, 
+												 SLOT_SRV_IRRADIANCE_PROBES);
 	}
 
 	void LBufferPass::ProcessLightsData(const World& world) {
@@ -135,24 +271,77 @@ namespace mage::rendering {
 
 			buffer.m_La = light.GetRadianceSpectrum();
 		});
+
+		// Process the irradiance probes.
+		ProcessIrradianceProbes(world, buffer);
 		
 		// Update the light buffer.
 		m_light_buffer.UpdateData(m_device_context, buffer);
 	}
 
+	void LBufferPass::ProcessIrradianceProbes(const World& world, 
+											  LightBuffer& buffer) {
+
+		const auto& volume = world.GetIrradianceVolume();
+		if (volume.empty()) {
+			// A zero resolution disables the irradiance probes.
+			return;
+		}
+
+		const auto& minimum    = volume.GetMinimum();
+		const auto& maximum    = volume.GetMaximum();
+		const auto& resolution = volume.GetResolution();
+		
+		buffer.m_probe_volume_minimum    = minimum;
+		buffer.m_probe_volume_resolution = resolution;
+		for (size_t i = 0u; i < 3u; ++i) {
+			const auto extent = maximum[i] - minimum[i];
+			buffer.m_probe_volume_scale[i] = (0.0f < extent)
+				? (resolution[i] - 1u) / extent : 0.0f;
+		}
+
+		// The irradiance volume only changes when it is (re)baked or loaded.
+		const auto& coefficients = volume.GetCoefficients();
+		if (m_irradiance_volume_data      == coefficients.data() &&
+			m_irradiance_volume_nb_passes == volume.GetNumberOfPasses()) {
+			return;
+		}
+
+		AlignedVector< IrradianceProbeBuffer > probes(volume.GetNumberOfProbes());
+		for (size_t i = 0u; i < probes.size(); ++i) {
+			for (size_t j = 0u; j < IrradianceVolume::s_nb_coefficients; ++j) {
+				probes[i].m_E[j] 
+					= coefficients[i * IrradianceVolume::s_nb_coefficients + j];
+			}
+		}
+
+		// Update the buffer for irradiance probes.
+		m_irradiance_probes.UpdateData(m_device_context, probes);
+
+		m_irradiance_volume_data      = coefficients.data();
+		m_irradiance_volume_nb_passes = volume.GetNumberOfPasses();
+	}
+
 	void XM_CALLCONV LBufferPass
 		::ProcessDirectionalLights(const World& world, 
-								   FXMMATRIX world_to_projection) {
+								   FXMMATRIX world_to_camera, 
+								   CXMMATRIX camera_to_projection) {
 
 		AlignedVector< DirectionalLightBuffer > lights;
 		lights.reserve(m_directional_lights.size());
 
-		AlignedVector< DirectionalLightBuffer > sm_lights;
-		sm_lights.reserve(m_sm_directional_lights.size());
+		m_sm_directional_light_buffers.clear();
 		m_directional_light_cameras.clear();
 
+		const auto world_to_projection  = world_to_camera * camera_to_projection;
+		const auto camera_to_world      = XMMatrixInverse(nullptr, world_to_camera);
+		const auto projection_to_camera = XMMatrixInverse(nullptr, camera_to_projection);
+		const auto depth_range          = GetViewDepthRange(projection_to_camera);
+
 		// Process the directional lights.
-		world.ForEach< DirectionalLight >([this, &lights, &sm_lights, world_to_projection]
+		world.ForEach< DirectionalLight >([this, &lights, world_to_projection, 
+										   camera_to_world, projection_to_camera, 
+										   depth_range]
 		(const DirectionalLight& light) {
 
 			if (State::Active != light.GetState()) {
@@ -180,16 +369,74 @@ namespace mage::rendering {
 			buffer.m_world_to_projection = XMMatrixTranspose(world_to_lprojection);
 
 			if (light.UseShadows()) {
-				// Create a spotlight camera.
-				LightCameraInfo camera;
-				camera.world_to_light      = world_to_light;
-				camera.light_to_projection = light_to_lprojection;
-
-				// Add directional light camera to the directional cameras.
-				m_directional_light_cameras.push_back(std::move(camera));
+				const auto index       = static_cast< U32 >(
+					m_sm_directional_light_buffers.size());
+				const auto nb_cascades = light.GetNumberOfShadowCascades();
+
+				// All shadow cascades share the priority and size of the 
+				// directional light.
+				const auto priority = ComputeShadowPriority(
+					light_to_projection, light.GetAABB(), 
+					0.0f, light.GetShadowImportance());
+				const auto size     = GetShadowMapSize(
+					priority, 
+					MAGE_DEFAULT_MIN_SHADOW_MAP_SIZE, 
+					MAGE_DEFAULT_MAX_SHADOW_MAP_SIZE);
+
+				if (1u == nb_cascades) {
+					// Create a directional light camera.
+					LightCameraInfo camera;
+					camera.world_to_light      = world_to_light;
+					camera.light_to_projection = light_to_lprojection;
+					camera.request.m_key       = GetShadowAtlasKey(light, 0u);
+					camera.request.m_priority  = priority;
+					camera.request.m_size      = size;
+					camera.index               = index;
+					camera.face                = 0u;
+
+					// Add directional light camera to the directional cameras.
+					m_directional_light_cameras.push_back(std::move(camera));
+				}
+				else {
+					// Fit the shadow cascades to the slices of the view 
+					// frustum.
+					const auto camera_to_light = camera_to_world * world_to_light;
+					const auto distance        = light.GetShadowDistance();
+					const auto far_plane       = (0.0f < distance)
+						? std::clamp(distance, depth_range[0], depth_range[1]) 
+						: depth_range[1];
+					const auto splits = ComputeShadowCascadeSplits(
+						depth_range[0], far_plane, nb_cascades, 
+						light.GetShadowCascadeSplitLambda());
+
+					for (U32 i = 0u; i < nb_cascades; ++i) {
+						// Create a directional light camera.
+						LightCameraInfo camera;
+						camera.world_to_light      = world_to_light;
+						camera.cascade             = ComputeShadowCascade(
+							camera_to_light, projection_to_camera, 
+							F32x2(splits[i], splits[i + 1u]), 
+							light.GetClippingPlanes());
+						camera.light_to_projection = GetShadowCascadeProjection(
+							camera.cascade, size);
+						camera.request.m_key       = GetShadowAtlasKey(light, i);
+						// Allocate the nearest shadow cascades first.
+						camera.request.m_priority  = priority / (i + 1u);
+						camera.request.m_size      = size;
+						camera.index               = index;
+						camera.face                = i;
+
+						// Add directional light camera to the directional 
+						// cameras.
+						m_directional_light_cameras.push_back(std::move(camera));
+					}
+				}
 
 				// Add directional light buffer to directional light buffers.
-				sm_lights.push_back(std::move(buffer));
+				ShadowMappedDirectionalLightBuffer sm_buffer;
+				sm_buffer.m_light       = std::move(buffer);
+				sm_buffer.m_nb_cascades = nb_cascades;
+				m_sm_directional_light_buffers.push_back(std::move(sm_buffer));
 			}
 			else {
 				// Add directional light buffer to directional light buffers.
@@ -197,9 +444,8 @@ namespace mage::rendering {
 			}
 		});
 
-		// Update the buffers for directional lights.
+		// Update the buffer for directional lights.
 		m_directional_lights.UpdateData(m_device_context, lights);
-		m_sm_directional_lights.UpdateData(m_device_context, sm_lights);
 	}
 
 	void XM_CALLCONV LBufferPass
@@ -208,12 +454,11 @@ namespace mage::rendering {
 		AlignedVector< OmniLightBuffer > lights;
 		lights.reserve(m_omni_lights.size());
 
-		AlignedVector< ShadowMappedOmniLightBuffer > sm_lights;
-		sm_lights.reserve(m_sm_omni_lights.size());
+		m_sm_omni_light_buffers.clear();
 		m_omni_light_cameras.clear();
 
 		// Process the omni lights.
-		world.ForEach< OmniLight >([this, &lights, &sm_lights, world_to_projection]
+		world.ForEach< OmniLight >([this, &lights, world_to_projection]
 		(const OmniLight& light) {
 			
 			static const XMMATRIX rotations[6] = {
@@ -246,10 +491,25 @@ namespace mage::rendering {
 				const auto world_to_light       = transform.GetWorldToObjectMatrix();
 				const auto light_to_lprojection = light.GetLightToProjectionMatrix();
 
+				// All faces share the priority and size of the omni light.
+				const auto priority = ComputeShadowPriority(
+					light_to_projection, light.GetAABB(), 
+					range, light.GetShadowImportance());
+				const auto size     = GetShadowMapSize(
+					priority, 
+					MAGE_DEFAULT_MIN_SHADOW_MAP_SIZE, 
+					MAGE_DEFAULT_MAX_SHADOW_MAP_SIZE);
+
 				for (size_t i = 0; i < std::size(rotations); ++i) {
 					LightCameraInfo camera;
 					camera.world_to_light      = world_to_light * rotations[i];
 					camera.light_to_projection = light_to_lprojection;
+					camera.request.m_key       = GetShadowAtlasKey(light, i);
+					camera.request.m_priority  = priority;
+					camera.request.m_size      = size;
+					camera.index               = static_cast< U32 >(
+						m_sm_omni_light_buffers.size());
+					camera.face                = static_cast< U32 >(i);
 
 					// Add omni light camera to the omni light cameras.
 					m_omni_light_cameras.push_back(std::move(camera));
@@ -265,7 +525,7 @@ namespace mage::rendering {
 					                                              light_to_lprojection));
 
 				// Add omni light buffer to omni light buffers.
-				sm_lights.push_back(std::move(buffer));
+				m_sm_omni_light_buffers.push_back(std::move(buffer));
 			}
 			else {
 				// Create an omni light buffer.
@@ -279,9 +539,8 @@ namespace mage::rendering {
 			}
 		});
 
-		// Update the buffers for omni lights.
+		// Update the buffer for omni lights.
 		m_omni_lights.UpdateData(m_device_context, lights);
-		m_sm_omni_lights.UpdateData(m_device_context, sm_lights);
 	}
 
 	void XM_CALLCONV LBufferPass
@@ -290,12 +549,11 @@ namespace mage::rendering {
 		AlignedVector< SpotLightBuffer > lights;
 		lights.reserve(m_spot_lights.size());
 
-		AlignedVector< ShadowMappedSpotLightBuffer > sm_lights;
-		sm_lights.reserve(m_sm_spot_lights.size());
+		m_sm_spot_light_buffers.clear();
 		m_spot_light_cameras.clear();
 
 		// Process the spotlights.
-		world.ForEach< SpotLight >([this, &lights, &sm_lights, world_to_projection]
+		world.ForEach< SpotLight >([this, &lights, world_to_projection]
 		(const SpotLight& light) {
 			
 			if (State::Active != light.GetState()) {
@@ -324,6 +582,17 @@ namespace mage::rendering {
 				LightCameraInfo camera;
 				camera.world_to_light          = world_to_light;
 				camera.light_to_projection     = light_to_lprojection;
+				camera.request.m_key           = GetShadowAtlasKey(light, 0u);
+				camera.request.m_priority      = ComputeShadowPriority(
+					light_to_projection, light.GetAABB(), 
+					range, light.GetShadowImportance());
+				camera.request.m_size          = GetShadowMapSize(
+					camera.request.m_priority, 
+					MAGE_DEFAULT_MIN_SHADOW_MAP_SIZE, 
+					MAGE_DEFAULT_MAX_SHADOW_MAP_SIZE);
+				camera.index                   = static_cast< U32 >(
+					m_sm_spot_light_buffers.size());
+				camera.face                    = 0u;
 
 				// Add spotlight camera to the spotlight cameras.
 				m_spot_light_cameras.push_back(std::move(camera));
@@ -339,7 +608,7 @@ namespace mage::rendering {
 				buffer.m_world_to_projection   = XMMatrixTranspose(world_to_lprojection);
 
 				// Add spotlight buffer to spotlight buffers.
-				sm_lights.push_back(std::move(buffer));
+				m_sm_spot_light_buffers.push_back(std::move(buffer));
 			}
 			else {
 				// Create an omni light buffer.
@@ -356,117 +625,157 @@ namespace mage::rendering {
 			}
 		});
 
-		// Update the buffers for spotlights.
+		// Update the buffer for spotlights.
 		m_spot_lights.UpdateData(m_device_context, lights);
-		m_sm_spot_lights.UpdateData(m_device_context, sm_lights);
 	}
 
-	void LBufferPass::SetupShadowMaps() {
-		// Setup the shadow maps for the directional lights.
-		{
-			const auto nb_requested = m_sm_directional_lights.size();
-			const auto nb_available = m_directional_sms->GetNumberOfShadowMaps();
-
-			if (nb_available < nb_requested) {
-				ComPtr< ID3D11Device > device;
-				m_device_context.get().GetDevice(device.ReleaseAndGetAddressOf());
-				m_directional_sms = MakeUnique< ShadowMapBuffer >(*device.Get(), 
-																  nb_requested);
-			}
-
-			m_directional_sms->ClearDSVs(m_device_context);
+	void LBufferPass::AllocateShadowMaps() {
+		// Collect the requests of all light cameras.
+		m_shadow_atlas_requests.clear();
+		for (const auto& camera : m_directional_light_cameras) {
+			m_shadow_atlas_requests.push_back(camera.request);
+		}
+		for (const auto& camera : m_omni_light_cameras) {
+			m_shadow_atlas_requests.push_back(camera.request);
+		}
+		for (const auto& camera : m_spot_light_cameras) {
+			m_shadow_atlas_requests.push_back(camera.request);
 		}
 
-		// Setup the shadow maps for the omni lights.
-		{
-			const auto nb_requested = m_sm_omni_lights.size();
-			const auto nb_available = m_omni_sms->GetNumberOfShadowCubeMaps();
+		// Update the tiles of the shadow atlas.
+		m_shadow_atlas_allocator.Update(m_shadow_atlas_requests, 
+										m_shadow_atlas_tiles);
 
-			if (nb_available < nb_requested) {
-				ComPtr< ID3D11Device > device;
-				m_device_context.get().GetDevice(device.ReleaseAndGetAddressOf());
-				m_omni_sms = MakeUnique< ShadowCubeMapBuffer >(*device.Get(), 
-															   nb_requested);
+		const auto resolution = m_shadow_atlas->GetResolution();
+		auto tile = m_shadow_atlas_tiles.cbegin();
+
+		// Assign the tiles to the shadow cascades of the directional lights.
+		for (auto& camera : m_directional_light_cameras) {
+			camera.tile = *tile++;
+
+			if (camera.tile.IsAllocated() && 0.0f < camera.cascade.m_radius) {
+				// Snap the shadow cascade to the texel grid of its tile.
+				camera.light_to_projection 
+					= GetShadowCascadeProjection(camera.cascade, 
+												 camera.tile.m_size);
 			}
 
-			m_omni_sms->ClearDSVs(m_device_context);
+			auto& buffer = m_sm_directional_light_buffers[camera.index];
+			buffer.m_cascade_world_to_projection[camera.face] 
+				= XMMatrixTranspose(camera.world_to_light 
+									* camera.light_to_projection);
+			buffer.m_cascade_tiles[camera.face] 
+				= GetShadowTileTransform(camera.tile, resolution);
 		}
 
-		// Setup the shadow maps for the spotlights.
-		{
-			const auto nb_requested = m_sm_spot_lights.size();
-			const auto nb_available = m_spot_sms->GetNumberOfShadowMaps();
-
-			if (nb_available < nb_requested) {
-				ComPtr< ID3D11Device > device;
-				m_device_context.get().GetDevice(device.ReleaseAndGetAddressOf());
-				m_spot_sms = MakeUnique< ShadowMapBuffer >(*device.Get(), 
-														   nb_requested);
-			}
+		// Assign the tiles to the faces of the omni lights.
+		for (auto& camera : m_omni_light_cameras) {
+			camera.tile = *tile++;
+			m_sm_omni_light_buffers[camera.index].m_shadow_tiles[camera.face] 
+				= GetShadowTileTransform(camera.tile, resolution);
+		}
 
-			m_spot_sms->ClearDSVs(m_device_context);
+		// Assign the tiles to the spotlights.
+		for (auto& camera : m_spot_light_cameras) {
+			camera.tile = *tile++;
+			m_sm_spot_light_buffers[camera.index].m_shadow_tile 
+				= GetShadowTileTransform(camera.tile, resolution);
 		}
+
+		// Update the buffers for shadow mapped lights.
+		m_sm_directional_lights.UpdateData(m_device_context, 
+										   m_sm_directional_light_buffers);
+		m_sm_omni_lights.UpdateData(m_device_context, 
+									m_sm_omni_light_buffers);
+		m_sm_spot_lights.UpdateData(m_device_context, 
+									m_sm_spot_light_buffers);
+	}
+
+	void LBufferPass::SetupShadowMaps() {
+		// Clear the shadow atlas.
+		m_shadow_atlas->ClearDSV(m_device_context);
 	}
 
 	void XM_CALLCONV LBufferPass::RenderShadowMaps(const World& world) {
+		MAGE_PROFILE_FUNCTION();
+
 		// Bind the fixed state.
 		m_depth_pass->BindFixedState();
 
-		// Render the shadow maps of the directional lights.
-		{
-			// Bind the viewport.
-			m_directional_sms->Bind(m_device_context);
-			// Bind the rasterizer state.
-			m_directional_sms->BindRasterizerState(m_device_context);
-
-			size_t i = 0;
-			for (const auto& camera : m_directional_light_cameras) {
-				// Bind the DSV.
-				m_directional_sms->BindDSV(m_device_context, i++);
-
-				// Perform the depth pass.
-				m_depth_pass->RenderOccluders(world, 
-											  camera.world_to_light, 
-											  camera.light_to_projection);
+		// Bind the rasterizer state.
+		m_shadow_atlas->BindRasterizerState(m_device_context);
+		// Bind the DSV.
+		m_shadow_atlas->BindDSV(m_device_context);
+
+		const auto render = [this, &world](const LightCameraInfo& camera) {
+			// Lights without a tile are not shadowed.
+			if (!camera.tile.IsAllocated()) {
+				return;
 			}
+
+			// Bind the viewport of the tile.
+			m_shadow_atlas->BindViewport(m_device_context, camera.tile);
+
+			// Perform the depth pass.
+			m_depth_pass->RenderOccluders(world, 
+										  camera.world_to_light, 
+										  camera.light_to_projection);
+		};
+
+		// Render the shadow maps of the directional lights.
+		for (const auto& camera : m_directional_light_cameras) {
+			render(camera);
 		}
 
 		// Render the shadow maps of the omni lights.
-		{
-			// Bind the viewport.
-			m_omni_sms->Bind(m_device_context);
-			// Bind the rasterizer state.
-			m_omni_sms->BindRasterizerState(m_device_context);
-
-			size_t i = 0;
-			for (const auto& camera : m_omni_light_cameras) {
-				// Bind the DSV.
-				m_omni_sms->BindDSV(m_device_context, i++);
-
-				// Perform the depth pass.
-				m_depth_pass->RenderOccluders(world,
-											  camera.world_to_light,
-											  camera.light_to_projection);
-			}
+		for (const auto& camera : m_omni_light_cameras) {
+			render(camera);
 		}
 
 		// Render the shadow maps of the spotlights.
-		{
-			// Bind the viewport.
-			m_spot_sms->Bind(m_device_context);
-			// Bind the rasterizer state.
-			m_spot_sms->BindRasterizerState(m_device_context);
-
-			size_t i = 0;
-			for (const auto& camera : m_spot_light_cameras) {
-				// Bind the DSV.
-				m_spot_sms->BindDSV(m_device_context, i++);
-
-				// Perform the depth pass.
-				m_depth_pass->RenderOccluders(world,
-											  camera.world_to_light,
-											  camera.light_to_projection);
-			}
+		for (const auto& camera : m_spot_light_cameras) {
+			render(camera);
 		}
 	}
+
+	void LBufferPass::RenderShadowAtlasOverlay() const {
+		const auto resolution = m_shadow_atlas_allocator.GetResolution();
+		const auto nb_texels  = static_cast< U64 >(resolution) * resolution;
+
+		ImGui::Begin("Shadow Atlas");
+		
+		ImGui::Text("Resolution: %u x %u", resolution, resolution);
+		ImGui::Text("Tiles: %zu", m_shadow_atlas_allocator.GetNumberOfTiles());
+		ImGui::Text("Usage: %.1f%%", 100.0 
+					* m_shadow_atlas_allocator.GetNumberOfAllocatedTexels() 
+					/ nb_texels);
+		
+		const auto nb_requests = m_shadow_atlas_requests.size();
+		const auto nb_missing  = std::count_if(
+			m_shadow_atlas_tiles.cbegin(), m_shadow_atlas_tiles.cend(), 
+			[](const ShadowAtlasTile& tile) noexcept {
+				return !tile.IsAllocated();
+			});
+		ImGui::Text("Requests: %zu (%zu without tile)", nb_requests, 
+					static_cast< size_t >(nb_missing));
+
+		// Draw the shadow atlas and the outlines of its tiles.
+		const auto size   = ImGui::GetContentRegionAvailWidth();
+		const auto origin = ImGui::GetCursorScreenPos();
+		const auto scale  = size / resolution;
+		
+		ImGui::Image(&m_shadow_atlas->GetSRV(), ImVec2(size, size));
+		
+		auto draw_list = ImGui::GetWindowDrawList();
+		m_shadow_atlas_allocator.ForEachTile(
+			[draw_list, origin, scale](U64, const ShadowAtlasTile& tile) {
+				const ImVec2 p_min(origin.x + scale * tile.m_position[0], 
+								   origin.y + scale * tile.m_position[1]);
+				const ImVec2 p_max(p_min.x + scale * tile.m_size, 
+								   p_min.y + scale * tile.m_size);
+				draw_list->AddRect(p_min, p_max, IM_COL32(255, 255, 0, 255));
+			});
+
+		ImGui::End();
+	}
 }
\ No newline at end of file
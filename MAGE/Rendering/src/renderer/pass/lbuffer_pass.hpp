@@ -9,6 +9,8 @@
 #include "renderer\buffer\light_buffer.hpp"
 #include "renderer\buffer\shadow_map_buffer.hpp"
 #include "renderer\pass\depth_pass.hpp"
+#include "renderer\shadow\shadow_atlas_allocator.hpp"
+#include "renderer\shadow\shadow_cascades.hpp"
 
 #pragma endregion
 
@@ -57,7 +59,16 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 
 		void XM_CALLCONV Render(const World& world,
-			                    FXMMATRIX world_to_projection);
+			                    FXMMATRIX world_to_camera, 
+			                    CXMMATRIX camera_to_projection);
+
+		/**
+		 Renders an overlay of the shadow atlas of this LBuffer pass (i.e. 
+		 the shadow atlas, the allocated tiles and the usage statistics).
+
+		 @pre			An ImGui frame has been started.
+		 */
+		void RenderShadowAtlasOverlay() const;
 		
 	private:
 
@@ -69,14 +80,17 @@ namespace mage::rendering {
 		void BindLBuffer() const noexcept;
 
 		void ProcessLightsData(const World& world);
+		void ProcessIrradianceProbes(const World& world, LightBuffer& buffer);
 
 		void XM_CALLCONV ProcessDirectionalLights(const World& world, 
-												  FXMMATRIX world_to_projection);
+												  FXMMATRIX world_to_camera, 
+												  CXMMATRIX camera_to_projection);
 		void XM_CALLCONV ProcessOmniLights(const World& world, 
 										   FXMMATRIX world_to_projection);
 		void XM_CALLCONV ProcessSpotLights(const World& world, 
 										   FXMMATRIX world_to_projection);
 
+		void AllocateShadowMaps();
 		void SetupShadowMaps();
 
 		void XM_CALLCONV RenderShadowMaps(const World& world);
@@ -94,19 +108,47 @@ namespace mage::rendering {
 		StructuredBuffer< DirectionalLightBuffer > m_directional_lights;
 		StructuredBuffer< OmniLightBuffer > m_omni_lights;
 		StructuredBuffer< SpotLightBuffer > m_spot_lights;
-		StructuredBuffer< DirectionalLightBuffer > m_sm_directional_lights;
+		StructuredBuffer< ShadowMappedDirectionalLightBuffer > m_sm_directional_lights;
 		StructuredBuffer< ShadowMappedOmniLightBuffer > m_sm_omni_lights;
 		StructuredBuffer< ShadowMappedSpotLightBuffer > m_sm_spot_lights;
+		StructuredBuffer< IrradianceProbeBuffer > m_irradiance_probes;
 
-		UniquePtr< ShadowMapBuffer > m_directional_sms;
-		UniquePtr< ShadowCubeMapBuffer > m_omni_sms;
-		UniquePtr< ShadowMapBuffer > m_spot_sms;
+		/**
+		 A pointer to the coefficients of the irradiance volume that was last 
+		 uploaded by this LBuffer pass.
+		 */
+		const RGB* m_irradiance_volume_data;
+
+		/**
+		 The number of sampling passes of the irradiance volume that was last 
+		 uploaded by this LBuffer pass.
+		 */
+		U32 m_irradiance_volume_nb_passes;
+
+		UniquePtr< ShadowAtlasBuffer > m_shadow_atlas;
+
+		/**
+		 The allocator of the tiles of the shadow atlas of this LBuffer pass.
+		 */
+		ShadowAtlasAllocator m_shadow_atlas_allocator;
+
+		std::vector< ShadowAtlasRequest > m_shadow_atlas_requests;
+		std::vector< ShadowAtlasTile > m_shadow_atlas_tiles;
 
 		struct alignas(16) LightCameraInfo final {
 			XMMATRIX world_to_light;
 			XMMATRIX light_to_projection;
+			ShadowAtlasRequest request;
+			ShadowAtlasTile tile;
+			ShadowCascade cascade;
+			U32 index;
+			U32 face;
 		};
 
+		AlignedVector< ShadowMappedDirectionalLightBuffer > m_sm_directional_light_buffers;
+		AlignedVector< ShadowMappedOmniLightBuffer > m_sm_omni_light_buffers;
+		AlignedVector< ShadowMappedSpotLightBuffer > m_sm_spot_light_buffers;
+
 		AlignedVector< LightCameraInfo > m_directional_light_cameras;
 		AlignedVector< LightCameraInfo > m_omni_light_cameras;
 		AlignedVector< LightCameraInfo > m_spot_light_cameras;
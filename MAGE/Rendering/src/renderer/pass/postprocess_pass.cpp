@@ -5,6 +5,7 @@
 
 #include "renderer\pass\postprocess_pass.hpp"
 #include "resource\shader\shader_factory.hpp"
+#include "system\profiler.hpp"
 
 // Include HLSL bindings.
 #include "hlsl.hpp"
@@ -22,7 +23,9 @@ namespace mage::rendering {
 		: m_device_context(device_context), 
 		m_state_manager(state_manager), 
 		m_resource_manager(resource_manager), 
-		m_dof_cs(CreateDepthOfFieldCS(resource_manager)) {}
+		m_dof_cs(CreateDepthOfFieldCS(resource_manager)),
+		m_ldr_cs(resource_manager, CreateLowDynamicRangeCS,
+				 ShaderPermutation::s_tone_mapping_mask) {}
 
 	PostProcessPass::PostProcessPass(PostProcessPass&& pass) noexcept = default;
 
@@ -32,6 +35,8 @@ namespace mage::rendering {
 		::operator=(PostProcessPass&& pass) noexcept = default;
 
 	void PostProcessPass::DispatchDOF(const U32x2& viewport_size) const noexcept {
+		MAGE_PROFILE_FUNCTION();
+
 		// CS: Bind the compute shader.
 		m_dof_cs->BindShader(m_device_context);
 
@@ -46,9 +51,11 @@ namespace mage::rendering {
 	void PostProcessPass::DispatchLDR(const U32x2& viewport_size, 
 									  ToneMapping tone_mapping) const noexcept {
 
+		MAGE_PROFILE_FUNCTION();
+
 		// CS: Bind the compute shader.
-		const auto cs = CreateLowDynamicRangeCS(m_resource_manager, 
-												tone_mapping);
+		const ShaderPermutation permutation(BRDF::Lambertian, tone_mapping);
+		const auto& cs = m_ldr_cs.Get(permutation);
 		cs->BindShader(m_device_context);
 
 		// Dispatch the pass.
@@ -8,6 +8,7 @@
 #include "renderer\configuration.hpp"
 #include "renderer\state_manager.hpp"
 #include "resource\rendering_resource_manager.hpp"
+#include "resource\shader\shader_permutation.hpp"
 
 #pragma endregion
 
@@ -135,5 +136,10 @@ namespace mage::rendering {
 		 A pointer to the compute shader of this post-process pass.
 		 */
 		ComputeShaderPtr m_dof_cs;
+
+		/**
+		 The LDR compute shader permutations of this post-process pass.
+		 */
+		ShaderPermutationTable< ComputeShader > m_ldr_cs;
 	};
 }
\ No newline at end of file
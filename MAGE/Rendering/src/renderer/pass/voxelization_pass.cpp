@@ -6,17 +6,89 @@
 #include "renderer\pass\voxelization_pass.hpp"
 #include "renderer\state_manager.hpp"
 #include "resource\shader\shader_factory.hpp"
+#include "system\profiler.hpp"
 
 // Include HLSL bindings.
 #include "hlsl.hpp"
 
 #pragma endregion
 
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <limits>
+
+#pragma endregion
+
 //-----------------------------------------------------------------------------
 // Engine Definitions
 //-----------------------------------------------------------------------------
 namespace mage::rendering {
 
+	namespace {
+
+		/**
+		 The FNV-1a offset basis.
+		 */
+		constexpr U64 g_fnv_offset_basis = 14695981039346656037ull;
+
+		/**
+		 The FNV-1a prime.
+		 */
+		constexpr U64 g_fnv_prime = 1099511628211ull;
+
+		/**
+		 The maximum number of thread groups per dimension of a dispatch.
+		 */
+		constexpr size_t g_max_nb_groups 
+			= D3D11_CS_DISPATCH_MAX_THREAD_GROUPS_PER_DIMENSION;
+
+		/**
+		 Combines the given hash with the bytes of the given value.
+
+		 @tparam		T
+						The value type.
+		 @param[in]		hash
+						The hash.
+		 @param[in]		value
+						A reference to the value.
+		 @return		The combined hash.
+		 */
+		template< typename T >
+		[[nodiscard]]
+		U64 Hash(U64 hash, const T& value) noexcept {
+			const auto bytes = reinterpret_cast< const U8* >(&value);
+			for (size_t i = 0u; i < sizeof(T); ++i) {
+				hash = (hash ^ bytes[i]) * g_fnv_prime;
+			}
+			return hash;
+		}
+
+		/**
+		 Transforms the given AABB.
+
+		 @param[in]		aabb
+						A reference to the AABB.
+		 @param[in]		transform
+						The transformation matrix.
+		 @return		The AABB enclosing the transformed AABB.
+		 */
+		[[nodiscard]]
+		const AABB XM_CALLCONV TransformAABB(const AABB& aabb, 
+										 FXMMATRIX transform) noexcept {
+			// Arvo's method for transforming the centroid and extents.
+			const auto c = XMVector3TransformCoord(aabb.Centroid(), transform);
+			const auto e = 0.5f * aabb.Diagonal();
+			const auto r = XMVectorAbs(XMVectorSplatX(e) * transform.r[0])
+				         + XMVectorAbs(XMVectorSplatY(e) * transform.r[1])
+				         + XMVectorAbs(XMVectorSplatZ(e) * transform.r[2]);
+			return AABB(c - r, c + r);
+		}
+	}
+
 	VoxelizationPass::VoxelizationPass(ID3D11Device& device,
 									   ID3D11DeviceContext& device_context,
 									   StateManager& state_manager,
@@ -28,7 +100,17 @@ namespace mage::rendering {
 		m_vs(CreateVoxelizationVS(resource_manager)),
 		m_gs(CreateVoxelizationGS(resource_manager)),
 		m_cs(CreateVoxelizationCS(resource_manager)),
-		m_voxel_grid(MakeUnique< VoxelGrid >(device, 1u)) {
+		m_bricks_cs(CreateVoxelizationBricksCS(resource_manager)),
+		m_mip_cs(CreateVoxelizationMipCS(resource_manager)),
+		m_emissive_ps(CreateVoxelizationEmissivePS(resource_manager)),
+		m_ps(resource_manager, CreateVoxelizationPS,
+			 ShaderPermutation::s_tsnm_mask),
+		m_voxel_grid(MakeUnique< VoxelGrid >(device, 1u)),
+		m_baked_voxel_grid(),
+		m_tracker(1u, 1u),
+		m_brick_mask(device, 1u),
+		m_brick_list(device, 1u),
+		m_nb_revoxelized_bricks(0u) {
 
 		SetupRasterizerState(device);
 	}
@@ -72,7 +154,171 @@ namespace mage::rendering {
 			ComPtr< ID3D11Device > device;
 			m_device_context.get().GetDevice(device.ReleaseAndGetAddressOf());
 			m_voxel_grid = MakeUnique< VoxelGrid >(*device.Get(), resolution);
+			m_baked_voxel_grid.reset();
+
+			const auto r = static_cast< U32 >(resolution);
+			const auto brick_size = std::min(r, 
+				static_cast< U32 >(VOXEL_BRICK_SIZE));
+			m_tracker = VoxelBrickTracker(r, brick_size);
+		}
+	}
+
+	void VoxelizationPass::Track(const World& world) {
+		constexpr auto inf = std::numeric_limits< F32 >::infinity();
+		const F32x3 all_min(-inf, -inf, -inf);
+		const F32x3 all_max( inf,  inf,  inf);
+		
+		// The length of the shadows cast by directional lights.
+		const auto shadow_length = 1.8f * m_tracker.GetResolution() 
+			                            * m_tracker.GetVoxelSize();
+
+		AlignedVector< XMVECTOR > shadow_offsets;
+		AlignedVector< AABB > shadow_aabbs;
+
+		// Process the ambient lights.
+		world.ForEach< AmbientLight >([this, &all_min, &all_max]
+		(const AmbientLight& light) {
+			if (State::Active != light.GetState()) {
+				return;
+			}
+
+			const auto signature = Hash(g_fnv_offset_basis, 
+										light.GetRadianceSpectrum());
+			m_tracker.Track(light.GetGuid(), all_min, all_max, signature);
+		});
+
+		// Process the directional lights.
+		world.ForEach< DirectionalLight >([this, &all_min, &all_max, 
+										   &shadow_offsets, shadow_length]
+		(const DirectionalLight& light) {
+			if (State::Active != light.GetState()) {
+				return;
+			}
+
+			const auto& transform = light.GetOwner()->GetTransform();
+			const auto  d         = transform.GetWorldAxisZ();
+			
+			auto signature = Hash(g_fnv_offset_basis, 
+								  light.GetIrradianceSpectrum());
+			signature = Hash(signature, XMStore< F32x3 >(d));
+			signature = Hash(signature, light.UseShadows());
+			m_tracker.Track(light.GetGuid(), all_min, all_max, signature);
+
+			if (light.UseShadows()) {
+				shadow_offsets.push_back(shadow_length * d);
+			}
+		});
+
+		// Process the omni lights and spotlights.
+		const auto track_light = [this, &shadow_aabbs](const auto& light, 
+													   U64 signature) {
+			if (State::Active != light.GetState()) {
+				return;
+			}
+
+			const auto& transform = light.GetOwner()->GetTransform();
+			const auto  light_to_world = transform.GetObjectToWorldMatrix();
+			const auto  aabb = TransformAABB(light.GetAABB(), light_to_world);
+
+			signature = Hash(signature, light_to_world);
+			signature = Hash(signature, light.GetIntensitySpectrum());
+			signature = Hash(signature, light.GetRange());
+			signature = Hash(signature, light.UseShadows());
+			m_tracker.Track(light.GetGuid(),
+							XMStore< F32x3 >(aabb.MinPoint()),
+							XMStore< F32x3 >(aabb.MaxPoint()), 
+							signature);
+
+			if (light.UseShadows()) {
+				shadow_aabbs.push_back(aabb);
+			}
+		};
+
+		world.ForEach< OmniLight >([&track_light](const OmniLight& light) {
+			track_light(light, g_fnv_offset_basis);
+		});
+
+		world.ForEach< SpotLight >([&track_light](const SpotLight& light) {
+			auto signature = Hash(g_fnv_offset_basis, light.GetPenumbraAngle());
+			signature = Hash(signature, light.GetUmbraAngle());
+			track_light(light, signature);
+		});
+
+		// Process the models.
+		world.ForEach< Model >([this, &shadow_offsets, &shadow_aabbs]
+		(const Model& model) {
+
+			const auto& material = model.GetMaterial();
+
+			if (State::Active != model.GetState()
+				|| material.GetBaseColor()[3] < TRANSPARENCY_THRESHOLD) {
+				return;
+			}
+
+			const auto& transform       = model.GetOwner()->GetTransform();
+			const auto  object_to_world = transform.GetObjectToWorldMatrix();
+			const auto  aabb = TransformAABB(model.GetAABB(), object_to_world);
+
+			// The bricks affected by the model include the bricks of the 
+			// shadows cast by the model.
+			auto bounds = aabb;
+			for (const auto offset : shadow_offsets) {
+				bounds = AABB::Union(bounds, 
+					AABB(aabb.MinPoint() + offset, aabb.MaxPoint() + offset));
+			}
+			for (const auto& light_aabb : shadow_aabbs) {
+				if (light_aabb.Overlaps(aabb)) {
+					bounds = AABB::Union(bounds, light_aabb);
+				}
+			}
+
+			auto signature = Hash(g_fnv_offset_basis, object_to_world);
+			signature = Hash(signature, material.GetBaseColor());
+			signature = Hash(signature, material.IsEmissive());
+			signature = Hash(signature, material.GetBaseColorSRV());
+			signature = Hash(signature, material.GetNormalSRV());
+			m_tracker.Track(model.GetGuid(),
+							XMStore< F32x3 >(bounds.MinPoint()),
+							XMStore< F32x3 >(bounds.MaxPoint()),
+							signature);
+		});
+
+		// Remove the objects which are no longer present.
+		m_tracker.Prune();
+	}
+
+	bool VoxelizationPass::UpdateBricks() {
+		const auto n         = m_tracker.GetNumberOfBricksPerAxis();
+		const auto nb_bricks = m_tracker.GetNumberOfBricks();
+		const auto all_dirty = m_tracker.IsAllDirty()
+			|| g_max_nb_groups < m_tracker.GetNumberOfDirtyBricks();
+
+		m_nb_revoxelized_bricks = all_dirty 
+			? nb_bricks : m_tracker.GetNumberOfDirtyBricks();
+
+		AlignedVector< U32 > mask((nb_bricks + 31u) / 32u, 
+								  all_dirty ? 0xFFFFFFFFu : 0u);
+		AlignedVector< U32 > bricks;
+
+		if (!all_dirty) {
+			bricks.reserve(m_tracker.GetNumberOfDirtyBricks());
+			
+			for (const auto index : m_tracker.GetDirtyBricks()) {
+				auto brick = m_tracker.GetBrick(index);
+				// Voxel indices flip the y axis.
+				brick[1] = n - 1u - brick[1];
+
+				const auto gpu_index = brick[0] + n * (brick[1] + n * brick[2]);
+				mask[gpu_index >> 5u] |= 1u << (gpu_index & 31u);
+				bricks.push_back(brick[0] | (brick[1] << 10u) | (brick[2] << 20u));
+			}
+
+			m_brick_list.UpdateData(m_device_context, bricks);
 		}
+
+		m_brick_mask.UpdateData(m_device_context, mask);
+
+		return all_dirty;
 	}
 
 	void VoxelizationPass::BindFixedState() const noexcept {
@@ -97,15 +343,63 @@ namespace mage::rendering {
 	void XM_CALLCONV VoxelizationPass::Render(const World& world,
 											  FXMMATRIX world_to_projection,
 											  size_t resolution) {
+		MAGE_PROFILE_FUNCTION();
+
 		SetupVoxelGrid(resolution);
 
+		if (VoxelizationSettings::UsesBakedVoxelGrid()) {
+			const auto& grid = VoxelizationSettings::GetBakedVoxelGrid();
+			if (m_baked_voxel_grid != grid) {
+				m_voxel_grid->UploadVoxelTexture(m_device_context, *grid);
+				m_baked_voxel_grid = grid;
+			}
+
+			m_nb_revoxelized_bricks = 0u;
+			m_voxel_grid->BindVoxelTexture(m_device_context);
+			return;
+		}
+
+		if (m_baked_voxel_grid) {
+			// The voxel texture contains the baked voxel grid.
+			m_baked_voxel_grid.reset();
+			m_tracker.MarkAllDirty();
+		}
+
+		m_tracker.SetGrid(VoxelizationSettings::GetVoxelGridCenter(),
+						  VoxelizationSettings::GetVoxelSize(),
+						  VoxelizationSettings::UsesClipmap());
+		Track(world);
+
+		if (!m_tracker.IsDirty()) {
+			// The voxel texture is still up to date.
+			m_nb_revoxelized_bricks = 0u;
+			m_voxel_grid->BindVoxelTexture(m_device_context);
+			return;
+		}
+
+		const auto all_dirty = UpdateBricks();
+
+		// PS: Bind the brick mask.
+		m_brick_mask.Bind< Pipeline::PS >(m_device_context, 
+										  SLOT_SRV_VOXEL_BRICK_MASK);
+		
 		m_voxel_grid->BindBeginVoxelizationBuffer(m_device_context);
 		Render(world, world_to_projection);
 		m_voxel_grid->BindEndVoxelizationBuffer(m_device_context);
 
+		// CS: Bind the brick list.
+		m_brick_list.Bind< Pipeline::CS >(m_device_context, 
+										  SLOT_SRV_VOXEL_BRICKS);
+
 		m_voxel_grid->BindBeginVoxelizationTexture(m_device_context);
-		Dispatch();
+		Dispatch(all_dirty);
 		m_voxel_grid->BindEndVoxelizationTexture(m_device_context);
+
+		GenerateMips(all_dirty);
+
+		m_voxel_grid->BindVoxelTexture(m_device_context);
+
+		m_tracker.ClearDirty();
 	}
 
 	void XM_CALLCONV VoxelizationPass::Render(const World& world,
@@ -119,9 +413,8 @@ namespace mage::rendering {
 		// All emissive models.
 		//---------------------------------------------------------------------
 		{
-			const PixelShaderPtr ps = CreateVoxelizationEmissivePS(m_resource_manager);
 			// PS: Bind the pixel shader.
-			ps->BindShader(m_device_context);
+			m_emissive_ps->BindShader(m_device_context);
 		}
 
 		// Process the models.
@@ -143,8 +436,9 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 		{
 			constexpr bool tsnm = false;
-			const PixelShaderPtr ps = CreateVoxelizationPS(m_resource_manager, 
-														   tsnm);
+			const ShaderPermutation permutation(BRDF::Lambertian, ToneMapping::None,
+												tsnm);
+			const auto& ps = m_ps.Get(permutation);
 			// PS: Bind the pixel shader.
 			ps->BindShader(m_device_context);
 		}
@@ -169,8 +463,9 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 		{
 			constexpr bool tsnm = true;
-			const PixelShaderPtr ps = CreateVoxelizationPS(m_resource_manager, 
-														   tsnm);
+			const ShaderPermutation permutation(BRDF::Lambertian, ToneMapping::None,
+												tsnm);
+			const auto& ps = m_ps.Get(permutation);
 			// PS: Bind the pixel shader.
 			ps->BindShader(m_device_context);
 		}
@@ -203,6 +498,13 @@ namespace mage::rendering {
 			return;
 		}
 
+		// Skip the models not overlapping any dirty brick.
+		const auto aabb = TransformAABB(model.GetAABB(), object_to_world);
+		if (!m_tracker.IsDirty(XMStore< F32x3 >(aabb.MinPoint()),
+							   XMStore< F32x3 >(aabb.MaxPoint()))) {
+			return;
+		}
+
 		const auto& material             = model.GetMaterial();
 
 		// Bind the constant buffer of the model.
@@ -224,14 +526,42 @@ namespace mage::rendering {
 		model.Draw(m_device_context);
 	}
 
-	void VoxelizationPass::Dispatch() const noexcept {
+	void VoxelizationPass::Dispatch(bool all_dirty) const noexcept {
+		if (all_dirty) {
+			// CS: Bind the compute shader.
+			m_cs->BindShader(m_device_context);
+
+			// Dispatch.
+			const auto nb_groups = GetNumberOfGroups(
+				static_cast< U32 >(m_voxel_grid->GetResolution()), 
+				GROUP_SIZE_3D_DEFAULT);
+			Pipeline::Dispatch(m_device_context, nb_groups, nb_groups, nb_groups);
+		}
+		else {
+			// CS: Bind the compute shader.
+			m_bricks_cs->BindShader(m_device_context);
+
+			// Dispatch (one group per dirty brick).
+			const auto nb_groups = static_cast< U32 >(m_brick_list.size());
+			Pipeline::Dispatch(m_device_context, nb_groups, 1u, 1u);
+		}
+	}
+
+	void VoxelizationPass::GenerateMips(bool all_dirty) const noexcept {
+		if (all_dirty) {
+			m_voxel_grid->GenerateMips(m_device_context);
+			return;
+		}
+
 		// CS: Bind the compute shader.
-		m_cs->BindShader(m_device_context);
+		m_mip_cs->BindShader(m_device_context);
 
-		// Dispatch.
-		const auto nb_groups = GetNumberOfGroups(
-			static_cast< U32 >(m_voxel_grid->GetResolution()), 
-			GROUP_SIZE_3D_DEFAULT);
-		Pipeline::Dispatch(m_device_context, nb_groups, nb_groups, nb_groups);
+		// Dispatch (one group per dirty brick) for each mip level.
+		const auto nb_groups = static_cast< U32 >(m_brick_list.size());
+		for (U32 i = 1u; i < m_voxel_grid->GetNumberOfMipLevels(); ++i) {
+			m_voxel_grid->BindBeginVoxelizationMip(m_device_context, i);
+			Pipeline::Dispatch(m_device_context, nb_groups, 1u, 1u);
+		}
+		m_voxel_grid->BindEndVoxelizationMip(m_device_context);
 	}
 }
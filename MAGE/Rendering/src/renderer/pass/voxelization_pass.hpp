@@ -5,9 +5,12 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
+#include "renderer\buffer\structured_buffer.hpp"
 #include "renderer\buffer\voxel_grid.hpp"
+#include "renderer\voxel_brick_tracker.hpp"
 #include "renderer\state_manager.hpp"
 #include "resource\rendering_resource_manager.hpp"
+#include "resource\shader\shader_permutation.hpp"
 #include "scene\rendering_world.hpp"
 
 #pragma endregion
@@ -98,7 +101,12 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 
 		/**
-		 Renders the world.
+		 Renders the world. Only the bricks of the voxel grid affected by 
+		 changes of the world since the previous call are revoxelized.
+
+		 If the baked voxel grid is used (see 
+		 VoxelizationSettings::UsesBakedVoxelGrid), the baked voxel grid is 
+		 uploaded once instead, and the world is not voxelized.
 
 		 @param[in]		world
 						A reference to the world.
@@ -113,6 +121,18 @@ namespace mage::rendering {
 			                    FXMMATRIX world_to_projection,
 								size_t resolution);
 
+		/**
+		 Returns the number of bricks revoxelized by the last call to 
+		 render of this voxelization pass.
+
+		 @return		The number of bricks revoxelized by the last call to 
+						render of this voxelization pass.
+		 */
+		[[nodiscard]]
+		size_t GetNumberOfRevoxelizedBricks() const noexcept {
+			return m_nb_revoxelized_bricks;
+		}
+
 	private:
 
 		//---------------------------------------------------------------------
@@ -131,6 +151,25 @@ namespace mage::rendering {
 		 */
 		void SetupVoxelGrid(size_t resolution);
 
+		/**
+		 Tracks the models and lights of the given world to determine the 
+		 dirty bricks of the voxel grid of this voxelization pass.
+
+		 @param[in]		world
+						A reference to the world.
+		 */
+		void Track(const World& world);
+
+		/**
+		 Updates the brick mask and brick list of this voxelization pass for 
+		 the dirty bricks.
+
+		 @return		@c true if all bricks are dirty. @c false otherwise.
+		 @throws		Exception
+						Failed to update the brick buffers.
+		 */
+		bool UpdateBricks();
+
 		/**
 		 Binds the fixed state of this voxelization pass.
 		 */
@@ -162,8 +201,20 @@ namespace mage::rendering {
 
 		/**
 		 Dispatches this voxelization pass.
+
+		 @param[in]		all_dirty
+						@c true if all bricks are dirty. @c false otherwise.
+		 */
+		void Dispatch(bool all_dirty) const noexcept;
+
+		/**
+		 Generates the mip levels of the voxel texture of this voxelization 
+		 pass.
+
+		 @param[in]		all_dirty
+						@c true if all bricks are dirty. @c false otherwise.
 		 */
-		void Dispatch() const noexcept;
+		void GenerateMips(bool all_dirty) const noexcept;
 			
 		//---------------------------------------------------------------------
 		// Member Variables
@@ -204,9 +255,58 @@ namespace mage::rendering {
 		 */
 		ComputeShaderPtr m_cs;
 
+		/**
+		 A pointer to the brick compute shader of this voxelization pass.
+		 */
+		ComputeShaderPtr m_bricks_cs;
+
+		/**
+		 A pointer to the brick mip compute shader of this voxelization pass.
+		 */
+		ComputeShaderPtr m_mip_cs;
+
+		/**
+		 A pointer to the emissive pixel shader of this voxelization pass.
+		 */
+		PixelShaderPtr m_emissive_ps;
+
+		/**
+		 The pixel shader permutations of this voxelization pass.
+		 */
+		ShaderPermutationTable< PixelShader > m_ps;
+
 		/**
 		 The voxel grid of this voxelization pass. 
 		 */
 		UniquePtr< VoxelGrid > m_voxel_grid;
+
+		/**
+		 A pointer to the baked voxel grid uploaded to the voxel grid of this 
+		 voxelization pass (or @c nullptr if the voxel grid is voxelized on 
+		 the GPU).
+		 */
+		SharedPtr< const SparseVoxelGrid > m_baked_voxel_grid;
+
+		/**
+		 The brick tracker of this voxelization pass.
+		 */
+		VoxelBrickTracker m_tracker;
+
+		/**
+		 The brick mask (one bit per brick) of this voxelization pass.
+		 */
+		StructuredBuffer< U32 > m_brick_mask;
+
+		/**
+		 The brick list (one packed brick per dirty brick) of this 
+		 voxelization pass.
+		 */
+		StructuredBuffer< U32 > m_brick_list;
+
+		/**
+		 The number of bricks revoxelized by the last call to render of this 
+		 voxelization pass.
+		 */
+		size_t m_nb_revoxelized_bricks;
 	};
 }
\ No newline at end of file
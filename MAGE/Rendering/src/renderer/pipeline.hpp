@@ -6,6 +6,7 @@
 #pragma region
 
 #include "direct3d11.hpp"
+#include "renderer\binding_cache.hpp"
 #include "type\types.hpp"
 
 #pragma endregion
@@ -45,7 +46,7 @@ namespace mage::rendering {
 			             U32 vertex_start) noexcept {
 
 			device_context.Draw(nb_vertices, vertex_start);
-			OnDraw();
+			OnDraw(nb_vertices);
 		}
 
 		static void DrawInstanced(ID3D11DeviceContext& device_context,
@@ -58,7 +59,7 @@ namespace mage::rendering {
 										 nb_instances, 
 										 vertex_start, 
 										 instance_start);
-			OnDraw();
+			OnDraw(nb_indices_per_instance * nb_instances);
 		}
 
 		static void DrawIndexed(ID3D11DeviceContext& device_context,
@@ -67,7 +68,7 @@ namespace mage::rendering {
 			                    U32 index_offset = 0u) noexcept {
 
 			device_context.DrawIndexed(nb_indices, index_start, index_offset);
-			OnDraw();
+			OnDraw(nb_indices);
 		}
 
 		static void DrawIndexedInstanced(ID3D11DeviceContext& device_context,
@@ -82,7 +83,7 @@ namespace mage::rendering {
 												index_start,
 												index_offset, 
 												instance_start);
-			OnDraw();
+			OnDraw(nb_indices_per_instance * nb_instances);
 		}
 
 		static void Dispatch(ID3D11DeviceContext& device_context,
@@ -120,6 +121,38 @@ namespace mage::rendering {
 
 		#pragma endregion
 
+		//---------------------------------------------------------------------
+		// Class Member Methods: State Cache
+		//---------------------------------------------------------------------
+		#pragma region
+
+		/**
+		 Resets the state cache of the pipeline.
+
+		 Subsequent bindings to the given device context which are identical
+		 to the currently bound values are skipped. Bindings to other device
+		 contexts are always issued.
+
+		 @param[in]		device_context
+						A reference to the device context.
+		 */
+		static void ResetStateCache(ID3D11DeviceContext& device_context) noexcept {
+			s_state_cache.m_device_context = &device_context;
+			InvalidateStateCache();
+		}
+
+		/**
+		 Invalidates the state cache of the pipeline.
+
+		 This must be called whenever the state of the device context of the
+		 state cache is changed without using the pipeline.
+		 */
+		static void InvalidateStateCache() noexcept {
+			s_state_cache.Invalidate();
+		}
+
+		#pragma endregion
+
 		//---------------------------------------------------------------------
 		// Class Member Methods: Resource Mapping/Updating
 		//---------------------------------------------------------------------
@@ -371,6 +404,12 @@ namespace mage::rendering {
 				                        DXGI_FORMAT format, 
 				                        U32 offset = 0u) noexcept {
 
+				const IndexBufferBinding binding = { &buffer, format, offset };
+				if (IsRedundant(device_context, s_state_cache.m_index_buffer,
+								0u, 1u, &binding)) {
+					return;
+				}
+
 				device_context.IASetIndexBuffer(&buffer, format, offset);
 			}
 
@@ -397,6 +436,15 @@ namespace mage::rendering {
 				                          const U32* strides, 
 				                          const U32* offsets) noexcept {
 
+				VertexBufferBinding bindings[D3D11_IA_VERTEX_INPUT_RESOURCE_SLOT_COUNT];
+				for (U32 i = 0u; i < nb_buffers; ++i) {
+					bindings[i] = { buffers[i], strides[i], offsets[i] };
+				}
+				if (IsRedundant(device_context, s_state_cache.m_vertex_buffers,
+								slot, nb_buffers, bindings)) {
+					return;
+				}
+
 				device_context.IASetVertexBuffers(slot, 
 												  nb_buffers, 
 												  buffers, 
@@ -407,12 +455,23 @@ namespace mage::rendering {
 			static void BindPrimitiveTopology(ID3D11DeviceContext& device_context,
 				                              D3D11_PRIMITIVE_TOPOLOGY topology) noexcept {
 
+				if (IsRedundant(device_context, s_state_cache.m_primitive_topology,
+								0u, 1u, &topology)) {
+					return;
+				}
+
 				device_context.IASetPrimitiveTopology(topology);
 			}
 
 			static void BindInputLayout(ID3D11DeviceContext& device_context,
 				                        ID3D11InputLayout& input_layout) noexcept {
 
+				ID3D11InputLayout* const layout = &input_layout;
+				if (IsRedundant(device_context, s_state_cache.m_input_layout,
+								0u, 1u, &layout)) {
+					return;
+				}
+
 				device_context.IASetInputLayout(&input_layout);
 			}
 		};
@@ -466,6 +525,14 @@ namespace mage::rendering {
 				                   ID3D11ClassInstance* const* class_instances, 
 				                   U32 nb_class_instances) noexcept {
 				
+				if (0u != nb_class_instances) {
+					s_state_cache.m_vs.m_shader.Invalidate();
+				}
+				else if (IsRedundant(device_context, s_state_cache.m_vs.m_shader,
+									 0u, 1u, &shader)) {
+					return;
+				}
+
 				device_context.VSSetShader(shader, 
 										   class_instances, 
 										   nb_class_instances);
@@ -518,6 +585,11 @@ namespace mage::rendering {
 				                            U32 nb_buffers, 
 				                            ID3D11Buffer* const* buffers) noexcept {
 					
+				if (IsRedundant(device_context, s_state_cache.m_vs.m_cbs,
+								slot, nb_buffers, buffers)) {
+					return;
+				}
+
 				device_context.VSSetConstantBuffers(slot, nb_buffers, buffers);
 			}
 			
@@ -569,6 +641,11 @@ namespace mage::rendering {
 				                 U32 nb_srvs, 
 				                 ID3D11ShaderResourceView* const* srvs) noexcept {
 					
+				if (IsRedundant(device_context, s_state_cache.m_vs.m_srvs,
+								slot, nb_srvs, srvs)) {
+					return;
+				}
+
 				device_context.VSSetShaderResources(slot, nb_srvs, srvs);
 			}
 			
@@ -619,6 +696,11 @@ namespace mage::rendering {
 				                     U32 nb_samplers, 
 				                     ID3D11SamplerState* const* samplers) noexcept {
 					
+				if (IsRedundant(device_context, s_state_cache.m_vs.m_samplers,
+								slot, nb_samplers, samplers)) {
+					return;
+				}
+
 				device_context.VSSetSamplers(slot, nb_samplers, samplers);
 			}
 		};
@@ -672,6 +754,14 @@ namespace mage::rendering {
 				                   ID3D11ClassInstance* const* class_instances, 
 				                   U32 nb_class_instances) noexcept {
 				
+				if (0u != nb_class_instances) {
+					s_state_cache.m_hs.m_shader.Invalidate();
+				}
+				else if (IsRedundant(device_context, s_state_cache.m_hs.m_shader,
+									 0u, 1u, &shader)) {
+					return;
+				}
+
 				device_context.HSSetShader(shader, 
 										   class_instances, 
 										   nb_class_instances);
@@ -724,6 +814,11 @@ namespace mage::rendering {
 				                            U32 nb_buffers, 
 				                            ID3D11Buffer* const* buffers) noexcept {
 					
+				if (IsRedundant(device_context, s_state_cache.m_hs.m_cbs,
+								slot, nb_buffers, buffers)) {
+					return;
+				}
+
 				device_context.HSSetConstantBuffers(slot, nb_buffers, buffers);
 			}
 			
@@ -775,6 +870,11 @@ namespace mage::rendering {
 				                 U32 nb_srvs, 
 				                 ID3D11ShaderResourceView* const* srvs) noexcept {
 					
+				if (IsRedundant(device_context, s_state_cache.m_hs.m_srvs,
+								slot, nb_srvs, srvs)) {
+					return;
+				}
+
 				device_context.HSSetShaderResources(slot, nb_srvs, srvs);
 			}
 
@@ -825,6 +925,11 @@ namespace mage::rendering {
 				                     U32 nb_samplers, 
 				                     ID3D11SamplerState* const* samplers) noexcept {
 					
+				if (IsRedundant(device_context, s_state_cache.m_hs.m_samplers,
+								slot, nb_samplers, samplers)) {
+					return;
+				}
+
 				device_context.HSSetSamplers(slot, nb_samplers, samplers);
 			}
 		};
@@ -890,6 +995,14 @@ namespace mage::rendering {
 				                   ID3D11ClassInstance* const* class_instances, 
 				                   U32 nb_class_instances) noexcept {
 				
+				if (0u != nb_class_instances) {
+					s_state_cache.m_ds.m_shader.Invalidate();
+				}
+				else if (IsRedundant(device_context, s_state_cache.m_ds.m_shader,
+									 0u, 1u, &shader)) {
+					return;
+				}
+
 				device_context.DSSetShader(shader, 
 										   class_instances, 
 										   nb_class_instances);
@@ -942,6 +1055,11 @@ namespace mage::rendering {
 				                            U32 nb_buffers, 
 				                            ID3D11Buffer* const* buffers) noexcept {
 					
+				if (IsRedundant(device_context, s_state_cache.m_ds.m_cbs,
+								slot, nb_buffers, buffers)) {
+					return;
+				}
+
 				device_context.DSSetConstantBuffers(slot, nb_buffers, buffers);
 			}
 			
@@ -993,6 +1111,11 @@ namespace mage::rendering {
 				                 U32 nb_srvs, 
 				                 ID3D11ShaderResourceView* const* srvs) noexcept {
 					
+				if (IsRedundant(device_context, s_state_cache.m_ds.m_srvs,
+								slot, nb_srvs, srvs)) {
+					return;
+				}
+
 				device_context.DSSetShaderResources(slot, nb_srvs, srvs);
 			}
 
@@ -1043,6 +1166,11 @@ namespace mage::rendering {
 				                     U32 nb_samplers, 
 				                     ID3D11SamplerState* const* samplers) noexcept {
 					
+				if (IsRedundant(device_context, s_state_cache.m_ds.m_samplers,
+								slot, nb_samplers, samplers)) {
+					return;
+				}
+
 				device_context.DSSetSamplers(slot, nb_samplers, samplers);
 			}
 		};
@@ -1096,6 +1224,14 @@ namespace mage::rendering {
 				                   ID3D11ClassInstance* const* class_instances, 
 				                   U32 nb_class_instances) noexcept {
 				
+				if (0u != nb_class_instances) {
+					s_state_cache.m_gs.m_shader.Invalidate();
+				}
+				else if (IsRedundant(device_context, s_state_cache.m_gs.m_shader,
+									 0u, 1u, &shader)) {
+					return;
+				}
+
 				device_context.GSSetShader(shader, 
 										   class_instances, 
 										   nb_class_instances);
@@ -1148,6 +1284,11 @@ namespace mage::rendering {
 				                            U32 nb_buffers, 
 				                            ID3D11Buffer* const* buffers) noexcept {
 					
+				if (IsRedundant(device_context, s_state_cache.m_gs.m_cbs,
+								slot, nb_buffers, buffers)) {
+					return;
+				}
+
 				device_context.GSSetConstantBuffers(slot, nb_buffers, buffers);
 			}
 			
@@ -1199,6 +1340,11 @@ namespace mage::rendering {
 				                 U32 nb_srvs, 
 				                 ID3D11ShaderResourceView* const* srvs) noexcept {
 					
+				if (IsRedundant(device_context, s_state_cache.m_gs.m_srvs,
+								slot, nb_srvs, srvs)) {
+					return;
+				}
+
 				device_context.GSSetShaderResources(slot, nb_srvs, srvs);
 			}
 			
@@ -1249,6 +1395,11 @@ namespace mage::rendering {
 				                     U32 nb_samplers, 
 				                     ID3D11SamplerState* const* samplers) noexcept {
 					
+				if (IsRedundant(device_context, s_state_cache.m_gs.m_samplers,
+								slot, nb_samplers, samplers)) {
+					return;
+				}
+
 				device_context.GSSetSamplers(slot, nb_samplers, samplers);
 			}
 		};
@@ -1299,6 +1450,11 @@ namespace mage::rendering {
 			static void BindState(ID3D11DeviceContext& device_context,
 				                  ID3D11RasterizerState* state) noexcept {
 
+				if (IsRedundant(device_context, s_state_cache.m_rasterizer_state,
+								0u, 1u, &state)) {
+					return;
+				}
+
 				device_context.RSSetState(state);
 			}
 			
@@ -1372,6 +1528,14 @@ namespace mage::rendering {
 				                   ID3D11ClassInstance* const* class_instances, 
 				                   U32 nb_class_instances) noexcept {
 				
+				if (0u != nb_class_instances) {
+					s_state_cache.m_ps.m_shader.Invalidate();
+				}
+				else if (IsRedundant(device_context, s_state_cache.m_ps.m_shader,
+									 0u, 1u, &shader)) {
+					return;
+				}
+
 				device_context.PSSetShader(shader, 
 										   class_instances, 
 										   nb_class_instances);
@@ -1424,6 +1588,11 @@ namespace mage::rendering {
 				                            U32 nb_buffers, 
 				                            ID3D11Buffer* const* buffers) noexcept {
 					
+				if (IsRedundant(device_context, s_state_cache.m_ps.m_cbs,
+								slot, nb_buffers, buffers)) {
+					return;
+				}
+
 				device_context.PSSetConstantBuffers(slot, nb_buffers, buffers);
 			}
 			
@@ -1475,6 +1644,11 @@ namespace mage::rendering {
 				                 U32 nb_srvs, 
 				                 ID3D11ShaderResourceView* const* srvs) noexcept {
 					
+				if (IsRedundant(device_context, s_state_cache.m_ps.m_srvs,
+								slot, nb_srvs, srvs)) {
+					return;
+				}
+
 				device_context.PSSetShaderResources(slot, nb_srvs, srvs);
 			}
 			
@@ -1525,6 +1699,11 @@ namespace mage::rendering {
 				                     U32 nb_samplers, 
 				                     ID3D11SamplerState* const* samplers) noexcept {
 					
+				if (IsRedundant(device_context, s_state_cache.m_ps.m_samplers,
+								slot, nb_samplers, samplers)) {
+					return;
+				}
+
 				device_context.PSSetSamplers(slot, nb_samplers, samplers);
 			}
 		};
@@ -1551,6 +1730,12 @@ namespace mage::rendering {
 				                              ID3D11DepthStencilState* state, 
 				                              U32 stencil_ref = 0u) noexcept {
 				
+				const DepthStencilStateBinding binding = { state, stencil_ref };
+				if (IsRedundant(device_context, s_state_cache.m_depth_stencil_state,
+								0u, 1u, &binding)) {
+					return;
+				}
+
 				device_context.OMSetDepthStencilState(state, stencil_ref);
 			}
 
@@ -1566,6 +1751,18 @@ namespace mage::rendering {
 				                       const F32 blend_factor[4], 
 				                       U32 sample_mask = 0xffffffff) noexcept {
 				
+				BlendStateBinding binding = { state, { 1.0f, 1.0f, 1.0f, 1.0f }, 
+											  sample_mask };
+				if (blend_factor) {
+					for (size_t i = 0u; i < 4u; ++i) {
+						binding.m_blend_factor[i] = blend_factor[i];
+					}
+				}
+				if (IsRedundant(device_context, s_state_cache.m_blend_state,
+								0u, 1u, &binding)) {
+					return;
+				}
+
 				device_context.OMSetBlendState(state, blend_factor, sample_mask);
 			}
 
@@ -1586,6 +1783,10 @@ namespace mage::rendering {
 				                       ID3D11RenderTargetView* const* rtvs, 
 				                       ID3D11DepthStencilView* dsv) noexcept {
 				
+				// Binding an output view unbinds its resource from all input
+				// slots.
+				s_state_cache.InvalidateResourceBindings();
+
 				device_context.OMSetRenderTargets(nb_views, rtvs, dsv);
 			}
 			
@@ -1655,6 +1856,10 @@ namespace mage::rendering {
 				                              ID3D11UnorderedAccessView* const* uavs,
 				                              const U32* initial_counts = nullptr) noexcept {
 				
+				// Binding an output view unbinds its resource from all input
+				// slots.
+				s_state_cache.InvalidateResourceBindings();
+
 				device_context.OMSetRenderTargetsAndUnorderedAccessViews(
 					nb_views, rtvs, dsv, uav_slot, nb_uavs, uavs, initial_counts);
 			}
@@ -1761,6 +1966,14 @@ namespace mage::rendering {
 				                   ID3D11ClassInstance* const* class_instances, 
 				                   U32 nb_class_instances) noexcept {
 				
+				if (0u != nb_class_instances) {
+					s_state_cache.m_cs.m_shader.Invalidate();
+				}
+				else if (IsRedundant(device_context, s_state_cache.m_cs.m_shader,
+									 0u, 1u, &shader)) {
+					return;
+				}
+
 				device_context.CSSetShader(shader, 
 										   class_instances, 
 										   nb_class_instances);
@@ -1813,6 +2026,11 @@ namespace mage::rendering {
 				                            U32 nb_buffers, 
 				                            ID3D11Buffer* const* buffers) noexcept {
 					
+				if (IsRedundant(device_context, s_state_cache.m_cs.m_cbs,
+								slot, nb_buffers, buffers)) {
+					return;
+				}
+
 				device_context.CSSetConstantBuffers(slot, nb_buffers, buffers);
 			}
 			
@@ -1864,6 +2082,11 @@ namespace mage::rendering {
 				                 U32 nb_srvs, 
 				                 ID3D11ShaderResourceView* const* srvs) noexcept {
 					
+				if (IsRedundant(device_context, s_state_cache.m_cs.m_srvs,
+								slot, nb_srvs, srvs)) {
+					return;
+				}
+
 				device_context.CSSetShaderResources(slot, nb_srvs, srvs);
 			}
 			
@@ -1924,6 +2147,10 @@ namespace mage::rendering {
 				                 ID3D11UnorderedAccessView* const* uavs, 
 				                 const U32 *initial_counts = nullptr) noexcept {
 					
+				// Binding an unordered access view unbinds its resource from
+				// all input slots.
+				s_state_cache.InvalidateResourceBindings();
+
 				device_context.CSSetUnorderedAccessViews(slot, 
 														 nb_uavs, 
 														 uavs, 
@@ -1977,6 +2204,11 @@ namespace mage::rendering {
 				                     U32 nb_samplers, 
 				                     ID3D11SamplerState* const* samplers) noexcept {
 					
+				if (IsRedundant(device_context, s_state_cache.m_cs.m_samplers,
+								slot, nb_samplers, samplers)) {
+					return;
+				}
+
 				device_context.CSSetSamplers(slot, nb_samplers, samplers);
 			}
 		};
@@ -2000,14 +2232,257 @@ namespace mage::rendering {
 		 */
 		static U32 s_nb_draws;
 
+		/**
+		 The number of drawn vertices (of non-indirect draw calls)
+		 */
+		static U32 s_nb_vertices;
+
+		/**
+		 The number of issued (non-redundant) bindings
+		 */
+		static U32 s_nb_bindings;
+
+		/**
+		 The number of skipped (redundant) bindings
+		 */
+		static U32 s_nb_redundant_bindings;
+
 	private:
 
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 A struct of index buffer bindings.
+		 */
+		struct IndexBufferBinding final {
+
+		public:
+
+			[[nodiscard]]
+			bool operator==(const IndexBufferBinding& rhs) const noexcept {
+				return m_buffer == rhs.m_buffer
+					&& m_format == rhs.m_format
+					&& m_offset == rhs.m_offset;
+			}
+
+			ID3D11Buffer* m_buffer;
+
+			DXGI_FORMAT m_format;
+
+			U32 m_offset;
+		};
+
+		/**
+		 A struct of vertex buffer bindings.
+		 */
+		struct VertexBufferBinding final {
+
+		public:
+
+			[[nodiscard]]
+			bool operator==(const VertexBufferBinding& rhs) const noexcept {
+				return m_buffer == rhs.m_buffer
+					&& m_stride == rhs.m_stride
+					&& m_offset == rhs.m_offset;
+			}
+
+			ID3D11Buffer* m_buffer;
+
+			U32 m_stride;
+
+			U32 m_offset;
+		};
+
+		/**
+		 A struct of depth-stencil state bindings.
+		 */
+		struct DepthStencilStateBinding final {
+
+		public:
+
+			[[nodiscard]]
+			bool operator==(const DepthStencilStateBinding& rhs) const noexcept {
+				return m_state == rhs.m_state
+					&& m_stencil_ref == rhs.m_stencil_ref;
+			}
+
+			ID3D11DepthStencilState* m_state;
+
+			U32 m_stencil_ref;
+		};
+
+		/**
+		 A struct of blend state bindings.
+		 */
+		struct BlendStateBinding final {
+
+		public:
+
+			[[nodiscard]]
+			bool operator==(const BlendStateBinding& rhs) const noexcept {
+				return m_state == rhs.m_state
+					&& m_blend_factor[0] == rhs.m_blend_factor[0]
+					&& m_blend_factor[1] == rhs.m_blend_factor[1]
+					&& m_blend_factor[2] == rhs.m_blend_factor[2]
+					&& m_blend_factor[3] == rhs.m_blend_factor[3]
+					&& m_sample_mask == rhs.m_sample_mask;
+			}
+
+			ID3D11BlendState* m_state;
+
+			F32 m_blend_factor[4];
+
+			U32 m_sample_mask;
+		};
+
+		/**
+		 A struct of shader stage caches.
+
+		 @tparam		ShaderT
+						The shader type.
+		 */
+		template< typename ShaderT >
+		struct ShaderStageCache final {
+
+		public:
+
+			void Invalidate() noexcept {
+				m_shader.Invalidate();
+				m_cbs.Invalidate();
+				m_srvs.Invalidate();
+				m_samplers.Invalidate();
+			}
+
+			BindingCache< ShaderT*, 1u > m_shader;
+
+			BindingCache< ID3D11Buffer*, 
+				D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT > m_cbs;
+
+			BindingCache< ID3D11ShaderResourceView*, 
+				D3D11_COMMONSHADER_INPUT_RESOURCE_SLOT_COUNT > m_srvs;
+
+			BindingCache< ID3D11SamplerState*, 
+				D3D11_COMMONSHADER_SAMPLER_SLOT_COUNT > m_samplers;
+		};
+
+		/**
+		 A struct of state caches containing a shadow copy of the state
+		 bound to a device context.
+		 */
+		struct StateCache final {
+
+		public:
+
+			void Invalidate() noexcept {
+				m_vs.Invalidate();
+				m_hs.Invalidate();
+				m_ds.Invalidate();
+				m_gs.Invalidate();
+				m_ps.Invalidate();
+				m_cs.Invalidate();
+				m_index_buffer.Invalidate();
+				m_vertex_buffers.Invalidate();
+				m_primitive_topology.Invalidate();
+				m_input_layout.Invalidate();
+				m_rasterizer_state.Invalidate();
+				m_depth_stencil_state.Invalidate();
+				m_blend_state.Invalidate();
+			}
+
+			void InvalidateResourceBindings() noexcept {
+				m_vs.m_srvs.Invalidate();
+				m_hs.m_srvs.Invalidate();
+				m_ds.m_srvs.Invalidate();
+				m_gs.m_srvs.Invalidate();
+				m_ps.m_srvs.Invalidate();
+				m_cs.m_srvs.Invalidate();
+				m_index_buffer.Invalidate();
+				m_vertex_buffers.Invalidate();
+			}
+
+			ID3D11DeviceContext* m_device_context = nullptr;
+
+			ShaderStageCache< ID3D11VertexShader >   m_vs;
+			ShaderStageCache< ID3D11HullShader >     m_hs;
+			ShaderStageCache< ID3D11DomainShader >   m_ds;
+			ShaderStageCache< ID3D11GeometryShader > m_gs;
+			ShaderStageCache< ID3D11PixelShader >    m_ps;
+			ShaderStageCache< ID3D11ComputeShader >  m_cs;
+
+			BindingCache< IndexBufferBinding, 1u > m_index_buffer;
+
+			BindingCache< VertexBufferBinding, 
+				D3D11_IA_VERTEX_INPUT_RESOURCE_SLOT_COUNT > m_vertex_buffers;
+
+			BindingCache< D3D11_PRIMITIVE_TOPOLOGY, 1u > m_primitive_topology;
+
+			BindingCache< ID3D11InputLayout*, 1u > m_input_layout;
+
+			BindingCache< ID3D11RasterizerState*, 1u > m_rasterizer_state;
+
+			BindingCache< DepthStencilStateBinding, 1u > m_depth_stencil_state;
+
+			BindingCache< BlendStateBinding, 1u > m_blend_state;
+		};
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The state cache of the pipeline.
+		 */
+		static StateCache s_state_cache;
+
 		//---------------------------------------------------------------------
 		// Class Member Methods
 		//---------------------------------------------------------------------
 
-		static void OnDraw() noexcept {
+		static void OnDraw(U32 nb_vertices = 0u) noexcept {
 			++s_nb_draws;
+			s_nb_vertices += nb_vertices;
+		}
+
+		/**
+		 Checks whether the given binding is redundant, and updates the given
+		 binding cache otherwise.
+
+		 @tparam		T
+						The value type.
+		 @tparam		N
+						The number of slots.
+		 @param[in]		device_context
+						A reference to the device context.
+		 @param[in,out]	cache
+						A reference to the binding cache.
+		 @param[in]		slot
+						The first slot.
+		 @param[in]		nb_values
+						The number of values.
+		 @param[in]		values
+						A pointer to the array of values.
+		 @return		@c true if the given binding is redundant and can be 
+						skipped. @c false otherwise.
+		 */
+		template< typename T, size_t N >
+		[[nodiscard]]
+		static bool IsRedundant(ID3D11DeviceContext& device_context,
+								BindingCache< T, N >& cache,
+								U32 slot,
+								U32 nb_values,
+								const T* values) noexcept {
+
+			if (&device_context != s_state_cache.m_device_context
+				|| cache.Update(slot, nb_values, values)) {
+				
+				++s_nb_bindings;
+				return false;
+			}
+
+			++s_nb_redundant_bindings;
+			return true;
 		}
 	};
 
@@ -0,0 +1,157 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\probe\irradiance_volume.hpp"
+#include "exception\exception.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cmath>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	[[nodiscard]]
+	const std::array< F32, IrradianceVolume::s_nb_coefficients >
+		IrradianceVolume::GetSHBasis(const F32x3& d) noexcept {
+
+		const auto [x, y, z] = d;
+		return {
+			0.282095f,
+			0.488603f * y,
+			0.488603f * z,
+			0.488603f * x,
+			1.092548f * x * y,
+			1.092548f * y * z,
+			0.315392f * (3.0f * z * z - 1.0f),
+			1.092548f * x * z,
+			0.546274f * (x * x - y * y)
+		};
+	}
+
+	IrradianceVolume::IrradianceVolume() noexcept
+		: m_minimum(),
+		m_maximum(),
+		m_resolution(),
+		m_nb_passes(0u),
+		m_coefficients() {}
+
+	IrradianceVolume::IrradianceVolume(const F32x3& minimum,
+									   const F32x3& maximum,
+									   const U32x3& resolution,
+									   U32 nb_passes,
+									   std::vector< RGB > coefficients)
+		: m_minimum(minimum),
+		m_maximum(maximum),
+		m_resolution(resolution),
+		m_nb_passes(nb_passes),
+		m_coefficients(std::move(coefficients)) {
+
+		const size_t nb_probes = static_cast< size_t >(m_resolution[0])
+			                   * m_resolution[1] * m_resolution[2];
+		ThrowIfFailed(nb_probes * s_nb_coefficients == m_coefficients.size(),
+					  "Irradiance volume: invalid number of coefficients.");
+	}
+
+	IrradianceVolume::IrradianceVolume(
+		const IrradianceVolume& volume) = default;
+
+	IrradianceVolume::IrradianceVolume(
+		IrradianceVolume&& volume) noexcept = default;
+
+	IrradianceVolume::~IrradianceVolume() = default;
+
+	IrradianceVolume& IrradianceVolume
+		::operator=(const IrradianceVolume& volume) = default;
+
+	IrradianceVolume& IrradianceVolume
+		::operator=(IrradianceVolume&& volume) noexcept = default;
+
+	[[nodiscard]]
+	const F32x3 IrradianceVolume
+		::GetProbePosition(const U32x3& probe) const noexcept {
+
+		F32x3 p;
+		for (size_t i = 0u; i < 3u; ++i) {
+			p[i] = (1u < m_resolution[i])
+				? m_minimum[i] + (m_maximum[i] - m_minimum[i])
+				               * probe[i] / (m_resolution[i] - 1u)
+				: 0.5f * (m_minimum[i] + m_maximum[i]);
+		}
+
+		return p;
+	}
+
+	[[nodiscard]]
+	const RGB IrradianceVolume::GetIrradiance(const F32x3& p,
+											  const F32x3& n) const noexcept {
+		if (empty()) {
+			return RGB();
+		}
+
+		// The grid coordinates of the surface position.
+		U32x3 first, last;
+		F32x3 t;
+		for (size_t i = 0u; i < 3u; ++i) {
+			const auto extent = m_maximum[i] - m_minimum[i];
+			const auto max_g  = static_cast< F32 >(m_resolution[i] - 1u);
+			const auto g      = (0.0f < extent)
+				? std::clamp((p[i] - m_minimum[i]) * max_g / extent, 0.0f, max_g)
+				: 0.0f;
+			first[i] = static_cast< U32 >(g);
+			last[i]  = std::min(first[i] + 1u, m_resolution[i] - 1u);
+			t[i]     = g - first[i];
+		}
+
+		// Interpolate the coefficients of the eight surrounding probes.
+		std::array< RGB, s_nb_coefficients > coefficients;
+		coefficients.fill(RGB());
+		for (U32 corner = 0u; corner < 8u; ++corner) {
+			F32 weight = 1.0f;
+			U32x3 probe;
+			for (size_t i = 0u; i < 3u; ++i) {
+				const bool upper = (0u != (corner & (1u << i)));
+				probe[i] = upper ? last[i] : first[i];
+				weight  *= upper ? t[i] : 1.0f - t[i];
+			}
+			if (0.0f >= weight) {
+				continue;
+			}
+
+			const auto index = probe[0] + m_resolution[0]
+				             * (probe[1] + m_resolution[1] * probe[2]);
+			for (size_t j = 0u; j < s_nb_coefficients; ++j) {
+				const auto& c = m_coefficients[index * s_nb_coefficients + j];
+				for (size_t k = 0u; k < 3u; ++k) {
+					coefficients[j][k] += weight * c[k];
+				}
+			}
+		}
+
+		// Evaluate the spherical harmonics.
+		const auto Y = GetSHBasis(n);
+		RGB E;
+		for (size_t j = 0u; j < s_nb_coefficients; ++j) {
+			for (size_t k = 0u; k < 3u; ++k) {
+				E[k] += Y[j] * coefficients[j][k];
+			}
+		}
+		for (size_t k = 0u; k < 3u; ++k) {
+			E[k] = std::max(E[k], 0.0f);
+		}
+
+		return E;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,291 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "spectrum\spectrum.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <array>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 A class of irradiance volumes.
+
+	 An irradiance volume consists of a regular grid of irradiance probes
+	 spanning an AABB. Each probe stores the irradiance as second-order
+	 spherical harmonics (i.e. nine RGB coefficients), and the irradiance at
+	 an arbitrary position is obtained by trilinear interpolation of the
+	 eight surrounding probes. The probe with grid coordinates (x, y, z)
+	 corresponds to the index x + R_x * (y + R_y * z).
+	 */
+	class IrradianceVolume final {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The number of spherical harmonics coefficients per probe.
+		 */
+		static constexpr size_t s_nb_coefficients = 9u;
+
+		//---------------------------------------------------------------------
+		// Class Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Evaluates the (real, second-order) spherical harmonics basis
+		 functions in the given direction.
+
+		 @pre			@a d is normalized.
+		 @param[in]		d
+						A reference to the direction.
+		 @return		The spherical harmonics basis functions evaluated in
+						the given direction.
+		 */
+		[[nodiscard]]
+		static const std::array< F32, s_nb_coefficients >
+			GetSHBasis(const F32x3& d) noexcept;
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs an (empty) irradiance volume.
+		 */
+		IrradianceVolume() noexcept;
+
+		/**
+		 Constructs an irradiance volume.
+
+		 @param[in]		minimum
+						A reference to the (world space) minimum point of the
+						irradiance volume.
+		 @param[in]		maximum
+						A reference to the (world space) maximum point of the
+						irradiance volume.
+		 @param[in]		resolution
+						A reference to the number of probes along each axis.
+		 @param[in]		nb_passes
+						The number of baked sampling passes.
+		 @param[in]		coefficients
+						A vector containing the irradiance coefficients of
+						all probes.
+		 @throws		Exception
+						The given resolution and number of coefficients are
+						inconsistent.
+		 */
+		explicit IrradianceVolume(const F32x3& minimum,
+								  const F32x3& maximum,
+								  const U32x3& resolution,
+								  U32 nb_passes,
+								  std::vector< RGB > coefficients);
+
+		/**
+		 Constructs an irradiance volume from the given irradiance volume.
+
+		 @param[in]		volume
+						A reference to the irradiance volume to copy.
+		 */
+		IrradianceVolume(const IrradianceVolume& volume);
+
+		/**
+		 Constructs an irradiance volume by moving the given irradiance
+		 volume.
+
+		 @param[in]		volume
+						A reference to the irradiance volume to move.
+		 */
+		IrradianceVolume(IrradianceVolume&& volume) noexcept;
+
+		/**
+		 Destructs this irradiance volume.
+		 */
+		~IrradianceVolume();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given irradiance volume to this irradiance volume.
+
+		 @param[in]		volume
+						A reference to the irradiance volume to copy.
+		 @return		A reference to the copy of the given irradiance volume
+						(i.e. this irradiance volume).
+		 */
+		IrradianceVolume& operator=(const IrradianceVolume& volume);
+
+		/**
+		 Moves the given irradiance volume to this irradiance volume.
+
+		 @param[in]		volume
+						A reference to the irradiance volume to move.
+		 @return		A reference to the moved irradiance volume (i.e. this
+						irradiance volume).
+		 */
+		IrradianceVolume& operator=(IrradianceVolume&& volume) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Checks whether this irradiance volume is empty.
+
+		 @return		@c true if this irradiance volume contains no probes.
+						@c false otherwise.
+		 */
+		[[nodiscard]]
+		bool empty() const noexcept {
+			return m_coefficients.empty();
+		}
+
+		/**
+		 Returns the (world space) minimum point of this irradiance volume.
+
+		 @return		A reference to the (world space) minimum point of
+						this irradiance volume.
+		 */
+		[[nodiscard]]
+		const F32x3& GetMinimum() const noexcept {
+			return m_minimum;
+		}
+
+		/**
+		 Returns the (world space) maximum point of this irradiance volume.
+
+		 @return		A reference to the (world space) maximum point of
+						this irradiance volume.
+		 */
+		[[nodiscard]]
+		const F32x3& GetMaximum() const noexcept {
+			return m_maximum;
+		}
+
+		/**
+		 Returns the number of probes along each axis of this irradiance
+		 volume.
+
+		 @return		A reference to the number of probes along each axis
+						of this irradiance volume.
+		 */
+		[[nodiscard]]
+		const U32x3& GetResolution() const noexcept {
+			return m_resolution;
+		}
+
+		/**
+		 Returns the number of probes of this irradiance volume.
+
+		 @return		The number of probes of this irradiance volume.
+		 */
+		[[nodiscard]]
+		size_t GetNumberOfProbes() const noexcept {
+			return m_coefficients.size() / s_nb_coefficients;
+		}
+
+		/**
+		 Returns the number of baked sampling passes of this irradiance
+		 volume.
+
+		 @return		The number of baked sampling passes of this
+						irradiance volume.
+		 */
+		[[nodiscard]]
+		U32 GetNumberOfPasses() const noexcept {
+			return m_nb_passes;
+		}
+
+		/**
+		 Returns the irradiance coefficients of this irradiance volume.
+
+		 @return		A reference to a vector containing the irradiance
+						coefficients of all probes of this irradiance volume.
+		 */
+		[[nodiscard]]
+		const std::vector< RGB >& GetCoefficients() const noexcept {
+			return m_coefficients;
+		}
+
+		/**
+		 Returns the (world space) position of the given probe of this
+		 irradiance volume.
+
+		 @param[in]		probe
+						A reference to the grid coordinates of the probe.
+		 @return		The (world space) position of the given probe of this
+						irradiance volume.
+		 */
+		[[nodiscard]]
+		const F32x3 GetProbePosition(const U32x3& probe) const noexcept;
+
+		/**
+		 Returns the irradiance at the given surface point of this irradiance
+		 volume.
+
+		 @param[in]		p
+						A reference to the (world space) surface position.
+		 @param[in]		n
+						A reference to the (normalized, world space) surface
+						normal.
+		 @return		The irradiance at the given surface point of this
+						irradiance volume.
+		 */
+		[[nodiscard]]
+		const RGB GetIrradiance(const F32x3& p,
+								const F32x3& n) const noexcept;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The (world space) minimum point of this irradiance volume.
+		 */
+		F32x3 m_minimum;
+
+		/**
+		 The (world space) maximum point of this irradiance volume.
+		 */
+		F32x3 m_maximum;
+
+		/**
+		 The number of probes along each axis of this irradiance volume.
+		 */
+		U32x3 m_resolution;
+
+		/**
+		 The number of baked sampling passes of this irradiance volume.
+		 */
+		U32 m_nb_passes;
+
+		/**
+		 A vector containing the irradiance coefficients of all probes of
+		 this irradiance volume.
+		 */
+		std::vector< RGB > m_coefficients;
+	};
+}
\ No newline at end of file
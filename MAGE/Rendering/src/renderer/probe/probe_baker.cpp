@@ -0,0 +1,295 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\probe\probe_baker.hpp"
+#include "renderer\baking_scene.hpp"
+#include "parallel\parallel.hpp"
+#include "sampling\fibonacci.hpp"
+#include "sampling\qmc.hpp"
+#include "sampling\rng.hpp"
+#include "sampling\sampling.hpp"
+#include "transform\basis.hpp"
+#include "exception\exception.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cmath>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	namespace {
+
+		/**
+		 The convolution of each spherical harmonics coefficient with the
+		 clamped cosine lobe (i.e. the conversion from radiance to
+		 irradiance).
+		 */
+		constexpr F32 g_cosine_lobe[IrradianceVolume::s_nb_coefficients] = {
+			XM_PI,
+			XM_2PI / 3.0f, XM_2PI / 3.0f, XM_2PI / 3.0f,
+			XM_PIDIV4, XM_PIDIV4, XM_PIDIV4, XM_PIDIV4, XM_PIDIV4
+		};
+
+		/**
+		 Returns the seed of the random number generator of the given probe
+		 and pass.
+
+		 @param[in]		seed
+						The seed of the probe baker.
+		 @param[in]		pass
+						The index of the pass.
+		 @param[in]		probe
+						The index of the probe (or zero for the random number
+						generator shared by all probes).
+		 @return		The seed of the random number generator of the given
+						probe and pass.
+		 */
+		[[nodiscard]]
+		constexpr U32 GetSeed(U32 seed, U32 pass, size_t probe) noexcept {
+			auto hash = seed ^ (0x9E3779B9u * (pass + 1u));
+			hash ^= 0x85EBCA6Bu * static_cast< U32 >(probe + 1u);
+			hash ^= hash >> 16u;
+			hash *= 0x7FEB352Du;
+			hash ^= hash >> 15u;
+			return hash;
+		}
+
+		/**
+		 Traces the given path through the given baking scene.
+
+		 @param[in]		scene
+						A reference to the baking scene.
+		 @param[in]		origin
+						The origin of the path.
+		 @param[in]		direction
+						The (normalized) direction of the path.
+		 @param[in]		nb_bounces
+						The maximum number of indirect bounces.
+		 @param[in]		bias
+						The offset of the origin of secondary rays along the
+						surface normal.
+		 @param[in]		t_max
+						The maximum ray parameter.
+		 @param[in]		u
+						A reference to the sample of the first bounce.
+		 @param[in,out]	rng
+						A reference to the random number generator of the
+						other bounces.
+		 @return		The radiance arriving at the origin of the path from
+						the given direction.
+		 */
+		[[nodiscard]]
+		const XMVECTOR XM_CALLCONV Trace(const BakingScene& scene,
+										 FXMVECTOR origin,
+										 FXMVECTOR direction,
+										 U32 nb_bounces,
+										 F32 bias,
+										 F32 t_max,
+										 const F32x2& u,
+										 RNG& rng) noexcept {
+
+			auto L          = XMVectorZero();
+			auto throughput = XMVectorReplicate(1.0f);
+			auto o          = origin;
+			auto d          = direction;
+
+			for (U32 bounce = 0u; true; ++bounce) {
+				TriangleBVH::Hit hit;
+				if (!scene.Intersect(o, d, t_max, hit)) {
+					L += throughput * XMLoad(scene.GetAmbientRadiance());
+					break;
+				}
+
+				const auto& material = scene.GetMaterial(hit.m_triangle);
+				const auto  p        = o + hit.m_t * d;
+				auto        n        = XMLoad(scene.GetNormal(hit.m_triangle));
+				// Shade the side of the triangle facing the ray.
+				if (0.0f < XMVectorGetX(XMVector3Dot(n, d))) {
+					n = -n;
+				}
+
+				L += throughput * scene.GetRadiance(p, n, material, bias);
+
+				if (material.m_emissive || nb_bounces == bounce) {
+					break;
+				}
+
+				// Lambertian BRDF with cosine-weighted sampling:
+				// (base_color/pi) * cos / (cos/pi) = base_color
+				throughput *= XMLoad(material.m_base_color);
+
+				const auto sample = (0u == bounce)
+					? CosineWeightedSampleOnUnitHemisphere(u[0], u[1])
+					: CosineWeightedSampleOnUnitHemisphere(rng.UniformF32(),
+														   rng.UniformF32());
+				// The samples are expressed in a y-up tangent space.
+				const auto local = XMVectorSwizzle< 0, 2, 1, 3 >(XMLoad(sample));
+
+				d = XMVector3TransformNormal(local, OrthonormalBasis(n));
+				o = p + bias * n;
+			}
+
+			return L;
+		}
+
+		/**
+		 Bakes the given number of sampling passes of the given irradiance
+		 volume.
+
+		 @param[in]		scene
+						A reference to the baking scene.
+		 @param[in]		desc
+						A reference to the probe baker descriptor.
+		 @param[in,out]	volume
+						A reference to the irradiance volume.
+		 @param[in]		nb_passes
+						The number of additional sampling passes.
+		 */
+		void BakePasses(const BakingScene& scene,
+						const ProbeBakerDescriptor& desc,
+						IrradianceVolume& volume,
+						U32 nb_passes) {
+
+			constexpr auto nb_coefficients = IrradianceVolume::s_nb_coefficients;
+
+			const auto& resolution = volume.GetResolution();
+			const auto  nb_probes  = volume.GetNumberOfProbes();
+			const auto  nb_samples = desc.GetNumberOfSamples();
+			const auto  first_pass = volume.GetNumberOfPasses();
+			const auto  nb_bounces = desc.GetNumberOfBounces();
+
+			const auto diagonal = XMVectorGetX(XMVector3Length(
+				XMLoad(scene.GetMaximum()) - XMLoad(scene.GetMinimum())));
+			const auto bias     = std::max(0.0001f * diagonal, 0.0001f);
+			const auto t_max    = 2.0f * diagonal + 1.0f;
+
+			// Generate the sample directions of each pass.
+			std::vector< F32x3 > directions(nb_passes * nb_samples);
+			for (U32 i = 0u; i < nb_passes; ++i) {
+				RNG rng(GetSeed(desc.GetSeed(), first_pass + i, 0u));
+				const auto rotation = XMMatrixRotationRollPitchYaw(
+					XM_2PI * rng.UniformF32(),
+					XM_2PI * rng.UniformF32(),
+					XM_2PI * rng.UniformF32());
+
+				const gsl::span< F32x3 > samples(&directions[i * nb_samples],
+												 nb_samples);
+				FibonacciSpiralSamplesOnUnitSphere(samples);
+				for (auto& sample : samples) {
+					sample = XMStore< F32x3 >(
+						XMVector3TransformNormal(XMLoad(sample), rotation));
+				}
+			}
+
+			auto coefficients = volume.GetCoefficients();
+
+			ParallelFor(0u, nb_probes, [&](size_t probe) {
+				const U32x3 index(
+					static_cast< U32 >(probe % resolution[0]),
+					static_cast< U32 >(probe / resolution[0] % resolution[1]),
+					static_cast< U32 >(probe / resolution[0] / resolution[1]));
+				const auto origin = XMLoad(volume.GetProbePosition(index));
+
+				F32 sums[nb_coefficients][3] = {};
+
+				for (U32 i = 0u; i < nb_passes; ++i) {
+					RNG rng(GetSeed(desc.GetSeed(), first_pass + i, probe + 1u));
+					const F32x2 offset(rng.UniformF32(), rng.UniformF32());
+
+					for (U32 j = 0u; j < nb_samples; ++j) {
+						const auto& d = directions[i * nb_samples + j];
+
+						// Cranley-Patterson rotation of the Hammersley sample
+						auto u = Hammersley2D(j, nb_samples);
+						u[0] += offset[0];
+						u[1] += offset[1];
+						u[0] -= std::floor(u[0]);
+						u[1] -= std::floor(u[1]);
+
+						const auto L = XMStore< F32x3 >(
+							Trace(scene, origin, XMLoad(d), nb_bounces,
+								  bias, t_max, u, rng));
+
+						// Project the radiance onto the SH basis.
+						const auto Y = IrradianceVolume::GetSHBasis(d);
+						for (size_t k = 0u; k < nb_coefficients; ++k) {
+							sums[k][0] += Y[k] * L[0];
+							sums[k][1] += Y[k] * L[1];
+							sums[k][2] += Y[k] * L[2];
+						}
+					}
+				}
+
+				// Average the new passes with the previous passes.
+				const auto inv_nb_passes = 1.0f / (first_pass + nb_passes);
+				const auto sample_weight = 4.0f * XM_PI / nb_samples;
+				for (size_t k = 0u; k < nb_coefficients; ++k) {
+					auto& c = coefficients[probe * nb_coefficients + k];
+					for (size_t l = 0u; l < 3u; ++l) {
+						const auto E = g_cosine_lobe[k] * sample_weight * sums[k][l];
+						c[l] = (c[l] * first_pass + E) * inv_nb_passes;
+					}
+				}
+			});
+
+			volume = IrradianceVolume(volume.GetMinimum(),
+									  volume.GetMaximum(),
+									  resolution,
+									  first_pass + nb_passes,
+									  std::move(coefficients));
+		}
+	}
+
+	const IrradianceVolume BakeIrradianceVolume(const World& world,
+												const ProbeBakerDescriptor& desc) {
+
+		const BakingScene scene(world);
+
+		// Set up the grid of probes.
+		const auto& minimum = scene.GetMinimum();
+		const auto& maximum = scene.GetMaximum();
+		U32x3 resolution;
+		for (size_t i = 0u; i < 3u; ++i) {
+			const auto nb_cells = std::ceil((maximum[i] - minimum[i])
+											/ desc.GetCellSize());
+			resolution[i] = std::min(desc.GetMaximumNumberOfProbes(),
+									 static_cast< U32 >(nb_cells) + 1u);
+		}
+
+		const auto nb_probes = static_cast< size_t >(resolution[0])
+			                 * resolution[1] * resolution[2];
+
+		IrradianceVolume volume(minimum, maximum, resolution, 0u,
+			std::vector< RGB >(nb_probes * IrradianceVolume::s_nb_coefficients,
+							   RGB()));
+
+		BakePasses(scene, desc, volume, desc.GetNumberOfPasses());
+
+		return volume;
+	}
+
+	void RefineIrradianceVolume(const World& world,
+								const ProbeBakerDescriptor& desc,
+								IrradianceVolume& volume,
+								U32 nb_passes) {
+
+		ThrowIfFailed(!volume.empty(),
+					  "Irradiance volume: no probes to refine.");
+
+		const BakingScene scene(world);
+		BakePasses(scene, desc, volume, nb_passes);
+	}
+}
\ No newline at end of file
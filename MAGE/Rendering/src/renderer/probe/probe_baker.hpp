@@ -0,0 +1,71 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\probe\irradiance_volume.hpp"
+#include "renderer\probe\probe_baker_descriptor.hpp"
+#include "scene\rendering_world.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 Bakes the irradiance volume of the given world.
+
+	 The bounds of the (active, opaque and static) models whose meshes have
+	 a CPU copy are covered by a regular grid of probes. All active lights
+	 are included. For each probe and pass, paths are traced in a (randomly
+	 rotated) Fibonacci spiral of directions against a bounding volume
+	 hierarchy of these triangles. At each path vertex, the emitted and
+	 directly reflected radiance is gathered (as in the Lambertian shading
+	 of the renderer with ray-traced shadows), and the path continues in a
+	 cosine-weighted direction (Hammersley samples for the first bounce).
+	 Escaping paths gather the ambient radiance. The radiance is projected
+	 onto second-order spherical harmonics and convolved with the clamped
+	 cosine lobe to obtain the irradiance.
+
+	 The probes are baked in parallel, and all samples only depend on the
+	 seed, pass and probe indices, so the result is deterministic.
+
+	 @param[in]		world
+					A reference to the world.
+	 @param[in]		desc
+					A reference to the probe baker descriptor.
+	 @return		The irradiance volume of the given world.
+	 @throws		Exception
+					Failed to bake the irradiance volume.
+	 */
+	[[nodiscard]]
+	const IrradianceVolume BakeIrradianceVolume(const World& world,
+												const ProbeBakerDescriptor& desc
+												= ProbeBakerDescriptor());
+
+	/**
+	 Refines the given irradiance volume of the given world by baking
+	 additional sampling passes.
+
+	 @pre			@a volume is not empty.
+	 @param[in]		world
+					A reference to the world.
+	 @param[in]		desc
+					A reference to the probe baker descriptor. The number
+					of passes of the descriptor is ignored.
+	 @param[in,out]	volume
+					A reference to the irradiance volume.
+	 @param[in]		nb_passes
+					The number of additional sampling passes.
+	 @throws		Exception
+					Failed to refine the irradiance volume.
+	 */
+	void RefineIrradianceVolume(const World& world,
+								const ProbeBakerDescriptor& desc,
+								IrradianceVolume& volume,
+								U32 nb_passes = 1u);
+}
\ No newline at end of file
@@ -0,0 +1,246 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "type\scalar_types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 A class of probe baker descriptors describing how the irradiance volume
+	 of a world must be baked.
+
+	 The quality of an irradiance volume is determined by its number of
+	 sampling passes: each pass traces the same number of paths per probe
+	 with its own (fixed) random rotation of the sample directions, and the
+	 passes are averaged. Hence, an irradiance volume can be refined
+	 progressively by baking additional passes, with the same result as
+	 baking all passes at once.
+	 */
+	class ProbeBakerDescriptor final {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a probe baker descriptor.
+
+		 @param[in]		cell_size
+						The (world space) distance between neighboring
+						probes.
+		 @param[in]		nb_samples
+						The number of paths traced per probe and pass.
+		 @param[in]		nb_passes
+						The number of sampling passes (i.e. the quality
+						level).
+		 @param[in]		nb_bounces
+						The maximum number of indirect bounces per path.
+		 @param[in]		max_nb_probes
+						The maximum number of probes along each axis.
+		 @param[in]		seed
+						The seed of the random number generators.
+		 */
+		constexpr explicit ProbeBakerDescriptor(F32 cell_size     = 2.0f,
+												U32 nb_samples    = 64u,
+												U32 nb_passes     = 4u,
+												U32 nb_bounces    = 2u,
+												U32 max_nb_probes = 32u,
+												U32 seed          = 0u) noexcept
+			: m_cell_size(std::max(0.01f, cell_size)),
+			m_nb_samples(std::max(1u, nb_samples)),
+			m_nb_passes(std::max(1u, nb_passes)),
+			m_nb_bounces(nb_bounces),
+			m_max_nb_probes(std::max(1u, max_nb_probes)),
+			m_seed(seed) {}
+
+		/**
+		 Constructs a probe baker descriptor from the given probe baker
+		 descriptor.
+
+		 @param[in]		desc
+						A reference to the probe baker descriptor to copy.
+		 */
+		constexpr ProbeBakerDescriptor(
+			const ProbeBakerDescriptor& desc) noexcept = default;
+
+		/**
+		 Constructs a probe baker descriptor by moving the given probe baker
+		 descriptor.
+
+		 @param[in]		desc
+						A reference to the probe baker descriptor to move.
+		 */
+		constexpr ProbeBakerDescriptor(
+			ProbeBakerDescriptor&& desc) noexcept = default;
+
+		/**
+		 Destructs this probe baker descriptor.
+		 */
+		~ProbeBakerDescriptor() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given probe baker descriptor to this probe baker
+		 descriptor.
+
+		 @param[in]		desc
+						A reference to the probe baker descriptor to copy.
+		 @return		A reference to the copy of the given probe baker
+						descriptor (i.e. this probe baker descriptor).
+		 */
+		constexpr ProbeBakerDescriptor& operator=(
+			const ProbeBakerDescriptor& desc) noexcept = default;
+
+		/**
+		 Moves the given probe baker descriptor to this probe baker
+		 descriptor.
+
+		 @param[in]		desc
+						A reference to the probe baker descriptor to move.
+		 @return		A reference to the moved probe baker descriptor (i.e.
+						this probe baker descriptor).
+		 */
+		constexpr ProbeBakerDescriptor& operator=(
+			ProbeBakerDescriptor&& desc) noexcept = default;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the (world space) distance between neighboring probes of
+		 this probe baker descriptor.
+
+		 @return		The (world space) distance between neighboring probes
+						of this probe baker descriptor.
+		 */
+		[[nodiscard]]
+		constexpr F32 GetCellSize() const noexcept {
+			return m_cell_size;
+		}
+
+		/**
+		 Returns the number of paths traced per probe and pass of this probe
+		 baker descriptor.
+
+		 @return		The number of paths traced per probe and pass of this
+						probe baker descriptor.
+		 */
+		[[nodiscard]]
+		constexpr U32 GetNumberOfSamples() const noexcept {
+			return m_nb_samples;
+		}
+
+		/**
+		 Returns the number of sampling passes of this probe baker
+		 descriptor.
+
+		 @return		The number of sampling passes of this probe baker
+						descriptor.
+		 */
+		[[nodiscard]]
+		constexpr U32 GetNumberOfPasses() const noexcept {
+			return m_nb_passes;
+		}
+
+		/**
+		 Returns the maximum number of indirect bounces per path of this
+		 probe baker descriptor.
+
+		 @return		The maximum number of indirect bounces per path of
+						this probe baker descriptor.
+		 */
+		[[nodiscard]]
+		constexpr U32 GetNumberOfBounces() const noexcept {
+			return m_nb_bounces;
+		}
+
+		/**
+		 Returns the maximum number of probes along each axis of this probe
+		 baker descriptor.
+
+		 @return		The maximum number of probes along each axis of this
+						probe baker descriptor.
+		 */
+		[[nodiscard]]
+		constexpr U32 GetMaximumNumberOfProbes() const noexcept {
+			return m_max_nb_probes;
+		}
+
+		/**
+		 Returns the seed of the random number generators of this probe baker
+		 descriptor.
+
+		 @return		The seed of the random number generators of this
+						probe baker descriptor.
+		 */
+		[[nodiscard]]
+		constexpr U32 GetSeed() const noexcept {
+			return m_seed;
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The (world space) distance between neighboring probes of this probe
+		 baker descriptor.
+		 */
+		F32 m_cell_size;
+
+		/**
+		 The number of paths traced per probe and pass of this probe baker
+		 descriptor.
+		 */
+		U32 m_nb_samples;
+
+		/**
+		 The number of sampling passes of this probe baker descriptor.
+		 */
+		U32 m_nb_passes;
+
+		/**
+		 The maximum number of indirect bounces per path of this probe baker
+		 descriptor.
+		 */
+		U32 m_nb_bounces;
+
+		/**
+		 The maximum number of probes along each axis of this probe baker
+		 descriptor.
+		 */
+		U32 m_max_nb_probes;
+
+		/**
+		 The seed of the random number generators of this probe baker
+		 descriptor.
+		 */
+		U32 m_seed;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,365 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\render_graph.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <functional>
+#include <queue>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	RenderGraph::RenderGraph() = default;
+
+	RenderGraph::RenderGraph(const RenderGraph& graph) = default;
+
+	RenderGraph::RenderGraph(RenderGraph&& graph) noexcept = default;
+
+	RenderGraph::~RenderGraph() = default;
+
+	RenderGraph& RenderGraph::operator=(const RenderGraph& graph) = default;
+
+	RenderGraph& RenderGraph::operator=(RenderGraph&& graph) noexcept = default;
+
+	void RenderGraph::Clear() noexcept {
+		m_passes.clear();
+		m_textures.clear();
+		m_schedule.clear();
+		m_physical_descriptors.clear();
+	}
+
+	RenderGraph::TextureHandle RenderGraph
+		::CreateTexture(const TextureDescriptor& desc) {
+
+		const auto texture = static_cast< TextureHandle >(m_textures.size());
+
+		auto& t  = m_textures.emplace_back();
+		t.m_desc = desc;
+
+		return texture;
+	}
+
+	RenderGraph::TextureHandle RenderGraph::ImportTexture() {
+		const auto texture = static_cast< TextureHandle >(m_textures.size());
+
+		auto& t      = m_textures.emplace_back();
+		t.m_imported = true;
+
+		return texture;
+	}
+
+	RenderGraph::PassHandle RenderGraph::AddPass(bool side_effects) {
+		const auto pass = static_cast< PassHandle >(m_passes.size());
+
+		auto& p          = m_passes.emplace_back();
+		p.m_side_effects = side_effects;
+
+		return pass;
+	}
+
+	void RenderGraph::Read(PassHandle pass, TextureHandle texture) {
+		GetPass(pass).m_reads.push_back(texture);
+	}
+
+	void RenderGraph::Write(PassHandle pass, TextureHandle texture) {
+		GetPass(pass).m_writes.push_back(texture);
+	}
+
+	void RenderGraph::Compile() {
+		ComputeDependencies();
+		CullPasses();
+		ComputeSchedule();
+		ComputeAliasing();
+		ComputeUnbinds();
+	}
+
+	[[nodiscard]]
+	U64 RenderGraph::GetTransientSize() const noexcept {
+		U64 size = 0u;
+		for (const auto& texture : m_textures) {
+			if (!texture.m_imported) {
+				size += texture.m_desc.GetSize();
+			}
+		}
+
+		return size;
+	}
+
+	[[nodiscard]]
+	U64 RenderGraph::GetPhysicalSize() const noexcept {
+		U64 size = 0u;
+		for (const auto& desc : m_physical_descriptors) {
+			size += desc.GetSize();
+		}
+
+		return size;
+	}
+
+	[[nodiscard]]
+	bool RenderGraph::Overlap(TextureHandle texture1,
+							  TextureHandle texture2) const noexcept {
+
+		if (texture1 == texture2) {
+			return true;
+		}
+
+		const auto index1 = GetTexture(texture1).m_physical_index;
+		const auto index2 = GetTexture(texture2).m_physical_index;
+		return s_no_physical_index != index1 && index1 == index2;
+	}
+
+	void RenderGraph::ComputeDependencies() {
+		static constexpr auto s_no_pass = std::numeric_limits< U32 >::max();
+
+		std::vector< U32 > last_writers(m_textures.size(), s_no_pass);
+		std::vector< std::vector< U32 > > readers(m_textures.size());
+
+		// The passes are visited in declaration order, so all dependencies
+		// point to preceding passes.
+		for (U32 i = 0u; i < static_cast< U32 >(m_passes.size()); ++i) {
+			auto& pass = m_passes[i];
+			pass.m_producers.clear();
+			pass.m_predecessors.clear();
+
+			for (const auto texture : pass.m_reads) {
+				const auto index = static_cast< size_t >(texture);
+
+				// Read-after-write
+				if (const auto writer = last_writers[index];
+					s_no_pass != writer && i != writer) {
+
+					pass.m_producers.push_back(writer);
+					pass.m_predecessors.push_back(writer);
+				}
+
+				readers[index].push_back(i);
+			}
+
+			for (const auto texture : pass.m_writes) {
+				const auto index = static_cast< size_t >(texture);
+
+				// Write-after-write
+				if (const auto writer = last_writers[index];
+					s_no_pass != writer && i != writer) {
+
+					pass.m_predecessors.push_back(writer);
+				}
+
+				// Write-after-read
+				for (const auto reader : readers[index]) {
+					if (i != reader) {
+						pass.m_predecessors.push_back(reader);
+					}
+				}
+
+				readers[index].clear();
+				last_writers[index] = i;
+			}
+		}
+	}
+
+	void RenderGraph::CullPasses() {
+		std::vector< U32 > stack;
+		stack.reserve(m_passes.size());
+
+		// Collect the passes with side effects or writing imported textures.
+		for (U32 i = 0u; i < static_cast< U32 >(m_passes.size()); ++i) {
+			auto& pass = m_passes[i];
+
+			const auto writes_imported = std::any_of(
+				pass.m_writes.cbegin(), pass.m_writes.cend(),
+				[this](TextureHandle texture) noexcept {
+					return GetTexture(texture).m_imported;
+				});
+
+			pass.m_culled = !(pass.m_side_effects || writes_imported);
+			if (!pass.m_culled) {
+				stack.push_back(i);
+			}
+		}
+
+		// Keep the passes producing textures read by non-culled passes.
+		while (!stack.empty()) {
+			const auto& pass = m_passes[stack.back()];
+			stack.pop_back();
+
+			for (const auto producer : pass.m_producers) {
+				if (m_passes[producer].m_culled) {
+					m_passes[producer].m_culled = false;
+					stack.push_back(producer);
+				}
+			}
+		}
+	}
+
+	void RenderGraph::ComputeSchedule() {
+		const auto nb_passes = m_passes.size();
+
+		std::vector< U32 > in_degrees(nb_passes, 0u);
+		std::vector< std::vector< U32 > > successors(nb_passes);
+		for (U32 i = 0u; i < static_cast< U32 >(nb_passes); ++i) {
+			if (m_passes[i].m_culled) {
+				continue;
+			}
+
+			for (const auto predecessor : m_passes[i].m_predecessors) {
+				if (!m_passes[predecessor].m_culled) {
+					++in_degrees[i];
+					successors[predecessor].push_back(i);
+				}
+			}
+		}
+
+		// Kahn's algorithm with ties broken by the declaration order.
+		std::priority_queue< U32, std::vector< U32 >, std::greater< U32 > > ready;
+		for (U32 i = 0u; i < static_cast< U32 >(nb_passes); ++i) {
+			if (!m_passes[i].m_culled && 0u == in_degrees[i]) {
+				ready.push(i);
+			}
+		}
+
+		m_schedule.clear();
+		while (!ready.empty()) {
+			const auto i = ready.top();
+			ready.pop();
+
+			m_schedule.push_back(static_cast< PassHandle >(i));
+
+			for (const auto successor : successors[i]) {
+				if (0u == --in_degrees[successor]) {
+					ready.push(successor);
+				}
+			}
+		}
+	}
+
+	void RenderGraph::ComputeAliasing() {
+		for (auto& texture : m_textures) {
+			texture.m_first_use      = s_no_physical_index;
+			texture.m_last_use       = 0u;
+			texture.m_physical_index = s_no_physical_index;
+		}
+
+		// Compute the lifetimes.
+		for (size_t i = 0u; i < m_schedule.size(); ++i) {
+			const auto& pass = GetPass(m_schedule[i]);
+
+			const auto update = [this, i](TextureHandle handle) noexcept {
+				auto& texture = GetTexture(handle);
+				texture.m_first_use = std::min(texture.m_first_use, i);
+				texture.m_last_use  = std::max(texture.m_last_use,  i);
+			};
+
+			std::for_each(pass.m_reads.cbegin(),  pass.m_reads.cend(),  update);
+			std::for_each(pass.m_writes.cbegin(), pass.m_writes.cend(), update);
+		}
+
+		// Collect the used transient textures in order of first use.
+		std::vector< U32 > textures;
+		textures.reserve(m_textures.size());
+		for (U32 i = 0u; i < static_cast< U32 >(m_textures.size()); ++i) {
+			const auto& texture = m_textures[i];
+			if (!texture.m_imported
+				&& s_no_physical_index != texture.m_first_use) {
+
+				textures.push_back(i);
+			}
+		}
+
+		std::stable_sort(textures.begin(), textures.end(),
+			[this](U32 lhs, U32 rhs) noexcept {
+				return m_textures[lhs].m_first_use
+					 < m_textures[rhs].m_first_use;
+			});
+
+		// Assign each texture to the first compatible physical texture which
+		// is no longer used.
+		m_physical_descriptors.clear();
+		std::vector< size_t > last_uses;
+		for (const auto i : textures) {
+			auto& texture = m_textures[i];
+
+			for (size_t j = 0u; j < m_physical_descriptors.size(); ++j) {
+				if (last_uses[j] < texture.m_first_use
+					&& m_physical_descriptors[j] == texture.m_desc) {
+
+					texture.m_physical_index = j;
+					break;
+				}
+			}
+
+			if (s_no_physical_index == texture.m_physical_index) {
+				texture.m_physical_index = m_physical_descriptors.size();
+				m_physical_descriptors.push_back(texture.m_desc);
+				last_uses.push_back(texture.m_last_use);
+			}
+			else {
+				last_uses[texture.m_physical_index] = texture.m_last_use;
+			}
+		}
+	}
+
+	void RenderGraph::ComputeUnbinds() {
+		const auto nb_textures = m_textures.size();
+
+		std::vector< bool > inputs(nb_textures, false);
+		std::vector< bool > outputs(nb_textures, false);
+
+		for (auto& pass : m_passes) {
+			pass.m_input_unbinds.clear();
+			pass.m_output_unbinds.clear();
+		}
+
+		for (const auto handle : m_schedule) {
+			auto& pass = GetPass(handle);
+
+			// Textures bound as input by a preceding pass of which the
+			// (physical) texture is written by this pass.
+			for (const auto write : pass.m_writes) {
+				for (U32 i = 0u; i < static_cast< U32 >(nb_textures); ++i) {
+					const auto texture = static_cast< TextureHandle >(i);
+					if (inputs[i] && Overlap(texture, write)) {
+						pass.m_input_unbinds.push_back(texture);
+						inputs[i] = false;
+					}
+				}
+			}
+
+			// Textures bound as output by the preceding pass of which the
+			// (physical) texture is read by this pass.
+			for (const auto read : pass.m_reads) {
+				for (U32 i = 0u; i < static_cast< U32 >(nb_textures); ++i) {
+					const auto texture = static_cast< TextureHandle >(i);
+					if (outputs[i] && Overlap(texture, read)) {
+						pass.m_output_unbinds.push_back(texture);
+						outputs[i] = false;
+					}
+				}
+			}
+
+			// The outputs of this pass replace the outputs of the preceding
+			// pass.
+			std::fill(outputs.begin(), outputs.end(), false);
+			for (const auto write : pass.m_writes) {
+				outputs[static_cast< size_t >(write)] = true;
+			}
+			for (const auto read : pass.m_reads) {
+				inputs[static_cast< size_t >(read)] = true;
+			}
+		}
+	}
+}
\ No newline at end of file
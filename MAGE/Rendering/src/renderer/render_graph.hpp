@@ -0,0 +1,635 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "type\types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <limits>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 A class of render graphs.
+
+	 A render graph consists of passes declaring their reads and writes of
+	 (virtual) texture resources. Transient textures are owned by the render
+	 graph, imported textures are owned by the caller. Compiling a render
+	 graph:
+	 <ol>
+	  <li>culls the passes which do not (transitively) contribute to an
+	  imported texture or have no side effects;</li>
+	  <li>orders the remaining passes topologically (ties are broken by the
+	  declaration order);</li>
+	  <li>computes the lifetime of each transient texture;</li>
+	  <li>aliases transient textures with identical descriptors and disjoint
+	  lifetimes onto the same physical texture;</li>
+	  <li>computes for each pass the textures which need to be unbound as
+	  input or output before executing that pass.</li>
+	 </ol>
+	 A render graph does not depend on the device (context) and only
+	 produces the schedule and the physical texture assignment. It does not
+	 execute the passes itself.
+
+	 A pass which accumulates into a texture (e.g., blending or depth
+	 testing) must declare a read as well as a write of that texture.
+	 */
+	class RenderGraph final {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 An enumeration of handles to render graph passes.
+		 */
+		enum class PassHandle : U32 {};
+
+		/**
+		 An enumeration of handles to render graph textures.
+		 */
+		enum class TextureHandle : U32 {};
+
+		/**
+		 A struct of texture descriptors.
+
+		 Textures can only be aliased if their descriptors are equal. The
+		 format and bind flags are opaque to the render graph.
+		 */
+		struct TextureDescriptor final {
+
+		public:
+
+			//-----------------------------------------------------------------
+			// Member Methods
+			//-----------------------------------------------------------------
+
+			/**
+			 Returns the size in bytes of a texture with this texture
+			 descriptor.
+
+			 @return		The size in bytes of a texture with this texture
+							descriptor.
+			 */
+			[[nodiscard]]
+			U64 GetSize() const noexcept {
+				return static_cast< U64 >(m_width) * m_height
+					 * m_nb_samples * m_texel_size;
+			}
+
+			/**
+			 Compares this texture descriptor to the given texture
+			 descriptor.
+
+			 @param[in]		desc
+							A reference to the texture descriptor to compare
+							with.
+			 @return		@c true if this texture descriptor is equal to the
+							given texture descriptor. @c false otherwise.
+			 */
+			[[nodiscard]]
+			bool operator==(const TextureDescriptor& desc) const noexcept {
+				return m_width      == desc.m_width
+					&& m_height     == desc.m_height
+					&& m_nb_samples == desc.m_nb_samples
+					&& m_format     == desc.m_format
+					&& m_bind_flags == desc.m_bind_flags
+					&& m_texel_size == desc.m_texel_size;
+			}
+
+			/**
+			 Compares this texture descriptor to the given texture
+			 descriptor.
+
+			 @param[in]		desc
+							A reference to the texture descriptor to compare
+							with.
+			 @return		@c true if this texture descriptor is not equal to
+							the given texture descriptor. @c false otherwise.
+			 */
+			[[nodiscard]]
+			bool operator!=(const TextureDescriptor& desc) const noexcept {
+				return !(*this == desc);
+			}
+
+			//-----------------------------------------------------------------
+			// Member Variables
+			//-----------------------------------------------------------------
+
+			/**
+			 The width in texels of this texture descriptor.
+			 */
+			U32 m_width = 0u;
+
+			/**
+			 The height in texels of this texture descriptor.
+			 */
+			U32 m_height = 0u;
+
+			/**
+			 The number of samples per texel of this texture descriptor.
+			 */
+			U32 m_nb_samples = 1u;
+
+			/**
+			 The (opaque) format of this texture descriptor.
+			 */
+			U32 m_format = 0u;
+
+			/**
+			 The (opaque) bind flags of this texture descriptor.
+			 */
+			U32 m_bind_flags = 0u;
+
+			/**
+			 The size in bytes of a sample of this texture descriptor.
+			 */
+			U32 m_texel_size = 0u;
+		};
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The physical index of textures which are not assigned to a physical
+		 texture (i.e. imported or unused textures).
+		 */
+		static constexpr size_t s_no_physical_index
+			= std::numeric_limits< size_t >::max();
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a render graph.
+		 */
+		RenderGraph();
+
+		/**
+		 Constructs a render graph from the given render graph.
+
+		 @param[in]		graph
+						A reference to the render graph to copy.
+		 */
+		RenderGraph(const RenderGraph& graph);
+
+		/**
+		 Constructs a render graph by moving the given render graph.
+
+		 @param[in]		graph
+						A reference to the render graph to move.
+		 */
+		RenderGraph(RenderGraph&& graph) noexcept;
+
+		/**
+		 Destructs this render graph.
+		 */
+		~RenderGraph();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given render graph to this render graph.
+
+		 @param[in]		graph
+						A reference to the render graph to copy.
+		 @return		A reference to the copy of the given render graph
+						(i.e. this render graph).
+		 */
+		RenderGraph& operator=(const RenderGraph& graph);
+
+		/**
+		 Moves the given render graph to this render graph.
+
+		 @param[in]		graph
+						A reference to the render graph to move.
+		 @return		A reference to the moved render graph (i.e. this
+						render graph).
+		 */
+		RenderGraph& operator=(RenderGraph&& graph) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods: Declaration
+		//---------------------------------------------------------------------
+
+		/**
+		 Removes all passes and textures from this render graph.
+		 */
+		void Clear() noexcept;
+
+		/**
+		 Creates a transient texture in this render graph.
+
+		 @param[in]		desc
+						A reference to the texture descriptor.
+		 @return		A handle to the texture.
+		 */
+		TextureHandle CreateTexture(const TextureDescriptor& desc);
+
+		/**
+		 Imports a texture in this render graph.
+
+		 Imported textures are never aliased and passes writing them are
+		 never culled.
+
+		 @return		A handle to the texture.
+		 */
+		TextureHandle ImportTexture();
+
+		/**
+		 Adds a pass to this render graph.
+
+		 @param[in]		side_effects
+						@c true if the pass has side effects besides writing
+						its declared textures (i.e. the pass may never be
+						culled). @c false otherwise.
+		 @return		A handle to the pass.
+		 */
+		PassHandle AddPass(bool side_effects = false);
+
+		/**
+		 Declares a read of the given texture by the given pass of this
+		 render graph.
+
+		 @param[in]		pass
+						The handle to the pass.
+		 @param[in]		texture
+						The handle to the texture.
+		 */
+		void Read(PassHandle pass, TextureHandle texture);
+
+		/**
+		 Declares a write of the given texture by the given pass of this
+		 render graph.
+
+		 @param[in]		pass
+						The handle to the pass.
+		 @param[in]		texture
+						The handle to the texture.
+		 */
+		void Write(PassHandle pass, TextureHandle texture);
+
+		/**
+		 Compiles this render graph.
+		 */
+		void Compile();
+
+		//---------------------------------------------------------------------
+		// Member Methods: Compilation Results
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the schedule of this render graph.
+
+		 @return		A reference to a vector containing the handles to the
+						(non-culled) passes of this render graph in execution
+						order.
+		 */
+		[[nodiscard]]
+		const std::vector< PassHandle >& GetSchedule() const noexcept {
+			return m_schedule;
+		}
+
+		/**
+		 Checks whether the given pass of this render graph is culled.
+
+		 @param[in]		pass
+						The handle to the pass.
+		 @return		@c true if the given pass of this render graph is
+						culled. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool IsCulled(PassHandle pass) const noexcept {
+			return GetPass(pass).m_culled;
+		}
+
+		/**
+		 Returns the physical index of the given texture of this render
+		 graph.
+
+		 @param[in]		texture
+						The handle to the texture.
+		 @return		The index of the physical texture the given texture
+						is assigned to, or @c s_no_physical_index if the given
+						texture is imported or not used by any non-culled
+						pass.
+		 */
+		[[nodiscard]]
+		size_t GetPhysicalIndex(TextureHandle texture) const noexcept {
+			return GetTexture(texture).m_physical_index;
+		}
+
+		/**
+		 Returns the descriptors of the physical textures of this render
+		 graph.
+
+		 @return		A reference to a vector containing the descriptors of
+						the physical textures of this render graph.
+		 */
+		[[nodiscard]]
+		const std::vector< TextureDescriptor >&
+			GetPhysicalDescriptors() const noexcept {
+
+			return m_physical_descriptors;
+		}
+
+		/**
+		 Returns the textures which need to be unbound as input before
+		 executing the given pass of this render graph.
+
+		 These are the textures read by a preceding pass of which the
+		 (physical) texture is written by the given pass.
+
+		 @param[in]		pass
+						The handle to the pass.
+		 @return		A reference to a vector containing the handles to the
+						textures which need to be unbound as input.
+		 */
+		[[nodiscard]]
+		const std::vector< TextureHandle >&
+			GetInputUnbinds(PassHandle pass) const noexcept {
+
+			return GetPass(pass).m_input_unbinds;
+		}
+
+		/**
+		 Returns the textures which need to be unbound as output before
+		 executing the given pass of this render graph.
+
+		 These are the textures written by the preceding pass of which the
+		 (physical) texture is read by the given pass.
+
+		 @param[in]		pass
+						The handle to the pass.
+		 @return		A reference to a vector containing the handles to the
+						textures which need to be unbound as output.
+		 */
+		[[nodiscard]]
+		const std::vector< TextureHandle >&
+			GetOutputUnbinds(PassHandle pass) const noexcept {
+
+			return GetPass(pass).m_output_unbinds;
+		}
+
+		/**
+		 Returns the total size of the transient textures of this render
+		 graph (i.e. without culling and aliasing).
+
+		 @return		The total size in bytes of the transient textures of
+						this render graph.
+		 */
+		[[nodiscard]]
+		U64 GetTransientSize() const noexcept;
+
+		/**
+		 Returns the total size of the physical textures of this render
+		 graph.
+
+		 @return		The total size in bytes of the physical textures of
+						this render graph.
+		 */
+		[[nodiscard]]
+		U64 GetPhysicalSize() const noexcept;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 A struct of render graph passes.
+		 */
+		struct Pass final {
+
+		public:
+
+			//-----------------------------------------------------------------
+			// Member Variables
+			//-----------------------------------------------------------------
+
+			/**
+			 The handles to the textures read by this pass.
+			 */
+			std::vector< TextureHandle > m_reads;
+
+			/**
+			 The handles to the textures written by this pass.
+			 */
+			std::vector< TextureHandle > m_writes;
+
+			/**
+			 The handles to the textures which need to be unbound as input
+			 before executing this pass.
+			 */
+			std::vector< TextureHandle > m_input_unbinds;
+
+			/**
+			 The handles to the textures which need to be unbound as output
+			 before executing this pass.
+			 */
+			std::vector< TextureHandle > m_output_unbinds;
+
+			/**
+			 The indices of the passes producing the textures read by this
+			 pass (read-after-write dependencies).
+			 */
+			std::vector< U32 > m_producers;
+
+			/**
+			 The indices of the passes which must be executed before this
+			 pass (all dependencies).
+			 */
+			std::vector< U32 > m_predecessors;
+
+			/**
+			 A flag indicating whether this pass has side effects.
+			 */
+			bool m_side_effects = false;
+
+			/**
+			 A flag indicating whether this pass is culled.
+			 */
+			bool m_culled = false;
+		};
+
+		/**
+		 A struct of render graph textures.
+		 */
+		struct Texture final {
+
+		public:
+
+			//-----------------------------------------------------------------
+			// Member Variables
+			//-----------------------------------------------------------------
+
+			/**
+			 The descriptor of this texture.
+			 */
+			TextureDescriptor m_desc;
+
+			/**
+			 The position in the schedule of the first pass using this
+			 texture.
+			 */
+			size_t m_first_use = 0u;
+
+			/**
+			 The position in the schedule of the last pass using this
+			 texture.
+			 */
+			size_t m_last_use = 0u;
+
+			/**
+			 The index of the physical texture of this texture.
+			 */
+			size_t m_physical_index = s_no_physical_index;
+
+			/**
+			 A flag indicating whether this texture is imported.
+			 */
+			bool m_imported = false;
+		};
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the given pass of this render graph.
+
+		 @param[in]		pass
+						The handle to the pass.
+		 @return		A reference to the given pass of this render graph.
+		 */
+		[[nodiscard]]
+		Pass& GetPass(PassHandle pass) noexcept {
+			return m_passes[static_cast< size_t >(pass)];
+		}
+
+		/**
+		 Returns the given pass of this render graph.
+
+		 @param[in]		pass
+						The handle to the pass.
+		 @return		A reference to the given pass of this render graph.
+		 */
+		[[nodiscard]]
+		const Pass& GetPass(PassHandle pass) const noexcept {
+			return m_passes[static_cast< size_t >(pass)];
+		}
+
+		/**
+		 Returns the given texture of this render graph.
+
+		 @param[in]		texture
+						The handle to the texture.
+		 @return		A reference to the given texture of this render graph.
+		 */
+		[[nodiscard]]
+		Texture& GetTexture(TextureHandle texture) noexcept {
+			return m_textures[static_cast< size_t >(texture)];
+		}
+
+		/**
+		 Returns the given texture of this render graph.
+
+		 @param[in]		texture
+						The handle to the texture.
+		 @return		A reference to the given texture of this render graph.
+		 */
+		[[nodiscard]]
+		const Texture& GetTexture(TextureHandle texture) const noexcept {
+			return m_textures[static_cast< size_t >(texture)];
+		}
+
+		/**
+		 Checks whether the given textures of this render graph share the
+		 same (physical) texture.
+
+		 @param[in]		texture1
+						The handle to the first texture.
+		 @param[in]		texture2
+						The handle to the second texture.
+		 @return		@c true if the given textures of this render graph
+						share the same (physical) texture. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool Overlap(TextureHandle texture1,
+					 TextureHandle texture2) const noexcept;
+
+		/**
+		 Computes the dependencies between the passes of this render graph.
+		 */
+		void ComputeDependencies();
+
+		/**
+		 Culls the passes of this render graph.
+		 */
+		void CullPasses();
+
+		/**
+		 Computes the schedule of this render graph.
+		 */
+		void ComputeSchedule();
+
+		/**
+		 Computes the lifetimes and physical textures of the textures of
+		 this render graph.
+		 */
+		void ComputeAliasing();
+
+		/**
+		 Computes the unbinds of the passes of this render graph.
+		 */
+		void ComputeUnbinds();
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A vector containing the passes of this render graph.
+		 */
+		std::vector< Pass > m_passes;
+
+		/**
+		 A vector containing the textures of this render graph.
+		 */
+		std::vector< Texture > m_textures;
+
+		/**
+		 A vector containing the handles to the (non-culled) passes of this
+		 render graph in execution order.
+		 */
+		std::vector< PassHandle > m_schedule;
+
+		/**
+		 A vector containing the descriptors of the physical textures of this
+		 render graph.
+		 */
+		std::vector< TextureDescriptor > m_physical_descriptors;
+	};
+}
\ No newline at end of file
@@ -5,6 +5,7 @@
 
 #include "renderer\renderer.hpp"
 #include "renderer\output_manager.hpp"
+#include "renderer\culling\occlusion_culler.hpp"
 #include "renderer\pass\aa_pass.hpp"
 #include "renderer\pass\back_buffer_pass.hpp"
 #include "renderer\pass\bounding_volume_pass.hpp"
@@ -18,13 +19,26 @@
 #include "renderer\pass\voxelization_pass.hpp"
 #include "renderer\pass\voxel_grid_pass.hpp"
 #include "renderer\buffer\world_buffer.hpp"
+#include "renderer\command\command_recorder.hpp"
 #include "imgui_impl_dx11.hpp"
+#include "system\profiler.hpp"
 
 // Include HLSL bindings.
 #include "hlsl.hpp"
 
 #pragma endregion
 
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#pragma endregion
+
 //-----------------------------------------------------------------------------
 // Engine Declarations and Definitions
 //-----------------------------------------------------------------------------
@@ -123,16 +137,18 @@ namespace mage::rendering {
 		void BindPersistentState();
 
 		/**
-		 Renders the given world.
+		 Renders the given world and GUI.
 
 		 @param[in]		world
 						A reference to the world.
 		 @param[in]		time
 						A reference to the game time.
+		 @param[in]		gui
+						A reference to the draw data of the GUI.
 		 @throws		Exception
 						Failed to render the world.
 		 */
-		void Render(const World& world, const GameTime& time);
+		void Render(const World& world, const GameTime& time, ImDrawData& gui);
 
 	private:
 
@@ -145,8 +161,25 @@ namespace mage::rendering {
 		void UpdateBuffers(const World& world, const GameTime& time);
 
 		void UpdateWorldBuffer(const GameTime& time);
+
+		void UpdateVoxelGridClipmap(const World& world);
 		
 		void Render(const World& world, const Camera& camera);
+
+		void XM_CALLCONV SelectLODs(const World& world, 
+									const Camera& camera, 
+									FXMMATRIX world_to_camera, 
+									CXMMATRIX camera_to_projection);
+
+		void XM_CALLCONV CullModels(const World& world, 
+									const Camera& camera, 
+									FXMMATRIX world_to_projection, 
+									CXMMATRIX camera_to_projection);
+
+		void XM_CALLCONV CullMeshlets(const World& world, 
+									  const Camera& camera, 
+									  FXMMATRIX world_to_projection, 
+									  CXMMATRIX camera_to_projection);
 		
 		void XM_CALLCONV RenderForward(const World& world, 
 									   const Camera& camera, 
@@ -207,6 +240,11 @@ namespace mage::rendering {
 		 */
 		UniquePtr< StateManager > m_state_manager;
 
+		/**
+		 A pointer to the occlusion culler of this renderer.
+		 */
+		UniquePtr< OcclusionCuller > m_occlusion_culler;
+
 		//---------------------------------------------------------------------
 		// Member Variables: Buffers
 		//---------------------------------------------------------------------
@@ -294,6 +332,7 @@ namespace mage::rendering {
 													 display_configuration, 
 													 swap_chain)), 
 		m_state_manager(MakeUnique< StateManager >(device)), 
+		m_occlusion_culler(MakeUnique< OcclusionCuller >()), 
 		m_world_buffer(device),
 		m_aa_pass(), 
 		m_back_buffer_pass(), 
@@ -377,7 +416,15 @@ namespace mage::rendering {
 		m_state_manager->BindPersistentState(m_device_context);
 	}
 
-	void Renderer::Impl::Render(const World& world, const GameTime& time) {
+	void Renderer::Impl::Render(const World& world, const GameTime& time, 
+								ImDrawData& gui) {
+		MAGE_PROFILE_FUNCTION();
+
+		// Center the voxel grid clipmap.
+		if (VoxelizationSettings::UsesClipmap()) {
+			UpdateVoxelGridClipmap(world);
+		}
+
 		// Update the buffers.
 		UpdateBuffers(world, time);
 
@@ -409,8 +456,17 @@ namespace mage::rendering {
 		m_sprite_pass->Render(world);
 
 		// GUI
-		ImGui::Render();
-		ImGui_ImplDX11_RenderDrawData(ImGui::GetDrawData());
+		if (const auto recorder = CommandRecorder::Get(m_device_context)) {
+			// ImGui renders to the device context replaying the commands.
+			recorder->Callback([](void* data) {
+				ImGui_ImplDX11_RenderDrawData(static_cast< ImDrawData* >(data));
+			}, &gui);
+		}
+		else {
+			ImGui_ImplDX11_RenderDrawData(&gui);
+		}
+		// ImGui binds its state without using the pipeline.
+		Pipeline::InvalidateStateCache();
 
 		m_output_manager->BindEnd(m_device_context);
 
@@ -441,6 +497,32 @@ namespace mage::rendering {
 		});
 	}
 
+	void Renderer::Impl::UpdateVoxelGridClipmap(const World& world) {
+		const Camera* target = nullptr;
+		world.ForEach< Camera >([&target](const Camera& camera) {
+			if (nullptr == target
+				&& State::Active == camera.GetState()
+				&& camera.GetSettings().GetVoxelizationSettings().UsesVCT()) {
+				target = &camera;
+			}
+		});
+
+		if (nullptr == target) {
+			return;
+		}
+
+		// Snap the center to the bricks of the voxel grid to scroll the 
+		// voxel grid by entire bricks.
+		const auto& transform  = target->GetOwner()->GetTransform();
+		const auto  brick_size = VOXEL_BRICK_SIZE 
+			                   * VoxelizationSettings::GetVoxelSize();
+		const auto  center     = brick_size * XMVectorRound(
+			transform.GetWorldOrigin() / brick_size);
+
+		VoxelizationSettings::SetVoxelGridCenter(
+			Point3(XMStore< F32x3 >(center)));
+	}
+
 	void Renderer::Impl::UpdateWorldBuffer(const GameTime& time) {
 		WorldBuffer buffer;
 
@@ -476,6 +558,29 @@ namespace mage::rendering {
 				= 1.0f / buffer.m_voxel_size;
 		}
 
+		// Voxelization (Clipmap)
+		if (VoxelizationSettings::UsesClipmap()) {
+			const auto r    = static_cast< S32 >(buffer.m_voxel_grid_resolution);
+			const auto mask = static_cast< U32 >(r - 1);
+			const auto& center = buffer.m_voxel_grid_center;
+
+			// The minimum corner of the voxel grid expressed in voxels.
+			S32x3 origin;
+			for (size_t i = 0u; i < 3u; ++i) {
+				origin[i] = static_cast< S32 >(
+					std::round(center[i] * buffer.m_voxel_inv_size)) - r / 2;
+			}
+
+			// Voxel indices flip the y axis.
+			buffer.m_voxel_texture_offset = U32x3(
+				static_cast< U32 >( origin[0]) & mask,
+				static_cast< U32 >(-origin[1]) & mask,
+				static_cast< U32 >( origin[2]) & mask);
+		}
+		else {
+			buffer.m_voxel_texture_offset = U32x3(0u, 0u, 0u);
+		}
+
 		// Time
 		{
 			buffer.m_time = static_cast< F32 >(time.GetWallClockTotalDeltaTime().count());
@@ -491,6 +596,8 @@ namespace mage::rendering {
 	}
 
 	void Renderer::Impl::Render(const World& world, const Camera& camera) {
+		MAGE_PROFILE_ZONE("mage::rendering::Renderer::Impl::Render (Camera)");
+
 		// Bind the camera to the pipeline.
 		camera.BindBuffer< Pipeline >(m_device_context,
 									  SLOT_CBUFFER_PRIMARY_CAMERA);
@@ -504,7 +611,16 @@ namespace mage::rendering {
 
 		const auto  render_mode          = camera.GetSettings().GetRenderMode();
 
-		m_output_manager->BindBeginViewport(m_device_context);
+		// Select the level of detail of each model for this camera.
+		SelectLODs(world, camera, world_to_camera, camera_to_projection);
+		// Cull the invisible and occluded models for this camera.
+		CullModels(world, camera, world_to_projection, camera_to_projection);
+		// Cull the meshlets of each model for this camera.
+		CullMeshlets(world, camera, world_to_projection, camera_to_projection);
+
+		m_output_manager->BindBeginViewport(m_device_context, 
+											RenderMode::Deferred == render_mode, 
+											camera.GetLens().HasFiniteAperture());
 
 		//---------------------------------------------------------------------
 		// RenderMode
@@ -638,6 +754,9 @@ namespace mage::rendering {
 		if (settings.ContainsRenderLayer(RenderLayer::AABB)) {
 			m_bounding_volume_pass->Render(world, world_to_projection);
 		}
+		if (settings.ContainsRenderLayer(RenderLayer::ShadowAtlas)) {
+			m_lbuffer_pass->RenderShadowAtlasOverlay();
+		}
 
 		m_output_manager->BindEndForward(m_device_context);
 
@@ -652,16 +771,146 @@ namespace mage::rendering {
 		RenderPostProcessing(camera);
 	}
 
+	void XM_CALLCONV Renderer::Impl::SelectLODs(const World& world, 
+												const Camera& camera, 
+												FXMMATRIX world_to_camera, 
+												CXMMATRIX camera_to_projection) {
+		
+		MAGE_PROFILE_FUNCTION();
+
+		const auto max_error = camera.GetSettings().GetMaxLODError();
+		// The projection scale maps camera-space lengths at unit depth to 
+		// half viewport heights.
+		const auto projection_scale 
+			= XMVectorGetY(camera_to_projection.r[1]) 
+			* 0.5f * static_cast< F32 >(camera.GetViewport().GetSize()[1]);
+		// Orthographic projections do not depend on the depth.
+		const auto perspective 
+			= (0.0f == XMVectorGetW(camera_to_projection.r[3]));
+
+		world.ForEach< Model >([&](const Model& model) {
+			if (State::Active != model.GetState() || !model.HasLODs()) {
+				return;
+			}
+
+			const auto& transform        = model.GetOwner()->GetTransform();
+			const auto  object_to_world  = transform.GetObjectToWorldMatrix();
+			const auto  object_to_camera = object_to_world * world_to_camera;
+			
+			const auto& sphere   = model.GetBoundingSphere();
+			const auto  scale    = std::max({ 
+				XMVectorGetX(XMVector3Length(object_to_camera.r[0])),
+				XMVectorGetX(XMVector3Length(object_to_camera.r[1])),
+				XMVectorGetX(XMVector3Length(object_to_camera.r[2])) });
+			const auto  radius   = sphere.Radius() * scale;
+
+			if (!perspective) {
+				model.SelectLOD(radius * projection_scale, max_error);
+				return;
+			}
+
+			const auto  p_camera = XMVector3TransformCoord(sphere.Centroid(), 
+														   object_to_camera);
+			const auto  w        = XMVectorGetW(XMVector4Transform(
+				XMVectorSetW(p_camera, 1.0f), camera_to_projection));
+
+			if (w <= radius) {
+				// The camera is (nearly) inside the bounding sphere.
+				model.SelectLOD(std::numeric_limits< F32 >::infinity(), 
+								max_error);
+				return;
+			}
+
+			model.SelectLOD(radius * projection_scale / w, max_error);
+		});
+	}
+
+	void XM_CALLCONV Renderer::Impl::CullModels(const World& world, 
+												const Camera& camera, 
+												FXMMATRIX world_to_projection, 
+												CXMMATRIX camera_to_projection) {
+		
+		MAGE_PROFILE_FUNCTION();
+
+		OcclusionCuller::Reset(world);
+
+		// Cull the models which are not potentially visible from the cell 
+		// containing the camera.
+		if (const auto& pvs = world.GetPVS(); !pvs.empty()) {
+			const auto& transform = camera.GetOwner()->GetTransform();
+			const auto  cell      = pvs.GetCell(
+				transform.GetObjectToWorldMatrix().r[3]);
+
+			// Dynamic models are never culled by the potentially visible set.
+			world.ForEach< Model >([&pvs, cell](const Model& model) {
+				if (model.IsStatic() 
+					&& !pvs.IsVisible(cell, model.GetPVSIndex())) {
+					model.SetOccluded(true);
+				}
+			});
+		}
+
+		// Cull the occluded models (requires a perspective projection).
+		if (camera.GetSettings().UsesOcclusionCulling()
+			&& 0.0f == XMVectorGetW(camera_to_projection.r[3])) {
+			m_occlusion_culler->Cull(world, world_to_projection);
+		}
+	}
+
+	void XM_CALLCONV Renderer::Impl::CullMeshlets(const World& world, 
+												  const Camera& camera, 
+												  FXMMATRIX world_to_projection, 
+												  CXMMATRIX camera_to_projection) {
+
+		MAGE_PROFILE_FUNCTION();
+
+		const auto& camera_transform = camera.GetOwner()->GetTransform();
+		const auto  camera_to_world  = camera_transform.GetObjectToWorldMatrix();
+		// The normal cone test requires a perspective projection.
+		const auto  perspective 
+			= (0.0f == XMVectorGetW(camera_to_projection.r[3]));
+
+		world.ForEach< Model >([&](const Model& model) {
+			if (State::Active != model.GetState() 
+				|| !model.HasMeshlets() 
+				|| model.IsOccluded()) {
+				return;
+			}
+
+			const auto& transform            = model.GetOwner()->GetTransform();
+			const auto  object_to_world      = transform.GetObjectToWorldMatrix();
+			const auto  object_to_projection = object_to_world * world_to_projection;
+			const auto  camera_to_object     = camera_to_world 
+				                             * transform.GetWorldToObjectMatrix();
+
+			// The normal cones are only preserved by uniform scaling.
+			const auto scale   = XMVectorSet(
+				XMVectorGetX(XMVector3Length(object_to_world.r[0])),
+				XMVectorGetX(XMVector3Length(object_to_world.r[1])),
+				XMVectorGetX(XMVector3Length(object_to_world.r[2])),
+				0.0f);
+			const auto uniform = XMVector3NearEqual(scale, 
+				XMVectorSplatX(scale), XMVectorSplatX(scale) * 0.001f);
+
+			model.CullMeshlets(object_to_projection, camera_to_object.r[3], 
+							   perspective && uniform);
+		});
+	}
+
 	void XM_CALLCONV Renderer::Impl::RenderForward(const World& world,
 												   const Camera& camera,
 												   FXMMATRIX world_to_projection) {
 
+		MAGE_PROFILE_FUNCTION();
+
 		const auto vct = camera.GetSettings().GetVoxelizationSettings().UsesVCT();
 
 		//---------------------------------------------------------------------
 		// LBuffer
 		//---------------------------------------------------------------------
-		m_lbuffer_pass->Render(world, world_to_projection);
+		m_lbuffer_pass->Render(world, 
+							   camera.GetOwner()->GetTransform().GetWorldToObjectMatrix(),
+							   camera.GetCameraToProjectionMatrix());
 
 		//---------------------------------------------------------------------
 		// Voxelization
@@ -712,12 +961,16 @@ namespace mage::rendering {
 													const Camera& camera, 
 													FXMMATRIX world_to_projection) {
 
+		MAGE_PROFILE_FUNCTION();
+
 		const auto vct = camera.GetSettings().GetVoxelizationSettings().UsesVCT();
 
 		//---------------------------------------------------------------------
 		// LBuffer
 		//---------------------------------------------------------------------
-		m_lbuffer_pass->Render(world, world_to_projection);
+		m_lbuffer_pass->Render(world, 
+							   camera.GetOwner()->GetTransform().GetWorldToObjectMatrix(),
+							   camera.GetCameraToProjectionMatrix());
 
 		//---------------------------------------------------------------------
 		// Voxelization
@@ -779,10 +1032,14 @@ namespace mage::rendering {
 												 const Camera& camera, 
 												 FXMMATRIX world_to_projection) {
 
+		MAGE_PROFILE_FUNCTION();
+
 		//---------------------------------------------------------------------
 		// LBuffer
 		//---------------------------------------------------------------------
-		m_lbuffer_pass->Render(world, world_to_projection);
+		m_lbuffer_pass->Render(world, 
+							   camera.GetOwner()->GetTransform().GetWorldToObjectMatrix(),
+							   camera.GetCameraToProjectionMatrix());
 
 		const Viewport viewport(camera.GetViewport(),
 								m_display_configuration.get().GetAA());
@@ -800,6 +1057,8 @@ namespace mage::rendering {
 													  FXMMATRIX world_to_projection, 
 													  FalseColor false_color) {
 		
+		MAGE_PROFILE_FUNCTION();
+
 		const Viewport viewport(camera.GetViewport(),
 								m_display_configuration.get().GetAA());
 		viewport.Bind(m_device_context);
@@ -815,10 +1074,14 @@ namespace mage::rendering {
 													 const Camera& camera, 
 													 FXMMATRIX world_to_projection) {
 
+		MAGE_PROFILE_FUNCTION();
+
 		//---------------------------------------------------------------------
 		// LBuffer
 		//---------------------------------------------------------------------
-		m_lbuffer_pass->Render(world, world_to_projection);
+		m_lbuffer_pass->Render(world, 
+							   camera.GetOwner()->GetTransform().GetWorldToObjectMatrix(),
+							   camera.GetCameraToProjectionMatrix());
 
 		//---------------------------------------------------------------------
 		// Voxelization
@@ -843,6 +1106,8 @@ namespace mage::rendering {
 	}
 
 	void Renderer::Impl::RenderPostProcessing(const Camera& camera) {
+		MAGE_PROFILE_FUNCTION();
+
 		const auto& viewport = camera.GetViewport();
 		viewport.Bind(m_device_context);
 
@@ -868,6 +1133,8 @@ namespace mage::rendering {
 	}
 
 	void Renderer::Impl::RenderAA(const Camera& camera) {
+		MAGE_PROFILE_FUNCTION();
+
 		const auto desc = m_display_configuration.get().GetAA();
 
 		switch (desc) {
@@ -941,8 +1208,9 @@ namespace mage::rendering {
 		m_impl->BindPersistentState();
 	}
 
-	void Renderer::Render(const World& world, const GameTime& time) {
-		m_impl->Render(world, time);
+	void Renderer::Render(const World& world, const GameTime& time, 
+						  ImDrawData& gui) {
+		m_impl->Render(world, time, gui);
 	}
 
 	#pragma endregion
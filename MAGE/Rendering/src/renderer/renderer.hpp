@@ -9,6 +9,7 @@
 #include "resource\rendering_resource_manager.hpp"
 #include "scene\rendering_world.hpp"
 #include "system\game_timer.hpp"
+#include "imgui.hpp"
 
 #pragma endregion
 
@@ -105,16 +106,18 @@ namespace mage::rendering {
 		void BindPersistentState();
 
 		/**
-		 Renders the given world.
+		 Renders the given world and GUI.
 
 		 @param[in]		world
 						A reference to the world.
 		 @param[in]		time
 						A reference to the game time.
+		 @param[in]		gui
+						A reference to the draw data of the GUI.
 		 @throws		Exception
 						Failed to render the world.
 		 */
-		void Render(const World& world, const GameTime& time);
+		void Render(const World& world, const GameTime& time, ImDrawData& gui);
 
 	private:
 
@@ -0,0 +1,324 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\shadow\shadow_atlas_allocator.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <numeric>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	namespace {
+
+		/**
+		 Returns the largest power of two which does not exceed the given
+		 value.
+
+		 @param[in]		value
+						The value.
+		 @return		The largest power of two which does not exceed the
+						given value (or one if @a value is zero).
+		 */
+		[[nodiscard]]
+		constexpr U32 FloorPowerOfTwo(U32 value) noexcept {
+			U32 result = 1u;
+			while (result <= value / 2u) {
+				result *= 2u;
+			}
+			return result;
+		}
+	}
+
+	//-------------------------------------------------------------------------
+	// ShadowAtlasAllocator
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	ShadowAtlasAllocator::ShadowAtlasAllocator(U32 resolution,
+											   U32 min_tile_size)
+		: m_resolution(FloorPowerOfTwo(resolution)),
+		m_nb_levels(1u),
+		m_states(),
+		m_tiles() {
+
+		const auto min_size = std::min(FloorPowerOfTwo(min_tile_size),
+									   m_resolution);
+		while ((m_resolution >> m_nb_levels) >= min_size) {
+			++m_nb_levels;
+		}
+
+		m_states.resize(m_nb_levels);
+		for (U32 level = 0u; level < m_nb_levels; ++level) {
+			m_states[level].resize(size_t(1u) << (2u * level), NodeState::Free);
+		}
+	}
+
+	ShadowAtlasAllocator::ShadowAtlasAllocator(
+		const ShadowAtlasAllocator& allocator) = default;
+
+	ShadowAtlasAllocator::ShadowAtlasAllocator(
+		ShadowAtlasAllocator&& allocator) noexcept = default;
+
+	ShadowAtlasAllocator::~ShadowAtlasAllocator() = default;
+
+	ShadowAtlasAllocator& ShadowAtlasAllocator
+		::operator=(const ShadowAtlasAllocator& allocator) = default;
+
+	ShadowAtlasAllocator& ShadowAtlasAllocator
+		::operator=(ShadowAtlasAllocator&& allocator) noexcept = default;
+
+	[[nodiscard]]
+	U64 ShadowAtlasAllocator::GetNumberOfAllocatedTexels() const noexcept {
+		U64 nb_texels = 0u;
+		for (const auto& [key, node] : m_tiles) {
+			const U64 size = m_resolution >> node.m_level;
+			nb_texels += size * size;
+		}
+		return nb_texels;
+	}
+
+	[[nodiscard]]
+	const ShadowAtlasTile ShadowAtlasAllocator
+		::GetTile(U64 key) const noexcept {
+
+		const auto it = m_tiles.find(key);
+		return (m_tiles.cend() != it) ? GetTile(it->second) : ShadowAtlasTile();
+	}
+
+	const ShadowAtlasTile ShadowAtlasAllocator::Allocate(U64 key, U32 size) {
+		Release(key);
+
+		const auto level = GetLevel(size);
+		const Node root  = { 0u, U32x2(0u, 0u) };
+		Node node;
+
+		// Prefer free nodes of already split nodes over splitting free nodes
+		// to limit the fragmentation.
+		if (AllocateNode(root, level, false, node)
+			|| AllocateNode(root, level, true, node)) {
+
+			m_tiles.emplace(key, node);
+			return GetTile(node);
+		}
+
+		return ShadowAtlasTile();
+	}
+
+	void ShadowAtlasAllocator::Release(U64 key) noexcept {
+		const auto it = m_tiles.find(key);
+		if (m_tiles.cend() == it) {
+			return;
+		}
+
+		ReleaseNode(it->second);
+		m_tiles.erase(it);
+	}
+
+	void ShadowAtlasAllocator::Clear() noexcept {
+		for (auto& states : m_states) {
+			std::fill(states.begin(), states.end(), NodeState::Free);
+		}
+		m_tiles.clear();
+	}
+
+	void ShadowAtlasAllocator
+		::Update(const std::vector< ShadowAtlasRequest >& requests,
+				 std::vector< ShadowAtlasTile >& tiles) {
+
+		tiles.assign(requests.size(), ShadowAtlasTile());
+
+		// Keep the tiles of the requests whose size did not change (much).
+		std::unordered_map< U64, Node > kept;
+		for (size_t i = 0u; i < requests.size(); ++i) {
+			const auto& request = requests[i];
+			const auto  it      = m_tiles.find(request.m_key);
+			if (m_tiles.cend() == it) {
+				continue;
+			}
+
+			const auto level = GetLevel(request.m_size);
+			if (level == it->second.m_level || level == it->second.m_level + 1u) {
+				tiles[i] = GetTile(it->second);
+				kept.insert(*it);
+				m_tiles.erase(it);
+			}
+		}
+
+		// Release the tiles of all other keys.
+		for (const auto& [key, node] : m_tiles) {
+			ReleaseNode(node);
+		}
+		m_tiles = std::move(kept);
+
+		// Allocate the remaining requests in order of decreasing priority.
+		std::vector< size_t > order(requests.size());
+		std::iota(order.begin(), order.end(), size_t(0u));
+		std::stable_sort(order.begin(), order.end(),
+			[&requests](size_t lhs, size_t rhs) noexcept {
+				return requests[lhs].m_priority > requests[rhs].m_priority;
+			});
+
+		for (const auto i : order) {
+			if (tiles[i].IsAllocated()) {
+				continue;
+			}
+
+			const auto& request = requests[i];
+			for (auto size = std::min(request.m_size, m_resolution);
+				 true; size /= 2u) {
+
+				tiles[i] = Allocate(request.m_key, size);
+				if (tiles[i].IsAllocated() || size <= GetMinimumTileSize()) {
+					break;
+				}
+			}
+		}
+	}
+
+	[[nodiscard]]
+	U32 ShadowAtlasAllocator::GetLevel(U32 size) const noexcept {
+		U32 level = 0u;
+		while (level + 1u < m_nb_levels && (m_resolution >> (level + 1u)) >= size) {
+			++level;
+		}
+		return level;
+	}
+
+	[[nodiscard]]
+	const ShadowAtlasTile ShadowAtlasAllocator
+		::GetTile(const Node& node) const noexcept {
+
+		ShadowAtlasTile tile;
+		tile.m_size     = m_resolution >> node.m_level;
+		tile.m_position = U32x2(node.m_index[0] * tile.m_size,
+								node.m_index[1] * tile.m_size);
+		return tile;
+	}
+
+	[[nodiscard]]
+	ShadowAtlasAllocator::NodeState& ShadowAtlasAllocator
+		::GetState(const Node& node) noexcept {
+
+		const size_t width = size_t(1u) << node.m_level;
+		return m_states[node.m_level][node.m_index[1] * width + node.m_index[0]];
+	}
+
+	[[nodiscard]]
+	bool ShadowAtlasAllocator::AllocateNode(const Node& node, U32 level,
+											bool split, Node& result) noexcept {
+		auto& state = GetState(node);
+
+		if (level == node.m_level) {
+			if (NodeState::Free != state) {
+				return false;
+			}
+
+			state  = NodeState::Used;
+			result = node;
+			return true;
+		}
+
+		switch (state) {
+
+		case NodeState::Used: {
+			return false;
+		}
+
+		case NodeState::Free: {
+			if (!split) {
+				return false;
+			}
+
+			state = NodeState::Split;
+			break;
+		}
+
+		default: {
+			break;
+		}
+		}
+
+		for (U32 i = 0u; i < 4u; ++i) {
+			const Node child = {
+				node.m_level + 1u,
+				U32x2(2u * node.m_index[0] + (i & 1u),
+					  2u * node.m_index[1] + (i >> 1u))
+			};
+			if (AllocateNode(child, level, split, result)) {
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	void ShadowAtlasAllocator::ReleaseNode(Node node) noexcept {
+		GetState(node) = NodeState::Free;
+
+		// Merge the free siblings into their parent.
+		while (0u != node.m_level) {
+			const Node parent = {
+				node.m_level - 1u,
+				U32x2(node.m_index[0] / 2u, node.m_index[1] / 2u)
+			};
+
+			for (U32 i = 0u; i < 4u; ++i) {
+				const Node child = {
+					node.m_level,
+					U32x2(2u * parent.m_index[0] + (i & 1u),
+						  2u * parent.m_index[1] + (i >> 1u))
+				};
+				if (NodeState::Free != GetState(child)) {
+					return;
+				}
+			}
+
+			GetState(parent) = NodeState::Free;
+			node = parent;
+		}
+	}
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// Shadow Priority
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	[[nodiscard]]
+	F32 GetShadowPriority(F32 coverage, F32 distance,
+						  F32 range, F32 importance) noexcept {
+
+		// Lights which cover a large part of the screen, are nearby relative
+		// to their range and are important get larger shadow maps.
+		const auto falloff = (0.0f < range)
+			? range / (range + std::max(0.0f, distance)) : 1.0f;
+		return std::max(0.0f, importance)
+			 * std::clamp(coverage, 0.0f, 1.0f) * falloff;
+	}
+
+	[[nodiscard]]
+	U32 GetShadowMapSize(F32 priority, U32 min_size, U32 max_size) noexcept {
+		const auto size = std::clamp(priority, 0.0f, 1.0f) * max_size;
+		const auto max_pow2 = FloorPowerOfTwo(max_size);
+		const auto min_pow2 = std::min(FloorPowerOfTwo(min_size), max_pow2);
+		return std::clamp(FloorPowerOfTwo(static_cast< U32 >(size)),
+						  min_pow2, max_pow2);
+	}
+
+	#pragma endregion
+}
\ No newline at end of file
@@ -0,0 +1,442 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "type\types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <unordered_map>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	//-------------------------------------------------------------------------
+	// ShadowAtlasTile
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A struct of shadow atlas tiles.
+	 */
+	struct ShadowAtlasTile final {
+
+	public:
+
+		/**
+		 Checks whether this shadow atlas tile is allocated.
+
+		 @return		@c true if this shadow atlas tile is allocated.
+						@c false otherwise.
+		 */
+		[[nodiscard]]
+		bool IsAllocated() const noexcept {
+			return 0u != m_size;
+		}
+
+		/**
+		 The (texel) position of the top-left corner of this shadow atlas
+		 tile.
+		 */
+		U32x2 m_position = {};
+
+		/**
+		 The (texel) width and height of this shadow atlas tile (or zero if
+		 this shadow atlas tile is not allocated).
+		 */
+		U32 m_size = 0u;
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// ShadowAtlasRequest
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A struct of shadow atlas requests.
+	 */
+	struct ShadowAtlasRequest final {
+
+	public:
+
+		/**
+		 The key identifying the shadow view of this shadow atlas request
+		 across frames.
+		 */
+		U64 m_key = 0u;
+
+		/**
+		 The requested (texel) width and height of this shadow atlas request.
+		 */
+		U32 m_size = 0u;
+
+		/**
+		 The priority of this shadow atlas request.
+		 */
+		F32 m_priority = 0.0f;
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// ShadowAtlasAllocator
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A class of shadow atlas allocators.
+
+	 A shadow atlas allocator partitions a square shadow atlas into square,
+	 power-of-two tiles using a quadtree. Each tile is identified by a key,
+	 which allows shadow views to keep their tile across frames as long as
+	 their requested size does not change too much. A shadow atlas allocator
+	 does not depend on any device resources.
+	 */
+	class ShadowAtlasAllocator final {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a shadow atlas allocator.
+
+		 @param[in]		resolution
+						The (texel) width and height of the shadow atlas.
+						This value is rounded down to a power of two.
+		 @param[in]		min_tile_size
+						The minimum (texel) width and height of the tiles.
+						This value is rounded down to a power of two.
+		 */
+		explicit ShadowAtlasAllocator(U32 resolution    = 4096u,
+									  U32 min_tile_size = 64u);
+
+		/**
+		 Constructs a shadow atlas allocator from the given shadow atlas
+		 allocator.
+
+		 @param[in]		allocator
+						A reference to the shadow atlas allocator to copy.
+		 */
+		ShadowAtlasAllocator(const ShadowAtlasAllocator& allocator);
+
+		/**
+		 Constructs a shadow atlas allocator by moving the given shadow atlas
+		 allocator.
+
+		 @param[in]		allocator
+						A reference to the shadow atlas allocator to move.
+		 */
+		ShadowAtlasAllocator(ShadowAtlasAllocator&& allocator) noexcept;
+
+		/**
+		 Destructs this shadow atlas allocator.
+		 */
+		~ShadowAtlasAllocator();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given shadow atlas allocator to this shadow atlas
+		 allocator.
+
+		 @param[in]		allocator
+						A reference to the shadow atlas allocator to copy.
+		 @return		A reference to the copy of the given shadow atlas
+						allocator (i.e. this shadow atlas allocator).
+		 */
+		ShadowAtlasAllocator& operator=(const ShadowAtlasAllocator& allocator);
+
+		/**
+		 Moves the given shadow atlas allocator to this shadow atlas
+		 allocator.
+
+		 @param[in]		allocator
+						A reference to the shadow atlas allocator to move.
+		 @return		A reference to the moved shadow atlas allocator (i.e.
+						this shadow atlas allocator).
+		 */
+		ShadowAtlasAllocator& operator=(
+			ShadowAtlasAllocator&& allocator) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the (texel) width and height of the shadow atlas of this
+		 shadow atlas allocator.
+
+		 @return		The (texel) width and height of the shadow atlas of
+						this shadow atlas allocator.
+		 */
+		[[nodiscard]]
+		U32 GetResolution() const noexcept {
+			return m_resolution;
+		}
+
+		/**
+		 Returns the minimum (texel) width and height of the tiles of this
+		 shadow atlas allocator.
+
+		 @return		The minimum (texel) width and height of the tiles of
+						this shadow atlas allocator.
+		 */
+		[[nodiscard]]
+		U32 GetMinimumTileSize() const noexcept {
+			return m_resolution >> (m_nb_levels - 1u);
+		}
+
+		/**
+		 Returns the number of allocated tiles of this shadow atlas
+		 allocator.
+
+		 @return		The number of allocated tiles of this shadow atlas
+						allocator.
+		 */
+		[[nodiscard]]
+		size_t GetNumberOfTiles() const noexcept {
+			return m_tiles.size();
+		}
+
+		/**
+		 Returns the number of allocated texels of this shadow atlas
+		 allocator.
+
+		 @return		The number of allocated texels of this shadow atlas
+						allocator.
+		 */
+		[[nodiscard]]
+		U64 GetNumberOfAllocatedTexels() const noexcept;
+
+		/**
+		 Returns the tile of this shadow atlas allocator associated with the
+		 given key.
+
+		 @param[in]		key
+						The key.
+		 @return		The tile associated with the given key. The tile is
+						not allocated if no tile is associated with the given
+						key.
+		 */
+		[[nodiscard]]
+		const ShadowAtlasTile GetTile(U64 key) const noexcept;
+
+		/**
+		 Allocates a tile of the given size for the given key in this shadow
+		 atlas allocator. The tile previously associated with the given key
+		 (if any) is released first.
+
+		 @param[in]		key
+						The key.
+		 @param[in]		size
+						The requested (texel) width and height. This value
+						is rounded up to a power of two and clamped to the
+						supported tile sizes.
+		 @return		The allocated tile. The tile is not allocated if the
+						shadow atlas has no free tile of the requested size.
+		 */
+		const ShadowAtlasTile Allocate(U64 key, U32 size);
+
+		/**
+		 Releases the tile of this shadow atlas allocator associated with the
+		 given key (if any).
+
+		 @param[in]		key
+						The key.
+		 */
+		void Release(U64 key) noexcept;
+
+		/**
+		 Releases all tiles of this shadow atlas allocator.
+		 */
+		void Clear() noexcept;
+
+		/**
+		 Updates the tiles of this shadow atlas allocator for the given
+		 requests.
+
+		 The tiles of keys that are not requested anymore are released. A
+		 requested key keeps its tile if the requested size equals the size
+		 of its tile or is only half of it (i.e. tiles grow immediately, but
+		 shrink with hysteresis). The other requests are allocated in order
+		 of decreasing priority. A request which does not fit at its
+		 requested size gets the largest smaller tile that fits.
+
+		 @pre			The keys of the given requests are unique.
+		 @param[in]		requests
+						A reference to a vector containing the requests.
+		 @param[out]	tiles
+						A reference to a vector containing the tile of each
+						request (in the same order as the requests). A tile
+						is not allocated if the shadow atlas is full.
+		 */
+		void Update(const std::vector< ShadowAtlasRequest >& requests,
+					std::vector< ShadowAtlasTile >& tiles);
+
+		/**
+		 Calls the given action for all allocated tiles of this shadow atlas
+		 allocator.
+
+		 @tparam		ActionT
+						An action to perform on all allocated tiles of this
+						shadow atlas allocator. The action must accept the
+						key and a @c const reference to the tile.
+		 @param[in]		action
+						The action.
+		 */
+		template< typename ActionT >
+		void ForEachTile(ActionT&& action) const {
+			for (const auto& [key, node] : m_tiles) {
+				action(key, GetTile(node));
+			}
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 An enumeration of the different states of quadtree nodes.
+
+		 This contains:
+		 @c Free,
+		 @c Split, and
+		 @c Used.
+		 */
+		enum class NodeState : U8 {
+			Free = 0, // The node and its descendants are free.
+			Split,    // The node is split in four children.
+			Used      // The node is allocated.
+		};
+
+		/**
+		 A struct of quadtree nodes.
+		 */
+		struct Node final {
+
+		public:
+
+			/**
+			 The level of this node (zero for the root).
+			 */
+			U32 m_level;
+
+			/**
+			 The (tile) coordinates of this node within its level.
+			 */
+			U32x2 m_index;
+		};
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		[[nodiscard]]
+		U32 GetLevel(U32 size) const noexcept;
+
+		[[nodiscard]]
+		const ShadowAtlasTile GetTile(const Node& node) const noexcept;
+
+		[[nodiscard]]
+		NodeState& GetState(const Node& node) noexcept;
+
+		[[nodiscard]]
+		bool AllocateNode(const Node& node, U32 level,
+						  bool split, Node& result) noexcept;
+
+		void ReleaseNode(Node node) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The (texel) width and height of the shadow atlas of this shadow
+		 atlas allocator.
+		 */
+		U32 m_resolution;
+
+		/**
+		 The number of levels of the quadtree of this shadow atlas allocator.
+		 */
+		U32 m_nb_levels;
+
+		/**
+		 A vector containing the node states of each level of the quadtree
+		 of this shadow atlas allocator.
+		 */
+		std::vector< std::vector< NodeState > > m_states;
+
+		/**
+		 A map containing the allocated node of each key of this shadow atlas
+		 allocator.
+		 */
+		std::unordered_map< U64, Node > m_tiles;
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// Shadow Priority
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 Computes the shadow priority of a light.
+
+	 @param[in]		coverage
+					The fraction of the screen covered by the (projected)
+					bounding volume of the light in [0,1].
+	 @param[in]		distance
+					The distance between the eye and the bounding volume of
+					the light (or zero if the eye is inside the bounding
+					volume).
+	 @param[in]		range
+					The range of the light.
+	 @param[in]		importance
+					The (user-defined) shadow importance of the light.
+	 @return		The shadow priority of the light.
+	 */
+	[[nodiscard]]
+	F32 GetShadowPriority(F32 coverage, F32 distance,
+						  F32 range, F32 importance) noexcept;
+
+	/**
+	 Computes the (texel) width and height of the shadow map of a light.
+
+	 @param[in]		priority
+					The shadow priority of the light.
+	 @param[in]		min_size
+					The minimum (texel) width and height of shadow maps.
+	 @param[in]		max_size
+					The maximum (texel) width and height of shadow maps.
+	 @return		The largest power of two in [@a min_size, @a max_size]
+					which does not exceed @a priority * @a max_size.
+	 */
+	[[nodiscard]]
+	U32 GetShadowMapSize(F32 priority, U32 min_size, U32 max_size) noexcept;
+
+	#pragma endregion
+}
\ No newline at end of file
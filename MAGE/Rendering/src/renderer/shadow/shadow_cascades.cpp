@@ -0,0 +1,178 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\shadow\shadow_cascades.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cmath>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	namespace {
+
+		/**
+		 Computes the corners of the near and far plane of the view frustum
+		 of the given camera expressed in camera space.
+
+		 @param[in]		projection_to_camera
+						The projection-to-camera transformation matrix of the
+						camera.
+		 @param[out]	near_corners
+						The corners of the near plane.
+		 @param[out]	far_corners
+						The corners of the far plane.
+		 */
+		void XM_CALLCONV GetFrustumCorners(FXMMATRIX projection_to_camera,
+										   XMVECTOR (&near_corners)[4],
+										   XMVECTOR (&far_corners)[4]) noexcept {
+
+			for (U32 i = 0u; i < 4u; ++i) {
+				const auto x = (i & 1u) ? 1.0f : -1.0f;
+				const auto y = (i & 2u) ? 1.0f : -1.0f;
+
+				// The NDC depth of the near and far plane depends on whether
+				// an inverted z-buffer is used, so both are sorted afterwards.
+				const auto p0 = XMVector3TransformCoord(
+					XMVectorSet(x, y, 0.0f, 1.0f), projection_to_camera);
+				const auto p1 = XMVector3TransformCoord(
+					XMVectorSet(x, y, 1.0f, 1.0f), projection_to_camera);
+
+				const auto swap = XMVectorGetZ(p1) < XMVectorGetZ(p0);
+				near_corners[i] = swap ? p1 : p0;
+				far_corners[i]  = swap ? p0 : p1;
+			}
+		}
+	}
+
+	[[nodiscard]]
+	const F32x2 XM_CALLCONV
+		GetViewDepthRange(FXMMATRIX projection_to_camera) noexcept {
+
+		XMVECTOR near_corners[4];
+		XMVECTOR far_corners[4];
+		GetFrustumCorners(projection_to_camera, near_corners, far_corners);
+
+		return { XMVectorGetZ(near_corners[0]), XMVectorGetZ(far_corners[0]) };
+	}
+
+	[[nodiscard]]
+	const std::array< F32, MAGE_MAX_NB_SHADOW_CASCADES + 1u >
+		ComputeShadowCascadeSplits(F32 near_plane, F32 far_plane,
+								   U32 nb_cascades, F32 lambda) noexcept {
+
+		nb_cascades = std::clamp(nb_cascades, 1u, MAGE_MAX_NB_SHADOW_CASCADES);
+		lambda      = std::clamp(lambda, 0.0f, 1.0f);
+
+		// The logarithmic scheme requires a strictly positive near plane.
+		const auto log_near = std::max(near_plane, 0.0001f);
+		const auto log_far  = std::max(far_plane, log_near);
+
+		std::array< F32, MAGE_MAX_NB_SHADOW_CASCADES + 1u > splits = {};
+		splits.fill(far_plane);
+		splits[0] = near_plane;
+
+		for (U32 i = 1u; i < nb_cascades; ++i) {
+			const auto f           = static_cast< F32 >(i) / nb_cascades;
+			const auto uniform     = near_plane + (far_plane - near_plane) * f;
+			const auto logarithmic = log_near * std::pow(log_far / log_near, f);
+			splits[i] = lambda * logarithmic + (1.0f - lambda) * uniform;
+		}
+
+		return splits;
+	}
+
+	[[nodiscard]]
+	const ShadowCascade XM_CALLCONV
+		ComputeShadowCascade(FXMMATRIX camera_to_light,
+							 CXMMATRIX projection_to_camera,
+							 const F32x2& slice,
+							 const F32x2& clipping_planes) noexcept {
+
+		XMVECTOR near_corners[4];
+		XMVECTOR far_corners[4];
+		GetFrustumCorners(projection_to_camera, near_corners, far_corners);
+
+		const auto z_near = XMVectorGetZ(near_corners[0]);
+		const auto z_far  = XMVectorGetZ(far_corners[0]);
+		const auto z_inv_range = (z_far != z_near) ? 1.0f / (z_far - z_near)
+			                                       : 0.0f;
+
+		// Compute the corners of the slice: the points on the edges of the
+		// view frustum are linear in the view depth (for both perspective and
+		// orthographic cameras).
+		XMVECTOR corners[8];
+		auto centroid = XMVectorZero();
+		for (U32 i = 0u; i < 4u; ++i) {
+			const auto t0 = (slice[0] - z_near) * z_inv_range;
+			const auto t1 = (slice[1] - z_near) * z_inv_range;
+			corners[i]      = XMVectorLerp(near_corners[i], far_corners[i], t0);
+			corners[i + 4u] = XMVectorLerp(near_corners[i], far_corners[i], t1);
+			centroid += corners[i] + corners[i + 4u];
+		}
+		centroid *= 0.125f;
+
+		// The bounding sphere is computed in light space (the camera-to-light
+		// transformation matrix may contain a uniform scaling).
+		const auto center = XMVector3TransformCoord(centroid, camera_to_light);
+		auto radius = 0.0f;
+		for (const auto& corner : corners) {
+			const auto p = XMVector3TransformCoord(corner, camera_to_light);
+			radius = std::max(radius,
+							  XMVectorGetX(XMVector3LengthSq(p - center)));
+		}
+
+		ShadowCascade cascade;
+		cascade.m_center          = { XMVectorGetX(center), XMVectorGetY(center) };
+		cascade.m_radius          = std::sqrt(radius);
+		cascade.m_clipping_planes = clipping_planes;
+		return cascade;
+	}
+
+	[[nodiscard]]
+	const XMMATRIX XM_CALLCONV
+		GetShadowCascadeProjection(const ShadowCascade& cascade,
+								   U32 resolution) noexcept {
+
+		// Enlarge the cascade by two texels to keep the bounding sphere inside
+		// the shadow map after snapping the center to the texel grid:
+		// extent - 2 * texel_size = 2 * radius.
+		const auto size       = static_cast< F32 >(std::max(resolution, 4u));
+		const auto extent     = 2.0f * cascade.m_radius * size / (size - 2.0f);
+		const auto texel_size = extent / size;
+
+		auto x = cascade.m_center[0];
+		auto y = cascade.m_center[1];
+		if (0.0f < texel_size) {
+			x = std::floor(x / texel_size) * texel_size;
+			y = std::floor(y / texel_size) * texel_size;
+		}
+
+		const auto half_extent = std::max(0.5f * extent, 0.0001f);
+
+		#ifdef DISABLE_INVERTED_Z_BUFFER
+		const auto [near_plane, far_plane] = cascade.m_clipping_planes;
+		#else  // DISABLE_INVERTED_Z_BUFFER
+		const auto [far_plane, near_plane] = cascade.m_clipping_planes;
+		#endif // DISABLE_INVERTED_Z_BUFFER
+
+		return XMMatrixOrthographicOffCenterLH(x - half_extent,
+											   x + half_extent,
+											   y - half_extent,
+											   y + half_extent,
+											   near_plane, far_plane);
+	}
+}
\ No newline at end of file
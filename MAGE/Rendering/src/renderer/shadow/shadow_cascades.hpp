@@ -0,0 +1,163 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "math\math.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <array>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Defines
+//-----------------------------------------------------------------------------
+#pragma region
+
+#define MAGE_MAX_NB_SHADOW_CASCADES 4u
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	//-------------------------------------------------------------------------
+	// ShadowCascade
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A struct of shadow cascades.
+
+	 A shadow cascade is the (light space) bounding sphere of a slice of the
+	 view frustum of a camera, extruded along the direction of a directional
+	 light between the clipping planes of that light. The size of a shadow
+	 cascade only depends on the shape of the slice (and not on the
+	 orientation or position of the camera), which avoids shimmering shadow
+	 edges.
+	 */
+	struct ShadowCascade final {
+
+	public:
+
+		/**
+		 The center of the bounding sphere of this shadow cascade projected
+		 on the xy plane of the light space.
+		 */
+		F32x2 m_center = {};
+
+		/**
+		 The radius of the bounding sphere of this shadow cascade expressed in
+		 light space.
+		 */
+		F32 m_radius = 0.0f;
+
+		/**
+		 The clipping planes of this shadow cascade expressed in light space.
+		 */
+		F32x2 m_clipping_planes = {};
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// Shadow Cascades
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 Returns the view depth range of the given camera.
+
+	 @param[in]		projection_to_camera
+					The projection-to-camera transformation matrix of the
+					camera.
+	 @return		The view depth range [near, far] of the given camera.
+	 */
+	[[nodiscard]]
+	const F32x2 XM_CALLCONV
+		GetViewDepthRange(FXMMATRIX projection_to_camera) noexcept;
+
+	/**
+	 Computes the split distances of the shadow cascades of the given view
+	 depth range.
+
+	 The split distances interpolate between the uniform scheme (@a lambda
+	 equal to zero) and the logarithmic scheme (@a lambda equal to one). The
+	 values in-between correspond to the practical split scheme.
+
+	 @param[in]		near_plane
+					The view depth of the near plane.
+	 @param[in]		far_plane
+					The view depth of the far plane.
+	 @param[in]		nb_cascades
+					The number of shadow cascades. This value is clamped to
+					[1, @c MAGE_MAX_NB_SHADOW_CASCADES].
+	 @param[in]		lambda
+					The weight of the logarithmic split scheme in [0,1].
+	 @return		An array containing the view depths of the splits. The
+					shadow cascade @c i covers the view depths between the
+					splits @c i and @c i+1. The first split is equal to
+					@a near_plane and the split @a nb_cascades is equal to
+					@a far_plane.
+	 */
+	[[nodiscard]]
+	const std::array< F32, MAGE_MAX_NB_SHADOW_CASCADES + 1u >
+		ComputeShadowCascadeSplits(F32 near_plane, F32 far_plane,
+								   U32 nb_cascades, F32 lambda) noexcept;
+
+	/**
+	 Computes the shadow cascade of the given slice of the view frustum of
+	 the given camera.
+
+	 @param[in]		camera_to_light
+					The camera-to-light transformation matrix.
+	 @param[in]		projection_to_camera
+					The projection-to-camera transformation matrix of the
+					camera.
+	 @param[in]		slice
+					The view depth range [near, far] of the slice.
+	 @param[in]		clipping_planes
+					The clipping planes of the light expressed in light space.
+	 @return		The shadow cascade of the given slice.
+	 */
+	[[nodiscard]]
+	const ShadowCascade XM_CALLCONV
+		ComputeShadowCascade(FXMMATRIX camera_to_light,
+							 CXMMATRIX projection_to_camera,
+							 const F32x2& slice,
+							 const F32x2& clipping_planes) noexcept;
+
+	/**
+	 Returns the light-to-projection transformation matrix of the given
+	 shadow cascade.
+
+	 The center of the shadow cascade is snapped to the texel grid of the
+	 shadow map, so that the shadow map is only translated by whole texels
+	 when the camera moves.
+
+	 @param[in]		cascade
+					A reference to the shadow cascade.
+	 @param[in]		resolution
+					The (texel) width and height of the shadow map of the
+					shadow cascade.
+	 @return		The light-to-projection transformation matrix of the
+					given shadow cascade.
+	 */
+	[[nodiscard]]
+	const XMMATRIX XM_CALLCONV
+		GetShadowCascadeProjection(const ShadowCascade& cascade,
+								   U32 resolution) noexcept;
+
+	#pragma endregion
+}
\ No newline at end of file
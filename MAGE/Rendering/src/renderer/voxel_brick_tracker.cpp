@@ -0,0 +1,336 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\voxel_brick_tracker.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cmath>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	VoxelBrickTracker::VoxelBrickTracker(U32 resolution, U32 brick_size)
+		: m_resolution(resolution),
+		m_brick_size(brick_size),
+		m_nb_bricks_per_axis(resolution / brick_size),
+		m_center(),
+		m_voxel_size(0.0f),
+		m_clipmap(false),
+		m_origin(),
+		m_all_dirty(true),
+		m_dirty_mask((GetNumberOfBricks() + 31u) / 32u, 0u),
+		m_dirty_bricks(),
+		m_objects() {}
+
+	VoxelBrickTracker::VoxelBrickTracker(
+		const VoxelBrickTracker& tracker) = default;
+
+	VoxelBrickTracker::VoxelBrickTracker(
+		VoxelBrickTracker&& tracker) noexcept = default;
+
+	VoxelBrickTracker::~VoxelBrickTracker() = default;
+
+	VoxelBrickTracker& VoxelBrickTracker
+		::operator=(const VoxelBrickTracker& tracker) = default;
+
+	VoxelBrickTracker& VoxelBrickTracker
+		::operator=(VoxelBrickTracker&& tracker) noexcept = default;
+
+	void VoxelBrickTracker::SetGrid(const F32x3& center, F32 voxel_size,
+									bool clipmap) {
+
+		if (m_voxel_size != voxel_size || m_clipmap != clipmap) {
+			m_voxel_size = voxel_size;
+			m_clipmap    = clipmap;
+			m_center     = center;
+			MarkAllDirty();
+		}
+		else if (!m_clipmap) {
+			if (m_center != center) {
+				m_center = center;
+				MarkAllDirty();
+			}
+			return;
+		}
+		else {
+			Scroll(GetOrigin(center));
+		}
+
+		if (m_clipmap) {
+			// Snap the center to the nearest brick corner.
+			m_origin = GetOrigin(center);
+			const auto half_nb_bricks = static_cast< S32 >(m_nb_bricks_per_axis / 2u);
+			const auto brick_extent   = m_brick_size * m_voxel_size;
+			for (size_t i = 0u; i < 3u; ++i) {
+				m_center[i] = (m_origin[i] + half_nb_bricks) * brick_extent;
+			}
+		}
+	}
+
+	void VoxelBrickTracker::MarkDirty(const F32x3& p_min, const F32x3& p_max) {
+		if (m_all_dirty) {
+			return;
+		}
+
+		U32x3 first, last;
+		if (GetBrickRange(p_min, p_max, first, last)) {
+			MarkDirty(first, last);
+		}
+	}
+
+	void VoxelBrickTracker::MarkAllDirty() noexcept {
+		std::fill(m_dirty_mask.begin(), m_dirty_mask.end(), 0u);
+		m_dirty_bricks.clear();
+		m_all_dirty = true;
+	}
+
+	void VoxelBrickTracker::ClearDirty() noexcept {
+		if (m_all_dirty) {
+			std::fill(m_dirty_mask.begin(), m_dirty_mask.end(), 0u);
+		}
+		else {
+			for (const auto index : m_dirty_bricks) {
+				m_dirty_mask[index >> 5u] = 0u;
+			}
+		}
+
+		m_dirty_bricks.clear();
+		m_all_dirty = false;
+	}
+
+	[[nodiscard]]
+	bool VoxelBrickTracker::IsDirty(const F32x3& p_min,
+									const F32x3& p_max) const noexcept {
+		if (!IsDirty()) {
+			return false;
+		}
+
+		U32x3 first, last;
+		if (!GetBrickRange(p_min, p_max, first, last)) {
+			return false;
+		}
+		if (m_all_dirty) {
+			return true;
+		}
+
+		const size_t nb_bricks = static_cast< size_t >(last[0] - first[0] + 1u)
+							   * static_cast< size_t >(last[1] - first[1] + 1u)
+							   * static_cast< size_t >(last[2] - first[2] + 1u);
+
+		// Visit the smallest of the range and the dirty bricks.
+		if (m_dirty_bricks.size() < nb_bricks) {
+			return std::any_of(m_dirty_bricks.cbegin(), m_dirty_bricks.cend(),
+				[this, &first, &last](U32 index) noexcept {
+					const auto brick = GetBrick(index);
+					return first[0] <= brick[0] && brick[0] <= last[0]
+						&& first[1] <= brick[1] && brick[1] <= last[1]
+						&& first[2] <= brick[2] && brick[2] <= last[2];
+				});
+		}
+
+		const auto n = m_nb_bricks_per_axis;
+		for (auto z = first[2]; z <= last[2]; ++z) {
+			for (auto y = first[1]; y <= last[1]; ++y) {
+				for (auto x = first[0]; x <= last[0]; ++x) {
+					const auto index = x + n * (y + n * z);
+					if (m_dirty_mask[index >> 5u] & (1u << (index & 31u))) {
+						return true;
+					}
+				}
+			}
+		}
+
+		return false;
+	}
+
+	bool VoxelBrickTracker::Track(U64 key, const F32x3& p_min,
+								  const F32x3& p_max, U64 signature) {
+
+		auto [it, inserted] = m_objects.try_emplace(key);
+		auto& object = it->second;
+		object.m_tracked = true;
+
+		if (!inserted
+			&& object.m_min       == p_min
+			&& object.m_max       == p_max
+			&& object.m_signature == signature) {
+			return false;
+		}
+
+		if (!inserted) {
+			MarkDirty(object.m_min, object.m_max);
+		}
+		MarkDirty(p_min, p_max);
+
+		object.m_min       = p_min;
+		object.m_max       = p_max;
+		object.m_signature = signature;
+
+		return true;
+	}
+
+	void VoxelBrickTracker::Prune() {
+		for (auto it = m_objects.begin(); it != m_objects.end();) {
+			auto& object = it->second;
+			if (object.m_tracked) {
+				object.m_tracked = false;
+				++it;
+			}
+			else {
+				MarkDirty(object.m_min, object.m_max);
+				it = m_objects.erase(it);
+			}
+		}
+	}
+
+	[[nodiscard]]
+	bool VoxelBrickTracker::GetBrickRange(const F32x3& p_min,
+										  const F32x3& p_max,
+										  U32x3& first,
+										  U32x3& last) const noexcept {
+
+		if (0.0f >= m_voxel_size) {
+			return false;
+		}
+
+		const auto n              = static_cast< F32 >(m_nb_bricks_per_axis);
+		const auto inv_brick_size = 1.0f / (m_brick_size * m_voxel_size);
+		const auto half_extent    = 0.5f * m_resolution * m_voxel_size;
+
+		for (size_t i = 0u; i < 3u; ++i) {
+			const auto grid_min = m_center[i] - half_extent;
+			const auto b_min = std::floor(
+				(p_min[i] - m_voxel_size - grid_min) * inv_brick_size);
+			const auto b_max = std::floor(
+				(p_max[i] + m_voxel_size - grid_min) * inv_brick_size);
+
+			// Also rejects empty and NaN regions.
+			if (!(b_min <= b_max && b_max >= 0.0f && b_min < n)) {
+				return false;
+			}
+
+			first[i] = static_cast< U32 >(std::max(b_min, 0.0f));
+			last[i]  = static_cast< U32 >(std::min(b_max, n - 1.0f));
+		}
+
+		return true;
+	}
+
+	void VoxelBrickTracker::MarkDirty(const U32x3& first, const U32x3& last) {
+		const auto n = m_nb_bricks_per_axis;
+		for (auto z = first[2]; z <= last[2]; ++z) {
+			for (auto y = first[1]; y <= last[1]; ++y) {
+				for (auto x = first[0]; x <= last[0]; ++x) {
+					MarkDirty(x + n * (y + n * z));
+				}
+			}
+		}
+	}
+
+	void VoxelBrickTracker::MarkDirty(U32 index) {
+		if (m_all_dirty) {
+			return;
+		}
+
+		auto& word = m_dirty_mask[index >> 5u];
+		const auto bit = 1u << (index & 31u);
+		if (word & bit) {
+			return;
+		}
+
+		word |= bit;
+		m_dirty_bricks.push_back(index);
+
+		if (m_dirty_bricks.size() == GetNumberOfBricks()) {
+			MarkAllDirty();
+		}
+	}
+
+	void VoxelBrickTracker::Scroll(const S32x3& origin) {
+		const auto n = static_cast< S32 >(m_nb_bricks_per_axis);
+
+		S32x3 delta;
+		for (size_t i = 0u; i < 3u; ++i) {
+			delta[i] = origin[i] - m_origin[i];
+			if (n <= std::abs(delta[i])) {
+				MarkAllDirty();
+				return;
+			}
+		}
+
+		if (S32x3() == delta || m_all_dirty) {
+			return;
+		}
+
+		// Move the pending dirty bricks.
+		auto bricks = std::move(m_dirty_bricks);
+		m_dirty_bricks.clear();
+		std::fill(m_dirty_mask.begin(), m_dirty_mask.end(), 0u);
+		for (const auto index : bricks) {
+			const auto brick = GetBrick(index);
+
+			U32x3 moved;
+			bool inside = true;
+			for (size_t i = 0u; i < 3u; ++i) {
+				const auto b = static_cast< S32 >(brick[i]) - delta[i];
+				inside = inside && 0 <= b && b < n;
+				moved[i] = static_cast< U32 >(b);
+			}
+
+			if (inside) {
+				MarkDirty(moved, moved);
+			}
+		}
+
+		// Mark the slabs of bricks entering the clipmap as dirty.
+		for (size_t i = 0u; i < 3u; ++i) {
+			if (0 == delta[i]) {
+				continue;
+			}
+
+			U32x3 first(0u, 0u, 0u);
+			U32x3 last(static_cast< U32 >(n - 1), 
+					   static_cast< U32 >(n - 1), 
+					   static_cast< U32 >(n - 1));
+			if (0 < delta[i]) {
+				first[i] = static_cast< U32 >(n - delta[i]);
+			}
+			else {
+				last[i]  = static_cast< U32 >(-delta[i] - 1);
+			}
+
+			MarkDirty(first, last);
+		}
+	}
+
+	[[nodiscard]]
+	const S32x3 VoxelBrickTracker::GetOrigin(const F32x3& center) const noexcept {
+		if (0.0f >= m_voxel_size) {
+			return {};
+		}
+
+		const auto half_nb_bricks = static_cast< S32 >(m_nb_bricks_per_axis / 2u);
+		const auto inv_brick_size = 1.0f / (m_brick_size * m_voxel_size);
+
+		S32x3 origin;
+		for (size_t i = 0u; i < 3u; ++i) {
+			origin[i] = static_cast< S32 >(std::round(center[i] * inv_brick_size))
+					  - half_nb_bricks;
+		}
+
+		return origin;
+	}
+}
\ No newline at end of file
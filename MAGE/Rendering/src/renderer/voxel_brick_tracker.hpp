@@ -0,0 +1,546 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "type\types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <unordered_map>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 A class of voxel brick trackers.
+
+	 A voxel brick tracker partitions a cubic voxel grid into cubic bricks of
+	 voxels, and keeps track of the bricks which need to be revoxelized
+	 (i.e. the dirty bricks). Bricks become dirty by marking world space
+	 regions as dirty, or by tracking objects (e.g., models and lights) of
+	 which the world space bounds or signature changed since the previous
+	 frame. A voxel brick tracker does not depend on the device (context).
+
+	 The voxel grid is either fixed or a clipmap. The center of a clipmap is
+	 snapped to the bricks and scrolling a clipmap only marks the bricks
+	 entering the voxel grid as dirty. The remaining bricks preserve their
+	 location in the (toroidally addressed) voxel texture.
+	 */
+	class VoxelBrickTracker final {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a voxel brick tracker with all bricks marked as dirty.
+
+		 @pre			@a resolution is a multiple of @a brick_size.
+		 @pre			@a brick_size is not equal to zero.
+		 @param[in]		resolution
+						The resolution of the voxel grid for all dimensions.
+		 @param[in]		brick_size
+						The resolution of a brick for all dimensions.
+		 */
+		explicit VoxelBrickTracker(U32 resolution = 1u, U32 brick_size = 1u);
+
+		/**
+		 Constructs a voxel brick tracker from the given voxel brick tracker.
+
+		 @param[in]		tracker
+						A reference to the voxel brick tracker to copy.
+		 */
+		VoxelBrickTracker(const VoxelBrickTracker& tracker);
+
+		/**
+		 Constructs a voxel brick tracker by moving the given voxel brick
+		 tracker.
+
+		 @param[in]		tracker
+						A reference to the voxel brick tracker to move.
+		 */
+		VoxelBrickTracker(VoxelBrickTracker&& tracker) noexcept;
+
+		/**
+		 Destructs this voxel brick tracker.
+		 */
+		~VoxelBrickTracker();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given voxel brick tracker to this voxel brick tracker.
+
+		 @param[in]		tracker
+						A reference to the voxel brick tracker to copy.
+		 @return		A reference to the copy of the given voxel brick
+						tracker (i.e. this voxel brick tracker).
+		 */
+		VoxelBrickTracker& operator=(const VoxelBrickTracker& tracker);
+
+		/**
+		 Moves the given voxel brick tracker to this voxel brick tracker.
+
+		 @param[in]		tracker
+						A reference to the voxel brick tracker to move.
+		 @return		A reference to the moved voxel brick tracker (i.e.
+						this voxel brick tracker).
+		 */
+		VoxelBrickTracker& operator=(VoxelBrickTracker&& tracker) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods: Voxel Grid
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the resolution of the voxel grid of this voxel brick
+		 tracker.
+
+		 @return		The resolution of the voxel grid of this voxel brick
+						tracker for all dimensions.
+		 */
+		[[nodiscard]]
+		U32 GetResolution() const noexcept {
+			return m_resolution;
+		}
+
+		/**
+		 Returns the resolution of a brick of this voxel brick tracker.
+
+		 @return		The resolution of a brick of this voxel brick tracker
+						for all dimensions.
+		 */
+		[[nodiscard]]
+		U32 GetBrickSize() const noexcept {
+			return m_brick_size;
+		}
+
+		/**
+		 Returns the number of bricks of this voxel brick tracker along each
+		 axis.
+
+		 @return		The number of bricks of this voxel brick tracker along
+						each axis.
+		 */
+		[[nodiscard]]
+		U32 GetNumberOfBricksPerAxis() const noexcept {
+			return m_nb_bricks_per_axis;
+		}
+
+		/**
+		 Returns the number of bricks of this voxel brick tracker.
+
+		 @return		The number of bricks of this voxel brick tracker.
+		 */
+		[[nodiscard]]
+		size_t GetNumberOfBricks() const noexcept {
+			const auto n = static_cast< size_t >(m_nb_bricks_per_axis);
+			return n * n * n;
+		}
+
+		/**
+		 Returns the center of the voxel grid of this voxel brick tracker.
+
+		 @return		A reference to the center of the voxel grid of this
+						voxel brick tracker expressed in world space.
+		 */
+		[[nodiscard]]
+		const F32x3& GetCenter() const noexcept {
+			return m_center;
+		}
+
+		/**
+		 Returns the size of a voxel of this voxel brick tracker.
+
+		 @return		The size of a voxel of this voxel brick tracker for all
+						dimensions expressed in world space.
+		 */
+		[[nodiscard]]
+		F32 GetVoxelSize() const noexcept {
+			return m_voxel_size;
+		}
+
+		/**
+		 Checks whether the voxel grid of this voxel brick tracker is a
+		 clipmap.
+
+		 @return		@c true if the voxel grid of this voxel brick tracker
+						is a clipmap. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool IsClipmap() const noexcept {
+			return m_clipmap;
+		}
+
+		/**
+		 Returns the origin of the voxel grid of this voxel brick tracker.
+
+		 @return		A reference to the (global) brick index of the brick
+						at the minimum corner of the voxel grid of this voxel
+						brick tracker. Only meaningful for clipmaps.
+		 */
+		[[nodiscard]]
+		const S32x3& GetOrigin() const noexcept {
+			return m_origin;
+		}
+
+		/**
+		 Sets the voxel grid of this voxel brick tracker.
+
+		 Changing the voxel size, switching between a fixed voxel grid and
+		 a clipmap or moving a fixed voxel grid marks all bricks as dirty.
+		 Moving a clipmap only marks the bricks entering the clipmap as
+		 dirty.
+
+		 @param[in]		center
+						A reference to the center of the voxel grid expressed
+						in world space. The center of a clipmap is snapped to
+						the nearest brick corner.
+		 @param[in]		voxel_size
+						The size of a voxel for all dimensions expressed in
+						world space.
+		 @param[in]		clipmap
+						@c true if the voxel grid is a clipmap. @c false
+						otherwise.
+		 */
+		void SetGrid(const F32x3& center, F32 voxel_size, bool clipmap);
+
+		//---------------------------------------------------------------------
+		// Member Methods: Dirty Bricks
+		//---------------------------------------------------------------------
+
+		/**
+		 Marks the bricks overlapping the given world space region as dirty.
+
+		 The region is conservatively dilated by one voxel.
+
+		 @param[in]		p_min
+						A reference to the minimum point of the region
+						expressed in world space.
+		 @param[in]		p_max
+						A reference to the maximum point of the region
+						expressed in world space.
+		 */
+		void MarkDirty(const F32x3& p_min, const F32x3& p_max);
+
+		/**
+		 Marks all bricks of this voxel brick tracker as dirty.
+		 */
+		void MarkAllDirty() noexcept;
+
+		/**
+		 Marks all bricks of this voxel brick tracker as clean.
+		 */
+		void ClearDirty() noexcept;
+
+		/**
+		 Checks whether this voxel brick tracker contains dirty bricks.
+
+		 @return		@c true if this voxel brick tracker contains dirty
+						bricks. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool IsDirty() const noexcept {
+			return m_all_dirty || !m_dirty_bricks.empty();
+		}
+
+		/**
+		 Checks whether all bricks of this voxel brick tracker are dirty.
+
+		 @return		@c true if all bricks of this voxel brick tracker are
+						dirty. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool IsAllDirty() const noexcept {
+			return m_all_dirty;
+		}
+
+		/**
+		 Checks whether the given world space region overlaps a dirty brick
+		 of this voxel brick tracker.
+
+		 The region is conservatively dilated by one voxel.
+
+		 @param[in]		p_min
+						A reference to the minimum point of the region
+						expressed in world space.
+		 @param[in]		p_max
+						A reference to the maximum point of the region
+						expressed in world space.
+		 @return		@c true if the given region overlaps a dirty brick
+						of this voxel brick tracker. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool IsDirty(const F32x3& p_min, const F32x3& p_max) const noexcept;
+
+		/**
+		 Returns the number of dirty bricks of this voxel brick tracker.
+
+		 @return		The number of dirty bricks of this voxel brick
+						tracker.
+		 */
+		[[nodiscard]]
+		size_t GetNumberOfDirtyBricks() const noexcept {
+			return m_all_dirty ? GetNumberOfBricks() : m_dirty_bricks.size();
+		}
+
+		/**
+		 Returns the dirty bricks of this voxel brick tracker.
+
+		 @pre			Not all bricks of this voxel brick tracker are dirty.
+		 @return		A reference to the vector containing the flat indices
+						of the dirty bricks of this voxel brick tracker (in
+						order of marking).
+		 */
+		[[nodiscard]]
+		const std::vector< U32 >& GetDirtyBricks() const noexcept {
+			return m_dirty_bricks;
+		}
+
+		/**
+		 Returns the brick index of the given flat brick index.
+
+		 @param[in]		index
+						The flat brick index.
+		 @return		The brick index (relative to the minimum corner of
+						the voxel grid) of the given flat brick index.
+		 */
+		[[nodiscard]]
+		const U32x3 GetBrick(U32 index) const noexcept {
+			const auto n = m_nb_bricks_per_axis;
+			return { index % n, (index / n) % n, index / (n * n) };
+		}
+
+		//---------------------------------------------------------------------
+		// Member Methods: Tracked Objects
+		//---------------------------------------------------------------------
+
+		/**
+		 Tracks the object with the given key.
+
+		 If the object is not tracked yet, or its bounds or signature
+		 changed, the bricks overlapping its previous and current bounds are
+		 marked as dirty.
+
+		 @param[in]		key
+						The key of the object.
+		 @param[in]		p_min
+						A reference to the minimum point of the bounds of the
+						object expressed in world space.
+		 @param[in]		p_max
+						A reference to the maximum point of the bounds of the
+						object expressed in world space.
+		 @param[in]		signature
+						The signature of the object (i.e. a summary of the
+						object state affecting the voxels, other than its
+						bounds).
+		 @return		@c true if bricks were marked as dirty. @c false
+						otherwise.
+		 */
+		bool Track(U64 key, const F32x3& p_min, const F32x3& p_max,
+				   U64 signature = 0u);
+
+		/**
+		 Stops tracking the objects which are not tracked since the previous
+		 call, and marks the bricks overlapping their last bounds as dirty.
+		 */
+		void Prune();
+
+		/**
+		 Returns the number of tracked objects of this voxel brick tracker.
+
+		 @return		The number of tracked objects of this voxel brick
+						tracker.
+		 */
+		[[nodiscard]]
+		size_t GetNumberOfTrackedObjects() const noexcept {
+			return m_objects.size();
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 A struct of tracked objects.
+		 */
+		struct TrackedObject final {
+
+		public:
+
+			//-----------------------------------------------------------------
+			// Member Variables
+			//-----------------------------------------------------------------
+
+			/**
+			 The minimum point of the bounds of this tracked object
+			 expressed in world space.
+			 */
+			F32x3 m_min;
+
+			/**
+			 The maximum point of the bounds of this tracked object
+			 expressed in world space.
+			 */
+			F32x3 m_max;
+
+			/**
+			 The signature of this tracked object.
+			 */
+			U64 m_signature = 0u;
+
+			/**
+			 A flag indicating whether this tracked object is tracked since
+			 the previous prune.
+			 */
+			bool m_tracked = false;
+		};
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Computes the (inclusive) range of bricks overlapping the given world
+		 space region dilated by one voxel.
+
+		 @param[in]		p_min
+						A reference to the minimum point of the region
+						expressed in world space.
+		 @param[in]		p_max
+						A reference to the maximum point of the region
+						expressed in world space.
+		 @param[out]	first
+						A reference to the first brick index.
+		 @param[out]	last
+						A reference to the last brick index.
+		 @return		@c true if the given region overlaps the voxel grid.
+						@c false otherwise.
+		 */
+		[[nodiscard]]
+		bool GetBrickRange(const F32x3& p_min, const F32x3& p_max,
+						   U32x3& first, U32x3& last) const noexcept;
+
+		/**
+		 Marks the given (inclusive) range of bricks as dirty.
+
+		 @param[in]		first
+						A reference to the first brick index.
+		 @param[in]		last
+						A reference to the last brick index.
+		 */
+		void MarkDirty(const U32x3& first, const U32x3& last);
+
+		/**
+		 Marks the given brick as dirty.
+
+		 @param[in]		index
+						The flat brick index.
+		 */
+		void MarkDirty(U32 index);
+
+		/**
+		 Scrolls the clipmap of this voxel brick tracker to the given origin.
+
+		 @param[in]		origin
+						A reference to the (global) brick index of the brick
+						at the minimum corner of the clipmap.
+		 */
+		void Scroll(const S32x3& origin);
+
+		/**
+		 Returns the origin of the clipmap centered at the given position.
+
+		 @param[in]		center
+						A reference to the center expressed in world space.
+		 @return		The (global) brick index of the brick at the minimum
+						corner of the clipmap.
+		 */
+		[[nodiscard]]
+		const S32x3 GetOrigin(const F32x3& center) const noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The resolution of the voxel grid of this voxel brick tracker.
+		 */
+		U32 m_resolution;
+
+		/**
+		 The resolution of a brick of this voxel brick tracker.
+		 */
+		U32 m_brick_size;
+
+		/**
+		 The number of bricks of this voxel brick tracker along each axis.
+		 */
+		U32 m_nb_bricks_per_axis;
+
+		/**
+		 The center of the voxel grid of this voxel brick tracker expressed
+		 in world space.
+		 */
+		F32x3 m_center;
+
+		/**
+		 The size of a voxel of this voxel brick tracker expressed in world
+		 space.
+		 */
+		F32 m_voxel_size;
+
+		/**
+		 A flag indicating whether the voxel grid of this voxel brick tracker
+		 is a clipmap.
+		 */
+		bool m_clipmap;
+
+		/**
+		 The (global) brick index of the brick at the minimum corner of the
+		 clipmap of this voxel brick tracker.
+		 */
+		S32x3 m_origin;
+
+		/**
+		 A flag indicating whether all bricks of this voxel brick tracker are
+		 dirty.
+		 */
+		bool m_all_dirty;
+
+		/**
+		 The dirty bit mask (i.e. one bit per brick) of this voxel brick
+		 tracker.
+		 */
+		std::vector< U32 > m_dirty_mask;
+
+		/**
+		 The flat indices of the dirty bricks of this voxel brick tracker.
+		 */
+		std::vector< U32 > m_dirty_bricks;
+
+		/**
+		 The tracked objects of this voxel brick tracker.
+		 */
+		std::unordered_map< U64, TrackedObject > m_objects;
+	};
+}
\ No newline at end of file
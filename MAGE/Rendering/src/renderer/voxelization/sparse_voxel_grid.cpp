@@ -0,0 +1,336 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\voxelization\sparse_voxel_grid.hpp"
+#include "exception\exception.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <bitset>
+#include <cmath>
+#include <functional>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	namespace {
+
+		/**
+		 Packs the given unsigned normalized value.
+
+		 @param[in]		value
+						The value.
+		 @param[in]		max_value
+						The maximum packed value.
+		 @return		The packed value.
+		 */
+		[[nodiscard]]
+		inline U32 PackUNorm(F32 value, F32 max_value) noexcept {
+			return static_cast< U32 >(
+				std::clamp(value, 0.0f, 1.0f) * max_value + 0.5f);
+		}
+
+		/**
+		 Packs the given signed normalized value (16 bits).
+
+		 @param[in]		value
+						The value.
+		 @return		The packed value.
+		 */
+		[[nodiscard]]
+		inline U32 PackSNorm16(F32 value) noexcept {
+			const auto v = std::round(std::clamp(value, -1.0f, 1.0f) * 32767.0f);
+			return static_cast< U32 >(static_cast< S32 >(v)) & 0xFFFFu;
+		}
+
+		/**
+		 Unpacks the given signed normalized value (16 bits).
+
+		 @param[in]		value
+						The packed value.
+		 @return		The value.
+		 */
+		[[nodiscard]]
+		inline F32 UnpackSNorm16(U32 value) noexcept {
+			const auto v = static_cast< S16 >(static_cast< U16 >(value));
+			return std::max(static_cast< F32 >(v) / 32767.0f, -1.0f);
+		}
+
+		/**
+		 Packs the given radiance (R9G9B9E5 shared exponent).
+
+		 @param[in]		L
+						A reference to the radiance.
+		 @return		The packed radiance.
+		 */
+		[[nodiscard]]
+		U32 PackRadiance(const RGB& L) noexcept {
+			constexpr S32 bias     = 15;
+			constexpr S32 nb_bits  = 9;
+			constexpr F32 max_rgb9 = 65408.0f;
+
+			F32 rgb[3];
+			for (size_t i = 0u; i < 3u; ++i) {
+				// Also maps NaN to zero.
+				rgb[i] = (L[i] > 0.0f) ? std::min(L[i], max_rgb9) : 0.0f;
+			}
+			const auto max_value = std::max({ rgb[0], rgb[1], rgb[2] });
+			if (0.0f >= max_value) {
+				return 0u;
+			}
+
+			auto exponent = std::max(-bias - 1,
+				static_cast< S32 >(std::floor(std::log2(max_value)))) + 1 + bias;
+			auto scale = std::exp2(static_cast< F32 >(exponent - bias - nb_bits));
+			if (512.0f <= std::floor(max_value / scale + 0.5f)) {
+				++exponent;
+				scale *= 2.0f;
+			}
+
+			U32 packed = static_cast< U32 >(exponent) << 27u;
+			for (size_t i = 0u; i < 3u; ++i) {
+				const auto m = std::min(511.0f, std::floor(rgb[i] / scale + 0.5f));
+				packed |= static_cast< U32 >(m) << (9u * i);
+			}
+
+			return packed;
+		}
+
+		/**
+		 Unpacks the given packed radiance (R9G9B9E5 shared exponent).
+
+		 @param[in]		L
+						The packed radiance.
+		 @return		The radiance.
+		 */
+		[[nodiscard]]
+		const RGB UnpackRadiance(U32 L) noexcept {
+			const auto exponent = static_cast< S32 >(L >> 27u);
+			const auto scale    = std::exp2(static_cast< F32 >(exponent - 24));
+			return RGB(static_cast< F32 >( L         & 0x1FFu) * scale,
+					   static_cast< F32 >((L >>  9u) & 0x1FFu) * scale,
+					   static_cast< F32 >((L >> 18u) & 0x1FFu) * scale);
+		}
+
+		/**
+		 Packs the given normal (octahedral R16G16 SNORM).
+
+		 @param[in]		n
+						A reference to the normal.
+		 @return		The packed normal.
+		 */
+		[[nodiscard]]
+		U32 PackNormal(const F32x3& n) noexcept {
+			const auto norm = std::abs(n[0]) + std::abs(n[1]) + std::abs(n[2]);
+			if (0.0f >= norm) {
+				return 0u;
+			}
+
+			auto x = n[0] / norm;
+			auto y = n[1] / norm;
+			if (0.0f > n[2]) {
+				const auto ox = (1.0f - std::abs(y)) * (0.0f <= x ? 1.0f : -1.0f);
+				const auto oy = (1.0f - std::abs(x)) * (0.0f <= y ? 1.0f : -1.0f);
+				x = ox;
+				y = oy;
+			}
+
+			return PackSNorm16(x) | (PackSNorm16(y) << 16u);
+		}
+
+		/**
+		 Unpacks the given packed normal (octahedral R16G16 SNORM).
+
+		 @param[in]		n
+						The packed normal.
+		 @return		The (normalized) normal.
+		 */
+		[[nodiscard]]
+		const F32x3 UnpackNormal(U32 n) noexcept {
+			if (0u == n) {
+				return {};
+			}
+
+			auto x = UnpackSNorm16(n);
+			auto y = UnpackSNorm16(n >> 16u);
+			const auto z = 1.0f - std::abs(x) - std::abs(y);
+			if (0.0f > z) {
+				const auto ox = (1.0f - std::abs(y)) * (0.0f <= x ? 1.0f : -1.0f);
+				const auto oy = (1.0f - std::abs(x)) * (0.0f <= y ? 1.0f : -1.0f);
+				x = ox;
+				y = oy;
+			}
+
+			const auto inv_length = 1.0f / std::sqrt(x * x + y * y + z * z);
+			return { x * inv_length, y * inv_length, z * inv_length };
+		}
+	}
+
+	[[nodiscard]]
+	const SparseVoxelGrid::PackedVoxel SparseVoxelGrid
+		::Pack(const Voxel& voxel) noexcept {
+
+		PackedVoxel packed;
+		packed.m_radiance = PackRadiance(voxel.m_radiance);
+		packed.m_albedo   = PackUNorm(voxel.m_albedo[0], 255.0f)
+			              | PackUNorm(voxel.m_albedo[1], 255.0f) <<  8u
+			              | PackUNorm(voxel.m_albedo[2], 255.0f) << 16u
+			              | PackUNorm(voxel.m_albedo[3], 255.0f) << 24u;
+		packed.m_normal   = PackNormal(voxel.m_normal);
+		return packed;
+	}
+
+	[[nodiscard]]
+	const SparseVoxelGrid::Voxel SparseVoxelGrid
+		::Unpack(const PackedVoxel& voxel) noexcept {
+
+		constexpr auto inv_max = 1.0f / 255.0f;
+
+		Voxel unpacked;
+		unpacked.m_radiance = UnpackRadiance(voxel.m_radiance);
+		unpacked.m_albedo   = RGBA(
+			static_cast< F32 >( voxel.m_albedo         & 0xFFu) * inv_max,
+			static_cast< F32 >((voxel.m_albedo >>  8u) & 0xFFu) * inv_max,
+			static_cast< F32 >((voxel.m_albedo >> 16u) & 0xFFu) * inv_max,
+			static_cast< F32 >( voxel.m_albedo >> 24u)          * inv_max);
+		unpacked.m_normal   = UnpackNormal(voxel.m_normal);
+		return unpacked;
+	}
+
+	SparseVoxelGrid::SparseVoxelGrid() noexcept
+		: m_center(),
+		m_resolution(0u),
+		m_voxel_size(0.0f),
+		m_brick_size(1u),
+		m_bricks(),
+		m_masks(),
+		m_offsets(1u, 0u),
+		m_voxels() {}
+
+	SparseVoxelGrid::SparseVoxelGrid(const F32x3& center,
+									 U32 resolution,
+									 F32 voxel_size,
+									 U32 brick_size,
+									 std::vector< U32 > bricks,
+									 std::vector< U32 > masks,
+									 std::vector< PackedVoxel > voxels)
+		: m_center(center),
+		m_resolution(resolution),
+		m_voxel_size(voxel_size),
+		m_brick_size(std::max(1u, brick_size)),
+		m_bricks(std::move(bricks)),
+		m_masks(std::move(masks)),
+		m_offsets(),
+		m_voxels(std::move(voxels)) {
+
+		ThrowIfFailed(0u == m_resolution % m_brick_size,
+					  "Sparse voxel grid: resolution %u is no multiple of the "
+					  "brick size %u.", m_resolution, m_brick_size);
+		
+		// The brick coordinates are packed with 10 bits per axis.
+		const auto nb_bricks_per_axis = m_resolution / m_brick_size;
+		ThrowIfFailed(nb_bricks_per_axis <= 1024u,
+					  "Sparse voxel grid: too many bricks per axis: %u.", 
+					  nb_bricks_per_axis);
+
+		const auto nb_words = GetNumberOfMaskWords();
+		ThrowIfFailed(m_bricks.size() * nb_words == m_masks.size(),
+					  "Sparse voxel grid: invalid number of masks.");
+		ThrowIfFailed(m_bricks.cend() == std::adjacent_find(
+						  m_bricks.cbegin(), m_bricks.cend(), 
+						  std::greater_equal< U32 >()),
+					  "Sparse voxel grid: unsorted or duplicate bricks.");
+		
+		for (const auto packed_brick : m_bricks) {
+			const auto brick = UnpackBrick(packed_brick);
+			ThrowIfFailed(brick[0] < nb_bricks_per_axis
+						  && brick[1] < nb_bricks_per_axis
+						  && brick[2] < nb_bricks_per_axis,
+						  "Sparse voxel grid: brick (%u, %u, %u) out of range.",
+						  brick[0], brick[1], brick[2]);
+		}
+
+		// Compute the offsets of the voxels of each brick.
+		m_offsets.reserve(m_bricks.size() + 1u);
+		size_t offset = 0u;
+		for (size_t i = 0u; i < m_bricks.size(); ++i) {
+			m_offsets.push_back(offset);
+			for (size_t j = 0u; j < nb_words; ++j) {
+				offset += std::bitset< 32 >(m_masks[i * nb_words + j]).count();
+			}
+		}
+		m_offsets.push_back(offset);
+
+		ThrowIfFailed(m_voxels.size() == offset,
+					  "Sparse voxel grid: invalid number of voxels.");
+	}
+
+	SparseVoxelGrid::SparseVoxelGrid(const SparseVoxelGrid& grid) = default;
+
+	SparseVoxelGrid::SparseVoxelGrid(SparseVoxelGrid&& grid) noexcept = default;
+
+	SparseVoxelGrid::~SparseVoxelGrid() = default;
+
+	SparseVoxelGrid& SparseVoxelGrid
+		::operator=(const SparseVoxelGrid& grid) = default;
+
+	SparseVoxelGrid& SparseVoxelGrid
+		::operator=(SparseVoxelGrid&& grid) noexcept = default;
+
+	bool SparseVoxelGrid::GetVoxel(const U32x3& index,
+								   Voxel& voxel) const noexcept {
+
+		if (m_resolution <= index[0]
+			|| m_resolution <= index[1]
+			|| m_resolution <= index[2]) {
+			return false;
+		}
+
+		const U32x3 brick(index[0] / m_brick_size,
+						  index[1] / m_brick_size,
+						  index[2] / m_brick_size);
+		const auto it = std::lower_bound(m_bricks.cbegin(), m_bricks.cend(),
+										 PackBrick(brick));
+		if (m_bricks.cend() == it || PackBrick(brick) != *it) {
+			return false;
+		}
+
+		const auto i     = static_cast< size_t >(it - m_bricks.cbegin());
+		const auto local = (index[0] % m_brick_size) + m_brick_size
+			             * ((index[1] % m_brick_size) + m_brick_size
+						 *  (index[2] % m_brick_size));
+		const auto mask  = &m_masks[i * GetNumberOfMaskWords()];
+		if (0u == (mask[local >> 5u] & (1u << (local & 31u)))) {
+			return false;
+		}
+
+		// The rank of the voxel in the bitmask of its brick.
+		auto offset = m_offsets[i];
+		for (U32 j = 0u; j < (local >> 5u); ++j) {
+			offset += std::bitset< 32 >(mask[j]).count();
+		}
+		offset += std::bitset< 32 >(
+			mask[local >> 5u] & ((1u << (local & 31u)) - 1u)).count();
+
+		voxel = Unpack(m_voxels[offset]);
+		return true;
+	}
+
+	[[nodiscard]]
+	size_t SparseVoxelGrid::GetSizeInBytes() const noexcept {
+		return sizeof(U32) * (m_bricks.size() + m_masks.size())
+			 + sizeof(PackedVoxel) * m_voxels.size();
+	}
+}
\ No newline at end of file
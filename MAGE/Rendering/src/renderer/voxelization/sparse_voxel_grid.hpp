@@ -0,0 +1,437 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "spectrum\spectrum.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 A class of sparse voxel grids.
+
+	 A sparse voxel grid partitions a regular voxel grid into bricks of
+	 voxels, and only stores the bricks containing at least one occupied
+	 voxel. Each stored brick consists of its (packed) brick coordinates, an
+	 occupancy bitmask, and the (packed) data of its occupied voxels in
+	 bitmask order. The voxel coordinates (x, y, z) of a voxel grid are
+	 aligned with the world axes, and the voxel x + B * (y + B * z) of a
+	 brick of size B corresponds to the bit with the same index of the
+	 occupancy bitmask of that brick.
+	 */
+	class SparseVoxelGrid final {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 A struct of voxels.
+		 */
+		struct Voxel final {
+
+		public:
+
+			//-----------------------------------------------------------------
+			// Member Variables
+			//-----------------------------------------------------------------
+
+			/**
+			 The (outgoing) radiance of this voxel.
+			 */
+			RGB m_radiance;
+
+			/**
+			 The albedo (i.e. base color) of this voxel.
+			 */
+			RGBA m_albedo;
+
+			/**
+			 The (normalized) normal of this voxel expressed in world space.
+			 */
+			F32x3 m_normal = {};
+		};
+
+		/**
+		 A struct of packed voxels.
+		 */
+		struct PackedVoxel final {
+
+		public:
+
+			//-----------------------------------------------------------------
+			// Member Variables
+			//-----------------------------------------------------------------
+
+			/**
+			 The radiance of this packed voxel (R9G9B9E5 shared exponent).
+			 */
+			U32 m_radiance = 0u;
+
+			/**
+			 The albedo of this packed voxel (R8G8B8A8 UNORM).
+			 */
+			U32 m_albedo = 0u;
+
+			/**
+			 The normal of this packed voxel (octahedral R16G16 SNORM).
+			 */
+			U32 m_normal = 0u;
+		};
+
+		static_assert(12 == sizeof(PackedVoxel), "Voxel packing mismatch");
+
+		//---------------------------------------------------------------------
+		// Class Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Packs the given voxel.
+
+		 @param[in]		voxel
+						A reference to the voxel.
+		 @return		The packed voxel.
+		 */
+		[[nodiscard]]
+		static const PackedVoxel Pack(const Voxel& voxel) noexcept;
+
+		/**
+		 Unpacks the given packed voxel.
+
+		 @param[in]		voxel
+						A reference to the packed voxel.
+		 @return		The voxel.
+		 */
+		[[nodiscard]]
+		static const Voxel Unpack(const PackedVoxel& voxel) noexcept;
+
+		/**
+		 Packs the given brick coordinates (10 bits per axis).
+
+		 @pre			All brick coordinates are smaller than 1024.
+		 @param[in]		brick
+						A reference to the brick coordinates.
+		 @return		The packed brick coordinates.
+		 */
+		[[nodiscard]]
+		static U32 PackBrick(const U32x3& brick) noexcept {
+			return brick[0] | (brick[1] << 10u) | (brick[2] << 20u);
+		}
+
+		/**
+		 Unpacks the given packed brick coordinates.
+
+		 @param[in]		brick
+						The packed brick coordinates.
+		 @return		The brick coordinates.
+		 */
+		[[nodiscard]]
+		static const U32x3 UnpackBrick(U32 brick) noexcept {
+			return { brick & 0x3FFu, (brick >> 10u) & 0x3FFu, brick >> 20u };
+		}
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs an (empty) sparse voxel grid.
+		 */
+		SparseVoxelGrid() noexcept;
+
+		/**
+		 Constructs a sparse voxel grid.
+
+		 @param[in]		center
+						A reference to the (world space) center of the voxel
+						grid.
+		 @param[in]		resolution
+						The resolution of the voxel grid.
+		 @param[in]		voxel_size
+						The (world space) size of the voxels.
+		 @param[in]		brick_size
+						The size of the bricks expressed in voxels.
+		 @param[in]		bricks
+						A vector containing the packed brick coordinates of
+						the stored bricks in increasing order.
+		 @param[in]		masks
+						A vector containing the occupancy bitmasks of the
+						stored bricks.
+		 @param[in]		voxels
+						A vector containing the packed voxels of the occupied
+						voxels of the stored bricks.
+		 @throws		Exception
+						The given resolution is no multiple of the given 
+						brick size, or the given bricks, masks and voxels are 
+						inconsistent (e.g. bricks outside the voxel grid).
+		 */
+		explicit SparseVoxelGrid(const F32x3& center,
+								 U32 resolution,
+								 F32 voxel_size,
+								 U32 brick_size,
+								 std::vector< U32 > bricks,
+								 std::vector< U32 > masks,
+								 std::vector< PackedVoxel > voxels);
+
+		/**
+		 Constructs a sparse voxel grid from the given sparse voxel grid.
+
+		 @param[in]		grid
+						A reference to the sparse voxel grid to copy.
+		 */
+		SparseVoxelGrid(const SparseVoxelGrid& grid);
+
+		/**
+		 Constructs a sparse voxel grid by moving the given sparse voxel grid.
+
+		 @param[in]		grid
+						A reference to the sparse voxel grid to move.
+		 */
+		SparseVoxelGrid(SparseVoxelGrid&& grid) noexcept;
+
+		/**
+		 Destructs this sparse voxel grid.
+		 */
+		~SparseVoxelGrid();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given sparse voxel grid to this sparse voxel grid.
+
+		 @param[in]		grid
+						A reference to the sparse voxel grid to copy.
+		 @return		A reference to the copy of the given sparse voxel
+						grid (i.e. this sparse voxel grid).
+		 */
+		SparseVoxelGrid& operator=(const SparseVoxelGrid& grid);
+
+		/**
+		 Moves the given sparse voxel grid to this sparse voxel grid.
+
+		 @param[in]		grid
+						A reference to the sparse voxel grid to move.
+		 @return		A reference to the moved sparse voxel grid (i.e. this
+						sparse voxel grid).
+		 */
+		SparseVoxelGrid& operator=(SparseVoxelGrid&& grid) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Checks whether this sparse voxel grid is empty.
+
+		 @return		@c true if this sparse voxel grid contains no occupied
+						voxels. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool empty() const noexcept {
+			return m_voxels.empty();
+		}
+
+		/**
+		 Returns the (world space) center of this sparse voxel grid.
+
+		 @return		A reference to the (world space) center of this
+						sparse voxel grid.
+		 */
+		[[nodiscard]]
+		const F32x3& GetCenter() const noexcept {
+			return m_center;
+		}
+
+		/**
+		 Returns the resolution of this sparse voxel grid.
+
+		 @return		The resolution of this sparse voxel grid.
+		 */
+		[[nodiscard]]
+		U32 GetResolution() const noexcept {
+			return m_resolution;
+		}
+
+		/**
+		 Returns the (world space) size of the voxels of this sparse voxel
+		 grid.
+
+		 @return		The (world space) size of the voxels of this sparse
+						voxel grid.
+		 */
+		[[nodiscard]]
+		F32 GetVoxelSize() const noexcept {
+			return m_voxel_size;
+		}
+
+		/**
+		 Returns the size of the bricks of this sparse voxel grid expressed
+		 in voxels.
+
+		 @return		The size of the bricks of this sparse voxel grid
+						expressed in voxels.
+		 */
+		[[nodiscard]]
+		U32 GetBrickSize() const noexcept {
+			return m_brick_size;
+		}
+
+		/**
+		 Returns the number of 32-bit words of the occupancy bitmask of a
+		 brick of this sparse voxel grid.
+
+		 @return		The number of 32-bit words of the occupancy bitmask
+						of a brick of this sparse voxel grid.
+		 */
+		[[nodiscard]]
+		size_t GetNumberOfMaskWords() const noexcept {
+			const size_t size = m_brick_size;
+			return (size * size * size + 31u) / 32u;
+		}
+
+		/**
+		 Returns the packed brick coordinates of the stored bricks of this
+		 sparse voxel grid.
+
+		 @return		A reference to a vector containing the packed brick
+						coordinates of the stored bricks (in increasing
+						order) of this sparse voxel grid.
+		 */
+		[[nodiscard]]
+		const std::vector< U32 >& GetBricks() const noexcept {
+			return m_bricks;
+		}
+
+		/**
+		 Returns the occupancy bitmasks of the stored bricks of this sparse
+		 voxel grid.
+
+		 @return		A reference to a vector containing the occupancy
+						bitmasks of the stored bricks of this sparse voxel
+						grid.
+		 */
+		[[nodiscard]]
+		const std::vector< U32 >& GetMasks() const noexcept {
+			return m_masks;
+		}
+
+		/**
+		 Returns the packed voxels of the occupied voxels of this sparse
+		 voxel grid.
+
+		 @return		A reference to a vector containing the packed voxels
+						of the occupied voxels of this sparse voxel grid.
+		 */
+		[[nodiscard]]
+		const std::vector< PackedVoxel >& GetVoxels() const noexcept {
+			return m_voxels;
+		}
+
+		/**
+		 Returns the index of the first packed voxel of the given stored
+		 brick of this sparse voxel grid.
+
+		 @pre			@a brick < @c GetBricks().size().
+		 @param[in]		brick
+						The index of the stored brick.
+		 @return		The index of the first packed voxel of the given
+						stored brick of this sparse voxel grid.
+		 */
+		[[nodiscard]]
+		size_t GetVoxelOffset(size_t brick) const noexcept {
+			return m_offsets[brick];
+		}
+
+		/**
+		 Returns the voxel with the given voxel coordinates of this sparse
+		 voxel grid.
+
+		 @param[in]		index
+						A reference to the voxel coordinates.
+		 @param[out]	voxel
+						A reference to the voxel.
+		 @return		@c true if the voxel with the given voxel coordinates
+						is occupied. @c false otherwise.
+		 */
+		bool GetVoxel(const U32x3& index, Voxel& voxel) const noexcept;
+
+		/**
+		 Returns the size (in bytes) of this sparse voxel grid.
+
+		 @return		The size (in bytes) of this sparse voxel grid.
+		 */
+		[[nodiscard]]
+		size_t GetSizeInBytes() const noexcept;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The (world space) center of this sparse voxel grid.
+		 */
+		F32x3 m_center;
+
+		/**
+		 The resolution of this sparse voxel grid.
+		 */
+		U32 m_resolution;
+
+		/**
+		 The (world space) size of the voxels of this sparse voxel grid.
+		 */
+		F32 m_voxel_size;
+
+		/**
+		 The size of the bricks of this sparse voxel grid expressed in voxels.
+		 */
+		U32 m_brick_size;
+
+		/**
+		 A vector containing the packed brick coordinates of the stored
+		 bricks (in increasing order) of this sparse voxel grid.
+		 */
+		std::vector< U32 > m_bricks;
+
+		/**
+		 A vector containing the occupancy bitmasks of the stored bricks of
+		 this sparse voxel grid.
+		 */
+		std::vector< U32 > m_masks;
+
+		/**
+		 A vector containing the index of the first packed voxel of each
+		 stored brick (followed by the number of packed voxels) of this
+		 sparse voxel grid.
+		 */
+		std::vector< size_t > m_offsets;
+
+		/**
+		 A vector containing the packed voxels of the occupied voxels of this
+		 sparse voxel grid.
+		 */
+		std::vector< PackedVoxel > m_voxels;
+	};
+}
\ No newline at end of file
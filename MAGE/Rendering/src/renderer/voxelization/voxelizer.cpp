@@ -0,0 +1,370 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\voxelization\voxelizer.hpp"
+#include "parallel\parallel.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	namespace {
+
+		/**
+		 A struct of voxel accumulators.
+		 */
+		struct VoxelAccumulator final {
+
+		public:
+
+			//-----------------------------------------------------------------
+			// Member Variables
+			//-----------------------------------------------------------------
+
+			/**
+			 The accumulated radiance of this voxel accumulator.
+			 */
+			F32x3 m_radiance = {};
+
+			/**
+			 The accumulated albedo of this voxel accumulator.
+			 */
+			F32x4 m_albedo = {};
+
+			/**
+			 The accumulated normal of this voxel accumulator.
+			 */
+			F32x3 m_normal = {};
+
+			/**
+			 The number of accumulated triangles of this voxel accumulator.
+			 */
+			U32 m_count = 0u;
+		};
+
+		/**
+		 Checks whether the given triangle overlaps the given cube.
+
+		 Implements the separating axis test of Akenine-Möller with the
+		 three box normals, the triangle normal and the nine cross products
+		 of the box normals and triangle edges as candidate axes.
+
+		 @param[in]		p0
+						A reference to the first vertex of the triangle.
+		 @param[in]		p1
+						A reference to the second vertex of the triangle.
+		 @param[in]		p2
+						A reference to the third vertex of the triangle.
+		 @param[in]		center
+						A reference to the center of the cube.
+		 @param[in]		half_size
+						The half size of the cube.
+		 @return		@c true if the given triangle overlaps the given
+						cube. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool TriangleOverlapsCube(const F32x3& p0,
+								  const F32x3& p1,
+								  const F32x3& p2,
+								  const F32x3& center,
+								  F32 half_size) noexcept {
+
+			F32 v[3][3];
+			for (size_t i = 0u; i < 3u; ++i) {
+				v[0][i] = p0[i] - center[i];
+				v[1][i] = p1[i] - center[i];
+				v[2][i] = p2[i] - center[i];
+			}
+
+			// Box normals
+			for (size_t i = 0u; i < 3u; ++i) {
+				const auto v_min = std::min({ v[0][i], v[1][i], v[2][i] });
+				const auto v_max = std::max({ v[0][i], v[1][i], v[2][i] });
+				if (half_size < v_min || v_max < -half_size) {
+					return false;
+				}
+			}
+
+			F32 e[3][3];
+			for (size_t i = 0u; i < 3u; ++i) {
+				e[0][i] = v[1][i] - v[0][i];
+				e[1][i] = v[2][i] - v[1][i];
+				e[2][i] = v[0][i] - v[2][i];
+			}
+
+			// Triangle normal
+			const F32 n[3] = {
+				e[0][1] * e[1][2] - e[0][2] * e[1][1],
+				e[0][2] * e[1][0] - e[0][0] * e[1][2],
+				e[0][0] * e[1][1] - e[0][1] * e[1][0]
+			};
+			const auto d = n[0] * v[0][0] + n[1] * v[0][1] + n[2] * v[0][2];
+			const auto r = half_size
+				         * (std::abs(n[0]) + std::abs(n[1]) + std::abs(n[2]));
+			if (r < std::abs(d)) {
+				return false;
+			}
+
+			// Cross products of the box normals and triangle edges
+			for (size_t i = 0u; i < 3u; ++i) {
+				const auto j = (i + 1u) % 3u;
+				const auto k = (i + 2u) % 3u;
+				for (size_t edge = 0u; edge < 3u; ++edge) {
+					// a = unit(i) x e
+					F32 a[3];
+					a[i] = 0.0f;
+					a[j] = -e[edge][k];
+					a[k] =  e[edge][j];
+
+					const auto q0 = a[j] * v[0][j] + a[k] * v[0][k];
+					const auto q1 = a[j] * v[1][j] + a[k] * v[1][k];
+					const auto q2 = a[j] * v[2][j] + a[k] * v[2][k];
+					const auto ra = half_size * (std::abs(a[j]) + std::abs(a[k]));
+					if (ra < std::min({ q0, q1, q2 })
+						|| std::max({ q0, q1, q2 }) < -ra) {
+						return false;
+					}
+				}
+			}
+
+			return true;
+		}
+	}
+
+	const SparseVoxelGrid Voxelize(const World& world,
+								   const VoxelizerDescriptor& desc) {
+
+		return Voxelize(BakingScene(world), desc);
+	}
+
+	const SparseVoxelGrid Voxelize(const BakingScene& scene,
+								   const VoxelizerDescriptor& desc) {
+
+		//---------------------------------------------------------------------
+		// Set up the voxel grid.
+		//---------------------------------------------------------------------
+		const auto  resolution    = desc.GetResolution();
+		const auto  brick_size    = desc.GetBrickSize();
+		const auto  voxel_size    = desc.GetVoxelSize();
+		const auto& center        = desc.GetCenter();
+		const auto  nb_bricks     = resolution / brick_size;
+		const auto  brick_extent  = brick_size * voxel_size;
+		// The inflation of the boxes for conservative overlap tests.
+		const auto  epsilon       = 0.001f * voxel_size;
+		const auto  bias          = 0.5f * voxel_size;
+
+		F32x3 grid_min;
+		for (size_t i = 0u; i < 3u; ++i) {
+			grid_min[i] = center[i] - 0.5f * resolution * voxel_size;
+		}
+
+		const auto& triangles    = scene.GetVertices();
+		const auto  nb_triangles = static_cast< U32 >(scene.GetNumberOfTriangles());
+
+		// Returns the range [first, last] of cells of the given size
+		// overlapping the AABB of the given triangle.
+		const auto get_range = [&](U32 t, F32 cell_size, U32 nb_cells,
+								   U32x3& first, U32x3& last) noexcept {
+			const auto n = static_cast< F32 >(nb_cells);
+			for (size_t i = 0u; i < 3u; ++i) {
+				const auto p_min = std::min({ triangles[3u * t][i],
+											  triangles[3u * t + 1u][i],
+											  triangles[3u * t + 2u][i] });
+				const auto p_max = std::max({ triangles[3u * t][i],
+											  triangles[3u * t + 1u][i],
+											  triangles[3u * t + 2u][i] });
+				const auto c_min = std::floor((p_min - epsilon - grid_min[i]) / cell_size);
+				const auto c_max = std::floor((p_max + epsilon - grid_min[i]) / cell_size);
+				if (c_max < 0.0f || n <= c_min) {
+					return false;
+				}
+
+				first[i] = static_cast< U32 >(std::max(c_min, 0.0f));
+				last[i]  = static_cast< U32 >(std::min(c_max, n - 1.0f));
+			}
+
+			return true;
+		};
+
+		//---------------------------------------------------------------------
+		// Bin the triangles into the bricks.
+		//---------------------------------------------------------------------
+		std::vector< std::pair< U32, U32 > > brick_triangles;
+
+		for (U32 t = 0u; t < nb_triangles; ++t) {
+			U32x3 first, last;
+			if (!get_range(t, brick_extent, nb_bricks, first, last)) {
+				continue;
+			}
+
+			for (auto z = first[2]; z <= last[2]; ++z) {
+				for (auto y = first[1]; y <= last[1]; ++y) {
+					for (auto x = first[0]; x <= last[0]; ++x) {
+						const F32x3 brick_center(
+							grid_min[0] + (x + 0.5f) * brick_extent,
+							grid_min[1] + (y + 0.5f) * brick_extent,
+							grid_min[2] + (z + 0.5f) * brick_extent);
+
+						if (TriangleOverlapsCube(triangles[3u * t],
+												 triangles[3u * t + 1u],
+												 triangles[3u * t + 2u],
+												 brick_center,
+												 0.5f * brick_extent + epsilon)) {
+							brick_triangles.emplace_back(
+								SparseVoxelGrid::PackBrick({ x, y, z }), t);
+						}
+					}
+				}
+			}
+		}
+
+		// Sort by brick (and triangle).
+		std::sort(brick_triangles.begin(), brick_triangles.end());
+
+		std::vector< size_t > brick_starts;
+		for (size_t i = 0u; i < brick_triangles.size(); ++i) {
+			if (0u == i
+				|| brick_triangles[i].first != brick_triangles[i - 1u].first) {
+				brick_starts.push_back(i);
+			}
+		}
+		brick_starts.push_back(brick_triangles.size());
+
+		//---------------------------------------------------------------------
+		// Voxelize the bricks.
+		//---------------------------------------------------------------------
+		const size_t nb_voxels_per_brick
+			= static_cast< size_t >(brick_size) * brick_size * brick_size;
+		const size_t nb_words = (nb_voxels_per_brick + 31u) / 32u;
+		const auto   nb_candidate_bricks = brick_starts.size() - 1u;
+
+		std::vector< std::vector< U32 > > brick_masks(nb_candidate_bricks);
+		std::vector< std::vector< SparseVoxelGrid::PackedVoxel > >
+			brick_voxels(nb_candidate_bricks);
+
+		ParallelFor(0u, nb_candidate_bricks, [&](size_t b) {
+			const auto brick = SparseVoxelGrid::UnpackBrick(
+				brick_triangles[brick_starts[b]].first);
+
+			std::vector< VoxelAccumulator > accumulators(nb_voxels_per_brick);
+
+			for (auto i = brick_starts[b]; i < brick_starts[b + 1u]; ++i) {
+				const auto  t        = brick_triangles[i].second;
+				const auto& p0       = triangles[3u * t];
+				const auto& material = scene.GetMaterial(t);
+				const auto  n        = XMLoad(scene.GetNormal(t));
+
+				U32x3 first, last;
+				if (!get_range(t, voxel_size, resolution, first, last)) {
+					continue;
+				}
+				for (size_t j = 0u; j < 3u; ++j) {
+					first[j] = std::max(first[j], brick[j] * brick_size);
+					last[j]  = std::min(last[j],  brick[j] * brick_size + brick_size - 1u);
+				}
+
+				for (auto z = first[2]; z <= last[2]; ++z) {
+					for (auto y = first[1]; y <= last[1]; ++y) {
+						for (auto x = first[0]; x <= last[0]; ++x) {
+							const F32x3 voxel_center(
+								grid_min[0] + (x + 0.5f) * voxel_size,
+								grid_min[1] + (y + 0.5f) * voxel_size,
+								grid_min[2] + (z + 0.5f) * voxel_size);
+
+							if (!TriangleOverlapsCube(p0,
+													  triangles[3u * t + 1u],
+													  triangles[3u * t + 2u],
+													  voxel_center,
+													  0.5f * voxel_size + epsilon)) {
+								continue;
+							}
+
+							// Shade the projection of the voxel center on
+							// the plane of the triangle.
+							const auto c = XMLoad(voxel_center);
+							const auto p = c - XMVector3Dot(n, c - XMLoad(p0)) * n;
+							const auto L = scene.GetRadiance(p, n, material, bias);
+
+							const auto local = (x - brick[0] * brick_size)
+								+ brick_size * ((y - brick[1] * brick_size)
+								+ brick_size *  (z - brick[2] * brick_size));
+							auto& accumulator = accumulators[local];
+							accumulator.m_radiance = XMStore< F32x3 >(
+								XMLoad(accumulator.m_radiance) + L);
+							accumulator.m_albedo   = XMStore< F32x4 >(
+								XMLoad(accumulator.m_albedo)
+								+ XMLoad(material.m_base_color));
+							accumulator.m_normal   = XMStore< F32x3 >(
+								XMLoad(accumulator.m_normal) + n);
+							++accumulator.m_count;
+						}
+					}
+				}
+			}
+
+			// Resolve the occupied voxels in bitmask order.
+			auto& mask   = brick_masks[b];
+			auto& voxels = brick_voxels[b];
+			mask.assign(nb_words, 0u);
+			for (size_t i = 0u; i < nb_voxels_per_brick; ++i) {
+				const auto& accumulator = accumulators[i];
+				if (0u == accumulator.m_count) {
+					continue;
+				}
+
+				const auto inv_count = 1.0f / accumulator.m_count;
+
+				SparseVoxelGrid::Voxel voxel;
+				voxel.m_radiance = RGB(XMStore< F32x3 >(
+					inv_count * XMLoad(accumulator.m_radiance)));
+				voxel.m_albedo   = RGBA(XMStore< F32x4 >(
+					inv_count * XMLoad(accumulator.m_albedo)));
+				voxel.m_normal   = XMStore< F32x3 >(
+					XMVector3Normalize(XMLoad(accumulator.m_normal)));
+
+				mask[i >> 5u] |= 1u << (i & 31u);
+				voxels.push_back(SparseVoxelGrid::Pack(voxel));
+			}
+		});
+
+		//---------------------------------------------------------------------
+		// Collect the non-empty bricks.
+		//---------------------------------------------------------------------
+		std::vector< U32 > bricks;
+		std::vector< U32 > masks;
+		std::vector< SparseVoxelGrid::PackedVoxel > voxels;
+
+		for (size_t b = 0u; b < nb_candidate_bricks; ++b) {
+			if (brick_voxels[b].empty()) {
+				continue;
+			}
+
+			bricks.push_back(brick_triangles[brick_starts[b]].first);
+			masks.insert(masks.end(),
+						 brick_masks[b].cbegin(), brick_masks[b].cend());
+			voxels.insert(voxels.end(),
+						  brick_voxels[b].cbegin(), brick_voxels[b].cend());
+		}
+
+		return SparseVoxelGrid(center, resolution, voxel_size, brick_size,
+							   std::move(bricks),
+							   std::move(masks),
+							   std::move(voxels));
+	}
+}
\ No newline at end of file
@@ -0,0 +1,66 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\voxelization\sparse_voxel_grid.hpp"
+#include "renderer\voxelization\voxelizer_descriptor.hpp"
+#include "renderer\baking_scene.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 Voxelizes the static geometry of the given world on the CPU.
+
+	 The triangles of the (active, opaque and static) models whose meshes
+	 have a CPU copy are binned into the bricks of the voxel grid they
+	 overlap. The bricks are voxelized in parallel: each voxel overlapping a
+	 triangle (conservative triangle/box overlap test) is occupied, and
+	 accumulates the base color of the material, the geometric normal and
+	 the radiance of the triangle. The radiance is computed as in the
+	 voxelization pass (direct Lambertian lighting of all active lights, or
+	 the base color for emissive materials), but with ray-traced shadows
+	 against a bounding volume hierarchy of all triangles for the lights
+	 using shadows. Hence, the result serves as a reference for validating
+	 the output of the voxelization pass.
+
+	 The bricks only depend on their own triangles, so the result is
+	 deterministic.
+
+	 @param[in]		world
+					A reference to the world.
+	 @param[in]		desc
+					A reference to the voxelizer descriptor.
+	 @return		The sparse voxel grid of the given world.
+	 @throws		Exception
+					Failed to voxelize the given world.
+	 */
+	[[nodiscard]]
+	const SparseVoxelGrid Voxelize(const World& world,
+								   const VoxelizerDescriptor& desc
+								   = VoxelizerDescriptor());
+
+	/**
+	 Voxelizes the triangles of the given baking scene on the CPU (see 
+	 Voxelize(const World&, const VoxelizerDescriptor&)).
+
+	 @param[in]		scene
+					A reference to the baking scene.
+	 @param[in]		desc
+					A reference to the voxelizer descriptor.
+	 @return		The sparse voxel grid of the given baking scene.
+	 @throws		Exception
+					Failed to voxelize the given baking scene.
+	 */
+	[[nodiscard]]
+	const SparseVoxelGrid Voxelize(const BakingScene& scene,
+								   const VoxelizerDescriptor& desc
+								   = VoxelizerDescriptor());
+}
\ No newline at end of file
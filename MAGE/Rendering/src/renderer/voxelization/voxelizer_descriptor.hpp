@@ -0,0 +1,197 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "type\types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 A class of voxelizer descriptors describing how the static geometry of a
+	 world must be voxelized on the CPU.
+	 */
+	class VoxelizerDescriptor final {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a voxelizer descriptor.
+
+		 @param[in]		center
+						A reference to the (world space) center of the voxel
+						grid.
+		 @param[in]		resolution
+						The resolution of the voxel grid (i.e. the number of
+						voxels along each axis). The resolution is rounded up
+						to a multiple of the brick size.
+		 @param[in]		voxel_size
+						The (world space) size of the voxels.
+		 @param[in]		brick_size
+						The size of the bricks expressed in voxels.
+		 */
+		constexpr explicit VoxelizerDescriptor(const F32x3& center = {},
+											   U32 resolution      = 128u,
+											   F32 voxel_size      = 0.08f,
+											   U32 brick_size      = 8u) noexcept
+			: m_center(center),
+			m_brick_size(std::clamp(brick_size, 1u, 8u)),
+			m_resolution(std::clamp(resolution, 1u, 1024u * m_brick_size)),
+			m_voxel_size(std::max(0.0001f, voxel_size)) {
+
+			m_resolution = (m_resolution + m_brick_size - 1u)
+				         / m_brick_size * m_brick_size;
+		}
+
+		/**
+		 Constructs a voxelizer descriptor from the given voxelizer
+		 descriptor.
+
+		 @param[in]		desc
+						A reference to the voxelizer descriptor to copy.
+		 */
+		constexpr VoxelizerDescriptor(
+			const VoxelizerDescriptor& desc) noexcept = default;
+
+		/**
+		 Constructs a voxelizer descriptor by moving the given voxelizer
+		 descriptor.
+
+		 @param[in]		desc
+						A reference to the voxelizer descriptor to move.
+		 */
+		constexpr VoxelizerDescriptor(
+			VoxelizerDescriptor&& desc) noexcept = default;
+
+		/**
+		 Destructs this voxelizer descriptor.
+		 */
+		~VoxelizerDescriptor() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given voxelizer descriptor to this voxelizer descriptor.
+
+		 @param[in]		desc
+						A reference to the voxelizer descriptor to copy.
+		 @return		A reference to the copy of the given voxelizer
+						descriptor (i.e. this voxelizer descriptor).
+		 */
+		constexpr VoxelizerDescriptor& operator=(
+			const VoxelizerDescriptor& desc) noexcept = default;
+
+		/**
+		 Moves the given voxelizer descriptor to this voxelizer descriptor.
+
+		 @param[in]		desc
+						A reference to the voxelizer descriptor to move.
+		 @return		A reference to the moved voxelizer descriptor (i.e.
+						this voxelizer descriptor).
+		 */
+		constexpr VoxelizerDescriptor& operator=(
+			VoxelizerDescriptor&& desc) noexcept = default;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the (world space) center of the voxel grid of this voxelizer
+		 descriptor.
+
+		 @return		A reference to the (world space) center of the voxel
+						grid of this voxelizer descriptor.
+		 */
+		[[nodiscard]]
+		constexpr const F32x3& GetCenter() const noexcept {
+			return m_center;
+		}
+
+		/**
+		 Returns the resolution of the voxel grid of this voxelizer
+		 descriptor.
+
+		 @return		The resolution of the voxel grid of this voxelizer
+						descriptor.
+		 */
+		[[nodiscard]]
+		constexpr U32 GetResolution() const noexcept {
+			return m_resolution;
+		}
+
+		/**
+		 Returns the (world space) size of the voxels of this voxelizer
+		 descriptor.
+
+		 @return		The (world space) size of the voxels of this
+						voxelizer descriptor.
+		 */
+		[[nodiscard]]
+		constexpr F32 GetVoxelSize() const noexcept {
+			return m_voxel_size;
+		}
+
+		/**
+		 Returns the size of the bricks of this voxelizer descriptor
+		 expressed in voxels.
+
+		 @return		The size of the bricks of this voxelizer descriptor
+						expressed in voxels.
+		 */
+		[[nodiscard]]
+		constexpr U32 GetBrickSize() const noexcept {
+			return m_brick_size;
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The (world space) center of the voxel grid of this voxelizer
+		 descriptor.
+		 */
+		F32x3 m_center;
+
+		/**
+		 The size of the bricks of this voxelizer descriptor expressed in
+		 voxels.
+		 */
+		U32 m_brick_size;
+
+		/**
+		 The resolution of the voxel grid of this voxelizer descriptor.
+		 */
+		U32 m_resolution;
+
+		/**
+		 The (world space) size of the voxels of this voxelizer descriptor.
+		 */
+		F32 m_voxel_size;
+	};
+}
\ No newline at end of file
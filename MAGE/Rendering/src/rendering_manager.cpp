@@ -5,8 +5,27 @@
 
 #include "rendering_manager.hpp"
 #include "renderer\renderer.hpp"
+#include "renderer\command\command_recorder.hpp"
+#include "renderer\command\command_replayer.hpp"
+#include "renderer\culling\occlusion_culler.hpp"
+#include "resource\shader\shader_permutation.hpp"
 #include "imgui_impl_dx11.hpp"
 #include "imgui_impl_win32.hpp"
+#include "scene\transform.hpp"
+#include "scene\frozen_world.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 #pragma endregion
 
@@ -17,6 +36,44 @@ namespace mage::rendering {
 
 	U32 Pipeline::s_nb_draws = 0u;
 
+	U32 Pipeline::s_nb_vertices = 0u;
+
+	U32 Pipeline::s_nb_bindings = 0u;
+
+	U32 Pipeline::s_nb_redundant_bindings = 0u;
+
+	Pipeline::StateCache Pipeline::s_state_cache;
+
+	namespace {
+
+		/**
+		 A pointer to the world bound to the calling thread (e.g., a staging 
+		 world to load a scene into on a background thread).
+		 */
+		thread_local World* t_bound_world = nullptr;
+
+		/**
+		 Copies the given source vector to the given destination vector.
+
+		 Unlike the assignment operator, the memory of the destination vector 
+		 is reused if sufficiently large.
+
+		 @tparam		T
+						The value type.
+		 @param[in]		src
+						A reference to the source vector.
+		 @param[out]	dst
+						A reference to the destination vector.
+		 */
+		template< typename T >
+		void Copy(const ImVector< T >& src, ImVector< T >& dst) {
+			dst.resize(src.Size);
+			if (0 != src.Size) {
+				memcpy(dst.Data, src.Data, sizeof(T) * src.Size);
+			}
+		}
+	}
+
 	//-------------------------------------------------------------------------
 	// Manager::Impl
 	//-------------------------------------------------------------------------
@@ -40,9 +97,14 @@ namespace mage::rendering {
 						The main window handle.
 		 @param[in]		display_configuration
 						The display configuration.
+		 @param[in]		record_commands
+						@c true if the frames rendered on the render thread 
+						must be recorded to command streams. @c false 
+						otherwise.
 		 */
 		explicit Impl(NotNull< HWND > window, 
-					  DisplayConfiguration display_configuration);
+					  DisplayConfiguration display_configuration, 
+					  bool record_commands);
 
 		/**
 		 Constructs a rendering manager from the given rendering manager.
@@ -58,7 +120,7 @@ namespace mage::rendering {
 		 @param[in]		manager
 						A reference to a rendering manager to move.
 		 */
-		Impl(Impl&& manager) noexcept;
+		Impl(Impl&& manager) = delete;
 
 		/**
 		 Destructs this rendering manager.
@@ -144,9 +206,70 @@ namespace mage::rendering {
 		 */
 		[[nodiscard]]
 		World& GetWorld() const noexcept {
-			return *m_world;
+			return (nullptr != t_bound_world) ? *t_bound_world : *m_world;
+		}
+
+		/**
+		 Creates a (staging) world for this rendering manager.
+
+		 @return		A pointer to the world.
+		 @throws		Exception
+						Failed to create the world.
+		 */
+		[[nodiscard]]
+		UniquePtr< World > CreateWorld() const {
+			return MakeUnique< World >(*m_device.Get(), 
+									   *m_display_configuration,
+									   *m_resource_manager);
+		}
+
+		/**
+		 Replaces the world of this rendering manager with the given world.
+
+		 @param[in]		world
+						A pointer to the world.
+		 @return		A pointer to the previous world of this rendering 
+						manager.
+		 */
+		UniquePtr< World > SwapWorld(UniquePtr< World > world) noexcept {
+			std::swap(m_world, world);
+			return world;
+		}
+
+		/**
+		 Returns the time spent presenting the last frame of this rendering
+		 manager.
+
+		 @return		The time spent presenting the last frame of this
+						rendering manager.
+		 */
+		[[nodiscard]]
+		TimeIntervalSeconds GetPresentTime() const noexcept {
+			return m_present_timer.GetTotalDeltaTime();
+		}
+
+		/**
+		 Returns the time spent rendering (excluding presenting) the last 
+		 frame of this rendering manager.
+
+		 @return		The time spent rendering the last frame of this 
+						rendering manager.
+		 */
+		[[nodiscard]]
+		TimeIntervalSeconds GetRenderTime() const noexcept {
+			return m_render_timer.GetTotalDeltaTime();
 		}
 
+		/**
+		 Returns the frame counters of the last frame of this rendering 
+		 manager.
+
+		 @return		The frame counters of the last frame of this rendering 
+						manager.
+		 */
+		[[nodiscard]]
+		const FrameCounters GetFrameCounters() const noexcept;
+
 		/**
 		 Binds the persistent state of this rendering manager.
 
@@ -169,10 +292,54 @@ namespace mage::rendering {
 
 		 @param[in]		time
 						A reference to the game time.
+		 @param[in]		present
+						@c true if the rendered frame must be presented. 
+						@c false otherwise.
+		 @throws		Exception
+						Failed to render the world of this rendering manager.
+		 */
+		void Render(const GameTime& time, bool present);
+
+		/**
+		 Renders on the render thread of this rendering manager.
+
+		 @pre			No frame is being rendered on the render thread of 
+						this rendering manager, unless this rendering manager 
+						records commands.
+		 @param[in]		time
+						A reference to the game time.
+		 @param[in]		present
+						@c true if the rendered frame must be presented. 
+						@c false otherwise.
+		 @throws		Exception
+						Failed to start the render thread of this rendering 
+						manager.
+		 @throws		Exception
+						Failed to record the world of this rendering manager.
+		 */
+		void RenderAsync(const GameTime& time, bool present);
+
+		/**
+		 Records the current frame while the previous frame (if any) is 
+		 replayed on the render thread of this rendering manager.
+
+		 @pre			This rendering manager records commands.
+		 @pre			The current frame is not recorded yet.
+		 @param[in]		time
+						A reference to the game time.
+		 @throws		Exception
+						Failed to record the world of this rendering manager.
+		 */
+		void Record(const GameTime& time);
+
+		/**
+		 Waits for the frame being rendered on the render thread of this 
+		 rendering manager (if any).
+
 		 @throws		Exception
 						Failed to render the world of this rendering manager.
 		 */
-		void Render(const GameTime& time);
+		void WaitForRender();
 		
 	private:
 
@@ -183,11 +350,15 @@ namespace mage::rendering {
 		/**
 		 Initializes the different rendering systems of this rendering manager.
 
+		 @param[in]		record_commands
+						@c true if the frames rendered on the render thread 
+						must be recorded to command streams. @c false 
+						otherwise.
 		 @throws		Exception
 						Failed to initialize at least one of the different 
 						rendering systems of this rendering manager.
 		 */
-		void InitializeSystems();
+		void InitializeSystems(bool record_commands);
 
 		/**
 		 Uninitializes the different rendering systems of this rendering 
@@ -204,6 +375,69 @@ namespace mage::rendering {
 		 */
 		void SetupDevice();
 
+		/**
+		 Renders the given GUI.
+
+		 @param[in]		time
+						A reference to the game time.
+		 @param[in]		present
+						@c true if the rendered frame must be presented. 
+						@c false otherwise.
+		 @param[in]		gui
+						A reference to the draw data of the GUI.
+		 @throws		Exception
+						Failed to render the world of this rendering manager.
+		 */
+		void Render(const GameTime& time, bool present, ImDrawData& gui);
+
+		/**
+		 Records the world and the given GUI to the back command stream of 
+		 this rendering manager.
+
+		 @param[in]		time
+						A reference to the game time.
+		 @param[in]		gui
+						A reference to the draw data of the GUI.
+		 @throws		Exception
+						Failed to record the world of this rendering manager.
+		 */
+		void Record(const GameTime& time, ImDrawData& gui);
+
+		/**
+		 Replays the given command stream and presents.
+
+		 @param[in]		stream
+						A reference to the command stream.
+		 @param[in]		present
+						@c true if the replayed frame must be presented. 
+						@c false otherwise.
+		 @throws		Exception
+						Failed to replay the given command stream.
+		 */
+		void Replay(const CommandStream& stream, bool present);
+
+		/**
+		 Resets the frame counters of this rendering manager.
+		 */
+		static void ResetFrameCounters() noexcept;
+
+		/**
+		 Copies the draw data of the current GUI frame to the GUI snapshot of 
+		 this rendering manager.
+		 */
+		void SnapshotGUI();
+
+		/**
+		 Renders the frames handed to the render thread of this rendering 
+		 manager until the render thread is terminated.
+		 */
+		void RunRenderThread() noexcept;
+
+		/**
+		 Terminates the render thread of this rendering manager (if any).
+		 */
+		void TerminateRenderThread() noexcept;
+
 		//---------------------------------------------------------------------
 		// Member Variables: Display Configuration
 		//---------------------------------------------------------------------
@@ -252,14 +486,124 @@ namespace mage::rendering {
 		 */
 		UniquePtr< World > m_world;
 
+		/**
+		 The command streams of this rendering manager. The main thread 
+		 records to the back command stream, while the render thread replays 
+		 the front command stream.
+		 */
+		CommandStream m_command_streams[2];
+
+		/**
+		 The index of the back command stream of this rendering manager.
+		 */
+		size_t m_command_stream_index;
+
+		/**
+		 A pointer to the command stream of the recorded, but not yet 
+		 replayed, current frame of this rendering manager (if any).
+		 */
+		const CommandStream* m_recorded_stream;
+
+		/**
+		 A pointer to the command recorder of this rendering manager (if 
+		 any).
+		 */
+		UniquePtr< CommandRecorder > m_command_recorder;
+
 		/**
 		 A pointer to the renderer of this rendering manager.
 		 */
 		UniquePtr< Renderer > m_renderer;
+
+		/**
+		 The timer measuring the time spent presenting the frames of this
+		 rendering manager.
+		 */
+		WallClockTimer m_present_timer;
+
+		/**
+		 The timer measuring the time spent rendering (excluding presenting) 
+		 the frames of this rendering manager.
+		 */
+		WallClockTimer m_render_timer;
+
+		//---------------------------------------------------------------------
+		// Member Variables: Render Thread
+		//---------------------------------------------------------------------
+
+		/**
+		 The render thread of this rendering manager.
+		 */
+		std::thread m_render_thread;
+
+		/**
+		 The mutex for handing frames to the render thread of this rendering 
+		 manager.
+		 */
+		std::mutex m_render_mutex;
+
+		/**
+		 The condition variable for handing frames to the render thread of 
+		 this rendering manager.
+		 */
+		std::condition_variable m_render_condition;
+
+		/**
+		 A flag indicating whether a frame is being rendered on the render 
+		 thread of this rendering manager.
+		 */
+		bool m_rendering;
+
+		/**
+		 A flag indicating whether the render thread of this rendering 
+		 manager must terminate.
+		 */
+		bool m_terminate;
+
+		/**
+		 The game time of the frame being rendered on the render thread of 
+		 this rendering manager.
+		 */
+		GameTime m_render_game_time;
+
+		/**
+		 A flag indicating whether the frame being rendered on the render 
+		 thread of this rendering manager must be presented.
+		 */
+		bool m_render_present;
+
+		/**
+		 A pointer to the command stream replayed on the render thread of 
+		 this rendering manager (if any).
+		 */
+		const CommandStream* m_render_stream;
+
+		/**
+		 The exception (if any) thrown while rendering the last frame on the 
+		 render thread of this rendering manager.
+		 */
+		std::exception_ptr m_render_exception;
+
+		/**
+		 The draw lists of the GUI snapshot of this rendering manager.
+		 */
+		std::vector< UniquePtr< ImDrawList > > m_gui_draw_lists;
+
+		/**
+		 The pointers to the draw lists of the GUI snapshot of this rendering 
+		 manager.
+		 */
+		std::vector< ImDrawList* > m_gui_cmd_lists;
+
+		/**
+		 The draw data of the GUI snapshot of this rendering manager.
+		 */
+		ImDrawData m_gui_draw_data;
 	};
 
 	Manager::Impl::Impl(NotNull< HWND > window, 
-						DisplayConfiguration configuration)
+						DisplayConfiguration configuration, 
+						bool record_commands)
 		: m_window(std::move(window)),
 		m_display_configuration(
 			MakeUnique< DisplayConfiguration >(std::move(configuration))),
@@ -269,18 +613,34 @@ namespace mage::rendering {
 		m_swap_chain(), 
 		m_resource_manager(), 
 		m_world(), 
-		m_renderer() {
-
-		InitializeSystems();
+		m_command_streams(), 
+		m_command_stream_index(0u), 
+		m_recorded_stream(nullptr), 
+		m_command_recorder(), 
+		m_renderer(),
+		m_present_timer(), 
+		m_render_timer(), 
+		m_render_thread(), 
+		m_render_mutex(), 
+		m_render_condition(), 
+		m_rendering(false), 
+		m_terminate(false), 
+		m_render_game_time(), 
+		m_render_present(false), 
+		m_render_stream(nullptr), 
+		m_render_exception(), 
+		m_gui_draw_lists(), 
+		m_gui_cmd_lists(), 
+		m_gui_draw_data() {
+
+		InitializeSystems(record_commands);
 	}
 
-	Manager::Impl::Impl(Manager::Impl&& manager) noexcept = default;
-
 	Manager::Impl::~Impl() {
 		UninitializeSystems();
 	}
 
-	void Manager::Impl::InitializeSystems() {
+	void Manager::Impl::InitializeSystems(bool record_commands) {
 		// Setup the device and device context.
 		SetupDevice();
 		
@@ -298,9 +658,19 @@ namespace mage::rendering {
 									  *m_display_configuration,
 									  *m_resource_manager);
 		
-		// Setup the renderer.
+		// Setup the command recorder.
+		if (record_commands) {
+			m_command_recorder = MakeUnique< CommandRecorder >(
+				*m_device.Get(), m_command_streams[m_command_stream_index]);
+		}
+
+		// Setup the renderer. The renderer records to the command recorder 
+		// (if any) instead of the device context.
+		ID3D11DeviceContext& renderer_context = m_command_recorder 
+			? static_cast< ID3D11DeviceContext& >(*m_command_recorder) 
+			: *m_device_context.Get();
 		m_renderer = MakeUnique< Renderer >(*m_device.Get(), 
-											*m_device_context.Get(), 
+											renderer_context, 
 											*m_display_configuration, 
 											*m_swap_chain, 
 											*m_resource_manager);
@@ -313,6 +683,10 @@ namespace mage::rendering {
 	}
 
 	void Manager::Impl::UninitializeSystems() noexcept {
+		// Uninitialize the render thread.
+		TerminateRenderThread();
+		m_gui_draw_lists.clear();
+
 		// Uninitialize ImGui.
 		ImGui_ImplDX11_Shutdown();
 		ImGui_ImplWin32_Shutdown();
@@ -324,6 +698,7 @@ namespace mage::rendering {
 		// Reset any device context to the default settings. 
 		if (m_device_context) {
 			m_device_context->ClearState();
+			Pipeline::InvalidateStateCache();
 		}
 	}
 
@@ -368,6 +743,13 @@ namespace mage::rendering {
 
 	void Manager::Impl::BindPersistentState() {
 		m_renderer->BindPersistentState();
+
+		if (m_command_recorder) {
+			// Replay the recorded commands right away.
+			auto& stream = m_command_recorder->GetStream();
+			CommandReplayer(*m_device_context.Get()).Replay(stream);
+			stream.Clear();
+		}
 	}
 
 	void Manager::Impl::Update() {
@@ -376,12 +758,223 @@ namespace mage::rendering {
 		ImGui::NewFrame();
 	}
 
-	void Manager::Impl::Render(const GameTime& time) {
+	[[nodiscard]]
+	const FrameCounters Manager::Impl::GetFrameCounters() const noexcept {
+		FrameCounters counters;
+		counters.m_nb_draws              = Pipeline::s_nb_draws;
+		counters.m_nb_triangles          = Pipeline::s_nb_vertices / 3u;
+		counters.m_nb_bindings           = Pipeline::s_nb_bindings;
+		counters.m_nb_redundant_bindings = Pipeline::s_nb_redundant_bindings;
+		counters.m_nb_occlusion_tests    = OcclusionCuller::s_nb_tests;
+		counters.m_nb_occlusion_culled   = OcclusionCuller::s_nb_culled;
+		counters.m_resident_size 
+			= m_resource_manager->GetStatistics().m_resident_size;
+		return counters;
+	}
+
+	void Manager::Impl::Render(const GameTime& time, bool present) {
+		if (m_command_recorder) {
+			// The recorded commands are replayed on the render thread.
+			RenderAsync(time, present);
+			WaitForRender();
+			return;
+		}
+
+		ImGui::Render();
+		Render(time, present, *ImGui::GetDrawData());
+	}
+
+	void Manager::Impl::RenderAsync(const GameTime& time, bool present) {
+		const CommandStream* stream = nullptr;
+		if (m_command_recorder) {
+			// Record this frame (unless recorded already) while the previous 
+			// frame is replayed.
+			if (!m_recorded_stream) {
+				Record(time);
+			}
+			stream = m_recorded_stream;
+			m_recorded_stream = nullptr;
+
+			WaitForRender();
+		}
+
+		// The render thread renders the snapshot of the GUI, since the next 
+		// GUI frame is built while rendering.
+		SnapshotGUI();
+
+		if (!m_render_thread.joinable()) {
+			m_render_thread = std::thread(&Impl::RunRenderThread, this);
+		}
+
+		{
+			const std::lock_guard< std::mutex > lock(m_render_mutex);
+			Assert(!m_rendering);
+			m_render_game_time = time;
+			m_render_present   = present;
+			m_render_stream    = stream;
+			m_rendering        = true;
+			// The rendering components are not part of the snapshot.
+			RestrictFrozenWorldAccess();
+			FreezeWorld(true);
+		}
+
+		m_render_condition.notify_all();
+	}
+
+	void Manager::Impl::Record(const GameTime& time) {
+		Assert(m_command_recorder);
+		Assert(!m_recorded_stream);
+
+		// The recorded GUI callback refers to the snapshot of the GUI, which 
+		// is only taken once the previous frame is replayed.
+		Record(time, m_gui_draw_data);
+		m_recorded_stream = &m_command_streams[m_command_stream_index];
+		m_command_stream_index = 1u - m_command_stream_index;
+	}
+
+	void Manager::Impl::WaitForRender() {
+		std::unique_lock< std::mutex > lock(m_render_mutex);
+		m_render_condition.wait(lock, [this]() noexcept {
+			return !m_rendering;
+		});
+
+		if (m_render_exception) {
+			const auto exception = m_render_exception;
+			m_render_exception = nullptr;
+			std::rethrow_exception(exception);
+		}
+	}
+
+	void Manager::Impl::SnapshotGUI() {
+		ImGui::Render();
+		const auto& draw_data = *ImGui::GetDrawData();
+		const auto nb_lists   = static_cast< size_t >(draw_data.CmdListsCount);
+
+		// Reuse the draw lists (and their memory) of the previous snapshots.
+		while (m_gui_draw_lists.size() < nb_lists) {
+			m_gui_draw_lists.push_back(
+				MakeUnique< ImDrawList >(ImGui::GetDrawListSharedData()));
+		}
+
+		m_gui_cmd_lists.clear();
+		for (size_t i = 0u; i < nb_lists; ++i) {
+			const auto& src = *draw_data.CmdLists[i];
+			auto& dst       = *m_gui_draw_lists[i];
+			Copy(src.CmdBuffer, dst.CmdBuffer);
+			Copy(src.IdxBuffer, dst.IdxBuffer);
+			Copy(src.VtxBuffer, dst.VtxBuffer);
+			m_gui_cmd_lists.push_back(&dst);
+		}
+
+		m_gui_draw_data          = draw_data;
+		m_gui_draw_data.CmdLists = m_gui_cmd_lists.data();
+	}
+
+	void Manager::Impl::RunRenderThread() noexcept {
+		// The render thread reads the snapshot of the transforms, since the 
+		// transforms of the next frame are updated while rendering.
+		Transform::ReadSnapshots(true);
+
+		std::unique_lock< std::mutex > lock(m_render_mutex);
+		while (true) {
+			m_render_condition.wait(lock, [this]() noexcept {
+				return m_rendering || m_terminate;
+			});
+
+			if (!m_rendering) {
+				return;
+			}
+
+			lock.unlock();
+
+			std::exception_ptr exception;
+			try {
+				if (m_render_stream) {
+					Replay(*m_render_stream, m_render_present);
+				}
+				else {
+					Render(m_render_game_time, m_render_present, m_gui_draw_data);
+				}
+			}
+			catch (...) {
+				exception = std::current_exception();
+			}
+
+			lock.lock();
+			FreezeWorld(false);
+			m_render_exception = exception;
+			m_rendering        = false;
+			m_render_condition.notify_all();
+		}
+	}
+
+	void Manager::Impl::TerminateRenderThread() noexcept {
+		if (!m_render_thread.joinable()) {
+			return;
+		}
+
+		{
+			const std::lock_guard< std::mutex > lock(m_render_mutex);
+			m_terminate = true;
+		}
+
+		m_render_condition.notify_all();
+		m_render_thread.join();
+	}
+
+	void Manager::Impl::Render(const GameTime& time, bool present, 
+							   ImDrawData& gui) {
+		m_render_timer.Restart();
+
+		Pipeline::ResetStateCache(*m_device_context.Get());
 		m_swap_chain->Clear();
-		Pipeline::s_nb_draws = 0u;
-		m_renderer->Render(GetWorld(), time);
+		ResetFrameCounters();
+		m_renderer->Render(GetWorld(), time, gui);
+
+		m_render_timer.Stop();
 		
-		m_swap_chain->Present();
+		m_present_timer.Restart();
+		if (present) {
+			m_swap_chain->Present();
+		}
+		m_present_timer.Stop();
+	}
+
+	void Manager::Impl::Record(const GameTime& time, ImDrawData& gui) {
+		auto& stream = m_command_streams[m_command_stream_index];
+		// Reuse the memory of the command stream.
+		stream.Clear();
+		m_command_recorder->SetStream(stream);
+
+		Pipeline::ResetStateCache(*m_command_recorder);
+		ResetFrameCounters();
+		m_renderer->Render(GetWorld(), time, gui);
+	}
+
+	void Manager::Impl::Replay(const CommandStream& stream, bool present) {
+		m_render_timer.Restart();
+
+		m_swap_chain->Clear();
+		CommandReplayer(*m_device_context.Get()).Replay(stream);
+
+		m_render_timer.Stop();
+
+		m_present_timer.Restart();
+		if (present) {
+			m_swap_chain->Present();
+		}
+		m_present_timer.Stop();
+	}
+
+	void Manager::Impl::ResetFrameCounters() noexcept {
+		Pipeline::s_nb_draws              = 0u;
+		Pipeline::s_nb_vertices           = 0u;
+		Pipeline::s_nb_bindings           = 0u;
+		Pipeline::s_nb_redundant_bindings = 0u;
+		OcclusionCuller::s_nb_occluders = 0u;
+		OcclusionCuller::s_nb_tests     = 0u;
+		OcclusionCuller::s_nb_culled    = 0u;
+		ShaderPermutation::s_nb_lookups = 0u;
 	}
 
 	#pragma endregion
@@ -392,9 +985,11 @@ namespace mage::rendering {
 	#pragma region
 
 	Manager::Manager(NotNull< HWND > window, 
-					 DisplayConfiguration configuration) 
+					 DisplayConfiguration configuration, 
+					 bool record_commands) 
 		: m_impl(MakeUnique< Impl >(std::move(window), 
-									std::move(configuration))) {}
+									std::move(configuration), 
+									record_commands)) {}
 
 	Manager::Manager(Manager&& manager) noexcept = default;
 
@@ -427,6 +1022,34 @@ namespace mage::rendering {
 		return m_impl->GetWorld();
 	}
 
+	[[nodiscard]]
+	UniquePtr< World > Manager::CreateWorld() const {
+		return m_impl->CreateWorld();
+	}
+
+	void Manager::BindWorld(World* world) const noexcept {
+		t_bound_world = world;
+	}
+
+	UniquePtr< World > Manager::SwapWorld(UniquePtr< World > world) noexcept {
+		return m_impl->SwapWorld(std::move(world));
+	}
+
+	[[nodiscard]]
+	TimeIntervalSeconds Manager::GetPresentTime() const noexcept {
+		return m_impl->GetPresentTime();
+	}
+
+	[[nodiscard]]
+	TimeIntervalSeconds Manager::GetRenderTime() const noexcept {
+		return m_impl->GetRenderTime();
+	}
+
+	[[nodiscard]]
+	const FrameCounters Manager::GetFrameCounters() const noexcept {
+		return m_impl->GetFrameCounters();
+	}
+
 	void Manager::BindPersistentState() {
 		m_impl->BindPersistentState();
 	}
@@ -435,8 +1058,20 @@ namespace mage::rendering {
 		m_impl->Update();
 	}
 
-	void Manager::Render(const GameTime& time) {
-		m_impl->Render(time);
+	void Manager::Render(const GameTime& time, bool present) {
+		m_impl->Render(time, present);
+	}
+
+	void Manager::RenderAsync(const GameTime& time, bool present) {
+		m_impl->RenderAsync(time, present);
+	}
+
+	void Manager::Record(const GameTime& time) {
+		m_impl->Record(time);
+	}
+
+	void Manager::WaitForRender() {
+		m_impl->WaitForRender();
 	}
 
 	#pragma endregion
@@ -17,6 +17,50 @@
 //-----------------------------------------------------------------------------
 namespace mage::rendering {
 
+	/**
+	 A struct of frame counters containing the CPU-side rendering work of a 
+	 frame.
+	 */
+	struct FrameCounters final {
+
+	public:
+
+		/**
+		 The number of draw calls.
+		 */
+		U32 m_nb_draws = 0u;
+
+		/**
+		 The number of drawn triangles (of non-indirect draw calls).
+		 */
+		U32 m_nb_triangles = 0u;
+
+		/**
+		 The number of issued (non-redundant) bindings.
+		 */
+		U32 m_nb_bindings = 0u;
+
+		/**
+		 The number of skipped (redundant) bindings.
+		 */
+		U32 m_nb_redundant_bindings = 0u;
+
+		/**
+		 The number of occlusion tests.
+		 */
+		U32 m_nb_occlusion_tests = 0u;
+
+		/**
+		 The number of occlusion culled objects.
+		 */
+		U32 m_nb_occlusion_culled = 0u;
+
+		/**
+		 The size in bytes of the resident resources.
+		 */
+		size_t m_resident_size = 0u;
+	};
+
 	/**
 	 A class of rendering managers.
 	 */
@@ -35,9 +79,15 @@ namespace mage::rendering {
 						The main window handle.
 		 @param[in]		configuration
 						The display configuration.
+		 @param[in]		record_commands
+						@c true if the frames rendered on the render thread 
+						must be recorded to command streams on the calling 
+						thread and replayed on the render thread. @c false 
+						otherwise.
 		 */
 		explicit Manager(NotNull< HWND > window, 
-						 DisplayConfiguration configuration);
+						 DisplayConfiguration configuration, 
+						 bool record_commands = false);
 
 		/**
 		 Constructs a rendering manager from the given rendering manager.
@@ -125,11 +175,76 @@ namespace mage::rendering {
 		/**
 		 Returns the world of this rendering manager.
 
+		 @return		A reference to the world bound to the calling thread, 
+						if any.
 		 @return		A reference to the world of this rendering manager.
 		 */
 		[[nodiscard]]
 		World& GetWorld() const noexcept;
 
+		/**
+		 Creates a (staging) world for this rendering manager.
+
+		 @return		A pointer to the world.
+		 @throws		Exception
+						Failed to create the world.
+		 */
+		[[nodiscard]]
+		UniquePtr< World > CreateWorld() const;
+
+		/**
+		 Binds the given world to the calling thread.
+
+		 While bound, GetWorld returns the given world on the calling thread. 
+		 This allows to load a scene into a staging world on a background 
+		 thread, while the world of this rendering manager is still rendered.
+
+		 @param[in]		world
+						A pointer to the world. @c nullptr to unbind the 
+						bound world.
+		 */
+		void BindWorld(World* world) const noexcept;
+
+		/**
+		 Replaces the world of this rendering manager with the given world.
+
+		 @param[in]		world
+						A pointer to the world.
+		 @return		A pointer to the previous world of this rendering 
+						manager.
+		 */
+		UniquePtr< World > SwapWorld(UniquePtr< World > world) noexcept;
+
+		/**
+		 Returns the time spent presenting the last frame of this rendering
+		 manager.
+
+		 @return		The time spent presenting the last frame of this
+						rendering manager.
+		 */
+		[[nodiscard]]
+		TimeIntervalSeconds GetPresentTime() const noexcept;
+
+		/**
+		 Returns the time spent rendering (excluding presenting) the last 
+		 frame of this rendering manager.
+
+		 @return		The time spent rendering the last frame of this 
+						rendering manager.
+		 */
+		[[nodiscard]]
+		TimeIntervalSeconds GetRenderTime() const noexcept;
+
+		/**
+		 Returns the frame counters of the last frame of this rendering 
+		 manager.
+
+		 @return		The frame counters of the last frame of this rendering 
+						manager.
+		 */
+		[[nodiscard]]
+		const FrameCounters GetFrameCounters() const noexcept;
+
 		/**
 		 Binds the persistent state of this rendering manager.
 
@@ -152,10 +267,76 @@ namespace mage::rendering {
 
 		 @param[in]		time
 						A reference to the game time.
+		 @param[in]		present
+						@c true if the rendered frame must be presented. 
+						@c false otherwise (e.g., to only measure the 
+						CPU-side rendering work).
+		 @throws		Exception
+						Failed to render the world of this rendering manager.
+		 */
+		void Render(const GameTime& time, bool present = true);
+
+		/**
+		 Renders on the render thread of this rendering manager, while the 
+		 calling thread continues with the next frame.
+
+		 The draw data of the current GUI frame is copied before returning. 
+		 The render thread reads the snapshot of the transforms (see 
+		 Transform::Snapshot) and the world of this rendering manager. Until 
+		 the frame is rendered (see WaitForRender), the world and its 
+		 components must not be changed, and the device context and swap 
+		 chain must not be used by any other thread.
+
+		 If this rendering manager records commands, the frame is recorded to 
+		 a command stream on the calling thread, while the previous frame (if 
+		 any) is still replayed on the render thread. The render thread only 
+		 replays the recorded commands, and does not read the world of this 
+		 rendering manager. Until the frame is rendered, the device objects 
+		 referenced by the recorded commands must not be destroyed.
+
+		 @pre			No frame is being rendered on the render thread of 
+						this rendering manager, unless this rendering manager 
+						records commands.
+		 @param[in]		time
+						A reference to the game time.
+		 @param[in]		present
+						@c true if the rendered frame must be presented. 
+						@c false otherwise (e.g., to only measure the 
+						CPU-side rendering work).
+		 @throws		Exception
+						Failed to start the render thread of this rendering 
+						manager.
+		 @throws		Exception
+						Failed to record the world of this rendering manager.
+		 */
+		void RenderAsync(const GameTime& time, bool present = true);
+
+		/**
+		 Records the current frame to a command stream on the calling thread, 
+		 while the previous frame (if any) is still replayed on the render 
+		 thread of this rendering manager. The next call to RenderAsync 
+		 replays the recorded frame instead of recording it again.
+
+		 Until the recorded frame is rendered, the device objects referenced 
+		 by the recorded commands must not be destroyed.
+
+		 @pre			This rendering manager records commands.
+		 @pre			The current frame is not recorded yet.
+		 @param[in]		time
+						A reference to the game time.
+		 @throws		Exception
+						Failed to record the world of this rendering manager.
+		 */
+		void Record(const GameTime& time);
+
+		/**
+		 Waits for the frame being rendered on the render thread of this 
+		 rendering manager (if any).
+
 		 @throws		Exception
 						Failed to render the world of this rendering manager.
 		 */
-		void Render(const GameTime& time);
+		void WaitForRender();
 
 	private:
 
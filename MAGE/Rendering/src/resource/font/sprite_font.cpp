@@ -4,6 +4,7 @@
 #pragma region
 
 #include "resource\font\sprite_font.hpp"
+#include "resource\texture\texture.hpp"
 #include "loaders\sprite_font_loader.hpp"
 #include "exception\exception.hpp"
 
@@ -115,6 +116,12 @@ namespace mage::rendering {
 
 	SpriteFont& SpriteFont::operator=(SpriteFont&& font) noexcept = default;
 
+	[[nodiscard]]
+	size_t SpriteFont::GetSizeInBytes() const noexcept {
+		return GetTextureSizeInBytes(*m_texture_srv.Get())
+			 + m_glyphs.capacity() * sizeof(Glyph);
+	}
+
 	void SpriteFont::InitializeSpriteFont(const SpriteFontOutput& output) {
 		using std::cbegin;
 		using std::cend;
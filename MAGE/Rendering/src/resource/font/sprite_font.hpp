@@ -272,6 +272,15 @@ namespace mage::rendering {
 			return m_texture_srv.Get();
 		}
 
+		/**
+		 Returns the size (in bytes) of this sprite font (i.e. the size of its 
+		 texture and glyphs).
+
+		 @return		The size (in bytes) of this sprite font.
+		 */
+		[[nodiscard]]
+		size_t GetSizeInBytes() const noexcept;
+
 	private:
 
 		//---------------------------------------------------------------------
@@ -0,0 +1,250 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "type\scalar_types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 A class of level-of-detail descriptors describing how the simplified
+	 levels of detail of the parts of a model must be generated.
+	 */
+	class LODDescriptor final {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a level-of-detail descriptor.
+
+		 @param[in]		nb_levels
+						The maximum number of simplified levels of detail
+						(excluding the original level of detail).
+		 @param[in]		target_ratio
+						The target ratio of the number of triangles of a level
+						of detail to the number of triangles of its preceding
+						level of detail.
+		 @param[in]		max_error
+						The maximum geometric error of a level of detail
+						relative to the radius of the bounding sphere of the
+						model part.
+		 @param[in]		normal_weight
+						The weight of normal deviations in the collapse costs.
+		 @param[in]		texture_weight
+						The weight of texture coordinate deviations in the
+						collapse costs.
+		 @param[in]		lock_borders
+						A flag indicating whether the vertices on the borders
+						and attribute seams of the model parts must be locked.
+		 */
+		constexpr explicit LODDescriptor(U32  nb_levels      = 0u,
+			                             F32  target_ratio   = 0.5f,
+			                             F32  max_error      = 0.05f,
+			                             F32  normal_weight  = 0.5f,
+			                             F32  texture_weight = 1.0f,
+			                             bool lock_borders   = true) noexcept
+			: m_nb_levels(nb_levels),
+			m_target_ratio(std::clamp(target_ratio, 0.0f, 1.0f)),
+			m_max_error(std::max(0.0f, max_error)),
+			m_normal_weight(std::max(0.0f, normal_weight)),
+			m_texture_weight(std::max(0.0f, texture_weight)),
+			m_lock_borders(lock_borders) {}
+
+		/**
+		 Constructs a level-of-detail descriptor from the given
+		 level-of-detail descriptor.
+
+		 @param[in]		desc
+						A reference to the level-of-detail descriptor to copy.
+		 */
+		constexpr LODDescriptor(const LODDescriptor& desc) noexcept = default;
+
+		/**
+		 Constructs a level-of-detail descriptor by moving the given
+		 level-of-detail descriptor.
+
+		 @param[in]		desc
+						A reference to the level-of-detail descriptor to move.
+		 */
+		constexpr LODDescriptor(LODDescriptor&& desc) noexcept = default;
+
+		/**
+		 Destructs this level-of-detail descriptor.
+		 */
+		~LODDescriptor() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given level-of-detail descriptor to this level-of-detail
+		 descriptor.
+
+		 @param[in]		desc
+						A reference to the level-of-detail descriptor to copy.
+		 @return		A reference to the copy of the given level-of-detail
+						descriptor (i.e. this level-of-detail descriptor).
+		 */
+		constexpr LODDescriptor& operator=(
+			const LODDescriptor& desc) noexcept = default;
+
+		/**
+		 Moves the given level-of-detail descriptor to this level-of-detail
+		 descriptor.
+
+		 @param[in]		desc
+						A reference to the level-of-detail descriptor to move.
+		 @return		A reference to the moved level-of-detail descriptor
+						(i.e. this level-of-detail descriptor).
+		 */
+		constexpr LODDescriptor& operator=(
+			LODDescriptor&& desc) noexcept = default;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Checks whether levels of detail should be generated according to this
+		 level-of-detail descriptor.
+
+		 @return		@c true if levels of detail should be generated.
+						@c false otherwise.
+		 */
+		[[nodiscard]]
+		constexpr bool GeneratesLODs() const noexcept {
+			return 0u != m_nb_levels;
+		}
+
+		/**
+		 Returns the maximum number of simplified levels of detail of this
+		 level-of-detail descriptor.
+
+		 @return		The maximum number of simplified levels of detail of
+						this level-of-detail descriptor.
+		 */
+		[[nodiscard]]
+		constexpr U32 GetNumberOfLevels() const noexcept {
+			return m_nb_levels;
+		}
+
+		/**
+		 Returns the target triangle ratio between two successive levels of
+		 detail of this level-of-detail descriptor.
+
+		 @return		The target triangle ratio between two successive
+						levels of detail of this level-of-detail descriptor.
+		 */
+		[[nodiscard]]
+		constexpr F32 GetTargetRatio() const noexcept {
+			return m_target_ratio;
+		}
+
+		/**
+		 Returns the maximum relative geometric error of this level-of-detail
+		 descriptor.
+
+		 @return		The maximum relative geometric error of this
+						level-of-detail descriptor.
+		 */
+		[[nodiscard]]
+		constexpr F32 GetMaximumError() const noexcept {
+			return m_max_error;
+		}
+
+		/**
+		 Returns the normal weight of this level-of-detail descriptor.
+
+		 @return		The normal weight of this level-of-detail descriptor.
+		 */
+		[[nodiscard]]
+		constexpr F32 GetNormalWeight() const noexcept {
+			return m_normal_weight;
+		}
+
+		/**
+		 Returns the texture weight of this level-of-detail descriptor.
+
+		 @return		The texture weight of this level-of-detail descriptor.
+		 */
+		[[nodiscard]]
+		constexpr F32 GetTextureWeight() const noexcept {
+			return m_texture_weight;
+		}
+
+		/**
+		 Checks whether the borders and attribute seams of model parts are
+		 locked according to this level-of-detail descriptor.
+
+		 @return		@c true if the borders and attribute seams of model
+						parts are locked. @c false otherwise.
+		 */
+		[[nodiscard]]
+		constexpr bool LocksBorders() const noexcept {
+			return m_lock_borders;
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The maximum number of simplified levels of detail of this
+		 level-of-detail descriptor.
+		 */
+		U32 m_nb_levels;
+
+		/**
+		 The target triangle ratio between two successive levels of detail of
+		 this level-of-detail descriptor.
+		 */
+		F32 m_target_ratio;
+
+		/**
+		 The maximum geometric error (relative to the bounding sphere radius
+		 of a model part) of this level-of-detail descriptor.
+		 */
+		F32 m_max_error;
+
+		/**
+		 The weight of normal deviations of this level-of-detail descriptor.
+		 */
+		F32 m_normal_weight;
+
+		/**
+		 The weight of texture coordinate deviations of this level-of-detail
+		 descriptor.
+		 */
+		F32 m_texture_weight;
+
+		/**
+		 A flag indicating whether the borders and attribute seams of model
+		 parts are locked for this level-of-detail descriptor.
+		 */
+		bool m_lock_borders;
+	};
+}
\ No newline at end of file
@@ -28,4 +28,17 @@ namespace mage::rendering {
 	Mesh::~Mesh() = default;
 
 	Mesh& Mesh::operator=(Mesh&& mesh) noexcept = default;
+
+	const std::vector< Point3 > Mesh
+		::GetTrianglePositions([[maybe_unused]] size_t start_index, 
+							   [[maybe_unused]] size_t nb_indices) const {
+
+		return {};
+	}
+
+	[[nodiscard]]
+	size_t Mesh::GetSizeInBytes() const noexcept {
+		const size_t index_size = (DXGI_FORMAT_R16_UINT == m_index_format) ? 2u : 4u;
+		return m_nb_vertices * m_vertex_size + m_nb_indices * index_size;
+	}
 }
\ No newline at end of file
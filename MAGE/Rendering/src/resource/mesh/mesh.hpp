@@ -6,6 +6,16 @@
 #pragma region
 
 #include "renderer\pipeline.hpp"
+#include "geometry\geometry.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <vector>
 
 #pragma endregion
 
@@ -198,6 +208,32 @@ namespace mage::rendering {
 				                  static_cast< U32 >(start_index));
 		}
 
+		/**
+		 Returns the vertex positions of the triangles of a submesh of this 
+		 mesh.
+
+		 @param[in]		start_index
+						The start index.
+		 @param[in]		nb_indices
+						The number of indices.
+		 @return		A vector containing three consecutive vertex 
+						positions per triangle of the given submesh. The 
+						vector is empty if this mesh has no CPU copy of its 
+						vertex positions.
+		 */
+		[[nodiscard]]
+		virtual const std::vector< Point3 > 
+			GetTrianglePositions(size_t start_index, size_t nb_indices) const;
+
+		/**
+		 Returns the size (in bytes) of this mesh (i.e. the size of its vertex 
+		 and index buffers).
+
+		 @return		The size (in bytes) of this mesh.
+		 */
+		[[nodiscard]]
+		virtual size_t GetSizeInBytes() const noexcept;
+
 	protected:
 
 		//---------------------------------------------------------------------
@@ -5,7 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "type\scalar_types.hpp"
+#include "resource\mesh\lod_descriptor.hpp"
 
 #pragma endregion
 
@@ -41,12 +41,21 @@ namespace mage::rendering {
 						A flag indicating whether the face vertices should be 
 						defined in clockwise order or not (i.e. 
 						counterclockwise order).
+		 @param[in]		lod_desc
+						The level-of-detail descriptor.
+		 @param[in]		generate_meshlets
+						A flag indicating whether the meshlets of the mesh 
+						should be generated.
 		 */
 		constexpr explicit MeshDescriptor(
 			bool invert_handedness = false, 
-			bool clockwise_order   = true) noexcept
+			bool clockwise_order   = true,
+			LODDescriptor lod_desc = LODDescriptor(),
+			bool generate_meshlets = false) noexcept
 			: m_invert_handedness(invert_handedness), 
-			m_clockwise_order(clockwise_order) {}
+			m_clockwise_order(clockwise_order),
+			m_lod_desc(lod_desc),
+			m_generate_meshlets(generate_meshlets) {}
 		
 		/**
 		 Constructs a mesh descriptor from the given mesh descriptor.
@@ -124,6 +133,29 @@ namespace mage::rendering {
 			return m_clockwise_order;
 		}
 
+		/**
+		 Returns the level-of-detail descriptor of this mesh descriptor.
+
+		 @return		A reference to the level-of-detail descriptor of this 
+						mesh descriptor.
+		 */
+		[[nodiscard]]
+		constexpr const LODDescriptor& GetLODDescriptor() const noexcept {
+			return m_lod_desc;
+		}
+
+		/**
+		 Checks whether the meshlets of the mesh should be generated according 
+		 to this mesh descriptor.
+
+		 @return		@c true if the meshlets of the mesh should be 
+						generated. @c false otherwise.
+		 */
+		[[nodiscard]]
+		constexpr bool GeneratesMeshlets() const noexcept {
+			return m_generate_meshlets;
+		}
+
 	private:
 
 		//---------------------------------------------------------------------
@@ -142,5 +174,16 @@ namespace mage::rendering {
 		 descriptor.
 		 */
 		bool m_clockwise_order;
+
+		/**
+		 The level-of-detail descriptor of this mesh descriptor.
+		 */
+		LODDescriptor m_lod_desc;
+
+		/**
+		 A flag indicating whether the meshlets of the mesh should be generated 
+		 for this mesh descriptor.
+		 */
+		bool m_generate_meshlets;
 	};
 }
\ No newline at end of file
@@ -0,0 +1,149 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "resource\mesh\meshlet.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	MeshletSet::MeshletSet(const AlignedVector< Meshlet >& meshlets)
+		: m_packets((meshlets.size() + 3u) / 4u),
+		m_ranges() {
+
+		m_ranges.reserve(meshlets.size());
+
+		for (size_t i = 0; i < m_packets.size(); ++i) {
+			F32x4 sphere[4] = {};
+			F32x4 cone[4]   = {};
+
+			for (size_t j = 0; j < 4u; ++j) {
+				if (meshlets.size() <= 4u * i + j) {
+					break;
+				}
+
+				const auto& meshlet  = meshlets[4u * i + j];
+				const auto  centroid = XMStore< F32x3 >(meshlet.m_sphere.Centroid());
+
+				sphere[0][j] = centroid[0];
+				sphere[1][j] = centroid[1];
+				sphere[2][j] = centroid[2];
+				sphere[3][j] = meshlet.m_sphere.Radius();
+
+				cone[0][j]   = meshlet.m_cone_axis[0];
+				cone[1][j]   = meshlet.m_cone_axis[1];
+				cone[2][j]   = meshlet.m_cone_axis[2];
+				cone[3][j]   = meshlet.m_cone_cutoff;
+
+				m_ranges.push_back({ meshlet.m_start_index,
+									 meshlet.m_nb_indices });
+			}
+
+			for (size_t k = 0; k < 4u; ++k) {
+				m_packets[i].m_sphere[k] = XMLoad(sphere[k]);
+				m_packets[i].m_cone[k]   = XMLoad(cone[k]);
+			}
+		}
+	}
+
+	MeshletSet::MeshletSet(const MeshletSet& meshlet_set) = default;
+
+	MeshletSet::MeshletSet(MeshletSet&& meshlet_set) noexcept = default;
+
+	MeshletSet::~MeshletSet() = default;
+
+	MeshletSet& MeshletSet::operator=(const MeshletSet& meshlet_set) = default;
+
+	MeshletSet& MeshletSet::operator=(MeshletSet&& meshlet_set) noexcept = default;
+
+	void XM_CALLCONV MeshletSet::Cull(FXMMATRIX object_to_projection,
+									  FXMVECTOR eye,
+									  bool cull_backfaces,
+									  std::vector< U32x2 >& ranges) const {
+		ranges.clear();
+
+		// Extract the (object space) view frustum planes once and splat their
+		// components for the SoA tests.
+		const BoundingFrustum frustum(object_to_projection);
+		XMVECTOR planes[6][4];
+		for (size_t k = 0; k < std::size(planes); ++k) {
+			const auto plane = frustum.GetPlane(k);
+			planes[k][0] = XMVectorSplatX(plane);
+			planes[k][1] = XMVectorSplatY(plane);
+			planes[k][2] = XMVectorSplatZ(plane);
+			planes[k][3] = XMVectorSplatW(plane);
+		}
+
+		const auto eye_x = XMVectorSplatX(eye);
+		const auto eye_y = XMVectorSplatY(eye);
+		const auto eye_z = XMVectorSplatZ(eye);
+
+		for (size_t i = 0; i < m_packets.size(); ++i) {
+			const auto& packet = m_packets[i];
+			const auto  x      = packet.m_sphere[0];
+			const auto  y      = packet.m_sphere[1];
+			const auto  z      = packet.m_sphere[2];
+			const auto  r      = packet.m_sphere[3];
+			const auto  neg_r  = XMVectorNegate(r);
+
+			// Frustum test: the bounding sphere may not lie completely behind
+			// one of the planes.
+			auto visible = XMVectorTrueInt();
+			for (const auto& plane : planes) {
+				auto distance = XMVectorMultiplyAdd(x, plane[0], plane[3]);
+				distance      = XMVectorMultiplyAdd(y, plane[1], distance);
+				distance      = XMVectorMultiplyAdd(z, plane[2], distance);
+				visible       = XMVectorAndInt(visible,
+									XMVectorGreaterOrEqual(distance, neg_r));
+			}
+
+			// Normal cone test: cull if
+			// dot(c - eye, axis) >= cutoff * length(c - eye) + r.
+			if (cull_backfaces) {
+				const auto dx = x - eye_x;
+				const auto dy = y - eye_y;
+				const auto dz = z - eye_z;
+
+				auto dot      = dx * packet.m_cone[0];
+				dot           = XMVectorMultiplyAdd(dy, packet.m_cone[1], dot);
+				dot           = XMVectorMultiplyAdd(dz, packet.m_cone[2], dot);
+
+				auto length   = dx * dx;
+				length        = XMVectorMultiplyAdd(dy, dy, length);
+				length        = XMVectorMultiplyAdd(dz, dz, length);
+				length        = XMVectorSqrt(length);
+
+				const auto threshold
+					= XMVectorMultiplyAdd(packet.m_cone[3], length, r);
+				visible = XMVectorAndCInt(visible,
+							XMVectorGreaterOrEqual(dot, threshold));
+			}
+
+			const auto mask = XMStore< U32x4 >(visible);
+			for (size_t j = 0; j < 4u; ++j) {
+				const auto index = 4u * i + j;
+				if (m_ranges.size() <= index) {
+					break;
+				}
+				if (0u == mask[j]) {
+					continue;
+				}
+
+				// Merge adjacent index ranges.
+				const auto& range = m_ranges[index];
+				if (!ranges.empty()
+					&& ranges.back()[0] + ranges.back()[1] == range[0]) {
+					ranges.back()[1] += range[1];
+				}
+				else {
+					ranges.push_back(range);
+				}
+			}
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,236 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "geometry\bounding_volume.hpp"
+#include "collection\vector.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	#pragma warning( push )
+	#pragma warning( disable : 4324 ) // Added padding.
+
+	/**
+	 A struct of meshlets (i.e. small clusters of triangles of a mesh).
+	 */
+	struct alignas(16) Meshlet final {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The maximum number of (unique) vertices of meshlets.
+		 */
+		static constexpr U32 s_max_nb_vertices = 64u;
+
+		/**
+		 The maximum number of triangles of meshlets.
+		 */
+		static constexpr U32 s_max_nb_triangles = 124u;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The bounding sphere of this meshlet.
+		 */
+		BoundingSphere m_sphere;
+
+		/**
+		 The (normalized) axis of the normal cone of this meshlet.
+		 */
+		F32x3 m_cone_axis = {};
+
+		/**
+		 The cutoff of the normal cone of this meshlet (i.e. the sine of the
+		 maximum angle between the triangle normals and the cone axis, or
+		 @c 1 if the normal cone is degenerate).
+		 */
+		F32 m_cone_cutoff = 1.0f;
+
+		/**
+		 The start index of this meshlet in the mesh of the corresponding
+		 model.
+		 */
+		U32 m_start_index = 0u;
+
+		/**
+		 The number of indices of this meshlet in the mesh of the
+		 corresponding model.
+		 */
+		U32 m_nb_indices = 0u;
+	};
+
+	/**
+	 A class of meshlet sets storing the bounding data of meshlets in packets
+	 of four to cull them in SIMD.
+	 */
+	class MeshletSet final {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a meshlet set.
+
+		 @param[in]		meshlets
+						A reference to a vector containing the meshlets.
+		 */
+		explicit MeshletSet(const AlignedVector< Meshlet >& meshlets
+							= AlignedVector< Meshlet >());
+
+		/**
+		 Constructs a meshlet set from the given meshlet set.
+
+		 @param[in]		meshlet_set
+						A reference to the meshlet set to copy.
+		 */
+		MeshletSet(const MeshletSet& meshlet_set);
+
+		/**
+		 Constructs a meshlet set by moving the given meshlet set.
+
+		 @param[in]		meshlet_set
+						A reference to the meshlet set to move.
+		 */
+		MeshletSet(MeshletSet&& meshlet_set) noexcept;
+
+		/**
+		 Destructs this meshlet set.
+		 */
+		~MeshletSet();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given meshlet set to this meshlet set.
+
+		 @param[in]		meshlet_set
+						A reference to the meshlet set to copy.
+		 @return		A reference to the copy of the given meshlet set (i.e.
+						this meshlet set).
+		 */
+		MeshletSet& operator=(const MeshletSet& meshlet_set);
+
+		/**
+		 Moves the given meshlet set to this meshlet set.
+
+		 @param[in]		meshlet_set
+						A reference to the meshlet set to move.
+		 @return		A reference to the moved meshlet set (i.e. this
+						meshlet set).
+		 */
+		MeshletSet& operator=(MeshletSet&& meshlet_set) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Checks whether this meshlet set is empty.
+
+		 @return		@c true if this meshlet set is empty. @c false
+						otherwise.
+		 */
+		[[nodiscard]]
+		bool empty() const noexcept {
+			return m_ranges.empty();
+		}
+
+		/**
+		 Returns the number of meshlets of this meshlet set.
+
+		 @return		The number of meshlets of this meshlet set.
+		 */
+		[[nodiscard]]
+		size_t size() const noexcept {
+			return m_ranges.size();
+		}
+
+		/**
+		 Culls the meshlets of this meshlet set against the view frustum and
+		 (optionally) their normal cones.
+
+		 @param[in]		object_to_projection
+						The object-to-projection transformation matrix.
+		 @param[in]		eye
+						The position of the camera expressed in object space.
+		 @param[in]		cull_backfaces
+						A flag indicating whether meshlets whose triangles all
+						face away from the camera must be culled.
+		 @param[out]	ranges
+						A reference to a vector for storing the compacted
+						index ranges (start index and number of indices) of
+						the visible meshlets.
+		 */
+		void XM_CALLCONV Cull(FXMMATRIX object_to_projection,
+							  FXMVECTOR eye,
+							  bool cull_backfaces,
+							  std::vector< U32x2 >& ranges) const;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 A struct of meshlet packets containing the bounding data of four
+		 meshlets in a structure-of-arrays layout.
+		 */
+		struct MeshletPacket final {
+
+		public:
+
+			//-----------------------------------------------------------------
+			// Member Variables
+			//-----------------------------------------------------------------
+
+			/**
+			 The x, y, z coordinates of the bounding sphere centroids and the
+			 bounding sphere radii of the meshlets of this meshlet packet.
+			 */
+			XMVECTOR m_sphere[4];
+
+			/**
+			 The x, y, z coordinates of the normal cone axes and the normal
+			 cone cutoffs of the meshlets of this meshlet packet.
+			 */
+			XMVECTOR m_cone[4];
+		};
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A vector containing the meshlet packets of this meshlet set.
+		 */
+		AlignedVector< MeshletPacket > m_packets;
+
+		/**
+		 A vector containing the index ranges (start index and number of
+		 indices) of the meshlets of this meshlet set.
+		 */
+		std::vector< U32x2 > m_ranges;
+	};
+
+	#pragma warning( pop )
+}
\ No newline at end of file
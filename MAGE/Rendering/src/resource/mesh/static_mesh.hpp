@@ -107,6 +107,35 @@ namespace mage::rendering {
 		 */
 		StaticMesh& operator=(StaticMesh&& mesh) noexcept;
 
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the vertex positions of the triangles of a submesh of this 
+		 static mesh.
+
+		 @param[in]		start_index
+						The start index.
+		 @param[in]		nb_indices
+						The number of indices.
+		 @return		A vector containing three consecutive vertex 
+						positions per triangle of the given submesh.
+		 */
+		[[nodiscard]]
+		virtual const std::vector< Point3 > 
+			GetTrianglePositions(size_t start_index, 
+								 size_t nb_indices) const override;
+
+		/**
+		 Returns the size (in bytes) of this static mesh (i.e. the size of its 
+		 vertex and index buffers and of their CPU copies).
+
+		 @return		The size (in bytes) of this static mesh.
+		 */
+		[[nodiscard]]
+		virtual size_t GetSizeInBytes() const noexcept override;
+
 	private:
 
 		//---------------------------------------------------------------------
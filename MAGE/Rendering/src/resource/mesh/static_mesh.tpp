@@ -43,6 +43,34 @@ namespace mage::rendering {
 	StaticMesh< VertexT, IndexT >& StaticMesh< VertexT, IndexT >
 		::operator=(StaticMesh&& mesh) noexcept = default;
 
+	template< typename VertexT, typename IndexT >
+	const std::vector< Point3 > StaticMesh< VertexT, IndexT >
+		::GetTrianglePositions(size_t start_index, size_t nb_indices) const {
+
+		std::vector< Point3 > positions;
+		
+		if constexpr (VertexT::HasPosition()) {
+			const auto end = std::min(start_index + nb_indices, m_indices.size());
+			positions.reserve(end - std::min(start_index, end));
+			
+			for (auto i = start_index; i + 2u < end; i += 3u) {
+				positions.push_back(m_vertices[m_indices[i]].m_p);
+				positions.push_back(m_vertices[m_indices[i + 1u]].m_p);
+				positions.push_back(m_vertices[m_indices[i + 2u]].m_p);
+			}
+		}
+
+		return positions;
+	}
+
+	template< typename VertexT, typename IndexT >
+	[[nodiscard]]
+	size_t StaticMesh< VertexT, IndexT >::GetSizeInBytes() const noexcept {
+		return Mesh::GetSizeInBytes()
+			 + m_vertices.capacity() * sizeof(VertexT)
+			 + m_indices.capacity()  * sizeof(IndexT);
+	}
+
 	template< typename VertexT, typename IndexT >
 	void StaticMesh< VertexT, IndexT >
 		::SetupVertexBuffer(ID3D11Device& device) {
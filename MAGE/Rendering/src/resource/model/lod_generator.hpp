@@ -0,0 +1,49 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "resource\model\model_output.hpp"
+#include "resource\mesh\lod_descriptor.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 Generates the levels of detail of all model parts of the given model
+	 output.
+
+	 The levels of detail are generated by iteratively collapsing the edges
+	 with the smallest quadric error metric (QEM) cost onto one of their
+	 existing vertices. Hence, the vertex buffer of the given model output is
+	 shared by all levels of detail, while the indices of each level of detail
+	 are appended to the index buffer of the given model output.
+
+	 @tparam		VertexT
+					The vertex type.
+	 @tparam		IndexT
+					The index type.
+	 @param[in,out]	model_output
+					A reference to the model output.
+	 @param[in]		desc
+					A reference to the level-of-detail descriptor.
+	 */
+	template< typename VertexT, typename IndexT >
+	void GenerateLODs(ModelOutput< VertexT, IndexT >& model_output,
+		              const LODDescriptor& desc);
+}
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "resource\model\lod_generator.tpp"
+
+#pragma endregion
\ No newline at end of file
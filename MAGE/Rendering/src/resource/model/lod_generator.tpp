@@ -0,0 +1,739 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	namespace details {
+
+		/**
+		 The weight of the constraint planes of unlocked border edges.
+		 */
+		constexpr F64 g_border_weight = 10.0;
+
+		/**
+		 A struct of (symmetric) error quadrics.
+		 */
+		struct ErrorQuadric final {
+
+		public:
+
+			//-----------------------------------------------------------------
+			// Member Methods
+			//-----------------------------------------------------------------
+
+			/**
+			 Adds the given plane to this error quadric.
+
+			 @param[in]		plane
+							The plane (normalized normal and offset).
+			 @param[in]		weight
+							The weight of the plane.
+			 */
+			void XM_CALLCONV AddPlane(FXMVECTOR plane, F64 weight) noexcept {
+				const auto p = XMStore< F32x4 >(plane);
+				const F64 a = p[0], b = p[1], c = p[2], d = p[3];
+
+				m_q[0] += weight * a * a;
+				m_q[1] += weight * a * b;
+				m_q[2] += weight * a * c;
+				m_q[3] += weight * a * d;
+				m_q[4] += weight * b * b;
+				m_q[5] += weight * b * c;
+				m_q[6] += weight * b * d;
+				m_q[7] += weight * c * c;
+				m_q[8] += weight * c * d;
+				m_q[9] += weight * d * d;
+			}
+
+			/**
+			 Adds the given error quadric to this error quadric.
+
+			 @param[in]		quadric
+							A reference to the error quadric.
+			 @return		A reference to this error quadric.
+			 */
+			ErrorQuadric& operator+=(const ErrorQuadric& quadric) noexcept {
+				for (size_t i = 0; i < std::size(m_q); ++i) {
+					m_q[i] += quadric.m_q[i];
+				}
+				return *this;
+			}
+
+			/**
+			 Evaluates this error quadric at the given point.
+
+			 @param[in]		p
+							A reference to the point.
+			 @return		The sum of the weighted squared distances of the
+							given point to the planes of this error quadric.
+			 */
+			[[nodiscard]]
+			F64 Evaluate(const Point3& p) const noexcept {
+				const F64 x = p[0], y = p[1], z = p[2];
+
+				const F64 error
+					=       m_q[0] * x * x + 2.0 * m_q[1] * x * y
+					+ 2.0 * m_q[2] * x * z + 2.0 * m_q[3] * x
+					+       m_q[4] * y * y + 2.0 * m_q[5] * y * z
+					+ 2.0 * m_q[6] * y     +       m_q[7] * z * z
+					+ 2.0 * m_q[8] * z     +       m_q[9];
+
+				return std::max(0.0, error);
+			}
+
+			//-----------------------------------------------------------------
+			// Member Variables
+			//-----------------------------------------------------------------
+
+			/**
+			 The upper triangular coefficients of the 4x4 matrix of this error
+			 quadric.
+			 */
+			F64 m_q[10] = {};
+		};
+
+		/**
+		 A struct of edge collapses.
+		 */
+		struct EdgeCollapse final {
+
+		public:
+
+			//-----------------------------------------------------------------
+			// Member Variables
+			//-----------------------------------------------------------------
+
+			/**
+			 The total (i.e. geometric and attribute) cost of this edge
+			 collapse.
+			 */
+			F64 m_cost;
+
+			/**
+			 The relative squared geometric error of this edge collapse.
+			 */
+			F64 m_error;
+
+			/**
+			 The (local) index of the vertex to remove.
+			 */
+			U32 m_from;
+
+			/**
+			 The (local) index of the vertex to keep.
+			 */
+			U32 m_to;
+		};
+
+		/**
+		 Returns the edge key of the given (undirected) edge.
+
+		 @param[in]		v0
+						The (local) index of the first vertex of the edge.
+		 @param[in]		v1
+						The (local) index of the second vertex of the edge.
+		 @return		The edge key of the given edge.
+		 */
+		[[nodiscard]]
+		inline U64 GetEdgeKey(U32 v0, U32 v1) noexcept {
+			return (v0 < v1) ? ((static_cast< U64 >(v0) << 32u) | v1)
+			                 : ((static_cast< U64 >(v1) << 32u) | v0);
+		}
+
+		/**
+		 Returns the (unnormalized) face normal of the given triangle.
+
+		 @param[in]		p0
+						A reference to the first vertex position.
+		 @param[in]		p1
+						A reference to the second vertex position.
+		 @param[in]		p2
+						A reference to the third vertex position.
+		 @return		The (unnormalized) face normal of the given triangle.
+		 */
+		[[nodiscard]]
+		inline const XMVECTOR XM_CALLCONV GetFaceNormal(const Point3& p0,
+			                                            const Point3& p1,
+			                                            const Point3& p2) noexcept {
+			const auto v0 = XMLoad(p0);
+			return XMVector3Cross(XMLoad(p1) - v0, XMLoad(p2) - v0);
+		}
+
+		/**
+		 A class of level-of-detail generators for a single model part.
+
+		 @tparam		VertexT
+						The vertex type.
+		 @tparam		IndexT
+						The index type.
+		 */
+		template< typename VertexT, typename IndexT >
+		class LODGenerator final {
+
+		public:
+
+			//-----------------------------------------------------------------
+			// Constructors and Destructors
+			//-----------------------------------------------------------------
+
+			/**
+			 Constructs a level-of-detail generator.
+
+			 @param[in]		vertices
+							A reference to the vertex buffer.
+			 @param[in,out]	indices
+							A reference to the index buffer.
+			 @param[in]		desc
+							A reference to the level-of-detail descriptor.
+			 */
+			explicit LODGenerator(const std::vector< VertexT >& vertices,
+				                  std::vector< IndexT >& indices,
+				                  const LODDescriptor& desc)
+				: m_vertices(vertices),
+				m_indices(indices),
+				m_desc(desc),
+				m_local_to_global(),
+				m_triangles(),
+				m_alive(),
+				m_quadrics(),
+				m_locked(),
+				m_nb_alive(0),
+				m_inv_radius_sq(0.0),
+				m_max_error_sq(0.0) {}
+
+			/**
+			 Constructs a level-of-detail generator from the given
+			 level-of-detail generator.
+
+			 @param[in]		generator
+							A reference to the level-of-detail generator to
+							copy.
+			 */
+			LODGenerator(const LODGenerator& generator) = delete;
+
+			/**
+			 Constructs a level-of-detail generator by moving the given
+			 level-of-detail generator.
+
+			 @param[in]		generator
+							A reference to the level-of-detail generator to
+							move.
+			 */
+			LODGenerator(LODGenerator&& generator) = delete;
+
+			/**
+			 Destructs this level-of-detail generator.
+			 */
+			~LODGenerator() = default;
+
+			//-----------------------------------------------------------------
+			// Assignment Operators
+			//-----------------------------------------------------------------
+
+			/**
+			 Copies the given level-of-detail generator to this
+			 level-of-detail generator.
+
+			 @param[in]		generator
+							A reference to the level-of-detail generator to
+							copy.
+			 @return		A reference to the copy of the given
+							level-of-detail generator (i.e. this
+							level-of-detail generator).
+			 */
+			LODGenerator& operator=(const LODGenerator& generator) = delete;
+
+			/**
+			 Moves the given level-of-detail generator to this
+			 level-of-detail generator.
+
+			 @param[in]		generator
+							A reference to the level-of-detail generator to
+							move.
+			 @return		A reference to the moved level-of-detail generator
+							(i.e. this level-of-detail generator).
+			 */
+			LODGenerator& operator=(LODGenerator&& generator) = delete;
+
+			//-----------------------------------------------------------------
+			// Member Methods
+			//-----------------------------------------------------------------
+
+			/**
+			 Generates the levels of detail of the given model part.
+
+			 @param[in,out]	model_part
+							A reference to the model part.
+			 */
+			void Generate(ModelPart& model_part) {
+				model_part.m_lods.clear();
+
+				const auto radius = model_part.m_sphere.Radius();
+				if (radius <= 0.0f) {
+					return;
+				}
+				m_inv_radius_sq = 1.0 / (static_cast< F64 >(radius) * radius);
+
+				Setup(model_part);
+
+				const auto max_error_sq = static_cast< F64 >(m_desc.GetMaximumError())
+					                    * static_cast< F64 >(m_desc.GetMaximumError());
+
+				for (U32 level = 0u; level < m_desc.GetNumberOfLevels(); ++level) {
+					const auto nb_triangles = m_nb_alive;
+					const auto target = static_cast< size_t >(
+						nb_triangles * m_desc.GetTargetRatio());
+
+					while (target < m_nb_alive) {
+						if (!Pass(target, max_error_sq)) {
+							break;
+						}
+					}
+
+					if (0u == m_nb_alive || nb_triangles == m_nb_alive) {
+						break;
+					}
+
+					ModelPartLOD lod;
+					lod.m_start_index = static_cast< U32 >(m_indices.size());
+					lod.m_nb_indices  = static_cast< U32 >(3u * m_nb_alive);
+					lod.m_error       = static_cast< F32 >(std::sqrt(m_max_error_sq));
+
+					for (size_t t = 0; t < m_triangles.size(); ++t) {
+						if (!m_alive[t]) {
+							continue;
+						}
+						for (const auto v : m_triangles[t]) {
+							m_indices.push_back(m_local_to_global[v]);
+						}
+					}
+
+					model_part.m_lods.push_back(lod);
+				}
+			}
+
+		private:
+
+			//-----------------------------------------------------------------
+			// Member Methods
+			//-----------------------------------------------------------------
+
+			/**
+			 Sets up the local topology, the error quadrics and the locked
+			 vertices of the given model part.
+
+			 @param[in]		model_part
+							A reference to the model part.
+			 */
+			void Setup(const ModelPart& model_part) {
+				std::unordered_map< IndexT, U32 > global_to_local;
+
+				const size_t start = model_part.m_start_index;
+				const size_t end   = start + model_part.m_nb_indices;
+				for (auto i = start; i + 2u < end; i += 3u) {
+					U32x3 triangle;
+					for (size_t j = 0u; j < 3u; ++j) {
+						const auto global = m_indices[i + j];
+						const auto [it, inserted] = global_to_local.try_emplace(
+							global, static_cast< U32 >(m_local_to_global.size()));
+						if (inserted) {
+							m_local_to_global.push_back(global);
+						}
+						triangle[j] = it->second;
+					}
+
+					if (triangle[0] == triangle[1]
+						|| triangle[1] == triangle[2]
+						|| triangle[2] == triangle[0]) {
+						continue;
+					}
+
+					m_triangles.push_back(triangle);
+				}
+
+				const auto nb_vertices = m_local_to_global.size();
+				m_alive.assign(m_triangles.size(), 1u);
+				m_nb_alive = m_triangles.size();
+				m_quadrics.assign(nb_vertices, ErrorQuadric());
+				m_locked.assign(nb_vertices, 0u);
+				m_max_error_sq = 0.0;
+
+				// Accumulate the face planes.
+				std::unordered_map< U64, U32 > edge_counts;
+				for (const auto& triangle : m_triangles) {
+					const auto plane = GetPlane(triangle);
+					for (size_t j = 0u; j < 3u; ++j) {
+						m_quadrics[triangle[j]].AddPlane(plane, 1.0);
+						++edge_counts[GetEdgeKey(triangle[j], triangle[(j + 1u) % 3u])];
+					}
+				}
+
+				// Lock or constrain the border vertices. Since vertices with
+				// different attributes are not welded, attribute seams are
+				// borders as well.
+				for (const auto& triangle : m_triangles) {
+					for (size_t j = 0u; j < 3u; ++j) {
+						const auto v0 = triangle[j];
+						const auto v1 = triangle[(j + 1u) % 3u];
+						const auto count = edge_counts[GetEdgeKey(v0, v1)];
+
+						if (2u == count) {
+							continue;
+						}
+
+						if (m_desc.LocksBorders() || 1u != count) {
+							m_locked[v0] = 1u;
+							m_locked[v1] = 1u;
+							continue;
+						}
+
+						const auto& p0 = GetPosition(v0);
+						const auto& p1 = GetPosition(v1);
+						const auto  n  = XMVector3Normalize(GetFaceNormal(
+							GetPosition(triangle[0]),
+							GetPosition(triangle[1]),
+							GetPosition(triangle[2])));
+						const auto  m  = XMVector3Normalize(
+							XMVector3Cross(XMLoad(p1) - XMLoad(p0), n));
+						const auto  d  = -XMVectorGetX(XMVector3Dot(m, XMLoad(p0)));
+						const auto plane = XMVectorSetW(m, d);
+
+						m_quadrics[v0].AddPlane(plane, g_border_weight);
+						m_quadrics[v1].AddPlane(plane, g_border_weight);
+					}
+				}
+			}
+
+			/**
+			 Performs one pass of non-overlapping edge collapses.
+
+			 @param[in]		target
+							The target number of triangles.
+			 @param[in]		max_error_sq
+							The maximum relative squared geometric error.
+			 @return		@c true if at least one edge was collapsed.
+							@c false otherwise.
+			 */
+			[[nodiscard]]
+			bool Pass(size_t target, F64 max_error_sq) {
+				const auto nb_vertices = m_local_to_global.size();
+
+				// Build the vertex-triangle adjacency.
+				std::vector< U32 > offsets(nb_vertices + 1u, 0u);
+				for (size_t t = 0; t < m_triangles.size(); ++t) {
+					if (m_alive[t]) {
+						for (const auto v : m_triangles[t]) {
+							++offsets[v + 1u];
+						}
+					}
+				}
+				for (size_t v = 0; v < nb_vertices; ++v) {
+					offsets[v + 1u] += offsets[v];
+				}
+				std::vector< U32 > adjacency(offsets.back());
+				{
+					auto cursor = offsets;
+					for (size_t t = 0; t < m_triangles.size(); ++t) {
+						if (m_alive[t]) {
+							for (const auto v : m_triangles[t]) {
+								adjacency[cursor[v]++] = static_cast< U32 >(t);
+							}
+						}
+					}
+				}
+
+				// Collect the candidate edge collapses.
+				std::vector< EdgeCollapse > collapses;
+				for (size_t t = 0; t < m_triangles.size(); ++t) {
+					if (!m_alive[t]) {
+						continue;
+					}
+					const auto& triangle = m_triangles[t];
+					for (size_t j = 0u; j < 3u; ++j) {
+						const auto v0 = triangle[j];
+						const auto v1 = triangle[(j + 1u) % 3u];
+						AddCollapse(collapses, v0, v1, max_error_sq);
+						AddCollapse(collapses, v1, v0, max_error_sq);
+					}
+				}
+
+				std::sort(collapses.begin(), collapses.end(),
+					[](const EdgeCollapse& lhs, const EdgeCollapse& rhs) noexcept {
+						return lhs.m_cost < rhs.m_cost;
+					});
+
+				// Apply the non-overlapping edge collapses.
+				std::vector< U8 > touched(nb_vertices, 0u);
+				size_t nb_collapses = 0u;
+
+				for (const auto& collapse : collapses) {
+					if (m_nb_alive <= target) {
+						break;
+					}
+					if (touched[collapse.m_from] || touched[collapse.m_to]) {
+						continue;
+					}
+
+					const auto first = adjacency.data() + offsets[collapse.m_from];
+					const auto last  = adjacency.data() + offsets[collapse.m_from + 1u];
+					if (Flips(first, last, collapse.m_from, collapse.m_to)) {
+						continue;
+					}
+
+					for (auto it = first; it != last; ++it) {
+						if (!m_alive[*it]) {
+							continue;
+						}
+
+						auto& triangle = m_triangles[*it];
+						for (const auto v : triangle) {
+							touched[v] = 1u;
+						}
+
+						if (std::find(triangle.begin(), triangle.end(),
+							          collapse.m_to) != triangle.end()) {
+							m_alive[*it] = 0u;
+							--m_nb_alive;
+						}
+						else {
+							std::replace(triangle.begin(), triangle.end(),
+								         collapse.m_from, collapse.m_to);
+						}
+					}
+
+					m_quadrics[collapse.m_to] += m_quadrics[collapse.m_from];
+					m_max_error_sq = std::max(m_max_error_sq, collapse.m_error);
+					++nb_collapses;
+				}
+
+				return 0u != nb_collapses;
+			}
+
+			/**
+			 Adds the edge collapse of the given vertex onto the given vertex
+			 if it is valid.
+
+			 @param[in,out]	collapses
+							A reference to the vector of edge collapses.
+			 @param[in]		from
+							The (local) index of the vertex to remove.
+			 @param[in]		to
+							The (local) index of the vertex to keep.
+			 @param[in]		max_error_sq
+							The maximum relative squared geometric error.
+			 */
+			void AddCollapse(std::vector< EdgeCollapse >& collapses,
+				             U32 from, U32 to, F64 max_error_sq) const {
+
+				if (m_locked[from]) {
+					return;
+				}
+
+				const auto& v_from = m_vertices[m_local_to_global[from]];
+				const auto& v_to   = m_vertices[m_local_to_global[to]];
+
+				const auto error = m_inv_radius_sq
+					* (m_quadrics[from].Evaluate(v_to.m_p)
+					 + m_quadrics[to].Evaluate(v_to.m_p));
+				if (max_error_sq < error) {
+					return;
+				}
+
+				auto cost = error;
+				if constexpr (VertexT::HasNormal()) {
+					const auto cos_theta = XMVectorGetX(XMVector3Dot(
+						XMVector3Normalize(XMLoad(v_from.m_n)),
+						XMVector3Normalize(XMLoad(v_to.m_n))));
+					cost += m_desc.GetNormalWeight() * (1.0 - cos_theta);
+				}
+				if constexpr (VertexT::HasTexture()) {
+					const auto delta = XMLoad(v_from.m_tex) - XMLoad(v_to.m_tex);
+					cost += m_desc.GetTextureWeight()
+						  * XMVectorGetX(XMVector2LengthSq(delta));
+				}
+
+				collapses.push_back({ cost, error, from, to });
+			}
+
+			/**
+			 Checks whether collapsing the given vertex onto the given vertex
+			 flips one of the given triangles.
+
+			 @param[in]		first
+							A pointer to the first triangle index.
+			 @param[in]		last
+							A pointer past the last triangle index.
+			 @param[in]		from
+							The (local) index of the vertex to remove.
+			 @param[in]		to
+							The (local) index of the vertex to keep.
+			 @return		@c true if one of the given triangles flips.
+							@c false otherwise.
+			 */
+			[[nodiscard]]
+			bool Flips(const U32* first, const U32* last,
+				       U32 from, U32 to) const noexcept {
+
+				for (auto it = first; it != last; ++it) {
+					if (!m_alive[*it]) {
+						continue;
+					}
+
+					const auto& triangle = m_triangles[*it];
+					if (std::find(triangle.begin(), triangle.end(), to)
+						!= triangle.end()) {
+						continue;
+					}
+
+					auto collapsed = triangle;
+					std::replace(collapsed.begin(), collapsed.end(), from, to);
+
+					const auto n0 = GetFaceNormal(GetPosition(triangle[0]),
+						                          GetPosition(triangle[1]),
+						                          GetPosition(triangle[2]));
+					const auto n1 = GetFaceNormal(GetPosition(collapsed[0]),
+						                          GetPosition(collapsed[1]),
+						                          GetPosition(collapsed[2]));
+					if (XMVectorGetX(XMVector3Dot(n0, n1)) <= 0.0f) {
+						return true;
+					}
+				}
+
+				return false;
+			}
+
+			/**
+			 Returns the position of the given vertex.
+
+			 @param[in]		v
+							The (local) index of the vertex.
+			 @return		A reference to the position of the given vertex.
+			 */
+			[[nodiscard]]
+			const Point3& GetPosition(U32 v) const noexcept {
+				return m_vertices[m_local_to_global[v]].m_p;
+			}
+
+			/**
+			 Returns the (normalized) plane of the given triangle.
+
+			 @param[in]		triangle
+							A reference to the triangle.
+			 @return		The plane of the given triangle.
+			 */
+			[[nodiscard]]
+			const XMVECTOR XM_CALLCONV GetPlane(const U32x3& triangle) const noexcept {
+				const auto& p0 = GetPosition(triangle[0]);
+				const auto  n  = GetFaceNormal(p0,
+					                           GetPosition(triangle[1]),
+					                           GetPosition(triangle[2]));
+				if (XMVector3Equal(n, XMVectorZero())) {
+					return XMVectorZero();
+				}
+
+				const auto m = XMVector3Normalize(n);
+				const auto d = -XMVectorGetX(XMVector3Dot(m, XMLoad(p0)));
+				return XMVectorSetW(m, d);
+			}
+
+			//-----------------------------------------------------------------
+			// Member Variables
+			//-----------------------------------------------------------------
+
+			/**
+			 A reference to the vertex buffer of this level-of-detail
+			 generator.
+			 */
+			const std::vector< VertexT >& m_vertices;
+
+			/**
+			 A reference to the index buffer of this level-of-detail
+			 generator.
+			 */
+			std::vector< IndexT >& m_indices;
+
+			/**
+			 A reference to the level-of-detail descriptor of this
+			 level-of-detail generator.
+			 */
+			const LODDescriptor& m_desc;
+
+			/**
+			 A vector mapping the local to the global vertex indices of this
+			 level-of-detail generator.
+			 */
+			std::vector< IndexT > m_local_to_global;
+
+			/**
+			 A vector containing the (local) triangles of this level-of-detail
+			 generator.
+			 */
+			std::vector< U32x3 > m_triangles;
+
+			/**
+			 A vector containing the alive flags of the triangles of this
+			 level-of-detail generator.
+			 */
+			std::vector< U8 > m_alive;
+
+			/**
+			 A vector containing the error quadrics of the vertices of this
+			 level-of-detail generator.
+			 */
+			std::vector< ErrorQuadric > m_quadrics;
+
+			/**
+			 A vector containing the locked flags of the vertices of this
+			 level-of-detail generator.
+			 */
+			std::vector< U8 > m_locked;
+
+			/**
+			 The number of alive triangles of this level-of-detail generator.
+			 */
+			size_t m_nb_alive;
+
+			/**
+			 The inverse squared bounding sphere radius of the model part of
+			 this level-of-detail generator.
+			 */
+			F64 m_inv_radius_sq;
+
+			/**
+			 The maximum relative squared geometric error of all applied edge
+			 collapses of this level-of-detail generator.
+			 */
+			F64 m_max_error_sq;
+		};
+	}
+
+	template< typename VertexT, typename IndexT >
+	void GenerateLODs(ModelOutput< VertexT, IndexT >& model_output,
+		              const LODDescriptor& desc) {
+
+		static_assert(VertexT::HasPosition());
+
+		if (!desc.GeneratesLODs()) {
+			return;
+		}
+
+		for (auto& model_part : model_output.m_model_parts) {
+			details::LODGenerator< VertexT, IndexT > generator(
+				model_output.m_vertex_buffer, model_output.m_index_buffer, desc);
+			generator.Generate(model_part);
+		}
+	}
+}
\ No newline at end of file
@@ -8,6 +8,7 @@
 #include "math_utils.hpp"
 #include "spectrum\spectrum.hpp"
 #include "resource\texture\texture.hpp"
+#include "scene\frozen_world.hpp"
 
 #pragma endregion
 
@@ -143,6 +144,7 @@ namespace mage::rendering {
 						A pointer to the base color texture.
 		 */
 		void SetBaseColorTexture(TexturePtr base_color_texture) noexcept {
+			Assert(!IsWorldFrozen());
 			m_base_color_texture = std::move(base_color_texture);
 		}
 		
@@ -167,6 +169,7 @@ namespace mage::rendering {
 						The roughness.
 		 */
 		void SetRoughness(F32 roughness) noexcept {
+			Assert(!IsWorldFrozen());
 			m_roughness = Saturate(roughness);
 		}
 
@@ -187,6 +190,7 @@ namespace mage::rendering {
 						The metalness.
 		 */
 		void SetMetalness(F32 metalness) noexcept {
+			Assert(!IsWorldFrozen());
 			m_metalness = Saturate(metalness);
 		}
 
@@ -231,6 +235,7 @@ namespace mage::rendering {
 						A pointer to the material texture.
 		 */
 		void SetMaterialTexture(TexturePtr material_texture) noexcept {
+			Assert(!IsWorldFrozen());
 			m_material_texture = std::move(material_texture);
 		}
 
@@ -268,6 +273,7 @@ namespace mage::rendering {
 						The normal texture.
 		 */
 		void SetNormalTexture(TexturePtr normal_texture) {
+			Assert(!IsWorldFrozen());
 			m_normal_texture = std::move(normal_texture);
 		}
 		
@@ -303,6 +309,7 @@ namespace mage::rendering {
 		 Makes this material opaque.
 		 */
 		void SetOpaque() noexcept {
+			Assert(!IsWorldFrozen());
 			SetTransparent(false);
 		}
 
@@ -314,6 +321,7 @@ namespace mage::rendering {
 						@c false otherwise.
 		 */
 		void SetTransparent(bool transparent = true) noexcept {
+			Assert(!IsWorldFrozen());
 			m_transparent = transparent;
 		}
 
@@ -339,6 +347,7 @@ namespace mage::rendering {
 						The radiance in watts per square meter per steradians.
 		 */
 		void SetRadiance(F32 radiance) noexcept {
+			Assert(!IsWorldFrozen());
 			m_radiance = std::abs(radiance);
 		}
 
@@ -385,6 +394,7 @@ namespace mage::rendering {
 						The name.
 		 */
 		void SetName(std::string name) noexcept {
+			Assert(!IsWorldFrozen());
 			m_name = std::move(name);
 		}
 
@@ -0,0 +1,47 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "resource\model\model_output.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 Generates the meshlets of all model parts of the given model output.
+
+	 The triangles of each model part are greedily grouped into meshlets of
+	 at most @c Meshlet::s_max_nb_vertices vertices and
+	 @c Meshlet::s_max_nb_triangles triangles, preferring triangles adjacent
+	 to the current meshlet. The triangles of each model part are reordered
+	 in place such that every meshlet occupies a contiguous index range.
+
+	 @pre			The vertices of the given model output have a position.
+	 @pre			The faces of the given model output are defined in
+					clockwise order.
+	 @tparam		VertexT
+					The vertex type.
+	 @tparam		IndexT
+					The index type.
+	 @param[in,out]	model_output
+					A reference to the model output.
+	 */
+	template< typename VertexT, typename IndexT >
+	void GenerateMeshlets(ModelOutput< VertexT, IndexT >& model_output);
+}
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "resource\model\meshlet_generator.tpp"
+
+#pragma endregion
\ No newline at end of file
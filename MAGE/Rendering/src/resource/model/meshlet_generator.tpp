@@ -0,0 +1,247 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <unordered_map>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	namespace details {
+
+		/**
+		 Generates the meshlets of the given model part.
+
+		 @tparam		VertexT
+						The vertex type.
+		 @tparam		IndexT
+						The index type.
+		 @param[in]		vertices
+						A reference to the vertex buffer.
+		 @param[in,out]	indices
+						A reference to the index buffer.
+		 @param[in,out]	model_part
+						A reference to the model part.
+		 */
+		template< typename VertexT, typename IndexT >
+		void GenerateMeshlets(const std::vector< VertexT >& vertices,
+							  std::vector< IndexT >& indices,
+							  ModelPart& model_part) {
+
+			model_part.m_meshlets.clear();
+
+			const size_t start        = model_part.m_start_index;
+			const size_t nb_triangles = model_part.m_nb_indices / 3u;
+			if (0u == nb_triangles) {
+				return;
+			}
+
+			// Map the vertices of the model part to local vertices.
+			std::unordered_map< IndexT, U32 > global_to_local;
+			std::vector< IndexT > local_to_global;
+			std::vector< U32 > triangles(3u * nb_triangles);
+			for (size_t i = 0; i < triangles.size(); ++i) {
+				const auto global = indices[start + i];
+				const auto [it, inserted] = global_to_local.try_emplace(
+					global, static_cast< U32 >(local_to_global.size()));
+				if (inserted) {
+					local_to_global.push_back(global);
+				}
+				triangles[i] = it->second;
+			}
+
+			const auto nb_vertices = local_to_global.size();
+
+			// Build the vertex-triangle adjacency.
+			std::vector< U32 > offsets(nb_vertices + 1u, 0u);
+			for (const auto v : triangles) {
+				++offsets[v + 1u];
+			}
+			for (size_t v = 0; v < nb_vertices; ++v) {
+				offsets[v + 1u] += offsets[v];
+			}
+			std::vector< U32 > adjacency(triangles.size());
+			{
+				auto cursor = offsets;
+				for (size_t i = 0; i < triangles.size(); ++i) {
+					adjacency[cursor[triangles[i]]++] = static_cast< U32 >(i / 3u);
+				}
+			}
+
+			constexpr auto no_triangle = std::numeric_limits< U32 >::max();
+
+			std::vector< U8 >  emitted(nb_triangles, 0u);
+			std::vector< U32 > vertex_stamps(nb_vertices, 0u);
+			std::vector< U32 > order;
+			std::vector< U32 > candidates;
+			order.reserve(nb_triangles);
+
+			U32    stamp = 0u;
+			size_t seed  = 0u;
+
+			while (order.size() < nb_triangles) {
+				++stamp;
+
+				const auto meshlet_start   = order.size();
+				U32 nb_meshlet_vertices    = 0u;
+				candidates.clear();
+
+				const auto nb_new_vertices = [&](U32 t) noexcept {
+					U32 count = 0u;
+					for (size_t j = 0u; j < 3u; ++j) {
+						if (stamp != vertex_stamps[triangles[3u * t + j]]) {
+							++count;
+						}
+					}
+					return count;
+				};
+
+				while (order.size() - meshlet_start < Meshlet::s_max_nb_triangles) {
+					candidates.erase(std::remove_if(candidates.begin(), candidates.end(),
+						[&emitted](U32 t) noexcept {
+							return 0u != emitted[t];
+						}), candidates.end());
+
+					// Select the adjacent triangle adding the fewest vertices.
+					auto best       = no_triangle;
+					U32  best_count = 4u;
+					for (const auto t : candidates) {
+						const auto count = nb_new_vertices(t);
+						if (count < best_count) {
+							best       = t;
+							best_count = count;
+							if (0u == count) {
+								break;
+							}
+						}
+					}
+
+					// Otherwise, continue with the next triangle in index order.
+					if (no_triangle == best) {
+						while (seed < nb_triangles && emitted[seed]) {
+							++seed;
+						}
+						if (nb_triangles == seed) {
+							break;
+						}
+						best       = static_cast< U32 >(seed);
+						best_count = nb_new_vertices(best);
+					}
+
+					if (Meshlet::s_max_nb_vertices < nb_meshlet_vertices + best_count) {
+						break;
+					}
+
+					emitted[best] = 1u;
+					order.push_back(best);
+
+					for (size_t j = 0u; j < 3u; ++j) {
+						const auto v = triangles[3u * best + j];
+						if (stamp == vertex_stamps[v]) {
+							continue;
+						}
+
+						vertex_stamps[v] = stamp;
+						++nb_meshlet_vertices;
+
+						for (auto k = offsets[v]; k < offsets[v + 1u]; ++k) {
+							if (!emitted[adjacency[k]]) {
+								candidates.push_back(adjacency[k]);
+							}
+						}
+					}
+				}
+
+				// Set up the bounding volumes of the meshlet.
+				Meshlet meshlet;
+				meshlet.m_start_index = static_cast< U32 >(start + 3u * meshlet_start);
+				meshlet.m_nb_indices  = static_cast< U32 >(3u * (order.size() - meshlet_start));
+
+				AABB aabb;
+				for (auto k = meshlet_start; k < order.size(); ++k) {
+					for (size_t j = 0u; j < 3u; ++j) {
+						const auto& vertex = vertices[local_to_global[triangles[3u * order[k] + j]]];
+						aabb = AABB::Union(aabb, vertex);
+					}
+				}
+				meshlet.m_sphere = BoundingSphere(aabb.Centroid());
+				for (auto k = meshlet_start; k < order.size(); ++k) {
+					for (size_t j = 0u; j < 3u; ++j) {
+						const auto& vertex = vertices[local_to_global[triangles[3u * order[k] + j]]];
+						meshlet.m_sphere = BoundingSphere::Union(meshlet.m_sphere, vertex);
+					}
+				}
+
+				// Set up the normal cone of the meshlet. Faces defined in
+				// clockwise order have outward normals (p1 - p0) x (p2 - p0)
+				// in a left-handed coordinate system.
+				std::vector< F32x3 > normals;
+				normals.reserve(order.size() - meshlet_start);
+				auto axis = XMVectorZero();
+				for (auto k = meshlet_start; k < order.size(); ++k) {
+					const auto t  = order[k];
+					const auto p0 = XMLoad(vertices[local_to_global[triangles[3u * t]]].m_p);
+					const auto p1 = XMLoad(vertices[local_to_global[triangles[3u * t + 1u]]].m_p);
+					const auto p2 = XMLoad(vertices[local_to_global[triangles[3u * t + 2u]]].m_p);
+					const auto n  = XMVector3Cross(p1 - p0, p2 - p0);
+					if (XMVector3Equal(n, XMVectorZero())) {
+						continue;
+					}
+
+					const auto unit_n = XMVector3Normalize(n);
+					normals.push_back(XMStore< F32x3 >(unit_n));
+					axis += unit_n;
+				}
+
+				if (!normals.empty()
+					&& !XMVector3NearEqual(axis, XMVectorZero(), g_XMEpsilon)) {
+
+					axis = XMVector3Normalize(axis);
+
+					auto min_dot = 1.0f;
+					for (const auto& n : normals) {
+						min_dot = std::min(min_dot,
+							XMVectorGetX(XMVector3Dot(XMLoad(n), axis)));
+					}
+
+					meshlet.m_cone_axis   = XMStore< F32x3 >(axis);
+					meshlet.m_cone_cutoff = (0.0f < min_dot)
+						? std::sqrt(1.0f - min_dot * min_dot) : 1.0f;
+				}
+
+				model_part.m_meshlets.push_back(std::move(meshlet));
+			}
+
+			// Reorder the triangles of the model part.
+			const std::vector< IndexT > part_indices(
+				indices.begin() + start,
+				indices.begin() + start + 3u * nb_triangles);
+			for (size_t k = 0; k < order.size(); ++k) {
+				for (size_t j = 0u; j < 3u; ++j) {
+					indices[start + 3u * k + j] = part_indices[3u * order[k] + j];
+				}
+			}
+		}
+	}
+
+	template< typename VertexT, typename IndexT >
+	void GenerateMeshlets(ModelOutput< VertexT, IndexT >& model_output) {
+		static_assert(VertexT::HasPosition());
+
+		for (auto& model_part : model_output.m_model_parts) {
+			details::GenerateMeshlets(model_output.m_vertex_buffer,
+									  model_output.m_index_buffer,
+									  model_part);
+		}
+	}
+}
\ No newline at end of file
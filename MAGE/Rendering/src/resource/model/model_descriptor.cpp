@@ -44,4 +44,18 @@ namespace mage::rendering {
 		
 		return nullptr;
 	}
+
+	[[nodiscard]]
+	size_t ModelDescriptor::GetSizeInBytes() const noexcept {
+		size_t size = (m_mesh) ? m_mesh->GetSizeInBytes() : 0u;
+		size += m_materials.capacity() * sizeof(Material);
+		
+		for (const auto& model_part : m_model_parts) {
+			size += sizeof(ModelPart)
+				  + model_part.m_lods.capacity()     * sizeof(ModelPartLOD)
+				  + model_part.m_meshlets.capacity() * sizeof(Meshlet);
+		}
+
+		return size;
+	}
 }
\ No newline at end of file
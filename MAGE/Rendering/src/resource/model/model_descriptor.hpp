@@ -7,6 +7,8 @@
 
 #include "resource\mesh\static_mesh.hpp"
 #include "loaders\model_loader.hpp"
+#include "resource\model\lod_generator.hpp"
+#include "resource\model\meshlet_generator.hpp"
 
 #pragma endregion
 
@@ -166,6 +168,16 @@ namespace mage::rendering {
 		template< typename ActionT >
 		void ForEachModelPart(ActionT&& action) const;
 
+		/**
+		 Returns the size (in bytes) of this model descriptor (i.e. the size 
+		 of its mesh, materials and model parts). The textures of the 
+		 materials are separate resources and are not included.
+
+		 @return		The size (in bytes) of this model descriptor.
+		 */
+		[[nodiscard]]
+		size_t GetSizeInBytes() const noexcept;
+
 	private:
 
 		//---------------------------------------------------------------------
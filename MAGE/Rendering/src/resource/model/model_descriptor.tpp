@@ -26,6 +26,13 @@ namespace mage::rendering {
 			loader::ExportModelToFile(mdl_path, buffer);
 		}
 
+		// The meshlets and levels of detail are generated after the export, 
+		// since the MDL file format does not store them.
+		if (desc.GeneratesMeshlets()) {
+			GenerateMeshlets(buffer);
+		}
+		GenerateLODs(buffer, desc.GetLODDescriptor());
+
 		m_mesh = MakeShared< StaticMesh< VertexT, IndexT > >(
 			               device, 
 			               std::move(buffer.m_vertex_buffer), 
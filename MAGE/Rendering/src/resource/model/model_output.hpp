@@ -8,6 +8,7 @@
 #include "transform\local_transform.hpp"
 #include "geometry\bounding_volume.hpp"
 #include "resource\model\material.hpp"
+#include "resource\mesh\meshlet.hpp"
 #include "collection\vector.hpp"
 
 #pragma endregion
@@ -17,6 +18,37 @@
 //-----------------------------------------------------------------------------
 namespace mage::rendering {
 
+	/**
+	 A struct of model part levels of detail.
+	 */
+	struct ModelPartLOD final {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The start index of this model part level of detail in the mesh of the 
+		 corresponding model.
+		 */
+		U32 m_start_index = 0u;
+
+		/**
+		 The number of indices of this model part level of detail in the mesh 
+		 of the corresponding model.
+		 */
+		U32 m_nb_indices = 0u;
+
+		/**
+		 The maximum geometric error of this model part level of detail 
+		 relative to the radius of the bounding sphere of the corresponding 
+		 model part.
+		 */
+		F32 m_error = 0.0f;
+	};
+
 	/**
 	 A struct of model parts.
 	 */
@@ -56,6 +88,8 @@ namespace mage::rendering {
 			m_transform(),
 			m_start_index(0), 
 			m_nb_indices(0),
+			m_lods(),
+			m_meshlets(),
 			m_child(s_default_child),
 			m_parent(s_default_parent),
 			m_material(s_default_material) {}
@@ -182,6 +216,18 @@ namespace mage::rendering {
 		 */
 		U32 m_nb_indices;
 
+		/**
+		 A vector containing the simplified levels of detail of this model 
+		 part (ordered from fine to coarse).
+		 */
+		std::vector< ModelPartLOD > m_lods;
+
+		/**
+		 A vector containing the meshlets of this model part (covering the 
+		 original level of detail).
+		 */
+		AlignedVector< Meshlet > m_meshlets;
+
 		//---------------------------------------------------------------------
 		// Member Variables: Scene Graph
 		//---------------------------------------------------------------------
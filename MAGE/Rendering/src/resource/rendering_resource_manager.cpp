@@ -12,19 +12,52 @@
 //-----------------------------------------------------------------------------
 namespace mage::rendering {
 
+	namespace {
+
+		/**
+		 The default budget (in bytes) of the resident model descriptors.
+		 */
+		constexpr size_t g_model_descriptor_budget = size_t(256u) << 20u;
+
+		/**
+		 The default budget (in bytes) of the resident sprite fonts.
+		 */
+		constexpr size_t g_sprite_font_budget = size_t(16u) << 20u;
+
+		/**
+		 The default budget (in bytes) of the resident textures.
+		 */
+		constexpr size_t g_texture_budget = size_t(512u) << 20u;
+	}
+
 	ResourceManager::ResourceManager(ID3D11Device& device) 
 		: m_device(device), 
-		m_model_descriptor_pool(), 
+		m_model_descriptor_pool(g_model_descriptor_budget), 
 		m_vs_pool(), 
 		m_hs_pool(),
 		m_ds_pool(),
 		m_gs_pool(),
 		m_ps_pool(),
 		m_cs_pool(),
-		m_sprite_font_pool(),
-		m_texture_pool() {}
+		m_sprite_font_pool(g_sprite_font_budget),
+		m_texture_pool(g_texture_budget) {}
 
 	ResourceManager::ResourceManager(ResourceManager&& manager) noexcept = default;
 
 	ResourceManager::~ResourceManager() = default;
+
+	[[nodiscard]]
+	const ResidencyStatistics ResourceManager::GetStatistics() const noexcept {
+		auto statistics  = GetStatistics< ModelDescriptor >();
+		statistics      += GetStatistics< SpriteFont >();
+		statistics      += GetStatistics< Texture >();
+		return statistics;
+	}
+
+	void ResourceManager::Trim() {
+		// Model descriptors reference textures.
+		GetPool< ModelDescriptor >().Trim();
+		GetPool< SpriteFont >().Trim();
+		GetPool< Texture >().Trim();
+	}
 }
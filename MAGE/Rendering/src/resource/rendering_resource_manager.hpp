@@ -113,6 +113,16 @@ namespace mage::rendering {
 		template< typename ResourceT >
 		using value_type = typename pool_type< ResourceT >::value_type;
 
+		/**
+		 The future type of resource pools containing (non-shader) resources 
+		 of the given type.
+
+		 @tparam		ResourceT
+						The resource type.
+		 */
+		template< typename ResourceT >
+		using future_type = typename pool_type< ResourceT >::future_type;
+
 		#pragma endregion
 
 		//---------------------------------------------------------------------
@@ -406,6 +416,134 @@ namespace mage::rendering {
 									 const D3D11_TEXTURE2D_DESC& desc, 
 									 const D3D11_SUBRESOURCE_DATA& initial_data);
 
+		/**
+		 Creates a model descriptor (if not existing) asynchronously.
+
+		 Concurrent requests for the same model descriptor share the same 
+		 pending model descriptor.
+
+		 @tparam		ResourceT
+						The resource type.
+		 @tparam		VertexT
+						The vertex type.
+		 @tparam		IndexT
+						The index type.
+		 @param[in]		fname
+						The filename (the globally unique identifier).
+		 @param[in]		desc
+						A reference to the mesh descriptor.
+		 @param[in]		export_as_MDL
+						@c true if the model descriptor needs to be exported as 
+						MDL file. @c false otherwise.
+		 @return		A shared future of a pointer to the model descriptor. 
+						The shared future rethrows the exception thrown while 
+						creating the model descriptor, if any.
+		 */
+		template< typename ResourceT, typename VertexT, typename IndexT >
+		typename std::enable_if_t< std::is_same_v< ModelDescriptor, ResourceT >,
+			future_type< ModelDescriptor > > 
+			GetOrCreateAsync(const std::wstring& fname,
+							 const MeshDescriptor< VertexT, IndexT >& 
+							 desc = MeshDescriptor< VertexT, IndexT >(), 
+							 bool export_as_MDL = false);
+
+		/**
+		 Creates a sprite font (if not existing) asynchronously.
+
+		 Concurrent requests for the same sprite font share the same pending 
+		 sprite font.
+
+		 @tparam		ResourceT
+						The resource type.
+		 @param[in]		fname
+						The filename (the globally unique identifier).
+		 @param[in]		desc
+						A reference to the sprite font descriptor.
+		 @return		A shared future of a pointer to the sprite font. The 
+						shared future rethrows the exception thrown while 
+						creating the sprite font, if any.
+		 */
+		template< typename ResourceT >
+		typename std::enable_if_t< std::is_same_v< SpriteFont, ResourceT >,
+			future_type< SpriteFont > > 
+			GetOrCreateAsync(const std::wstring& fname,
+							 const SpriteFontDescriptor& desc 
+							     = SpriteFontDescriptor());
+
+		/**
+		 Creates a texture (if not existing) asynchronously.
+
+		 Concurrent requests for the same texture share the same pending 
+		 texture.
+
+		 @tparam		ResourceT
+						The resource type.
+		 @param[in]		fname
+						The filename (the globally unique identifier).
+		 @return		A shared future of a pointer to the texture. The shared 
+						future rethrows the exception thrown while creating 
+						the texture, if any.
+		 */
+		template< typename ResourceT >
+		typename std::enable_if_t< std::is_same_v< Texture, ResourceT >,
+			future_type< Texture > > GetOrCreateAsync(const std::wstring& fname);
+
+		/**
+		 Returns the budget (in bytes) of the resident resources of the given 
+		 (non-shader) type of this resource manager.
+
+		 @tparam		ResourceT
+						The resource type.
+		 @return		The budget (in bytes) of the resident resources of the 
+						given type of this resource manager.
+		 */
+		template< typename ResourceT >
+		[[nodiscard]]
+		size_t GetBudget() const noexcept;
+
+		/**
+		 Sets the budget (in bytes) of the resident resources of the given 
+		 (non-shader) type of this resource manager. While the budget is 
+		 exceeded, cached (i.e. unreferenced) resources are evicted in 
+		 least-recently-used order.
+
+		 @tparam		ResourceT
+						The resource type.
+		 @param[in]		budget
+						The budget (in bytes) of the resident resources.
+		 */
+		template< typename ResourceT >
+		void SetBudget(size_t budget);
+
+		/**
+		 Returns the residency statistics of the resources of the given 
+		 (non-shader) type of this resource manager.
+
+		 @tparam		ResourceT
+						The resource type.
+		 @return		The residency statistics of the resources of the given 
+						type of this resource manager.
+		 */
+		template< typename ResourceT >
+		[[nodiscard]]
+		const ResidencyStatistics GetStatistics() const noexcept;
+
+		/**
+		 Returns the residency statistics of all (non-shader) resources of 
+		 this resource manager.
+
+		 @return		The residency statistics of all (non-shader) resources 
+						of this resource manager.
+		 */
+		[[nodiscard]]
+		const ResidencyStatistics GetStatistics() const noexcept;
+
+		/**
+		 Evicts cached (i.e. unreferenced) resources of this resource manager 
+		 whose resident resources exceed their budgets.
+		 */
+		void Trim();
+
 	private:
 
 		//---------------------------------------------------------------------
@@ -233,4 +233,76 @@ namespace mage::rendering {
 	}
 
 	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// ResourceManager: Residency
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	template< typename ResourceT >
+	[[nodiscard]]
+	inline size_t ResourceManager::GetBudget() const noexcept {
+		return GetPool< ResourceT >().GetBudget();
+	}
+
+	template< typename ResourceT >
+	inline void ResourceManager::SetBudget(size_t budget) {
+		GetPool< ResourceT >().SetBudget(budget);
+	}
+
+	template< typename ResourceT >
+	[[nodiscard]]
+	inline const ResidencyStatistics 
+		ResourceManager::GetStatistics() const noexcept {
+
+		return GetPool< ResourceT >().GetStatistics();
+	}
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// ResourceManager: GetOrCreateAsync
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	// The device and this resource manager are passed by reference to the 
+	// creation tasks (i.e. the device must be free threaded).
+
+	template< typename ResourceT, typename VertexT, typename IndexT >
+	inline typename std::enable_if_t< std::is_same_v< ModelDescriptor, ResourceT >,
+		ResourceManager::future_type< ModelDescriptor > >
+		ResourceManager::GetOrCreateAsync(const std::wstring& fname,
+										  const MeshDescriptor< VertexT, IndexT >& desc,
+										  bool export_as_MDL) {
+
+		return GetPool< ResourceT >().GetOrCreateAsync(fname, 
+													   std::ref(m_device), 
+													   std::ref(*this), 
+													   key_type< ResourceT >(fname), 
+													   desc, export_as_MDL);
+	}
+
+	template< typename ResourceT >
+	inline typename std::enable_if_t< std::is_same_v< SpriteFont, ResourceT >,
+		ResourceManager::future_type< SpriteFont > >
+		ResourceManager::GetOrCreateAsync(const std::wstring& fname,
+										  const SpriteFontDescriptor& desc) {
+
+		return GetPool< ResourceT >().GetOrCreateAsync(fname, 
+													   std::ref(m_device), 
+													   key_type< ResourceT >(fname), 
+													   desc);
+	}
+
+	template< typename ResourceT >
+	inline typename std::enable_if_t< std::is_same_v< Texture, ResourceT >,
+		ResourceManager::future_type< Texture > >
+		ResourceManager::GetOrCreateAsync(const std::wstring& fname) {
+
+		return GetPool< ResourceT >().GetOrCreateAsync(fname, 
+													   std::ref(m_device), 
+													   key_type< ResourceT >(fname));
+	}
+
+	#pragma endregion
 }
\ No newline at end of file
@@ -155,6 +155,8 @@
 
 // Voxelization
 #include "voxelization\voxelization_CS.hpp"
+#include "voxelization\voxelization_bricks_CS.hpp"
+#include "voxelization\voxelization_mip_CS.hpp"
 #include "voxelization\voxelization_VS.hpp"
 #include "voxelization\voxelization_GS.hpp"
 // Voxelization: Opaque
@@ -447,6 +449,13 @@ namespace mage::rendering {
 		}
 	}
 
+	ComputeShaderPtr CreateDeferredCS(ResourceManager& resource_manager,
+									  const ShaderPermutation& permutation) {
+
+		return CreateDeferredCS(resource_manager, permutation.GetBRDF(),
+								permutation.UseVCT());
+	}
+
 	PixelShaderPtr CreateDeferredMSAAEmissivePS(ResourceManager& resource_manager) {
 		return CreatePS(resource_manager,
 						MAGE_SHADER_ARGS(g_deferred_msaa_emissive_PS));
@@ -520,6 +529,13 @@ namespace mage::rendering {
 		}
 	}
 
+	PixelShaderPtr CreateDeferredMSAAPS(ResourceManager& resource_manager,
+										const ShaderPermutation& permutation) {
+
+		return CreateDeferredMSAAPS(resource_manager, permutation.GetBRDF(),
+									permutation.UseVCT());
+	}
+
 	#pragma endregion
 
 	//-------------------------------------------------------------------------
@@ -634,6 +650,13 @@ namespace mage::rendering {
 									   MAGE_SHADER_ARGS(g_forward_emissive_PS));
 	}
 
+	PixelShaderPtr CreateForwardEmissivePS(ResourceManager& resource_manager,
+										   const ShaderPermutation& permutation) {
+
+		return CreateForwardEmissivePS(resource_manager,
+									   permutation.UseTransparency());
+	}
+
 	namespace {
 
 		PixelShaderPtr CreateForwardBlinnPhongPS(ResourceManager& resource_manager, 
@@ -861,6 +884,15 @@ namespace mage::rendering {
 		}
 	}
 
+	PixelShaderPtr CreateForwardPS(ResourceManager& resource_manager,
+								   const ShaderPermutation& permutation) {
+
+		return CreateForwardPS(resource_manager, permutation.GetBRDF(),
+							   permutation.UseTransparency(),
+							   permutation.UseVCT(),
+							   permutation.UseTSNM());
+	}
+
 	PixelShaderPtr CreateForwardSolidPS(ResourceManager& resource_manager) {
 		return CreatePS(resource_manager, 
 						MAGE_SHADER_ARGS(g_forward_solid_PS));
@@ -882,6 +914,12 @@ namespace mage::rendering {
 							   MAGE_SHADER_ARGS(g_gbuffer_PS));
 	}
 
+	PixelShaderPtr CreateGBufferPS(ResourceManager& resource_manager,
+								   const ShaderPermutation& permutation) {
+
+		return CreateGBufferPS(resource_manager, permutation.UseTSNM());
+	}
+
 	#pragma endregion
 
 	//-------------------------------------------------------------------------
@@ -918,6 +956,13 @@ namespace mage::rendering {
 		}
 	}
 
+	ComputeShaderPtr CreateLowDynamicRangeCS(ResourceManager& resource_manager,
+											 const ShaderPermutation& permutation) {
+
+		return CreateLowDynamicRangeCS(resource_manager,
+									   permutation.GetToneMapping());
+	}
+
 	#pragma endregion
 
 	//-------------------------------------------------------------------------
@@ -1031,11 +1076,27 @@ namespace mage::rendering {
 							   MAGE_SHADER_ARGS(g_voxelization_lambertian_PS));
 	}
 
+	PixelShaderPtr CreateVoxelizationPS(ResourceManager& resource_manager,
+										const ShaderPermutation& permutation) {
+
+		return CreateVoxelizationPS(resource_manager, permutation.UseTSNM());
+	}
+
 	ComputeShaderPtr CreateVoxelizationCS(ResourceManager& resource_manager) {
 		return CreateCS(resource_manager, 
 						MAGE_SHADER_ARGS(g_voxelization_CS));
 	}
 
+	ComputeShaderPtr CreateVoxelizationBricksCS(ResourceManager& resource_manager) {
+		return CreateCS(resource_manager, 
+						MAGE_SHADER_ARGS(g_voxelization_bricks_CS));
+	}
+
+	ComputeShaderPtr CreateVoxelizationMipCS(ResourceManager& resource_manager) {
+		return CreateCS(resource_manager, 
+						MAGE_SHADER_ARGS(g_voxelization_mip_CS));
+	}
+
 	VertexShaderPtr CreateVoxelGridVS(ResourceManager& resource_manager) {
 		return CreateVS(resource_manager, 
 						MAGE_SHADER_ARGS(g_voxel_grid_VS), 
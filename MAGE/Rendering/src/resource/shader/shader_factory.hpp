@@ -7,6 +7,7 @@
 
 #include "renderer\configuration.hpp"
 #include "resource\rendering_resource_manager.hpp"
+#include "resource\shader\shader_permutation.hpp"
 
 #pragma endregion
 
@@ -118,6 +119,21 @@ namespace mage::rendering {
 	ComputeShaderPtr CreateDeferredCS(ResourceManager& resource_manager, 
 									  BRDF brdf, bool vct);
 
+	/**
+	 Creates a deferred compute shader matching the BRDF and VCT options of
+	 the given shader permutation.
+
+	 @param[in]		resource_manager
+					A reference to the resource manager.
+	 @param[in]		permutation
+					A reference to the shader permutation.
+	 @return		A pointer to the deferred compute shader.
+	 @throws		Exception
+					Failed to create the compute shader.
+	 */
+	ComputeShaderPtr CreateDeferredCS(ResourceManager& resource_manager,
+									  const ShaderPermutation& permutation);
+
 	/**
 	 Creates a deferred MSAA emissive pixel shader.
 
@@ -147,6 +163,21 @@ namespace mage::rendering {
 	PixelShaderPtr CreateDeferredMSAAPS(ResourceManager& resource_manager, 
 										BRDF brdf, bool vct);
 
+	/**
+	 Creates a deferred MSAA pixel shader matching the BRDF and VCT options
+	 of the given shader permutation.
+
+	 @param[in]		resource_manager
+					A reference to the resource manager.
+	 @param[in]		permutation
+					A reference to the shader permutation.
+	 @return		A pointer to the deferred MSAA pixel shader.
+	 @throws		Exception
+					Failed to create the pixel shader.
+	 */
+	PixelShaderPtr CreateDeferredMSAAPS(ResourceManager& resource_manager,
+										const ShaderPermutation& permutation);
+
 	#pragma endregion
 
 	//-------------------------------------------------------------------------
@@ -230,6 +261,21 @@ namespace mage::rendering {
 	PixelShaderPtr CreateForwardEmissivePS(ResourceManager& resource_manager, 
 										   bool transparency);
 
+	/**
+	 Creates a forward emissive pixel shader matching the transparency
+	 option of the given shader permutation.
+
+	 @param[in]		resource_manager
+					A reference to the resource manager.
+	 @param[in]		permutation
+					A reference to the shader permutation.
+	 @return		A pointer to the forward emissive pixel shader.
+	 @throws		Exception
+					Failed to create the pixel shader.
+	 */
+	PixelShaderPtr CreateForwardEmissivePS(ResourceManager& resource_manager,
+										   const ShaderPermutation& permutation);
+
 	/**
 	 Creates a forward pixel shader matching the given BRDF.
 
@@ -257,6 +303,21 @@ namespace mage::rendering {
 								   bool vct, 
 								   bool tsnm);
 
+	/**
+	 Creates a forward pixel shader matching the BRDF, transparency, VCT and
+	 TSNM options of the given shader permutation.
+
+	 @param[in]		resource_manager
+					A reference to the resource manager.
+	 @param[in]		permutation
+					A reference to the shader permutation.
+	 @return		A pointer to the forward pixel shader.
+	 @throws		Exception
+					Failed to create the pixel shader.
+	 */
+	PixelShaderPtr CreateForwardPS(ResourceManager& resource_manager,
+								   const ShaderPermutation& permutation);
+
 	/**
 	 Creates a forward solid pixel shader.
 
@@ -290,6 +351,21 @@ namespace mage::rendering {
 	PixelShaderPtr CreateGBufferPS(ResourceManager& resource_manager, 
 								   bool tsnm);
 
+	/**
+	 Creates a GBuffer pixel shader matching the TSNM option of the given
+	 shader permutation.
+
+	 @param[in]		resource_manager
+					A reference to the resource manager.
+	 @param[in]		permutation
+					A reference to the shader permutation.
+	 @return		A pointer to the GBuffer pixel shader.
+	 @throws		Exception
+					Failed to create the pixel shader.
+	 */
+	PixelShaderPtr CreateGBufferPS(ResourceManager& resource_manager,
+								   const ShaderPermutation& permutation);
+
 	#pragma endregion
 
 	//-------------------------------------------------------------------------
@@ -322,6 +398,21 @@ namespace mage::rendering {
 	ComputeShaderPtr CreateLowDynamicRangeCS(ResourceManager& resource_manager, 
 											 ToneMapping tone_mapping);
 
+	/**
+	 Creates a LDR compute shader matching the tone mapping option of the
+	 given shader permutation.
+
+	 @param[in]		resource_manager
+					A reference to the resource manager.
+	 @param[in]		permutation
+					A reference to the shader permutation.
+	 @return		A pointer to the LDR compute shader.
+	 @throws		Exception
+					Failed to create the compute shader.
+	 */
+	ComputeShaderPtr CreateLowDynamicRangeCS(ResourceManager& resource_manager,
+											 const ShaderPermutation& permutation);
+
 	#pragma endregion
 
 	//-------------------------------------------------------------------------
@@ -504,6 +595,21 @@ namespace mage::rendering {
 	PixelShaderPtr CreateVoxelizationPS(ResourceManager& resource_manager, 
 										bool tsnm);
 
+	/**
+	 Creates a voxelization pixel shader matching the TSNM option of the
+	 given shader permutation.
+
+	 @param[in]		resource_manager
+					A reference to the resource manager.
+	 @param[in]		permutation
+					A reference to the shader permutation.
+	 @return		A pointer to the voxelization pixel shader.
+	 @throws		Exception
+					Failed to create the pixel shader.
+	 */
+	PixelShaderPtr CreateVoxelizationPS(ResourceManager& resource_manager,
+										const ShaderPermutation& permutation);
+
 	/**
 	 Creates a voxelization compute shader.
 
@@ -515,6 +621,30 @@ namespace mage::rendering {
 	 */
 	ComputeShaderPtr CreateVoxelizationCS(ResourceManager& resource_manager);
 
+	/**
+	 Creates a voxelization compute shader which only processes the dirty 
+	 bricks.
+
+	 @param[in]		resource_manager
+					A reference to the resource manager.
+	 @return		A pointer to the voxelization compute shader.
+	 @throws		Exception
+					Failed to create the compute shader.
+	 */
+	ComputeShaderPtr CreateVoxelizationBricksCS(ResourceManager& resource_manager);
+
+	/**
+	 Creates a voxelization mip compute shader which only generates the mip 
+	 levels of the dirty bricks.
+
+	 @param[in]		resource_manager
+					A reference to the resource manager.
+	 @return		A pointer to the voxelization mip compute shader.
+	 @throws		Exception
+					Failed to create the compute shader.
+	 */
+	ComputeShaderPtr CreateVoxelizationMipCS(ResourceManager& resource_manager);
+
 	/**
 	 Creates a voxel grid vertex shader.
 
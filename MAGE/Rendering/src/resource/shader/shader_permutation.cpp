@@ -0,0 +1,18 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "resource\shader\shader_permutation.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	U32 ShaderPermutation::s_nb_permutations = 0u;
+
+	U32 ShaderPermutation::s_nb_lookups = 0u;
+}
\ No newline at end of file
@@ -0,0 +1,460 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\configuration.hpp"
+#include "resource\rendering_resource_manager.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <array>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	//-------------------------------------------------------------------------
+	// ShaderPermutation
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A class of shader permutations.
+
+	 A shader permutation encodes the shader options (BRDF, tone mapping,
+	 TSNM, VCT, transparency and MSAA) as a compact bitfield key, which can be
+	 used as an index into a flat array of shaders.
+	 */
+	class ShaderPermutation final {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The mask of the BRDF bits of shader permutation keys.
+		 */
+		static constexpr U16 s_brdf_mask         = 0x007u;
+
+		/**
+		 The mask of the tone mapping bits of shader permutation keys.
+		 */
+		static constexpr U16 s_tone_mapping_mask = 0x038u;
+
+		/**
+		 The mask of the TSNM bit of shader permutation keys.
+		 */
+		static constexpr U16 s_tsnm_mask         = 0x040u;
+
+		/**
+		 The mask of the VCT bit of shader permutation keys.
+		 */
+		static constexpr U16 s_vct_mask          = 0x080u;
+
+		/**
+		 The mask of the transparency bit of shader permutation keys.
+		 */
+		static constexpr U16 s_transparency_mask = 0x100u;
+
+		/**
+		 The mask of the MSAA bit of shader permutation keys.
+		 */
+		static constexpr U16 s_msaa_mask         = 0x200u;
+
+		/**
+		 The number of shader permutation keys.
+		 */
+		static constexpr size_t s_nb_keys        = 0x400u;
+
+		/**
+		 The number of created shader permutations.
+		 */
+		static U32 s_nb_permutations;
+
+		/**
+		 The number of shader permutation lookups.
+		 */
+		static U32 s_nb_lookups;
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a shader permutation.
+
+		 @param[in]		brdf
+						The BRDF function.
+		 @param[in]		tone_mapping
+						The tone mapping function.
+		 @param[in]		tsnm
+						@c true if tangent space normal mapping should be
+						enabled. @c false otherwise.
+		 @param[in]		vct
+						@c true if voxel cone tracing should be enabled.
+						@c false otherwise.
+		 @param[in]		transparency
+						@c true if transparency should be enabled. @c false
+						otherwise.
+		 @param[in]		msaa
+						@c true if MSAA should be enabled. @c false otherwise.
+		 */
+		constexpr explicit ShaderPermutation(
+			BRDF brdf                = BRDF::Lambertian,
+			ToneMapping tone_mapping = ToneMapping::None,
+			bool tsnm                = false,
+			bool vct                 = false,
+			bool transparency        = false,
+			bool msaa                = false) noexcept
+			: m_key(static_cast< U16 >(
+				  static_cast< U16 >(brdf)
+				| static_cast< U16 >(tone_mapping)         << 3u
+				| static_cast< U16 >(tsnm         ? 1u : 0u) << 6u
+				| static_cast< U16 >(vct          ? 1u : 0u) << 7u
+				| static_cast< U16 >(transparency ? 1u : 0u) << 8u
+				| static_cast< U16 >(msaa         ? 1u : 0u) << 9u)) {}
+
+		/**
+		 Constructs a shader permutation from the given shader permutation.
+
+		 @param[in]		permutation
+						A reference to the shader permutation to copy.
+		 */
+		constexpr ShaderPermutation(
+			const ShaderPermutation& permutation) noexcept = default;
+
+		/**
+		 Constructs a shader permutation by moving the given shader
+		 permutation.
+
+		 @param[in]		permutation
+						A reference to the shader permutation to move.
+		 */
+		constexpr ShaderPermutation(
+			ShaderPermutation&& permutation) noexcept = default;
+
+		/**
+		 Destructs this shader permutation.
+		 */
+		~ShaderPermutation() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given shader permutation to this shader permutation.
+
+		 @param[in]		permutation
+						A reference to the shader permutation to copy.
+		 @return		A reference to the copy of the given shader permutation
+						(i.e. this shader permutation).
+		 */
+		constexpr ShaderPermutation& operator=(
+			const ShaderPermutation& permutation) noexcept = default;
+
+		/**
+		 Moves the given shader permutation to this shader permutation.
+
+		 @param[in]		permutation
+						A reference to the shader permutation to move.
+		 @return		A reference to the moved shader permutation (i.e. this
+						shader permutation).
+		 */
+		constexpr ShaderPermutation& operator=(
+			ShaderPermutation&& permutation) noexcept = default;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the key of this shader permutation.
+
+		 @return		The key of this shader permutation.
+		 */
+		[[nodiscard]]
+		constexpr U16 GetKey() const noexcept {
+			return m_key;
+		}
+
+		/**
+		 Returns the BRDF of this shader permutation.
+
+		 @return		The BRDF of this shader permutation.
+		 */
+		[[nodiscard]]
+		constexpr BRDF GetBRDF() const noexcept {
+			return static_cast< BRDF >(m_key & s_brdf_mask);
+		}
+
+		/**
+		 Returns the tone mapping of this shader permutation.
+
+		 @return		The tone mapping of this shader permutation.
+		 */
+		[[nodiscard]]
+		constexpr ToneMapping GetToneMapping() const noexcept {
+			return static_cast< ToneMapping >((m_key & s_tone_mapping_mask) >> 3u);
+		}
+
+		/**
+		 Checks whether this shader permutation uses tangent space normal
+		 mapping.
+
+		 @return		@c true if this shader permutation uses tangent space
+						normal mapping. @c false otherwise.
+		 */
+		[[nodiscard]]
+		constexpr bool UseTSNM() const noexcept {
+			return 0u != (m_key & s_tsnm_mask);
+		}
+
+		/**
+		 Checks whether this shader permutation uses voxel cone tracing.
+
+		 @return		@c true if this shader permutation uses voxel cone
+						tracing. @c false otherwise.
+		 */
+		[[nodiscard]]
+		constexpr bool UseVCT() const noexcept {
+			return 0u != (m_key & s_vct_mask);
+		}
+
+		/**
+		 Checks whether this shader permutation uses transparency.
+
+		 @return		@c true if this shader permutation uses transparency.
+						@c false otherwise.
+		 */
+		[[nodiscard]]
+		constexpr bool UseTransparency() const noexcept {
+			return 0u != (m_key & s_transparency_mask);
+		}
+
+		/**
+		 Checks whether this shader permutation uses MSAA.
+
+		 @return		@c true if this shader permutation uses MSAA.
+						@c false otherwise.
+		 */
+		[[nodiscard]]
+		constexpr bool UseMSAA() const noexcept {
+			return 0u != (m_key & s_msaa_mask);
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The key of this shader permutation.
+		 */
+		U16 m_key;
+	};
+
+	static_assert(ShaderPermutation::s_nb_keys
+				  > ShaderPermutation(BRDF::WardDuer, ToneMapping::Uncharted,
+									  true, true, true, true).GetKey());
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// ShaderPermutationTable
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A class of shader permutation tables.
+
+	 A shader permutation table lazily creates the shader permutations on
+	 first use and stores them in a flat array indexed by the shader
+	 permutation key, restricted to the options the shader depends on.
+	 Subsequent lookups do not format strings or lock resource pools.
+
+	 @tparam		ShaderT
+					The shader type.
+	 */
+	template< typename ShaderT >
+	class ShaderPermutationTable final {
+
+	public:
+
+		static_assert(is_shader_v< ShaderT >);
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 The shader pointer type of shader permutation tables.
+		 */
+		using shader_type = SharedPtr< const ShaderT >;
+
+		/**
+		 The factory type of shader permutation tables.
+		 */
+		using factory_type = shader_type (*)(ResourceManager&,
+											 const ShaderPermutation&);
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a shader permutation table.
+
+		 @param[in]		resource_manager
+						A reference to the resource manager.
+		 @param[in]		factory
+						The factory for creating shader permutations.
+		 @param[in]		mask
+						The mask of the shader permutation key bits the
+						shader depends on.
+		 */
+		explicit ShaderPermutationTable(ResourceManager& resource_manager,
+										factory_type factory,
+										U16 mask) noexcept;
+
+		/**
+		 Constructs a shader permutation table from the given shader
+		 permutation table.
+
+		 @param[in]		table
+						A reference to the shader permutation table to copy.
+		 */
+		ShaderPermutationTable(const ShaderPermutationTable& table) = delete;
+
+		/**
+		 Constructs a shader permutation table by moving the given shader
+		 permutation table.
+
+		 @param[in]		table
+						A reference to the shader permutation table to move.
+		 */
+		ShaderPermutationTable(ShaderPermutationTable&& table) noexcept = default;
+
+		/**
+		 Destructs this shader permutation table.
+		 */
+		~ShaderPermutationTable() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given shader permutation table to this shader permutation
+		 table.
+
+		 @param[in]		table
+						A reference to the shader permutation table to copy.
+		 @return		A reference to the copy of the given shader
+						permutation table (i.e. this shader permutation
+						table).
+		 */
+		ShaderPermutationTable& operator=(
+			const ShaderPermutationTable& table) = delete;
+
+		/**
+		 Moves the given shader permutation table to this shader permutation
+		 table.
+
+		 @param[in]		table
+						A reference to the shader permutation table to move.
+		 @return		A reference to the moved shader permutation table (i.e.
+						this shader permutation table).
+		 */
+		ShaderPermutationTable& operator=(
+			ShaderPermutationTable&& table) noexcept = default;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the shader permutation of this shader permutation table
+		 matching the given shader permutation.
+
+		 @param[in]		permutation
+						A reference to the shader permutation.
+		 @return		A reference to the pointer to the shader permutation.
+		 @throws		Exception
+						Failed to create the shader permutation.
+		 */
+		const shader_type& Get(const ShaderPermutation& permutation) const;
+
+		/**
+		 Returns the number of created shader permutations of this shader
+		 permutation table.
+
+		 @return		The number of created shader permutations of this
+						shader permutation table.
+		 */
+		[[nodiscard]]
+		size_t GetNumberOfPermutations() const noexcept {
+			return m_nb_permutations;
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A reference to the resource manager of this shader permutation
+		 table.
+		 */
+		std::reference_wrapper< ResourceManager > m_resource_manager;
+
+		/**
+		 The factory for creating the shader permutations of this shader
+		 permutation table.
+		 */
+		factory_type m_factory;
+
+		/**
+		 The mask of the shader permutation key bits of this shader
+		 permutation table.
+		 */
+		U16 m_mask;
+
+		/**
+		 The number of created shader permutations of this shader permutation
+		 table.
+		 */
+		mutable size_t m_nb_permutations;
+
+		/**
+		 The shader permutations of this shader permutation table.
+		 */
+		mutable std::array< shader_type, ShaderPermutation::s_nb_keys > m_shaders;
+	};
+
+	#pragma endregion
+}
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "resource\shader\shader_permutation.tpp"
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,37 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	template< typename ShaderT >
+	ShaderPermutationTable< ShaderT >
+		::ShaderPermutationTable(ResourceManager& resource_manager,
+								 factory_type factory,
+								 U16 mask) noexcept
+		: m_resource_manager(resource_manager),
+		m_factory(factory),
+		m_mask(mask),
+		m_nb_permutations(0u),
+		m_shaders() {}
+
+	template< typename ShaderT >
+	const typename ShaderPermutationTable< ShaderT >::shader_type&
+		ShaderPermutationTable< ShaderT >
+		::Get(const ShaderPermutation& permutation) const {
+
+		++ShaderPermutation::s_nb_lookups;
+
+		auto& shader = m_shaders[permutation.GetKey() & m_mask];
+		if (nullptr == shader) {
+			shader = m_factory(m_resource_manager, permutation);
+			if (nullptr != shader) {
+				++m_nb_permutations;
+				++ShaderPermutation::s_nb_permutations;
+			}
+		}
+
+		return shader;
+	}
+}
\ No newline at end of file
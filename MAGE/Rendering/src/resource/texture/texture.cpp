@@ -4,11 +4,21 @@
 #pragma region
 
 #include "resource\texture\texture.hpp"
+#include "resource\texture\texture_format.hpp"
 #include "loaders\texture_loader.hpp"
 #include "exception\exception.hpp"
 
 #pragma endregion
 
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+
+#pragma endregion
+
 //-----------------------------------------------------------------------------
 // Engine Definitions
 //-----------------------------------------------------------------------------
@@ -42,6 +52,38 @@ namespace mage::rendering {
 		return { desc.Width, desc.Height };
 	}
 
+	[[nodiscard]]
+	size_t GetTextureSizeInBytes(ID3D11ShaderResourceView& texture_srv) noexcept {
+		ComPtr< ID3D11Resource > resource;
+		texture_srv.GetResource(&resource);
+
+		ComPtr< ID3D11Texture2D > texture;
+		if (FAILED(resource.As(&texture))) {
+			return 0u;
+		}
+
+		D3D11_TEXTURE2D_DESC desc;
+		texture->GetDesc(&desc);
+
+		const auto bpp = static_cast< size_t >(BitsPerPixel(desc.Format));
+		const auto bc  = IsBlockCompressed(desc.Format);
+
+		size_t size = 0u;
+		for (U32 level = 0u; level < desc.MipLevels; ++level) {
+			auto width  = static_cast< size_t >(std::max(desc.Width  >> level, 1u));
+			auto height = static_cast< size_t >(std::max(desc.Height >> level, 1u));
+			if (bc) {
+				// Block-compressed formats store blocks of 4x4 pixels.
+				width  = (width  + 3u) & ~size_t(3u);
+				height = (height + 3u) & ~size_t(3u);
+			}
+
+			size += (width * height * bpp) / 8u;
+		}
+
+		return size * desc.ArraySize;
+	}
+
 	#pragma endregion
 
 	//-------------------------------------------------------------------------
@@ -43,6 +43,19 @@ namespace mage::rendering {
 	[[nodiscard]]
 	const U32x2 GetTexture2DSize(ID3D11Texture2D& texture) noexcept;
 
+	/**
+	 Returns the size (in bytes) of the given texture (i.e. the size of all 
+	 its mipmap levels and array slices).
+
+	 @param[in]		texture_srv
+					A reference to the (texture) shader resource view.
+	 @return		The size (in bytes) of the given texture. @c 0 if the 
+					resource of the given shader resource view is not a 
+					@c ID3D11Texture2D.
+	 */
+	[[nodiscard]]
+	size_t GetTextureSizeInBytes(ID3D11ShaderResourceView& texture_srv) noexcept;
+
 	#pragma endregion
 
 	//-------------------------------------------------------------------------
@@ -149,6 +162,16 @@ namespace mage::rendering {
 		ID3D11ShaderResourceView* Get() const noexcept {
 			return m_texture_srv.Get();
 		}
+
+		/**
+		 Returns the size (in bytes) of this texture.
+
+		 @return		The size (in bytes) of this texture.
+		 */
+		[[nodiscard]]
+		size_t GetSizeInBytes() const noexcept {
+			return GetTextureSizeInBytes(*m_texture_srv.Get());
+		}
 		
 		/**
 		 Binds this texture.
@@ -168,6 +168,23 @@ namespace mage {
 		}
 	}
 
+	/**
+	 Checks whether the given DXGI format is a block-compressed format (i.e. 
+	 a format storing blocks of 4x4 pixels).
+
+	 @param[in]		format
+					The DXGI format.
+	 @return		@c true if the given DXGI format is a block-compressed 
+					format. @c false otherwise.
+	 */
+	[[nodiscard]]
+	constexpr bool IsBlockCompressed(DXGI_FORMAT format) noexcept {
+		return (DXGI_FORMAT_BC1_TYPELESS  <= format 
+			 && DXGI_FORMAT_BC5_SNORM     >= format)
+			|| (DXGI_FORMAT_BC6H_TYPELESS <= format 
+			 && DXGI_FORMAT_BC7_UNORM_SRGB >= format);
+	}
+
 	/**
 	 Converts the given DXGI format to an sRGB DXGI format.
 
@@ -24,6 +24,10 @@ namespace mage::rendering {
 
 	F32 VoxelizationSettings::s_voxel_size = 0.08f;
 
+	bool VoxelizationSettings::s_clipmap = false;
+
+	SharedPtr< const SparseVoxelGrid > VoxelizationSettings::s_baked_voxel_grid;
+
 	#pragma endregion
 
 	//-------------------------------------------------------------------------
@@ -10,10 +10,12 @@
 #include "renderer\configuration.hpp"
 #include "renderer\buffer\constant_buffer.hpp"
 #include "renderer\buffer\camera_buffer.hpp"
+#include "renderer\voxelization\sparse_voxel_grid.hpp"
 #include "resource\texture\texture.hpp"
 #include "math_utils.hpp"
 #include "geometry\geometry.hpp"
 #include "spectrum\color.hpp"
+#include "scene\frozen_world.hpp"
 
 #pragma endregion
 
@@ -236,15 +238,71 @@ namespace mage::rendering {
 			s_voxel_size = std::abs(voxel_size);
 		}
 
+		[[nodiscard]]
+		static constexpr bool UsesClipmap() noexcept {
+			return s_clipmap;
+		}
+
+		static constexpr void SetClipmap(bool clipmap = true) noexcept {
+			s_clipmap = clipmap;
+		}
+
 		[[nodiscard]]
 		static U32 GetMaxVoxelTextureMipLevel() noexcept {
 			return static_cast< U32 >(std::log2(s_voxel_grid_resolution));
 		}
 
+		[[nodiscard]]
+		static const SharedPtr< const SparseVoxelGrid >& 
+			GetBakedVoxelGrid() noexcept {
+
+			return s_baked_voxel_grid;
+		}
+
+		/**
+		 Sets the baked voxel grid. The voxel grid is uploaded instead of 
+		 voxelizing the world every frame, as long as the voxel grid 
+		 settings match the baked voxel grid. Therefore, the voxel grid 
+		 settings are set to the settings of the given baked voxel grid and 
+		 the clipmap is disabled.
+
+		 @param[in]		grid
+						A pointer to the baked voxel grid (or @c nullptr to 
+						voxelize the world every frame).
+		 */
+		static void SetBakedVoxelGrid(
+			SharedPtr< const SparseVoxelGrid > grid) noexcept {
+
+			if (grid) {
+				s_voxel_grid_center     = Point3(grid->GetCenter());
+				s_voxel_grid_resolution = grid->GetResolution();
+				s_voxel_size            = grid->GetVoxelSize();
+				s_clipmap               = false;
+			}
+
+			s_baked_voxel_grid = std::move(grid);
+		}
+
+		/**
+		 Checks whether the baked voxel grid matches the voxel grid settings.
+
+		 @return		@c true if a baked voxel grid is set and matches the 
+						voxel grid settings. @c false otherwise.
+		 */
+		[[nodiscard]]
+		static bool UsesBakedVoxelGrid() noexcept {
+			return s_baked_voxel_grid
+				&& !s_clipmap
+				&& s_voxel_grid_resolution == s_baked_voxel_grid->GetResolution()
+				&& s_voxel_size            == s_baked_voxel_grid->GetVoxelSize()
+				&& s_voxel_grid_center     == Point3(s_baked_voxel_grid->GetCenter());
+		}
+
 		[[nodiscard]]
 		static const XMMATRIX XM_CALLCONV GetWorldToVoxelMatrix() noexcept {
 			const auto r = s_voxel_grid_resolution * 0.5f * s_voxel_size;
-			return XMMatrixOrthographicOffCenterLH(-r, r, -r, r, -r, r);
+			return XMMatrixTranslationFromVector(-XMLoad(s_voxel_grid_center))
+				 * XMMatrixOrthographicOffCenterLH(-r, r, -r, r, -r, r);
 		}
 
 		//---------------------------------------------------------------------
@@ -320,18 +378,22 @@ namespace mage::rendering {
 		}
 
 		void EnableVCT() noexcept {
+			Assert(!IsWorldFrozen());
 			SetVCT(true);
 		}
 
 		void DisableVCT() noexcept {
+			Assert(!IsWorldFrozen());
 			SetVCT(false);
 		}
 
 		void ToggleVCT() noexcept {
+			Assert(!IsWorldFrozen());
 			SetVCT(!UsesVCT());
 		}
 
 		void SetVCT(bool vct = true) noexcept {
+			Assert(!IsWorldFrozen());
 			m_vct = vct;
 		}
 
@@ -341,6 +403,7 @@ namespace mage::rendering {
 		}
 
 		void SetConeStepMultiplier(F32 cone_step_multiplier) noexcept {
+			Assert(!IsWorldFrozen());
 			m_cone_step_multiplier = std::max(0.01f, 
 											  std::abs(cone_step_multiplier));
 		}
@@ -351,6 +414,7 @@ namespace mage::rendering {
 		}
 
 		void SetMaxConeDistance(F32 max_cone_distance) noexcept {
+			Assert(!IsWorldFrozen());
 			m_max_cone_distance = std::abs(max_cone_distance);
 		}
 
@@ -375,6 +439,17 @@ namespace mage::rendering {
 		 */
 		static F32 s_voxel_size;
 
+		/**
+		 A flag indicating whether the voxel grid is a clipmap (i.e. follows 
+		 the camera).
+		 */
+		static bool s_clipmap;
+
+		/**
+		 A pointer to the baked voxel grid (baked offline on the CPU).
+		 */
+		static SharedPtr< const SparseVoxelGrid > s_baked_voxel_grid;
+
 		//---------------------------------------------------------------------
 		// Member Variables
 		//---------------------------------------------------------------------
@@ -630,6 +705,7 @@ namespace mage::rendering {
 						The texture of this sky.
 		 */
 		void SetTexture(TexturePtr texture) {
+			Assert(!IsWorldFrozen());
 			m_texture = std::move(texture);
 		}
 
@@ -653,6 +729,7 @@ namespace mage::rendering {
 						The scaling factor.
 		 */
 		void SetScaleZ(F32 scale_z) noexcept {
+			Assert(!IsWorldFrozen());
 			m_scale_z = std::abs(scale_z);
 		}
 
@@ -724,6 +801,8 @@ namespace mage::rendering {
 			: m_render_mode(RenderMode::Forward), 
 			m_brdf(BRDF::Frostbite), 
 			m_tone_mapping(ToneMapping::ACESFilmic), 
+			m_max_lod_error(1.0f), 
+			m_occlusion_culling(false), 
 			m_render_layer_mask(static_cast< U32 >(RenderLayer::None)), 
 			m_fog(), 
 			m_sky() {}
@@ -783,6 +862,7 @@ namespace mage::rendering {
 		}
 
 		void SetRenderMode(RenderMode render_mode) noexcept {
+			Assert(!IsWorldFrozen());
 			m_render_mode = render_mode;
 		}
 
@@ -796,6 +876,7 @@ namespace mage::rendering {
 		}
 
 		void SetBRDF(BRDF brdf) noexcept {
+			Assert(!IsWorldFrozen());
 			m_brdf = brdf;
 		}
 
@@ -809,6 +890,7 @@ namespace mage::rendering {
 		}
 
 		void SetToneMapping(ToneMapping tone_mapping) noexcept {
+			Assert(!IsWorldFrozen());
 			m_tone_mapping = tone_mapping;
 		}
 
@@ -826,6 +908,34 @@ namespace mage::rendering {
 			return m_voxelization_settings;
 		}
 
+		//---------------------------------------------------------------------
+		// Member Methods: Level of Detail
+		//---------------------------------------------------------------------
+
+		[[nodiscard]]
+		F32 GetMaxLODError() const noexcept {
+			return m_max_lod_error;
+		}
+
+		void SetMaxLODError(F32 max_lod_error) noexcept {
+			Assert(!IsWorldFrozen());
+			m_max_lod_error = max_lod_error;
+		}
+
+		//---------------------------------------------------------------------
+		// Member Methods: Occlusion Culling
+		//---------------------------------------------------------------------
+
+		[[nodiscard]]
+		bool UsesOcclusionCulling() const noexcept {
+			return m_occlusion_culling;
+		}
+
+		void SetOcclusionCulling(bool occlusion_culling) noexcept {
+			Assert(!IsWorldFrozen());
+			m_occlusion_culling = occlusion_culling;
+		}
+
 		//---------------------------------------------------------------------
 		// Member Methods: Render Layers
 		//---------------------------------------------------------------------
@@ -842,18 +952,22 @@ namespace mage::rendering {
 		}
 
 		void AddRenderLayer(RenderLayer render_layer) noexcept {
+			Assert(!IsWorldFrozen());
 			m_render_layer_mask |= static_cast< U32 >(render_layer);
 		}
 
 		void RemoveRenderLayer(RenderLayer render_layer) noexcept {
+			Assert(!IsWorldFrozen());
 			m_render_layer_mask &= ~(static_cast< U32 >(render_layer));
 		}
 
 		void ToggleRenderLayer(RenderLayer render_layer) noexcept {
+			Assert(!IsWorldFrozen());
 			m_render_layer_mask ^= static_cast< U32 >(render_layer);
 		}
 
 		void ResetRenderLayers() noexcept {
+			Assert(!IsWorldFrozen());
 			m_render_layer_mask = static_cast< U32 >(RenderLayer::None);
 		}
 
@@ -932,6 +1046,27 @@ namespace mage::rendering {
 		 */
 		VoxelizationSettings m_voxelization_settings;
 
+		//---------------------------------------------------------------------
+		// Member Variables: Level of Detail
+		//---------------------------------------------------------------------
+
+		/**
+		 The maximum projected geometric error (in pixels) of the levels of 
+		 detail of the models rendered with this camera settings.
+		 */
+		F32 m_max_lod_error;
+
+		//---------------------------------------------------------------------
+		// Member Variables: Occlusion Culling
+		//---------------------------------------------------------------------
+
+		/**
+		 A flag indicating whether the models rendered with this camera 
+		 settings are culled against a software rasterized depth buffer of 
+		 their occluders.
+		 */
+		bool m_occlusion_culling;
+
 		//---------------------------------------------------------------------
 		// Member Variables: Render Layers
 		//---------------------------------------------------------------------
@@ -1029,6 +1164,7 @@ namespace mage::rendering {
 						The clipping planes.
 		 */
 		void SetClippingPlanes(F32x2 clipping_planes) noexcept {
+			Assert(!IsWorldFrozen());
 			m_clipping_planes = std::move(clipping_planes);
 		}
 		
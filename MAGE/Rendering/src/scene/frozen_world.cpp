@@ -0,0 +1,50 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "scene\frozen_world.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <atomic>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	namespace {
+
+		/**
+		 A flag indicating whether the rendering world is frozen.
+		 */
+		std::atomic< bool > g_frozen = false;
+
+		/**
+		 A flag indicating whether the current thread must not change the
+		 rendering world while it is frozen.
+		 */
+		thread_local bool t_restricted = false;
+	}
+
+	void FreezeWorld(bool frozen) noexcept {
+		g_frozen.store(frozen, std::memory_order_relaxed);
+	}
+
+	void RestrictFrozenWorldAccess() noexcept {
+		t_restricted = true;
+	}
+
+	[[nodiscard]]
+	bool IsWorldFrozen() noexcept {
+		return t_restricted && g_frozen.load(std::memory_order_relaxed);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,49 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "logging\error.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 Freezes or unfreezes the rendering world.
+
+	 The rendering world is frozen while a frame is rendered on the render
+	 thread of the rendering manager (i.e. in pipelined rendering mode).
+	 Rendering components (i.e. lights, materials, camera settings and sprite
+	 texts) are not part of the render snapshot and must not be changed by
+	 the thread handing frames to the render thread while the rendering world
+	 is frozen (see Engine::Defer).
+
+	 @param[in]		frozen
+					@c true if the rendering world must be frozen. @c false
+					otherwise.
+	 */
+	void FreezeWorld(bool frozen) noexcept;
+
+	/**
+	 Disallows the calling thread (i.e. the thread handing frames to the
+	 render thread) to change the rendering world while it is frozen. Other
+	 threads (e.g., the render thread and the threads loading resources or
+	 scenes) are not checked.
+	 */
+	void RestrictFrozenWorldAccess() noexcept;
+
+	/**
+	 Checks whether the rendering world is frozen for the calling thread.
+
+	 @return		@c true if the rendering world is frozen and the calling
+					thread is not allowed to change it. @c false otherwise.
+	 */
+	[[nodiscard]]
+	bool IsWorldFrozen() noexcept;
+}
\ No newline at end of file
@@ -7,6 +7,7 @@
 
 #include "scene\component.hpp"
 #include "spectrum\spectrum.hpp"
+#include "scene\frozen_world.hpp"
 
 #pragma endregion
 
@@ -123,6 +124,7 @@ namespace mage::rendering {
 						The radiance in watts per square meter per steradians.
 		 */
 		void SetRadiance(F32 radiance) noexcept {
+			Assert(!IsWorldFrozen());
 			m_radiance = std::abs(radiance);
 		}
 
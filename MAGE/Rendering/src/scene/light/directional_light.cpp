@@ -16,6 +16,10 @@ namespace mage::rendering {
 	DirectionalLight::DirectionalLight() noexcept
 		: Component(),
 		m_shadows(false), 
+		m_shadow_importance(1.0f), 
+		m_nb_shadow_cascades(1u), 
+		m_shadow_cascade_split_lambda(0.5f), 
+		m_shadow_distance(0.0f), 
 		m_clipping_planes(0.1f, 1.0f), 
 		m_size(1.0f, 1.0f), 
 		m_aabb(), 
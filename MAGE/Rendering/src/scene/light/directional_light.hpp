@@ -8,6 +8,8 @@
 #include "scene\component.hpp"
 #include "spectrum\spectrum.hpp"
 #include "geometry\bounding_volume.hpp"
+#include "renderer\shadow\shadow_cascades.hpp"
+#include "scene\frozen_world.hpp"
 
 #pragma endregion
 
@@ -124,6 +126,7 @@ namespace mage::rendering {
 						The irradiance in watts per square meter.
 		 */
 		void SetIrradiance(F32 irradiance) noexcept {
+			Assert(!IsWorldFrozen());
 			m_irradiance = std::abs(irradiance);
 		}
 
@@ -182,6 +185,7 @@ namespace mage::rendering {
 						The range expressed in light space.
 		 */
 		void SetRange(F32 range) noexcept {
+			Assert(!IsWorldFrozen());
 			m_clipping_planes[1] = range;
 
 			// Update the bounding volumes.
@@ -207,6 +211,7 @@ namespace mage::rendering {
 		 Enables shadows for this directional light.
 		 */
 		void EnableShadows() noexcept {
+			Assert(!IsWorldFrozen());
 			SetShadows(true);
 		}
 
@@ -214,6 +219,7 @@ namespace mage::rendering {
 		 Dissables shadows for this directional light.
 		 */
 		void DissableShadows() noexcept {
+			Assert(!IsWorldFrozen());
 			SetShadows(false);
 		}
 
@@ -221,6 +227,7 @@ namespace mage::rendering {
 		 Toggles shadows for this directional light.
 		 */
 		void ToggleShadows() noexcept {
+			Assert(!IsWorldFrozen());
 			SetShadows(!m_shadows);
 		}
 
@@ -232,9 +239,115 @@ namespace mage::rendering {
 						light. @c false otherwise.
 		 */
 		void SetShadows(bool shadows) noexcept {
+			Assert(!IsWorldFrozen());
 			m_shadows = shadows;
 		}
 
+		/**
+		 Returns the shadow importance of this directional light.
+
+		 The shadow importance scales the priority of the shadow map of this 
+		 directional light when allocating shadow maps in the shadow atlas.
+
+		 @return		The shadow importance of this directional light.
+		 */
+		[[nodiscard]]
+		F32 GetShadowImportance() const noexcept {
+			return m_shadow_importance;
+		}
+
+		/**
+		 Sets the shadow importance of this directional light to the given value.
+
+		 @param[in]		importance
+						The shadow importance.
+		 */
+		void SetShadowImportance(F32 importance) noexcept {
+			Assert(!IsWorldFrozen());
+			m_shadow_importance = std::max(0.0f, importance);
+		}
+
+		/**
+		 Returns the number of shadow cascades of this directional light.
+
+		 A directional light with a single shadow cascade uses the light 
+		 camera of this directional light. A directional light with multiple 
+		 shadow cascades fits each shadow cascade to a slice of the view 
+		 frustum of the camera.
+
+		 @return		The number of shadow cascades of this directional 
+						light.
+		 */
+		[[nodiscard]]
+		U32 GetNumberOfShadowCascades() const noexcept {
+			return m_nb_shadow_cascades;
+		}
+
+		/**
+		 Sets the number of shadow cascades of this directional light to the 
+		 given value.
+
+		 @param[in]		nb_cascades
+						The number of shadow cascades. This value is clamped 
+						to [1, @c MAGE_MAX_NB_SHADOW_CASCADES].
+		 */
+		void SetNumberOfShadowCascades(U32 nb_cascades) noexcept {
+			Assert(!IsWorldFrozen());
+			m_nb_shadow_cascades = std::clamp(nb_cascades, 1u, 
+											  MAGE_MAX_NB_SHADOW_CASCADES);
+		}
+
+		/**
+		 Returns the split lambda of the shadow cascades of this directional 
+		 light.
+
+		 @return		The weight of the logarithmic split scheme (versus the 
+						uniform split scheme) of the shadow cascades of this 
+						directional light.
+		 */
+		[[nodiscard]]
+		F32 GetShadowCascadeSplitLambda() const noexcept {
+			return m_shadow_cascade_split_lambda;
+		}
+
+		/**
+		 Sets the split lambda of the shadow cascades of this directional light 
+		 to the given value.
+
+		 @param[in]		lambda
+						The weight of the logarithmic split scheme (versus the 
+						uniform split scheme). This value is clamped to [0,1].
+		 */
+		void SetShadowCascadeSplitLambda(F32 lambda) noexcept {
+			Assert(!IsWorldFrozen());
+			m_shadow_cascade_split_lambda = std::clamp(lambda, 0.0f, 1.0f);
+		}
+
+		/**
+		 Returns the shadow distance of this directional light.
+
+		 @return		The (view depth) distance covered by the shadow 
+						cascades of this directional light (or zero if the 
+						shadow cascades cover the complete view frustum).
+		 */
+		[[nodiscard]]
+		F32 GetShadowDistance() const noexcept {
+			return m_shadow_distance;
+		}
+
+		/**
+		 Sets the shadow distance of this directional light to the given value.
+
+		 @param[in]		distance
+						The (view depth) distance covered by the shadow 
+						cascades (or zero if the shadow cascades cover the 
+						complete view frustum).
+		 */
+		void SetShadowDistance(F32 distance) noexcept {
+			Assert(!IsWorldFrozen());
+			m_shadow_distance = std::max(0.0f, distance);
+		}
+
 		/**
 		 Returns the clipping planes of this directional light expressed in 
 		 light space.
@@ -255,6 +368,7 @@ namespace mage::rendering {
 						The clipping planes.
 		 */
 		void SetClippingPlanes(F32x2 clipping_planes) noexcept {
+			Assert(!IsWorldFrozen());
 			m_clipping_planes = std::move(clipping_planes);
 
 			// Update the bounding volumes.
@@ -281,6 +395,7 @@ namespace mage::rendering {
 						The size.
 		 */
 		void SetSize(F32x2 size) noexcept {
+			Assert(!IsWorldFrozen());
 			m_size = std::move(size);
 		}
 
@@ -326,6 +441,29 @@ namespace mage::rendering {
 		 */
 		bool m_shadows;
 
+		/**
+		 The shadow importance of this directional light.
+		 */
+		F32 m_shadow_importance;
+
+		/**
+		 The number of shadow cascades of this directional light.
+		 */
+		U32 m_nb_shadow_cascades;
+
+		/**
+		 The weight of the logarithmic split scheme (versus the uniform split 
+		 scheme) of the shadow cascades of this directional light.
+		 */
+		F32 m_shadow_cascade_split_lambda;
+
+		/**
+		 The (view depth) distance covered by the shadow cascades of this 
+		 directional light (or zero if the shadow cascades cover the complete 
+		 view frustum).
+		 */
+		F32 m_shadow_distance;
+
 		/**
 		 The clipping planes of this directional light expressed in light 
 		 space.
@@ -16,6 +16,7 @@ namespace mage::rendering {
 	OmniLight::OmniLight() noexcept
 		: Component(),
 		m_shadows(false), 
+		m_shadow_importance(1.0f), 
 		m_clipping_planes(0.1f, 1.0f),
 		m_aabb(), 
 		m_sphere(), 
@@ -8,6 +8,7 @@
 #include "scene\component.hpp"
 #include "spectrum\spectrum.hpp"
 #include "geometry\bounding_volume.hpp"
+#include "scene\frozen_world.hpp"
 
 #pragma endregion
 
@@ -123,6 +124,7 @@ namespace mage::rendering {
 						The power in watts.
 		 */
 		void SetPower(F32 power) noexcept {
+			Assert(!IsWorldFrozen());
 			SetIntensity(power * 4.0f * XM_PI);
 		}
 
@@ -156,6 +158,7 @@ namespace mage::rendering {
 						The radiant intensity in watts per steradians.
 		 */
 		void SetIntensity(F32 intensity) noexcept {
+			Assert(!IsWorldFrozen());
 			m_intensity = std::abs(intensity);
 		}
 
@@ -221,6 +224,7 @@ namespace mage::rendering {
 						The range expressed in light space.
 		 */
 		void SetRange(F32 range) noexcept {
+			Assert(!IsWorldFrozen());
 			m_clipping_planes[1] = range;
 
 			// Update the bounding volumes.
@@ -246,6 +250,7 @@ namespace mage::rendering {
 		 Enables shadows for this omni light.
 		 */
 		void EnableShadows() noexcept {
+			Assert(!IsWorldFrozen());
 			SetShadows(true);
 		}
 
@@ -253,6 +258,7 @@ namespace mage::rendering {
 		 Dissables shadows for this omni light.
 		 */
 		void DissableShadows() noexcept {
+			Assert(!IsWorldFrozen());
 			SetShadows(false);
 		}
 
@@ -260,6 +266,7 @@ namespace mage::rendering {
 		 Toggles shadows for this omni light.
 		 */
 		void ToggleShadows() noexcept {
+			Assert(!IsWorldFrozen());
 			SetShadows(!m_shadows);
 		}
 		
@@ -271,9 +278,34 @@ namespace mage::rendering {
 						@c false otherwise.
 		 */
 		void SetShadows(bool shadows) noexcept {
+			Assert(!IsWorldFrozen());
 			m_shadows = shadows;
 		}
 
+		/**
+		 Returns the shadow importance of this omni light.
+
+		 The shadow importance scales the priority of the shadow map of this 
+		 omni light when allocating shadow maps in the shadow atlas.
+
+		 @return		The shadow importance of this omni light.
+		 */
+		[[nodiscard]]
+		F32 GetShadowImportance() const noexcept {
+			return m_shadow_importance;
+		}
+
+		/**
+		 Sets the shadow importance of this omni light to the given value.
+
+		 @param[in]		importance
+						The shadow importance.
+		 */
+		void SetShadowImportance(F32 importance) noexcept {
+			Assert(!IsWorldFrozen());
+			m_shadow_importance = std::max(0.0f, importance);
+		}
+
 		/**
 		 Returns the clipping planes of this omni light expressed in light 
 		 space.
@@ -294,6 +326,7 @@ namespace mage::rendering {
 						The clipping planes.
 		 */
 		void SetClippingPlanes(F32x2 clipping_planes) noexcept {
+			Assert(!IsWorldFrozen());
 			m_clipping_planes = std::move(clipping_planes);
 
 			// Update the bounding volumes.
@@ -349,6 +382,11 @@ namespace mage::rendering {
 		 */
 		bool m_shadows;
 
+		/**
+		 The shadow importance of this omni light.
+		 */
+		F32 m_shadow_importance;
+
 		/**
 		 The clipping planes of this omni light expressed in light space.
 		 */
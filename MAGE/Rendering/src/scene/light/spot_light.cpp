@@ -16,6 +16,7 @@ namespace mage::rendering {
 	SpotLight::SpotLight() noexcept
 		: Component(),
 		m_shadows(false), 
+		m_shadow_importance(1.0f), 
 		m_aabb(), 
 		m_sphere(), 
 		m_base_color(RGB(1.0f)), 
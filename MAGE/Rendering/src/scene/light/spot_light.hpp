@@ -8,6 +8,7 @@
 #include "scene\component.hpp"
 #include "spectrum\spectrum.hpp"
 #include "geometry\bounding_volume.hpp"
+#include "scene\frozen_world.hpp"
 
 #pragma endregion
 
@@ -122,6 +123,7 @@ namespace mage::rendering {
 						The power in watts.
 		 */
 		void SetPower(F32 power) noexcept {
+			Assert(!IsWorldFrozen());
 			// [Frostbite]
 			SetIntensity(power * XM_PI);
 		}
@@ -156,6 +158,7 @@ namespace mage::rendering {
 						The radiant intensity in watts per steradians.
 		 */
 		void SetIntensity(F32 intensity) noexcept {
+			Assert(!IsWorldFrozen());
 			m_intensity = std::abs(intensity);
 		}
 
@@ -221,6 +224,7 @@ namespace mage::rendering {
 						The range expressed in light space.
 		 */
 		void SetRange(F32 range) noexcept {
+			Assert(!IsWorldFrozen());
 			m_clipping_planes[1] = range;
 
 			// Update the bounding volumes.
@@ -245,6 +249,7 @@ namespace mage::rendering {
 						The cosine of the penumbra angle.
 		 */
 		void SetStartAngularCutoff(F32 cos_penumbra) noexcept {
+			Assert(!IsWorldFrozen());
 			m_cos_penumbra = cos_penumbra;
 		}
 		
@@ -266,6 +271,7 @@ namespace mage::rendering {
 						The cosine of the umbra angle.
 		 */
 		void SetEndAngularCutoff(F32 cos_umbra) noexcept {
+			Assert(!IsWorldFrozen());
 			m_cos_umbra = std::max(0.001f, cos_umbra);
 
 			// Update the bounding volumes.
@@ -282,6 +288,7 @@ namespace mage::rendering {
 						The cosine of the umbra angle.
 		 */
 		void SetAngularCutoff(F32 cos_penumbra, F32 cos_umbra) noexcept {
+			Assert(!IsWorldFrozen());
 			SetStartAngularCutoff(cos_penumbra);
 			SetEndAngularCutoff(cos_umbra);
 		}
@@ -317,6 +324,7 @@ namespace mage::rendering {
 						The penumbra angle (in radians).
 		 */
 		void SetPenumbraAngle(F32 penumbra) noexcept {
+			Assert(!IsWorldFrozen());
 			SetStartAngularCutoff(std::cos(penumbra));
 		}
 
@@ -339,6 +347,7 @@ namespace mage::rendering {
 						The umbra angle (in radians).
 		 */
 		void SetUmbraAngle(F32 umbra) noexcept {
+			Assert(!IsWorldFrozen());
 			SetEndAngularCutoff(std::cos(umbra));
 		}
 		
@@ -353,6 +362,7 @@ namespace mage::rendering {
 						The umbra angle (in radians).
 		 */
 		void SetPenumbraAndUmbraAngles(F32 penumbra, F32 umbra) noexcept {
+			Assert(!IsWorldFrozen());
 			SetPenumbraAngle(penumbra);
 			SetUmbraAngle(umbra);
 		}
@@ -376,6 +386,7 @@ namespace mage::rendering {
 		 Enables shadows for this spotlight.
 		 */
 		void EnableShadows() noexcept {
+			Assert(!IsWorldFrozen());
 			SetShadows(true);
 		}
 
@@ -383,6 +394,7 @@ namespace mage::rendering {
 		 Dissables shadows for this spotlight.
 		 */
 		void DissableShadows() noexcept {
+			Assert(!IsWorldFrozen());
 			SetShadows(false);
 		}
 
@@ -390,6 +402,7 @@ namespace mage::rendering {
 		 Toggles shadows for this spotlight.
 		 */
 		void ToggleShadows() noexcept {
+			Assert(!IsWorldFrozen());
 			SetShadows(!m_shadows);
 		}
 		
@@ -401,8 +414,33 @@ namespace mage::rendering {
 						@c false otherwise.
 		 */
 		void SetShadows(bool shadows) noexcept {
+			Assert(!IsWorldFrozen());
 			m_shadows = shadows;
 		}
+
+		/**
+		 Returns the shadow importance of this spotlight.
+
+		 The shadow importance scales the priority of the shadow map of this 
+		 spotlight when allocating shadow maps in the shadow atlas.
+
+		 @return		The shadow importance of this spotlight.
+		 */
+		[[nodiscard]]
+		F32 GetShadowImportance() const noexcept {
+			return m_shadow_importance;
+		}
+
+		/**
+		 Sets the shadow importance of this spotlight to the given value.
+
+		 @param[in]		importance
+						The shadow importance.
+		 */
+		void SetShadowImportance(F32 importance) noexcept {
+			Assert(!IsWorldFrozen());
+			m_shadow_importance = std::max(0.0f, importance);
+		}
 		
 		/**
 		 Returns the clipping planes of this spotlight expressed in light 
@@ -424,6 +462,7 @@ namespace mage::rendering {
 						The clipping planes.
 		 */
 		void SetClippingPlanes(F32x2 clipping_planes) noexcept {
+			Assert(!IsWorldFrozen());
 			m_clipping_planes = std::move(clipping_planes);
 
 			// Update the bounding volumes.
@@ -484,6 +523,11 @@ namespace mage::rendering {
 		 */
 		bool m_shadows;
 
+		/**
+		 The shadow importance of this spotlight.
+		 */
+		F32 m_shadow_importance;
+
 		/**
 		 The AABB of this spotlight.
 		 */
@@ -21,9 +21,17 @@ namespace mage::rendering {
 		m_mesh(), 
 		m_start_index(0u), 
 		m_nb_indices(0u),
+		m_lods(),
+		m_lod(0u),
+		m_meshlets(),
+		m_visible_ranges(),
 		m_texture_transform(),
 		m_material(),
-		m_light_occlusion(true) {}
+		m_light_occlusion(true),
+		m_geometry_occlusion(false),
+		m_occluded(false),
+		m_pvs_index(s_no_pvs_index),
+		m_occluder_triangles() {}
 
 	Model::Model(Model&& model) noexcept = default;
 
@@ -42,6 +50,73 @@ namespace mage::rendering {
 		m_mesh        = std::move(mesh);
 		m_start_index = start_index;
 		m_nb_indices  = nb_indices;
+		m_lods.clear();
+		m_lod         = 0u;
+		m_meshlets    = MeshletSet();
+		m_visible_ranges.clear();
+		m_occluder_triangles.clear();
+	}
+
+	void Model::SetLODs(std::vector< ModelPartLOD > lods) {
+		m_lods = std::move(lods);
+		m_lod  = 0u;
+		m_occluder_triangles.clear();
+	}
+
+	void Model::SelectLOD(F32 projected_radius, F32 max_error) const noexcept {
+		m_lod = 0u;
+		
+		for (size_t i = 0u; i < m_lods.size(); ++i) {
+			if (max_error < m_lods[i].m_error * projected_radius) {
+				break;
+			}
+			m_lod = i + 1u;
+		}
+	}
+
+	void Model::SetMeshlets(const AlignedVector< Meshlet >& meshlets) {
+		m_meshlets = MeshletSet(meshlets);
+		m_visible_ranges.clear();
+	}
+
+	void XM_CALLCONV Model::CullMeshlets(FXMMATRIX object_to_projection, 
+										 FXMVECTOR eye, 
+										 bool cull_backfaces) const {
+
+		m_meshlets.Cull(object_to_projection, eye, cull_backfaces, 
+						m_visible_ranges);
+	}
+
+	void Model::DrawVisible(ID3D11DeviceContext& device_context) const noexcept {
+		if (0u != m_lod || m_meshlets.empty()) {
+			Draw(device_context);
+			return;
+		}
+
+		for (const auto& range : m_visible_ranges) {
+			m_mesh->Draw(device_context, range[0], range[1]);
+		}
+	}
+
+	const std::vector< Point3 > Model::GetTriangles() const {
+		return m_mesh ? m_mesh->GetTrianglePositions(m_start_index, m_nb_indices)
+			          : std::vector< Point3 >();
+	}
+
+	const std::vector< Point3 >& Model::GetOccluderTriangles() const {
+		if (m_occluder_triangles.empty() && m_mesh) {
+			if (m_lods.empty()) {
+				m_occluder_triangles = m_mesh->GetTrianglePositions(
+					m_start_index, m_nb_indices);
+			}
+			else {
+				const auto& lod = m_lods.back();
+				m_occluder_triangles = m_mesh->GetTrianglePositions(
+					lod.m_start_index, lod.m_nb_indices);
+			}
+		}
+
+		return m_occluder_triangles;
 	}
 
 	void Model::UpdateBuffer(ID3D11DeviceContext& device_context) const {
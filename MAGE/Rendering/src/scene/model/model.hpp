@@ -7,6 +7,7 @@
 
 #include "scene\component.hpp"
 #include "resource\mesh\mesh.hpp"
+#include "resource\model\model_output.hpp"
 #include "resource\model\material.hpp"
 #include "geometry\bounding_volume.hpp"
 #include "transform\texture_transform.hpp"
@@ -15,6 +16,15 @@
 
 #pragma endregion
 
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <limits>
+
+#pragma endregion
+
 //-----------------------------------------------------------------------------
 // Engine Declarations and Definitions
 //-----------------------------------------------------------------------------
@@ -30,6 +40,15 @@ namespace mage::rendering {
 
 	public:
 
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The PVS index of dynamic models.
+		 */
+		static constexpr U32 s_no_pvs_index = std::numeric_limits< U32 >::max();
+
 		//---------------------------------------------------------------------
 		// Constructors and Destructors
 		//---------------------------------------------------------------------
@@ -110,6 +129,86 @@ namespace mage::rendering {
 					 AABB aabb,
 					 BoundingSphere bs);
 
+		/**
+		 Sets the simplified levels of detail of this model to the given 
+		 levels of detail.
+
+		 @param[in]		lods
+						The simplified levels of detail (ordered from fine to 
+						coarse).
+		 */
+		void SetLODs(std::vector< ModelPartLOD > lods);
+
+		/**
+		 Checks whether this model has simplified levels of detail.
+
+		 @return		@c true if this model has simplified levels of detail.
+						@c false otherwise.
+		 */
+		[[nodiscard]]
+		bool HasLODs() const noexcept {
+			return !m_lods.empty();
+		}
+
+		/**
+		 Returns the selected level of detail of this model.
+
+		 @return		The selected level of detail of this model (@c 0 
+						corresponds to the original level of detail).
+		 */
+		[[nodiscard]]
+		size_t GetLOD() const noexcept {
+			return m_lod;
+		}
+
+		/**
+		 Selects the coarsest level of detail of this model whose projected 
+		 geometric error does not exceed the given maximum error.
+
+		 @param[in]		projected_radius
+						The projected radius (in pixels) of the bounding 
+						sphere of this model.
+		 @param[in]		max_error
+						The maximum projected geometric error (in pixels).
+		 */
+		void SelectLOD(F32 projected_radius, F32 max_error) const noexcept;
+
+		/**
+		 Sets the meshlets of this model to the given meshlets.
+
+		 @param[in]		meshlets
+						A reference to a vector containing the meshlets 
+						(covering the original level of detail).
+		 */
+		void SetMeshlets(const AlignedVector< Meshlet >& meshlets);
+
+		/**
+		 Checks whether this model has meshlets.
+
+		 @return		@c true if this model has meshlets. @c false 
+						otherwise.
+		 */
+		[[nodiscard]]
+		bool HasMeshlets() const noexcept {
+			return !m_meshlets.empty();
+		}
+
+		/**
+		 Culls the meshlets of this model and stores the index ranges of the 
+		 visible meshlets for @c DrawVisible.
+
+		 @param[in]		object_to_projection
+						The object-to-projection transformation matrix.
+		 @param[in]		eye
+						The position of the camera expressed in object space.
+		 @param[in]		cull_backfaces
+						A flag indicating whether meshlets whose triangles all 
+						face away from the camera must be culled.
+		 */
+		void XM_CALLCONV CullMeshlets(FXMMATRIX object_to_projection, 
+									  FXMVECTOR eye, 
+									  bool cull_backfaces) const;
+
 		/**
 		 Returns the AABB of this model.
 
@@ -137,7 +236,8 @@ namespace mage::rendering {
 		 */
 		[[nodiscard]]
 		size_t GetStartIndex() const noexcept {
-			return m_start_index;
+			return (0u == m_lod) ? m_start_index 
+				                 : m_lods[m_lod - 1u].m_start_index;
 		}
 
 		/**
@@ -148,7 +248,8 @@ namespace mage::rendering {
 		 */
 		[[nodiscard]]
 		size_t GetNumberOfIndices() const noexcept {
-			return m_nb_indices;
+			return (0u == m_lod) ? m_nb_indices 
+				                 : m_lods[m_lod - 1u].m_nb_indices;
 		}
 
 		/**
@@ -182,9 +283,20 @@ namespace mage::rendering {
 						A reference to the device context.
 		 */
 		void Draw(ID3D11DeviceContext& device_context) const noexcept {
-			m_mesh->Draw(device_context, m_start_index, m_nb_indices);
+			m_mesh->Draw(device_context, GetStartIndex(), GetNumberOfIndices());
 		}
 
+		/**
+		 Draws the visible meshlets of this model (i.e. the meshlets that 
+		 passed the last @c CullMeshlets call). If this model has no meshlets 
+		 or a simplified level of detail is selected, this model is drawn 
+		 completely.
+
+		 @param[in]		device_context
+						A reference to the device context.
+		 */
+		void DrawVisible(ID3D11DeviceContext& device_context) const noexcept;
+
 		//---------------------------------------------------------------------
 		// Member Methods: Appearance
 		//---------------------------------------------------------------------
@@ -276,6 +388,135 @@ namespace mage::rendering {
 			m_light_occlusion = light_occlusion;
 		}
 
+		/**
+		 Checks whether this model occludes other models (i.e. whether this 
+		 model may be rasterized as an occluder for occlusion culling).
+
+		 @return		@c true if this model occludes other models. @c false 
+						otherwise.
+		 */
+		[[nodiscard]]
+		bool OccludesGeometry() const noexcept {
+			return m_geometry_occlusion;
+		}
+
+		/**
+		 Enables the occlusion of other models by this model.
+		 */
+		void EnableGeometryOcclusion() noexcept {
+			SetGeometryOcclusion(true);
+		}
+
+		/**
+		 Dissables the occlusion of other models by this model.
+		 */
+		void DissableGeometryOcclusion() noexcept {
+			SetGeometryOcclusion(false);
+		}
+
+		/**
+		 Toggles the occlusion of other models by this model.
+		 */
+		void ToggleGeometryOcclusion() noexcept {
+			SetGeometryOcclusion(!m_geometry_occlusion);
+		}
+
+		/**
+		 Sets the occlusion of other models by this model to the given value.
+
+		 @param[in]		geometry_occlusion
+						@c true if this model needs to occlude other models. 
+						@c false otherwise.
+		 */
+		void SetGeometryOcclusion(bool geometry_occlusion) noexcept {
+			m_geometry_occlusion = geometry_occlusion;
+		}
+
+		/**
+		 Returns the triangles of the finest level of detail of this model.
+
+		 @return		A vector containing three consecutive object space 
+						vertex positions per triangle of the finest level of 
+						detail of this model (empty if the mesh of this model 
+						has no CPU copy of its vertices and indices).
+		 */
+		[[nodiscard]]
+		const std::vector< Point3 > GetTriangles() const;
+
+		/**
+		 Returns the occluder triangles of this model.
+
+		 The occluder triangles correspond to the coarsest level of detail of 
+		 this model and are extracted from the mesh of this model on first 
+		 use.
+
+		 @return		A reference to a vector containing three consecutive 
+						object space vertex positions per occluder triangle of 
+						this model.
+		 */
+		[[nodiscard]]
+		const std::vector< Point3 >& GetOccluderTriangles() const;
+
+		/**
+		 Checks whether this model is occluded for the current camera.
+
+		 @return		@c true if this model is occluded for the current 
+						camera. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool IsOccluded() const noexcept {
+			return m_occluded;
+		}
+
+		/**
+		 Sets the occlusion state of this model for the current camera to the 
+		 given value.
+
+		 @param[in]		occluded
+						@c true if this model is occluded for the current 
+						camera. @c false otherwise.
+		 */
+		void SetOccluded(bool occluded) const noexcept {
+			m_occluded = occluded;
+		}
+
+		/**
+		 Checks whether this model is static.
+
+		 Only static models are baked into and culled by the potentially 
+		 visible set of their world.
+
+		 @return		@c true if this model is static. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool IsStatic() const noexcept {
+			return s_no_pvs_index != m_pvs_index;
+		}
+
+		/**
+		 Returns the PVS index of this model.
+
+		 @return		The index of this model in the potentially visible set 
+						of its world, or @c s_no_pvs_index if this model is 
+						dynamic.
+		 */
+		[[nodiscard]]
+		U32 GetPVSIndex() const noexcept {
+			return m_pvs_index;
+		}
+
+		/**
+		 Sets the PVS index of this model to the given index.
+
+		 @param[in]		index
+						The index of this model in the potentially visible set 
+						of its world, or @c s_no_pvs_index to make this model 
+						dynamic.
+		 */
+		void SetPVSIndex(U32 index) noexcept {
+			m_pvs_index = index;
+		}
+
 		//---------------------------------------------------------------------
 		// Member Methods: Buffer
 		//---------------------------------------------------------------------
@@ -347,6 +588,27 @@ namespace mage::rendering {
 		 */
 		size_t m_nb_indices;
 
+		/**
+		 A vector containing the simplified levels of detail of this model.
+		 */
+		std::vector< ModelPartLOD > m_lods;
+
+		/**
+		 The selected level of detail of this model.
+		 */
+		mutable size_t m_lod;
+
+		/**
+		 The meshlets of this model.
+		 */
+		MeshletSet m_meshlets;
+
+		/**
+		 A vector containing the index ranges (start index and number of 
+		 indices) of the visible meshlets of this model.
+		 */
+		mutable std::vector< U32x2 > m_visible_ranges;
+
 		//---------------------------------------------------------------------
 		// Member Variables: Appearance
 		//---------------------------------------------------------------------
@@ -369,6 +631,28 @@ namespace mage::rendering {
 		 A flag indicating whether this model occludes light.
 		 */
 		bool m_light_occlusion;
+
+		/**
+		 A flag indicating whether this model occludes other models.
+		 */
+		bool m_geometry_occlusion;
+
+		/**
+		 A flag indicating whether this model is occluded for the current 
+		 camera.
+		 */
+		mutable bool m_occluded;
+
+		/**
+		 The index of this model in the potentially visible set of its world, 
+		 or @c s_no_pvs_index if this model is dynamic.
+		 */
+		U32 m_pvs_index;
+
+		/**
+		 A vector containing the (cached) occluder triangles of this model.
+		 */
+		mutable std::vector< Point3 > m_occluder_triangles;
 	};
 
 	#pragma warning( pop )
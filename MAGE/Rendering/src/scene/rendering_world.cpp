@@ -26,7 +26,10 @@ namespace mage::rendering {
 		m_spot_lights(),
 		m_models(),
 		m_sprite_images(),
-		m_sprite_texts() {}
+		m_sprite_texts(),
+		m_pvs(),
+		m_nb_static_models(0u),
+		m_irradiance_volume() {}
 
 	World::World(World&& world) noexcept = default;
 
@@ -44,5 +47,21 @@ namespace mage::rendering {
 		m_models.clear();
 		m_sprite_images.clear();
 		m_sprite_texts.clear();
+		m_pvs = PotentiallyVisibleSet();
+		m_nb_static_models = 0u;
+		m_irradiance_volume = IrradianceVolume();
+	}
+
+	U32 World::MakeStatic(Node& node) {
+		const auto make_static = [this](Node& n) {
+			n.ForEach< Model >([this](Model& model) {
+				model.SetPVSIndex(m_nb_static_models++);
+			});
+		};
+
+		make_static(node);
+		node.ForEachDescendant(make_static);
+
+		return m_nb_static_models;
 	}
 }
\ No newline at end of file
@@ -17,6 +17,8 @@
 #include "scene\model\model.hpp"
 #include "scene\sprite\sprite_image.hpp"
 #include "scene\sprite\sprite_text.hpp"
+#include "renderer\culling\pvs.hpp"
+#include "renderer\probe\irradiance_volume.hpp"
 
 #pragma endregion
 
@@ -115,6 +117,80 @@ namespace mage::rendering {
 		 Clears this world.
 		 */
 		void Clear() noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods: Visibility
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the potentially visible set of this world.
+
+		 @return		A reference to the potentially visible set of this 
+						world.
+		 */
+		[[nodiscard]]
+		PotentiallyVisibleSet& GetPVS() noexcept {
+			return m_pvs;
+		}
+
+		/**
+		 Returns the potentially visible set of this world.
+
+		 @return		A reference to the potentially visible set of this 
+						world.
+		 */
+		[[nodiscard]]
+		const PotentiallyVisibleSet& GetPVS() const noexcept {
+			return m_pvs;
+		}
+
+		/**
+		 Marks the models of the given node and its descendants as static.
+
+		 The models are numbered in depth-first order of the given hierarchy, 
+		 continuing after the static models marked before. These PVS indices 
+		 do not depend on the slots of the models in this world and are 
+		 stable across runs as long as the hierarchy is loaded the same way.
+
+		 @param[in]		node
+						A reference to the root node.
+		 @return		The number of static models of this world.
+		 */
+		U32 MakeStatic(Node& node);
+
+		/**
+		 Returns the number of static models of this world.
+
+		 @return		The number of static models of this world.
+		 */
+		[[nodiscard]]
+		U32 GetNumberOfStaticModels() const noexcept {
+			return m_nb_static_models;
+		}
+
+		//---------------------------------------------------------------------
+		// Member Methods: Global Illumination
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the (baked) irradiance volume of this world.
+
+		 @return		A reference to the irradiance volume of this world.
+		 */
+		[[nodiscard]]
+		IrradianceVolume& GetIrradianceVolume() noexcept {
+			return m_irradiance_volume;
+		}
+
+		/**
+		 Returns the (baked) irradiance volume of this world.
+
+		 @return		A reference to the irradiance volume of this world.
+		 */
+		[[nodiscard]]
+		const IrradianceVolume& GetIrradianceVolume() const noexcept {
+			return m_irradiance_volume;
+		}
 		
 	private:
 
@@ -185,6 +261,29 @@ namespace mage::rendering {
 		 A vector containing the sprite texts of this world.
 		 */
 		AlignedVector< SpriteText > m_sprite_texts;
+
+		//---------------------------------------------------------------------
+		// Member Variables: Visibility
+		//---------------------------------------------------------------------
+
+		/**
+		 The potentially visible set of the models of this world.
+		 */
+		PotentiallyVisibleSet m_pvs;
+
+		/**
+		 The number of static models of this world.
+		 */
+		U32 m_nb_static_models;
+
+		//---------------------------------------------------------------------
+		// Member Variables: Global Illumination
+		//---------------------------------------------------------------------
+
+		/**
+		 The (baked) irradiance volume of this world.
+		 */
+		IrradianceVolume m_irradiance_volume;
 	};
 }
 
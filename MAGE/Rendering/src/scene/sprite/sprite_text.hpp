@@ -7,6 +7,7 @@
 
 #include "scene\component.hpp"
 #include "resource\font\sprite_font.hpp"
+#include "scene\frozen_world.hpp"
 
 #pragma endregion
 
@@ -158,6 +159,7 @@ namespace mage::rendering {
 						The sprite effects.
 		 */
 		void SetSpriteEffects(SpriteEffect sprite_effects) noexcept {
+			Assert(!IsWorldFrozen());
 			m_sprite_effects = sprite_effects;
 		}
 
@@ -169,6 +171,7 @@ namespace mage::rendering {
 		 Clears the text of this sprite text.
 		 */
 		void ClearText() noexcept {
+			Assert(!IsWorldFrozen());
 			m_strings.clear();
 		}
 
@@ -190,6 +193,7 @@ namespace mage::rendering {
 						The text.
 		 */
 		void SetText(ColorString text) {
+			Assert(!IsWorldFrozen());
 			ClearText();
 			m_strings.push_back(std::move(text));
 		}
@@ -201,6 +205,7 @@ namespace mage::rendering {
 						The text.
 		 */
 		void AppendText(ColorString text) {
+			Assert(!IsWorldFrozen());
 			m_strings.push_back(std::move(text));
 		}
 
@@ -273,6 +278,7 @@ namespace mage::rendering {
 						The text effect.
 		 */
 		void SetTextEffect(TextEffect text_effect) noexcept {
+			Assert(!IsWorldFrozen());
 			m_text_effect = text_effect;
 		}
 
@@ -308,6 +314,7 @@ namespace mage::rendering {
 						A pointer to the font of this sprite text.
 		 */
 		void SetFont(SpriteFontPtr font) noexcept {
+			Assert(!IsWorldFrozen());
 			m_font = std::move(font);
 		}
 
@@ -5,10 +5,21 @@
 
 #include "editor_script.hpp"
 #include "scene\scene.hpp"
+#include "system\profiler.hpp"
+#include "system\system_time.hpp"
 #include "imgui.hpp"
 
 #pragma endregion
 
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+
+#pragma endregion
+
 //-----------------------------------------------------------------------------
 // Engine Definitions
 //-----------------------------------------------------------------------------
@@ -68,6 +79,10 @@ namespace mage::script {
 								 0.01f, 0.01f, 10.0f, "%.2f");
 				VoxelizationSettings::SetVoxelSize(voxel_size);
 
+				auto clipmap = VoxelizationSettings::UsesClipmap();
+				ImGui::Checkbox("Clipmap", &clipmap);
+				VoxelizationSettings::SetClipmap(clipmap);
+
 				ImGui::TreePop();
 			}
 
@@ -280,6 +295,12 @@ namespace mage::script {
 					settings.ToggleRenderLayer(RenderLayer::AABB);
 				}
 
+				if (auto shadow_atlas = settings.ContainsRenderLayer(RenderLayer::ShadowAtlas);
+					ImGui::Checkbox("Shadow Atlas", &shadow_atlas)) {
+
+					settings.ToggleRenderLayer(RenderLayer::ShadowAtlas);
+				}
+
 				ImGui::EndPopup();
 			}
 		}
@@ -474,6 +495,34 @@ namespace mage::script {
 			ImGui::Checkbox("Shadows", &shadows);
 			light.SetShadows(shadows);
 
+			//-----------------------------------------------------------------
+			// Shadow Importance
+			//-----------------------------------------------------------------
+			if (shadows) {
+				auto importance = light.GetShadowImportance();
+				ImGui::InputFloat("Shadow Importance", &importance);
+				light.SetShadowImportance(importance);
+			}
+
+			//-----------------------------------------------------------------
+			// Shadow Cascades
+			//-----------------------------------------------------------------
+			if (shadows) {
+				auto nb_cascades = static_cast< int >(
+					light.GetNumberOfShadowCascades());
+				ImGui::InputInt("Shadow Cascades", &nb_cascades);
+				light.SetNumberOfShadowCascades(
+					static_cast< U32 >(std::max(1, nb_cascades)));
+
+				auto lambda = light.GetShadowCascadeSplitLambda();
+				ImGui::InputFloat("Cascade Split Lambda", &lambda);
+				light.SetShadowCascadeSplitLambda(lambda);
+
+				auto distance = light.GetShadowDistance();
+				ImGui::InputFloat("Shadow Distance", &distance);
+				light.SetShadowDistance(distance);
+			}
+
 			//-----------------------------------------------------------------
 			// Clipping Planes and Size
 			//-----------------------------------------------------------------
@@ -520,6 +569,15 @@ namespace mage::script {
 			ImGui::Checkbox("Shadows", &shadows);
 			light.SetShadows(shadows);
 
+			//-----------------------------------------------------------------
+			// Shadow Importance
+			//-----------------------------------------------------------------
+			if (shadows) {
+				auto importance = light.GetShadowImportance();
+				ImGui::InputFloat("Shadow Importance", &importance);
+				light.SetShadowImportance(importance);
+			}
+
 			//-----------------------------------------------------------------
 			// Clipping Planes
 			//-----------------------------------------------------------------
@@ -575,6 +633,15 @@ namespace mage::script {
 			ImGui::Checkbox("Shadows", &shadows);
 			light.SetShadows(shadows);
 
+			//-----------------------------------------------------------------
+			// Shadow Importance
+			//-----------------------------------------------------------------
+			if (shadows) {
+				auto importance = light.GetShadowImportance();
+				ImGui::InputFloat("Shadow Importance", &importance);
+				light.SetShadowImportance(importance);
+			}
+
 			//-----------------------------------------------------------------
 			// Clipping Planes
 			//-----------------------------------------------------------------
@@ -1242,6 +1309,109 @@ namespace mage::script {
 
 			ImGui::End();
 		}
+
+		void DrawProfiler(FrameStatistics& statistics) {
+			auto& profiler = Profiler::Get();
+
+			ImGui::Begin("Profiler");
+
+			auto enabled = profiler.IsEnabled();
+			ImGui::Checkbox("Enabled", &enabled);
+			profiler.SetEnabled(enabled);
+
+			//-----------------------------------------------------------------
+			// Capture
+			//-----------------------------------------------------------------
+			ImGui::SameLine();
+			if (profiler.IsCapturing()) {
+				if (ImGui::Button("Stop Capture")) {
+					profiler.EndCapture();
+				}
+			}
+			else if (ImGui::Button("Start Capture")) {
+				profiler.BeginCapture();
+			}
+
+			if (0u != profiler.GetNumberOfCapturedEvents()
+				&& !profiler.IsCapturing()) {
+
+				ImGui::SameLine();
+				if (ImGui::Button("Export Trace")) {
+					const auto fname = L"trace-" 
+						             + GetLocalSystemDateAndTimeAsString()
+						             + L".json";
+					profiler.ExportChromeTrace(fname);
+				}
+			}
+
+			ImGui::Text("Events: %zu captured (%llu dropped)", 
+						profiler.GetNumberOfCapturedEvents(), 
+						profiler.GetNumberOfDroppedEvents());
+
+			//-----------------------------------------------------------------
+			// Telemetry
+			//-----------------------------------------------------------------
+			if (statistics.UsesTelemetry()) {
+				if (ImGui::Button("Stop Telemetry")) {
+					statistics.StopTelemetry();
+				}
+			}
+			else {
+				if (ImGui::Button("Start Telemetry (CSV)")) {
+					statistics.StartTelemetry(L"telemetry-" 
+						                      + GetLocalSystemDateAndTimeAsString()
+						                      + L".csv");
+				}
+				ImGui::SameLine();
+				if (ImGui::Button("Start Telemetry (JSON)")) {
+					statistics.StartTelemetry(L"telemetry-" 
+						                      + GetLocalSystemDateAndTimeAsString()
+						                      + L".json");
+				}
+			}
+
+			auto hitch_threshold = statistics.GetHitchThreshold();
+			ImGui::InputFloat("Hitch Threshold (ms)", &hitch_threshold);
+			statistics.SetHitchThreshold(std::max(hitch_threshold, 0.0f));
+
+			const auto frame_times 
+				= statistics.GetRecentPercentiles(FrameMetric::WallClock);
+			ImGui::Text("Frame (ms): %.2f p50 %.2f p95 %.2f p99 %.2f max", 
+						frame_times.m_p50, frame_times.m_p95, 
+						frame_times.m_p99, frame_times.m_max);
+			ImGui::Text("Hitches: %zu recent (%llu total)", 
+						statistics.GetNumberOfRecentHitches(), 
+						static_cast< unsigned long long >(
+							statistics.GetNumberOfHitches()));
+
+			//-----------------------------------------------------------------
+			// Statistics
+			//-----------------------------------------------------------------
+			ImGui::Columns(5, "Profile Zones");
+			ImGui::Separator();
+			ImGui::Text("Zone");     ImGui::NextColumn();
+			ImGui::Text("Calls");    ImGui::NextColumn();
+			ImGui::Text("Min (ms)"); ImGui::NextColumn();
+			ImGui::Text("Avg (ms)"); ImGui::NextColumn();
+			ImGui::Text("P99 (ms)"); ImGui::NextColumn();
+			ImGui::Separator();
+
+			for (const auto& stats : profiler.GetStatistics()) {
+				ImGui::Text("%*s%.*s", 2 * static_cast< int >(stats.m_depth), "",
+							static_cast< int >(stats.m_name.size()), 
+							stats.m_name.data());
+				ImGui::NextColumn();
+				ImGui::Text("%.1f", stats.m_nb_calls); ImGui::NextColumn();
+				ImGui::Text("%.3f", stats.m_min);      ImGui::NextColumn();
+				ImGui::Text("%.3f", stats.m_avg);      ImGui::NextColumn();
+				ImGui::Text("%.3f", stats.m_p99);      ImGui::NextColumn();
+			}
+
+			ImGui::Columns(1);
+			ImGui::Separator();
+
+			ImGui::End();
+		}
 	}
 
 	//-------------------------------------------------------------------------
@@ -1268,12 +1438,21 @@ namespace mage::script {
 	}
 
 	void EditorScript::Update([[maybe_unused]] Engine& engine) {
+		// The inspected components are shared with the renderer.
+		engine.Defer([this](Engine& engine) {
+			Draw(engine);
+		});
+	}
+
+	void EditorScript::Draw(Engine& engine) {
 		const auto scene = engine.GetScene();
 		DrawGraph(*scene, m_selected);
 
 		const auto config = engine.GetRenderingManager().GetDisplayConfiguration();
 		const auto display_resolution = config.GetDisplayResolution();
 		DrawInspector(m_selected, display_resolution);
+
+		DrawProfiler(engine.GetFrameStatistics());
 	}
 
 	#pragma endregion
@@ -43,6 +43,12 @@ namespace mage::script {
 
 	private:
 
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		void Draw(Engine& engine);
+
 		//---------------------------------------------------------------------
 		// Member Variables
 		//---------------------------------------------------------------------
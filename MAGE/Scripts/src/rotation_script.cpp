@@ -58,4 +58,10 @@ namespace mage::script {
 		}
 		}
 	}
+
+	[[nodiscard]]
+	const ScriptDependencies RotationScript::GetDependencies() const noexcept {
+		// Only the transform of the owner is written.
+		return ScriptDependencies(true);
+	}
 }
\ No newline at end of file
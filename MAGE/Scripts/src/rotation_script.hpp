@@ -47,6 +47,9 @@ namespace mage::script {
 		virtual void Load([[maybe_unused]] Engine& engine) override;
 		virtual void Update([[maybe_unused]] Engine& engine) override;
 
+		[[nodiscard]]
+		virtual const ScriptDependencies GetDependencies() const noexcept override;
+
 		[[nodiscard]]
 		RotationAxis GetRotationAxis() const noexcept {
 			return m_axis;
@@ -5,6 +5,8 @@
 
 #include "stats_script.hpp"
 #include "system\system_usage.hpp"
+#include "renderer\culling\occlusion_culler.hpp"
+#include "resource\shader\shader_permutation.hpp"
 #include "exception\exception.hpp"
 
 #pragma endregion
@@ -23,7 +25,12 @@ namespace mage::script {
 		m_fps(0u), 
 		m_spf(0.0f), 
 		m_cpu(0.0f), 
-		m_ram(0u) {}
+		m_ram(0u), 
+		m_resident_resources(0u), 
+		m_cached_resources(0u), 
+		m_frame_times(), 
+		m_nb_hitches(0u), 
+		m_pacing_jitter(0.0f) {}
 
 	StatsScript::StatsScript(const StatsScript& script) noexcept = default;
 
@@ -47,6 +54,13 @@ namespace mage::script {
 	}
 
 	void StatsScript::Update([[maybe_unused]] Engine& engine) {
+		// The sprite text and frame counters are shared with the renderer.
+		engine.Defer([this](Engine& engine) {
+			UpdateText(engine);
+		});
+	}
+
+	void StatsScript::UpdateText(Engine& engine) {
 		static constexpr F64 s_resource_fetch_period = 1.0;
 		
 		++m_accumulated_nb_frames;
@@ -62,6 +76,18 @@ namespace mage::script {
 			m_cpu = static_cast< F32 >(core_clock_delta.count() / wall_clock_delta.count()) * 100.0f;
 			m_ram = static_cast< U32 >(GetVirtualMemoryUsage() >> 20u);
 
+			const auto resources = engine.GetRenderingManager()
+				                         .GetResourceManager().GetStatistics();
+			m_resident_resources = static_cast< U32 >(resources.m_resident_size >> 20u);
+			m_cached_resources   = static_cast< U32 >(resources.m_cached_size   >> 20u);
+
+			const auto& statistics = engine.GetFrameStatistics();
+			m_frame_times = statistics.GetRecentPercentiles(FrameMetric::WallClock);
+			m_nb_hitches  = statistics.GetNumberOfHitches();
+
+			const auto pacing_jitter = engine.GetTimer().GetAveragePacingJitter();
+			m_pacing_jitter = static_cast< F32 >(pacing_jitter.count()) * 1000.0f;
+
 			m_accumulated_nb_frames = 0u;
 			m_prev_wall_clock_time  = wall_clock_time;
 			m_prev_core_clock_time  = core_clock_time;
@@ -74,10 +100,34 @@ namespace mage::script {
 			std::to_wstring(m_fps),
 			std::move(color)));
 		
-		wchar_t buffer[64];
+		using rendering::OcclusionCuller;
+		using rendering::ShaderPermutation;
+		const auto occluded = (0u == OcclusionCuller::s_nb_tests) ? 0.0f
+			: 100.0f * OcclusionCuller::s_nb_culled / OcclusionCuller::s_nb_tests;
+
+		// The number of triangles assumes triangle lists.
+		wchar_t buffer[352];
 		_snwprintf_s(buffer, std::size(buffer), 
-			         L"\nSPF: %.2fms\nCPU: %.1f%%\nRAM: %uMB\nDCs: %u", 
-					 m_spf, m_cpu, m_ram, rendering::Pipeline::s_nb_draws);
+			         L"\nSPF: %.2fms\nP50/P95/P99/Max: %.1f/%.1f/%.1f/%.1fms"
+					 L"\nHitches: %llu\nPacing Jitter: %.2fms"
+					 L"\nCPU: %.1f%%\nRAM: %uMB"
+					 L"\nResources: %uMB (%uMB cached)\nDCs: %u\nTris: %u"
+					 L"\nBindings: %u (%u redundant)"
+					 L"\nOccluders: %u\nOcclusion Tests: %u (%.1f%% culled)"
+					 L"\nShader Permutations: %u (%u lookups)", 
+					 m_spf, m_frame_times.m_p50, m_frame_times.m_p95, 
+					 m_frame_times.m_p99, m_frame_times.m_max, 
+					 static_cast< unsigned long long >(m_nb_hitches), 
+					 m_pacing_jitter, 
+					 m_cpu, m_ram, m_resident_resources, 
+					 m_cached_resources, rendering::Pipeline::s_nb_draws,
+					 rendering::Pipeline::s_nb_vertices / 3u,
+					 rendering::Pipeline::s_nb_bindings,
+					 rendering::Pipeline::s_nb_redundant_bindings,
+					 OcclusionCuller::s_nb_occluders, 
+					 OcclusionCuller::s_nb_tests, occluded,
+					 ShaderPermutation::s_nb_permutations,
+					 ShaderPermutation::s_nb_lookups);
 		m_text->AppendText(std::wstring(buffer));
 	}
 }
\ No newline at end of file
@@ -8,6 +8,7 @@
 #include "scene\script\behavior_script.hpp"
 #include "scene\sprite\sprite_text.hpp"
 #include "system\cpu_monitor.hpp"
+#include "system\frame_statistics.hpp"
 
 #pragma endregion
 
@@ -45,6 +46,12 @@ namespace mage::script {
 
 	private:
 
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		void UpdateText(Engine& engine);
+
 		//---------------------------------------------------------------------
 		// Member Variables
 		//---------------------------------------------------------------------
@@ -58,5 +65,10 @@ namespace mage::script {
 		F32 m_spf;
 		F32 m_cpu;
 		U32 m_ram;
+		U32 m_resident_resources;
+		U32 m_cached_resources;
+		FrameTimePercentiles m_frame_times;
+		U64 m_nb_hitches;
+		F32 m_pacing_jitter;
 	};
 }
\ No newline at end of file
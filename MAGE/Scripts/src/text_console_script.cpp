@@ -66,6 +66,13 @@ namespace mage::script {
 	}
 
 	void TextConsoleScript::Update([[maybe_unused]] Engine& engine) {
+		// The sprite text is shared with the renderer.
+		engine.Defer([this]([[maybe_unused]] Engine& engine) {
+			UpdateText();
+		});
+	}
+
+	void TextConsoleScript::UpdateText() {
 		const std::scoped_lock lock(m_mutex);
 
 		SetCharacter(L'\n', m_current_row, m_current_column);
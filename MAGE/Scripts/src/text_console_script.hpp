@@ -62,6 +62,7 @@ namespace mage::script {
 		// Member Methods
 		//---------------------------------------------------------------------
 
+		void UpdateText();
 		void ProcessString(NotNull< const_wzstring > str);
 		void IncrementRow();
 
@@ -84,6 +84,14 @@ CBUFFER(World, SLOT_CBUFFER_WORLD) {
 
 	// The inverse of the gamma exponent used for gamma correction.
 	float    g_inv_gamma                   : packoffset(c4.y);
+
+	//-------------------------------------------------------------------------
+	// Member Variables: Voxelization (Clipmap)
+	//-------------------------------------------------------------------------
+
+	// The offset of the voxel grid in the (toroidally addressed) voxel 
+	// texture expressed in voxels (zero for a fixed voxel grid).
+	uint3    g_voxel_texture_offset        : packoffset(c5.x);
 };
 
 CBUFFER(PrimaryCamera, SLOT_CBUFFER_PRIMARY_CAMERA) {
@@ -168,6 +176,7 @@ CBUFFER(PrimaryCamera, SLOT_CBUFFER_PRIMARY_CAMERA) {
 //-----------------------------------------------------------------------------
 // world                  <-> voxel UVW                
 // world                  <-> voxel index
+// voxel index             -> voxel texture index
 // 
 // NDC                     -> world
 // depth (= NDC z)         -> camera z
@@ -229,8 +238,8 @@ float3 VoxelUVWtoWorld(float3 uvw) {
 int3 WorldToVoxelIndex(float3 p_world) {
 	const float3 voxel = (p_world - g_voxel_grid_center) * g_voxel_inv_size 
 		               + 0.5f * g_voxel_grid_resolution;
-	// [0,R)^3 -> [0,R)x(R,0]x[0,R)
-	return int3(0, g_voxel_grid_resolution, 0) + int3(1, -1, 1) * floor(voxel);
+	// [0,R)^3 -> [0,R)x[R-1,-1)x[0,R)
+	return int3(0, g_voxel_grid_resolution - 1, 0) + int3(1, -1, 1) * floor(voxel);
 }
 
 /**
@@ -242,12 +251,27 @@ int3 WorldToVoxelIndex(float3 p_world) {
  @return		The voxel index.
  */
 float3 VoxelIndexToWorld(uint3 voxel_index) {
-	// [0,R]x[R,0]x[0,R] -> [-R/2,R/2]^3
+	// [0,R)x[R-1,-1)x[0,R) -> [-R/2,R/2)^3
 	const float3 voxel = float3( 1.0f, -1.0f,  1.0f) * voxel_index
-		               + float3(-0.5f,  0.5f, -0.5f) * g_voxel_grid_resolution;
+		               + float3(-0.5f,  0.5f, -0.5f) * g_voxel_grid_resolution
+		               + float3( 0.0f, -1.0f,  0.0f);
 	return g_voxel_grid_center + voxel * g_voxel_size;
 }
 
+/**
+ Converts the given voxel index to the corresponding voxel texture index. The 
+ voxel texture is addressed toroidally to scroll clipmaps without moving the 
+ voxels.
+
+ @param[in]		voxel_index
+				The voxel index.
+ @return		The voxel texture index.
+ */
+uint3 VoxelIndexToTextureIndex(uint3 voxel_index) {
+	return (voxel_index + g_voxel_texture_offset) 
+		 & (g_voxel_grid_resolution - 1u);
+}
+
 /**
  Converts the given position expressed in NDC space to the corresponding 
  position expressed in world space.
@@ -9,11 +9,12 @@
 // FOG_FACTOR_FUNCTION                      | FogFactor_Exponential
 // LIGHT_ANGULAR_ATTENUATION_FUNCTION       | AngularAttenuation
 // LIGHT_DISTANCE_ATTENUATION_FUNCTION      | DistanceAttenuation
+// SHADOW_CASCADE_BLEND_FRACTION            | 0.1f
 
 //-----------------------------------------------------------------------------
 // Engine Includes
 //-----------------------------------------------------------------------------
-#include "math.hlsli"
+#include "global.hlsli"
 
 //-----------------------------------------------------------------------------
 // Engine Defines
@@ -31,6 +32,10 @@
 	#define FOG_FACTOR_FUNCTION FogFactor_Exponential
 #endif // FOG_FACTOR_FUNCTION
 
+#ifndef SHADOW_CASCADE_BLEND_FRACTION
+	#define SHADOW_CASCADE_BLEND_FRACTION 0.1f
+#endif // SHADOW_CASCADE_BLEND_FRACTION
+
 //-----------------------------------------------------------------------------
 // Engine Declarations and Definitions: Attenuation
 //-----------------------------------------------------------------------------
@@ -107,10 +112,21 @@ float AngularAttenuation(float cos_theta,
 struct ShadowMap {
 	// The PCF sampler comparison state.
 	SamplerComparisonState pcf_sampler;
-	// The array of shadow maps.
-	Texture2DArray< float > maps;
-	// The index into the array of shadow maps.
-	uint index;
+	// The shadow atlas.
+	Texture2D< float > atlas;
+	// The shadow atlas tile transform of the shadow map: 
+	// [offset_u, offset_v, scale_u, scale_v].
+	float4 tile;
+};
+
+/**
+ A struct of shadow cascade maps.
+ */
+struct ShadowCascadeMap {
+	// The PCF sampler comparison state.
+	SamplerComparisonState pcf_sampler;
+	// The shadow atlas.
+	Texture2D< float > atlas;
 };
 
 /**
@@ -119,16 +135,48 @@ struct ShadowMap {
 struct ShadowCubeMap {
 	// The PCF sampler comparison state.
 	SamplerComparisonState pcf_sampler;
-	// The array of shadow cube maps.
-	TextureCubeArray< float > maps;
-	// The index into the array of shadow cube maps.
-	uint index;
+	// The shadow atlas.
+	Texture2D< float > atlas;
+	// The shadow atlas tile transforms of the six faces of the shadow cube 
+	// map (+x, -x, +y, -y, +z, -z): [offset_u, offset_v, scale_u, scale_v].
+	float4 tiles[6];
 };
 
 /**
  Computes the shadow factor.
 
- @pre			@a shadow_maps must contain a shadow map at index @a index.
+ @param[in]		atlas
+				The shadow atlas.
+ @param[in]		pcf_sampler
+				The PCF sampler comparison state.
+ @param[in]		tile
+				The shadow atlas tile transform of the shadow map.
+ @param[in]		p_ndc
+				The hit position expressed in light NDC space.
+ @return		The shadow factor.
+ */
+float ShadowFactor(Texture2D< float > atlas, SamplerComparisonState pcf_sampler,
+				   float4 tile, float3 p_ndc) {
+
+	// Lights without a tile in the shadow atlas are not shadowed.
+	if (0.0f == tile.z) {
+		return 1.0f;
+	}
+
+	const float2 uv = NDCtoUV(p_ndc.xy);
+	// Positions outside the shadow map are shadowed (cfr. the border color 
+	// of the PCF sampler).
+	if (any(uv != saturate(uv))) {
+		return 0.0f;
+	}
+
+	const float2 location = tile.xy + uv * tile.zw;
+	return atlas.SampleCmpLevelZero(pcf_sampler, location, p_ndc.z);
+}
+
+/**
+ Computes the shadow factor.
+
  @param[in]		shadow_map
 				The shadow map.
  @param[in]		p_ndc
@@ -136,16 +184,13 @@ struct ShadowCubeMap {
  @return		The shadow factor.
  */
 float ShadowFactor(ShadowMap shadow_map, float3 p_ndc) {
-	const float3 location = { NDCtoUV(p_ndc.xy), shadow_map.index };
-
-	return shadow_map.maps
-		.SampleCmpLevelZero(shadow_map.pcf_sampler, location, p_ndc.z);
+	return ShadowFactor(shadow_map.atlas, shadow_map.pcf_sampler, 
+						shadow_map.tile, p_ndc);
 }
 
 /**
  Computes the shadow factor.
 
- @pre			@a shadow_maps must contain a shadow cube map at index @a index.
  @param[in]		shadow_cube_map
 				The shadow cube map.
  @param[in]		p_light
@@ -158,12 +203,33 @@ float ShadowFactor(ShadowMap shadow_map, float3 p_ndc) {
 float ShadowFactor(ShadowCubeMap shadow_cube_map, float3 p_light, 
 				   float2 projection_values) {
 
-	const float  p_light_z = Max(abs(p_light));
-	const float  p_ndc_z   = ViewZtoNDCZ(p_light_z, projection_values);
-	const float4 location  = float4(p_light, shadow_cube_map.index);
-
-	return shadow_cube_map.maps
-		.SampleCmpLevelZero(shadow_cube_map.pcf_sampler, location, p_ndc_z);
+	// Select the face of the major axis and express the hit position in the 
+	// light space of that face (cfr. the omni light cameras).
+	const float3 abs_p_light = abs(p_light);
+	uint   face;
+	float3 p_face;
+	if (abs_p_light.x >= abs_p_light.y && abs_p_light.x >= abs_p_light.z) {
+		face   = (0.0f <= p_light.x) ? 0u : 1u;
+		p_face = (0.0f <= p_light.x) ? float3(-p_light.z, p_light.y,  p_light.x)
+			                         : float3( p_light.z, p_light.y, -p_light.x);
+	}
+	else if (abs_p_light.y >= abs_p_light.z) {
+		face   = (0.0f <= p_light.y) ? 2u : 3u;
+		p_face = (0.0f <= p_light.y) ? float3(p_light.x, -p_light.z,  p_light.y)
+			                         : float3(p_light.x,  p_light.z, -p_light.y);
+	}
+	else {
+		face   = (0.0f <= p_light.z) ? 4u : 5u;
+		p_face = (0.0f <= p_light.z) ? p_light
+			                         : float3(-p_light.x, p_light.y, -p_light.z);
+	}
+
+	// The faces use a 90 degrees field of view and an aspect ratio of 1.
+	const float3 p_ndc = float3(p_face.xy / p_face.z, 
+								ViewZtoNDCZ(p_face.z, projection_values));
+
+	return ShadowFactor(shadow_cube_map.atlas, shadow_cube_map.pcf_sampler, 
+						shadow_cube_map.tiles[face], p_ndc);
 }
 
 //-----------------------------------------------------------------------------
@@ -221,7 +287,18 @@ struct SpotLight {
 /**
  A struct of shadow mapped directional lights.
  */
-typedef DirectionalLight ShadowMappedDirectionalLight;
+struct ShadowMappedDirectionalLight {
+	// The directional light.
+	DirectionalLight light;
+	// The world-to-projection transformation matrices of the shadow cascades.
+	float4x4 cascade_world_to_projection[MAX_NB_SHADOW_CASCADES];
+	// The shadow atlas tile transforms of the shadow cascades: 
+	// [offset_u, offset_v, scale_u, scale_v].
+	float4   cascade_tiles[MAX_NB_SHADOW_CASCADES];
+	// The number of shadow cascades.
+	uint     nb_cascades;
+	uint3    padding0;
+};
 
 /**
  A struct of shadow mapped omni lights.
@@ -236,6 +313,9 @@ struct ShadowMappedOmniLight {
 	// projection_values.y = light_to_projection32
 	float2   projection_values;
 	uint2    padding0;
+	// The shadow atlas tile transforms of the six faces: 
+	// [offset_u, offset_v, scale_u, scale_v].
+	float4   shadow_tiles[6];
 };
 
 /**
@@ -246,8 +326,66 @@ struct ShadowMappedSpotLight {
 	SpotLight light;
 	// The world-to-projection transformation matrix.
 	float4x4 world_to_projection;
+	// The shadow atlas tile transform: [offset_u, offset_v, scale_u, scale_v].
+	float4   shadow_tile;
 };
 
+/**
+ Computes the shadow factor.
+
+ The first shadow cascade containing the hit position is used. Near the 
+ border of that shadow cascade, the shadow factor is blended with the next 
+ shadow cascade. Hit positions outside all shadow cascades are not shadowed.
+
+ @param[in]		shadow_cascade_map
+				The shadow cascade map.
+ @param[in]		light
+				The shadow mapped directional light.
+ @param[in]		p
+				The hit position expressed in world space.
+ @return		The shadow factor.
+ */
+float ShadowFactor(ShadowCascadeMap shadow_cascade_map, 
+				   ShadowMappedDirectionalLight light, float3 p) {
+
+	for (uint i = 0u; i < light.nb_cascades; ++i) {
+		const float4 p_proj = mul(float4(p, 1.0f), 
+								  light.cascade_world_to_projection[i]);
+		const float3 p_ndc  = HomogeneousDivide(p_proj);
+		const float  border = Max(abs(p_ndc.xy));
+		if (1.0f < border) {
+			continue;
+		}
+
+		const float s = ShadowFactor(shadow_cascade_map.atlas, 
+									 shadow_cascade_map.pcf_sampler, 
+									 light.cascade_tiles[i], p_ndc);
+
+		const float t = saturate((border - 1.0f + SHADOW_CASCADE_BLEND_FRACTION) 
+								 / SHADOW_CASCADE_BLEND_FRACTION);
+		if (0.0f == t || light.nb_cascades == i + 1u) {
+			return s;
+		}
+
+		// Blend with the next shadow cascade (if it contains the hit 
+		// position).
+		const float4 p_proj_next = mul(float4(p, 1.0f), 
+									   light.cascade_world_to_projection[i + 1u]);
+		const float3 p_ndc_next  = HomogeneousDivide(p_proj_next);
+		if (1.0f < Max(abs(p_ndc_next.xy))) {
+			return s;
+		}
+
+		const float s_next = ShadowFactor(shadow_cascade_map.atlas, 
+										  shadow_cascade_map.pcf_sampler, 
+										  light.cascade_tiles[i + 1u], 
+										  p_ndc_next);
+		return lerp(s, s_next, t);
+	}
+
+	return 1.0f;
+}
+
 /**
  Computes the irradiance contribution of the given directional light.
 
@@ -349,11 +487,10 @@ void Contribution(SpotLight light, float3 p, out float3 l, out float3 E) {
 /**
  Computes the irradiance contribution of the given directional light.
 
- @pre			@a shadow_maps must contain a shadow map at index @a index.
  @param[in]		light
-				The directional light.
- @param[in]		shadow_map
-				The shadow map.
+				The shadow mapped directional light.
+ @param[in]		shadow_cascade_map
+				The shadow cascade map.
  @param[in]		p
 				The hit position expressed in world space.
  @param[out]	l
@@ -362,20 +499,20 @@ void Contribution(SpotLight light, float3 p, out float3 l, out float3 E) {
 				The (orthogonal) irradiance contribution of the given 
 				directional light.
  */
-void Contribution(ShadowMappedDirectionalLight light, ShadowMap shadow_map,
+void Contribution(ShadowMappedDirectionalLight light, 
+				  ShadowCascadeMap shadow_cascade_map,
 				  float3 p, out float3 l, out float3 E) {
 
-	float3 l0, E0, p_ndc;
-	Contribution(light, p, l0, E0, p_ndc);
+	float3 l0, E0;
+	Contribution(light.light, p, l0, E0);
 
 	l = l0;
-	E = E0 * ShadowFactor(shadow_map, p_ndc);
+	E = E0 * ShadowFactor(shadow_cascade_map, light, p);
 }
 
 /**
  Computes the irradiance contribution of the given omni light.
 
- @pre			@a shadow_maps must contain a shadow cube map at index @a index.
  @param[in]		light
 				The omni light.
  @param[in]		shadow_cube_map
@@ -402,7 +539,6 @@ void Contribution(ShadowMappedOmniLight light, ShadowCubeMap shadow_cube_map,
 /**
  Computes the irradiance contribution of the given spotlight.
 
- @pre			@a shadow_maps must contain a shadow map at index @a index.
  @param[in]		light
 				The spotlight.
  @param[in]		shadow_map
@@ -17,6 +17,7 @@
 // DISABLE_FOG                              | not defined
 // DISABLE_ILLUMINATION_DIRECT              | not defined
 // DISABLE_ILLUMINATION_INDIRECT            | not defined
+// DISABLE_IRRADIANCE_PROBES                | not defined
 // DISABLE_LIGHTS_DIRECTIONAL               | not defined
 // DISABLE_LIGHTS_OMNI                      | not defined
 // DISABLE_LIGHTS_SPOT                      | not defined
@@ -40,8 +41,14 @@
 
 #ifdef DISABLE_ILLUMINATION_INDIRECT
 	#define DISABLE_VCT
+	#define DISABLE_IRRADIANCE_PROBES
 #endif // DISABLE_ILLUMINATION_INDIRECT
 
+#ifndef DISABLE_VCT
+	// Voxel cone tracing already accounts for the indirect illumination.
+	#define DISABLE_IRRADIANCE_PROBES
+#endif // DISABLE_VCT
+
 #ifdef BRDF_FUNCTION
 
 	#include "brdf.hlsli"
@@ -50,6 +57,10 @@
 		#include "vct.hlsli"
 	#endif // DISABLE_VCT
 
+	#ifndef DISABLE_IRRADIANCE_PROBES
+		#include "sh.hlsli"
+	#endif // DISABLE_IRRADIANCE_PROBES
+
 #endif // BRDF_FUNCTION
 
 //-----------------------------------------------------------------------------
@@ -85,6 +96,19 @@ CBUFFER(LightBuffer, SLOT_CBUFFER_LIGHTING) {
 
 	// The radiance of the ambient light in the scene. 
 	float3 g_La                     : packoffset(c2);
+
+	//-------------------------------------------------------------------------
+	// Member Variables: Irradiance Probes
+	//-------------------------------------------------------------------------
+
+	// The world space minimum point of the irradiance volume.
+	float3 g_probe_volume_minimum    : packoffset(c3);
+	// The scaling factors from world space to the grid space of the 
+	// irradiance volume.
+	float3 g_probe_volume_scale      : packoffset(c4);
+	// The number of probes along each axis of the irradiance volume (or zero 
+	// if no irradiance volume is available).
+	uint3 g_probe_volume_resolution  : packoffset(c5);
 }
 
 //-----------------------------------------------------------------------------
@@ -112,30 +136,31 @@ STRUCTURED_BUFFER(g_spot_lights, SpotLight,
 #ifndef DISABLE_LIGHTS_SHADOW_MAPPED_DIRECTIONAL
 STRUCTURED_BUFFER(g_sm_directional_lights, ShadowMappedDirectionalLight,
 				  SLOT_SRV_SHADOW_MAPPED_DIRECTIONAL_LIGHTS);
-TEXTURE_2D_ARRAY(g_directional_sms, float, 
-				 SLOT_SRV_DIRECTIONAL_SHADOW_MAPS);
 #endif // DISABLE_LIGHTS_SHADOW_MAPPED_DIRECTIONAL
 
 #ifndef DISABLE_LIGHTS_SHADOW_MAPPED_OMNI
 STRUCTURED_BUFFER(g_sm_omni_lights, ShadowMappedOmniLight, 
 				  SLOT_SRV_SHADOW_MAPPED_OMNI_LIGHTS);
-TEXTURE_CUBE_ARRAY(g_omni_sms, float, 
-				   SLOT_SRV_OMNI_SHADOW_MAPS);
 #endif // DISABLE_LIGHTS_SHADOW_MAPPED_OMNI
 
 #ifndef DISABLE_LIGHTS_SHADOW_MAPPED_SPOT
 STRUCTURED_BUFFER(g_sm_spot_lights, ShadowMappedSpotLight, 
 				  SLOT_SRV_SHADOW_MAPPED_SPOT_LIGHTS);
-TEXTURE_2D_ARRAY(g_spot_sms, float, 
-				 SLOT_SRV_SPOT_SHADOW_MAPS);
 #endif // DISABLE_LIGHTS_SHADOW_MAPPED_SPOT
 
+TEXTURE_2D(g_shadow_atlas, float, SLOT_SRV_SHADOW_ATLAS);
+
 #endif // DISABLE_LIGHTS_SHADOW_MAPPED
 
 #ifndef DISABLE_VCT
 TEXTURE_3D(g_voxel_texture, float4, SLOT_SRV_VOXEL_TEXTURE);
 #endif // DISABLE_VCT
 
+#ifndef DISABLE_IRRADIANCE_PROBES
+STRUCTURED_BUFFER(g_irradiance_probes, IrradianceProbe, 
+				  SLOT_SRV_IRRADIANCE_PROBES);
+#endif // DISABLE_IRRADIANCE_PROBES
+
 #endif // BRDF_FUNCTION
 
 //-----------------------------------------------------------------------------
@@ -192,10 +217,11 @@ float3 GetDirectRadiance(float3 v, float3 p, float3 n, Material material) {
 	// Directional lights with shadow mapping contribution
 	for (uint i3 = 0u; i3 < g_nb_sm_directional_lights; ++i3) {
 		const ShadowMappedDirectionalLight light = g_sm_directional_lights[i3];
-		const ShadowMap shadow_map = { g_pcf_sampler, g_directional_sms, i3 };
+		const ShadowCascadeMap shadow_cascade_map = { g_pcf_sampler, 
+													  g_shadow_atlas };
 
 		float3 l, E;
-		Contribution(light, shadow_map, p, l, E);
+		Contribution(light, shadow_cascade_map, p, l, E);
 		const float n_dot_l = sat_dot(n, l);
 
 		L += BRDF_FUNCTION(n, l, v, material) * E * n_dot_l;
@@ -206,7 +232,8 @@ float3 GetDirectRadiance(float3 v, float3 p, float3 n, Material material) {
 	// Omni lights with shadow mapping contribution
 	for (uint i4 = 0u; i4 < g_nb_sm_omni_lights; ++i4) {
 		const ShadowMappedOmniLight light = g_sm_omni_lights[i4];
-		const ShadowCubeMap shadow_cube_map = { g_pcf_sampler, g_omni_sms, i4 };
+		const ShadowCubeMap shadow_cube_map = { g_pcf_sampler, g_shadow_atlas, 
+												light.shadow_tiles };
 
 		float3 l, E;
 		Contribution(light, shadow_cube_map, p, l, E);
@@ -220,7 +247,8 @@ float3 GetDirectRadiance(float3 v, float3 p, float3 n, Material material) {
 	// Spotlights with shadow mapping contribution
 	for (uint i5 = 0u; i5 < g_nb_sm_spot_lights; ++i5) {
 		const ShadowMappedSpotLight light = g_sm_spot_lights[i5];
-		const ShadowMap shadow_map = { g_pcf_sampler, g_spot_sms, i5 };
+		const ShadowMap shadow_map = { g_pcf_sampler, g_shadow_atlas, 
+									   light.shadow_tile };
 		
 		float3 l, E;
 		Contribution(light, shadow_map, p, l, E);
@@ -235,9 +263,54 @@ float3 GetDirectRadiance(float3 v, float3 p, float3 n, Material material) {
 	return L;
 }
 
+#ifndef DISABLE_IRRADIANCE_PROBES
+
+/**
+ Returns the irradiance at the given surface point by trilinearly 
+ interpolating the eight surrounding irradiance probes.
+
+ @param[in]		p
+				The world space surface position.
+ @param[in]		n
+				The (normalized) world space surface normal.
+ @return		The irradiance at the given surface point.
+ */
+float3 GetProbeIrradiance(float3 p, float3 n) {
+	const uint3  max_index = g_probe_volume_resolution - 1u;
+	const float3 g         = clamp((p - g_probe_volume_minimum) * g_probe_volume_scale, 
+								   0.0f, (float3)max_index);
+	const uint3  first     = (uint3)g;
+	const uint3  last      = min(first + 1u, max_index);
+	const float3 t         = g - (float3)first;
+
+	float3 E = 0.0f;
+	[unroll]
+	for (uint corner = 0u; corner < 8u; ++corner) {
+		const bool3  upper  = bool3(corner & 1u, corner & 2u, corner & 4u);
+		const uint3  index  = upper ? last : first;
+		const float3 w      = upper ? t : 1.0f - t;
+		const uint   probe  = index.x + g_probe_volume_resolution.x 
+			                * (index.y + g_probe_volume_resolution.y * index.z);
+
+		E += w.x * w.y * w.z * EvaluateSH(g_irradiance_probes[probe].E, n);
+	}
+
+	return E;
+}
+
+#endif // DISABLE_IRRADIANCE_PROBES
+
 float3 GetIndirectRadiance(float3 v, float3 p, float3 n, Material material) {
 	float3 L = 0.0f;
 
+	#ifndef DISABLE_IRRADIANCE_PROBES
+	// Irradiance probes contribution (including the ambient light)
+	if (0u != g_probe_volume_resolution.x) {
+		const float3 E = GetProbeIrradiance(p, n);
+		return (1.0f - material.metalness) * material.base_color * g_inv_pi * E;
+	}
+	#endif // DISABLE_IRRADIANCE_PROBES
+
 	#ifndef DISABLE_LIGHT_AMBIENT
 	// Ambient light contribution
 	L += g_La;
@@ -253,7 +326,8 @@ float3 GetIndirectRadiance(float3 v, float3 p, float3 n, Material material) {
 		g_voxel_grid_inv_resolution,
 		g_cone_step_multiplier,
 		g_max_cone_distance,
-		g_linear_clamp_sampler,
+		g_voxel_texture_offset * g_voxel_grid_inv_resolution,
+		g_linear_wrap_sampler,
 		g_voxel_texture
 	};
 
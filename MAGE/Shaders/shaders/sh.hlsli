@@ -0,0 +1,41 @@
+#ifndef MAGE_HEADER_SH
+#define MAGE_HEADER_SH
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+
+/**
+ A struct of irradiance probes.
+ */
+struct IrradianceProbe {
+	// The second-order spherical harmonics coefficients of the irradiance in 
+	// watts per square meter of this irradiance probe.
+	float3 E[9];
+};
+
+/**
+ Evaluates the irradiance of the given second-order spherical harmonics 
+ coefficients in the given direction.
+
+ @pre			@a n is normalized.
+ @param[in]		E
+				The second-order spherical harmonics coefficients of the 
+				irradiance.
+ @param[in]		n
+				The direction.
+ @return		The irradiance in the given direction.
+ */
+float3 EvaluateSH(float3 E[9], float3 n) {
+	float3 result = 0.282095f * E[0];
+	
+	result += 0.488603f * (n.y * E[1] + n.z * E[2] + n.x * E[3]);
+	
+	result += 1.092548f * (n.x * n.y * E[4] + n.y * n.z * E[5] + n.x * n.z * E[7]);
+	result += 0.315392f * (3.0f * n.z * n.z - 1.0f) * E[6];
+	result += 0.546274f * (n.x * n.x - n.y * n.y) * E[8];
+
+	return max(result, 0.0f);
+}
+
+#endif // MAGE_HEADER_SH
\ No newline at end of file
@@ -25,6 +25,9 @@ struct VCTConfig {
 	float voxel_grid_inv_resolution;
 	float cone_step_multiplier;
 	float max_cone_distance;
+	// The offset of the voxel grid in the (toroidally addressed) voxel 
+	// texture (expressed in normalized texture coordinates).
+	float3 voxel_texture_offset;
 	SamplerState voxel_sampler;
 	Texture3D< float4 > voxel_texture;
 };
@@ -62,7 +65,8 @@ float3 GetVCTRadiance(Cone cone, VCTConfig config) {
 
 		// Obtain the radiance.
 		const float4 L_voxel 
-			= config.voxel_texture.SampleLevel(config.voxel_sampler, uvw, mip_level);
+			= config.voxel_texture.SampleLevel(config.voxel_sampler, 
+				uvw + config.voxel_texture_offset, mip_level);
 
 		// Perform blending.
 		const float inv_alpha = 1.0f - L.w;
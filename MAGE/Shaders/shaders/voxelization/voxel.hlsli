@@ -4,6 +4,7 @@
 //-----------------------------------------------------------------------------
 // Engine Includes
 //-----------------------------------------------------------------------------
+#include "global.hlsli"
 #include "color.hlsli"
 #include "normal.hlsli"
 
@@ -32,4 +33,18 @@ float3 DecodeNormal(uint encoded_n) {
 	return NORMAL_DECODE_FUNCTION(UnpackR16G16(encoded_n));
 }
 
+uint PackVoxelBrick(uint3 brick) {
+	return brick.x | (brick.y << 10u) | (brick.z << 20u);
+}
+
+uint3 UnpackVoxelBrick(uint packed_brick) {
+	return uint3(packed_brick, packed_brick >> 10u, packed_brick >> 20u) 
+		 & 0x3FFu;
+}
+
+uint FlattenVoxelBrickIndex(uint3 brick) {
+	const uint nb_bricks = g_voxel_grid_resolution / VOXEL_BRICK_SIZE;
+	return brick.x + nb_bricks * (brick.y + nb_bricks * brick.z);
+}
+
 #endif // MAGE_HEADER_VOXEL
\ No newline at end of file
@@ -21,7 +21,7 @@ GSInputPositionColor VS(uint flat_index : SV_VERTEXID) {
 
 	GSInputPositionColor output;
 	output.p_world = VoxelIndexToWorld(index);
-	output.color   = g_voxel_texture[index];
+	output.color   = g_voxel_texture[VoxelIndexToTextureIndex(index)];
 
 	return output;
 }
\ No newline at end of file
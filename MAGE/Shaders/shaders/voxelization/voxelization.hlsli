@@ -34,6 +34,11 @@
 #include "lighting.hlsli"
 #include "voxelization\voxel.hlsli"
 
+//-----------------------------------------------------------------------------
+// SRV
+//-----------------------------------------------------------------------------
+STRUCTURED_BUFFER(voxel_brick_mask, uint, SLOT_SRV_VOXEL_BRICK_MASK);
+
 //-----------------------------------------------------------------------------
 // UAV
 //-----------------------------------------------------------------------------
@@ -52,6 +57,14 @@ void PS(PSInputPositionNormalTexture input) {
 		return;
 	}
 
+	// Only voxelize the dirty bricks (the voxels of the other bricks are 
+	// preserved in the voxel texture).
+	const uint brick_index = FlattenVoxelBrickIndex(index / VOXEL_BRICK_SIZE);
+	[branch]
+	if (0u == (voxel_brick_mask[brick_index >> 5u] & (1u << (brick_index & 31u)))) {
+		return;
+	}
+
 	// Obtain the base color of the material.
 	const float4 base_color = GetMaterialBaseColor(input.tex_material);
 	
@@ -8,14 +8,7 @@
 //-----------------------------------------------------------------------------
 // Engine Includes
 //-----------------------------------------------------------------------------
-#include "global.hlsli"
-#include "voxelization\voxel.hlsli"
-
-//-----------------------------------------------------------------------------
-// UAV
-//-----------------------------------------------------------------------------
-RW_STRUCTURED_BUFFER(voxel_grid, Voxel,  SLOT_UAV_VOXEL_BUFFER);
-RW_TEXTURE_3D(voxel_texture,     float4, SLOT_UAV_VOXEL_TEXTURE);
+#include "voxelization\voxelization_resolve.hlsli"
 
 //-----------------------------------------------------------------------------
 // Compute Shader
@@ -33,12 +26,5 @@ void CS(uint3 thread_id : SV_DispatchThreadID) {
 		return;
 	}
 
-	const uint flat_index = FlattenIndex(thread_id, g_voxel_grid_resolution);
-	const uint encoded_L  = voxel_grid[flat_index].encoded_L;
-	voxel_grid[flat_index].encoded_L = 0u;
-	voxel_grid[flat_index].encoded_n = 0u;
-
-	const float3 L     = DecodeRadiance(encoded_L);
-	const float  alpha = float(0u != encoded_L);
-	voxel_texture[thread_id] = float4(L, alpha);
+	ResolveVoxel(thread_id);
 }
\ No newline at end of file
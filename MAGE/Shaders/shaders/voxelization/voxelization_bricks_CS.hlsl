@@ -0,0 +1,22 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#include "voxelization\voxelization_resolve.hlsli"
+
+//-----------------------------------------------------------------------------
+// SRV
+//-----------------------------------------------------------------------------
+STRUCTURED_BUFFER(voxel_bricks, uint, SLOT_SRV_VOXEL_BRICKS);
+
+//-----------------------------------------------------------------------------
+// Compute Shader
+//-----------------------------------------------------------------------------
+
+// One group per dirty brick.
+[numthreads(VOXEL_BRICK_SIZE, VOXEL_BRICK_SIZE, VOXEL_BRICK_SIZE)]
+void CS(uint3 group_id : SV_GroupID, uint3 thread_id : SV_GroupThreadID) {
+
+	const uint3 brick = UnpackVoxelBrick(voxel_bricks[group_id.x]);
+	
+	ResolveVoxel(brick * VOXEL_BRICK_SIZE + thread_id);
+}
\ No newline at end of file
@@ -0,0 +1,58 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#include "global.hlsli"
+#include "voxelization\voxel.hlsli"
+
+//-----------------------------------------------------------------------------
+// SRV
+//-----------------------------------------------------------------------------
+STRUCTURED_BUFFER(voxel_bricks, uint,   SLOT_SRV_VOXEL_BRICKS);
+TEXTURE_3D(voxel_mip,           float4, SLOT_SRV_VOXEL_MIP);
+
+//-----------------------------------------------------------------------------
+// UAV
+//-----------------------------------------------------------------------------
+RW_TEXTURE_3D(voxel_texture,    float4, SLOT_UAV_VOXEL_TEXTURE);
+
+//-----------------------------------------------------------------------------
+// Compute Shader
+//-----------------------------------------------------------------------------
+
+#define GROUP_SIZE (VOXEL_BRICK_SIZE / 2)
+
+// One group per dirty brick. The voxel texture UAV contains mip level m, and 
+// the voxel mip SRV contains mip level m-1.
+[numthreads(GROUP_SIZE, GROUP_SIZE, GROUP_SIZE)]
+void CS(uint3 group_id : SV_GroupID, uint3 thread_id : SV_GroupThreadID) {
+
+	uint3 resolution;
+	voxel_texture.GetDimensions(resolution.x, resolution.y, resolution.z);
+
+	// The number of voxels of mip level 0 per voxel of mip level m.
+	const uint scale = g_voxel_grid_resolution / resolution.x;
+	// The number of voxels of mip level m covered by a brick.
+	const uint size  = max(1u, VOXEL_BRICK_SIZE / scale);
+
+	[branch]
+	if (any(size <= thread_id)) {
+		return;
+	}
+
+	const uint3 brick = UnpackVoxelBrick(voxel_bricks[group_id.x]);
+	// Bricks are aligned with the toroidal addressing of the voxel texture.
+	const uint3 index = VoxelIndexToTextureIndex(brick * VOXEL_BRICK_SIZE) 
+		              / scale + thread_id;
+
+	// Box filter (i.e. the same filter as for the generation of all mips).
+	const uint3 src = 2u * index;
+	float4 L = 0.0f;
+	[unroll]
+	for (uint i = 0u; i < 8u; ++i) {
+		L += voxel_mip[src + uint3(i & 1u, (i >> 1u) & 1u, i >> 2u)];
+	}
+
+	// Multiple bricks can cover the same voxel of mip level m, but all 
+	// compute and store the same value.
+	voxel_texture[index] = 0.125f * L;
+}
\ No newline at end of file
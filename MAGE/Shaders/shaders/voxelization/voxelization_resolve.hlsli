@@ -0,0 +1,38 @@
+#ifndef MAGE_HEADER_VOXELIZATION_RESOLVE
+#define MAGE_HEADER_VOXELIZATION_RESOLVE
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#include "global.hlsli"
+#include "voxelization\voxel.hlsli"
+
+//-----------------------------------------------------------------------------
+// UAV
+//-----------------------------------------------------------------------------
+RW_STRUCTURED_BUFFER(voxel_grid, Voxel,  SLOT_UAV_VOXEL_BUFFER);
+RW_TEXTURE_3D(voxel_texture,     float4, SLOT_UAV_VOXEL_TEXTURE);
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+
+/**
+ Resolves the voxel with the given voxel index from the voxel buffer to the 
+ voxel texture, and clears the voxel in the voxel buffer.
+
+ @param[in]		index
+				The voxel index.
+ */
+void ResolveVoxel(uint3 index) {
+	const uint flat_index = FlattenIndex(index, g_voxel_grid_resolution);
+	const uint encoded_L  = voxel_grid[flat_index].encoded_L;
+	voxel_grid[flat_index].encoded_L = 0u;
+	voxel_grid[flat_index].encoded_n = 0u;
+
+	const float3 L     = DecodeRadiance(encoded_L);
+	const float  alpha = float(0u != encoded_L);
+	voxel_texture[VoxelIndexToTextureIndex(index)] = float4(L, alpha);
+}
+
+#endif // MAGE_HEADER_VOXELIZATION_RESOLVE
\ No newline at end of file
@@ -76,16 +76,27 @@
 #define SLOT_SRV_SHADOW_MAPPED_DIRECTIONAL_LIGHTS  4
 #define SLOT_SRV_SHADOW_MAPPED_OMNI_LIGHTS         5
 #define SLOT_SRV_SHADOW_MAPPED_SPOT_LIGHTS         6
-// Shadow (Cube) Maps
-#define SLOT_SRV_DIRECTIONAL_SHADOW_MAPS           7
-#define SLOT_SRV_OMNI_SHADOW_MAPS                  8
-#define SLOT_SRV_SPOT_SHADOW_MAPS                  9
+// Shadow Atlas
+#define SLOT_SRV_SHADOW_ATLAS                      7
+
+#define MAX_NB_SHADOW_CASCADES                     4
 
 //-----------------------------------------------------------------------------
 // Engine Includes: Voxelization
 //-----------------------------------------------------------------------------
 
 #define SLOT_SRV_VOXEL_TEXTURE                    10
+#define SLOT_SRV_VOXEL_BRICK_MASK                 16
+#define SLOT_SRV_VOXEL_BRICKS                     17
+#define SLOT_SRV_VOXEL_MIP                        18
+
+#define VOXEL_BRICK_SIZE                           8  //  8^3 = 512, 512/64 = 8
+
+//-----------------------------------------------------------------------------
+// Engine Includes: Irradiance Probes
+//-----------------------------------------------------------------------------
+
+#define SLOT_SRV_IRRADIANCE_PROBES                19
 
 //-----------------------------------------------------------------------------
 // Engine Includes: GBuffer SRVs
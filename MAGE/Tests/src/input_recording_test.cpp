@@ -0,0 +1,195 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test\test.hpp"
+#include "input_recording.hpp"
+#include "exception\exception.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	using namespace input;
+
+	namespace {
+
+		/**
+		 Returns the path of the input recording file of the tests.
+
+		 @return		The path of the input recording file of the tests.
+		 */
+		[[nodiscard]]
+		const std::filesystem::path GetRecordingPath() {
+			return std::filesystem::temp_directory_path()
+				 / L"mage_input_recording_test.inp";
+		}
+
+		/**
+		 Returns the input frames of the tests. Each input frame presses a
+		 key and a mouse button and moves the mouse. The second input frame
+		 also releases the key of the first input frame.
+
+		 @return		A vector containing the input frames.
+		 */
+		[[nodiscard]]
+		const std::vector< InputFrame > GetFrames() {
+			std::vector< InputFrame > frames(3u);
+			for (size_t i = 0u; i < frames.size(); ++i) {
+				auto& frame = frames[i];
+				if (0u != i) {
+					frame.m_keyboard = frames[i - 1u].m_keyboard;
+				}
+				if (1u == i) {
+					frame.m_keyboard.m_keys[DIK_W] = 0u;
+				}
+
+				const auto s = static_cast< S32 >(i);
+				frame.m_wall_clock_delta_time = TimeIntervalSeconds(0.016 * (i + 1u));
+				frame.m_core_clock_delta_time = TimeIntervalSeconds(0.015 * (i + 1u));
+				frame.m_keyboard.m_keys[DIK_W + i] = 0x80u;
+				frame.m_mouse.m_position    = S32x2(100 + s, 200 - s);
+				frame.m_mouse.m_delta       = S32x2(s, -s);
+				frame.m_mouse.m_delta_wheel = 120 * s;
+				frame.m_mouse.m_buttons[i]  = 0x80u;
+			}
+
+			return frames;
+		}
+
+		/**
+		 Checks whether the given input frames are equal.
+
+		 @param[in]		lhs
+						A reference to the first input frame.
+		 @param[in]		rhs
+						A reference to the second input frame.
+		 @return		@c true if the given input frames are equal.
+						@c false otherwise.
+		 */
+		[[nodiscard]]
+		bool Equals(const InputFrame& lhs, const InputFrame& rhs) noexcept {
+			return lhs.m_wall_clock_delta_time == rhs.m_wall_clock_delta_time
+				&& lhs.m_core_clock_delta_time == rhs.m_core_clock_delta_time
+				&& std::equal(std::cbegin(lhs.m_keyboard.m_keys),
+							  std::cend(lhs.m_keyboard.m_keys),
+							  std::cbegin(rhs.m_keyboard.m_keys))
+				&& lhs.m_mouse.m_position    == rhs.m_mouse.m_position
+				&& lhs.m_mouse.m_delta       == rhs.m_mouse.m_delta
+				&& lhs.m_mouse.m_delta_wheel == rhs.m_mouse.m_delta_wheel
+				&& std::equal(std::cbegin(lhs.m_mouse.m_buttons),
+							  std::cend(lhs.m_mouse.m_buttons),
+							  std::cbegin(rhs.m_mouse.m_buttons));
+		}
+
+		/**
+		 Records the input frames of the tests.
+		 */
+		void Record() {
+			InputRecorder recorder(GetRecordingPath());
+			for (const auto& frame : GetFrames()) {
+				recorder.Record(frame);
+			}
+		}
+
+		/**
+		 The size of the header of input recording files: the magic token and
+		 the number of input frames.
+		 */
+		constexpr std::uintmax_t g_header_size = 7u + sizeof(U64);
+
+		/**
+		 The sizes of the input frames of the tests: the time deltas, the mouse
+		 state, the number of changed keys and two bytes per changed key.
+		 */
+		constexpr std::uintmax_t g_frame_sizes[] = {
+			42u + 2u * 1u,
+			42u + 2u * 2u,
+			42u + 2u * 1u
+		};
+	}
+
+	MAGE_TEST(InputRecordingRoundTripsInputFrames) {
+		Record();
+		const auto size   = std::filesystem::file_size(GetRecordingPath());
+		const auto frames = ReadInputRecording(GetRecordingPath());
+		std::filesystem::remove(GetRecordingPath());
+
+		const auto expected_frames = GetFrames();
+		MAGE_CHECK(expected_frames.size() == frames.size());
+		for (size_t i = 0u; i < frames.size() && i < expected_frames.size(); ++i) {
+			MAGE_CHECK(Equals(expected_frames[i], frames[i]));
+		}
+
+		// Only the changed keys of each input frame are stored.
+		MAGE_CHECK(g_header_size + g_frame_sizes[0u] + g_frame_sizes[1u]
+				   + g_frame_sizes[2u] == size);
+	}
+
+	MAGE_TEST(InputRecordingDropsTruncatedInputFrames) {
+		Record();
+		const auto expected_frames = GetFrames();
+
+		// The size of the input recording file after the header and after
+		// each input frame.
+		std::uintmax_t sizes[] = { g_header_size, 0u, 0u, 0u };
+		for (size_t i = 0u; i < std::size(g_frame_sizes); ++i) {
+			sizes[i + 1u] = sizes[i] + g_frame_sizes[i];
+		}
+
+		// Truncate the input recording file inside the last input frame (i.e.
+		// inside its changed keys and inside its mouse state), inside the time
+		// deltas of the last input frame, at the end of each input frame and
+		// at the end of the header. The number of input
+		// frames of the header is a hint only and is not updated.
+		const std::pair< std::uintmax_t, size_t > truncations[] = {
+			{ sizes[3u] - 1u, 2u },
+			{ sizes[3u] - 4u, 2u },
+			{ sizes[2u] + 4u, 2u },
+			{ sizes[2u],      2u },
+			{ sizes[1u],      1u },
+			{ sizes[0u],      0u }
+		};
+
+		for (const auto& [size, nb_frames] : truncations) {
+			std::filesystem::resize_file(GetRecordingPath(), size);
+
+			const auto frames = ReadInputRecording(GetRecordingPath());
+			MAGE_CHECK(nb_frames == frames.size());
+			for (size_t i = 0u; i < frames.size() && i < nb_frames; ++i) {
+				MAGE_CHECK(Equals(expected_frames[i], frames[i]));
+			}
+		}
+
+		// A file truncated inside its header is no input recording.
+		std::filesystem::resize_file(GetRecordingPath(), sizes[0u] - 1u);
+		auto throws = false;
+		try {
+			const auto frames = ReadInputRecording(GetRecordingPath());
+		}
+		catch (const Exception&) {
+			throws = true;
+		}
+		MAGE_CHECK(throws);
+
+		std::filesystem::remove(GetRecordingPath());
+	}
+}
\ No newline at end of file
@@ -0,0 +1,223 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test\test.hpp"
+#include "logging\logger.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <cstdarg>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	namespace {
+
+		/**
+		 Logs a message with the given logger.
+
+		 @param[in]		logger
+						A reference to the logger.
+		 @param[in]		severity
+						The severity of the message.
+		 @param[in]		format
+						Pointer to the message format.
+		 @param[in]		...
+						The arguments of the message format.
+		 */
+		void Log(Logger& logger, LogSeverity severity,
+				 const_zstring format, ...) {
+			va_list args;
+			va_start(args, format);
+			logger.Log(severity, format, args);
+			va_end(args);
+		}
+
+		/**
+		 Returns the path of the log file of the logger tests.
+
+		 @return		The path of the log file of the logger tests.
+		 */
+		[[nodiscard]]
+		const std::filesystem::path GetLogPath() {
+			return std::filesystem::temp_directory_path()
+				 / L"mage_logger_test.log";
+		}
+
+		/**
+		 Reads the lines of the log file of the logger tests without their
+		 time stamps.
+
+		 @return		A vector containing the lines of the log file.
+		 */
+		[[nodiscard]]
+		const std::vector< std::string > ReadLog() {
+			std::vector< std::string > lines;
+
+			std::ifstream file(GetLogPath());
+			for (std::string line; std::getline(file, line); ) {
+				// Strip the "[time] " prefix.
+				const auto pos = line.find("] ");
+				lines.push_back((std::string::npos == pos) ? line
+					                                       : line.substr(pos + 2u));
+			}
+
+			return lines;
+		}
+
+		/**
+		 Counts the lines of the given lines starting with the given prefix.
+
+		 @param[in]		lines
+						A reference to a vector containing the lines.
+		 @param[in]		prefix
+						A reference to the prefix.
+		 @return		The number of lines of @a lines starting with
+						@a prefix.
+		 */
+		[[nodiscard]]
+		size_t Count(const std::vector< std::string >& lines,
+					 const std::string& prefix) {
+			size_t count = 0u;
+			for (const auto& line : lines) {
+				if (0u == line.compare(0u, prefix.size(), prefix)) {
+					++count;
+				}
+			}
+			return count;
+		}
+	}
+
+	MAGE_TEST(LoggerFlushesMessages) {
+		{
+			Logger logger;
+			logger.AddFileSink(GetLogPath());
+
+			Log(logger, LogSeverity::Info,    "Flush %d", 1);
+			Log(logger, LogSeverity::Warning, "Flush %d", 2);
+			logger.Flush();
+
+			auto lines = ReadLog();
+			MAGE_CHECK(2u == lines.size());
+			MAGE_CHECK(1u == Count(lines, "Info: Flush 1"));
+			MAGE_CHECK(1u == Count(lines, "Warning: Flush 2"));
+
+			// Errors are flushed before returning.
+			Log(logger, LogSeverity::Error, "Flush %d", 3);
+
+			lines = ReadLog();
+			MAGE_CHECK(3u == lines.size());
+			MAGE_CHECK(1u == Count(lines, "Error: Flush 3"));
+
+			// Messages logged after removing the file sinks are not written
+			// to the log file.
+			logger.RemoveFileSinks();
+			Log(logger, LogSeverity::Error, "Flush %d", 4);
+			MAGE_CHECK(3u == ReadLog().size());
+		}
+
+		std::filesystem::remove(GetLogPath());
+	}
+
+	MAGE_TEST(LoggerCollapsesRepeatedMessages) {
+		{
+			Logger logger;
+			logger.AddFileSink(GetLogPath());
+
+			for (U32 i = 0u; i < 10u; ++i) {
+				Log(logger, LogSeverity::Warning, "Repeated warning");
+				Log(logger, LogSeverity::Info,    "Repeated warning");
+			}
+			for (U32 i = 0u; i < 3u; ++i) {
+				Log(logger, LogSeverity::Error, "Repeated error");
+			}
+			logger.Flush();
+
+			const auto lines = ReadLog();
+
+			// The repetitions are reported at the end of each rate limit
+			// period (and on each flush), so the repetitions may be split
+			// over multiple reports.
+			const auto count = [&lines](const std::string& message) {
+				size_t nb_repetitions = 0u;
+				for (const auto& line : lines) {
+					if (line == message) {
+						++nb_repetitions;
+						continue;
+					}
+
+					const auto pos = line.find("(repeated ");
+					if (std::string::npos == pos
+						|| 0u != line.compare(0u, pos, message.substr(0u, pos))
+						|| line.substr(line.find(" times) ") + 8u)
+						   != message.substr(pos)) {
+						continue;
+					}
+
+					nb_repetitions += std::stoul(line.substr(pos + 10u));
+				}
+				return nb_repetitions;
+			};
+
+			// Each severity is collapsed separately.
+			MAGE_CHECK(10u == count("Warning: Repeated warning"));
+			MAGE_CHECK(10u == count("Info: Repeated warning"));
+			MAGE_CHECK(1u  <= Count(lines, "Warning: (repeated "));
+			// Errors are never collapsed.
+			MAGE_CHECK(3u  == Count(lines, "Error: Repeated error"));
+		}
+
+		std::filesystem::remove(GetLogPath());
+	}
+
+	MAGE_TEST(LoggerDropsMessagesIfTheQueueIsFull) {
+		constexpr U32 nb_messages = 16u * MAGE_LOGGER_QUEUE_SIZE;
+		{
+			Logger logger;
+			logger.AddFileSink(GetLogPath());
+
+			// Flood the queue faster than the logging thread writes to the
+			// console and the log file.
+			for (U32 i = 0u; i < nb_messages; ++i) {
+				Log(logger, LogSeverity::Debug, "Flood %u", i);
+			}
+			// Errors wait for a free slot instead.
+			Log(logger, LogSeverity::Error, "Flood done");
+
+			const auto nb_dropped = logger.GetNumberOfDroppedMessages();
+			const auto lines      = ReadLog();
+
+			MAGE_CHECK(0u < nb_dropped);
+			MAGE_CHECK(nb_messages == Count(lines, "Debug Info: Flood ")
+					                  + nb_dropped);
+			MAGE_CHECK(1u == Count(lines, "Error: Flood done"));
+
+			// All dropped messages are reported.
+			size_t nb_reported = 0u;
+			for (const auto& line : lines) {
+				if (0u == line.compare(0u, 9u, "Warning: ")
+					&& std::string::npos != line.find(" log messages dropped")) {
+					nb_reported += std::stoul(line.substr(9u));
+				}
+			}
+			MAGE_CHECK(nb_dropped == nb_reported);
+		}
+
+		std::filesystem::remove(GetLogPath());
+	}
+}
\ No newline at end of file
@@ -0,0 +1,172 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test\test.hpp"
+#include "renderer\mock_device_context.hpp"
+#include "renderer\binding_cache.hpp"
+#include "renderer\pipeline.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	using namespace rendering;
+
+	namespace {
+
+		ID3D11PixelShader* const g_ps[] = {
+			GetMockObject< ID3D11PixelShader >(0u),
+			GetMockObject< ID3D11PixelShader >(1u)
+		};
+
+		ID3D11ShaderResourceView* const g_srvs[] = {
+			GetMockObject< ID3D11ShaderResourceView >(2u),
+			GetMockObject< ID3D11ShaderResourceView >(3u)
+		};
+
+		ID3D11Buffer* const g_buffers[] = {
+			GetMockObject< ID3D11Buffer >(4u),
+			GetMockObject< ID3D11Buffer >(5u)
+		};
+
+		ID3D11RenderTargetView* const g_rtv
+			= GetMockObject< ID3D11RenderTargetView >(6u);
+
+		ID3D11BlendState* const g_blend_state
+			= GetMockObject< ID3D11BlendState >(7u);
+	}
+
+	MAGE_TEST(BindingCacheDetectsRedundantValues) {
+		BindingCache< int, 4u > cache;
+
+		// Invalidated slots always need to be bound.
+		MAGE_CHECK(cache.Update(0u, 0));
+		MAGE_CHECK(!cache.Update(0u, 0));
+		MAGE_CHECK(cache.Update(0u, 1));
+		MAGE_CHECK(!cache.Update(0u, 1));
+
+		const int values[] = { 1, 2, 3 };
+		MAGE_CHECK(cache.Update(0u, 3u, values));
+		MAGE_CHECK(!cache.Update(0u, 3u, values));
+		MAGE_CHECK(!cache.Update(1u, 2u, values + 1u));
+
+		// A single changed slot dirties the whole range.
+		const int changed[] = { 1, 2, 4 };
+		MAGE_CHECK(cache.Update(0u, 3u, changed));
+		MAGE_CHECK(!cache.Update(2u, 4));
+
+		cache.Invalidate();
+		MAGE_CHECK(cache.Update(0u, 1));
+		MAGE_CHECK(cache.Update(1u, 2u, values + 1u));
+	}
+
+	MAGE_TEST(PipelineFiltersRedundantBindings) {
+		MockDeviceContext device_context;
+		Pipeline::ResetStateCache(device_context);
+
+		const auto nb_bindings           = Pipeline::s_nb_bindings;
+		const auto nb_redundant_bindings = Pipeline::s_nb_redundant_bindings;
+
+		Pipeline::PS::BindShader(device_context, g_ps[0]);
+		Pipeline::PS::BindShader(device_context, g_ps[0]);
+		MAGE_CHECK(1u == device_context.GetNumberOfCalls("PSSetShader"));
+		Pipeline::PS::BindShader(device_context, g_ps[1]);
+		Pipeline::PS::BindShader(device_context, nullptr);
+		Pipeline::PS::BindShader(device_context, nullptr);
+		MAGE_CHECK(3u == device_context.GetNumberOfCalls("PSSetShader"));
+
+		ID3D11ShaderResourceView* const srvs[] = { g_srvs[0], g_srvs[1] };
+		Pipeline::PS::BindSRVs(device_context, 0u, 2u, srvs);
+		Pipeline::PS::BindSRVs(device_context, 0u, 2u, srvs);
+		Pipeline::PS::BindSRV(device_context, 1u, g_srvs[1]);
+		MAGE_CHECK(1u == device_context.GetNumberOfCalls("PSSetShaderResources"));
+
+		// Each stage has its own slots.
+		Pipeline::VS::BindSRV(device_context, 0u, g_srvs[0]);
+		MAGE_CHECK(1u == device_context.GetNumberOfCalls("VSSetShaderResources"));
+
+		Pipeline::IA::BindVertexBuffer(device_context, 0u, *g_buffers[0], 32u);
+		Pipeline::IA::BindVertexBuffer(device_context, 0u, *g_buffers[0], 32u);
+		Pipeline::IA::BindVertexBuffer(device_context, 0u, *g_buffers[0], 16u);
+		MAGE_CHECK(2u == device_context.GetNumberOfCalls("IASetVertexBuffers"));
+
+		Pipeline::IA::BindPrimitiveTopology(device_context,
+			D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+		Pipeline::IA::BindPrimitiveTopology(device_context,
+			D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+		MAGE_CHECK(1u == device_context.GetNumberOfCalls("IASetPrimitiveTopology"));
+
+		F32 blend_factor[] = { 1.0f, 1.0f, 1.0f, 1.0f };
+		Pipeline::OM::BindBlendState(device_context, g_blend_state);
+		Pipeline::OM::BindBlendState(device_context, g_blend_state, blend_factor);
+		blend_factor[0] = 0.5f;
+		Pipeline::OM::BindBlendState(device_context, g_blend_state, blend_factor);
+		MAGE_CHECK(2u == device_context.GetNumberOfCalls("OMSetBlendState"));
+
+		Pipeline::OM::BindDepthStencilState(device_context, nullptr, 0u);
+		Pipeline::OM::BindDepthStencilState(device_context, nullptr, 1u);
+		MAGE_CHECK(2u == device_context.GetNumberOfCalls("OMSetDepthStencilState"));
+
+		MAGE_CHECK(device_context.GetNumberOfCalls()
+				   == Pipeline::s_nb_bindings - nb_bindings);
+		MAGE_CHECK(7u == Pipeline::s_nb_redundant_bindings - nb_redundant_bindings);
+	}
+
+	MAGE_TEST(PipelineFlushesDirtyBindings) {
+		MockDeviceContext device_context;
+		Pipeline::ResetStateCache(device_context);
+
+		Pipeline::PS::BindShader(device_context, g_ps[0]);
+		Pipeline::PS::BindSRV(device_context, 0u, g_srvs[0]);
+		Pipeline::PS::BindConstantBuffer(device_context, 0u, g_buffers[0]);
+		Pipeline::IA::BindVertexBuffer(device_context, 0u, *g_buffers[1], 32u);
+		device_context.ClearCalls();
+
+		// Binding an output view unbinds the hazarding input views and
+		// vertex buffers, so their slots must be bound again.
+		Pipeline::OM::BindRTVAndDSV(device_context, g_rtv, nullptr);
+		Pipeline::PS::BindShader(device_context, g_ps[0]);
+		Pipeline::PS::BindSRV(device_context, 0u, g_srvs[0]);
+		Pipeline::PS::BindConstantBuffer(device_context, 0u, g_buffers[0]);
+		Pipeline::IA::BindVertexBuffer(device_context, 0u, *g_buffers[1], 32u);
+		MAGE_CHECK(0u == device_context.GetNumberOfCalls("PSSetShader"));
+		MAGE_CHECK(1u == device_context.GetNumberOfCalls("PSSetShaderResources"));
+		MAGE_CHECK(0u == device_context.GetNumberOfCalls("PSSetConstantBuffers"));
+		MAGE_CHECK(1u == device_context.GetNumberOfCalls("IASetVertexBuffers"));
+
+		// Invalidating the state cache makes every slot dirty.
+		device_context.ClearCalls();
+		Pipeline::InvalidateStateCache();
+		Pipeline::PS::BindShader(device_context, g_ps[0]);
+		Pipeline::PS::BindSRV(device_context, 0u, g_srvs[0]);
+		Pipeline::PS::BindConstantBuffer(device_context, 0u, g_buffers[0]);
+		MAGE_CHECK(3u == device_context.GetNumberOfCalls());
+
+		// Shaders with class instances are always bound and dirty the slot.
+		device_context.ClearCalls();
+		ID3D11ClassInstance* const class_instances[] = {
+			GetMockObject< ID3D11ClassInstance >(8u)
+		};
+		Pipeline::PS::BindShader(device_context, g_ps[0], class_instances, 1u);
+		Pipeline::PS::BindShader(device_context, g_ps[0]);
+		MAGE_CHECK(2u == device_context.GetNumberOfCalls("PSSetShader"));
+	}
+
+	MAGE_TEST(PipelineBypassesTheCacheForOtherDeviceContexts) {
+		MockDeviceContext device_context;
+		MockDeviceContext other_device_context;
+		Pipeline::ResetStateCache(device_context);
+
+		Pipeline::PS::BindShader(device_context, g_ps[0]);
+		Pipeline::PS::BindShader(other_device_context, g_ps[0]);
+		Pipeline::PS::BindShader(other_device_context, g_ps[0]);
+		Pipeline::PS::BindShader(device_context, g_ps[0]);
+		MAGE_CHECK(1u == device_context.GetNumberOfCalls());
+		MAGE_CHECK(2u == other_device_context.GetNumberOfCalls());
+	}
+}
\ No newline at end of file
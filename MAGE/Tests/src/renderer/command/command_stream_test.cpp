@@ -0,0 +1,378 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test\test.hpp"
+#include "renderer\mock_device_context.hpp"
+#include "renderer\command\command_recorder.hpp"
+#include "renderer\command\command_replayer.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	using namespace rendering;
+
+	namespace {
+
+		/**
+		 A struct of callback data for checking the position of a callback
+		 in the replayed calls.
+		 */
+		struct CallbackData final {
+
+		public:
+
+			/**
+			 A pointer to the device context the calls are replayed to.
+			 */
+			const MockDeviceContext* m_device_context;
+
+			/**
+			 The number of calls replayed before the callback.
+			 */
+			size_t m_nb_calls;
+		};
+
+		/**
+		 Stores the number of calls replayed before this callback.
+
+		 @param[in]		data
+						A pointer to the callback data.
+		 */
+		void StoreNumberOfCalls(void* data) noexcept {
+			auto& callback_data = *static_cast< CallbackData* >(data);
+			callback_data.m_nb_calls
+				= callback_data.m_device_context->GetNumberOfCalls();
+		}
+
+		/**
+		 Issues a frame of calls to the given device context. The calls
+		 cover all recorded methods of command recorders, except for
+		 mapping buffers and updating subresources, since command
+		 recorders query the descriptors of the mapped and updated
+		 resources.
+
+		 @param[in]		device_context
+						A reference to the device context.
+		 */
+		void IssueCalls(ID3D11DeviceContext& device_context) {
+			ID3D11Buffer* const buffers[] = {
+				GetMockObject< ID3D11Buffer >(0u),
+				nullptr,
+				GetMockObject< ID3D11Buffer >(1u)
+			};
+			ID3D11ShaderResourceView* const srvs[] = {
+				GetMockObject< ID3D11ShaderResourceView >(2u),
+				GetMockObject< ID3D11ShaderResourceView >(3u)
+			};
+			ID3D11SamplerState* const samplers[] = {
+				GetMockObject< ID3D11SamplerState >(4u)
+			};
+			ID3D11UnorderedAccessView* const uavs[] = {
+				GetMockObject< ID3D11UnorderedAccessView >(5u),
+				GetMockObject< ID3D11UnorderedAccessView >(6u)
+			};
+			ID3D11RenderTargetView* const rtvs[] = {
+				GetMockObject< ID3D11RenderTargetView >(7u),
+				GetMockObject< ID3D11RenderTargetView >(8u)
+			};
+			const auto dsv = GetMockObject< ID3D11DepthStencilView >(9u);
+
+			const UINT strides[]        = { 32u, 0u, 12u };
+			const UINT offsets[]        = { 0u, 0u, 256u };
+			const UINT initial_counts[] = { 0u, 0xFFFFFFFFu };
+
+			const D3D11_VIEWPORT viewports[] = {
+				{ 0.0f,   0.0f, 1920.0f, 1080.0f, 0.0f, 1.0f },
+				{ 16.0f, 32.0f,  640.0f,  360.0f, 0.5f, 1.0f }
+			};
+			const D3D11_RECT rectangles[] = {
+				{ 0, 0, 1920, 1080 }
+			};
+
+			const FLOAT blend_factor[] = { 0.25f, 0.5f, 0.75f, 1.0f };
+			const FLOAT color[]        = { 0.0f, 0.1f, 0.2f, 1.0f };
+			const UINT  uint_values[]  = { 1u, 2u, 3u, 4u };
+			const FLOAT float_values[] = { 0.5f, 0.0f, -1.0f, 2.0f };
+
+			// Forward pass
+			device_context.IASetInputLayout(GetMockObject< ID3D11InputLayout >(10u));
+			device_context.IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+			device_context.IASetVertexBuffers(0u, 3u, buffers, strides, offsets);
+			device_context.IASetIndexBuffer(buffers[0], DXGI_FORMAT_R32_UINT, 64u);
+			device_context.VSSetShader(GetMockObject< ID3D11VertexShader >(11u), nullptr, 0u);
+			device_context.VSSetConstantBuffers(1u, 3u, buffers);
+			device_context.VSSetShaderResources(0u, 1u, srvs);
+			device_context.VSSetSamplers(2u, 1u, samplers);
+			device_context.HSSetShader(GetMockObject< ID3D11HullShader >(12u), nullptr, 0u);
+			device_context.HSSetConstantBuffers(0u, 1u, buffers);
+			device_context.HSSetShaderResources(0u, 2u, srvs);
+			device_context.HSSetSamplers(0u, 1u, samplers);
+			device_context.DSSetShader(GetMockObject< ID3D11DomainShader >(13u), nullptr, 0u);
+			device_context.DSSetConstantBuffers(0u, 1u, buffers + 2u);
+			device_context.DSSetShaderResources(3u, 1u, srvs + 1u);
+			device_context.DSSetSamplers(0u, 1u, samplers);
+			device_context.GSSetShader(GetMockObject< ID3D11GeometryShader >(14u), nullptr, 0u);
+			device_context.GSSetConstantBuffers(0u, 2u, buffers);
+			device_context.GSSetShaderResources(0u, 2u, srvs);
+			device_context.GSSetSamplers(1u, 1u, samplers);
+			device_context.RSSetState(GetMockObject< ID3D11RasterizerState >(15u));
+			device_context.RSSetViewports(2u, viewports);
+			device_context.RSSetScissorRects(1u, rectangles);
+			device_context.PSSetShader(GetMockObject< ID3D11PixelShader >(16u), nullptr, 0u);
+			device_context.PSSetConstantBuffers(0u, 3u, buffers);
+			device_context.PSSetShaderResources(0u, 2u, srvs);
+			device_context.PSSetSamplers(0u, 1u, samplers);
+			device_context.OMSetBlendState(GetMockObject< ID3D11BlendState >(17u),
+				                           blend_factor, 0xFFFFFFFFu);
+			device_context.OMSetBlendState(nullptr, nullptr, 0x0000FFFFu);
+			device_context.OMSetDepthStencilState(
+				GetMockObject< ID3D11DepthStencilState >(18u), 3u);
+			device_context.OMSetRenderTargets(2u, rtvs, dsv);
+			device_context.ClearRenderTargetView(rtvs[0], color);
+			device_context.ClearDepthStencilView(dsv, D3D11_CLEAR_DEPTH | D3D11_CLEAR_STENCIL,
+				                                 0.0f, 7u);
+			device_context.Draw(3u, 0u);
+			device_context.DrawIndexed(36u, 6u, -4);
+			device_context.DrawInstanced(4u, 100u, 0u, 8u);
+			device_context.DrawIndexedInstanced(36u, 10u, 0u, 2, 1u);
+			device_context.DrawAuto();
+			device_context.DrawInstancedIndirect(buffers[2], 16u);
+			device_context.DrawIndexedInstancedIndirect(buffers[2], 32u);
+
+			// Unbind the render targets and bind unordered access views.
+			device_context.OMSetRenderTargets(0u, nullptr, nullptr);
+			device_context.OMSetRenderTargetsAndUnorderedAccessViews(
+				1u, rtvs, nullptr, 1u, 2u, uavs, initial_counts);
+			device_context.OMSetRenderTargetsAndUnorderedAccessViews(
+				D3D11_KEEP_RENDER_TARGETS_AND_DEPTH_STENCIL, nullptr, nullptr,
+				1u, 1u, uavs + 1u, nullptr);
+			device_context.OMSetRenderTargetsAndUnorderedAccessViews(
+				2u, rtvs, dsv, 2u, D3D11_KEEP_UNORDERED_ACCESS_VIEWS,
+				nullptr, nullptr);
+			device_context.Draw(6u, 3u);
+
+			// Compute pass
+			device_context.CSSetShader(GetMockObject< ID3D11ComputeShader >(19u), nullptr, 0u);
+			device_context.CSSetConstantBuffers(0u, 1u, buffers);
+			device_context.CSSetShaderResources(0u, 2u, srvs);
+			device_context.CSSetSamplers(0u, 1u, samplers);
+			device_context.CSSetUnorderedAccessViews(0u, 2u, uavs, initial_counts);
+			device_context.CSSetUnorderedAccessViews(2u, 1u, uavs, nullptr);
+			device_context.ClearUnorderedAccessViewUint(uavs[0], uint_values);
+			device_context.ClearUnorderedAccessViewFloat(uavs[1], float_values);
+			device_context.Dispatch(16u, 8u, 1u);
+			device_context.DispatchIndirect(buffers[0], 48u);
+			device_context.CSSetShader(nullptr, nullptr, 0u);
+			device_context.GenerateMips(srvs[1]);
+		}
+		/**
+		 Maps the given buffer with the given device context, fills the
+		 given range of the mapped data with the given value and unmaps the
+		 buffer.
+
+		 @param[in]		device_context
+						A reference to the device context.
+		 @param[in]		buffer
+						A reference to the buffer.
+		 @param[in]		map_type
+						The map type.
+		 @param[in]		offset
+						The offset in bytes of the range to fill.
+		 @param[in]		size
+						The size in bytes of the range to fill.
+		 @param[in]		value
+						The value to fill the range with.
+		 @return		A copy of the mapped data before filling the range.
+		 */
+		std::vector< U8 > FillBuffer(ID3D11DeviceContext& device_context,
+									 MockBuffer& buffer, D3D11_MAP map_type,
+									 size_t offset, size_t size, U8 value) {
+
+			D3D11_BUFFER_DESC desc;
+			buffer.GetDesc(&desc);
+
+			D3D11_MAPPED_SUBRESOURCE mapped_buffer;
+			device_context.Map(&buffer, 0u, map_type, 0u, &mapped_buffer);
+			const auto data = static_cast< U8* >(mapped_buffer.pData);
+			std::vector< U8 > previous_data(data, data + desc.ByteWidth);
+			std::memset(data + offset, value, size);
+			device_context.Unmap(&buffer, 0u);
+
+			return previous_data;
+		}
+	}
+
+	MAGE_TEST(CommandStreamReplaysRecordedCalls) {
+		MockDeviceContext expected;
+		IssueCalls(expected);
+
+		CommandStream stream;
+		CommandRecorder recorder(*GetMockObject< ID3D11Device >(20u), stream);
+		IssueCalls(recorder);
+		MAGE_CHECK(expected.GetNumberOfCalls() == stream.GetNumberOfCommands());
+
+		MockDeviceContext device_context;
+		CommandReplayer replayer(device_context);
+		replayer.Replay(stream);
+		MAGE_CHECK(expected.GetNumberOfCalls() == device_context.GetNumberOfCalls());
+		MAGE_CHECK(expected.GetCalls() == device_context.GetCalls());
+
+		// A command stream can be replayed more than once.
+		device_context.ClearCalls();
+		replayer.Replay(stream);
+		MAGE_CHECK(expected.GetCalls() == device_context.GetCalls());
+
+		// Cleared command streams replay nothing.
+		stream.Clear();
+		MAGE_CHECK(stream.IsEmpty());
+		MAGE_CHECK(0u == stream.GetNumberOfCommands());
+		device_context.ClearCalls();
+		replayer.Replay(stream);
+		MAGE_CHECK(0u == device_context.GetNumberOfCalls());
+
+		// The command stream can be recorded again after clearing it.
+		IssueCalls(recorder);
+		replayer.Replay(stream);
+		MAGE_CHECK(expected.GetCalls() == device_context.GetCalls());
+	}
+
+	MAGE_TEST(CommandStreamReplaysUpdatesAndCallbacks) {
+		const auto buffer  = GetMockObject< ID3D11Buffer >(0u);
+		const auto texture = GetMockObject< ID3D11Texture2D >(1u);
+
+		U8 data[64u];
+		for (size_t i = 0u; i < sizeof(data); ++i) {
+			data[i] = static_cast< U8 >(i);
+		}
+		const CommandBox box = { 0u, 0u, 0u, 4u, 4u, 1u };
+
+		MockDeviceContext expected;
+		D3D11_MAPPED_SUBRESOURCE mapped_buffer;
+		expected.Map(buffer, 0u, D3D11_MAP_WRITE_DISCARD, 0u, &mapped_buffer);
+		expected.Unmap(buffer, 0u);
+		expected.Draw(3u, 0u);
+		expected.Map(buffer, 0u, D3D11_MAP_WRITE_NO_OVERWRITE, 0u, &mapped_buffer);
+		expected.Unmap(buffer, 0u);
+		expected.UpdateSubresource(texture, 1u,
+			reinterpret_cast< const D3D11_BOX* >(&box), data, 16u, 0u);
+		expected.UpdateSubresource(texture, 0u, nullptr, data, 16u, 64u);
+		expected.Draw(3u, 0u);
+
+		CommandStream stream;
+		CommandRecorder recorder(*GetMockObject< ID3D11Device >(2u), stream);
+		MockDeviceContext device_context;
+		CallbackData callback_data = { &device_context, 0u };
+
+		std::memcpy(stream.UpdateBuffer(buffer, 0u, 64u, false), data, 64u);
+		recorder.Draw(3u, 0u);
+		recorder.Callback(StoreNumberOfCalls, &callback_data);
+		std::memcpy(stream.UpdateBuffer(buffer, 16u, 32u, true), data, 32u);
+		stream.UpdateSubresource(texture, 1u, &box, data, 64u, 16u, 0u);
+		stream.UpdateSubresource(texture, 0u, nullptr, data, 64u, 16u, 64u);
+		recorder.Draw(3u, 0u);
+
+		CommandReplayer replayer(device_context);
+		replayer.Replay(stream);
+		MAGE_CHECK(expected.GetCalls() == device_context.GetCalls());
+		// The callback is called in command order.
+		MAGE_CHECK(3u == callback_data.m_nb_calls);
+	}
+
+	MAGE_TEST(CommandRecorderRecordsWrittenBufferRanges) {
+		static constexpr size_t s_size = 64u;
+
+		MockBuffer buffer(static_cast< U32 >(s_size));
+		CommandStream stream;
+		CommandRecorder recorder(*GetMockObject< ID3D11Device >(0u), stream);
+		MockDeviceContext device_context;
+		CommandReplayer replayer(device_context);
+		auto& memory = device_context.GetMappedData();
+
+		const auto Reset = [&]() {
+			stream.Clear();
+			device_context.ClearCalls();
+			std::fill(memory.begin(), memory.end(), U8(0xCD));
+		};
+		const auto IsFilled = [&memory](size_t begin, size_t end, U8 value) {
+			return std::all_of(memory.cbegin() + begin, memory.cbegin() + end,
+				[value](U8 byte) noexcept {
+					return value == byte;
+				});
+		};
+
+		D3D11_MAPPED_SUBRESOURCE mapped_buffer;
+
+		// The data of the buffer is not known yet: the whole buffer is
+		// recorded and the previous data is discarded.
+		Reset();
+		FillBuffer(recorder, buffer, D3D11_MAP_WRITE_NO_OVERWRITE, 0u, s_size, 1u);
+		replayer.Replay(stream);
+		{
+			MockDeviceContext expected;
+			expected.Map(&buffer, 0u, D3D11_MAP_WRITE_DISCARD, 0u, &mapped_buffer);
+			expected.Unmap(&buffer, 0u);
+			MAGE_CHECK(expected.GetCalls() == device_context.GetCalls());
+		}
+		MAGE_CHECK(IsFilled(0u, s_size, 1u));
+
+		// The shadow copy preserves the data: only the written range is
+		// recorded.
+		Reset();
+		{
+			const auto previous_data = FillBuffer(
+				recorder, buffer, D3D11_MAP_WRITE_NO_OVERWRITE, 20u, 8u, 2u);
+			MAGE_CHECK(std::all_of(previous_data.cbegin(), previous_data.cend(),
+				[](U8 byte) noexcept {
+					return 1u == byte;
+				}));
+		}
+		replayer.Replay(stream);
+		{
+			MockDeviceContext expected;
+			expected.Map(&buffer, 0u, D3D11_MAP_WRITE_NO_OVERWRITE, 0u, &mapped_buffer);
+			expected.Unmap(&buffer, 0u);
+			MAGE_CHECK(expected.GetCalls() == device_context.GetCalls());
+		}
+		MAGE_CHECK(IsFilled( 0u,     20u, 0xCD));
+		MAGE_CHECK(IsFilled(20u,     28u, 2u));
+		MAGE_CHECK(IsFilled(28u, s_size, 0xCD));
+
+		// Rewriting the same data records nothing.
+		Reset();
+		FillBuffer(recorder, buffer, D3D11_MAP_WRITE_NO_OVERWRITE, 16u, 4u, 1u);
+		MAGE_CHECK(stream.IsEmpty());
+
+		// Discarding the data updates the shadow copy.
+		Reset();
+		FillBuffer(recorder, buffer, D3D11_MAP_WRITE_DISCARD, 0u, s_size, 3u);
+		{
+			const auto previous_data = FillBuffer(
+				recorder, buffer, D3D11_MAP_WRITE_NO_OVERWRITE, s_size - 1u, 1u, 4u);
+			MAGE_CHECK(std::all_of(previous_data.cbegin(), previous_data.cend(),
+				[](U8 byte) noexcept {
+					return 3u == byte;
+				}));
+		}
+		replayer.Replay(stream);
+		MAGE_CHECK(4u == device_context.GetNumberOfCalls());
+		MAGE_CHECK(IsFilled(0u, s_size - 1u, 3u));
+		MAGE_CHECK(IsFilled(s_size - 1u, s_size, 4u));
+	}
+}
\ No newline at end of file
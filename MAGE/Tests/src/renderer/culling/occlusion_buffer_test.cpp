@@ -0,0 +1,235 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test\test.hpp"
+#include "renderer\culling\occlusion_buffer.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cmath>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	using namespace rendering;
+
+	namespace {
+
+		/**
+		 Checks whether the given values are approximately equal.
+
+		 @param[in]		lhs
+						The first value.
+		 @param[in]		rhs
+						The second value.
+		 @param[in]		epsilon
+						The relative tolerance.
+		 @return		@c true if the given values are approximately equal.
+						@c false otherwise.
+		 */
+		[[nodiscard]]
+		bool ApproximatelyEqual(F32 lhs, F32 rhs,
+			                    F32 epsilon = 0.0001f) noexcept {
+
+			return std::abs(lhs - rhs)
+				<= epsilon * std::max(1.0f, std::max(std::abs(lhs), std::abs(rhs)));
+		}
+
+		/**
+		 Returns the camera-to-projection transformation matrix of the
+		 tests. The aspect ratio matches the occlusion buffer and the
+		 vertical field of view is 90 degrees, so the camera-space point
+		 (x, y, z) maps to the pixel (128 + 64 x/z, 64 - 64 y/z).
+
+		 @return		The camera-to-projection transformation matrix.
+		 */
+		[[nodiscard]]
+		const XMMATRIX XM_CALLCONV GetCameraToProjection() noexcept {
+			return XMMatrixPerspectiveFovLH(
+				XM_PIDIV2,
+				static_cast< F32 >(OcclusionBuffer::s_width)
+					/ static_cast< F32 >(OcclusionBuffer::s_height),
+				0.1f, 1000.0f);
+		}
+
+		/**
+		 Rasterizes the given quad into the given occlusion buffer.
+
+		 @param[in,out]	buffer
+						A reference to the occlusion buffer.
+		 @param[in]		p0
+						The first vertex of the quad expressed in camera
+						space.
+		 @param[in]		p1
+						The second vertex of the quad expressed in camera
+						space.
+		 @param[in]		p2
+						The third vertex of the quad expressed in camera
+						space.
+		 @param[in]		p3
+						The fourth vertex of the quad expressed in camera
+						space.
+		 */
+		void RasterizeQuad(OcclusionBuffer& buffer,
+			               const F32x3& p0, const F32x3& p1,
+			               const F32x3& p2, const F32x3& p3) noexcept {
+
+			const auto camera_to_projection = GetCameraToProjection();
+			const auto v0 = XMVector3Transform(XMLoad(p0), camera_to_projection);
+			const auto v1 = XMVector3Transform(XMLoad(p1), camera_to_projection);
+			const auto v2 = XMVector3Transform(XMLoad(p2), camera_to_projection);
+			const auto v3 = XMVector3Transform(XMLoad(p3), camera_to_projection);
+
+			buffer.RasterizeTriangle(v0, v1, v2);
+			buffer.RasterizeTriangle(v0, v2, v3);
+		}
+
+		/**
+		 Rasterizes a wall parallel to the image plane into the given
+		 occlusion buffer.
+
+		 @param[in,out]	buffer
+						A reference to the occlusion buffer.
+		 @param[in]		min_x
+						The minimum camera-space x coordinate of the wall.
+		 @param[in]		max_x
+						The maximum camera-space x coordinate of the wall.
+		 @param[in]		z
+						The camera-space z coordinate of the wall.
+		 */
+		void RasterizeWall(OcclusionBuffer& buffer,
+			               F32 min_x, F32 max_x, F32 z) noexcept {
+
+			RasterizeQuad(buffer,
+				          { min_x, -1000.0f, z },
+				          { max_x, -1000.0f, z },
+				          { max_x,  1000.0f, z },
+				          { min_x,  1000.0f, z });
+		}
+
+		/**
+		 Checks whether the given camera-space box is occluded by the given
+		 occlusion buffer.
+
+		 @param[in]		buffer
+						A reference to the occlusion buffer.
+		 @param[in]		p_min
+						The minimum point of the box expressed in camera
+						space.
+		 @param[in]		p_max
+						The maximum point of the box expressed in camera
+						space.
+		 @return		@c true if the given box is occluded. @c false
+						otherwise.
+		 */
+		[[nodiscard]]
+		bool IsOccluded(const OcclusionBuffer& buffer,
+			            const Point3& p_min, const Point3& p_max) noexcept {
+
+			return buffer.IsOccluded(GetCameraToProjection(),
+				                     AABB(p_min, p_max));
+		}
+	}
+
+	MAGE_TEST(OcclusionBufferKeepsTheNearestDepth) {
+		OcclusionBuffer buffer;
+		buffer.Clear();
+		MAGE_CHECK(0.0f == buffer.GetDepth(0u, 0u));
+		MAGE_CHECK(0.0f == buffer.GetDepth(128u, 64u));
+
+		// The left half of the buffer (the pixel centers left of x = 128).
+		RasterizeWall(buffer, -1000.0f, 0.0f, 10.0f);
+		MAGE_CHECK(ApproximatelyEqual(0.1f, buffer.GetDepth(  0u,   0u)));
+		MAGE_CHECK(ApproximatelyEqual(0.1f, buffer.GetDepth(127u, 127u)));
+		MAGE_CHECK(0.0f == buffer.GetDepth(128u,  64u));
+		MAGE_CHECK(0.0f == buffer.GetDepth(255u, 127u));
+
+		// Farther triangles do not overwrite nearer ones.
+		RasterizeWall(buffer, -1000.0f, 1000.0f, 20.0f);
+		MAGE_CHECK(ApproximatelyEqual(0.1f,  buffer.GetDepth( 64u, 64u)));
+		MAGE_CHECK(ApproximatelyEqual(0.05f, buffer.GetDepth(192u, 64u)));
+
+		// Both faces are rasterized.
+		RasterizeQuad(buffer,
+			          { -1000.0f,  1000.0f, 5.0f },
+			          {  1000.0f,  1000.0f, 5.0f },
+			          {  1000.0f, -1000.0f, 5.0f },
+			          { -1000.0f, -1000.0f, 5.0f });
+		MAGE_CHECK(ApproximatelyEqual(0.2f, buffer.GetDepth( 64u, 64u)));
+		MAGE_CHECK(ApproximatelyEqual(0.2f, buffer.GetDepth(192u, 64u)));
+
+		buffer.Clear();
+		MAGE_CHECK(0.0f == buffer.GetDepth(64u, 64u));
+	}
+
+	MAGE_TEST(OcclusionBufferClipsAgainstTheNearPlane) {
+		OcclusionBuffer buffer;
+		buffer.Clear();
+
+		// Triangles behind the camera are not rasterized.
+		RasterizeQuad(buffer,
+			          { -1000.0f, -1000.0f, -10.0f },
+			          {  1000.0f, -1000.0f, -10.0f },
+			          {  1000.0f,  1000.0f, -10.0f },
+			          { -1000.0f,  1000.0f, -10.0f });
+		for (U32 y = 0u; y < OcclusionBuffer::s_height; ++y) {
+			for (U32 x = 0u; x < OcclusionBuffer::s_width; ++x) {
+				MAGE_CHECK(0.0f == buffer.GetDepth(x, y));
+			}
+		}
+
+		// A floor (y = -1) extending behind the camera covers the pixels
+		// below the horizon. The pixel centers at y + 0.5 = 64 + 64/z have
+		// the depth 1/z.
+		RasterizeQuad(buffer,
+			          { -1000.0f, -1.0f,  -10.0f },
+			          {  1000.0f, -1.0f,  -10.0f },
+			          {  1000.0f, -1.0f, 1000.0f },
+			          { -1000.0f, -1.0f, 1000.0f });
+		MAGE_CHECK(0.0f == buffer.GetDepth(128u, 32u));
+		MAGE_CHECK(0.0f == buffer.GetDepth(128u, 63u));
+		MAGE_CHECK(ApproximatelyEqual(32.5f / 64.0f,
+			                          buffer.GetDepth(128u, 96u), 0.001f));
+		MAGE_CHECK(ApproximatelyEqual(63.5f / 64.0f,
+			                          buffer.GetDepth(  0u, 127u), 0.001f));
+	}
+
+	MAGE_TEST(OcclusionBufferTestsBoxesAgainstTheDepth) {
+		OcclusionBuffer buffer;
+		buffer.Clear();
+		RasterizeWall(buffer, -1000.0f, 1000.0f, 10.0f);
+		buffer.BuildHiZ();
+
+		MAGE_CHECK( IsOccluded(buffer, { -1.0f, -1.0f, 20.0f }, { 1.0f, 1.0f, 21.0f }));
+		MAGE_CHECK(!IsOccluded(buffer, { -1.0f, -1.0f,  5.0f }, { 1.0f, 1.0f,  6.0f }));
+		// Boxes intersecting the occluders are visible.
+		MAGE_CHECK(!IsOccluded(buffer, { -1.0f, -1.0f,  9.0f }, { 1.0f, 1.0f, 11.0f }));
+		// Boxes containing the camera are visible.
+		MAGE_CHECK(!IsOccluded(buffer, { -1.0f, -1.0f, -1.0f }, { 1.0f, 1.0f,  1.0f }));
+		// Boxes outside the view frustum are not tested.
+		MAGE_CHECK(!IsOccluded(buffer, { 100.0f, -1.0f, 20.0f }, { 110.0f, 1.0f, 21.0f }));
+		// Empty boxes are not tested.
+		MAGE_CHECK(!buffer.IsOccluded(GetCameraToProjection(), AABB()));
+
+		// Only the left half of the buffer is occluded.
+		buffer.Clear();
+		RasterizeWall(buffer, -1000.0f, 0.0f, 10.0f);
+		buffer.BuildHiZ();
+
+		MAGE_CHECK( IsOccluded(buffer, { -10.0f, -1.0f, 20.0f }, { -5.0f, 1.0f, 21.0f }));
+		MAGE_CHECK(!IsOccluded(buffer, {   5.0f, -1.0f, 20.0f }, { 10.0f, 1.0f, 21.0f }));
+		MAGE_CHECK(!IsOccluded(buffer, {  -5.0f, -1.0f, 20.0f }, {  5.0f, 1.0f, 21.0f }));
+	}
+}
\ No newline at end of file
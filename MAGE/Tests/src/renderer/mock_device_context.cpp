@@ -0,0 +1,920 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\mock_device_context.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	//-------------------------------------------------------------------------
+	// MockBuffer
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	MockBuffer::MockBuffer(U32 size) noexcept
+		: m_size(size) {}
+
+	MockBuffer::~MockBuffer() = default;
+
+	HRESULT STDMETHODCALLTYPE MockBuffer::QueryInterface(REFIID, void** object) {
+		*object = nullptr;
+		return E_NOINTERFACE;
+	}
+
+	ULONG STDMETHODCALLTYPE MockBuffer::AddRef() {
+		return 1u;
+	}
+
+	ULONG STDMETHODCALLTYPE MockBuffer::Release() {
+		return 1u;
+	}
+
+	void STDMETHODCALLTYPE MockBuffer::GetDevice(ID3D11Device** device) {
+		*device = nullptr;
+	}
+
+	HRESULT STDMETHODCALLTYPE MockBuffer
+		::GetPrivateData(REFGUID, UINT*, void*) {
+
+		return E_NOTIMPL;
+	}
+
+	HRESULT STDMETHODCALLTYPE MockBuffer
+		::SetPrivateData(REFGUID, UINT, const void*) {
+
+		return E_NOTIMPL;
+	}
+
+	HRESULT STDMETHODCALLTYPE MockBuffer
+		::SetPrivateDataInterface(REFGUID, const IUnknown*) {
+
+		return E_NOTIMPL;
+	}
+
+	void STDMETHODCALLTYPE MockBuffer
+		::GetType(D3D11_RESOURCE_DIMENSION* dimension) {
+
+		*dimension = D3D11_RESOURCE_DIMENSION_BUFFER;
+	}
+
+	void STDMETHODCALLTYPE MockBuffer::SetEvictionPriority(UINT) {}
+
+	UINT STDMETHODCALLTYPE MockBuffer::GetEvictionPriority() {
+		return 0u;
+	}
+
+	void STDMETHODCALLTYPE MockBuffer::GetDesc(D3D11_BUFFER_DESC* desc) {
+		*desc = {};
+		desc->ByteWidth      = m_size;
+		desc->Usage          = D3D11_USAGE_DYNAMIC;
+		desc->CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+	}
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// MockDeviceContext
+	//-------------------------------------------------------------------------
+
+	MockDeviceContext::MockDeviceContext()
+		: m_calls(),
+		m_mapped_data(1u << 16u) {}
+
+	MockDeviceContext::~MockDeviceContext() = default;
+
+	[[nodiscard]]
+	size_t MockDeviceContext::GetNumberOfCalls(const char* name) const noexcept {
+		return static_cast< size_t >(std::count_if(m_calls.cbegin(), m_calls.cend(),
+			[name](const MockCall& call) noexcept {
+				return call.m_name == name;
+			}));
+	}
+
+	//-------------------------------------------------------------------------
+	// MockDeviceContext: IUnknown
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	HRESULT STDMETHODCALLTYPE MockDeviceContext
+		::QueryInterface(REFIID, void** object) {
+
+		*object = nullptr;
+		return E_NOINTERFACE;
+	}
+
+	ULONG STDMETHODCALLTYPE MockDeviceContext::AddRef() {
+		return 1u;
+	}
+
+	ULONG STDMETHODCALLTYPE MockDeviceContext::Release() {
+		return 1u;
+	}
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// MockDeviceContext: ID3D11DeviceChild
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	void STDMETHODCALLTYPE MockDeviceContext::GetDevice(ID3D11Device** device) {
+		*device = nullptr;
+	}
+
+	HRESULT STDMETHODCALLTYPE MockDeviceContext
+		::GetPrivateData(REFGUID, UINT*, void*) {
+
+		return E_NOTIMPL;
+	}
+
+	HRESULT STDMETHODCALLTYPE MockDeviceContext
+		::SetPrivateData(REFGUID, UINT, const void*) {
+
+		return E_NOTIMPL;
+	}
+
+	HRESULT STDMETHODCALLTYPE MockDeviceContext
+		::SetPrivateDataInterface(REFGUID, const IUnknown*) {
+
+		return E_NOTIMPL;
+	}
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// MockDeviceContext: ID3D11DeviceContext (Recorded)
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::VSSetShader(ID3D11VertexShader* shader, ID3D11ClassInstance* const* class_instances,
+		                UINT nb_class_instances) {
+
+		Record("VSSetShader", shader, Elements(class_instances, nb_class_instances));
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::VSSetConstantBuffers(UINT slot, UINT nb_buffers, ID3D11Buffer* const* buffers) {
+
+		Record("VSSetConstantBuffers", slot, Elements(buffers, nb_buffers));
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::VSSetShaderResources(UINT slot, UINT nb_srvs, ID3D11ShaderResourceView* const* srvs) {
+
+		Record("VSSetShaderResources", slot, Elements(srvs, nb_srvs));
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::VSSetSamplers(UINT slot, UINT nb_samplers, ID3D11SamplerState* const* samplers) {
+
+		Record("VSSetSamplers", slot, Elements(samplers, nb_samplers));
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::HSSetShader(ID3D11HullShader* shader, ID3D11ClassInstance* const* class_instances,
+		                UINT nb_class_instances) {
+
+		Record("HSSetShader", shader, Elements(class_instances, nb_class_instances));
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::HSSetConstantBuffers(UINT slot, UINT nb_buffers, ID3D11Buffer* const* buffers) {
+
+		Record("HSSetConstantBuffers", slot, Elements(buffers, nb_buffers));
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::HSSetShaderResources(UINT slot, UINT nb_srvs, ID3D11ShaderResourceView* const* srvs) {
+
+		Record("HSSetShaderResources", slot, Elements(srvs, nb_srvs));
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::HSSetSamplers(UINT slot, UINT nb_samplers, ID3D11SamplerState* const* samplers) {
+
+		Record("HSSetSamplers", slot, Elements(samplers, nb_samplers));
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::DSSetShader(ID3D11DomainShader* shader, ID3D11ClassInstance* const* class_instances,
+		                UINT nb_class_instances) {
+
+		Record("DSSetShader", shader, Elements(class_instances, nb_class_instances));
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::DSSetConstantBuffers(UINT slot, UINT nb_buffers, ID3D11Buffer* const* buffers) {
+
+		Record("DSSetConstantBuffers", slot, Elements(buffers, nb_buffers));
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::DSSetShaderResources(UINT slot, UINT nb_srvs, ID3D11ShaderResourceView* const* srvs) {
+
+		Record("DSSetShaderResources", slot, Elements(srvs, nb_srvs));
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::DSSetSamplers(UINT slot, UINT nb_samplers, ID3D11SamplerState* const* samplers) {
+
+		Record("DSSetSamplers", slot, Elements(samplers, nb_samplers));
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::GSSetShader(ID3D11GeometryShader* shader, ID3D11ClassInstance* const* class_instances,
+		                UINT nb_class_instances) {
+
+		Record("GSSetShader", shader, Elements(class_instances, nb_class_instances));
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::GSSetConstantBuffers(UINT slot, UINT nb_buffers, ID3D11Buffer* const* buffers) {
+
+		Record("GSSetConstantBuffers", slot, Elements(buffers, nb_buffers));
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::GSSetShaderResources(UINT slot, UINT nb_srvs, ID3D11ShaderResourceView* const* srvs) {
+
+		Record("GSSetShaderResources", slot, Elements(srvs, nb_srvs));
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::GSSetSamplers(UINT slot, UINT nb_samplers, ID3D11SamplerState* const* samplers) {
+
+		Record("GSSetSamplers", slot, Elements(samplers, nb_samplers));
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::PSSetShader(ID3D11PixelShader* shader, ID3D11ClassInstance* const* class_instances,
+		                UINT nb_class_instances) {
+
+		Record("PSSetShader", shader, Elements(class_instances, nb_class_instances));
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::PSSetConstantBuffers(UINT slot, UINT nb_buffers, ID3D11Buffer* const* buffers) {
+
+		Record("PSSetConstantBuffers", slot, Elements(buffers, nb_buffers));
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::PSSetShaderResources(UINT slot, UINT nb_srvs, ID3D11ShaderResourceView* const* srvs) {
+
+		Record("PSSetShaderResources", slot, Elements(srvs, nb_srvs));
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::PSSetSamplers(UINT slot, UINT nb_samplers, ID3D11SamplerState* const* samplers) {
+
+		Record("PSSetSamplers", slot, Elements(samplers, nb_samplers));
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::CSSetShader(ID3D11ComputeShader* shader, ID3D11ClassInstance* const* class_instances,
+		                UINT nb_class_instances) {
+
+		Record("CSSetShader", shader, Elements(class_instances, nb_class_instances));
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::CSSetConstantBuffers(UINT slot, UINT nb_buffers, ID3D11Buffer* const* buffers) {
+
+		Record("CSSetConstantBuffers", slot, Elements(buffers, nb_buffers));
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::CSSetShaderResources(UINT slot, UINT nb_srvs, ID3D11ShaderResourceView* const* srvs) {
+
+		Record("CSSetShaderResources", slot, Elements(srvs, nb_srvs));
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::CSSetSamplers(UINT slot, UINT nb_samplers, ID3D11SamplerState* const* samplers) {
+
+		Record("CSSetSamplers", slot, Elements(samplers, nb_samplers));
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::CSSetUnorderedAccessViews(UINT slot, UINT nb_uavs, ID3D11UnorderedAccessView* const* uavs,
+		                              const UINT* initial_counts) {
+
+		Record("CSSetUnorderedAccessViews", slot, Elements(uavs, nb_uavs), Elements(initial_counts, nb_uavs));
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::IASetInputLayout(ID3D11InputLayout* input_layout) {
+
+		Record("IASetInputLayout", input_layout);
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::IASetVertexBuffers(UINT slot, UINT nb_buffers, ID3D11Buffer* const* buffers,
+		                       const UINT* strides, const UINT* offsets) {
+
+		Record("IASetVertexBuffers", slot, Elements(buffers, nb_buffers), Elements(strides, nb_buffers), Elements(offsets, nb_buffers));
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::IASetIndexBuffer(ID3D11Buffer* buffer, DXGI_FORMAT format, UINT offset) {
+
+		Record("IASetIndexBuffer", buffer, format, offset);
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY topology) {
+
+		Record("IASetPrimitiveTopology", topology);
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::RSSetState(ID3D11RasterizerState* state) {
+
+		Record("RSSetState", state);
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::RSSetViewports(UINT nb_viewports, const D3D11_VIEWPORT* viewports) {
+
+		Record("RSSetViewports", Elements(viewports, nb_viewports));
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::RSSetScissorRects(UINT nb_rects, const D3D11_RECT* rects) {
+
+		Record("RSSetScissorRects", Elements(rects, nb_rects));
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::OMSetRenderTargets(UINT nb_rtvs, ID3D11RenderTargetView* const* rtvs,
+		                       ID3D11DepthStencilView* dsv) {
+
+		Record("OMSetRenderTargets", Elements(rtvs, nb_rtvs), dsv);
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::OMSetRenderTargetsAndUnorderedAccessViews(UINT nb_rtvs, ID3D11RenderTargetView* const* rtvs,
+		  ID3D11DepthStencilView* dsv, UINT uav_slot, UINT nb_uavs,
+		  ID3D11UnorderedAccessView* const* uavs, const UINT* initial_counts) {
+
+		// D3D11_KEEP_RENDER_TARGETS_AND_DEPTH_STENCIL and D3D11_KEEP_UNORDERED_ACCESS_VIEWS
+		// are larger than any valid number of views.
+		const auto nb_recorded_rtvs = std::min(nb_rtvs, 8u);
+		const auto nb_recorded_uavs = std::min(nb_uavs, 64u);
+		Record("OMSetRenderTargetsAndUnorderedAccessViews", nb_rtvs, Elements(rtvs, nb_recorded_rtvs), dsv, uav_slot, nb_uavs, Elements(uavs, nb_recorded_uavs), Elements(initial_counts, nb_recorded_uavs));
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::OMSetBlendState(ID3D11BlendState* state, const FLOAT blend_factor[4],
+		                    UINT sample_mask) {
+
+		Record("OMSetBlendState", state, Elements(blend_factor, 4u), sample_mask);
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::OMSetDepthStencilState(ID3D11DepthStencilState* state, UINT stencil_ref) {
+
+		Record("OMSetDepthStencilState", state, stencil_ref);
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::SOSetTargets(UINT nb_buffers, ID3D11Buffer* const* buffers, const UINT* offsets) {
+
+		Record("SOSetTargets", Elements(buffers, nb_buffers), Elements(offsets, nb_buffers));
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::Draw(UINT nb_vertices, UINT start_vertex) {
+
+		Record("Draw", nb_vertices, start_vertex);
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::DrawIndexed(UINT nb_indices, UINT start_index, INT base_vertex) {
+
+		Record("DrawIndexed", nb_indices, start_index, base_vertex);
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::DrawInstanced(UINT nb_vertices, UINT nb_instances, UINT start_vertex,
+		                  UINT start_instance) {
+
+		Record("DrawInstanced", nb_vertices, nb_instances, start_vertex, start_instance);
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::DrawIndexedInstanced(UINT nb_indices, UINT nb_instances, UINT start_index,
+		                         INT base_vertex, UINT start_instance) {
+
+		Record("DrawIndexedInstanced", nb_indices, nb_instances, start_index, base_vertex, start_instance);
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::DrawAuto() {
+
+		Record("DrawAuto");
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::DrawInstancedIndirect(ID3D11Buffer* buffer, UINT offset) {
+
+		Record("DrawInstancedIndirect", buffer, offset);
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::DrawIndexedInstancedIndirect(ID3D11Buffer* buffer, UINT offset) {
+
+		Record("DrawIndexedInstancedIndirect", buffer, offset);
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::Dispatch(UINT nb_groups_x, UINT nb_groups_y, UINT nb_groups_z) {
+
+		Record("Dispatch", nb_groups_x, nb_groups_y, nb_groups_z);
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::DispatchIndirect(ID3D11Buffer* buffer, UINT offset) {
+
+		Record("DispatchIndirect", buffer, offset);
+	}
+
+	HRESULT STDMETHODCALLTYPE MockDeviceContext
+		::Map(ID3D11Resource* resource, UINT subresource, D3D11_MAP map_type,
+		        UINT map_flags, D3D11_MAPPED_SUBRESOURCE* mapped_resource) {
+
+		Record("Map", resource, subresource, map_type, map_flags);
+
+		mapped_resource->pData      = m_mapped_data.data();
+		mapped_resource->RowPitch   = static_cast< UINT >(m_mapped_data.size());
+		mapped_resource->DepthPitch = static_cast< UINT >(m_mapped_data.size());
+		
+		return S_OK;
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::Unmap(ID3D11Resource* resource, UINT subresource) {
+
+		Record("Unmap", resource, subresource);
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::Begin(ID3D11Asynchronous* async) {
+
+		Record("Begin", async);
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::End(ID3D11Asynchronous* async) {
+
+		Record("End", async);
+	}
+
+	HRESULT STDMETHODCALLTYPE MockDeviceContext
+		::GetData(ID3D11Asynchronous*, void*, UINT, UINT) {
+
+		return E_NOTIMPL;
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::SetPredication(ID3D11Predicate* predicate, BOOL value) {
+
+		Record("SetPredication", predicate, value);
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::CopySubresourceRegion(ID3D11Resource* dst, UINT dst_subresource, UINT dst_x,
+		  UINT dst_y, UINT dst_z, ID3D11Resource* src, UINT src_subresource,
+		  const D3D11_BOX* src_box) {
+
+		Record("CopySubresourceRegion", dst, dst_subresource, dst_x, dst_y, dst_z, src, src_subresource, Elements(src_box, 1u));
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::CopyResource(ID3D11Resource* dst, ID3D11Resource* src) {
+
+		Record("CopyResource", dst, src);
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::UpdateSubresource(ID3D11Resource* dst, UINT dst_subresource,
+		  const D3D11_BOX* dst_box, const void*, UINT, UINT) {
+
+		Record("UpdateSubresource", dst, dst_subresource, Elements(dst_box, 1u));
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::CopyStructureCount(ID3D11Buffer* dst, UINT dst_offset,
+		                       ID3D11UnorderedAccessView* src) {
+
+		Record("CopyStructureCount", dst, dst_offset, src);
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::ClearRenderTargetView(ID3D11RenderTargetView* rtv, const FLOAT color[4]) {
+
+		Record("ClearRenderTargetView", rtv, Elements(color, 4u));
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::ClearUnorderedAccessViewUint(ID3D11UnorderedAccessView* uav, const UINT values[4]) {
+
+		Record("ClearUnorderedAccessViewUint", uav, Elements(values, 4u));
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::ClearUnorderedAccessViewFloat(ID3D11UnorderedAccessView* uav, const FLOAT values[4]) {
+
+		Record("ClearUnorderedAccessViewFloat", uav, Elements(values, 4u));
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::ClearDepthStencilView(ID3D11DepthStencilView* dsv, UINT clear_flags,
+		                          FLOAT depth, UINT8 stencil) {
+
+		Record("ClearDepthStencilView", dsv, clear_flags, depth, stencil);
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::GenerateMips(ID3D11ShaderResourceView* srv) {
+
+		Record("GenerateMips", srv);
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::SetResourceMinLOD(ID3D11Resource* resource, FLOAT min_lod) {
+
+		Record("SetResourceMinLOD", resource, min_lod);
+	}
+
+	FLOAT STDMETHODCALLTYPE MockDeviceContext
+		::GetResourceMinLOD(ID3D11Resource*) {
+
+		return 0.0f;
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::ResolveSubresource(ID3D11Resource* dst, UINT dst_subresource,
+		  ID3D11Resource* src, UINT src_subresource, DXGI_FORMAT format) {
+
+		Record("ResolveSubresource", dst, dst_subresource, src, src_subresource, format);
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::ExecuteCommandList(ID3D11CommandList* command_list,
+		                       BOOL restore_context_state) {
+
+		Record("ExecuteCommandList", command_list, restore_context_state);
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::ClearState() {
+
+		Record("ClearState");
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::Flush() {
+
+		Record("Flush");
+	}
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// MockDeviceContext: ID3D11DeviceContext (Queries)
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::VSGetShader(ID3D11VertexShader** shader, ID3D11ClassInstance**,
+		                UINT* nb_class_instances) {
+
+		*shader = nullptr;
+		if (nb_class_instances) {
+			*nb_class_instances = 0u;
+		}
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::VSGetConstantBuffers(UINT, UINT nb_buffers, ID3D11Buffer** buffers) {
+
+		std::fill_n(buffers, nb_buffers, nullptr);
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::VSGetShaderResources(UINT, UINT nb_srvs, ID3D11ShaderResourceView** srvs) {
+
+		std::fill_n(srvs, nb_srvs, nullptr);
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::VSGetSamplers(UINT, UINT nb_samplers, ID3D11SamplerState** samplers) {
+
+		std::fill_n(samplers, nb_samplers, nullptr);
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::HSGetShader(ID3D11HullShader** shader, ID3D11ClassInstance**,
+		                UINT* nb_class_instances) {
+
+		*shader = nullptr;
+		if (nb_class_instances) {
+			*nb_class_instances = 0u;
+		}
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::HSGetConstantBuffers(UINT, UINT nb_buffers, ID3D11Buffer** buffers) {
+
+		std::fill_n(buffers, nb_buffers, nullptr);
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::HSGetShaderResources(UINT, UINT nb_srvs, ID3D11ShaderResourceView** srvs) {
+
+		std::fill_n(srvs, nb_srvs, nullptr);
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::HSGetSamplers(UINT, UINT nb_samplers, ID3D11SamplerState** samplers) {
+
+		std::fill_n(samplers, nb_samplers, nullptr);
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::DSGetShader(ID3D11DomainShader** shader, ID3D11ClassInstance**,
+		                UINT* nb_class_instances) {
+
+		*shader = nullptr;
+		if (nb_class_instances) {
+			*nb_class_instances = 0u;
+		}
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::DSGetConstantBuffers(UINT, UINT nb_buffers, ID3D11Buffer** buffers) {
+
+		std::fill_n(buffers, nb_buffers, nullptr);
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::DSGetShaderResources(UINT, UINT nb_srvs, ID3D11ShaderResourceView** srvs) {
+
+		std::fill_n(srvs, nb_srvs, nullptr);
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::DSGetSamplers(UINT, UINT nb_samplers, ID3D11SamplerState** samplers) {
+
+		std::fill_n(samplers, nb_samplers, nullptr);
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::GSGetShader(ID3D11GeometryShader** shader, ID3D11ClassInstance**,
+		                UINT* nb_class_instances) {
+
+		*shader = nullptr;
+		if (nb_class_instances) {
+			*nb_class_instances = 0u;
+		}
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::GSGetConstantBuffers(UINT, UINT nb_buffers, ID3D11Buffer** buffers) {
+
+		std::fill_n(buffers, nb_buffers, nullptr);
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::GSGetShaderResources(UINT, UINT nb_srvs, ID3D11ShaderResourceView** srvs) {
+
+		std::fill_n(srvs, nb_srvs, nullptr);
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::GSGetSamplers(UINT, UINT nb_samplers, ID3D11SamplerState** samplers) {
+
+		std::fill_n(samplers, nb_samplers, nullptr);
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::PSGetShader(ID3D11PixelShader** shader, ID3D11ClassInstance**,
+		                UINT* nb_class_instances) {
+
+		*shader = nullptr;
+		if (nb_class_instances) {
+			*nb_class_instances = 0u;
+		}
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::PSGetConstantBuffers(UINT, UINT nb_buffers, ID3D11Buffer** buffers) {
+
+		std::fill_n(buffers, nb_buffers, nullptr);
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::PSGetShaderResources(UINT, UINT nb_srvs, ID3D11ShaderResourceView** srvs) {
+
+		std::fill_n(srvs, nb_srvs, nullptr);
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::PSGetSamplers(UINT, UINT nb_samplers, ID3D11SamplerState** samplers) {
+
+		std::fill_n(samplers, nb_samplers, nullptr);
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::CSGetShader(ID3D11ComputeShader** shader, ID3D11ClassInstance**,
+		                UINT* nb_class_instances) {
+
+		*shader = nullptr;
+		if (nb_class_instances) {
+			*nb_class_instances = 0u;
+		}
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::CSGetConstantBuffers(UINT, UINT nb_buffers, ID3D11Buffer** buffers) {
+
+		std::fill_n(buffers, nb_buffers, nullptr);
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::CSGetShaderResources(UINT, UINT nb_srvs, ID3D11ShaderResourceView** srvs) {
+
+		std::fill_n(srvs, nb_srvs, nullptr);
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::CSGetSamplers(UINT, UINT nb_samplers, ID3D11SamplerState** samplers) {
+
+		std::fill_n(samplers, nb_samplers, nullptr);
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::CSGetUnorderedAccessViews(UINT, UINT nb_uavs, ID3D11UnorderedAccessView** uavs) {
+
+		std::fill_n(uavs, nb_uavs, nullptr);
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::IAGetInputLayout(ID3D11InputLayout** input_layout) {
+
+		*input_layout = nullptr;
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::IAGetVertexBuffers(UINT, UINT nb_buffers, ID3D11Buffer** buffers,
+		                       UINT* strides, UINT* offsets) {
+
+		std::fill_n(buffers, nb_buffers, nullptr);
+		if (strides) {
+			std::fill_n(strides, nb_buffers, 0u);
+		}
+		if (offsets) {
+			std::fill_n(offsets, nb_buffers, 0u);
+		}
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::IAGetIndexBuffer(ID3D11Buffer** buffer, DXGI_FORMAT* format, UINT* offset) {
+
+		*buffer = nullptr;
+		if (format) {
+			*format = DXGI_FORMAT_UNKNOWN;
+		}
+		if (offset) {
+			*offset = 0u;
+		}
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::IAGetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY* topology) {
+
+		*topology = D3D11_PRIMITIVE_TOPOLOGY_UNDEFINED;
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::GetPredication(ID3D11Predicate** predicate, BOOL* value) {
+
+		if (predicate) {
+			*predicate = nullptr;
+		}
+		if (value) {
+			*value = FALSE;
+		}
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::OMGetRenderTargets(UINT nb_rtvs, ID3D11RenderTargetView** rtvs,
+		                       ID3D11DepthStencilView** dsv) {
+
+		if (rtvs) {
+			std::fill_n(rtvs, nb_rtvs, nullptr);
+		}
+		if (dsv) {
+			*dsv = nullptr;
+		}
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::OMGetRenderTargetsAndUnorderedAccessViews(UINT nb_rtvs, ID3D11RenderTargetView** rtvs,
+		  ID3D11DepthStencilView** dsv, UINT, UINT nb_uavs,
+		  ID3D11UnorderedAccessView** uavs) {
+
+		OMGetRenderTargets(nb_rtvs, rtvs, dsv);
+		if (uavs) {
+			std::fill_n(uavs, nb_uavs, nullptr);
+		}
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::OMGetBlendState(ID3D11BlendState** state, FLOAT blend_factor[4],
+		                    UINT* sample_mask) {
+
+		if (state) {
+			*state = nullptr;
+		}
+		if (blend_factor) {
+			std::fill_n(blend_factor, 4u, 1.0f);
+		}
+		if (sample_mask) {
+			*sample_mask = 0xFFFFFFFFu;
+		}
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::OMGetDepthStencilState(ID3D11DepthStencilState** state, UINT* stencil_ref) {
+
+		if (state) {
+			*state = nullptr;
+		}
+		if (stencil_ref) {
+			*stencil_ref = 0u;
+		}
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::SOGetTargets(UINT nb_buffers, ID3D11Buffer** buffers) {
+
+		std::fill_n(buffers, nb_buffers, nullptr);
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::RSGetState(ID3D11RasterizerState** state) {
+
+		*state = nullptr;
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::RSGetViewports(UINT* nb_viewports, D3D11_VIEWPORT*) {
+
+		*nb_viewports = 0u;
+	}
+
+	void STDMETHODCALLTYPE MockDeviceContext
+		::RSGetScissorRects(UINT* nb_rects, D3D11_RECT*) {
+
+		*nb_rects = 0u;
+	}
+
+	D3D11_DEVICE_CONTEXT_TYPE STDMETHODCALLTYPE MockDeviceContext
+		::GetType() {
+
+		return D3D11_DEVICE_CONTEXT_IMMEDIATE;
+	}
+
+	UINT STDMETHODCALLTYPE MockDeviceContext
+		::GetContextFlags() {
+
+		return 0u;
+	}
+
+	HRESULT STDMETHODCALLTYPE MockDeviceContext
+		::FinishCommandList(BOOL, ID3D11CommandList** command_list) {
+
+		*command_list = nullptr;
+		return E_NOTIMPL;
+	}
+
+	#pragma endregion
+}
\ No newline at end of file
@@ -0,0 +1,787 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "direct3d11.hpp"
+#include "type\types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	/**
+	 A struct of device context calls recorded by a mock device context.
+	 */
+	struct MockCall final {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Compares this mock call to the given mock call for equality.
+
+		 @param[in]		rhs
+						A reference to the mock call to compare against.
+		 @return		@c true if this mock call is equal to the given mock
+						call. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool operator==(const MockCall& rhs) const noexcept {
+			return m_name == rhs.m_name && m_arguments == rhs.m_arguments;
+		}
+
+		/**
+		 Compares this mock call to the given mock call for inequality.
+
+		 @param[in]		rhs
+						A reference to the mock call to compare against.
+		 @return		@c true if this mock call is not equal to the given
+						mock call. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool operator!=(const MockCall& rhs) const noexcept {
+			return !(*this == rhs);
+		}
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The name of the called method of this mock call.
+		 */
+		std::string m_name;
+
+		/**
+		 The arguments of this mock call. Pointers are recorded by address,
+		 arrays by their elements.
+		 */
+		std::vector< U64 > m_arguments;
+	};
+
+	/**
+	 Returns a fake pointer to a D3D11 object with the given identifier. Fake
+	 pointers can be bound to mock device contexts, but must never be
+	 dereferenced.
+
+	 @tparam		T
+					The object type.
+	 @param[in]		id
+					The identifier of the object. Distinct identifiers result
+					in distinct pointers.
+	 @return		A fake pointer to the D3D11 object with the given
+					identifier.
+	 */
+	template< typename T >
+	[[nodiscard]]
+	inline T* GetMockObject(size_t id) noexcept {
+		return reinterpret_cast< T* >((id + 1u) * 64u);
+	}
+
+	/**
+	 A class of mock buffers. Unlike fake pointers, mock buffers can be
+	 queried for their type and descriptor (e.g., by command recorders
+	 mapping them).
+
+	 Mock buffers are not reference counted and must outlive their uses.
+	 */
+	class MockBuffer final : public ID3D11Buffer {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a mock buffer.
+
+		 @param[in]		size
+						The size in bytes of the mock buffer.
+		 */
+		explicit MockBuffer(U32 size) noexcept;
+
+		/**
+		 Constructs a mock buffer from the given mock buffer.
+
+		 @param[in]		buffer
+						A reference to the mock buffer to copy.
+		 */
+		MockBuffer(const MockBuffer& buffer) = delete;
+
+		/**
+		 Constructs a mock buffer by moving the given mock buffer.
+
+		 @param[in]		buffer
+						A reference to the mock buffer to move.
+		 */
+		MockBuffer(MockBuffer&& buffer) = delete;
+
+		/**
+		 Destructs this mock buffer.
+		 */
+		virtual ~MockBuffer();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given mock buffer to this mock buffer.
+
+		 @param[in]		buffer
+						A reference to the mock buffer to copy.
+		 @return		A reference to the copy of the given mock buffer
+						(i.e. this mock buffer).
+		 */
+		MockBuffer& operator=(const MockBuffer& buffer) = delete;
+
+		/**
+		 Moves the given mock buffer to this mock buffer.
+
+		 @param[in]		buffer
+						A reference to the mock buffer to move.
+		 @return		A reference to the moved mock buffer (i.e. this mock
+						buffer).
+		 */
+		MockBuffer& operator=(MockBuffer&& buffer) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods: IUnknown
+		//---------------------------------------------------------------------
+		#pragma region
+
+		HRESULT STDMETHODCALLTYPE QueryInterface(REFIID riid,
+			                                     void** object) override;
+		ULONG STDMETHODCALLTYPE AddRef() override;
+		ULONG STDMETHODCALLTYPE Release() override;
+
+		#pragma endregion
+
+		//---------------------------------------------------------------------
+		// Member Methods: ID3D11DeviceChild
+		//---------------------------------------------------------------------
+		#pragma region
+
+		void STDMETHODCALLTYPE GetDevice(ID3D11Device** device) override;
+		HRESULT STDMETHODCALLTYPE GetPrivateData(REFGUID guid,
+			                                     UINT* data_size,
+			                                     void* data) override;
+		HRESULT STDMETHODCALLTYPE SetPrivateData(REFGUID guid,
+			                                     UINT data_size,
+			                                     const void* data) override;
+		HRESULT STDMETHODCALLTYPE SetPrivateDataInterface(REFGUID guid,
+			                                              const IUnknown* data) override;
+
+		#pragma endregion
+
+		//---------------------------------------------------------------------
+		// Member Methods: ID3D11Resource
+		//---------------------------------------------------------------------
+		#pragma region
+
+		void STDMETHODCALLTYPE GetType(
+			D3D11_RESOURCE_DIMENSION* dimension) override;
+		void STDMETHODCALLTYPE SetEvictionPriority(UINT priority) override;
+		UINT STDMETHODCALLTYPE GetEvictionPriority() override;
+
+		#pragma endregion
+
+		//---------------------------------------------------------------------
+		// Member Methods: ID3D11Buffer
+		//---------------------------------------------------------------------
+		#pragma region
+
+		void STDMETHODCALLTYPE GetDesc(D3D11_BUFFER_DESC* desc) override;
+
+		#pragma endregion
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The size in bytes of this mock buffer.
+		 */
+		U32 m_size;
+	};
+
+	/**
+	 A class of mock device contexts. A mock device context records the
+	 calls that change the state of the pipeline (and draws, dispatches,
+	 copies and clears) instead of executing them. Queries return empty
+	 state.
+
+	 Mock device contexts are not reference counted and must outlive their
+	 uses.
+	 */
+	class MockDeviceContext final : public ID3D11DeviceContext {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a mock device context.
+		 */
+		MockDeviceContext();
+
+		/**
+		 Constructs a mock device context from the given mock device context.
+
+		 @param[in]		device_context
+						A reference to the mock device context to copy.
+		 */
+		MockDeviceContext(const MockDeviceContext& device_context) = delete;
+
+		/**
+		 Constructs a mock device context by moving the given mock device
+		 context.
+
+		 @param[in]		device_context
+						A reference to the mock device context to move.
+		 */
+		MockDeviceContext(MockDeviceContext&& device_context) = delete;
+
+		/**
+		 Destructs this mock device context.
+		 */
+		virtual ~MockDeviceContext();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given mock device context to this mock device context.
+
+		 @param[in]		device_context
+						A reference to the mock device context to copy.
+		 @return		A reference to the copy of the given mock device
+						context (i.e. this mock device context).
+		 */
+		MockDeviceContext& operator=(
+			const MockDeviceContext& device_context) = delete;
+
+		/**
+		 Moves the given mock device context to this mock device context.
+
+		 @param[in]		device_context
+						A reference to the mock device context to move.
+		 @return		A reference to the moved mock device context (i.e.
+						this mock device context).
+		 */
+		MockDeviceContext& operator=(
+			MockDeviceContext&& device_context) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the recorded calls of this mock device context.
+
+		 @return		A reference to the recorded calls of this mock device
+						context.
+		 */
+		[[nodiscard]]
+		const std::vector< MockCall >& GetCalls() const noexcept {
+			return m_calls;
+		}
+
+		/**
+		 Returns the number of recorded calls of this mock device context.
+
+		 @return		The number of recorded calls of this mock device
+						context.
+		 */
+		[[nodiscard]]
+		size_t GetNumberOfCalls() const noexcept {
+			return m_calls.size();
+		}
+
+		/**
+		 Returns the number of recorded calls of this mock device context
+		 with the given method name.
+
+		 @param[in]		name
+						A pointer to the null-terminated method name.
+		 @return		The number of recorded calls of this mock device
+						context with the given method name.
+		 */
+		[[nodiscard]]
+		size_t GetNumberOfCalls(const char* name) const noexcept;
+
+		/**
+		 Returns the memory returned for mapped resources of this mock
+		 device context. The memory is shared by all mapped resources and
+		 preserved between mappings.
+
+		 @return		A reference to the memory returned for mapped
+						resources of this mock device context.
+		 */
+		[[nodiscard]]
+		std::vector< U8 >& GetMappedData() noexcept {
+			return m_mapped_data;
+		}
+
+		/**
+		 Removes all recorded calls of this mock device context.
+		 */
+		void ClearCalls() noexcept {
+			m_calls.clear();
+		}
+
+		//---------------------------------------------------------------------
+		// Member Methods: IUnknown
+		//---------------------------------------------------------------------
+		#pragma region
+
+		HRESULT STDMETHODCALLTYPE QueryInterface(REFIID riid,
+			                                     void** object) override;
+		ULONG STDMETHODCALLTYPE AddRef() override;
+		ULONG STDMETHODCALLTYPE Release() override;
+
+		#pragma endregion
+
+		//---------------------------------------------------------------------
+		// Member Methods: ID3D11DeviceChild
+		//---------------------------------------------------------------------
+		#pragma region
+
+		void STDMETHODCALLTYPE GetDevice(ID3D11Device** device) override;
+		HRESULT STDMETHODCALLTYPE GetPrivateData(REFGUID guid,
+			                                     UINT* data_size,
+			                                     void* data) override;
+		HRESULT STDMETHODCALLTYPE SetPrivateData(REFGUID guid,
+			                                     UINT data_size,
+			                                     const void* data) override;
+		HRESULT STDMETHODCALLTYPE SetPrivateDataInterface(REFGUID guid,
+			                                              const IUnknown* data) override;
+
+		#pragma endregion
+
+		//---------------------------------------------------------------------
+		// Member Methods: ID3D11DeviceContext (Recorded)
+		//---------------------------------------------------------------------
+		#pragma region
+
+		void STDMETHODCALLTYPE VSSetConstantBuffers(UINT slot, UINT nb_buffers,
+			ID3D11Buffer* const* buffers) override;
+		void STDMETHODCALLTYPE PSSetShaderResources(UINT slot, UINT nb_srvs,
+			ID3D11ShaderResourceView* const* srvs) override;
+		void STDMETHODCALLTYPE PSSetShader(ID3D11PixelShader* shader,
+			ID3D11ClassInstance* const* class_instances,
+			UINT nb_class_instances) override;
+		void STDMETHODCALLTYPE PSSetSamplers(UINT slot, UINT nb_samplers,
+			ID3D11SamplerState* const* samplers) override;
+		void STDMETHODCALLTYPE VSSetShader(ID3D11VertexShader* shader,
+			ID3D11ClassInstance* const* class_instances,
+			UINT nb_class_instances) override;
+		void STDMETHODCALLTYPE DrawIndexed(UINT nb_indices, UINT start_index,
+			INT base_vertex) override;
+		void STDMETHODCALLTYPE Draw(UINT nb_vertices,
+			UINT start_vertex) override;
+		HRESULT STDMETHODCALLTYPE Map(ID3D11Resource* resource,
+			UINT subresource, D3D11_MAP map_type, UINT map_flags,
+			D3D11_MAPPED_SUBRESOURCE* mapped_resource) override;
+		void STDMETHODCALLTYPE Unmap(ID3D11Resource* resource,
+			UINT subresource) override;
+		void STDMETHODCALLTYPE PSSetConstantBuffers(UINT slot, UINT nb_buffers,
+			ID3D11Buffer* const* buffers) override;
+		void STDMETHODCALLTYPE IASetInputLayout(
+			ID3D11InputLayout* input_layout) override;
+		void STDMETHODCALLTYPE IASetVertexBuffers(UINT slot, UINT nb_buffers,
+			ID3D11Buffer* const* buffers, const UINT* strides,
+			const UINT* offsets) override;
+		void STDMETHODCALLTYPE IASetIndexBuffer(ID3D11Buffer* buffer,
+			DXGI_FORMAT format, UINT offset) override;
+		void STDMETHODCALLTYPE DrawIndexedInstanced(UINT nb_indices,
+			UINT nb_instances, UINT start_index, INT base_vertex,
+			UINT start_instance) override;
+		void STDMETHODCALLTYPE DrawInstanced(UINT nb_vertices,
+			UINT nb_instances, UINT start_vertex,
+			UINT start_instance) override;
+		void STDMETHODCALLTYPE GSSetConstantBuffers(UINT slot, UINT nb_buffers,
+			ID3D11Buffer* const* buffers) override;
+		void STDMETHODCALLTYPE GSSetShader(ID3D11GeometryShader* shader,
+			ID3D11ClassInstance* const* class_instances,
+			UINT nb_class_instances) override;
+		void STDMETHODCALLTYPE IASetPrimitiveTopology(
+			D3D11_PRIMITIVE_TOPOLOGY topology) override;
+		void STDMETHODCALLTYPE VSSetShaderResources(UINT slot, UINT nb_srvs,
+			ID3D11ShaderResourceView* const* srvs) override;
+		void STDMETHODCALLTYPE VSSetSamplers(UINT slot, UINT nb_samplers,
+			ID3D11SamplerState* const* samplers) override;
+		void STDMETHODCALLTYPE Begin(ID3D11Asynchronous* async) override;
+		void STDMETHODCALLTYPE End(ID3D11Asynchronous* async) override;
+		HRESULT STDMETHODCALLTYPE GetData(ID3D11Asynchronous* async,
+			void* data, UINT data_size, UINT flags) override;
+		void STDMETHODCALLTYPE SetPredication(ID3D11Predicate* predicate,
+			BOOL value) override;
+		void STDMETHODCALLTYPE GSSetShaderResources(UINT slot, UINT nb_srvs,
+			ID3D11ShaderResourceView* const* srvs) override;
+		void STDMETHODCALLTYPE GSSetSamplers(UINT slot, UINT nb_samplers,
+			ID3D11SamplerState* const* samplers) override;
+		void STDMETHODCALLTYPE OMSetRenderTargets(UINT nb_rtvs,
+			ID3D11RenderTargetView* const* rtvs,
+			ID3D11DepthStencilView* dsv) override;
+		void STDMETHODCALLTYPE OMSetRenderTargetsAndUnorderedAccessViews(
+			UINT nb_rtvs, ID3D11RenderTargetView* const* rtvs,
+			ID3D11DepthStencilView* dsv, UINT uav_slot, UINT nb_uavs,
+			ID3D11UnorderedAccessView* const* uavs,
+			const UINT* initial_counts) override;
+		void STDMETHODCALLTYPE OMSetBlendState(ID3D11BlendState* state,
+			const FLOAT blend_factor[4], UINT sample_mask) override;
+		void STDMETHODCALLTYPE OMSetDepthStencilState(
+			ID3D11DepthStencilState* state, UINT stencil_ref) override;
+		void STDMETHODCALLTYPE SOSetTargets(UINT nb_buffers,
+			ID3D11Buffer* const* buffers, const UINT* offsets) override;
+		void STDMETHODCALLTYPE DrawAuto() override;
+		void STDMETHODCALLTYPE DrawIndexedInstancedIndirect(
+			ID3D11Buffer* buffer, UINT offset) override;
+		void STDMETHODCALLTYPE DrawInstancedIndirect(
+			ID3D11Buffer* buffer, UINT offset) override;
+		void STDMETHODCALLTYPE Dispatch(UINT nb_groups_x, UINT nb_groups_y,
+			UINT nb_groups_z) override;
+		void STDMETHODCALLTYPE DispatchIndirect(ID3D11Buffer* buffer,
+			UINT offset) override;
+		void STDMETHODCALLTYPE RSSetState(
+			ID3D11RasterizerState* state) override;
+		void STDMETHODCALLTYPE RSSetViewports(UINT nb_viewports,
+			const D3D11_VIEWPORT* viewports) override;
+		void STDMETHODCALLTYPE RSSetScissorRects(UINT nb_rects,
+			const D3D11_RECT* rects) override;
+		void STDMETHODCALLTYPE CopySubresourceRegion(ID3D11Resource* dst,
+			UINT dst_subresource, UINT dst_x, UINT dst_y, UINT dst_z,
+			ID3D11Resource* src, UINT src_subresource,
+			const D3D11_BOX* src_box) override;
+		void STDMETHODCALLTYPE CopyResource(ID3D11Resource* dst,
+			ID3D11Resource* src) override;
+		void STDMETHODCALLTYPE UpdateSubresource(ID3D11Resource* dst,
+			UINT dst_subresource, const D3D11_BOX* dst_box,
+			const void* src_data, UINT src_row_pitch,
+			UINT src_depth_pitch) override;
+		void STDMETHODCALLTYPE CopyStructureCount(ID3D11Buffer* dst,
+			UINT dst_offset, ID3D11UnorderedAccessView* src) override;
+		void STDMETHODCALLTYPE ClearRenderTargetView(
+			ID3D11RenderTargetView* rtv, const FLOAT color[4]) override;
+		void STDMETHODCALLTYPE ClearUnorderedAccessViewUint(
+			ID3D11UnorderedAccessView* uav, const UINT values[4]) override;
+		void STDMETHODCALLTYPE ClearUnorderedAccessViewFloat(
+			ID3D11UnorderedAccessView* uav, const FLOAT values[4]) override;
+		void STDMETHODCALLTYPE ClearDepthStencilView(
+			ID3D11DepthStencilView* dsv, UINT clear_flags, FLOAT depth,
+			UINT8 stencil) override;
+		void STDMETHODCALLTYPE GenerateMips(
+			ID3D11ShaderResourceView* srv) override;
+		void STDMETHODCALLTYPE SetResourceMinLOD(ID3D11Resource* resource,
+			FLOAT min_lod) override;
+		FLOAT STDMETHODCALLTYPE GetResourceMinLOD(
+			ID3D11Resource* resource) override;
+		void STDMETHODCALLTYPE ResolveSubresource(ID3D11Resource* dst,
+			UINT dst_subresource, ID3D11Resource* src, UINT src_subresource,
+			DXGI_FORMAT format) override;
+		void STDMETHODCALLTYPE ExecuteCommandList(
+			ID3D11CommandList* command_list,
+			BOOL restore_context_state) override;
+		void STDMETHODCALLTYPE HSSetShaderResources(UINT slot, UINT nb_srvs,
+			ID3D11ShaderResourceView* const* srvs) override;
+		void STDMETHODCALLTYPE HSSetShader(ID3D11HullShader* shader,
+			ID3D11ClassInstance* const* class_instances,
+			UINT nb_class_instances) override;
+		void STDMETHODCALLTYPE HSSetSamplers(UINT slot, UINT nb_samplers,
+			ID3D11SamplerState* const* samplers) override;
+		void STDMETHODCALLTYPE HSSetConstantBuffers(UINT slot, UINT nb_buffers,
+			ID3D11Buffer* const* buffers) override;
+		void STDMETHODCALLTYPE DSSetShaderResources(UINT slot, UINT nb_srvs,
+			ID3D11ShaderResourceView* const* srvs) override;
+		void STDMETHODCALLTYPE DSSetShader(ID3D11DomainShader* shader,
+			ID3D11ClassInstance* const* class_instances,
+			UINT nb_class_instances) override;
+		void STDMETHODCALLTYPE DSSetSamplers(UINT slot, UINT nb_samplers,
+			ID3D11SamplerState* const* samplers) override;
+		void STDMETHODCALLTYPE DSSetConstantBuffers(UINT slot, UINT nb_buffers,
+			ID3D11Buffer* const* buffers) override;
+		void STDMETHODCALLTYPE CSSetShaderResources(UINT slot, UINT nb_srvs,
+			ID3D11ShaderResourceView* const* srvs) override;
+		void STDMETHODCALLTYPE CSSetUnorderedAccessViews(UINT slot,
+			UINT nb_uavs, ID3D11UnorderedAccessView* const* uavs,
+			const UINT* initial_counts) override;
+		void STDMETHODCALLTYPE CSSetShader(ID3D11ComputeShader* shader,
+			ID3D11ClassInstance* const* class_instances,
+			UINT nb_class_instances) override;
+		void STDMETHODCALLTYPE CSSetSamplers(UINT slot, UINT nb_samplers,
+			ID3D11SamplerState* const* samplers) override;
+		void STDMETHODCALLTYPE CSSetConstantBuffers(UINT slot, UINT nb_buffers,
+			ID3D11Buffer* const* buffers) override;
+		void STDMETHODCALLTYPE ClearState() override;
+		void STDMETHODCALLTYPE Flush() override;
+
+		#pragma endregion
+
+		//---------------------------------------------------------------------
+		// Member Methods: ID3D11DeviceContext (Queries)
+		//---------------------------------------------------------------------
+		#pragma region
+
+		void STDMETHODCALLTYPE VSGetConstantBuffers(UINT slot, UINT nb_buffers,
+			ID3D11Buffer** buffers) override;
+		void STDMETHODCALLTYPE PSGetShaderResources(UINT slot, UINT nb_srvs,
+			ID3D11ShaderResourceView** srvs) override;
+		void STDMETHODCALLTYPE PSGetShader(ID3D11PixelShader** shader,
+			ID3D11ClassInstance** class_instances,
+			UINT* nb_class_instances) override;
+		void STDMETHODCALLTYPE PSGetSamplers(UINT slot, UINT nb_samplers,
+			ID3D11SamplerState** samplers) override;
+		void STDMETHODCALLTYPE VSGetShader(ID3D11VertexShader** shader,
+			ID3D11ClassInstance** class_instances,
+			UINT* nb_class_instances) override;
+		void STDMETHODCALLTYPE PSGetConstantBuffers(UINT slot, UINT nb_buffers,
+			ID3D11Buffer** buffers) override;
+		void STDMETHODCALLTYPE IAGetInputLayout(
+			ID3D11InputLayout** input_layout) override;
+		void STDMETHODCALLTYPE IAGetVertexBuffers(UINT slot, UINT nb_buffers,
+			ID3D11Buffer** buffers, UINT* strides, UINT* offsets) override;
+		void STDMETHODCALLTYPE IAGetIndexBuffer(ID3D11Buffer** buffer,
+			DXGI_FORMAT* format, UINT* offset) override;
+		void STDMETHODCALLTYPE GSGetConstantBuffers(UINT slot, UINT nb_buffers,
+			ID3D11Buffer** buffers) override;
+		void STDMETHODCALLTYPE GSGetShader(ID3D11GeometryShader** shader,
+			ID3D11ClassInstance** class_instances,
+			UINT* nb_class_instances) override;
+		void STDMETHODCALLTYPE IAGetPrimitiveTopology(
+			D3D11_PRIMITIVE_TOPOLOGY* topology) override;
+		void STDMETHODCALLTYPE VSGetShaderResources(UINT slot, UINT nb_srvs,
+			ID3D11ShaderResourceView** srvs) override;
+		void STDMETHODCALLTYPE VSGetSamplers(UINT slot, UINT nb_samplers,
+			ID3D11SamplerState** samplers) override;
+		void STDMETHODCALLTYPE GetPredication(ID3D11Predicate** predicate,
+			BOOL* value) override;
+		void STDMETHODCALLTYPE GSGetShaderResources(UINT slot, UINT nb_srvs,
+			ID3D11ShaderResourceView** srvs) override;
+		void STDMETHODCALLTYPE GSGetSamplers(UINT slot, UINT nb_samplers,
+			ID3D11SamplerState** samplers) override;
+		void STDMETHODCALLTYPE OMGetRenderTargets(UINT nb_rtvs,
+			ID3D11RenderTargetView** rtvs,
+			ID3D11DepthStencilView** dsv) override;
+		void STDMETHODCALLTYPE OMGetRenderTargetsAndUnorderedAccessViews(
+			UINT nb_rtvs, ID3D11RenderTargetView** rtvs,
+			ID3D11DepthStencilView** dsv, UINT uav_slot, UINT nb_uavs,
+			ID3D11UnorderedAccessView** uavs) override;
+		void STDMETHODCALLTYPE OMGetBlendState(ID3D11BlendState** state,
+			FLOAT blend_factor[4], UINT* sample_mask) override;
+		void STDMETHODCALLTYPE OMGetDepthStencilState(
+			ID3D11DepthStencilState** state, UINT* stencil_ref) override;
+		void STDMETHODCALLTYPE SOGetTargets(UINT nb_buffers,
+			ID3D11Buffer** buffers) override;
+		void STDMETHODCALLTYPE RSGetState(
+			ID3D11RasterizerState** state) override;
+		void STDMETHODCALLTYPE RSGetViewports(UINT* nb_viewports,
+			D3D11_VIEWPORT* viewports) override;
+		void STDMETHODCALLTYPE RSGetScissorRects(UINT* nb_rects,
+			D3D11_RECT* rects) override;
+		void STDMETHODCALLTYPE HSGetShaderResources(UINT slot, UINT nb_srvs,
+			ID3D11ShaderResourceView** srvs) override;
+		void STDMETHODCALLTYPE HSGetShader(ID3D11HullShader** shader,
+			ID3D11ClassInstance** class_instances,
+			UINT* nb_class_instances) override;
+		void STDMETHODCALLTYPE HSGetSamplers(UINT slot, UINT nb_samplers,
+			ID3D11SamplerState** samplers) override;
+		void STDMETHODCALLTYPE HSGetConstantBuffers(UINT slot, UINT nb_buffers,
+			ID3D11Buffer** buffers) override;
+		void STDMETHODCALLTYPE DSGetShaderResources(UINT slot, UINT nb_srvs,
+			ID3D11ShaderResourceView** srvs) override;
+		void STDMETHODCALLTYPE DSGetShader(ID3D11DomainShader** shader,
+			ID3D11ClassInstance** class_instances,
+			UINT* nb_class_instances) override;
+		void STDMETHODCALLTYPE DSGetSamplers(UINT slot, UINT nb_samplers,
+			ID3D11SamplerState** samplers) override;
+		void STDMETHODCALLTYPE DSGetConstantBuffers(UINT slot, UINT nb_buffers,
+			ID3D11Buffer** buffers) override;
+		void STDMETHODCALLTYPE CSGetShaderResources(UINT slot, UINT nb_srvs,
+			ID3D11ShaderResourceView** srvs) override;
+		void STDMETHODCALLTYPE CSGetUnorderedAccessViews(UINT slot,
+			UINT nb_uavs, ID3D11UnorderedAccessView** uavs) override;
+		void STDMETHODCALLTYPE CSGetShader(ID3D11ComputeShader** shader,
+			ID3D11ClassInstance** class_instances,
+			UINT* nb_class_instances) override;
+		void STDMETHODCALLTYPE CSGetSamplers(UINT slot, UINT nb_samplers,
+			ID3D11SamplerState** samplers) override;
+		void STDMETHODCALLTYPE CSGetConstantBuffers(UINT slot, UINT nb_buffers,
+			ID3D11Buffer** buffers) override;
+		D3D11_DEVICE_CONTEXT_TYPE STDMETHODCALLTYPE GetType() override;
+		UINT STDMETHODCALLTYPE GetContextFlags() override;
+		HRESULT STDMETHODCALLTYPE FinishCommandList(
+			BOOL restore_deferred_context_state,
+			ID3D11CommandList** command_list) override;
+
+		#pragma endregion
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 A struct of arrays of call arguments.
+
+		 @tparam		T
+						The element type.
+		 */
+		template< typename T >
+		struct ArgumentArray final {
+
+		public:
+
+			/**
+			 A pointer to the first element of this argument array.
+			 */
+			const T* m_elements;
+
+			/**
+			 The number of elements of this argument array.
+			 */
+			size_t m_nb_elements;
+		};
+
+		//---------------------------------------------------------------------
+		// Class Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Creates an argument array.
+
+		 @tparam		T
+						The element type.
+		 @param[in]		elements
+						A pointer to the first element. A @c nullptr records
+						no elements.
+		 @param[in]		nb_elements
+						The number of elements.
+		 @return		The argument array.
+		 */
+		template< typename T >
+		[[nodiscard]]
+		static const ArgumentArray< T > Elements(const T* elements,
+			                                     size_t nb_elements) noexcept {
+			return { elements, elements ? nb_elements : 0u };
+		}
+
+		/**
+		 Appends the given argument to the given mock call.
+
+		 @tparam		T
+						The argument type.
+		 @param[in,out]	call
+						A reference to the mock call.
+		 @param[in]		argument
+						A reference to the argument.
+		 */
+		template< typename T >
+		static void Append(MockCall& call, const T& argument) {
+			if constexpr (std::is_pointer_v< T >) {
+				call.m_arguments.push_back(
+					static_cast< U64 >(reinterpret_cast< uintptr_t >(argument)));
+			}
+			else if constexpr (std::is_floating_point_v< T >) {
+				U32 bits;
+				const auto value = static_cast< F32 >(argument);
+				std::memcpy(&bits, &value, sizeof(bits));
+				call.m_arguments.push_back(bits);
+			}
+			else if constexpr (std::is_class_v< T >) {
+				static_assert(0u == sizeof(T) % sizeof(U32));
+				U32 words[sizeof(T) / sizeof(U32)];
+				std::memcpy(words, &argument, sizeof(T));
+				for (const auto word : words) {
+					call.m_arguments.push_back(word);
+				}
+			}
+			else {
+				call.m_arguments.push_back(static_cast< U64 >(argument));
+			}
+		}
+
+		/**
+		 Appends the given argument array to the given mock call.
+
+		 @tparam		T
+						The element type.
+		 @param[in,out]	call
+						A reference to the mock call.
+		 @param[in]		argument
+						A reference to the argument array.
+		 */
+		template< typename T >
+		static void Append(MockCall& call, const ArgumentArray< T >& argument) {
+			call.m_arguments.push_back(argument.m_nb_elements);
+			for (size_t i = 0u; i < argument.m_nb_elements; ++i) {
+				Append(call, argument.m_elements[i]);
+			}
+		}
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Records a call with the given method name and arguments.
+
+		 @tparam		ArgumentsT
+						The argument types.
+		 @param[in]		name
+						A pointer to the null-terminated method name.
+		 @param[in]		arguments
+						A reference to the arguments.
+		 */
+		template< typename... ArgumentsT >
+		void Record(const char* name, const ArgumentsT&... arguments) {
+			MockCall call;
+			call.m_name = name;
+			(Append(call, arguments), ...);
+			m_calls.push_back(std::move(call));
+		}
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The recorded calls of this mock device context.
+		 */
+		std::vector< MockCall > m_calls;
+
+		/**
+		 The memory returned for mapped resources of this mock device
+		 context.
+		 */
+		std::vector< U8 > m_mapped_data;
+	};
+}
\ No newline at end of file
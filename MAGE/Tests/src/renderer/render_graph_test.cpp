@@ -0,0 +1,258 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test\test.hpp"
+#include "renderer\render_graph.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	using namespace rendering;
+
+	namespace {
+
+		using PassHandle        = RenderGraph::PassHandle;
+		using TextureHandle     = RenderGraph::TextureHandle;
+		using TextureDescriptor = RenderGraph::TextureDescriptor;
+
+		/**
+		 A 1080p HDR texture descriptor.
+		 */
+		constexpr TextureDescriptor g_hdr_desc = { 1920u, 1080u, 1u, 10u, 0xA8u, 8u };
+
+		/**
+		 A 1080p normal texture descriptor.
+		 */
+		constexpr TextureDescriptor g_normal_desc = { 1920u, 1080u, 1u, 35u, 0x28u, 4u };
+
+		/**
+		 Returns the position of the given pass in the schedule of the given
+		 render graph.
+
+		 @param[in]		graph
+						A reference to the render graph.
+		 @param[in]		pass
+						The handle to the pass.
+		 @return		The position of the given pass in the schedule of the
+						given render graph. The size of the schedule if the
+						given pass is culled.
+		 */
+		[[nodiscard]]
+		size_t GetPosition(const RenderGraph& graph, PassHandle pass) {
+			const auto& schedule = graph.GetSchedule();
+			return static_cast< size_t >(
+				std::find(schedule.cbegin(), schedule.cend(), pass)
+				- schedule.cbegin());
+		}
+
+		/**
+		 Checks whether the given unbinds contain the given texture.
+
+		 @param[in]		unbinds
+						A reference to the unbinds.
+		 @param[in]		texture
+						The handle to the texture.
+		 @return		@c true if the given unbinds contain the given
+						texture. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool Contains(const std::vector< TextureHandle >& unbinds,
+			          TextureHandle texture) {
+
+			return unbinds.cend()
+				!= std::find(unbinds.cbegin(), unbinds.cend(), texture);
+		}
+	}
+
+	MAGE_TEST(RenderGraphOrdersDependentPasses) {
+		RenderGraph graph;
+		const auto hdr0   = graph.CreateTexture(g_hdr_desc);
+		const auto hdr1   = graph.CreateTexture(g_hdr_desc);
+		const auto output = graph.ImportTexture();
+
+		// Ping-pong: read-after-write, write-after-write and write-after-read.
+		const auto lighting = graph.AddPass();
+		graph.Write(lighting, hdr0);
+		const auto fog = graph.AddPass();
+		graph.Read(fog, hdr0);
+		graph.Write(fog, hdr1);
+		const auto dof = graph.AddPass();
+		graph.Read(dof, hdr1);
+		graph.Write(dof, hdr0);
+		const auto tone_mapping = graph.AddPass();
+		graph.Read(tone_mapping, hdr0);
+		graph.Write(tone_mapping, output);
+
+		graph.Compile();
+
+		MAGE_CHECK(4u == graph.GetSchedule().size());
+		MAGE_CHECK(GetPosition(graph, lighting) < GetPosition(graph, fog));
+		MAGE_CHECK(GetPosition(graph, fog) < GetPosition(graph, dof));
+		MAGE_CHECK(GetPosition(graph, dof) < GetPosition(graph, tone_mapping));
+	}
+
+	MAGE_TEST(RenderGraphBreaksTiesByDeclarationOrder) {
+		RenderGraph graph;
+		const auto output0 = graph.ImportTexture();
+		const auto output1 = graph.ImportTexture();
+		const auto normal  = graph.CreateTexture(g_normal_desc);
+
+		// Independent passes keep their declaration order.
+		const auto pass0 = graph.AddPass();
+		graph.Write(pass0, output0);
+		const auto pass1 = graph.AddPass();
+		graph.Write(pass1, normal);
+		const auto pass2 = graph.AddPass();
+		graph.Write(pass2, output1);
+		const auto pass3 = graph.AddPass();
+		graph.Read(pass3, normal);
+		graph.Write(pass3, output1);
+
+		graph.Compile();
+
+		const std::vector< PassHandle > expected = { pass0, pass1, pass2, pass3 };
+		MAGE_CHECK(expected == graph.GetSchedule());
+	}
+
+	MAGE_TEST(RenderGraphCullsUnusedPasses) {
+		RenderGraph graph;
+		const auto hdr    = graph.CreateTexture(g_hdr_desc);
+		const auto normal = graph.CreateTexture(g_normal_desc);
+		const auto unused = graph.CreateTexture(g_hdr_desc);
+		const auto output = graph.ImportTexture();
+
+		const auto gbuffer = graph.AddPass();
+		graph.Write(gbuffer, normal);
+		const auto lighting = graph.AddPass();
+		graph.Read(lighting, normal);
+		graph.Write(lighting, hdr);
+		const auto debug = graph.AddPass();
+		graph.Read(debug, normal);
+		graph.Write(debug, unused);
+		const auto tone_mapping = graph.AddPass();
+		graph.Read(tone_mapping, hdr);
+		graph.Write(tone_mapping, output);
+		const auto profiling = graph.AddPass(true);
+		graph.Read(profiling, hdr);
+
+		graph.Compile();
+
+		// Producers of non-culled passes are kept transitively.
+		MAGE_CHECK(!graph.IsCulled(gbuffer));
+		MAGE_CHECK(!graph.IsCulled(lighting));
+		MAGE_CHECK(!graph.IsCulled(tone_mapping));
+		MAGE_CHECK(!graph.IsCulled(profiling));
+		MAGE_CHECK(graph.IsCulled(debug));
+		MAGE_CHECK(4u == graph.GetSchedule().size());
+		MAGE_CHECK(graph.GetSchedule().size() == GetPosition(graph, debug));
+		MAGE_CHECK(RenderGraph::s_no_physical_index == graph.GetPhysicalIndex(unused));
+
+		// Passes with side effects are kept, their consumers are not.
+		RenderGraph side_effects;
+		const auto texture = side_effects.CreateTexture(g_normal_desc);
+		const auto writer  = side_effects.AddPass(true);
+		side_effects.Write(writer, texture);
+		const auto reader  = side_effects.AddPass();
+		side_effects.Read(reader, texture);
+
+		side_effects.Compile();
+
+		MAGE_CHECK(!side_effects.IsCulled(writer));
+		MAGE_CHECK(side_effects.IsCulled(reader));
+		MAGE_CHECK(1u == side_effects.GetSchedule().size());
+
+		side_effects.Clear();
+		side_effects.Compile();
+		MAGE_CHECK(side_effects.GetSchedule().empty());
+	}
+
+	MAGE_TEST(RenderGraphAliasesDisjointLifetimes) {
+		RenderGraph graph;
+		const auto a      = graph.CreateTexture(g_hdr_desc);
+		const auto b      = graph.CreateTexture(g_hdr_desc);
+		const auto c      = graph.CreateTexture(g_hdr_desc);
+		const auto normal = graph.CreateTexture(g_normal_desc);
+		const auto output = graph.ImportTexture();
+
+		// Lifetimes: a [0, 1], b [1, 2], c [2, 3], normal [0, 3].
+		const auto pass0 = graph.AddPass();
+		graph.Write(pass0, a);
+		graph.Write(pass0, normal);
+		const auto pass1 = graph.AddPass();
+		graph.Read(pass1, a);
+		graph.Write(pass1, b);
+		const auto pass2 = graph.AddPass();
+		graph.Read(pass2, b);
+		graph.Write(pass2, c);
+		const auto pass3 = graph.AddPass();
+		graph.Read(pass3, c);
+		graph.Read(pass3, normal);
+		graph.Write(pass3, output);
+
+		graph.Compile();
+
+		const auto index_a = graph.GetPhysicalIndex(a);
+		MAGE_CHECK(RenderGraph::s_no_physical_index != index_a);
+		MAGE_CHECK(index_a == graph.GetPhysicalIndex(c));
+		MAGE_CHECK(index_a != graph.GetPhysicalIndex(b));
+		MAGE_CHECK(index_a != graph.GetPhysicalIndex(normal));
+		MAGE_CHECK(RenderGraph::s_no_physical_index == graph.GetPhysicalIndex(output));
+
+		const auto& descs = graph.GetPhysicalDescriptors();
+		MAGE_CHECK(3u == descs.size());
+		MAGE_CHECK(g_hdr_desc == descs[index_a]);
+		MAGE_CHECK(g_normal_desc == descs[graph.GetPhysicalIndex(normal)]);
+
+		MAGE_CHECK(3u * g_hdr_desc.GetSize() + g_normal_desc.GetSize()
+				   == graph.GetTransientSize());
+		MAGE_CHECK(2u * g_hdr_desc.GetSize() + g_normal_desc.GetSize()
+				   == graph.GetPhysicalSize());
+	}
+
+	MAGE_TEST(RenderGraphUnbindsHazardingTextures) {
+		RenderGraph graph;
+		const auto a      = graph.CreateTexture(g_hdr_desc);
+		const auto b      = graph.CreateTexture(g_hdr_desc);
+		const auto c      = graph.CreateTexture(g_hdr_desc);
+		const auto output = graph.ImportTexture();
+
+		const auto pass0 = graph.AddPass();
+		graph.Write(pass0, a);
+		const auto pass1 = graph.AddPass();
+		graph.Read(pass1, a);
+		graph.Write(pass1, b);
+		const auto pass2 = graph.AddPass();
+		graph.Read(pass2, b);
+		graph.Write(pass2, c);
+		const auto pass3 = graph.AddPass();
+		graph.Read(pass3, c);
+		graph.Write(pass3, output);
+
+		graph.Compile();
+
+		// pass1 reads a, which is still bound as output of pass0.
+		MAGE_CHECK(Contains(graph.GetOutputUnbinds(pass1), a));
+		MAGE_CHECK(1u == graph.GetOutputUnbinds(pass1).size());
+		// pass2 writes c, which aliases a, still bound as input of pass1.
+		MAGE_CHECK(graph.GetPhysicalIndex(a) == graph.GetPhysicalIndex(c));
+		MAGE_CHECK(Contains(graph.GetInputUnbinds(pass2), a));
+		MAGE_CHECK(1u == graph.GetInputUnbinds(pass2).size());
+		MAGE_CHECK(graph.GetInputUnbinds(pass0).empty());
+		MAGE_CHECK(graph.GetOutputUnbinds(pass0).empty());
+	}
+}
\ No newline at end of file
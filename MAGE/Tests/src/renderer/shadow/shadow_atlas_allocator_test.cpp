@@ -0,0 +1,290 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test\test.hpp"
+#include "renderer\shadow\shadow_atlas_allocator.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	using namespace rendering;
+
+	namespace {
+
+		/**
+		 Checks whether the given shadow atlas tiles overlap.
+
+		 @param[in]		lhs
+						A reference to the first shadow atlas tile.
+		 @param[in]		rhs
+						A reference to the second shadow atlas tile.
+		 @return		@c true if the given shadow atlas tiles overlap.
+						@c false otherwise.
+		 */
+		[[nodiscard]]
+		bool Overlap(const ShadowAtlasTile& lhs,
+			         const ShadowAtlasTile& rhs) noexcept {
+
+			return lhs.m_position[0] < rhs.m_position[0] + rhs.m_size
+				&& rhs.m_position[0] < lhs.m_position[0] + lhs.m_size
+				&& lhs.m_position[1] < rhs.m_position[1] + rhs.m_size
+				&& rhs.m_position[1] < lhs.m_position[1] + lhs.m_size;
+		}
+
+		/**
+		 Checks whether the allocated tiles of the given shadow atlas
+		 allocator lie inside the shadow atlas and do not overlap.
+
+		 @param[in]		allocator
+						A reference to the shadow atlas allocator.
+		 @return		@c true if the allocated tiles of the given shadow
+						atlas allocator are valid. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool IsValid(const ShadowAtlasAllocator& allocator) {
+			std::vector< ShadowAtlasTile > tiles;
+			allocator.ForEachTile([&tiles](U64, const ShadowAtlasTile& tile) {
+				tiles.push_back(tile);
+			});
+
+			const auto resolution = allocator.GetResolution();
+			for (size_t i = 0u; i < tiles.size(); ++i) {
+				const auto& tile = tiles[i];
+				if (resolution < tile.m_position[0] + tile.m_size
+					|| resolution < tile.m_position[1] + tile.m_size) {
+					return false;
+				}
+
+				for (size_t j = i + 1u; j < tiles.size(); ++j) {
+					if (Overlap(tile, tiles[j])) {
+						return false;
+					}
+				}
+			}
+
+			return true;
+		}
+
+		/**
+		 Checks whether the given shadow atlas tiles are equal.
+
+		 @param[in]		lhs
+						A reference to the first shadow atlas tile.
+		 @param[in]		rhs
+						A reference to the second shadow atlas tile.
+		 @return		@c true if the given shadow atlas tiles are equal.
+						@c false otherwise.
+		 */
+		[[nodiscard]]
+		bool Equal(const ShadowAtlasTile& lhs,
+			       const ShadowAtlasTile& rhs) noexcept {
+
+			return lhs.m_size == rhs.m_size
+				&& lhs.m_position == rhs.m_position;
+		}
+	}
+
+	MAGE_TEST(ShadowAtlasAllocatorAllocatesAndReleases) {
+		ShadowAtlasAllocator allocator(1000u, 100u);
+		MAGE_CHECK(512u == allocator.GetResolution());
+		MAGE_CHECK(64u == allocator.GetMinimumTileSize());
+
+		// Sizes are rounded up to a power of two and clamped.
+		const auto tile = allocator.Allocate(1u, 100u);
+		MAGE_CHECK(128u == tile.m_size);
+		MAGE_CHECK(U32x2(0u, 0u) == tile.m_position);
+		MAGE_CHECK(64u == allocator.Allocate(2u, 1u).m_size);
+		MAGE_CHECK(2u == allocator.GetNumberOfTiles());
+		MAGE_CHECK(128u * 128u + 64u * 64u == allocator.GetNumberOfAllocatedTexels());
+		MAGE_CHECK(Equal(tile, allocator.GetTile(1u)));
+		MAGE_CHECK(IsValid(allocator));
+
+		// Reallocating a key releases its previous tile first.
+		MAGE_CHECK(128u == allocator.Allocate(2u, 128u).m_size);
+		MAGE_CHECK(2u == allocator.GetNumberOfTiles());
+		MAGE_CHECK(2u * 128u * 128u == allocator.GetNumberOfAllocatedTexels());
+
+		allocator.Release(1u);
+		allocator.Release(1u);
+		MAGE_CHECK(!allocator.GetTile(1u).IsAllocated());
+		MAGE_CHECK(1u == allocator.GetNumberOfTiles());
+
+		allocator.Clear();
+		MAGE_CHECK(0u == allocator.GetNumberOfTiles());
+		MAGE_CHECK(512u == allocator.Allocate(3u, 4096u).m_size);
+	}
+
+	MAGE_TEST(ShadowAtlasAllocatorRunsOutOfSpace) {
+		ShadowAtlasAllocator allocator(1024u, 64u);
+
+		for (U64 key = 0u; key < 4u; ++key) {
+			MAGE_CHECK(512u == allocator.Allocate(key, 512u).m_size);
+		}
+		MAGE_CHECK(1024u * 1024u == allocator.GetNumberOfAllocatedTexels());
+		MAGE_CHECK(!allocator.Allocate(4u, 512u).IsAllocated());
+		MAGE_CHECK(!allocator.Allocate(4u, 64u).IsAllocated());
+		MAGE_CHECK(4u == allocator.GetNumberOfTiles());
+		MAGE_CHECK(IsValid(allocator));
+
+		// Releasing a single tile makes room for its size again.
+		allocator.Release(2u);
+		MAGE_CHECK(512u == allocator.Allocate(4u, 512u).m_size);
+	}
+
+	MAGE_TEST(ShadowAtlasAllocatorLimitsFragmentation) {
+		ShadowAtlasAllocator allocator(1024u, 64u);
+
+		// Small tiles are packed into already split nodes.
+		MAGE_CHECK(U32x2(0u,  0u) == allocator.Allocate(0u, 64u).m_position);
+		MAGE_CHECK(U32x2(64u, 0u) == allocator.Allocate(1u, 64u).m_position);
+		MAGE_CHECK(U32x2(512u, 0u) == allocator.Allocate(2u, 512u).m_position);
+		MAGE_CHECK(U32x2(0u, 64u) == allocator.Allocate(3u, 64u).m_position);
+		allocator.Clear();
+
+		// Fill the atlas with 16 256^2 tiles and release a checkerboard.
+		for (U64 key = 0u; key < 16u; ++key) {
+			MAGE_CHECK(256u == allocator.Allocate(key, 256u).m_size);
+		}
+		for (U64 key = 0u; key < 16u; key += 2u) {
+			allocator.Release(key);
+		}
+
+		// Half of the atlas is free, but no 512^2 quadrant.
+		MAGE_CHECK(512u * 1024u == allocator.GetNumberOfAllocatedTexels());
+		MAGE_CHECK(!allocator.Allocate(16u, 512u).IsAllocated());
+
+		// Releasing the remaining tiles of a quadrant merges it.
+		allocator.Release(1u);
+		allocator.Release(3u);
+		MAGE_CHECK(U32x2(0u, 0u) == allocator.Allocate(16u, 512u).m_position);
+		MAGE_CHECK(IsValid(allocator));
+
+		// Releasing all tiles merges the root.
+		allocator.Clear();
+		for (U64 key = 0u; key < 64u; ++key) {
+			MAGE_CHECK(allocator.Allocate(key, 128u).IsAllocated());
+		}
+		for (U64 key = 0u; key < 64u; ++key) {
+			allocator.Release(key);
+		}
+		MAGE_CHECK(1024u == allocator.Allocate(64u, 1024u).m_size);
+	}
+
+	MAGE_TEST(ShadowAtlasAllocatorUpdatesByPriority) {
+		ShadowAtlasAllocator allocator(1024u, 64u);
+		std::vector< ShadowAtlasTile > tiles;
+
+		// The lowest priority request is downsized to the remaining space.
+		std::vector< ShadowAtlasRequest > requests = {
+			{ 10u, 512u, 0.1f },
+			{ 11u, 512u, 0.9f },
+			{ 12u, 512u, 0.8f },
+			{ 13u, 512u, 0.7f },
+			{ 14u, 256u, 0.6f }
+		};
+		allocator.Update(requests, tiles);
+		MAGE_CHECK(5u == tiles.size());
+		MAGE_CHECK(256u == tiles[0].m_size);
+		MAGE_CHECK(512u == tiles[1].m_size);
+		MAGE_CHECK(512u == tiles[2].m_size);
+		MAGE_CHECK(512u == tiles[3].m_size);
+		MAGE_CHECK(256u == tiles[4].m_size);
+		MAGE_CHECK(IsValid(allocator));
+
+		// Tiles shrink with hysteresis.
+		const auto tile1 = tiles[1];
+		const auto tile4 = tiles[4];
+		requests[1].m_size = 256u;
+		requests[2].m_size = 128u;
+		allocator.Update(requests, tiles);
+		MAGE_CHECK(Equal(tile1, tiles[1]));
+		MAGE_CHECK(128u == tiles[2].m_size);
+		MAGE_CHECK(Equal(tile4, tiles[4]));
+		MAGE_CHECK(IsValid(allocator));
+
+		// Unrequested keys lose their tiles, and tiles grow immediately.
+		requests.resize(1u);
+		requests[0].m_size = 512u;
+		allocator.Update(requests, tiles);
+		MAGE_CHECK(1u == allocator.GetNumberOfTiles());
+		MAGE_CHECK(!allocator.GetTile(11u).IsAllocated());
+		MAGE_CHECK(512u == tiles[0].m_size);
+
+		allocator.Update({}, tiles);
+		MAGE_CHECK(0u == allocator.GetNumberOfTiles());
+		MAGE_CHECK(1024u == allocator.Allocate(0u, 1024u).m_size);
+	}
+
+	MAGE_TEST(ShadowAtlasAllocatorKeepsTilesValid) {
+		ShadowAtlasAllocator allocator(4096u, 64u);
+		std::mt19937 generator(1u);
+		std::vector< ShadowAtlasRequest > requests;
+		std::vector< ShadowAtlasTile > tiles;
+
+		for (size_t frame = 0u; frame < 500u; ++frame) {
+			requests.clear();
+			const auto nb_requests = generator() % 40u;
+			for (size_t i = 0u; i < nb_requests; ++i) {
+				ShadowAtlasRequest request;
+				request.m_key = generator() % 60u;
+				if (std::any_of(requests.cbegin(), requests.cend(),
+					[&request](const ShadowAtlasRequest& r) noexcept {
+						return r.m_key == request.m_key;
+					})) {
+					continue;
+				}
+
+				request.m_priority = (generator() % 1000u) / 1000.0f;
+				request.m_size = GetShadowMapSize(request.m_priority, 64u, 2048u);
+				requests.push_back(request);
+			}
+
+			allocator.Update(requests, tiles);
+			MAGE_CHECK(IsValid(allocator));
+
+			const auto nb_tiles = std::count_if(tiles.cbegin(), tiles.cend(),
+				[](const ShadowAtlasTile& tile) noexcept {
+					return tile.IsAllocated();
+				});
+			MAGE_CHECK(static_cast< size_t >(nb_tiles) == allocator.GetNumberOfTiles());
+			for (size_t i = 0u; i < requests.size(); ++i) {
+				MAGE_CHECK(Equal(tiles[i], allocator.GetTile(requests[i].m_key)));
+			}
+		}
+
+		// The same requests keep the same tiles.
+		const auto previous_tiles = tiles;
+		allocator.Update(requests, tiles);
+		for (size_t i = 0u; i < tiles.size(); ++i) {
+			MAGE_CHECK(Equal(previous_tiles[i], tiles[i]));
+		}
+	}
+
+	MAGE_TEST(ShadowMapSizeFollowsPriority) {
+		MAGE_CHECK(2048u == GetShadowMapSize(1.0f, 64u, 2048u));
+		MAGE_CHECK(512u  == GetShadowMapSize(0.3f, 64u, 2048u));
+		MAGE_CHECK(64u   == GetShadowMapSize(0.0f, 64u, 2048u));
+		MAGE_CHECK(64u   == GetShadowMapSize(-1.0f, 64u, 2048u));
+
+		MAGE_CHECK(0.5f  == GetShadowPriority(0.5f, 0.0f, 10.0f, 1.0f));
+		MAGE_CHECK(0.25f == GetShadowPriority(0.5f, 10.0f, 10.0f, 1.0f));
+		MAGE_CHECK(0.0f  == GetShadowPriority(0.5f, 0.0f, 10.0f, -1.0f));
+	}
+}
\ No newline at end of file
@@ -0,0 +1,239 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test\test.hpp"
+#include "renderer\shadow\shadow_cascades.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	using namespace rendering;
+
+	namespace {
+
+		/**
+		 Checks whether the given values are approximately equal.
+
+		 @param[in]		lhs
+						The first value.
+		 @param[in]		rhs
+						The second value.
+		 @param[in]		epsilon
+						The relative tolerance.
+		 @return		@c true if the given values are approximately equal.
+						@c false otherwise.
+		 */
+		[[nodiscard]]
+		bool ApproximatelyEqual(F32 lhs, F32 rhs,
+			                    F32 epsilon = 0.0001f) noexcept {
+
+			return std::abs(lhs - rhs)
+				<= epsilon * std::max(1.0f, std::max(std::abs(lhs), std::abs(rhs)));
+		}
+
+		/**
+		 Returns the projection-to-camera transformation matrix of a
+		 perspective camera.
+
+		 @param[in]		near_plane
+						The view depth of the near plane.
+		 @param[in]		far_plane
+						The view depth of the far plane.
+		 @param[in]		inverted_z
+						@c true if the camera uses an inverted z-buffer.
+						@c false otherwise.
+		 @return		The projection-to-camera transformation matrix.
+		 */
+		[[nodiscard]]
+		const XMMATRIX XM_CALLCONV GetProjectionToCamera(F32 near_plane,
+			                                             F32 far_plane,
+			                                             bool inverted_z) noexcept {
+
+			const auto camera_to_projection = inverted_z
+				? XMMatrixPerspectiveFovLH(XM_PIDIV4, 16.0f / 9.0f, far_plane, near_plane)
+				: XMMatrixPerspectiveFovLH(XM_PIDIV4, 16.0f / 9.0f, near_plane, far_plane);
+			return XMMatrixInverse(nullptr, camera_to_projection);
+		}
+
+		/**
+		 Returns a random camera-to-light transformation matrix consisting
+		 of a rotation and a translation.
+
+		 @param[in,out]	generator
+						A reference to the random number generator.
+		 @return		The camera-to-light transformation matrix.
+		 */
+		[[nodiscard]]
+		const XMMATRIX XM_CALLCONV GetCameraToLight(std::mt19937& generator) {
+			std::uniform_real_distribution< F32 > angle(-XM_PI, XM_PI);
+			std::uniform_real_distribution< F32 > offset(-100.0f, 100.0f);
+
+			return XMMatrixRotationRollPitchYaw(angle(generator),
+				                                angle(generator),
+				                                angle(generator))
+				 * XMMatrixTranslation(offset(generator),
+					                   offset(generator),
+					                   offset(generator));
+		}
+	}
+
+	MAGE_TEST(ShadowCascadeSplitsInterpolateSchemes) {
+		// Uniform scheme
+		const auto uniform = ComputeShadowCascadeSplits(1.0f, 101.0f, 4u, 0.0f);
+		MAGE_CHECK(ApproximatelyEqual(1.0f,   uniform[0]));
+		MAGE_CHECK(ApproximatelyEqual(26.0f,  uniform[1]));
+		MAGE_CHECK(ApproximatelyEqual(51.0f,  uniform[2]));
+		MAGE_CHECK(ApproximatelyEqual(76.0f,  uniform[3]));
+		MAGE_CHECK(ApproximatelyEqual(101.0f, uniform[4]));
+
+		// Logarithmic scheme
+		const auto logarithmic = ComputeShadowCascadeSplits(1.0f, 10000.0f, 4u, 1.0f);
+		MAGE_CHECK(ApproximatelyEqual(1.0f,     logarithmic[0]));
+		MAGE_CHECK(ApproximatelyEqual(10.0f,    logarithmic[1]));
+		MAGE_CHECK(ApproximatelyEqual(100.0f,   logarithmic[2]));
+		MAGE_CHECK(ApproximatelyEqual(1000.0f,  logarithmic[3]));
+		MAGE_CHECK(ApproximatelyEqual(10000.0f, logarithmic[4]));
+
+		// Practical scheme
+		const auto practical  = ComputeShadowCascadeSplits(1.0f, 10000.0f, 4u, 0.5f);
+		const auto uniform2   = ComputeShadowCascadeSplits(1.0f, 10000.0f, 4u, 0.0f);
+		for (size_t i = 0u; i < practical.size(); ++i) {
+			MAGE_CHECK(ApproximatelyEqual(0.5f * (uniform2[i] + logarithmic[i]),
+				                          practical[i]));
+			if (0u != i) {
+				MAGE_CHECK(practical[i - 1u] < practical[i]);
+			}
+		}
+
+		// Fewer cascades fill the remaining splits with the far plane.
+		const auto two = ComputeShadowCascadeSplits(1.0f, 101.0f, 2u, 0.0f);
+		MAGE_CHECK(ApproximatelyEqual(51.0f, two[1]));
+		MAGE_CHECK(101.0f == two[2] && 101.0f == two[3] && 101.0f == two[4]);
+
+		// The number of cascades and the weight are clamped.
+		const auto one = ComputeShadowCascadeSplits(1.0f, 101.0f, 0u, 0.0f);
+		MAGE_CHECK(1.0f == one[0] && 101.0f == one[1]);
+		const auto many = ComputeShadowCascadeSplits(1.0f, 101.0f, 9u, 0.0f);
+		MAGE_CHECK(ApproximatelyEqual(76.0f, many[3]) && 101.0f == many[4]);
+		const auto clamped = ComputeShadowCascadeSplits(1.0f, 10000.0f, 4u, 2.0f);
+		MAGE_CHECK(ApproximatelyEqual(logarithmic[2], clamped[2]));
+
+		// A zero near plane does not break the logarithmic scheme.
+		const auto zero = ComputeShadowCascadeSplits(0.0f, 100.0f, 4u, 1.0f);
+		MAGE_CHECK(0.0f == zero[0] && 100.0f == zero[4]);
+		for (size_t i = 1u; i < zero.size(); ++i) {
+			MAGE_CHECK(std::isfinite(zero[i]) && zero[i - 1u] < zero[i]);
+		}
+	}
+
+	MAGE_TEST(ShadowCascadeViewDepthRange) {
+		for (const bool inverted_z : { false, true }) {
+			const auto range = GetViewDepthRange(
+				GetProjectionToCamera(0.1f, 300.0f, inverted_z));
+			MAGE_CHECK(ApproximatelyEqual(0.1f,   range[0], 0.001f));
+			MAGE_CHECK(ApproximatelyEqual(300.0f, range[1], 0.001f));
+		}
+	}
+
+	MAGE_TEST(ShadowCascadeBoundsSlice) {
+		const auto projection_to_camera = GetProjectionToCamera(0.1f, 300.0f, false);
+		const F32x2 slice(10.0f, 40.0f);
+		const F32x2 clipping_planes(-500.0f, 500.0f);
+
+		const auto reference = ComputeShadowCascade(XMMatrixIdentity(),
+			                                        projection_to_camera,
+			                                        slice, clipping_planes);
+		MAGE_CHECK(0.0f < reference.m_radius);
+		MAGE_CHECK(clipping_planes == reference.m_clipping_planes);
+
+		// The corners of the slice lie inside the bounding sphere.
+		const auto tan_y = std::tan(0.5f * XM_PIDIV4);
+		const auto tan_x = tan_y * 16.0f / 9.0f;
+		for (U32 i = 0u; i < 8u; ++i) {
+			const auto z = slice[(i & 4u) ? 1u : 0u];
+			const auto x = ((i & 1u) ? tan_x : -tan_x) * z - reference.m_center[0];
+			const auto y = ((i & 2u) ? tan_y : -tan_y) * z - reference.m_center[1];
+			MAGE_CHECK(std::sqrt(x * x + y * y) <= reference.m_radius * 1.0001f);
+		}
+
+		// The radius does not depend on the position and orientation of the
+		// camera relative to the light.
+		std::mt19937 generator(1u);
+		for (size_t i = 0u; i < 100u; ++i) {
+			const auto cascade = ComputeShadowCascade(GetCameraToLight(generator),
+				                                      projection_to_camera,
+				                                      slice, clipping_planes);
+			MAGE_CHECK(ApproximatelyEqual(reference.m_radius, cascade.m_radius, 0.001f));
+		}
+	}
+
+	MAGE_TEST(ShadowCascadeSnapsToTexels) {
+		constexpr U32 resolution = 1024u;
+
+		// Far from the light space origin, the F32 precision of the
+		// projection itself exceeds the snapping tolerance.
+		std::mt19937 generator(3u);
+		std::uniform_real_distribution< F32 > position(-100.0f, 100.0f);
+
+		ShadowCascade cascade;
+		cascade.m_radius          = 25.0f;
+		cascade.m_clipping_planes = F32x2(-500.0f, 500.0f);
+
+		const auto texel_size = 2.0f * cascade.m_radius / (resolution - 2u);
+		const auto texel_ndc  = 2.0f / resolution;
+
+		for (size_t i = 0u; i < 1000u; ++i) {
+			cascade.m_center = F32x2(position(generator), position(generator));
+
+			const auto light_to_projection
+				= GetShadowCascadeProjection(cascade, resolution);
+
+			// The sphere stays inside the shadow map.
+			const auto center = XMVector3TransformCoord(
+				XMVectorSet(cascade.m_center[0], cascade.m_center[1], 0.0f, 1.0f),
+				light_to_projection);
+			const auto center_x = XMVectorGetX(center);
+			const auto center_y = XMVectorGetY(center);
+			const auto radius   = texel_ndc * cascade.m_radius / texel_size;
+			MAGE_CHECK(-1.0001f <= center_x - radius && center_x + radius <= 1.0001f);
+			MAGE_CHECK(-1.0001f <= center_y - radius && center_y + radius <= 1.0001f);
+
+			// The origin of the light space is projected on a texel corner,
+			// so the shadow map is only translated by whole texels.
+			const auto origin = XMVector3TransformCoord(
+				XMVectorSet(0.0f, 0.0f, 0.0f, 1.0f), light_to_projection);
+			for (const auto ndc : { XMVectorGetX(origin), XMVectorGetY(origin) }) {
+				const auto texels = ndc / texel_ndc;
+				MAGE_CHECK(std::abs(texels - std::round(texels)) < 0.01f);
+			}
+		}
+
+		// Moving the cascade by less than a texel does not move the map.
+		cascade.m_center = F32x2(10.0f * texel_size + 0.25f * texel_size, 0.0f);
+		const auto projection0 = GetShadowCascadeProjection(cascade, resolution);
+		cascade.m_center[0] += 0.5f * texel_size;
+		const auto projection1 = GetShadowCascadeProjection(cascade, resolution);
+		MAGE_CHECK(XMVectorGetX(projection0.r[3]) == XMVectorGetX(projection1.r[3]));
+		cascade.m_center[0] += 0.5f * texel_size;
+		const auto projection2 = GetShadowCascadeProjection(cascade, resolution);
+		MAGE_CHECK(ApproximatelyEqual(XMVectorGetX(projection0.r[3]) - texel_ndc,
+			                          XMVectorGetX(projection2.r[3]), 0.001f));
+	}
+}
\ No newline at end of file
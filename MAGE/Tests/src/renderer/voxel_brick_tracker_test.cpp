@@ -0,0 +1,374 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test\test.hpp"
+#include "renderer\voxel_brick_tracker.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <limits>
+#include <random>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	using namespace rendering;
+
+	namespace {
+
+		/**
+		 Returns the flat brick index of the given brick of a voxel grid
+		 with 8 bricks per axis.
+
+		 @param[in]		x
+						The x brick index.
+		 @param[in]		y
+						The y brick index.
+		 @param[in]		z
+						The z brick index.
+		 @return		The flat brick index.
+		 */
+		[[nodiscard]]
+		constexpr U32 GetIndex(U32 x, U32 y, U32 z) noexcept {
+			return x + 8u * (y + 8u * z);
+		}
+
+		/**
+		 Checks whether the given brick is dirty.
+
+		 @param[in]		tracker
+						A reference to the voxel brick tracker.
+		 @param[in]		index
+						The flat brick index.
+		 @return		@c true if the given brick is dirty. @c false
+						otherwise.
+		 */
+		[[nodiscard]]
+		bool IsDirtyBrick(const VoxelBrickTracker& tracker, U32 index) {
+			if (tracker.IsAllDirty()) {
+				return true;
+			}
+
+			const auto& bricks = tracker.GetDirtyBricks();
+			return bricks.cend() != std::find(bricks.cbegin(), bricks.cend(), index);
+		}
+
+		/**
+		 Returns a 64^3 voxel brick tracker with 8^3 bricks and unit voxels
+		 centered at the origin, without dirty bricks.
+
+		 @param[in]		clipmap
+						@c true if the voxel grid is a clipmap. @c false
+						otherwise.
+		 @return		The voxel brick tracker.
+		 */
+		[[nodiscard]]
+		VoxelBrickTracker CreateTracker(bool clipmap) {
+			VoxelBrickTracker tracker(64u, 8u);
+			tracker.SetGrid(F32x3(0.0f, 0.0f, 0.0f), 1.0f, clipmap);
+			tracker.ClearDirty();
+			return tracker;
+		}
+
+		/**
+		 Simulates the given number of frames of a scene of tracked objects
+		 of which the given number of objects move each frame.
+
+		 @param[in]		nb_objects
+						The number of objects.
+		 @param[in]		nb_moving_objects
+						The number of moving objects.
+		 @param[in]		camera_speed
+						The distance in world space the clipmap center moves
+						each frame. Zero for a fixed voxel grid.
+		 @param[in]		nb_frames
+						The number of frames.
+		 @param[out]	nb_dirty_bricks
+						The average number of dirty bricks per frame.
+		 @return		The average time in seconds per frame.
+		 */
+		[[nodiscard]]
+		F64 SimulateFrames(size_t nb_objects,
+			               size_t nb_moving_objects,
+			               F32 camera_speed,
+			               size_t nb_frames,
+			               F64& nb_dirty_bricks) {
+
+			constexpr F32 voxel_size  = 0.08f;
+			constexpr F32 object_size = 0.5f;
+
+			// 256^3 voxels and 32^3 bricks covering a 20.48^3 region.
+			VoxelBrickTracker tracker(256u, 8u);
+			const bool clipmap = 0.0f != camera_speed;
+
+			std::mt19937 generator(1u);
+			std::uniform_real_distribution< F32 > distribution(-9.0f, 9.0f);
+			std::vector< F32x3 > positions(nb_objects);
+			for (auto& position : positions) {
+				position = F32x3(distribution(generator),
+					             distribution(generator),
+					             distribution(generator));
+			}
+
+			size_t total_nb_dirty_bricks = 0u;
+
+			const auto time = Measure([&]() {
+				for (size_t frame = 0u; frame < nb_frames; ++frame) {
+					const auto x = camera_speed * static_cast< F32 >(frame);
+					tracker.SetGrid(F32x3(x, 0.0f, 0.0f), voxel_size, clipmap);
+
+					for (size_t i = 0u; i < nb_objects; ++i) {
+						auto& p_min = positions[i];
+						if (i < nb_moving_objects) {
+							p_min[0] += 0.01f;
+						}
+						const F32x3 p_max(p_min[0] + object_size,
+							              p_min[1] + object_size,
+							              p_min[2] + object_size);
+						tracker.Track(static_cast< U64 >(i), p_min, p_max);
+					}
+					tracker.Prune();
+
+					// The first frame always revoxelizes the whole grid.
+					if (0u != frame) {
+						total_nb_dirty_bricks += tracker.GetNumberOfDirtyBricks();
+					}
+					tracker.ClearDirty();
+				}
+			});
+
+			nb_dirty_bricks = static_cast< F64 >(total_nb_dirty_bricks)
+				            / static_cast< F64 >(nb_frames - 1u);
+
+			return time / static_cast< F64 >(nb_frames);
+		}
+	}
+
+	MAGE_TEST(VoxelBrickTrackerMarksRegions) {
+		VoxelBrickTracker tracker(64u, 8u);
+		MAGE_CHECK(512u == tracker.GetNumberOfBricks());
+		MAGE_CHECK(tracker.IsAllDirty());
+		MAGE_CHECK(512u == tracker.GetNumberOfDirtyBricks());
+
+		tracker.SetGrid(F32x3(0.0f, 0.0f, 0.0f), 1.0f, false);
+		tracker.ClearDirty();
+		MAGE_CHECK(!tracker.IsDirty());
+
+		// [1.5, 6] dilated by one voxel stays within brick [0, 8).
+		tracker.MarkDirty(F32x3(1.5f, 1.5f, 1.5f), F32x3(6.0f, 6.0f, 6.0f));
+		MAGE_CHECK(1u == tracker.GetNumberOfDirtyBricks());
+		MAGE_CHECK(GetIndex(4u, 4u, 4u) == tracker.GetDirtyBricks()[0]);
+		MAGE_CHECK(U32x3(4u, 4u, 4u) == tracker.GetBrick(GetIndex(4u, 4u, 4u)));
+		MAGE_CHECK(tracker.IsDirty(F32x3(2.0f, 2.0f, 2.0f), F32x3(3.0f, 3.0f, 3.0f)));
+		MAGE_CHECK(!tracker.IsDirty(F32x3(-20.0f, -20.0f, -20.0f),
+			                        F32x3(-19.0f, -19.0f, -19.0f)));
+
+		// The dilation reaches into the neighbouring brick.
+		tracker.MarkDirty(F32x3(1.5f, 1.5f, 1.5f), F32x3(7.5f, 6.0f, 6.0f));
+		MAGE_CHECK(2u == tracker.GetNumberOfDirtyBricks());
+		MAGE_CHECK(IsDirtyBrick(tracker, GetIndex(5u, 4u, 4u)));
+
+		tracker.ClearDirty();
+		MAGE_CHECK(!tracker.IsDirty());
+
+		// Regions outside the grid, empty regions and NaNs are ignored.
+		const auto inf = std::numeric_limits< F32 >::infinity();
+		const auto nan = std::numeric_limits< F32 >::quiet_NaN();
+		tracker.MarkDirty(F32x3(100.0f, 0.0f, 0.0f), F32x3(101.0f, 1.0f, 1.0f));
+		tracker.MarkDirty(F32x3(inf, inf, inf), F32x3(-inf, -inf, -inf));
+		tracker.MarkDirty(F32x3(nan, 0.0f, 0.0f), F32x3(1.0f, 1.0f, 1.0f));
+		MAGE_CHECK(!tracker.IsDirty());
+
+		// Marking every brick switches to all dirty.
+		tracker.MarkDirty(F32x3(-inf, -inf, -inf), F32x3(inf, inf, inf));
+		MAGE_CHECK(tracker.IsAllDirty());
+	}
+
+	MAGE_TEST(VoxelBrickTrackerMatchesBruteForce) {
+		auto tracker = CreateTracker(false);
+
+		std::mt19937 generator(7u);
+		std::uniform_real_distribution< F32 > distribution(-40.0f, 40.0f);
+
+		for (size_t i = 0u; i < 2000u; ++i) {
+			const F32x3 p_min(distribution(generator),
+				              distribution(generator),
+				              distribution(generator));
+			F32x3 p_max = p_min;
+			for (size_t j = 0u; j < 3u; ++j) {
+				p_max[j] += 0.2f * std::abs(distribution(generator));
+			}
+
+			bool expected = false;
+			for (const auto index : tracker.GetDirtyBricks()) {
+				const auto brick = tracker.GetBrick(index);
+				bool overlaps = true;
+				for (size_t j = 0u; j < 3u; ++j) {
+					const auto b_min = -32.0f + 8.0f * brick[j];
+					overlaps = overlaps
+						    && p_min[j] - 1.0f < b_min + 8.0f
+						    && p_max[j] + 1.0f >= b_min;
+				}
+				expected = expected || overlaps;
+			}
+
+			MAGE_CHECK(tracker.IsAllDirty()
+				       || expected == tracker.IsDirty(p_min, p_max));
+
+			if (0u == i % 3u) {
+				tracker.MarkDirty(p_min, p_max);
+			}
+			if (0u == i % 50u) {
+				tracker.ClearDirty();
+			}
+		}
+	}
+
+	MAGE_TEST(VoxelBrickTrackerTracksObjects) {
+		auto tracker = CreateTracker(false);
+		const F32x3 p_min(1.5f, 1.5f, 1.5f);
+		const F32x3 p_max(6.0f, 6.0f, 6.0f);
+
+		MAGE_CHECK(tracker.Track(1u, p_min, p_max));
+		MAGE_CHECK(1u == tracker.GetNumberOfDirtyBricks());
+		MAGE_CHECK(1u == tracker.GetNumberOfTrackedObjects());
+		tracker.ClearDirty();
+
+		// Unchanged objects do not dirty bricks.
+		MAGE_CHECK(!tracker.Track(1u, p_min, p_max));
+		MAGE_CHECK(!tracker.IsDirty());
+
+		// Moved objects dirty their previous and current bricks.
+		const F32x3 moved_min(-30.0f, 1.5f, 1.5f);
+		const F32x3 moved_max(-28.0f, 6.0f, 6.0f);
+		MAGE_CHECK(tracker.Track(1u, moved_min, moved_max));
+		MAGE_CHECK(2u == tracker.GetNumberOfDirtyBricks());
+		MAGE_CHECK(IsDirtyBrick(tracker, GetIndex(4u, 4u, 4u)));
+		MAGE_CHECK(IsDirtyBrick(tracker, GetIndex(0u, 4u, 4u)));
+		tracker.ClearDirty();
+
+		// Changed signatures dirty the current bricks.
+		MAGE_CHECK(tracker.Track(1u, moved_min, moved_max, 7u));
+		MAGE_CHECK(1u == tracker.GetNumberOfDirtyBricks());
+		tracker.ClearDirty();
+
+		// Objects tracked since the previous prune survive the next prune.
+		tracker.Prune();
+		MAGE_CHECK(!tracker.IsDirty());
+		MAGE_CHECK(1u == tracker.GetNumberOfTrackedObjects());
+
+		// Removed objects dirty their last bricks.
+		tracker.Prune();
+		MAGE_CHECK(0u == tracker.GetNumberOfTrackedObjects());
+		MAGE_CHECK(1u == tracker.GetNumberOfDirtyBricks());
+		MAGE_CHECK(IsDirtyBrick(tracker, GetIndex(0u, 4u, 4u)));
+	}
+
+	MAGE_TEST(VoxelBrickTrackerInvalidatesFixedGrids) {
+		auto tracker = CreateTracker(false);
+
+		tracker.SetGrid(F32x3(0.0f, 0.0f, 0.0f), 1.0f, false);
+		MAGE_CHECK(!tracker.IsDirty());
+
+		tracker.SetGrid(F32x3(1.0f, 0.0f, 0.0f), 1.0f, false);
+		MAGE_CHECK(tracker.IsAllDirty());
+		tracker.ClearDirty();
+
+		tracker.SetGrid(F32x3(1.0f, 0.0f, 0.0f), 0.5f, false);
+		MAGE_CHECK(tracker.IsAllDirty());
+		tracker.ClearDirty();
+
+		tracker.SetGrid(F32x3(1.0f, 0.0f, 0.0f), 0.5f, true);
+		MAGE_CHECK(tracker.IsAllDirty());
+		MAGE_CHECK(tracker.IsClipmap());
+	}
+
+	MAGE_TEST(VoxelBrickTrackerScrollsClipmaps) {
+		VoxelBrickTracker tracker(64u, 8u);
+
+		// The center is snapped to the nearest brick corner.
+		tracker.SetGrid(F32x3(3.0f, -2.0f, 0.0f), 1.0f, true);
+		MAGE_CHECK(tracker.IsAllDirty());
+		MAGE_CHECK(S32x3(-4, -4, -4) == tracker.GetOrigin());
+		MAGE_CHECK(F32x3(0.0f, 0.0f, 0.0f) == tracker.GetCenter());
+		tracker.ClearDirty();
+
+		tracker.SetGrid(F32x3(3.0f, -2.0f, 0.0f), 1.0f, true);
+		MAGE_CHECK(!tracker.IsDirty());
+
+		// Pending dirty bricks move with the clipmap, and only the slab
+		// entering the clipmap becomes dirty.
+		tracker.MarkDirty(F32x3(9.0f, 1.0f, 1.0f), F32x3(10.0f, 2.0f, 2.0f));
+		MAGE_CHECK(IsDirtyBrick(tracker, GetIndex(5u, 4u, 4u)));
+		tracker.SetGrid(F32x3(8.0f, 0.0f, 0.0f), 1.0f, true);
+		MAGE_CHECK(S32x3(-3, -4, -4) == tracker.GetOrigin());
+		MAGE_CHECK(F32x3(8.0f, 0.0f, 0.0f) == tracker.GetCenter());
+		MAGE_CHECK(64u + 1u == tracker.GetNumberOfDirtyBricks());
+		MAGE_CHECK(IsDirtyBrick(tracker, GetIndex(4u, 4u, 4u)));
+		MAGE_CHECK(IsDirtyBrick(tracker, GetIndex(7u, 0u, 0u)));
+		MAGE_CHECK(!IsDirtyBrick(tracker, GetIndex(6u, 0u, 0u)));
+		tracker.ClearDirty();
+
+		// Two slabs along x and y sharing 2 x 2 x 8 bricks.
+		tracker.SetGrid(F32x3(-8.0f, -16.0f, 0.0f), 1.0f, true);
+		MAGE_CHECK(128u + 128u - 32u == tracker.GetNumberOfDirtyBricks());
+		tracker.ClearDirty();
+
+		// Scrolling past the clipmap dirties every brick.
+		tracker.SetGrid(F32x3(1000.0f, 0.0f, 0.0f), 1.0f, true);
+		MAGE_CHECK(tracker.IsAllDirty());
+	}
+
+	MAGE_BENCHMARK(VoxelBrickTrackerFrameCost) {
+		constexpr size_t nb_objects = 2000u;
+		constexpr size_t nb_frames  = 500u;
+
+		// The dirty bricks are the revoxelization cost on the GPU, relative
+		// to revoxelizing all 32^3 bricks each frame.
+		std::printf("moving objects  camera  CPU [us/frame]"
+			        "  dirty bricks/frame  revoxelized\n");
+
+		const struct {
+			size_t m_nb_moving_objects;
+			F32 m_camera_speed;
+		} scenarios[] = {
+			{ 0u,   0.0f  },
+			{ 20u,  0.0f  },
+			{ 200u, 0.0f  },
+			{ 0u,   0.08f },
+			{ 20u,  0.08f },
+			{ 20u,  0.64f }
+		};
+
+		for (const auto& scenario : scenarios) {
+			F64 nb_dirty_bricks = 0.0;
+			const auto time = SimulateFrames(nb_objects,
+				                             scenario.m_nb_moving_objects,
+				                             scenario.m_camera_speed,
+				                             nb_frames,
+				                             nb_dirty_bricks);
+
+			std::printf("%14zu  %6.2f  %14.1f  %18.1f  %10.2f%%\n",
+				        scenario.m_nb_moving_objects,
+				        scenario.m_camera_speed,
+				        time * 1e6,
+				        nb_dirty_bricks,
+				        100.0 * nb_dirty_bricks / (32.0 * 32.0 * 32.0));
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,188 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test\test.hpp"
+#include "renderer\voxelization\voxelizer.hpp"
+#include "loaders\vxb\vxb_loader.hpp"
+#include "exception\exception.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <cmath>
+#include <filesystem>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	using namespace rendering;
+
+	namespace {
+
+		/**
+		 Returns the voxelizer descriptor of the tests: 16 voxels of size 1
+		 per axis centered around the origin (i.e. the voxel with index i
+		 along an axis covers [i - 8, i - 7]), and bricks of 4 voxels per
+		 axis.
+
+		 @return		The voxelizer descriptor.
+		 */
+		[[nodiscard]]
+		const VoxelizerDescriptor GetDescriptor() noexcept {
+			return VoxelizerDescriptor(F32x3(), 16u, 1.0f, 4u);
+		}
+
+		/**
+		 Returns the emissive material of the tests.
+
+		 @return		The emissive material.
+		 */
+		[[nodiscard]]
+		const BakingScene::Material GetMaterial() noexcept {
+			BakingScene::Material material;
+			material.m_base_color = RGBA(0.5f, 0.25f, 1.0f, 1.0f);
+			material.m_emissive   = true;
+			return material;
+		}
+
+		/**
+		 Voxelizes the square [-1.5, 1.5] x [-1.5, 1.5] in the plane
+		 z = 0.5, which occupies the voxels [6, 9] x [6, 9] x [8, 8]. The
+		 normal of the square points to -z.
+
+		 @return		The sparse voxel grid of the square.
+		 */
+		[[nodiscard]]
+		const SparseVoxelGrid VoxelizeSquare() {
+			const std::vector< F32x3 > vertices = {
+				{ -1.5f, -1.5f, 0.5f }, { -1.5f,  1.5f, 0.5f }, {  1.5f,  1.5f, 0.5f },
+				{ -1.5f, -1.5f, 0.5f }, {  1.5f,  1.5f, 0.5f }, {  1.5f, -1.5f, 0.5f }
+			};
+
+			return Voxelize(BakingScene(vertices, GetMaterial()),
+							GetDescriptor());
+		}
+
+		/**
+		 Checks whether constructing a sparse voxel grid with the given
+		 arguments and a single voxel per brick throws.
+
+		 @param[in]		resolution
+						The resolution of the voxel grid.
+		 @param[in]		bricks
+						The packed brick coordinates.
+		 @return		@c true if constructing the sparse voxel grid throws.
+						@c false otherwise.
+		 */
+		[[nodiscard]]
+		bool Throws(U32 resolution, const std::vector< U32 >& bricks) {
+			std::vector< U32 > masks;
+			for (size_t i = 0u; i < bricks.size(); ++i) {
+				masks.push_back(1u);
+				masks.push_back(0u);
+			}
+
+			try {
+				const SparseVoxelGrid grid(F32x3(), resolution, 1.0f, 4u,
+					bricks, std::move(masks),
+					std::vector< SparseVoxelGrid::PackedVoxel >(bricks.size()));
+			}
+			catch (const Exception&) {
+				return true;
+			}
+
+			return false;
+		}
+	}
+
+	MAGE_TEST(VoxelizerOccupiesOverlappedVoxels) {
+		const auto grid = VoxelizeSquare();
+
+		MAGE_CHECK(16u == grid.GetResolution());
+		MAGE_CHECK(4u  == grid.GetBrickSize());
+		// The square overlaps the bricks [1, 2] x [1, 2] x [2, 2].
+		MAGE_CHECK(4u  == grid.GetBricks().size());
+		MAGE_CHECK(16u == grid.GetVoxels().size());
+
+		const auto& material = GetMaterial();
+		for (U32 y = 6u; y <= 9u; ++y) {
+			for (U32 x = 6u; x <= 9u; ++x) {
+				SparseVoxelGrid::Voxel voxel;
+				MAGE_CHECK(grid.GetVoxel({ x, y, 8u }, voxel));
+
+				for (size_t i = 0u; i < 3u; ++i) {
+					MAGE_CHECK(std::abs(voxel.m_radiance[i]
+						                - material.m_base_color[i]) < 0.01f);
+					MAGE_CHECK(std::abs(voxel.m_albedo[i]
+						                - material.m_base_color[i]) < 0.01f);
+				}
+				MAGE_CHECK(std::abs(voxel.m_normal[0])        < 0.001f);
+				MAGE_CHECK(std::abs(voxel.m_normal[1])        < 0.001f);
+				MAGE_CHECK(std::abs(voxel.m_normal[2] + 1.0f) < 0.001f);
+			}
+		}
+
+		SparseVoxelGrid::Voxel voxel;
+		MAGE_CHECK(!grid.GetVoxel({ 7u, 7u, 7u }, voxel));
+		MAGE_CHECK(!grid.GetVoxel({ 7u, 7u, 9u }, voxel));
+		MAGE_CHECK(!grid.GetVoxel({ 5u, 7u, 8u }, voxel));
+		MAGE_CHECK(!grid.GetVoxel({ 7u, 10u, 8u }, voxel));
+		MAGE_CHECK(!grid.GetVoxel({ 16u, 7u, 8u }, voxel));
+	}
+
+	MAGE_TEST(VoxelizerRoundTripsThroughVXBFiles) {
+		const auto grid = VoxelizeSquare();
+
+		const auto path = std::filesystem::temp_directory_path()
+			            / L"mage_voxelizer_test.vxb";
+		loader::ExportSparseVoxelGridToFile(path, grid);
+
+		SparseVoxelGrid imported;
+		loader::ImportSparseVoxelGridFromFile(path, imported);
+		std::filesystem::remove(path);
+
+		MAGE_CHECK(grid.GetCenter()     == imported.GetCenter());
+		MAGE_CHECK(grid.GetResolution() == imported.GetResolution());
+		MAGE_CHECK(grid.GetVoxelSize()  == imported.GetVoxelSize());
+		MAGE_CHECK(grid.GetBrickSize()  == imported.GetBrickSize());
+		MAGE_CHECK(grid.GetBricks()     == imported.GetBricks());
+		MAGE_CHECK(grid.GetMasks()      == imported.GetMasks());
+
+		const auto& voxels          = grid.GetVoxels();
+		const auto& imported_voxels = imported.GetVoxels();
+		MAGE_CHECK(voxels.size() == imported_voxels.size());
+		for (size_t i = 0u; i < voxels.size() && i < imported_voxels.size(); ++i) {
+			MAGE_CHECK(voxels[i].m_radiance == imported_voxels[i].m_radiance);
+			MAGE_CHECK(voxels[i].m_albedo   == imported_voxels[i].m_albedo);
+			MAGE_CHECK(voxels[i].m_normal   == imported_voxels[i].m_normal);
+		}
+	}
+
+	MAGE_TEST(SparseVoxelGridRejectsInvalidBricks) {
+		using Brick = U32x3;
+		const auto pack = [](const Brick& brick) noexcept {
+			return SparseVoxelGrid::PackBrick(brick);
+		};
+
+		MAGE_CHECK(!Throws(16u, { pack({ 0u, 0u, 0u }), pack({ 3u, 3u, 3u }) }));
+		// The resolution is no multiple of the brick size.
+		MAGE_CHECK(Throws(15u, { pack({ 0u, 0u, 0u }) }));
+		// The bricks lie outside the voxel grid.
+		MAGE_CHECK(Throws(16u, { pack({ 4u, 0u, 0u }) }));
+		MAGE_CHECK(Throws(16u, { pack({ 0u, 0u, 4u }) }));
+		MAGE_CHECK(Throws(16u, { pack({ 0u, 0u, 0u }) | (1u << 30u) }));
+		// The bricks are unsorted or duplicate.
+		MAGE_CHECK(Throws(16u, { pack({ 1u, 0u, 0u }), pack({ 0u, 0u, 0u }) }));
+		MAGE_CHECK(Throws(16u, { pack({ 1u, 0u, 0u }), pack({ 1u, 0u, 0u }) }));
+	}
+}
\ No newline at end of file
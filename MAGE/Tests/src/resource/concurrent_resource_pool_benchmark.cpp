@@ -0,0 +1,182 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test\test.hpp"
+#include "resource\concurrent_resource_pool.hpp"
+#include "resource\resource_pool.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <atomic>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	namespace {
+
+		/**
+		 A struct of resources identified by a name.
+		 */
+		struct NamedResource final {
+
+		public:
+
+			//-----------------------------------------------------------------
+			// Constructors and Destructors
+			//-----------------------------------------------------------------
+
+			/**
+			 Constructs a named resource.
+
+			 @param[in]		name
+							The name.
+			 */
+			explicit NamedResource(std::wstring name)
+				: m_name(std::move(name)) {}
+
+			//-----------------------------------------------------------------
+			// Member Variables
+			//-----------------------------------------------------------------
+
+			/**
+			 The name of this named resource.
+			 */
+			std::wstring m_name;
+		};
+
+		/**
+		 Returns the names of the resources shared by all threads. The names
+		 resemble shader GUIDs.
+
+		 @return		The names.
+		 */
+		[[nodiscard]]
+		const std::vector< std::wstring > GetNames() {
+			std::vector< std::wstring > names;
+			names.reserve(96u);
+			for (size_t i = 0u; i < 96u; ++i) {
+				names.push_back(L"SHADER_PIXEL_FORWARD_VARIANT_"
+					            + std::to_wstring(i * 7919u));
+			}
+			return names;
+		}
+
+		/**
+		 Looks up the given names from the given number of threads
+		 concurrently.
+
+		 @tparam		PoolT
+						The resource pool type.
+		 @param[in]		pool
+						A reference to the resource pool.
+		 @param[in]		names
+						A reference to the names.
+		 @param[in]		nb_threads
+						The number of threads.
+		 @param[in]		nb_lookups
+						The number of lookups per thread.
+		 @return		The number of lookups per second.
+		 */
+		template< typename PoolT >
+		[[nodiscard]]
+		F64 MeasureLookups(PoolT& pool,
+			               const std::vector< std::wstring >& names,
+			               size_t nb_threads,
+			               size_t nb_lookups) {
+
+			std::atomic< size_t > checksum = 0u;
+
+			const auto time = Measure([&]() {
+				std::vector< std::thread > threads;
+				threads.reserve(nb_threads);
+				for (size_t t = 0u; t < nb_threads; ++t) {
+					threads.emplace_back([&, t]() {
+						size_t sum = 0u;
+						for (size_t i = 0u; i < nb_lookups; ++i) {
+							const auto& name = names[(i * 31u + t) % names.size()];
+							sum += pool.GetOrCreate(name, name)->m_name.size();
+						}
+						checksum += sum;
+					});
+				}
+
+				for (auto& thread : threads) {
+					thread.join();
+				}
+			});
+
+			MAGE_CHECK(0u < checksum);
+
+			return static_cast< F64 >(nb_threads * nb_lookups) / time;
+		}
+	}
+
+	MAGE_TEST(ConcurrentResourcePoolSharesResources) {
+		ConcurrentResourcePool< std::wstring, NamedResource > pool;
+		const auto names = GetNames();
+
+		std::vector< SharedPtr< NamedResource > > resources(4u * names.size());
+		std::vector< std::thread > threads;
+		for (size_t t = 0u; t < 4u; ++t) {
+			threads.emplace_back([&, t]() {
+				for (size_t i = 0u; i < names.size(); ++i) {
+					resources[t * names.size() + i]
+						= pool.GetOrCreate(names[i], names[i]);
+				}
+			});
+		}
+		for (auto& thread : threads) {
+			thread.join();
+		}
+
+		MAGE_CHECK(names.size() == pool.size());
+		for (size_t i = 0u; i < names.size(); ++i) {
+			const auto resource = pool.Get(std::wstring_view(names[i]));
+			MAGE_CHECK(resource && names[i] == resource->m_name);
+			for (size_t t = 0u; t < 4u; ++t) {
+				MAGE_CHECK(resource == resources[t * names.size() + i]);
+			}
+		}
+
+		pool.Remove(names[0]);
+		MAGE_CHECK(!pool.Contains(names[0]));
+		MAGE_CHECK(names.size() - 1u == pool.size());
+	}
+
+	MAGE_BENCHMARK(ConcurrentResourcePoolContention) {
+		constexpr size_t nb_lookups = 200000u;
+
+		const auto names = GetNames();
+		PersistentResourcePool< std::wstring, NamedResource > locked_pool;
+		ConcurrentResourcePool< std::wstring, NamedResource > sharded_pool;
+
+		std::printf("hardware threads: %u\n",
+			        std::thread::hardware_concurrency());
+		std::printf("threads  single lock [M/s]  sharded [M/s]  speedup\n");
+
+		for (size_t nb_threads = 1u; nb_threads <= 32u; nb_threads *= 2u) {
+			const auto locked  = MeasureLookups(locked_pool,  names,
+				                                nb_threads, nb_lookups);
+			const auto sharded = MeasureLookups(sharded_pool, names,
+				                                nb_threads, nb_lookups);
+
+			std::printf("%7zu  %16.2f  %13.2f  %7.2f\n", nb_threads,
+				        locked * 1e-6, sharded * 1e-6, sharded / locked);
+		}
+	}
+}
\ No newline at end of file
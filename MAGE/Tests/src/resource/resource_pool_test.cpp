@@ -0,0 +1,227 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test\test.hpp"
+#include "resource\resource_pool.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <optional>
+#include <stdexcept>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	namespace {
+
+		/**
+		 A struct of resources with a given size.
+		 */
+		struct SizedResource final {
+
+		public:
+
+			//-----------------------------------------------------------------
+			// Constructors and Destructors
+			//-----------------------------------------------------------------
+
+			/**
+			 Constructs a sized resource.
+
+			 @param[in]		size
+							The size (in bytes).
+			 @throws		std::invalid_argument
+							The given size is zero.
+			 */
+			explicit SizedResource(size_t size)
+				: m_size(size) {
+
+				if (0u == size) {
+					throw std::invalid_argument("Empty resource");
+				}
+			}
+
+			//-----------------------------------------------------------------
+			// Member Methods
+			//-----------------------------------------------------------------
+
+			/**
+			 Returns the size (in bytes) of this sized resource.
+
+			 @return		The size (in bytes) of this sized resource.
+			 */
+			[[nodiscard]]
+			size_t GetSizeInBytes() const noexcept {
+				return m_size;
+			}
+
+			//-----------------------------------------------------------------
+			// Member Variables
+			//-----------------------------------------------------------------
+
+			/**
+			 The size (in bytes) of this sized resource.
+			 */
+			size_t m_size;
+		};
+
+		/**
+		 A resource pool of sized resources.
+		 */
+		using SizedResourcePool = ResourcePool< U32, SizedResource >;
+
+		/**
+		 Creates and immediately releases the resource corresponding to the
+		 given key of the given resource pool.
+
+		 @param[in]		pool
+						A reference to the resource pool.
+		 @param[in]		key
+						The key of the resource.
+		 */
+		void Load(SizedResourcePool& pool, U32 key) {
+			const auto resource = pool.GetOrCreate(key, size_t(100u));
+			MAGE_CHECK(resource && 100u == resource->GetSizeInBytes());
+		}
+	}
+
+	MAGE_TEST(ResourcePoolEvictsCachedResourcesInLeastRecentlyUsedOrder) {
+		SizedResourcePool pool(300u);
+
+		Load(pool, 0u);
+		Load(pool, 1u);
+		Load(pool, 2u);
+		// Resource 0 becomes the most recently used resource.
+		Load(pool, 0u);
+		Load(pool, 3u);
+
+		MAGE_CHECK(pool.Contains(0u));
+		MAGE_CHECK(!pool.Contains(1u));
+		MAGE_CHECK(pool.Contains(2u));
+		MAGE_CHECK(pool.Contains(3u));
+
+		const auto statistics = pool.GetStatistics();
+		MAGE_CHECK(3u   == statistics.m_nb_resident_resources);
+		MAGE_CHECK(300u == statistics.m_resident_size);
+		MAGE_CHECK(3u   == statistics.m_nb_cached_resources);
+		MAGE_CHECK(300u == statistics.m_cached_size);
+		MAGE_CHECK(1u   == statistics.m_nb_evicted_resources);
+		MAGE_CHECK(100u == statistics.m_evicted_size);
+	}
+
+	MAGE_TEST(ResourcePoolKeepsReferencedResources) {
+		SizedResourcePool pool(200u);
+
+		auto resource = pool.GetOrCreate(0u, size_t(100u));
+		MAGE_CHECK(resource == pool.Get(0u));
+
+		Load(pool, 1u);
+		Load(pool, 2u);
+		Load(pool, 3u);
+
+		// The least recently used resource is referenced.
+		MAGE_CHECK(pool.Contains(0u));
+		MAGE_CHECK(!pool.Contains(1u));
+		MAGE_CHECK(!pool.Contains(2u));
+		MAGE_CHECK(pool.Contains(3u));
+
+		auto statistics = pool.GetStatistics();
+		MAGE_CHECK(2u   == statistics.m_nb_resident_resources);
+		MAGE_CHECK(1u   == statistics.m_nb_cached_resources);
+		MAGE_CHECK(100u == statistics.m_cached_size);
+
+		// A copy keeps the resource referenced.
+		auto copy = resource;
+		resource.reset();
+		MAGE_CHECK(1u == pool.GetStatistics().m_nb_cached_resources);
+
+		pool.SetBudget(100u);
+		MAGE_CHECK(pool.Contains(0u));
+		MAGE_CHECK(!pool.Contains(3u));
+
+		statistics = pool.GetStatistics();
+		MAGE_CHECK(1u == statistics.m_nb_resident_resources);
+		MAGE_CHECK(0u == statistics.m_nb_cached_resources);
+		MAGE_CHECK(0u == statistics.m_cached_size);
+
+		// Releasing the last reference caches the resource again.
+		copy.reset();
+		MAGE_CHECK(1u == pool.GetStatistics().m_nb_cached_resources);
+		MAGE_CHECK(pool.Contains(0u));
+	}
+
+	MAGE_TEST(ResourcePoolCachesReleasedResources) {
+		SizedResourcePool pool(100u);
+
+		auto resource = pool.GetOrCreate(0u, size_t(100u));
+		Load(pool, 1u);
+		// The resident resources exceed the budget, but no resource is
+		// cached.
+		MAGE_CHECK(pool.Contains(0u));
+		MAGE_CHECK(pool.Contains(1u));
+
+		resource.reset();
+
+		const auto statistics = pool.GetStatistics();
+		MAGE_CHECK(statistics.m_nb_resident_resources
+			       == statistics.m_nb_cached_resources);
+		MAGE_CHECK(statistics.m_resident_size == statistics.m_cached_size);
+
+		// Resource 0 is released more recently than resource 1.
+		pool.Trim();
+		MAGE_CHECK(pool.Contains(0u));
+		MAGE_CHECK(!pool.Contains(1u));
+		MAGE_CHECK(100u == pool.GetStatistics().m_resident_size);
+	}
+
+	MAGE_TEST(ResourcePoolReferencesOutliveThePool) {
+		SharedPtr< SizedResource > removed;
+		SharedPtr< SizedResource > resource;
+		{
+			SizedResourcePool pool;
+			removed  = pool.GetOrCreate(0u, size_t(100u));
+			resource = pool.GetOrCreate(1u, size_t(200u));
+
+			pool.Remove(0u);
+			MAGE_CHECK(!pool.Contains(0u));
+			removed.reset();
+
+			std::optional< SizedResourcePool > moved(std::move(pool));
+			MAGE_CHECK(moved->Contains(1u));
+			MAGE_CHECK(resource == moved->Get(1u));
+		}
+
+		MAGE_CHECK(200u == resource->GetSizeInBytes());
+		resource.reset();
+	}
+
+	MAGE_TEST(ResourcePoolForwardsConstructionExceptions) {
+		SizedResourcePool pool;
+
+		auto thrown = false;
+		try {
+			const auto resource = pool.GetOrCreate(0u, size_t(0u));
+		}
+		catch (const std::invalid_argument&) {
+			thrown = true;
+		}
+
+		MAGE_CHECK(thrown);
+		MAGE_CHECK(!pool.Contains(0u));
+
+		// The key is no longer pending.
+		const auto resource = pool.GetOrCreate(0u, size_t(100u));
+		MAGE_CHECK(resource && 1u == pool.size());
+	}
+}
\ No newline at end of file
@@ -0,0 +1,322 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test\test.hpp"
+#include "scene\script\script_schedule.hpp"
+#include "parallel\parallel.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	namespace {
+
+		/**
+		 Returns the tasks of the tests: a task per group (with the given
+		 script dependencies) followed by a second task for each group (without
+		 shared accesses).
+
+		 @param[in]		dependencies
+						A reference to a vector containing the script
+						dependencies of the groups.
+		 @return		A vector containing the tasks.
+		 */
+		[[nodiscard]]
+		const std::vector< ScriptSchedule::Task >
+			GetTasks(const std::vector< ScriptDependencies >& dependencies) {
+
+			// The groups are identified by the addresses of the script
+			// dependencies.
+			std::vector< ScriptSchedule::Task > tasks;
+			for (const auto& group_dependencies : dependencies) {
+				tasks.push_back({ &group_dependencies, group_dependencies });
+			}
+			for (const auto& group_dependencies : dependencies) {
+				tasks.push_back({ &group_dependencies, ScriptDependencies(true) });
+			}
+
+			return tasks;
+		}
+
+		/**
+		 Returns the batch of each task of the given script schedule.
+
+		 @param[in]		schedule
+						A reference to the script schedule.
+		 @return		A vector containing the batch of each task of the given
+						script schedule.
+		 */
+		[[nodiscard]]
+		const std::vector< size_t > GetBatches(const ScriptSchedule& schedule) {
+			const auto& tasks   = schedule.GetTasks();
+			const auto& jobs    = schedule.GetJobs();
+			const auto& batches = schedule.GetBatches();
+
+			std::vector< size_t > task_batches(tasks.size());
+			for (size_t batch = 0u; batch < batches.size(); ++batch) {
+				for (auto job = batches[batch].m_begin;
+					 job < batches[batch].m_end; ++job) {
+
+					for (auto i = jobs[job].m_begin; i < jobs[job].m_end; ++i) {
+						task_batches[tasks[i]] = batch;
+					}
+				}
+			}
+
+			return task_batches;
+		}
+
+		/**
+		 A struct of rotations resembling the state a rotation script
+		 updates.
+		 */
+		struct Rotation final {
+
+		public:
+
+			/**
+			 The rotation angle (in radians) of this rotation.
+			 */
+			F32 m_angle = 0.0f;
+
+			/**
+			 The rotation matrix (i.e. the cosine and sine of the rotation
+			 angle) of this rotation.
+			 */
+			F32 m_matrix[2] = { 1.0f, 0.0f };
+		};
+
+		/**
+		 Updates the given rotation.
+
+		 @param[in,out]	rotation
+						A reference to the rotation.
+		 @param[in]		delta_time
+						The delta time (in seconds).
+		 */
+		void Update(Rotation& rotation, F32 delta_time) noexcept {
+			rotation.m_angle     = std::fmod(rotation.m_angle + delta_time,
+											 6.2831853f);
+			rotation.m_matrix[0] = std::cos(rotation.m_angle);
+			rotation.m_matrix[1] = std::sin(rotation.m_angle);
+		}
+	}
+
+	MAGE_TEST(ScriptScheduleGroupsTasksPerGroup) {
+		const std::vector< ScriptDependencies > dependencies(3u,
+			ScriptDependencies(true));
+
+		ScriptSchedule schedule;
+		schedule.Build(GetTasks(dependencies));
+
+		// Without shared accesses, all jobs share a single batch.
+		MAGE_CHECK(1u == schedule.GetBatches().size());
+		MAGE_CHECK(3u == schedule.GetJobs().size());
+		// The tasks of a job keep their order.
+		const std::vector< size_t > expected_tasks = { 0u, 3u, 1u, 4u, 2u, 5u };
+		MAGE_CHECK(expected_tasks == schedule.GetTasks());
+
+		schedule.Build({});
+		MAGE_CHECK(schedule.GetTasks().empty());
+		MAGE_CHECK(schedule.GetJobs().empty());
+		MAGE_CHECK(schedule.GetBatches().empty());
+	}
+
+	MAGE_TEST(ScriptScheduleSeparatesConflictingJobs) {
+		using A = ScriptAccess;
+		const std::vector< ScriptDependencies > dependencies = {
+			ScriptDependencies(true).Write(A::Transform),                // 0
+			ScriptDependencies(true).Read(A::Transform),                 // 1
+			ScriptDependencies(true).Read(A::Light),                     // 2
+			ScriptDependencies(true).Write(A::Light),                    // 3
+			ScriptDependencies(true).Read(A::Light).Read(A::Transform),  // 4
+			ScriptDependencies(true).Write(A::Model),                    // 5
+			ScriptDependencies(true).Write(A::Transform)                 // 6
+		};
+
+		ScriptSchedule schedule;
+		schedule.Build(GetTasks(dependencies));
+		const auto batches = GetBatches(schedule);
+
+		// Each job is assigned to the batch following the last batch with
+		// conflicting shared accesses. Non-conflicting jobs (e.g. readers of
+		// the same component kinds) share batches.
+		const std::vector< size_t > expected_batches = {
+			0u, 1u, 0u, 1u, 2u, 0u, 3u
+		};
+		MAGE_CHECK(4u == schedule.GetBatches().size());
+		for (size_t group = 0u; group < dependencies.size(); ++group) {
+			MAGE_CHECK(expected_batches[group] == batches[group]);
+			// The second task of each group belongs to the same job.
+			MAGE_CHECK(batches[group] == batches[dependencies.size() + group]);
+		}
+
+		// Conflicting jobs never share a batch and keep their order.
+		for (size_t i = 0u; i < dependencies.size(); ++i) {
+			for (size_t j = i + 1u; j < dependencies.size(); ++j) {
+				if (dependencies[i].Conflicts(dependencies[j])) {
+					MAGE_CHECK(batches[i] < batches[j]);
+				}
+			}
+		}
+	}
+
+	MAGE_TEST(ScriptScheduleExecutesBatchesInOrder) {
+		using A = ScriptAccess;
+		std::vector< ScriptDependencies > dependencies;
+		for (size_t group = 0u; group < 256u; ++group) {
+			// Every eighth group writes the transforms the other groups read.
+			dependencies.push_back((0u == group % 8u)
+				? ScriptDependencies(true).Write(A::Transform)
+				: ScriptDependencies(true).Read(A::Transform));
+		}
+
+		ScriptSchedule schedule;
+		const auto tasks = GetTasks(dependencies);
+		schedule.Build(tasks);
+		const auto batches = GetBatches(schedule);
+
+		std::atomic< size_t > time = 0u;
+		std::vector< size_t > start_times(tasks.size());
+		std::vector< size_t > end_times(tasks.size());
+		std::vector< size_t > keys(tasks.size());
+		std::vector< std::thread::id > threads(tasks.size());
+
+		schedule.Execute([&](size_t task) {
+			start_times[task] = time++;
+			keys[task]        = ScriptSchedule::GetCurrentKey();
+			threads[task]     = std::this_thread::get_id();
+			end_times[task]   = time++;
+		});
+
+		MAGE_CHECK(0u == ScriptSchedule::GetCurrentKey());
+		// Each task is executed exactly once.
+		MAGE_CHECK(2u * tasks.size() == time);
+
+		for (size_t i = 0u; i < tasks.size(); ++i) {
+			// The schedule key is the position in the schedule plus one.
+			MAGE_CHECK(i + 1u == keys[schedule.GetTasks()[i]]);
+
+			for (size_t j = 0u; j < tasks.size(); ++j) {
+				// Batches are executed one after the other.
+				if (batches[i] < batches[j]) {
+					MAGE_CHECK(end_times[i] < start_times[j]);
+				}
+			}
+		}
+
+		// The tasks of a job are executed one after the other on a single
+		// thread.
+		for (size_t group = 0u; group < dependencies.size(); ++group) {
+			const auto second = dependencies.size() + group;
+			MAGE_CHECK(end_times[group] < start_times[second]);
+			MAGE_CHECK(threads[group] == threads[second]);
+		}
+	}
+
+	MAGE_TEST(DeferredCommandsRunInScheduleOrder) {
+		std::vector< ScriptDependencies > dependencies(64u,
+			ScriptDependencies(true));
+		dependencies[16u].Write(ScriptAccess::Script);
+		dependencies[48u].Read(ScriptAccess::Script);
+
+		ScriptSchedule schedule;
+		const auto tasks = GetTasks(dependencies);
+		schedule.Build(tasks);
+
+		// Commands deferred outside task executions (i.e. by the engine and
+		// the non-thread-safe behavior scripts) run first.
+		std::vector< size_t > expected_commands = { 2u * tasks.size() };
+		for (const auto task : schedule.GetTasks()) {
+			expected_commands.push_back(2u * task);
+			expected_commands.push_back(2u * task + 1u);
+		}
+
+		// The thread timings must not change the order.
+		for (size_t iteration = 0u; iteration < 16u; ++iteration) {
+			DeferredCommandQueue< size_t > queue;
+			MAGE_CHECK(!queue.HasCommands());
+
+			schedule.Execute([&queue](size_t task) {
+				queue.Defer(2u * task);
+				// Vary the thread timings.
+				std::this_thread::yield();
+				queue.Defer(2u * task + 1u);
+			});
+			queue.Defer(2u * tasks.size());
+
+			MAGE_CHECK(queue.HasCommands());
+			MAGE_CHECK(expected_commands == queue.Pop());
+			MAGE_CHECK(!queue.HasCommands());
+		}
+	}
+
+	MAGE_BENCHMARK(ScriptScheduleUpdateScaling) {
+		// The scripts scene of the demo: 10k thread-safe rotation scripts,
+		// each attached to a root node of its own.
+		constexpr size_t nb_scripts = 10000u;
+		constexpr size_t nb_frames  = 200u;
+
+		std::vector< ScriptSchedule::Task > tasks;
+		std::vector< Rotation > rotations(nb_scripts);
+		for (const auto& rotation : rotations) {
+			tasks.push_back({ &rotation, ScriptDependencies(true) });
+		}
+
+		ScriptSchedule schedule;
+		schedule.Build(tasks);
+
+		// Serial updates (i.e. without -parallel-scripts).
+		const auto serial_time = Measure([&]() {
+			for (size_t frame = 0u; frame < nb_frames; ++frame) {
+				for (auto& rotation : rotations) {
+					Update(rotation, 0.016f);
+				}
+			}
+		});
+
+		// Scheduled updates (i.e. with -parallel-scripts).
+		const auto parallel_time = Measure([&]() {
+			for (size_t frame = 0u; frame < nb_frames; ++frame) {
+				schedule.Execute([&rotations](size_t task) {
+					Update(rotations[task], 0.016f);
+				});
+			}
+		});
+
+		F32 checksum = 0.0f;
+		for (const auto& rotation : rotations) {
+			checksum += rotation.m_matrix[0];
+		}
+		MAGE_CHECK(std::isfinite(checksum));
+
+		std::printf("hardware threads: %u, worker threads: %u\n",
+			        std::thread::hardware_concurrency(),
+			        static_cast< unsigned >(NumberOfSystemCores()));
+		std::printf("scripts  threads  update [ms]  speedup\n");
+		std::printf("%7zu  %7u  %11.4f  %7.2f\n", nb_scripts, 1u,
+			        1e3 * serial_time / nb_frames, 1.0);
+		std::printf("%7zu  %7u  %11.4f  %7.2f\n", nb_scripts,
+			        static_cast< unsigned >(NumberOfSystemCores()),
+			        1e3 * parallel_time / nb_frames,
+			        serial_time / parallel_time);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,475 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test\test.hpp"
+#include "system\frame_statistics.hpp"
+#include "system\profiler.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	namespace {
+
+		/**
+		 The name of the profile zone of the telemetry tests, which needs to
+		 be quoted and escaped.
+		 */
+		constexpr const_zstring g_zone_name = "FrameStatisticsTest \"Zone\" \\";
+
+		/**
+		 Checks whether the given quantile sketch approximates the exact
+		 quantiles of the given values with the given relative accuracy.
+
+		 @param[in]		sketch
+						A reference to the quantile sketch.
+		 @param[in]		values
+						The values of the quantile sketch.
+		 @param[in]		relative_accuracy
+						The relative accuracy of the quantile sketch.
+		 */
+		void CheckQuantiles(const QuantileSketch& sketch,
+							std::vector< F32 > values,
+							F32 relative_accuracy) {
+			std::sort(values.begin(), values.end());
+
+			for (const auto q : { 0.0f, 0.01f, 0.25f, 0.5f, 0.75f,
+								  0.9f, 0.95f, 0.99f, 0.999f, 1.0f }) {
+				// The sketch and the exact quantiles use the same rank.
+				const auto rank  = static_cast< size_t >(
+					q * static_cast< F32 >(values.size() - 1u));
+				const auto exact = values[rank];
+				const auto error = std::abs(sketch.GetQuantile(q) - exact) / exact;
+				// Allow for the rounding errors of single precision.
+				MAGE_CHECK(error <= relative_accuracy + 0.0001f);
+			}
+		}
+
+		/**
+		 A class of JSON parsers which only validate the syntax.
+		 */
+		class JSONValidator final {
+
+		public:
+
+			explicit JSONValidator(const std::string& str) noexcept
+				: m_str(str), m_pos(0u) {}
+
+			[[nodiscard]]
+			bool Validate() {
+				const auto valid = ParseValue();
+				SkipWhitespace();
+				return valid && m_str.size() == m_pos;
+			}
+
+		private:
+
+			[[nodiscard]]
+			char Peek() const noexcept {
+				return (m_pos < m_str.size()) ? m_str[m_pos] : '\0';
+			}
+
+			void SkipWhitespace() noexcept {
+				while (m_pos < m_str.size()
+					   && std::isspace(static_cast< unsigned char >(m_str[m_pos]))) {
+					++m_pos;
+				}
+			}
+
+			[[nodiscard]]
+			bool Consume(char c) noexcept {
+				SkipWhitespace();
+				if (c != Peek()) {
+					return false;
+				}
+				++m_pos;
+				return true;
+			}
+
+			[[nodiscard]]
+			bool ParseValue() {
+				SkipWhitespace();
+				switch (Peek()) {
+				case '{': return ParseObject();
+				case '[': return ParseArray();
+				case '"': return ParseString();
+				case 't': return ParseLiteral("true");
+				case 'f': return ParseLiteral("false");
+				case 'n': return ParseLiteral("null");
+				default:  return ParseNumber();
+				}
+			}
+
+			[[nodiscard]]
+			bool ParseObject() {
+				if (!Consume('{')) {
+					return false;
+				}
+				if (Consume('}')) {
+					return true;
+				}
+				do {
+					SkipWhitespace();
+					if (!ParseString() || !Consume(':') || !ParseValue()) {
+						return false;
+					}
+				} while (Consume(','));
+				return Consume('}');
+			}
+
+			[[nodiscard]]
+			bool ParseArray() {
+				if (!Consume('[')) {
+					return false;
+				}
+				if (Consume(']')) {
+					return true;
+				}
+				do {
+					if (!ParseValue()) {
+						return false;
+					}
+				} while (Consume(','));
+				return Consume(']');
+			}
+
+			[[nodiscard]]
+			bool ParseString() noexcept {
+				if ('"' != Peek()) {
+					return false;
+				}
+				for (++m_pos; m_pos < m_str.size(); ++m_pos) {
+					const auto c = m_str[m_pos];
+					if ('"' == c) {
+						++m_pos;
+						return true;
+					}
+					if ('\\' == c) {
+						++m_pos;
+						if (std::string::npos == std::string("\"\\/bfnrt").find(Peek())) {
+							return false;
+						}
+					}
+					else if (0 <= c && c < ' ') {
+						return false;
+					}
+				}
+				return false;
+			}
+
+			[[nodiscard]]
+			bool ParseLiteral(const std::string& literal) {
+				if (0 != m_str.compare(m_pos, literal.size(), literal)) {
+					return false;
+				}
+				m_pos += literal.size();
+				return true;
+			}
+
+			[[nodiscard]]
+			bool ParseNumber() noexcept {
+				const auto begin = m_str.c_str() + m_pos;
+				char* end = nullptr;
+				std::strtod(begin, &end);
+				if (begin == end) {
+					return false;
+				}
+				m_pos += static_cast< size_t >(end - begin);
+				return true;
+			}
+
+			const std::string& m_str;
+
+			size_t m_pos;
+		};
+
+		/**
+		 Splits the given CSV record into its fields.
+
+		 @param[in]		record
+						A reference to the CSV record.
+		 @param[out]	fields
+						A reference to a vector for storing the fields.
+		 @return		@c true if the given CSV record is valid. @c false
+						otherwise.
+		 */
+		[[nodiscard]]
+		bool ParseCSVRecord(const std::string& record,
+							std::vector< std::string >& fields) {
+			fields.clear();
+
+			size_t pos = 0u;
+			while (true) {
+				std::string field;
+				if (pos < record.size() && '"' == record[pos]) {
+					// Quoted field with doubled quotes.
+					for (++pos; ; ++pos) {
+						if (record.size() <= pos) {
+							return false;
+						}
+						if ('"' == record[pos]) {
+							if (pos + 1u < record.size() && '"' == record[pos + 1u]) {
+								field += '"';
+								++pos;
+								continue;
+							}
+							++pos;
+							break;
+						}
+						field += record[pos];
+					}
+				}
+				else {
+					const auto end = std::min(record.find(',', pos), record.size());
+					field = record.substr(pos, end - pos);
+					if (std::string::npos != field.find('"')) {
+						return false;
+					}
+					pos = end;
+				}
+				fields.push_back(std::move(field));
+
+				if (record.size() == pos) {
+					return true;
+				}
+				if (',' != record[pos]) {
+					return false;
+				}
+				++pos;
+			}
+		}
+
+		/**
+		 Checks whether the given CSV field is empty or a number.
+
+		 @param[in]		field
+						A reference to the CSV field.
+		 @return		@c true if the given CSV field is empty or a number.
+						@c false otherwise.
+		 */
+		[[nodiscard]]
+		bool IsOptionalNumber(const std::string& field) noexcept {
+			if (field.empty()) {
+				return true;
+			}
+
+			char* end = nullptr;
+			std::strtod(field.c_str(), &end);
+			return field.c_str() + field.size() == end;
+		}
+
+		/**
+		 Records 100 frames of 10 ms of wall clock time each with the given
+		 frame statistics, of which frames 0, 10, ..., 90 are hitches of
+		 50 ms.
+
+		 @param[in]		statistics
+						A reference to the frame statistics.
+		 */
+		void RecordFrames(FrameStatistics& statistics) {
+			// Make sure the profiler has a profile zone to summarize.
+			auto& profiler = Profiler::Get();
+			profiler.Record(g_zone_name, nullptr, 0u, 1000000u, 0u);
+			profiler.EndFrame();
+
+			for (U32 i = 0u; i < 100u; ++i) {
+				const auto wall = (0u == i % 10u) ? 0.050 : 0.010;
+				statistics.Record(TimeIntervalSeconds(wall),
+								  TimeIntervalSeconds(0.005),
+								  TimeIntervalSeconds(0.001));
+			}
+		}
+
+		/**
+		 Reads the lines of the file associated with the given path and
+		 removes that file.
+
+		 @param[in]		path
+						A reference to the path.
+		 @return		A vector containing the lines of the file.
+		 */
+		[[nodiscard]]
+		const std::vector< std::string >
+			ReadAndRemove(const std::filesystem::path& path) {
+
+			std::vector< std::string > lines;
+			{
+				std::ifstream file(path);
+				for (std::string line; std::getline(file, line); ) {
+					lines.push_back(line);
+				}
+			}
+			std::filesystem::remove(path);
+
+			return lines;
+		}
+	}
+
+	MAGE_TEST(QuantileSketchApproximatesExactQuantiles) {
+		QuantileSketch empty;
+		MAGE_CHECK(0u   == empty.GetCount());
+		MAGE_CHECK(0.0f == empty.GetQuantile(0.5f));
+
+		// Log-uniformly distributed values in [0.01, 1000].
+		std::mt19937 generator(42u);
+		std::uniform_real_distribution< F32 > distribution(std::log(0.01f),
+														   std::log(1000.0f));
+		for (const auto relative_accuracy : { 0.01f, 0.05f }) {
+			QuantileSketch sketch(relative_accuracy);
+
+			std::vector< F32 > values;
+			F64 sum = 0.0;
+			for (U32 i = 0u; i < 100000u; ++i) {
+				const auto value = std::exp(distribution(generator));
+				sketch.Add(value);
+				values.push_back(value);
+				sum += value;
+			}
+
+			MAGE_CHECK(values.size() == sketch.GetCount());
+			MAGE_CHECK(*std::max_element(values.cbegin(), values.cend())
+					   == sketch.GetMaximum());
+			MAGE_CHECK(std::abs(sketch.GetAverage() - sum / values.size())
+					   <= 0.0001 * sum / values.size());
+			CheckQuantiles(sketch, std::move(values), relative_accuracy);
+
+			sketch.Clear();
+			MAGE_CHECK(0u == sketch.GetCount());
+		}
+
+		// Frame times (in milliseconds): mostly around 16.7 with hitches.
+		QuantileSketch sketch;
+		std::vector< F32 > values;
+		for (U32 i = 0u; i < 1000u; ++i) {
+			const auto value = (0u == i % 100u) ? 100.0f + i * 0.1f
+				                                : 16.0f + (i % 7u) * 0.2f;
+			sketch.Add(value);
+			values.push_back(value);
+		}
+		CheckQuantiles(sketch, std::move(values), 0.01f);
+	}
+
+	MAGE_TEST(FrameStatisticsComputesRecentPercentiles) {
+		FrameStatistics statistics(100u);
+		RecordFrames(statistics);
+
+		MAGE_CHECK(100u == statistics.GetNumberOfFrames());
+		MAGE_CHECK(10u  == statistics.GetNumberOfHitches());
+		MAGE_CHECK(10u  == statistics.GetNumberOfRecentHitches());
+
+		const auto wall = statistics.GetRecentPercentiles(FrameMetric::WallClock);
+		MAGE_CHECK(std::abs(wall.m_p50 - 10.0f) < 0.001f);
+		MAGE_CHECK(std::abs(wall.m_p95 - 50.0f) < 0.001f);
+		MAGE_CHECK(std::abs(wall.m_p99 - 50.0f) < 0.001f);
+		MAGE_CHECK(std::abs(wall.m_max - 50.0f) < 0.001f);
+
+		const auto cpu = statistics.GetRecentPercentiles(FrameMetric::CoreClock);
+		MAGE_CHECK(std::abs(cpu.m_p50 - 5.0f) < 0.001f);
+		MAGE_CHECK(std::abs(cpu.m_max - 5.0f) < 0.001f);
+	}
+
+	MAGE_TEST(FrameStatisticsWritesParsableCSVTelemetry) {
+		const auto path = std::filesystem::temp_directory_path()
+			            / L"mage_frame_statistics_test.csv";
+
+		FrameStatistics statistics;
+		// The 1.4 s of frames span three telemetry periods, each containing
+		// at least three hitches.
+		statistics.StartTelemetry(path, TimeIntervalSeconds(0.5));
+		RecordFrames(statistics);
+		statistics.StopTelemetry();
+
+		const auto lines = ReadAndRemove(path);
+		MAGE_CHECK(2u <= lines.size());
+		if (lines.empty()) {
+			return;
+		}
+
+		std::vector< std::string > fields;
+		MAGE_CHECK(ParseCSVRecord(lines[0], fields));
+		MAGE_CHECK(9u == fields.size());
+		MAGE_CHECK("time_s" == fields.front() && "hitches" == fields.back());
+
+		size_t nb_frames  = 0u;
+		size_t nb_hitches = 0u;
+		auto found_zone   = false;
+		for (size_t i = 1u; i < lines.size(); ++i) {
+			MAGE_CHECK(ParseCSVRecord(lines[i], fields));
+			MAGE_CHECK(9u == fields.size());
+			if (9u != fields.size()) {
+				continue;
+			}
+
+			for (size_t j = 0u; j < fields.size(); ++j) {
+				MAGE_CHECK(1u == j || IsOptionalNumber(fields[j]));
+			}
+
+			if ("wall" == fields[1]) {
+				nb_frames  += std::stoul(fields[2]);
+				nb_hitches += std::stoul(fields[8]);
+				MAGE_CHECK(std::abs(std::stof(fields[4]) - 10.0f) < 0.1f);
+				MAGE_CHECK(std::abs(std::stof(fields[7]) - 50.0f) < 0.001f);
+			}
+			found_zone = found_zone || g_zone_name == fields[1];
+		}
+
+		MAGE_CHECK(100u == nb_frames);
+		MAGE_CHECK(10u  == nb_hitches);
+		MAGE_CHECK(found_zone);
+	}
+
+	MAGE_TEST(FrameStatisticsWritesParsableJSONTelemetry) {
+		const auto path = std::filesystem::temp_directory_path()
+			            / L"mage_frame_statistics_test.json";
+
+		FrameStatistics statistics;
+		statistics.StartTelemetry(path, TimeIntervalSeconds(0.5));
+		RecordFrames(statistics);
+		statistics.StopTelemetry();
+
+		const auto lines = ReadAndRemove(path);
+		MAGE_CHECK(2u <= lines.size());
+
+		const auto get_count = [](const std::string& line,
+								  const std::string& key) {
+			const auto pos = line.find("\"" + key + "\":");
+			return (std::string::npos == pos) ? size_t(0u)
+				: std::stoul(line.substr(pos + key.size() + 3u));
+		};
+
+		size_t nb_frames  = 0u;
+		size_t nb_hitches = 0u;
+		for (const auto& line : lines) {
+			MAGE_CHECK(JSONValidator(line).Validate());
+			MAGE_CHECK(0u == line.find("{\"time_s\":"));
+			MAGE_CHECK(std::string::npos
+					   != line.find("\"FrameStatisticsTest \\\"Zone\\\" \\\\\":{"));
+			nb_frames  += get_count(line, "frames");
+			nb_hitches += get_count(line, "hitches");
+		}
+
+		MAGE_CHECK(100u == nb_frames);
+		MAGE_CHECK(10u  == nb_hitches);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,266 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test\test.hpp"
+#include "system\profiler.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	// Profile zones always record to the global profiler. The thread buffers
+	// are shared by all profilers as well, so the tests use the global
+	// profiler with profile zone names of their own.
+
+	namespace {
+
+		/**
+		 Drains the pending profile events of the global profiler and starts
+		 a new capture.
+
+		 @return		A reference to the global profiler.
+		 */
+		Profiler& BeginCapture() {
+			auto& profiler = Profiler::Get();
+			profiler.SetEnabled(true);
+			profiler.EndFrame();
+			profiler.BeginCapture();
+			return profiler;
+		}
+
+		/**
+		 Returns the captured profile events of the global profiler by
+		 exporting and reading back a Chrome trace.
+
+		 @return		The Chrome trace of the captured profile events.
+		 */
+		[[nodiscard]]
+		const std::string ExportChromeTrace() {
+			const auto path = std::filesystem::temp_directory_path()
+				            / L"mage_profiler_test.json";
+			Profiler::Get().ExportChromeTrace(path);
+
+			std::string trace;
+			{
+				std::ifstream file(path);
+				trace.assign(std::istreambuf_iterator< char >(file),
+							 std::istreambuf_iterator< char >());
+			}
+			std::filesystem::remove(path);
+
+			return trace;
+		}
+
+		/**
+		 Counts the number of occurrences of the given substring in the given
+		 string.
+
+		 @param[in]		str
+						A reference to the string.
+		 @param[in]		substr
+						A reference to the substring.
+		 @return		The number of occurrences of @a substr in @a str.
+		 */
+		[[nodiscard]]
+		size_t Count(const std::string& str, const std::string& substr) {
+			size_t count = 0u;
+			for (auto pos = str.find(substr); std::string::npos != pos;
+				 pos = str.find(substr, pos + substr.size())) {
+				++count;
+			}
+			return count;
+		}
+	}
+
+	MAGE_TEST(ProfilerRecordsNestedProfileZones) {
+		auto& profiler = BeginCapture();
+		{
+			MAGE_PROFILE_ZONE("ProfilerTestNestingOuter");
+			{
+				MAGE_PROFILE_ZONE("ProfilerTestNestingInner");
+			}
+			{
+				MAGE_PROFILE_ZONE("ProfilerTestNestingInner");
+				MAGE_PROFILE_ZONE("ProfilerTestNestingInnermost");
+			}
+		}
+
+		// Disabled profilers do not record profile zones.
+		profiler.SetEnabled(false);
+		{
+			MAGE_PROFILE_ZONE("ProfilerTestNestingDisabled");
+		}
+		profiler.SetEnabled(true);
+
+		profiler.EndFrame();
+		profiler.EndCapture();
+
+		MAGE_CHECK(4u == profiler.GetNumberOfCapturedEvents());
+
+		const auto statistics = profiler.GetStatistics();
+		std::vector< ProfileZoneStatistics > zones;
+		for (const auto& stats : statistics) {
+			MAGE_CHECK("ProfilerTestNestingDisabled" != stats.m_name);
+			if (0u == stats.m_name.find("ProfilerTestNesting")) {
+				zones.push_back(stats);
+			}
+		}
+
+		MAGE_CHECK(3u == zones.size());
+		if (3u != zones.size()) {
+			return;
+		}
+
+		MAGE_CHECK("ProfilerTestNestingOuter"     == zones[0].m_name);
+		MAGE_CHECK("ProfilerTestNestingInner"     == zones[1].m_name);
+		MAGE_CHECK("ProfilerTestNestingInnermost" == zones[2].m_name);
+		MAGE_CHECK(0u == zones[0].m_depth);
+		MAGE_CHECK(1u == zones[1].m_depth);
+		MAGE_CHECK(2u == zones[2].m_depth);
+		MAGE_CHECK(1.0f == zones[0].m_nb_calls);
+		MAGE_CHECK(2.0f == zones[1].m_nb_calls);
+		MAGE_CHECK(1.0f == zones[2].m_nb_calls);
+		// The enclosing profile zones last at least as long as their
+		// enclosed profile zones.
+		MAGE_CHECK(zones[1].m_avg <= zones[0].m_avg);
+		MAGE_CHECK(zones[2].m_avg <= zones[1].m_avg);
+	}
+
+	MAGE_TEST(ProfilerOrdersStatisticsDepthFirst) {
+		auto& profiler = BeginCapture();
+		profiler.EndCapture();
+
+		// Frame i lasts i + 1 ms for each profile zone, which is called twice
+		// per frame (except for profile zone D, which is called four times
+		// per frame and thus lasts 2 (i + 1) ms).
+		constexpr U64 ms = 1000000u;
+		for (U64 i = 0u; i < 100u; ++i) {
+			const auto time = (i + 1u) * ms;
+			for (U32 j = 0u; j < 2u; ++j) {
+				// Record the enclosed profile zones before their enclosing
+				// profile zones (as the destructors of profile zones do) and
+				// the sibling profile zones in reverse order.
+				profiler.Record("ProfilerTestStatsD", "ProfilerTestStatsB",
+								0u, time / 2u, 2u);
+				profiler.Record("ProfilerTestStatsD", "ProfilerTestStatsB",
+								0u, time / 2u, 2u);
+				profiler.Record("ProfilerTestStatsC", "ProfilerTestStatsA",
+								0u, time / 2u, 1u);
+				profiler.Record("ProfilerTestStatsB", "ProfilerTestStatsA",
+								0u, time / 2u, 1u);
+				profiler.Record("ProfilerTestStatsA", nullptr,
+								0u, time / 2u, 0u);
+			}
+			profiler.EndFrame();
+		}
+
+		std::vector< ProfileZoneStatistics > zones;
+		for (const auto& stats : profiler.GetStatistics()) {
+			if (0u == stats.m_name.find("ProfilerTestStats")) {
+				zones.push_back(stats);
+			}
+		}
+
+		MAGE_CHECK(4u == zones.size());
+		if (4u != zones.size()) {
+			return;
+		}
+
+		MAGE_CHECK("ProfilerTestStatsA" == zones[0].m_name);
+		MAGE_CHECK("ProfilerTestStatsB" == zones[1].m_name);
+		MAGE_CHECK("ProfilerTestStatsD" == zones[2].m_name);
+		MAGE_CHECK("ProfilerTestStatsC" == zones[3].m_name);
+		MAGE_CHECK(0u == zones[0].m_depth);
+		MAGE_CHECK(1u == zones[1].m_depth);
+		MAGE_CHECK(2u == zones[2].m_depth);
+		MAGE_CHECK(1u == zones[3].m_depth);
+
+		for (const auto& zone : zones) {
+			const auto nb_calls = ("ProfilerTestStatsD" == zone.m_name) ? 4.0f
+				                                                        : 2.0f;
+			const auto scale    = ("ProfilerTestStatsD" == zone.m_name) ? 2.0
+				                                                        : 1.0;
+			MAGE_CHECK(100u == zone.m_nb_frames);
+			MAGE_CHECK(nb_calls == zone.m_nb_calls);
+			MAGE_CHECK(std::abs(zone.m_min -  1.0 * scale) < 1e-9);
+			MAGE_CHECK(std::abs(zone.m_avg - 50.5 * scale) < 1e-9);
+			// The 99th percentile of 1, ..., 100 ms is 99 ms.
+			MAGE_CHECK(std::abs(zone.m_p99 - 99.0 * scale) < 1e-9);
+		}
+	}
+
+	MAGE_TEST(ProfilerExportsChromeTraces) {
+		auto& profiler = BeginCapture();
+		profiler.Record("ProfilerTestTrace", nullptr, 1000000u, 1002500u, 0u);
+		profiler.Record("ProfilerTest\"Trace\\", "ProfilerTestTrace",
+						1001000u, 1001500u, 1u);
+		profiler.EndFrame();
+		profiler.EndCapture();
+
+		MAGE_CHECK(2u == profiler.GetNumberOfCapturedEvents());
+
+		const auto trace = ExportChromeTrace();
+
+		MAGE_CHECK(0u == trace.find("{\"traceEvents\":["));
+		MAGE_CHECK(trace.size() - trace.rfind("],\"displayTimeUnit\":\"ms\"}")
+				   == std::size("],\"displayTimeUnit\":\"ms\"}\n") - 1u);
+		MAGE_CHECK(1u <= Count(trace, "\"ph\":\"M\""));
+		MAGE_CHECK(2u == Count(trace, "\"ph\":\"X\""));
+
+		// The time stamps (in microseconds) are relative to the first
+		// captured profile event.
+		MAGE_CHECK(1u == Count(trace,
+			"{\"name\":\"ProfilerTestTrace\",\"cat\":\"MAGE\",\"ph\":\"X\","));
+		MAGE_CHECK(1u == Count(trace, "\"ts\":0.000,\"dur\":2.500}"));
+		MAGE_CHECK(1u == Count(trace,
+			"{\"name\":\"ProfilerTest\\\"Trace\\\\\",\"cat\":\"MAGE\",\"ph\":\"X\","));
+		MAGE_CHECK(1u == Count(trace, "\"ts\":1.000,\"dur\":0.500}"));
+
+		// The JSON objects and arrays are balanced outside strings.
+		auto in_string = false;
+		auto balanced  = true;
+		S32 nb_objects = 0;
+		S32 nb_arrays  = 0;
+		for (size_t i = 0u; i < trace.size(); ++i) {
+			const auto c = trace[i];
+			if (in_string) {
+				if ('\\' == c) {
+					++i;
+				}
+				else if ('"' == c) {
+					in_string = false;
+				}
+				continue;
+			}
+
+			switch (c) {
+			case '"': in_string = true; break;
+			case '{': ++nb_objects;     break;
+			case '}': --nb_objects;     break;
+			case '[': ++nb_arrays;      break;
+			case ']': --nb_arrays;      break;
+			}
+			balanced = balanced && 0 <= nb_objects && 0 <= nb_arrays;
+		}
+		MAGE_CHECK(!in_string && balanced);
+		MAGE_CHECK(0 == nb_objects && 0 == nb_arrays);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,138 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test\test.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <cstdio>
+#include <cstring>
+#include <exception>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	namespace {
+
+		/**
+		 A struct of registered test cases.
+		 */
+		struct TestCase final {
+
+		public:
+
+			//-----------------------------------------------------------------
+			// Member Variables
+			//-----------------------------------------------------------------
+
+			/**
+			 The type of this test case.
+			 */
+			TestCaseType m_type;
+
+			/**
+			 A pointer to the null-terminated name of this test case.
+			 */
+			const char* m_name;
+
+			/**
+			 The function of this test case.
+			 */
+			TestCaseRegistrar::TestCaseFunction m_function;
+		};
+
+		/**
+		 Returns the registered test cases.
+
+		 @return		A reference to the registered test cases.
+		 */
+		[[nodiscard]]
+		std::vector< TestCase >& GetTestCases() {
+			static std::vector< TestCase > s_test_cases;
+			return s_test_cases;
+		}
+
+		/**
+		 The number of failed checks of the running test case.
+		 */
+		U32 g_nb_failed_checks = 0u;
+	}
+
+	TestCaseRegistrar::TestCaseRegistrar(TestCaseType type,
+		                                 const char* name,
+		                                 TestCaseFunction function) {
+
+		GetTestCases().push_back(TestCase{ type, name, function });
+	}
+
+	void Check(bool condition,
+		       const char* expression,
+		       const char* file,
+		       int line) noexcept {
+
+		if (condition) {
+			return;
+		}
+
+		++g_nb_failed_checks;
+		std::fprintf(stderr, "%s(%d): check failed: %s\n",
+			         file, line, expression);
+	}
+
+	[[nodiscard]]
+	U32 RunTestCases(TestCaseType type, const char* filter) noexcept {
+		U32 nb_test_cases        = 0u;
+		U32 nb_failed_test_cases = 0u;
+
+		for (const auto& test_case : GetTestCases()) {
+			if (type != test_case.m_type) {
+				continue;
+			}
+			if (filter && !std::strstr(test_case.m_name, filter)) {
+				continue;
+			}
+
+			++nb_test_cases;
+			g_nb_failed_checks = 0u;
+			std::printf("[ RUN    ] %s\n", test_case.m_name);
+
+			try {
+				test_case.m_function();
+			}
+			catch (const std::exception& e) {
+				++g_nb_failed_checks;
+				std::fprintf(stderr, "unexpected exception: %s\n", e.what());
+			}
+			catch (...) {
+				++g_nb_failed_checks;
+				std::fprintf(stderr, "unexpected exception\n");
+			}
+
+			if (0u == g_nb_failed_checks) {
+				std::printf("[     OK ] %s\n", test_case.m_name);
+			}
+			else {
+				++nb_failed_test_cases;
+				std::printf("[ FAILED ] %s\n", test_case.m_name);
+			}
+		}
+
+		std::printf("%u/%u passed\n",
+			        nb_test_cases - nb_failed_test_cases, nb_test_cases);
+		std::fflush(stdout);
+
+		return nb_failed_test_cases;
+	}
+}
\ No newline at end of file
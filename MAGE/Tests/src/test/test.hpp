@@ -0,0 +1,166 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "type\types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <chrono>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Defines
+//-----------------------------------------------------------------------------
+#pragma region
+
+/**
+ Defines and registers a test with the given name.
+
+ @param[in]		name
+				The name of the test.
+ */
+#define MAGE_TEST(name)                                                      \
+	static void name();                                                      \
+	static const mage::test::TestCaseRegistrar name##_registrar(             \
+		mage::test::TestCaseType::Test, #name, &name);                       \
+	static void name()
+
+/**
+ Defines and registers a benchmark with the given name.
+
+ @param[in]		name
+				The name of the benchmark.
+ */
+#define MAGE_BENCHMARK(name)                                                 \
+	static void name();                                                      \
+	static const mage::test::TestCaseRegistrar name##_registrar(             \
+		mage::test::TestCaseType::Benchmark, #name, &name);                  \
+	static void name()
+
+/**
+ Checks the given expression in the running test case.
+
+ @param[in]		expression
+				The expression to check.
+ */
+#define MAGE_CHECK(expression)                                               \
+	mage::test::Check(static_cast< bool >(expression), #expression,          \
+		              __FILE__, __LINE__)
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	/**
+	 An enumeration of the different test case types.
+
+	 This contains:
+	 @c Test and
+	 @c Benchmark.
+	 */
+	enum class TestCaseType : U8 {
+		Test = 0,
+		Benchmark
+	};
+
+	/**
+	 A class of test case registrars. Each registrar registers a single test
+	 case at static initialization time.
+	 */
+	class TestCaseRegistrar final {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 The function type of test cases.
+		 */
+		using TestCaseFunction = void (*)();
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a test case registrar and registers the given test case.
+
+		 @param[in]		type
+						The type of the test case.
+		 @param[in]		name
+						A pointer to the null-terminated name of the test case.
+		 @param[in]		function
+						The function of the test case.
+		 */
+		explicit TestCaseRegistrar(TestCaseType type,
+			                       const char* name,
+			                       TestCaseFunction function);
+	};
+
+	/**
+	 Checks the given condition of the running test case. If the condition
+	 does not hold, the running test case is marked as failed and the failed
+	 expression is reported.
+
+	 @param[in]		condition
+					The condition to check.
+	 @param[in]		expression
+					A pointer to the null-terminated expression of the
+					condition.
+	 @param[in]		file
+					A pointer to the null-terminated file name of the check.
+	 @param[in]		line
+					The line number of the check.
+	 */
+	void Check(bool condition,
+		       const char* expression,
+		       const char* file,
+		       int line) noexcept;
+
+	/**
+	 Runs all registered test cases of the given type whose names contain the
+	 given filter.
+
+	 @param[in]		type
+					The type of the test cases to run.
+	 @param[in]		filter
+					A pointer to the null-terminated filter. Every test case
+					matches a @c nullptr filter.
+	 @return		The number of failed test cases.
+	 */
+	[[nodiscard]]
+	U32 RunTestCases(TestCaseType type, const char* filter) noexcept;
+
+	/**
+	 Measures the wall clock time of the given function.
+
+	 @tparam		FunctionT
+					The function type.
+	 @param[in]		function
+					A reference to the function.
+	 @return		The wall clock time in seconds of the given function.
+	 */
+	template< typename FunctionT >
+	[[nodiscard]]
+	inline F64 Measure(FunctionT&& function) {
+		const auto start = std::chrono::steady_clock::now();
+		function();
+		const auto end   = std::chrono::steady_clock::now();
+		return std::chrono::duration< F64 >(end - start).count();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,48 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test\test.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <cstring>
+
+#pragma endregion
+
+/**
+ The entry point of the tests.
+
+ Supported arguments:
+ @c -benchmark (runs the benchmarks instead of the tests) and
+ @c <filter> (only runs the test cases whose names contain the filter).
+
+ @param[in]		argc
+				The number of command line arguments.
+ @param[in]		argv
+				A pointer to the command line arguments.
+ @return		The number of failed test cases.
+ */
+int main(int argc, char* argv[]) {
+	using namespace mage::test;
+
+	auto type          = TestCaseType::Test;
+	const char* filter = nullptr;
+
+	for (int i = 1; i < argc; ++i) {
+		if (0 == std::strcmp(argv[i], "-benchmark")) {
+			type = TestCaseType::Benchmark;
+		}
+		else {
+			filter = argv[i];
+		}
+	}
+
+	return static_cast< int >(RunTestCases(type, filter));
+}
\ No newline at end of file
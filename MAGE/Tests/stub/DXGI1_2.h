@@ -0,0 +1,26 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "windows.h"
+#include "dxgiformat.h"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Stub Definitions
+//-----------------------------------------------------------------------------
+//
+// A stand-in for the DXGI interfaces named by the engine sources of the
+// Linux test build. None of them is used.
+//
+
+struct IDXGIObject     : public IUnknown {};
+struct IDXGIAdapter    : public IDXGIObject {};
+struct IDXGIOutput     : public IDXGIObject {};
+struct IDXGISwapChain  : public IDXGIObject {};
+struct IDXGIFactory    : public IDXGIObject {};
+struct IDXGIFactory2   : public IDXGIFactory {};
\ No newline at end of file
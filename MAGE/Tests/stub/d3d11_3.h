@@ -0,0 +1,504 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "windows.h"
+#include "dxgiformat.h"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Stub Definitions
+//-----------------------------------------------------------------------------
+//
+// A stand-in for the subset of the Direct3D 11 API used by the engine
+// sources of the Linux test build. ID3D11DeviceContext is complete, so mock
+// device contexts and command recorders can implement it. The values of the
+// constants match the Windows SDK.
+//
+
+#pragma region
+
+#define D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT        14
+#define D3D11_COMMONSHADER_INPUT_RESOURCE_SLOT_COUNT             128
+#define D3D11_COMMONSHADER_SAMPLER_SLOT_COUNT                    16
+#define D3D11_IA_VERTEX_INPUT_RESOURCE_SLOT_COUNT                32
+#define D3D11_SIMULTANEOUS_RENDER_TARGET_COUNT                   8
+#define D3D11_VIEWPORT_AND_SCISSORRECT_OBJECT_COUNT_PER_PIPELINE 16
+#define D3D11_PS_CS_UAV_REGISTER_COUNT                           8
+#define D3D11_1_UAV_SLOT_COUNT                                   64
+#define D3D11_KEEP_RENDER_TARGETS_AND_DEPTH_STENCIL              0xffffffffu
+#define D3D11_KEEP_UNORDERED_ACCESS_VIEWS                        0xffffffffu
+#define D3D11_DEFAULT_STENCIL_REFERENCE                          0
+
+#define DXGI_ERROR_NOT_FOUND static_cast< HRESULT >(static_cast< std::int32_t >(0x887A0002u))
+
+enum D3D_FEATURE_LEVEL {
+	D3D_FEATURE_LEVEL_11_0 = 0xb000,
+	D3D_FEATURE_LEVEL_11_1 = 0xb100
+};
+
+enum D3D11_PRIMITIVE_TOPOLOGY {
+	D3D11_PRIMITIVE_TOPOLOGY_UNDEFINED     = 0,
+	D3D11_PRIMITIVE_TOPOLOGY_POINTLIST     = 1,
+	D3D11_PRIMITIVE_TOPOLOGY_LINELIST      = 2,
+	D3D11_PRIMITIVE_TOPOLOGY_LINESTRIP     = 3,
+	D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST  = 4,
+	D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP = 5
+};
+
+enum D3D11_MAP {
+	D3D11_MAP_READ               = 1,
+	D3D11_MAP_WRITE              = 2,
+	D3D11_MAP_READ_WRITE         = 3,
+	D3D11_MAP_WRITE_DISCARD      = 4,
+	D3D11_MAP_WRITE_NO_OVERWRITE = 5
+};
+
+enum D3D11_DEVICE_CONTEXT_TYPE {
+	D3D11_DEVICE_CONTEXT_IMMEDIATE = 0,
+	D3D11_DEVICE_CONTEXT_DEFERRED  = 1
+};
+
+enum D3D11_RESOURCE_DIMENSION {
+	D3D11_RESOURCE_DIMENSION_UNKNOWN   = 0,
+	D3D11_RESOURCE_DIMENSION_BUFFER    = 1,
+	D3D11_RESOURCE_DIMENSION_TEXTURE1D = 2,
+	D3D11_RESOURCE_DIMENSION_TEXTURE2D = 3,
+	D3D11_RESOURCE_DIMENSION_TEXTURE3D = 4
+};
+
+enum D3D11_USAGE {
+	D3D11_USAGE_DEFAULT   = 0,
+	D3D11_USAGE_IMMUTABLE = 1,
+	D3D11_USAGE_DYNAMIC   = 2,
+	D3D11_USAGE_STAGING   = 3
+};
+
+enum D3D11_CPU_ACCESS_FLAG {
+	D3D11_CPU_ACCESS_WRITE = 0x10000,
+	D3D11_CPU_ACCESS_READ  = 0x20000
+};
+
+enum D3D11_CLEAR_FLAG {
+	D3D11_CLEAR_DEPTH   = 0x1,
+	D3D11_CLEAR_STENCIL = 0x2
+};
+
+enum D3D11_BUFFER_UAV_FLAG {
+	D3D11_BUFFER_UAV_FLAG_RAW     = 0x1,
+	D3D11_BUFFER_UAV_FLAG_APPEND  = 0x2,
+	D3D11_BUFFER_UAV_FLAG_COUNTER = 0x4
+};
+
+struct D3D11_BOX {
+	UINT left;
+	UINT top;
+	UINT front;
+	UINT right;
+	UINT bottom;
+	UINT back;
+};
+
+struct D3D11_RECT {
+	LONG left;
+	LONG top;
+	LONG right;
+	LONG bottom;
+};
+
+struct D3D11_VIEWPORT {
+	FLOAT TopLeftX;
+	FLOAT TopLeftY;
+	FLOAT Width;
+	FLOAT Height;
+	FLOAT MinDepth;
+	FLOAT MaxDepth;
+};
+
+struct D3D11_MAPPED_SUBRESOURCE {
+	void* pData;
+	UINT  RowPitch;
+	UINT  DepthPitch;
+};
+
+struct D3D11_BUFFER_DESC {
+	UINT        ByteWidth;
+	D3D11_USAGE Usage;
+	UINT        BindFlags;
+	UINT        CPUAccessFlags;
+	UINT        MiscFlags;
+	UINT        StructureByteStride;
+};
+
+struct DXGI_SAMPLE_DESC {
+	UINT Count;
+	UINT Quality;
+};
+
+struct D3D11_TEXTURE2D_DESC {
+	UINT             Width;
+	UINT             Height;
+	UINT             MipLevels;
+	UINT             ArraySize;
+	DXGI_FORMAT      Format;
+	DXGI_SAMPLE_DESC SampleDesc;
+	D3D11_USAGE      Usage;
+	UINT             BindFlags;
+	UINT             CPUAccessFlags;
+	UINT             MiscFlags;
+};
+
+struct D3D11_TEXTURE3D_DESC {
+	UINT        Width;
+	UINT        Height;
+	UINT        Depth;
+	UINT        MipLevels;
+	DXGI_FORMAT Format;
+	D3D11_USAGE Usage;
+	UINT        BindFlags;
+	UINT        CPUAccessFlags;
+	UINT        MiscFlags;
+};
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Interfaces
+//-----------------------------------------------------------------------------
+#pragma region
+
+struct ID3D11Device;
+
+struct ID3D11DeviceChild : public IUnknown {
+
+	virtual void STDMETHODCALLTYPE GetDevice(ID3D11Device** ppDevice) = 0;
+
+	virtual HRESULT STDMETHODCALLTYPE GetPrivateData(REFGUID guid,
+		                                             UINT* pDataSize,
+		                                             void* pData) = 0;
+
+	virtual HRESULT STDMETHODCALLTYPE SetPrivateData(REFGUID guid,
+		                                             UINT DataSize,
+		                                             const void* pData) = 0;
+
+	virtual HRESULT STDMETHODCALLTYPE SetPrivateDataInterface(
+		REFGUID guid, const IUnknown* pData) = 0;
+};
+
+struct ID3D11Resource : public ID3D11DeviceChild {
+
+	virtual void STDMETHODCALLTYPE GetType(
+		D3D11_RESOURCE_DIMENSION* pResourceDimension) = 0;
+
+	virtual void STDMETHODCALLTYPE SetEvictionPriority(
+		UINT EvictionPriority) = 0;
+
+	virtual UINT STDMETHODCALLTYPE GetEvictionPriority() = 0;
+};
+
+struct ID3D11Buffer : public ID3D11Resource {
+
+	virtual void STDMETHODCALLTYPE GetDesc(D3D11_BUFFER_DESC* pDesc) = 0;
+};
+
+struct ID3D11Texture2D : public ID3D11Resource {
+
+	virtual void STDMETHODCALLTYPE GetDesc(D3D11_TEXTURE2D_DESC* pDesc) = 0;
+};
+
+struct ID3D11Texture3D : public ID3D11Resource {
+
+	virtual void STDMETHODCALLTYPE GetDesc(D3D11_TEXTURE3D_DESC* pDesc) = 0;
+};
+
+struct ID3D11View : public ID3D11DeviceChild {
+
+	virtual void STDMETHODCALLTYPE GetResource(ID3D11Resource** ppResource) = 0;
+};
+
+struct ID3D11ShaderResourceView  : public ID3D11View {};
+struct ID3D11RenderTargetView    : public ID3D11View {};
+struct ID3D11DepthStencilView    : public ID3D11View {};
+struct ID3D11UnorderedAccessView : public ID3D11View {};
+
+struct ID3D11VertexShader        : public ID3D11DeviceChild {};
+struct ID3D11HullShader          : public ID3D11DeviceChild {};
+struct ID3D11DomainShader        : public ID3D11DeviceChild {};
+struct ID3D11GeometryShader      : public ID3D11DeviceChild {};
+struct ID3D11PixelShader         : public ID3D11DeviceChild {};
+struct ID3D11ComputeShader       : public ID3D11DeviceChild {};
+struct ID3D11ClassInstance       : public ID3D11DeviceChild {};
+struct ID3D11InputLayout         : public ID3D11DeviceChild {};
+struct ID3D11SamplerState        : public ID3D11DeviceChild {};
+struct ID3D11RasterizerState     : public ID3D11DeviceChild {};
+struct ID3D11BlendState          : public ID3D11DeviceChild {};
+struct ID3D11DepthStencilState   : public ID3D11DeviceChild {};
+struct ID3D11Asynchronous        : public ID3D11DeviceChild {};
+struct ID3D11Predicate           : public ID3D11Asynchronous {};
+struct ID3D11CommandList         : public ID3D11DeviceChild {};
+
+/**
+ Devices only create resources, which the Linux test build does not.
+ */
+struct ID3D11Device : public IUnknown {};
+
+#define MAGE_STUB_SHADER_STAGE(stage, shader)                                  \
+	virtual void STDMETHODCALLTYPE stage##SetShaderResources(                  \
+		UINT StartSlot, UINT NumViews,                                         \
+		ID3D11ShaderResourceView* const* ppShaderResourceViews) = 0;           \
+	virtual void STDMETHODCALLTYPE stage##SetShader(                           \
+		shader* pShader, ID3D11ClassInstance* const* ppClassInstances,         \
+		UINT NumClassInstances) = 0;                                           \
+	virtual void STDMETHODCALLTYPE stage##SetSamplers(                         \
+		UINT StartSlot, UINT NumSamplers,                                      \
+		ID3D11SamplerState* const* ppSamplers) = 0;                            \
+	virtual void STDMETHODCALLTYPE stage##SetConstantBuffers(                  \
+		UINT StartSlot, UINT NumBuffers,                                       \
+		ID3D11Buffer* const* ppConstantBuffers) = 0;                           \
+	virtual void STDMETHODCALLTYPE stage##GetShaderResources(                  \
+		UINT StartSlot, UINT NumViews,                                         \
+		ID3D11ShaderResourceView** ppShaderResourceViews) = 0;                 \
+	virtual void STDMETHODCALLTYPE stage##GetShader(                           \
+		shader** ppShader, ID3D11ClassInstance** ppClassInstances,             \
+		UINT* pNumClassInstances) = 0;                                         \
+	virtual void STDMETHODCALLTYPE stage##GetSamplers(                         \
+		UINT StartSlot, UINT NumSamplers,                                      \
+		ID3D11SamplerState** ppSamplers) = 0;                                  \
+	virtual void STDMETHODCALLTYPE stage##GetConstantBuffers(                  \
+		UINT StartSlot, UINT NumBuffers,                                       \
+		ID3D11Buffer** ppConstantBuffers) = 0;
+
+struct ID3D11DeviceContext : public ID3D11DeviceChild {
+
+	MAGE_STUB_SHADER_STAGE(VS, ID3D11VertexShader)
+	MAGE_STUB_SHADER_STAGE(HS, ID3D11HullShader)
+	MAGE_STUB_SHADER_STAGE(DS, ID3D11DomainShader)
+	MAGE_STUB_SHADER_STAGE(GS, ID3D11GeometryShader)
+	MAGE_STUB_SHADER_STAGE(PS, ID3D11PixelShader)
+	MAGE_STUB_SHADER_STAGE(CS, ID3D11ComputeShader)
+
+	virtual void STDMETHODCALLTYPE DrawIndexed(UINT IndexCount,
+		                                       UINT StartIndexLocation,
+		                                       INT BaseVertexLocation) = 0;
+
+	virtual void STDMETHODCALLTYPE Draw(UINT VertexCount,
+		                                UINT StartVertexLocation) = 0;
+
+	virtual HRESULT STDMETHODCALLTYPE Map(ID3D11Resource* pResource,
+		                                  UINT Subresource,
+		                                  D3D11_MAP MapType,
+		                                  UINT MapFlags,
+		                                  D3D11_MAPPED_SUBRESOURCE* pMappedResource) = 0;
+
+	virtual void STDMETHODCALLTYPE Unmap(ID3D11Resource* pResource,
+		                                 UINT Subresource) = 0;
+
+	virtual void STDMETHODCALLTYPE IASetInputLayout(
+		ID3D11InputLayout* pInputLayout) = 0;
+
+	virtual void STDMETHODCALLTYPE IASetVertexBuffers(
+		UINT StartSlot, UINT NumBuffers,
+		ID3D11Buffer* const* ppVertexBuffers,
+		const UINT* pStrides, const UINT* pOffsets) = 0;
+
+	virtual void STDMETHODCALLTYPE IASetIndexBuffer(ID3D11Buffer* pIndexBuffer,
+		                                            DXGI_FORMAT Format,
+		                                            UINT Offset) = 0;
+
+	virtual void STDMETHODCALLTYPE DrawIndexedInstanced(
+		UINT IndexCountPerInstance, UINT InstanceCount,
+		UINT StartIndexLocation, INT BaseVertexLocation,
+		UINT StartInstanceLocation) = 0;
+
+	virtual void STDMETHODCALLTYPE DrawInstanced(
+		UINT VertexCountPerInstance, UINT InstanceCount,
+		UINT StartVertexLocation, UINT StartInstanceLocation) = 0;
+
+	virtual void STDMETHODCALLTYPE IASetPrimitiveTopology(
+		D3D11_PRIMITIVE_TOPOLOGY Topology) = 0;
+
+	virtual void STDMETHODCALLTYPE Begin(ID3D11Asynchronous* pAsync) = 0;
+
+	virtual void STDMETHODCALLTYPE End(ID3D11Asynchronous* pAsync) = 0;
+
+	virtual HRESULT STDMETHODCALLTYPE GetData(ID3D11Asynchronous* pAsync,
+		                                      void* pData, UINT DataSize,
+		                                      UINT GetDataFlags) = 0;
+
+	virtual void STDMETHODCALLTYPE SetPredication(ID3D11Predicate* pPredicate,
+		                                          BOOL PredicateValue) = 0;
+
+	virtual void STDMETHODCALLTYPE OMSetRenderTargets(
+		UINT NumViews,
+		ID3D11RenderTargetView* const* ppRenderTargetViews,
+		ID3D11DepthStencilView* pDepthStencilView) = 0;
+
+	virtual void STDMETHODCALLTYPE OMSetRenderTargetsAndUnorderedAccessViews(
+		UINT NumRTVs,
+		ID3D11RenderTargetView* const* ppRenderTargetViews,
+		ID3D11DepthStencilView* pDepthStencilView,
+		UINT UAVStartSlot, UINT NumUAVs,
+		ID3D11UnorderedAccessView* const* ppUnorderedAccessViews,
+		const UINT* pUAVInitialCounts) = 0;
+
+	virtual void STDMETHODCALLTYPE OMSetBlendState(ID3D11BlendState* pBlendState,
+		                                           const FLOAT BlendFactor[4],
+		                                           UINT SampleMask) = 0;
+
+	virtual void STDMETHODCALLTYPE OMSetDepthStencilState(
+		ID3D11DepthStencilState* pDepthStencilState, UINT StencilRef) = 0;
+
+	virtual void STDMETHODCALLTYPE SOSetTargets(UINT NumBuffers,
+		                                        ID3D11Buffer* const* ppSOTargets,
+		                                        const UINT* pOffsets) = 0;
+
+	virtual void STDMETHODCALLTYPE DrawAuto() = 0;
+
+	virtual void STDMETHODCALLTYPE DrawIndexedInstancedIndirect(
+		ID3D11Buffer* pBufferForArgs, UINT AlignedByteOffsetForArgs) = 0;
+
+	virtual void STDMETHODCALLTYPE DrawInstancedIndirect(
+		ID3D11Buffer* pBufferForArgs, UINT AlignedByteOffsetForArgs) = 0;
+
+	virtual void STDMETHODCALLTYPE Dispatch(UINT ThreadGroupCountX,
+		                                    UINT ThreadGroupCountY,
+		                                    UINT ThreadGroupCountZ) = 0;
+
+	virtual void STDMETHODCALLTYPE DispatchIndirect(
+		ID3D11Buffer* pBufferForArgs, UINT AlignedByteOffsetForArgs) = 0;
+
+	virtual void STDMETHODCALLTYPE RSSetState(
+		ID3D11RasterizerState* pRasterizerState) = 0;
+
+	virtual void STDMETHODCALLTYPE RSSetViewports(
+		UINT NumViewports, const D3D11_VIEWPORT* pViewports) = 0;
+
+	virtual void STDMETHODCALLTYPE RSSetScissorRects(
+		UINT NumRects, const D3D11_RECT* pRects) = 0;
+
+	virtual void STDMETHODCALLTYPE CopySubresourceRegion(
+		ID3D11Resource* pDstResource, UINT DstSubresource,
+		UINT DstX, UINT DstY, UINT DstZ,
+		ID3D11Resource* pSrcResource, UINT SrcSubresource,
+		const D3D11_BOX* pSrcBox) = 0;
+
+	virtual void STDMETHODCALLTYPE CopyResource(ID3D11Resource* pDstResource,
+		                                        ID3D11Resource* pSrcResource) = 0;
+
+	virtual void STDMETHODCALLTYPE UpdateSubresource(
+		ID3D11Resource* pDstResource, UINT DstSubresource,
+		const D3D11_BOX* pDstBox, const void* pSrcData,
+		UINT SrcRowPitch, UINT SrcDepthPitch) = 0;
+
+	virtual void STDMETHODCALLTYPE CopyStructureCount(
+		ID3D11Buffer* pDstBuffer, UINT DstAlignedByteOffset,
+		ID3D11UnorderedAccessView* pSrcView) = 0;
+
+	virtual void STDMETHODCALLTYPE ClearRenderTargetView(
+		ID3D11RenderTargetView* pRenderTargetView,
+		const FLOAT ColorRGBA[4]) = 0;
+
+	virtual void STDMETHODCALLTYPE ClearUnorderedAccessViewUint(
+		ID3D11UnorderedAccessView* pUnorderedAccessView,
+		const UINT Values[4]) = 0;
+
+	virtual void STDMETHODCALLTYPE ClearUnorderedAccessViewFloat(
+		ID3D11UnorderedAccessView* pUnorderedAccessView,
+		const FLOAT Values[4]) = 0;
+
+	virtual void STDMETHODCALLTYPE ClearDepthStencilView(
+		ID3D11DepthStencilView* pDepthStencilView,
+		UINT ClearFlags, FLOAT Depth, UINT8 Stencil) = 0;
+
+	virtual void STDMETHODCALLTYPE GenerateMips(
+		ID3D11ShaderResourceView* pShaderResourceView) = 0;
+
+	virtual void STDMETHODCALLTYPE SetResourceMinLOD(ID3D11Resource* pResource,
+		                                             FLOAT MinLOD) = 0;
+
+	virtual FLOAT STDMETHODCALLTYPE GetResourceMinLOD(
+		ID3D11Resource* pResource) = 0;
+
+	virtual void STDMETHODCALLTYPE ResolveSubresource(
+		ID3D11Resource* pDstResource, UINT DstSubresource,
+		ID3D11Resource* pSrcResource, UINT SrcSubresource,
+		DXGI_FORMAT Format) = 0;
+
+	virtual void STDMETHODCALLTYPE ExecuteCommandList(
+		ID3D11CommandList* pCommandList, BOOL RestoreContextState) = 0;
+
+	virtual void STDMETHODCALLTYPE CSSetUnorderedAccessViews(
+		UINT StartSlot, UINT NumUAVs,
+		ID3D11UnorderedAccessView* const* ppUnorderedAccessViews,
+		const UINT* pUAVInitialCounts) = 0;
+
+	virtual void STDMETHODCALLTYPE IAGetInputLayout(
+		ID3D11InputLayout** ppInputLayout) = 0;
+
+	virtual void STDMETHODCALLTYPE IAGetVertexBuffers(
+		UINT StartSlot, UINT NumBuffers, ID3D11Buffer** ppVertexBuffers,
+		UINT* pStrides, UINT* pOffsets) = 0;
+
+	virtual void STDMETHODCALLTYPE IAGetIndexBuffer(ID3D11Buffer** pIndexBuffer,
+		                                            DXGI_FORMAT* Format,
+		                                            UINT* Offset) = 0;
+
+	virtual void STDMETHODCALLTYPE IAGetPrimitiveTopology(
+		D3D11_PRIMITIVE_TOPOLOGY* pTopology) = 0;
+
+	virtual void STDMETHODCALLTYPE GetPredication(ID3D11Predicate** ppPredicate,
+		                                          BOOL* pPredicateValue) = 0;
+
+	virtual void STDMETHODCALLTYPE OMGetRenderTargets(
+		UINT NumViews, ID3D11RenderTargetView** ppRenderTargetViews,
+		ID3D11DepthStencilView** ppDepthStencilView) = 0;
+
+	virtual void STDMETHODCALLTYPE OMGetRenderTargetsAndUnorderedAccessViews(
+		UINT NumRTVs, ID3D11RenderTargetView** ppRenderTargetViews,
+		ID3D11DepthStencilView** ppDepthStencilView,
+		UINT UAVStartSlot, UINT NumUAVs,
+		ID3D11UnorderedAccessView** ppUnorderedAccessViews) = 0;
+
+	virtual void STDMETHODCALLTYPE OMGetBlendState(ID3D11BlendState** ppBlendState,
+		                                           FLOAT BlendFactor[4],
+		                                           UINT* pSampleMask) = 0;
+
+	virtual void STDMETHODCALLTYPE OMGetDepthStencilState(
+		ID3D11DepthStencilState** ppDepthStencilState, UINT* pStencilRef) = 0;
+
+	virtual void STDMETHODCALLTYPE SOGetTargets(UINT NumBuffers,
+		                                        ID3D11Buffer** ppSOTargets) = 0;
+
+	virtual void STDMETHODCALLTYPE RSGetState(
+		ID3D11RasterizerState** ppRasterizerState) = 0;
+
+	virtual void STDMETHODCALLTYPE RSGetViewports(
+		UINT* pNumViewports, D3D11_VIEWPORT* pViewports) = 0;
+
+	virtual void STDMETHODCALLTYPE RSGetScissorRects(
+		UINT* pNumRects, D3D11_RECT* pRects) = 0;
+
+	virtual void STDMETHODCALLTYPE CSGetUnorderedAccessViews(
+		UINT StartSlot, UINT NumUAVs,
+		ID3D11UnorderedAccessView** ppUnorderedAccessViews) = 0;
+
+	virtual void STDMETHODCALLTYPE ClearState() = 0;
+
+	virtual void STDMETHODCALLTYPE Flush() = 0;
+
+	virtual D3D11_DEVICE_CONTEXT_TYPE STDMETHODCALLTYPE GetType() = 0;
+
+	virtual UINT STDMETHODCALLTYPE GetContextFlags() = 0;
+
+	virtual HRESULT STDMETHODCALLTYPE FinishCommandList(
+		BOOL RestoreDeferredContextState,
+		ID3D11CommandList** ppCommandList) = 0;
+};
+
+#undef MAGE_STUB_SHADER_STAGE
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,29 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "windows.h"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Stub Definitions
+//-----------------------------------------------------------------------------
+//
+// A stand-in for the subset of the DirectInput API used by the engine
+// sources and tests of the Linux test build. Only the device states are
+// used, so the interfaces are incomplete. The values of the constants match
+// the Windows SDK.
+//
+
+#pragma region
+
+#define DIK_W 0x11
+
+struct IDirectInput8;
+struct IDirectInputDevice8;
+
+#pragma endregion
\ No newline at end of file
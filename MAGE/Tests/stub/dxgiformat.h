@@ -0,0 +1,43 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Stub Definitions
+//-----------------------------------------------------------------------------
+//
+// A stand-in for the DXGI formats used by the engine sources of the Linux
+// test build. The values match the Windows SDK.
+//
+
+enum DXGI_FORMAT {
+	DXGI_FORMAT_UNKNOWN                    = 0,
+	DXGI_FORMAT_R32G32B32A32_FLOAT         = 2,
+	DXGI_FORMAT_R32G32B32A32_UINT          = 3,
+	DXGI_FORMAT_R32G32B32_FLOAT            = 6,
+	DXGI_FORMAT_R16G16B16A16_FLOAT         = 10,
+	DXGI_FORMAT_R16G16B16A16_UNORM         = 11,
+	DXGI_FORMAT_R32G32_FLOAT               = 16,
+	DXGI_FORMAT_R10G10B10A2_UNORM          = 24,
+	DXGI_FORMAT_R11G11B10_FLOAT            = 26,
+	DXGI_FORMAT_R8G8B8A8_TYPELESS          = 27,
+	DXGI_FORMAT_R8G8B8A8_UNORM             = 28,
+	DXGI_FORMAT_R8G8B8A8_UNORM_SRGB        = 29,
+	DXGI_FORMAT_R8G8B8A8_UINT              = 30,
+	DXGI_FORMAT_R16G16_FLOAT               = 34,
+	DXGI_FORMAT_R16G16_UNORM               = 35,
+	DXGI_FORMAT_R32_TYPELESS               = 39,
+	DXGI_FORMAT_D32_FLOAT                  = 40,
+	DXGI_FORMAT_R32_FLOAT                  = 41,
+	DXGI_FORMAT_R32_UINT                   = 42,
+	DXGI_FORMAT_R24G8_TYPELESS             = 44,
+	DXGI_FORMAT_D24_UNORM_S8_UINT          = 45,
+	DXGI_FORMAT_R24_UNORM_X8_TYPELESS      = 46,
+	DXGI_FORMAT_R16_TYPELESS               = 53,
+	DXGI_FORMAT_R16_FLOAT                  = 54,
+	DXGI_FORMAT_D16_UNORM                  = 55,
+	DXGI_FORMAT_R16_UNORM                  = 56,
+	DXGI_FORMAT_R16_UINT                   = 57,
+	DXGI_FORMAT_R8_UNORM                   = 61,
+	DXGI_FORMAT_R8_UINT                    = 62,
+	DXGI_FORMAT_B8G8R8A8_UNORM             = 87,
+	DXGI_FORMAT_B8G8R8A8_UNORM_SRGB        = 91
+};
\ No newline at end of file
@@ -0,0 +1,30 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include_next <malloc.h>
+#include <cstdlib>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Stub Definitions
+//-----------------------------------------------------------------------------
+//
+// The aligned allocation functions of the Microsoft CRT.
+//
+
+inline void* _aligned_malloc(std::size_t size, std::size_t alignment) noexcept {
+	void* ptr = nullptr;
+	if (alignment < sizeof(void*)) {
+		alignment = sizeof(void*);
+	}
+	return (0 == posix_memalign(&ptr, alignment, size)) ? ptr : nullptr;
+}
+
+inline void _aligned_free(void* ptr) noexcept {
+	std::free(ptr);
+}
\ No newline at end of file
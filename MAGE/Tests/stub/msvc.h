@@ -0,0 +1,28 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <cmath>
+#include <csignal>
+#include <stddef.h>
+#include <tuple>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Stub Definitions
+//-----------------------------------------------------------------------------
+//
+// Included before every source file of the Linux test build. Provides what
+// MSVC declares without an include or includes transitively through the
+// standard headers used by the engine sources.
+//
+
+#define __noop ((void)0)
+
+inline void __debugbreak() noexcept {
+	std::raise(SIGTRAP);
+}
\ No newline at end of file
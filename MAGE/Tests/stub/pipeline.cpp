@@ -0,0 +1,28 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\pipeline.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+//
+// The static members of the pipeline are defined in rendering_manager.cpp,
+// which is not part of the Linux test build.
+//
+namespace mage::rendering {
+
+	U32 Pipeline::s_nb_draws = 0u;
+
+	U32 Pipeline::s_nb_vertices = 0u;
+
+	U32 Pipeline::s_nb_bindings = 0u;
+
+	U32 Pipeline::s_nb_redundant_bindings = 0u;
+
+	Pipeline::StateCache Pipeline::s_state_cache;
+}
\ No newline at end of file
@@ -0,0 +1,414 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <cerrno>
+#include <chrono>
+#include <cstdarg>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cwchar>
+#include <string>
+#include <thread>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Stub Definitions
+//-----------------------------------------------------------------------------
+//
+// A stand-in for the subset of the Windows API used by the engine sources of
+// the Linux test build. Functions without a meaningful Linux counterpart
+// report failure.
+//
+
+#pragma region
+
+#define WINAPI
+#define STDMETHODCALLTYPE
+#define STDMETHODIMP        HRESULT STDMETHODCALLTYPE
+#define STDMETHODIMP_(type) type STDMETHODCALLTYPE
+#define __declspec(x)
+#define _In_
+#define _In_opt_
+#define _Out_
+#define _Out_opt_
+#define _Inout_
+
+using BOOL      = int;
+using BOOLEAN   = unsigned char;
+using BYTE      = unsigned char;
+using CHAR      = char;
+using WCHAR     = wchar_t;
+using SHORT     = std::int16_t;
+using USHORT    = std::uint16_t;
+using WORD      = std::uint16_t;
+using INT       = std::int32_t;
+using INT8      = std::int8_t;
+using INT16     = std::int16_t;
+using INT32     = std::int32_t;
+using INT64     = long long;
+using UINT      = std::uint32_t;
+using UINT8     = std::uint8_t;
+using UINT16    = std::uint16_t;
+using UINT32    = std::uint32_t;
+using UINT64    = unsigned long long;
+using LONG      = std::int32_t;
+using ULONG     = std::uint32_t;
+using DWORD     = std::uint32_t;
+using LONGLONG  = long long;
+using ULONGLONG = unsigned long long;
+using SIZE_T    = std::size_t;
+using FLOAT     = float;
+using HRESULT   = long;
+using LPVOID    = void*;
+using LPCVOID   = const void*;
+using LPCSTR    = const char*;
+using LPCWSTR   = const wchar_t*;
+using HANDLE    = void*;
+using HWND      = struct HWND__*;
+using HMODULE   = struct HINSTANCE__*;
+using HINSTANCE = struct HINSTANCE__*;
+using errno_t   = int;
+
+#define TRUE  1
+#define FALSE 0
+
+#define S_OK                   static_cast< HRESULT >(static_cast< std::int32_t >(0x00000000u))
+#define S_FALSE                static_cast< HRESULT >(static_cast< std::int32_t >(0x00000001u))
+#define E_NOTIMPL              static_cast< HRESULT >(static_cast< std::int32_t >(0x80004001u))
+#define E_NOINTERFACE          static_cast< HRESULT >(static_cast< std::int32_t >(0x80004002u))
+#define E_POINTER              static_cast< HRESULT >(static_cast< std::int32_t >(0x80004003u))
+#define E_FAIL                 static_cast< HRESULT >(static_cast< std::int32_t >(0x80004005u))
+#define E_OUTOFMEMORY          static_cast< HRESULT >(static_cast< std::int32_t >(0x8007000Eu))
+#define E_INVALIDARG           static_cast< HRESULT >(static_cast< std::int32_t >(0x80070057u))
+
+#define SUCCEEDED(hr)          (static_cast< HRESULT >(hr) >= 0)
+#define FAILED(hr)             (static_cast< HRESULT >(hr) < 0)
+
+#define INVALID_HANDLE_VALUE   reinterpret_cast< HANDLE >(-1)
+
+#define STD_INPUT_HANDLE       static_cast< DWORD >(-10)
+#define STD_OUTPUT_HANDLE      static_cast< DWORD >(-11)
+#define STD_ERROR_HANDLE       static_cast< DWORD >(-12)
+
+#define CTRL_CLOSE_EVENT       2
+
+#define GENERIC_READ           0x80000000u
+#define FILE_SHARE_READ        0x00000001u
+#define OPEN_EXISTING          3u
+
+#define _TRUNCATE              static_cast< std::size_t >(-1)
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// COM
+//-----------------------------------------------------------------------------
+#pragma region
+
+struct GUID {
+	std::uint32_t Data1;
+	std::uint16_t Data2;
+	std::uint16_t Data3;
+	std::uint8_t  Data4[8];
+};
+
+using IID     = GUID;
+using REFGUID = const GUID&;
+using REFIID  = const GUID&;
+
+inline bool operator==(REFGUID lhs, REFGUID rhs) noexcept {
+	return 0 == std::memcmp(&lhs, &rhs, sizeof(GUID));
+}
+
+inline bool operator!=(REFGUID lhs, REFGUID rhs) noexcept {
+	return !(lhs == rhs);
+}
+
+namespace stub {
+
+	/**
+	 Returns a GUID which is unique for the given type in this process.
+
+	 @tparam		T
+					The type.
+	 @return		A reference to the GUID of the given type.
+	 */
+	template< typename T >
+	inline const GUID& UuidOf() noexcept {
+		static const char tag = 0;
+		static const GUID guid = [] {
+			GUID result = {};
+			const auto address = reinterpret_cast< std::uintptr_t >(&tag);
+			std::memcpy(result.Data4, &address, sizeof(address));
+			return result;
+		}();
+		return guid;
+	}
+}
+
+#define __uuidof(type) stub::UuidOf< type >()
+
+struct IUnknown {
+
+	virtual ~IUnknown() = default;
+
+	virtual HRESULT STDMETHODCALLTYPE QueryInterface(REFIID riid,
+		                                             void** ppvObject) = 0;
+
+	virtual ULONG STDMETHODCALLTYPE AddRef() = 0;
+
+	virtual ULONG STDMETHODCALLTYPE Release() = 0;
+};
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Handles and Files
+//-----------------------------------------------------------------------------
+#pragma region
+
+struct COORD {
+	SHORT X;
+	SHORT Y;
+};
+
+struct SMALL_RECT {
+	SHORT Left;
+	SHORT Top;
+	SHORT Right;
+	SHORT Bottom;
+};
+
+struct CONSOLE_SCREEN_BUFFER_INFO {
+	COORD      dwSize;
+	COORD      dwCursorPosition;
+	WORD       wAttributes;
+	SMALL_RECT srWindow;
+	COORD      dwMaximumWindowSize;
+};
+
+union LARGE_INTEGER {
+	struct {
+		DWORD LowPart;
+		LONG  HighPart;
+	};
+	LONGLONG QuadPart;
+};
+
+enum FILE_INFO_BY_HANDLE_CLASS {
+	FileStandardInfo = 1
+};
+
+struct FILE_STANDARD_INFO {
+	LARGE_INTEGER AllocationSize;
+	LARGE_INTEGER EndOfFile;
+	DWORD         NumberOfLinks;
+	BOOLEAN       DeletePending;
+	BOOLEAN       Directory;
+};
+
+struct FILETIME {
+	DWORD dwLowDateTime;
+	DWORD dwHighDateTime;
+};
+
+using PHANDLER_ROUTINE = BOOL (WINAPI*)(DWORD);
+
+inline HANDLE GetStdHandle(DWORD) noexcept {
+	return nullptr;
+}
+
+inline BOOL GetConsoleScreenBufferInfo(HANDLE,
+	                                   CONSOLE_SCREEN_BUFFER_INFO*) noexcept {
+	return FALSE;
+}
+
+inline BOOL AllocConsole() noexcept {
+	return FALSE;
+}
+
+inline BOOL FreeConsole() noexcept {
+	return FALSE;
+}
+
+inline BOOL SetConsoleCtrlHandler(PHANDLER_ROUTINE, BOOL) noexcept {
+	return FALSE;
+}
+
+inline BOOL CloseHandle(HANDLE handle) noexcept {
+	const auto fd = static_cast< int >(reinterpret_cast< std::intptr_t >(handle)) - 1;
+	return (0 == ::close(fd)) ? TRUE : FALSE;
+}
+
+/**
+ File handles are file descriptors offset by one, so that @c nullptr is no
+ valid file handle.
+ */
+inline HANDLE CreateFile2(const char* path, DWORD, DWORD, DWORD,
+	                      void*) noexcept {
+	const auto fd = ::open(path, O_RDONLY);
+	return (-1 == fd) ? INVALID_HANDLE_VALUE
+		              : reinterpret_cast< HANDLE >(static_cast< std::intptr_t >(fd + 1));
+}
+
+inline BOOL GetFileSizeEx(HANDLE handle, LARGE_INTEGER* size) noexcept {
+	const auto fd = static_cast< int >(reinterpret_cast< std::intptr_t >(handle)) - 1;
+	struct stat status;
+	if (0 != ::fstat(fd, &status)) {
+		return FALSE;
+	}
+	size->QuadPart = status.st_size;
+	return TRUE;
+}
+
+/**
+ Only @c FileStandardInfo is supported, of which only the end of file is
+ set.
+ */
+inline BOOL GetFileInformationByHandleEx(HANDLE handle,
+	                                     FILE_INFO_BY_HANDLE_CLASS info_class,
+	                                     void* info, DWORD size) noexcept {
+	if (FileStandardInfo != info_class || sizeof(FILE_STANDARD_INFO) > size) {
+		return FALSE;
+	}
+
+	auto& standard_info = *static_cast< FILE_STANDARD_INFO* >(info);
+	standard_info = {};
+	return GetFileSizeEx(handle, &standard_info.EndOfFile);
+}
+
+inline BOOL ReadFile(HANDLE handle, void* buffer, DWORD nb_bytes,
+	                 DWORD* nb_bytes_read, void*) noexcept {
+	const auto fd = static_cast< int >(reinterpret_cast< std::intptr_t >(handle)) - 1;
+	const auto result = ::read(fd, buffer, nb_bytes);
+	if (result < 0) {
+		return FALSE;
+	}
+	*nb_bytes_read = static_cast< DWORD >(result);
+	return TRUE;
+}
+
+inline void Sleep(DWORD milliseconds) {
+	std::this_thread::sleep_for(std::chrono::milliseconds(milliseconds));
+}
+
+inline DWORD GetLastError() noexcept {
+	return static_cast< DWORD >(errno);
+}
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Information and Threads
+//-----------------------------------------------------------------------------
+#pragma region
+
+#define ERROR_INSUFFICIENT_BUFFER 122u
+#define COINIT_MULTITHREADED      0x0u
+
+enum LOGICAL_PROCESSOR_RELATIONSHIP {
+	RelationProcessorCore = 0
+};
+
+struct SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX {
+	LOGICAL_PROCESSOR_RELATIONSHIP Relationship;
+	DWORD                          Size;
+};
+
+using PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX 
+	= SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX*;
+
+struct SYSTEM_INFO {
+	DWORD dwNumberOfProcessors;
+};
+
+inline BOOL GetLogicalProcessorInformationEx(
+	LOGICAL_PROCESSOR_RELATIONSHIP, PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX,
+	DWORD*) noexcept {
+
+	return FALSE;
+}
+
+inline void GetSystemInfo(SYSTEM_INFO* info) noexcept {
+	info->dwNumberOfProcessors 
+		= static_cast< DWORD >(std::thread::hardware_concurrency());
+}
+
+inline HRESULT CoInitializeEx(void*, DWORD) noexcept {
+	return S_OK;
+}
+
+inline void CoUninitialize() noexcept {}
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// CRT
+//-----------------------------------------------------------------------------
+#pragma region
+
+inline int vsnprintf_s(char* buffer, std::size_t size, std::size_t,
+	                   const char* format, va_list args) noexcept {
+	return std::vsnprintf(buffer, size, format, args);
+}
+
+inline int sprintf_s(char* buffer, std::size_t size,
+	                 const char* format, ...) noexcept {
+	va_list args;
+	va_start(args, format);
+	const auto result = std::vsnprintf(buffer, size, format, args);
+	va_end(args);
+	return result;
+}
+
+inline errno_t strcpy_s(char* destination, std::size_t size,
+	                    const char* source) noexcept {
+	if (!destination || 0u == size) {
+		return EINVAL;
+	}
+	const auto length = std::strlen(source);
+	if (size <= length) {
+		*destination = '\0';
+		return ERANGE;
+	}
+	std::memcpy(destination, source, length + 1u);
+	return 0;
+}
+
+inline errno_t fopen_s(FILE** file, const char* path,
+	                   const char* mode) noexcept {
+	*file = std::fopen(path, mode);
+	return *file ? 0 : errno;
+}
+
+/**
+ The paths of @c std::filesystem::path are narrow strings on Linux.
+ */
+inline errno_t _wfopen_s(FILE** file, const char* path,
+	                     const wchar_t* mode) noexcept {
+	char narrow_mode[8] = {};
+	for (std::size_t i = 0u; mode[i] && i + 1u < sizeof(narrow_mode); ++i) {
+		narrow_mode[i] = static_cast< char >(mode[i]);
+	}
+	return fopen_s(file, path, narrow_mode);
+}
+
+inline errno_t freopen_s(FILE** file, const char* path, const char* mode,
+	                     FILE* stream) noexcept {
+	*file = std::freopen(path, mode, stream);
+	return *file ? 0 : errno;
+}
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,3 @@
+#pragma once
+
+#include "wrl/client.h"
\ No newline at end of file
@@ -0,0 +1,173 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "windows.h"
+#include <utility>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Stub Definitions
+//-----------------------------------------------------------------------------
+namespace Microsoft::WRL {
+
+	/**
+	 A class of reference counting smart pointers to COM objects.
+
+	 @tparam		T
+					The COM interface type.
+	 */
+	template< typename T >
+	class ComPtr {
+
+	public:
+
+		using InterfaceType = T;
+
+		ComPtr() noexcept = default;
+
+		ComPtr(std::nullptr_t) noexcept {}
+
+		template< typename U >
+		ComPtr(U* ptr) noexcept
+			: m_ptr(ptr) {
+			InternalAddRef();
+		}
+
+		ComPtr(const ComPtr& ptr) noexcept
+			: m_ptr(ptr.m_ptr) {
+			InternalAddRef();
+		}
+
+		template< typename U >
+		ComPtr(const ComPtr< U >& ptr) noexcept
+			: m_ptr(ptr.Get()) {
+			InternalAddRef();
+		}
+
+		ComPtr(ComPtr&& ptr) noexcept
+			: m_ptr(std::exchange(ptr.m_ptr, nullptr)) {}
+
+		~ComPtr() {
+			InternalRelease();
+		}
+
+		ComPtr& operator=(ComPtr ptr) noexcept {
+			std::swap(m_ptr, ptr.m_ptr);
+			return *this;
+		}
+
+		ComPtr& operator=(std::nullptr_t) noexcept {
+			InternalRelease();
+			return *this;
+		}
+
+		[[nodiscard]]
+		T* Get() const noexcept {
+			return m_ptr;
+		}
+
+		[[nodiscard]]
+		T* operator->() const noexcept {
+			return m_ptr;
+		}
+
+		explicit operator bool() const noexcept {
+			return nullptr != m_ptr;
+		}
+
+		[[nodiscard]]
+		T* const* GetAddressOf() const noexcept {
+			return &m_ptr;
+		}
+
+		[[nodiscard]]
+		T** GetAddressOf() noexcept {
+			return &m_ptr;
+		}
+
+		[[nodiscard]]
+		T** ReleaseAndGetAddressOf() noexcept {
+			InternalRelease();
+			return &m_ptr;
+		}
+
+		[[nodiscard]]
+		T** operator&() noexcept {
+			return ReleaseAndGetAddressOf();
+		}
+
+		ULONG Reset() noexcept {
+			return InternalRelease();
+		}
+
+		T* Detach() noexcept {
+			return std::exchange(m_ptr, nullptr);
+		}
+
+		void Attach(T* ptr) noexcept {
+			InternalRelease();
+			m_ptr = ptr;
+		}
+
+		template< typename U >
+		HRESULT As(ComPtr< U >* ptr) const noexcept {
+			return m_ptr->QueryInterface(__uuidof(U),
+				reinterpret_cast< void** >(ptr->ReleaseAndGetAddressOf()));
+		}
+
+	private:
+
+		void InternalAddRef() const noexcept {
+			if (m_ptr) {
+				m_ptr->AddRef();
+			}
+		}
+
+		ULONG InternalRelease() noexcept {
+			ULONG count = 0u;
+			if (auto ptr = std::exchange(m_ptr, nullptr)) {
+				count = ptr->Release();
+			}
+			return count;
+		}
+
+		T* m_ptr = nullptr;
+	};
+
+	template< typename T, typename U >
+	inline bool operator==(const ComPtr< T >& lhs,
+		                   const ComPtr< U >& rhs) noexcept {
+		return lhs.Get() == rhs.Get();
+	}
+
+	template< typename T >
+	inline bool operator==(const ComPtr< T >& lhs, std::nullptr_t) noexcept {
+		return nullptr == lhs.Get();
+	}
+
+	template< typename T >
+	inline bool operator==(std::nullptr_t, const ComPtr< T >& rhs) noexcept {
+		return nullptr == rhs.Get();
+	}
+
+	template< typename T, typename U >
+	inline bool operator!=(const ComPtr< T >& lhs,
+		                   const ComPtr< U >& rhs) noexcept {
+		return lhs.Get() != rhs.Get();
+	}
+
+	template< typename T >
+	inline bool operator!=(const ComPtr< T >& lhs, std::nullptr_t) noexcept {
+		return nullptr != lhs.Get();
+	}
+
+	template< typename T >
+	inline bool operator!=(std::nullptr_t, const ComPtr< T >& rhs) noexcept {
+		return nullptr != rhs.Get();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,67 @@
+"""
+Compares the triangle counts and frame times of a demo scene rendered with 
+and without levels of detail.
+
+The demo is run twice in benchmark mode (with a fixed time step and a static 
+camera): once with the generated levels of detail and once with the original 
+meshes only (-no-lod). The summaries of both benchmark reports are printed 
+side by side.
+
+Usage:
+    python compare_lods.py <Demo.exe> [--scene sponza] [--frames 600]
+
+The demo must be run from (or next to) its assets directory.
+"""
+
+import argparse
+import json
+import os
+import subprocess
+import sys
+
+FIELDS = ("triangles", "draws", "frame_ms", "render_ms", "update_ms")
+STATISTICS = ("avg", "p50", "p95", "p99")
+
+def run_benchmark(demo, scene, frames, report, lods):
+    arguments = [demo, "-scene", scene, "-benchmark", str(frames), report]
+    if not lods:
+        arguments.append("-no-lod")
+
+    subprocess.run(arguments, cwd=os.path.dirname(os.path.abspath(demo)), 
+                   check=True)
+
+    with open(report) as file:
+        return json.load(file)["summary"]
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, 
+        formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("demo", help="path to Demo.exe")
+    parser.add_argument("--scene", default="sponza")
+    parser.add_argument("--frames", type=int, default=600)
+    arguments = parser.parse_args()
+
+    directory = os.path.dirname(os.path.abspath(arguments.demo))
+    lod    = run_benchmark(arguments.demo, arguments.scene, arguments.frames, 
+                           os.path.join(directory, "benchmark_lod.json"), 
+                           True)
+    no_lod = run_benchmark(arguments.demo, arguments.scene, arguments.frames, 
+                           os.path.join(directory, "benchmark_no_lod.json"), 
+                           False)
+
+    print("%-12s %-4s %14s %14s %9s" % ("field", "stat", "original", "lod", 
+                                        "ratio"))
+    for field in FIELDS:
+        if field not in lod or field not in no_lod:
+            continue
+        for statistic in STATISTICS:
+            original = no_lod[field][statistic]
+            reduced  = lod[field][statistic]
+            ratio    = reduced / original if original else float("nan")
+            print("%-12s %-4s %14.3f %14.3f %9.3f" 
+                  % (field, statistic, original, reduced, ratio))
+
+    return 0
+
+if __name__ == "__main__":
+    sys.exit(main())
\ No newline at end of file
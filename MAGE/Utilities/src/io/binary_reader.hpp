@@ -358,6 +358,18 @@ namespace mage {
 			return m_pos < m_end;
 		}
 
+		/**
+		 Returns the number of characters left to read by this big endian 
+		 binary reader.
+
+		 @return		The number of characters left to read by this big 
+						endian binary reader.
+		 */
+		[[nodiscard]]
+		size_t GetNumberOfRemainingChars() const noexcept {
+			return static_cast< size_t >(m_end - m_pos);
+		}
+
 		/**
 		 Reads a @c T value.
 
@@ -7,6 +7,7 @@
 #include "loaders\var\var_loader.hpp"
 #include "string\string_utils.hpp"
 #include "exception\exception.hpp"
+#include "system\profiler.hpp"
 
 #pragma endregion
 
@@ -19,6 +20,8 @@ namespace mage::loader {
 									  std::map< std::string, Value >&
 									  variable_buffer) {
 		
+		MAGE_PROFILE_FUNCTION();
+
 		std::wstring extension(path.extension());
 		TransformToLowerCase(extension);
 
@@ -5,6 +5,7 @@
 
 #include "logging\dump.hpp"
 #include "logging\error.hpp"
+#include "logging\logger.hpp"
 
 #pragma endregion
 
@@ -14,6 +15,8 @@
 #pragma region
 
 #include <dbghelp.h>
+#include <cstdlib>
+#include <exception>
 
 #pragma endregion
 
@@ -33,18 +36,43 @@ namespace mage {
 
 	namespace {
 
+		/**
+		 The terminate handler replaced by @c TerminateHandler.
+		 */
+		std::terminate_handler g_terminate_handler = nullptr;
+
 		[[nodiscard]]
 		inline LONG WINAPI UnhandledExceptionFilter(
 			EXCEPTION_POINTERS* exception_record) noexcept {
 
 			CreateMiniDump(exception_record);
+
+			// Write the pending log messages before the process terminates.
+			Logger::Get().Flush();
 			return EXCEPTION_CONTINUE_SEARCH;
 		}
 
+		[[noreturn]]
+		void TerminateHandler() noexcept {
+			// Write the pending log messages before the process terminates.
+			Logger::Get().Flush();
+
+			if (nullptr != g_terminate_handler) {
+				g_terminate_handler();
+			}
+
+			std::abort();
+		}
 	}
 
 	void AddUnhandledExceptionFilter() noexcept {
 		SetUnhandledExceptionFilter(UnhandledExceptionFilter);
+
+		if (const auto handler = std::set_terminate(TerminateHandler);
+			TerminateHandler != handler) {
+
+			g_terminate_handler = handler;
+		}
 	}
 
 	void CreateMiniDump(EXCEPTION_POINTERS* exception_record) noexcept {
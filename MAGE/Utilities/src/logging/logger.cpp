@@ -0,0 +1,540 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "logging\logger.hpp"
+#include "exception\exception.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <iterator>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	namespace {
+
+		static_assert(0u == (MAGE_LOGGER_QUEUE_SIZE & (MAGE_LOGGER_QUEUE_SIZE - 1u)),
+					  "The logger queue size must be a power of two.");
+
+		/**
+		 The period of refreshing the cached console width.
+		 */
+		constexpr std::chrono::seconds g_console_width_period(1);
+
+		/**
+		 The per-thread buffer for formatting messages.
+		 */
+		thread_local char g_message_buffer[MAGE_LOGGER_MESSAGE_SIZE];
+
+		/**
+		 Returns the name of the given log severity.
+
+		 @param[in]		severity
+						The log severity.
+		 @return		A pointer to the name of the given log severity.
+		 */
+		[[nodiscard]]
+		constexpr const_zstring GetName(LogSeverity severity) noexcept {
+			switch (severity) {
+
+			case LogSeverity::Debug:
+				return "Debug Info";
+			case LogSeverity::Info:
+				return "Info";
+			case LogSeverity::Warning:
+				return "Warning";
+			case LogSeverity::Error:
+				return "Error";
+			default:
+				return "Fatal Error";
+			}
+		}
+
+		/**
+		 Queries the width of the console attached to the standard error
+		 device.
+
+		 Unlike @c ConsoleWidth, this function does not throw (and thus does
+		 not log) if no console is attached.
+
+		 @return		The width of the console attached to the standard
+						error device. @c 0 if no console is attached.
+		 */
+		[[nodiscard]]
+		U16 QueryConsoleWidth() noexcept {
+			const auto handle = GetStdHandle(STD_ERROR_HANDLE);
+			if (nullptr == handle || INVALID_HANDLE_VALUE == handle) {
+				return 0u;
+			}
+
+			CONSOLE_SCREEN_BUFFER_INFO buffer_info = {};
+			if (!GetConsoleScreenBufferInfo(handle, &buffer_info)) {
+				return 0u;
+			}
+
+			return static_cast< U16 >(buffer_info.dwSize.X);
+		}
+
+		/**
+		 Finds the start of the next word.
+
+		 @param[in]		str
+						A pointer to the null-terminated string.
+		 @return		A pointer to the null-terminating character if the end of
+						the given string is reached.
+		 @return		A pointer to the start of the next word.
+		 */
+		[[nodiscard]]
+		inline NotNull< const_zstring >
+			FindWordStart(NotNull< const_zstring > str) noexcept {
+
+			const char* buffer = str;
+			while ('\0' != *buffer && isspace(*buffer)) {
+				++buffer;
+			}
+
+			return NotNull< const_zstring >(buffer);
+		}
+
+		/**
+		 Finds the end of the current word.
+
+		 @param[in]		buffer
+						A pointer to the null-terminated string.
+		 @return		A pointer to the null-terminating character if the end of
+						the given string is reached.
+		 @return		A pointer to the end of the current word (i.e. space).
+		 */
+		[[nodiscard]]
+		inline NotNull< const_zstring >
+			FindWordEnd(NotNull< const_zstring > str) noexcept {
+
+			const char* buffer = str;
+			while ('\0' != *buffer && !isspace(*buffer)) {
+				++buffer;
+			}
+
+			return NotNull< const_zstring >(buffer);
+		}
+
+		/**
+		 Word-wraps the given message.
+
+		 @param[in]		prefix
+						A reference to the prefix of the message.
+		 @param[in]		message
+						A pointer to the null-terminated message.
+		 @param[in]		width
+						The maximum line width.
+		 @return		The word-wrapped message.
+		 */
+		[[nodiscard]]
+		const std::string WordWrap(const std::string& prefix,
+								   NotNull< const_zstring > message,
+								   size_t width) {
+
+			std::string str = prefix;
+			auto pos        = str.size();
+
+			const auto* msg_pos = message.get();
+			while (true) {
+				msg_pos = FindWordStart(NotNull< const_zstring >(msg_pos));
+
+				if ('\0' == *msg_pos) {
+					break;
+				}
+
+				// false == isspace(*msg_pos)
+
+				const char* word_end = FindWordEnd(NotNull< const_zstring >(msg_pos));
+				if (const auto word_length
+					= static_cast< size_t >(word_end - msg_pos);
+					width < pos + word_length) {
+
+					str += "\n    ";
+					pos  = 4;
+				}
+
+				str.append(msg_pos, word_end);
+				pos    += static_cast< size_t >(word_end - msg_pos);
+				msg_pos = word_end;
+
+				str += ' ';
+				++pos;
+			}
+
+			str += '\n';
+			return str;
+		}
+	}
+
+	//-------------------------------------------------------------------------
+	// Logger::Message
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A struct of messages of the message queue of a logger.
+	 */
+	struct Logger::Message final {
+
+	public:
+
+		/**
+		 The sequence number of this message. A message at position @c p is
+		 free if its sequence number is equal to @c p and published if its
+		 sequence number is equal to @c p+1.
+		 */
+		AtomicU64 m_sequence;
+
+		/**
+		 The severity of this message.
+		 */
+		LogSeverity m_severity;
+
+		/**
+		 The null-terminated text of this message.
+		 */
+		char m_text[MAGE_LOGGER_MESSAGE_SIZE];
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// Logger
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	Logger Logger::s_logger;
+
+	Logger::Logger()
+		: m_messages(MakeUnique< Message[] >(MAGE_LOGGER_QUEUE_SIZE)),
+		m_enqueue_position(0u),
+		m_dequeue_position(0u),
+		m_flushed_position(0u),
+		m_nb_dropped_messages(0u),
+		m_nb_reported_dropped_messages(0u),
+		m_waiting(false),
+		m_mutex(),
+		m_condition(),
+		m_flush_condition(),
+		m_flush(false),
+		m_terminate(false),
+		m_sink_mutex(),
+		m_file_sinks(),
+		m_repeated_messages(),
+		m_rate_limit_start(std::chrono::steady_clock::now()),
+		m_console_width(0u),
+		m_console_width_time(),
+		m_start(m_rate_limit_start),
+		m_thread() {
+
+		for (U64 i = 0u; i < MAGE_LOGGER_QUEUE_SIZE; ++i) {
+			m_messages[i].m_sequence.store(i, std::memory_order_relaxed);
+		}
+
+		m_thread = std::thread(&Logger::Run, this);
+	}
+
+	Logger::~Logger() {
+		{
+			const std::lock_guard< std::mutex > lock(m_mutex);
+			m_terminate = true;
+		}
+		m_condition.notify_one();
+
+		if (m_thread.joinable()) {
+			m_thread.join();
+		}
+	}
+
+	void Logger::Log(LogSeverity severity,
+					 const_zstring format,
+					 va_list args) noexcept {
+
+		// Format the message on the calling thread.
+		vsnprintf_s(g_message_buffer, std::size(g_message_buffer),
+					_TRUNCATE, format, args);
+
+		if (LogSeverity::Error <= severity
+			&& std::this_thread::get_id() != m_thread.get_id()) {
+			// Error messages are never dropped (unless logged by the logging
+			// thread itself, which cannot wait for itself).
+			while (!Enqueue(severity, g_message_buffer)) {
+				m_condition.notify_one();
+				std::this_thread::yield();
+			}
+		}
+		else if (!Enqueue(severity, g_message_buffer)) {
+			m_nb_dropped_messages.fetch_add(1u, std::memory_order_relaxed);
+			return;
+		}
+
+		if (LogSeverity::Error <= severity) {
+			// Errors often precede an exception or a crash terminating the
+			// process before the logging thread gets to write them.
+			Flush();
+		}
+		else if (m_waiting.load(std::memory_order_relaxed)) {
+			m_condition.notify_one();
+		}
+	}
+
+	void Logger::Flush() noexcept {
+		if (std::this_thread::get_id() == m_thread.get_id()) {
+			return;
+		}
+
+		// Only wait for the published messages. Messages claimed but not yet
+		// published by other threads are not logged before this call, and
+		// would block the logging thread (and thus this flush) until their
+		// producers publish them.
+		auto position  = m_flushed_position.load(std::memory_order_acquire);
+		const auto end = m_enqueue_position.load(std::memory_order_acquire);
+		for (; position != end; ++position) {
+			const auto& message
+				= m_messages[position & (MAGE_LOGGER_QUEUE_SIZE - 1u)];
+			if (position == message.m_sequence.load(std::memory_order_acquire)) {
+				break;
+			}
+		}
+
+		std::unique_lock< std::mutex > lock(m_mutex);
+		m_flush = true;
+		m_condition.notify_one();
+		m_flush_condition.wait(lock, [this, position]() noexcept {
+			return m_terminate
+				|| position <= m_flushed_position.load(std::memory_order_acquire);
+		});
+	}
+
+	void Logger::AddFileSink(const std::filesystem::path& path) {
+		FILE* file;
+		{
+			const errno_t result = _wfopen_s(&file, path.c_str(), L"w");
+			ThrowIfFailed((0 == result),
+						  "%ls: could not open file.", path.c_str());
+		}
+
+		const std::lock_guard< std::mutex > lock(m_sink_mutex);
+		m_file_sinks.emplace_back(file);
+	}
+
+	void Logger::RemoveFileSinks() noexcept {
+		Flush();
+
+		const std::lock_guard< std::mutex > lock(m_sink_mutex);
+		m_file_sinks.clear();
+	}
+
+	[[nodiscard]]
+	bool Logger::Enqueue(LogSeverity severity, const char* text) noexcept {
+		auto position = m_enqueue_position.load(std::memory_order_relaxed);
+		Message* message;
+
+		// Claim a free message (Vyukov's bounded queue).
+		while (true) {
+			message = &m_messages[position & (MAGE_LOGGER_QUEUE_SIZE - 1u)];
+			const auto sequence = message->m_sequence.load(std::memory_order_acquire);
+			const auto diff     = static_cast< S64 >(sequence - position);
+
+			if (0 == diff) {
+				if (m_enqueue_position.compare_exchange_weak(
+					position, position + 1u, std::memory_order_relaxed)) {
+					break;
+				}
+			}
+			else if (diff < 0) {
+				// The queue is full.
+				return false;
+			}
+			else {
+				position = m_enqueue_position.load(std::memory_order_relaxed);
+			}
+		}
+
+		message->m_severity = severity;
+		strcpy_s(message->m_text, std::size(message->m_text), text);
+
+		// Publish the message.
+		message->m_sequence.store(position + 1u, std::memory_order_release);
+		return true;
+	}
+
+	[[nodiscard]]
+	bool Logger::HasPendingMessages() const noexcept {
+		const auto& message
+			= m_messages[m_dequeue_position & (MAGE_LOGGER_QUEUE_SIZE - 1u)];
+		return m_dequeue_position + 1u
+			== message.m_sequence.load(std::memory_order_acquire);
+	}
+
+	void Logger::Run() noexcept {
+		static constexpr std::chrono::duration< F64 >
+			s_rate_limit_period(MAGE_LOGGER_RATE_LIMIT_PERIOD);
+
+		while (true) {
+			bool terminate;
+			bool flush;
+			{
+				std::unique_lock< std::mutex > lock(m_mutex);
+				m_waiting.store(true, std::memory_order_relaxed);
+
+				// Producers only signal a waiting logging thread (without
+				// acquiring the mutex), so the wait is bounded by the rate
+				// limit period to catch up with a missed signal.
+				m_condition.wait_for(lock, s_rate_limit_period, [this]() noexcept {
+					return m_terminate || m_flush || HasPendingMessages();
+				});
+
+				m_waiting.store(false, std::memory_order_relaxed);
+				terminate = m_terminate;
+				flush     = m_flush;
+				m_flush   = false;
+			}
+
+			try {
+				ProcessMessages();
+
+				const auto now = std::chrono::steady_clock::now();
+				if (terminate || flush
+					|| s_rate_limit_period <= now - m_rate_limit_start) {
+
+					ReportRepeatedMessages();
+					m_rate_limit_start = now;
+				}
+
+				const std::lock_guard< std::mutex > lock(m_sink_mutex);
+				fflush(stderr);
+				for (const auto& file : m_file_sinks) {
+					fflush(file.get());
+				}
+			}
+			catch (...) {
+				// Messages that cannot be written are lost.
+			}
+
+			{
+				const std::lock_guard< std::mutex > lock(m_mutex);
+				m_flushed_position.store(m_dequeue_position,
+										 std::memory_order_release);
+			}
+			m_flush_condition.notify_all();
+
+			if (terminate && !HasPendingMessages()) {
+				break;
+			}
+		}
+	}
+
+	void Logger::ProcessMessages() {
+		while (HasPendingMessages()) {
+			auto& message
+				= m_messages[m_dequeue_position & (MAGE_LOGGER_QUEUE_SIZE - 1u)];
+			const auto severity = message.m_severity;
+			std::string text(message.m_text);
+
+			// Release the message.
+			message.m_sequence.store(m_dequeue_position + MAGE_LOGGER_QUEUE_SIZE,
+									 std::memory_order_release);
+			++m_dequeue_position;
+
+			// Collapse repeated identical non-error messages.
+			if (severity < LogSeverity::Error) {
+				std::string key(1u, static_cast< char >(severity));
+				key += text;
+
+				if (const auto it = m_repeated_messages.find(key);
+					m_repeated_messages.end() != it) {
+
+					++it->second;
+					continue;
+				}
+
+				if (m_repeated_messages.size() < MAGE_LOGGER_RATE_LIMIT_SIZE) {
+					m_repeated_messages.emplace(std::move(key), 0u);
+				}
+			}
+
+			Write(severity, text);
+		}
+
+		const auto nb_dropped_messages
+			= m_nb_dropped_messages.load(std::memory_order_relaxed);
+		if (m_nb_reported_dropped_messages != nb_dropped_messages) {
+			Write(LogSeverity::Warning,
+				  std::to_string(nb_dropped_messages - m_nb_reported_dropped_messages)
+				  + " log messages dropped (queue full).");
+			m_nb_reported_dropped_messages = nb_dropped_messages;
+		}
+	}
+
+	void Logger::ReportRepeatedMessages() {
+		for (const auto& [key, count] : m_repeated_messages) {
+			if (0u == count) {
+				continue;
+			}
+
+			const auto severity = static_cast< LogSeverity >(key[0]);
+			Write(severity, "(repeated " + std::to_string(count) + " times) "
+				            + key.substr(1u));
+		}
+
+		m_repeated_messages.clear();
+	}
+
+	void Logger::Write(LogSeverity severity, const std::string& text) {
+		const auto now = std::chrono::steady_clock::now();
+
+		// Print the word-wrapped message to the console.
+		const auto width = GetConsoleWidth(now);
+		const auto prefix = std::string(GetName(severity)) + ": ";
+		fputs(WordWrap(prefix, NotNull< const_zstring >(text.c_str()), width).c_str(),
+			  stderr);
+
+		// Print the time-stamped message to the file sinks.
+		const std::lock_guard< std::mutex > lock(m_sink_mutex);
+		if (m_file_sinks.empty()) {
+			return;
+		}
+
+		const std::chrono::duration< F64 > time = now - m_start;
+		for (const auto& file : m_file_sinks) {
+			fprintf(file.get(), "[%10.3f] %s%s\n",
+					time.count(), prefix.c_str(), text.c_str());
+		}
+	}
+
+	[[nodiscard]]
+	size_t Logger::GetConsoleWidth(TimePoint now) noexcept {
+		// Querying the console screen buffer is expensive compared to
+		// formatting a message. A resize of the console is not signaled to
+		// an application that does not read console input, so the cached
+		// width is refreshed at most once per period instead.
+		if (0u == m_console_width
+			|| g_console_width_period <= now - m_console_width_time) {
+
+			const auto width = QueryConsoleWidth();
+			m_console_width = (0u == width)
+				? 78u : static_cast< size_t >(std::max(20, width - 2));
+
+			m_console_width_time = now;
+		}
+
+		return m_console_width;
+	}
+
+	#pragma endregion
+}
\ No newline at end of file
@@ -0,0 +1,386 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "parallel\atomic.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdarg>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Defines
+//-----------------------------------------------------------------------------
+#pragma region
+
+/**
+ The number of messages of the message queue of the logger (must be a power
+ of two).
+ */
+#define MAGE_LOGGER_QUEUE_SIZE 1024u
+
+/**
+ The maximum number of characters (including the null-terminating character)
+ of a message of the logger. Longer messages are truncated.
+ */
+#define MAGE_LOGGER_MESSAGE_SIZE 1024u
+
+/**
+ The period (in seconds) during which repeated identical messages of the
+ logger are collapsed.
+ */
+#define MAGE_LOGGER_RATE_LIMIT_PERIOD 1.0
+
+/**
+ The maximum number of distinct messages tracked by the rate limiter of the
+ logger per period.
+ */
+#define MAGE_LOGGER_RATE_LIMIT_SIZE 256u
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	//-------------------------------------------------------------------------
+	// LogSeverity
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 An enumeration of the different log severities.
+
+	 This contains:
+	 @c Debug,
+	 @c Info,
+	 @c Warning,
+	 @c Error and
+	 @c Fatal.
+	 */
+	enum class LogSeverity : U8 {
+		Debug = 0,
+		Info,
+		Warning,
+		Error,
+		Fatal
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// Logger
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A class of (asynchronous) loggers.
+
+	 Producers format their messages on the calling thread into a per-thread
+	 buffer and push these messages into a bounded, lock-free multiple
+	 producer single consumer queue. A background thread consumes these
+	 messages, collapses repeated identical (non-error) messages, word-wraps
+	 the messages for the console and writes them to the console and the
+	 file sinks.
+
+	 If the queue is full, debug, info and warning messages are dropped
+	 (and counted), while error and fatal messages wait for a free slot.
+	 Error and fatal messages are flushed before returning.
+	 */
+	class Logger final {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the global logger.
+
+		 @return		A reference to the global logger.
+		 */
+		[[nodiscard]]
+		static Logger& Get() noexcept {
+			return s_logger;
+		}
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a logger.
+		 */
+		Logger();
+
+		/**
+		 Constructs a logger from the given logger.
+
+		 @param[in]		logger
+						A reference to the logger to copy.
+		 */
+		Logger(const Logger& logger) = delete;
+
+		/**
+		 Constructs a logger by moving the given logger.
+
+		 @param[in]		logger
+						A reference to the logger to move.
+		 */
+		Logger(Logger&& logger) = delete;
+
+		/**
+		 Destructs this logger. All pending messages are written first.
+		 */
+		~Logger();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given logger to this logger.
+
+		 @param[in]		logger
+						A reference to the logger to copy.
+		 @return		A reference to the copy of the given logger (i.e.
+						this logger).
+		 */
+		Logger& operator=(const Logger& logger) = delete;
+
+		/**
+		 Moves the given logger to this logger.
+
+		 @param[in]		logger
+						A reference to the logger to move.
+		 @return		A reference to the moved logger (i.e. this logger).
+		 */
+		Logger& operator=(Logger&& logger) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Logs a message.
+
+		 @param[in]		severity
+						The severity of the message.
+		 @param[in]		format
+						Pointer to the message format.
+		 @param[in]		args
+						The arguments of the message format.
+		 */
+		void Log(LogSeverity severity,
+				 const_zstring format,
+				 va_list args) noexcept;
+
+		/**
+		 Blocks the calling thread until all messages logged before this call
+		 are written and flushed.
+
+		 Messages which other threads are still enqueueing during this call
+		 are not waited for.
+		 */
+		void Flush() noexcept;
+
+		/**
+		 Adds a file sink to this logger.
+
+		 @param[in]		path
+						The path of the log file.
+		 @throws		Exception
+						Failed to open the log file.
+		 */
+		void AddFileSink(const std::filesystem::path& path);
+
+		/**
+		 Removes all file sinks of this logger. All pending messages are
+		 written first.
+		 */
+		void RemoveFileSinks() noexcept;
+
+		/**
+		 Returns the number of dropped messages of this logger.
+
+		 @return		The number of messages of this logger which are dropped
+						because the message queue was full.
+		 */
+		[[nodiscard]]
+		U64 GetNumberOfDroppedMessages() const noexcept {
+			return m_nb_dropped_messages.load(std::memory_order_relaxed);
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The global logger.
+		 */
+		static Logger s_logger;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		struct Message;
+
+		using TimePoint = std::chrono::steady_clock::time_point;
+
+		[[nodiscard]]
+		bool Enqueue(LogSeverity severity, const char* text) noexcept;
+
+		[[nodiscard]]
+		bool HasPendingMessages() const noexcept;
+
+		void Run() noexcept;
+
+		void ProcessMessages();
+
+		void ReportRepeatedMessages();
+
+		void Write(LogSeverity severity, const std::string& text);
+
+		[[nodiscard]]
+		size_t GetConsoleWidth(TimePoint now) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A pointer to the ring buffer containing the messages of the message
+		 queue of this logger.
+		 */
+		UniquePtr< Message[] > m_messages;
+
+		/**
+		 The enqueue position of the message queue of this logger.
+		 */
+		alignas(64) AtomicU64 m_enqueue_position;
+
+		/**
+		 The dequeue position of the message queue of this logger (only
+		 accessed by the logging thread).
+		 */
+		alignas(64) U64 m_dequeue_position;
+
+		/**
+		 The position of the message queue of this logger up to which all
+		 messages are written and flushed.
+		 */
+		AtomicU64 m_flushed_position;
+
+		/**
+		 The number of dropped messages of this logger.
+		 */
+		AtomicU64 m_nb_dropped_messages;
+
+		/**
+		 The number of dropped messages of this logger which are reported
+		 (only accessed by the logging thread).
+		 */
+		U64 m_nb_reported_dropped_messages;
+
+		/**
+		 Flag indicating whether the logging thread of this logger is
+		 (about to be) waiting for messages.
+		 */
+		AtomicBool m_waiting;
+
+		/**
+		 The mutex for signaling the logging thread of this logger.
+		 */
+		std::mutex m_mutex;
+
+		/**
+		 The condition variable for signaling the logging thread of this
+		 logger.
+		 */
+		std::condition_variable m_condition;
+
+		/**
+		 The condition variable for signaling the threads waiting for a
+		 flush of this logger.
+		 */
+		std::condition_variable m_flush_condition;
+
+		/**
+		 Flag indicating whether a flush of this logger is requested.
+		 */
+		bool m_flush;
+
+		/**
+		 Flag indicating whether the logging thread of this logger must
+		 terminate.
+		 */
+		bool m_terminate;
+
+		/**
+		 The mutex for accessing the file sinks of this logger.
+		 */
+		std::mutex m_sink_mutex;
+
+		/**
+		 The file streams of the file sinks of this logger.
+		 */
+		std::vector< UniqueFileStream > m_file_sinks;
+
+		/**
+		 The messages of the current rate limit period of this logger mapped
+		 to their number of suppressed repetitions (only accessed by the
+		 logging thread).
+		 */
+		std::unordered_map< std::string, U32 > m_repeated_messages;
+
+		/**
+		 The start of the current rate limit period of this logger.
+		 */
+		TimePoint m_rate_limit_start;
+
+		/**
+		 The (cached) console width of this logger.
+		 */
+		size_t m_console_width;
+
+		/**
+		 The time of the last refresh of the console width of this logger.
+		 */
+		TimePoint m_console_width_time;
+
+		/**
+		 The start time of this logger.
+		 */
+		TimePoint m_start;
+
+		/**
+		 The logging thread of this logger.
+		 */
+		std::thread m_thread;
+	};
+
+	#pragma endregion
+}
\ No newline at end of file
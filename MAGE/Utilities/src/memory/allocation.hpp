@@ -85,7 +85,7 @@ namespace mage {
 					The alignment size in bytes.
 	 */
 	template< typename T, size_t A = alignof(T) >
-	class AlignedAllocator final {
+	class AlignedAllocator {
 		
 	public:
 
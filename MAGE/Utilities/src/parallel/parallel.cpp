@@ -8,11 +8,380 @@
 
 #pragma endregion
 
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#pragma endregion
+
 //-----------------------------------------------------------------------------
 // Engine Definitions
 //-----------------------------------------------------------------------------
 namespace mage {
 
+	namespace {
+
+		/**
+		 A class of task queues processed by a fixed number of worker 
+		 threads.
+		 */
+		class TaskQueue final {
+
+		public:
+
+			//-----------------------------------------------------------------
+			// Constructors and Destructors
+			//-----------------------------------------------------------------
+
+			/**
+			 Constructs a task queue.
+
+			 @param[in]		nb_threads
+							The number of worker threads.
+			 */
+			explicit TaskQueue(size_t nb_threads)
+				: m_tasks(),
+				m_threads(),
+				m_mutex(),
+				m_condition(),
+				m_terminate(false) {
+
+				m_threads.reserve(nb_threads);
+				for (size_t i = 0u; i < nb_threads; ++i) {
+					m_threads.emplace_back(&TaskQueue::Work, this);
+				}
+			}
+
+			/**
+			 Constructs a task queue from the given task queue.
+
+			 @param[in]		queue
+							A reference to the task queue to copy.
+			 */
+			TaskQueue(const TaskQueue& queue) = delete;
+
+			/**
+			 Constructs a task queue by moving the given task queue.
+
+			 @param[in]		queue
+							A reference to the task queue to move.
+			 */
+			TaskQueue(TaskQueue&& queue) = delete;
+
+			/**
+			 Destructs this task queue. The remaining tasks are processed 
+			 before the worker threads are joined.
+			 */
+			~TaskQueue() {
+				{
+					const std::lock_guard< std::mutex > lock(m_mutex);
+					m_terminate = true;
+				}
+				m_condition.notify_all();
+
+				for (auto& thread : m_threads) {
+					thread.join();
+				}
+			}
+
+			//-----------------------------------------------------------------
+			// Assignment Operators
+			//-----------------------------------------------------------------
+
+			/**
+			 Copies the given task queue to this task queue.
+
+			 @param[in]		queue
+							A reference to the task queue to copy.
+			 @return		A reference to the copy of the given task queue 
+							(i.e. this task queue).
+			 */
+			TaskQueue& operator=(const TaskQueue& queue) = delete;
+
+			/**
+			 Moves the given task queue to this task queue.
+
+			 @param[in]		queue
+							A reference to the task queue to move.
+			 @return		A reference to the moved task queue (i.e. this 
+							task queue).
+			 */
+			TaskQueue& operator=(TaskQueue&& queue) = delete;
+
+			//-----------------------------------------------------------------
+			// Member Methods
+			//-----------------------------------------------------------------
+
+			/**
+			 Enqueues the given task.
+
+			 @param[in]		task
+							The task.
+			 */
+			void Enqueue(std::function< void() > task) {
+				{
+					const std::lock_guard< std::mutex > lock(m_mutex);
+					m_tasks.push_back(std::move(task));
+				}
+				m_condition.notify_one();
+			}
+
+			/**
+			 Processes the first pending task of this task queue, if any, on 
+			 the calling thread.
+
+			 @return		@c true if a pending task was processed. @c false 
+							otherwise.
+			 */
+			bool TryProcess() {
+				std::function< void() > task;
+				{
+					const std::lock_guard< std::mutex > lock(m_mutex);
+					if (m_tasks.empty()) {
+						return false;
+					}
+
+					task = std::move(m_tasks.front());
+					m_tasks.pop_front();
+				}
+
+				task();
+				return true;
+			}
+
+		private:
+
+			//-----------------------------------------------------------------
+			// Member Methods
+			//-----------------------------------------------------------------
+
+			/**
+			 Processes the tasks of this task queue until this task queue 
+			 terminates.
+			 */
+			void Work() {
+				// Initialize the COM library for the worker thread (e.g., 
+				// used by WIC).
+				const HRESULT result = CoInitializeEx(nullptr, 
+													  COINIT_MULTITHREADED);
+				
+				while (true) {
+					std::function< void() > task;
+					{
+						std::unique_lock< std::mutex > lock(m_mutex);
+						m_condition.wait(lock, [this]() noexcept {
+							return m_terminate || !m_tasks.empty();
+						});
+
+						if (m_tasks.empty()) {
+							break;
+						}
+
+						task = std::move(m_tasks.front());
+						m_tasks.pop_front();
+					}
+
+					task();
+				}
+
+				if (SUCCEEDED(result)) {
+					CoUninitialize();
+				}
+			}
+
+			//-----------------------------------------------------------------
+			// Member Variables
+			//-----------------------------------------------------------------
+
+			/**
+			 The pending tasks of this task queue.
+			 */
+			std::deque< std::function< void() > > m_tasks;
+
+			/**
+			 The worker threads of this task queue.
+			 */
+			std::vector< std::thread > m_threads;
+
+			/**
+			 The mutex for accessing the pending tasks of this task queue.
+			 */
+			std::mutex m_mutex;
+
+			/**
+			 The condition variable for signaling the worker threads of this 
+			 task queue.
+			 */
+			std::condition_variable m_condition;
+
+			/**
+			 A flag indicating whether the worker threads of this task queue 
+			 must terminate.
+			 */
+			bool m_terminate;
+		};
+
+		/**
+		 Returns the task queue shared by all callers.
+
+		 The worker threads (one per system core) are created on first use.
+
+		 @return		A reference to the task queue.
+		 */
+		[[nodiscard]]
+		TaskQueue& GetTaskQueue() {
+			static TaskQueue queue(std::max(
+				static_cast< size_t >(NumberOfSystemCores()), size_t(1u)));
+			
+			return queue;
+		}
+
+		/**
+		 A struct of parallel for states shared by the calling thread and the 
+		 helper tasks of a parallel for.
+		 */
+		struct ParallelForState final {
+
+		public:
+
+			//-----------------------------------------------------------------
+			// Constructors and Destructors
+			//-----------------------------------------------------------------
+
+			/**
+			 Constructs a parallel for state.
+
+			 @param[in]		begin
+							The first index of the range.
+			 @param[in]		end
+							The end index (exclusive) of the range.
+			 @param[in]		action
+							A reference to the action.
+			 */
+			explicit ParallelForState(size_t begin, size_t end, 
+				const std::function< void(size_t) >& action) noexcept
+				: m_next(begin),
+				m_nb_remaining(end - begin),
+				m_end(end),
+				m_cancelled(false),
+				m_action(&action),
+				m_exception(),
+				m_mutex(),
+				m_condition() {}
+
+			//-----------------------------------------------------------------
+			// Member Methods
+			//-----------------------------------------------------------------
+
+			/**
+			 Processes indices of this parallel for state until all indices 
+			 are claimed. Once an action threw, the remaining indices are 
+			 claimed without being processed.
+			 */
+			void Work() noexcept {
+				size_t nb_claimed = 0u;
+				for (auto i = m_next++; i < m_end; i = m_next++) {
+					++nb_claimed;
+
+					if (m_cancelled.load(std::memory_order_relaxed)) {
+						continue;
+					}
+
+					try {
+						(*m_action)(i);
+					}
+					catch (...) {
+						const std::lock_guard< std::mutex > lock(m_mutex);
+						if (!m_exception) {
+							m_exception = std::current_exception();
+						}
+						m_cancelled = true;
+					}
+				}
+
+				if (0u != nb_claimed 
+					&& nb_claimed == m_nb_remaining.fetch_sub(nb_claimed)) {
+					
+					const std::lock_guard< std::mutex > lock(m_mutex);
+					m_condition.notify_all();
+				}
+			}
+
+			/**
+			 Blocks the calling thread until all indices of this parallel 
+			 for state are processed.
+			 */
+			void Wait() {
+				std::unique_lock< std::mutex > lock(m_mutex);
+				m_condition.wait(lock, [this]() noexcept {
+					return 0u == m_nb_remaining.load();
+				});
+			}
+
+			//-----------------------------------------------------------------
+			// Member Variables
+			//-----------------------------------------------------------------
+
+			/**
+			 The next index to claim of this parallel for state.
+			 */
+			std::atomic< size_t > m_next;
+
+			/**
+			 The number of claimed indices that are not processed (or 
+			 skipped) yet of this parallel for state.
+			 */
+			std::atomic< size_t > m_nb_remaining;
+
+			/**
+			 The end index (exclusive) of the range of this parallel for 
+			 state.
+			 */
+			const size_t m_end;
+
+			/**
+			 A flag indicating whether the remaining indices of this parallel 
+			 for state must be skipped.
+			 */
+			std::atomic< bool > m_cancelled;
+
+			/**
+			 A pointer to the action of this parallel for state. The action 
+			 is only valid as long as not all indices are claimed.
+			 */
+			const std::function< void(size_t) >* m_action;
+
+			/**
+			 The first exception thrown by the action of this parallel for 
+			 state.
+			 */
+			std::exception_ptr m_exception;
+
+			/**
+			 The mutex for accessing the exception of this parallel for 
+			 state and for signaling its completion.
+			 */
+			std::mutex m_mutex;
+
+			/**
+			 The condition variable for signaling the completion of this 
+			 parallel for state.
+			 */
+			std::condition_variable m_condition;
+		};
+	}
+
 	[[nodiscard]]
 	U16 NumberOfPhysicalCores() {
 		DWORD length = 0u;
@@ -63,4 +432,42 @@ namespace mage {
 		//                          current group.
 		return static_cast< U16 >(system_info.dwNumberOfProcessors);
 	}
+
+	void ParallelFor(size_t begin, size_t end, 
+					 const std::function< void(size_t) >& action) {
+		
+		if (end <= begin) {
+			return;
+		}
+
+		const auto nb_threads = std::min(
+			std::max(static_cast< size_t >(NumberOfSystemCores()), size_t(1u)), 
+			end - begin);
+
+		// The state is shared with the helper tasks, which may only start 
+		// (and finish) after all indices are processed.
+		const auto state = std::make_shared< ParallelForState >(
+			begin, end, action);
+
+		for (size_t i = 1u; i < nb_threads; ++i) {
+			EnqueueTask([state]() noexcept {
+				state->Work();
+			});
+		}
+		
+		state->Work();
+		state->Wait();
+
+		if (state->m_exception) {
+			std::rethrow_exception(state->m_exception);
+		}
+	}
+
+	void EnqueueTask(std::function< void() > task) {
+		GetTaskQueue().Enqueue(std::move(task));
+	}
+
+	bool ProcessEnqueuedTask() {
+		return GetTaskQueue().TryProcess();
+	}
 }
\ No newline at end of file
@@ -9,6 +9,17 @@
 
 #pragma endregion
 
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <chrono>
+#include <functional>
+#include <future>
+
+#pragma endregion
+
 //-----------------------------------------------------------------------------
 // Engine Declarations
 //-----------------------------------------------------------------------------
@@ -29,4 +40,83 @@ namespace mage {
 	 */
 	[[nodiscard]]
 	U16 NumberOfSystemCores() noexcept;
-}
\ No newline at end of file
+
+	/**
+	 Executes the given action for each index of the given range on the worker 
+	 threads (see EnqueueTask), including the calling thread.
+
+	 Each index is processed exactly once, but the order in which the indices 
+	 are processed is unspecified. Hence, the action must only write to data 
+	 associated with its own index to obtain deterministic results. The 
+	 calling thread processes indices itself while waiting, so this function 
+	 can also be called from within an enqueued task.
+
+	 @param[in]		begin
+					The first index of the range.
+	 @param[in]		end
+					The end index (exclusive) of the range.
+	 @param[in]		action
+					A reference to the action.
+	 @throws		Exception
+					Failed to execute the given action for some index (i.e. 
+					the first exception thrown by the given action is 
+					rethrown after all threads have finished).
+	 */
+	void ParallelFor(size_t begin, size_t end, 
+					 const std::function< void(size_t) >& action);
+
+	/**
+	 Enqueues the given task for execution on one of the worker threads.
+
+	 The worker threads (one per system core) are created on first use, are 
+	 shared by all callers and initialize the COM library for use by the 
+	 tasks (multithreaded apartment). Since the number of worker threads is 
+	 limited, the given task must only block on the completion of other 
+	 enqueued tasks with WaitFor.
+
+	 @param[in]		task
+					The task. The task must not throw.
+	 */
+	void EnqueueTask(std::function< void() > task);
+
+	/**
+	 Processes one pending enqueued task (see EnqueueTask) on the calling 
+	 thread.
+
+	 The calling thread must have initialized the COM library for use by the 
+	 tasks (multithreaded apartment).
+
+	 @return		@c true if a pending task was processed. @c false if no 
+					task was pending.
+	 */
+	bool ProcessEnqueuedTask();
+
+	/**
+	 Blocks the calling thread until the given future is ready.
+
+	 Pending enqueued tasks are processed on the calling thread while 
+	 waiting. Hence, this function can also be called from within an enqueued 
+	 task without starving the worker threads (e.g., if the awaited task is 
+	 still pending), as long as the awaited result does not depend on the 
+	 calling task itself.
+
+	 @tparam		T
+					The value type.
+	 @param[in]		future
+					A reference to the future.
+	 @return		A reference to the value of the given future.
+	 @throws		...
+					The exception stored in the given future.
+	 */
+	template< typename T >
+	const T& WaitFor(const std::shared_future< T >& future);
+}
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "parallel\parallel.tpp"
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,22 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	template< typename T >
+	const T& WaitFor(const std::shared_future< T >& future) {
+		using namespace std::chrono_literals;
+
+		while (std::future_status::ready != future.wait_for(0s)) {
+			// Help the worker threads (the awaited task may still be pending), 
+			// or back off briefly if no task is pending.
+			if (!ProcessEnqueuedTask()) {
+				future.wait_for(1ms);
+			}
+		}
+
+		return future.get();
+	}
+}
\ No newline at end of file
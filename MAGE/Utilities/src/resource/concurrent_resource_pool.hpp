@@ -0,0 +1,403 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "type\types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <shared_mutex>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	#pragma warning( push )
+	#pragma warning( disable : 4324 ) // Added padding.
+
+	/**
+	 A class of concurrent persistent resource pools.
+
+	 The resources are distributed over a fixed number of shards based on the
+	 hash of their keys. Each shard is guarded by its own reader/writer lock,
+	 such that lookups of existing resources only acquire a shared lock of a
+	 single shard. The hashes of the keys are computed once per operation and
+	 stored next to the resources.
+
+	 Resources can be looked up with any key type which is comparable to
+	 @c KeyT and hashes to the same value (e.g., @c std::wstring_view or
+	 string literals for @c std::wstring keys) without constructing a
+	 @c KeyT.
+
+	 @tparam		KeyT
+					The key type.
+	 @tparam		ResourceT
+					The resource type.
+	 @tparam		NbShards
+					The number of shards.
+	 */
+	template< typename KeyT, typename ResourceT, size_t NbShards = 16u >
+	class ConcurrentResourcePool final {
+
+	public:
+
+		static_assert(0u < NbShards);
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 The key type of concurrent resource pools.
+		 */
+		using key_type = KeyT;
+
+		/**
+		 The value type of concurrent resource pools.
+		 */
+		using value_type = ResourceT;
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a concurrent resource pool.
+		 */
+		ConcurrentResourcePool() = default;
+
+		/**
+		 Constructs a concurrent resource pool from the given concurrent
+		 resource pool.
+
+		 @param[in]		pool
+						A reference to the concurrent resource pool to copy.
+		 */
+		ConcurrentResourcePool(const ConcurrentResourcePool& pool) = delete;
+
+		/**
+		 Constructs a concurrent resource pool by moving the given concurrent
+		 resource pool.
+
+		 @param[in]		pool
+						A reference to the concurrent resource pool to move.
+		 */
+		ConcurrentResourcePool(ConcurrentResourcePool&& pool) noexcept;
+
+		/**
+		 Destructs this concurrent resource pool.
+		 */
+		~ConcurrentResourcePool() noexcept {
+			RemoveAll();
+		}
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given concurrent resource pool to this concurrent resource
+		 pool.
+
+		 @param[in]		pool
+						A reference to the concurrent resource pool to copy.
+		 @return		A reference to the copy of the given concurrent
+						resource pool (i.e. this concurrent resource pool).
+		 */
+		ConcurrentResourcePool& operator=(
+			const ConcurrentResourcePool& pool) = delete;
+
+		/**
+		 Moves the given concurrent resource pool to this concurrent resource
+		 pool.
+
+		 @param[in]		pool
+						A reference to the concurrent resource pool to move.
+		 @return		A reference to the moved concurrent resource pool (i.e.
+						this concurrent resource pool).
+		 */
+		ConcurrentResourcePool& operator=(
+			ConcurrentResourcePool&& pool) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Checks whether this concurrent resource pool is empty.
+
+		 @return		@c true if this concurrent resource pool is empty.
+						@c false otherwise.
+		 */
+		[[nodiscard]]
+		bool empty() const noexcept;
+
+		/**
+		 Returns the number of resources contained in this concurrent resource
+		 pool.
+		 */
+		[[nodiscard]]
+		size_t size() const noexcept;
+
+		/**
+		 Checks whether this concurrent resource pool contains a resource
+		 corresponding to the given key.
+
+		 @tparam		LookupKeyT
+						The lookup key type.
+		 @param[in]		key
+						A reference to the key of the resource.
+		 @return		@c true, if a resource is contained in this concurrent
+						resource pool corresponding to the given key.
+						@c false, otherwise.
+		 */
+		template< typename LookupKeyT >
+		[[nodiscard]]
+		bool Contains(const LookupKeyT& key) const noexcept;
+
+		/**
+		 Returns the resource corresponding to the given key from this
+		 concurrent resource pool.
+
+		 @tparam		LookupKeyT
+						The lookup key type.
+		 @param[in]		key
+						A reference to the key of the resource.
+		 @return		@c nullptr, if no resource is contained in this
+						concurrent resource pool corresponding to the given
+						key.
+		 @return		A pointer to the resource corresponding to the given
+						key from this concurrent resource pool.
+		 */
+		template< typename LookupKeyT >
+		[[nodiscard]]
+		SharedPtr< ResourceT > Get(const LookupKeyT& key) const noexcept;
+
+		/**
+		 Returns the resource corresponding to the given key from this
+		 concurrent resource pool.
+
+		 If no resource is contained in this concurrent resource pool
+		 corresponding to the given key, a new resource is created from the
+		 given arguments, added to this concurrent resource pool and returned.
+
+		 @tparam		LookupKeyT
+						The lookup key type.
+		 @tparam		ConstructorArgsT
+						The argument types for creating a new resource of type
+						@c ResourceT.
+		 @param[in]		key
+						A reference to the key of the resource.
+		 @param[in]		args
+						The arguments for creating a new resource of type
+						@c ResourceT.
+		 @return		A pointer to the resource corresponding to the given
+						key from this concurrent resource pool.
+		 */
+		template< typename LookupKeyT, typename... ConstructorArgsT >
+		SharedPtr< ResourceT > GetOrCreate(const LookupKeyT& key,
+			                               ConstructorArgsT&&... args);
+
+		/**
+		 Returns the resource corresponding to the given key from this
+		 concurrent resource pool.
+
+		 If no resource is contained in this concurrent resource pool
+		 corresponding to the given key, a new resource is created from the
+		 given arguments, added to this concurrent resource pool and returned.
+
+		 @pre			@c DerivedResourceT is a derived class of @c ResourceT.
+		 @tparam		DerivedResourceT
+						The derived resource type.
+		 @tparam		LookupKeyT
+						The lookup key type.
+		 @tparam		ConstructorArgsT
+						The argument types for creating a new resource of type
+						@c DerivedResourceT.
+		 @param[in]		key
+						A reference to the key of the resource.
+		 @param[in]		args
+						The arguments for creating a new resource of type
+						@c DerivedResourceT.
+		 @return		A pointer to the resource corresponding to the given
+						key from this concurrent resource pool.
+		 */
+		template< typename DerivedResourceT, typename LookupKeyT,
+			      typename... ConstructorArgsT >
+		SharedPtr< ResourceT > GetOrCreateDerived(const LookupKeyT& key,
+			                                      ConstructorArgsT&&... args);
+
+		/**
+		 Removes the resource corresponding to the given key from this
+		 concurrent resource pool.
+
+		 @tparam		LookupKeyT
+						The lookup key type.
+		 @param[in]		key
+						A reference to the key of the resource to remove.
+		 */
+		template< typename LookupKeyT >
+		void Remove(const LookupKeyT& key);
+
+		/**
+		 Removes all resources from this concurrent resource pool.
+		 */
+		void RemoveAll() noexcept;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 A struct of identity hashers for precomputed hashes.
+		 */
+		struct IdentityHash final {
+
+		public:
+
+			//-----------------------------------------------------------------
+			// Member Methods
+			//-----------------------------------------------------------------
+
+			/**
+			 Returns the given hash.
+
+			 @param[in]		hash
+							The hash.
+			 @return		The given hash.
+			 */
+			[[nodiscard]]
+			size_t operator()(size_t hash) const noexcept {
+				return hash;
+			}
+		};
+
+		/**
+		 A resource map used by a shard of a concurrent resource pool,
+		 mapping precomputed key hashes to keys and resources.
+		 */
+		using ResourceMap = std::unordered_multimap< size_t,
+			std::pair< KeyT, SharedPtr< ResourceT > >, IdentityHash >;
+
+		/**
+		 A struct of shards of concurrent resource pools.
+		 */
+		struct alignas(64) Shard final {
+
+		public:
+
+			//-----------------------------------------------------------------
+			// Member Methods
+			//-----------------------------------------------------------------
+
+			/**
+			 Returns the resource corresponding to the given key and hash
+			 from this shard.
+
+			 @pre			The mutex of this shard is locked.
+			 @tparam		LookupKeyT
+							The lookup key type.
+			 @param[in]		key
+							A reference to the key of the resource.
+			 @param[in]		hash
+							The hash of the given key.
+			 @return		@c nullptr, if no resource is contained in this
+							shard corresponding to the given key.
+			 @return		A pointer to the resource corresponding to the
+							given key from this shard.
+			 */
+			template< typename LookupKeyT >
+			[[nodiscard]]
+			SharedPtr< ResourceT > Find(const LookupKeyT& key,
+										size_t hash) const noexcept;
+
+			//-----------------------------------------------------------------
+			// Member Variables
+			//-----------------------------------------------------------------
+
+			/**
+			 The resource map of this shard.
+			 */
+			ResourceMap m_resource_map;
+
+			/**
+			 The reader/writer mutex for accessing the resource map of this
+			 shard.
+			 */
+			mutable std::shared_mutex m_mutex;
+		};
+
+		//---------------------------------------------------------------------
+		// Class Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Computes the hash of the given key.
+
+		 Keys convertible to @c std::wstring_view or @c std::string_view are
+		 hashed as string views, which matches the hashes of the corresponding
+		 @c std::wstring and @c std::string keys.
+
+		 @tparam		LookupKeyT
+						The lookup key type.
+		 @param[in]		key
+						A reference to the key.
+		 @return		The hash of the given key.
+		 */
+		template< typename LookupKeyT >
+		[[nodiscard]]
+		static size_t Hash(const LookupKeyT& key) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the shard of this concurrent resource pool corresponding to
+		 the given hash.
+
+		 @param[in]		hash
+						The hash.
+		 @return		A reference to the shard of this concurrent resource
+						pool corresponding to the given hash.
+		 */
+		[[nodiscard]]
+		Shard& GetShard(size_t hash) const noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The shards of this concurrent resource pool.
+		 */
+		mutable Shard m_shards[NbShards];
+	};
+
+	#pragma warning( pop )
+}
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "resource\concurrent_resource_pool.tpp"
+
+#pragma endregion
\ No newline at end of file
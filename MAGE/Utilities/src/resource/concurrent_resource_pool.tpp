@@ -0,0 +1,209 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <functional>
+#include <mutex>
+#include <string_view>
+#include <type_traits>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	//-------------------------------------------------------------------------
+	// ConcurrentResourcePool
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	template< typename KeyT, typename ResourceT, size_t NbShards >
+	ConcurrentResourcePool< KeyT, ResourceT, NbShards >
+		::ConcurrentResourcePool(ConcurrentResourcePool&& pool) noexcept {
+
+		for (size_t i = 0u; i < NbShards; ++i) {
+			const std::scoped_lock lock(pool.m_shards[i].m_mutex);
+
+			m_shards[i].m_resource_map
+				= std::move(pool.m_shards[i].m_resource_map);
+		}
+	}
+
+	template< typename KeyT, typename ResourceT, size_t NbShards >
+	[[nodiscard]]
+	inline bool ConcurrentResourcePool< KeyT, ResourceT, NbShards >
+		::empty() const noexcept {
+
+		return 0u == size();
+	}
+
+	template< typename KeyT, typename ResourceT, size_t NbShards >
+	[[nodiscard]]
+	size_t ConcurrentResourcePool< KeyT, ResourceT, NbShards >
+		::size() const noexcept {
+
+		size_t nb_resources = 0u;
+		for (const auto& shard : m_shards) {
+			const std::shared_lock lock(shard.m_mutex);
+			nb_resources += shard.m_resource_map.size();
+		}
+
+		return nb_resources;
+	}
+
+	template< typename KeyT, typename ResourceT, size_t NbShards >
+	template< typename LookupKeyT >
+	[[nodiscard]]
+	inline bool ConcurrentResourcePool< KeyT, ResourceT, NbShards >
+		::Contains(const LookupKeyT& key) const noexcept {
+
+		return nullptr != Get(key);
+	}
+
+	template< typename KeyT, typename ResourceT, size_t NbShards >
+	template< typename LookupKeyT >
+	[[nodiscard]]
+	SharedPtr< ResourceT > ConcurrentResourcePool< KeyT, ResourceT, NbShards >
+		::Get(const LookupKeyT& key) const noexcept {
+
+		const auto hash   = Hash(key);
+		const auto& shard = GetShard(hash);
+
+		const std::shared_lock lock(shard.m_mutex);
+
+		return shard.Find(key, hash);
+	}
+
+	template< typename KeyT, typename ResourceT, size_t NbShards >
+	template< typename LookupKeyT, typename... ConstructorArgsT >
+	inline SharedPtr< ResourceT > ConcurrentResourcePool< KeyT, ResourceT, NbShards >
+		::GetOrCreate(const LookupKeyT& key, ConstructorArgsT&&... args) {
+
+		return GetOrCreateDerived< ResourceT, LookupKeyT, ConstructorArgsT... >(
+			key, std::forward< ConstructorArgsT >(args)...);
+	}
+
+	template< typename KeyT, typename ResourceT, size_t NbShards >
+	template< typename DerivedResourceT, typename LookupKeyT,
+		      typename... ConstructorArgsT >
+	SharedPtr< ResourceT > ConcurrentResourcePool< KeyT, ResourceT, NbShards >
+		::GetOrCreateDerived(const LookupKeyT& key, ConstructorArgsT&&... args) {
+
+		static_assert(std::is_base_of_v< ResourceT, DerivedResourceT >);
+
+		const auto hash = Hash(key);
+		auto& shard     = GetShard(hash);
+
+		// Fast path: the resource exists.
+		{
+			const std::shared_lock lock(shard.m_mutex);
+
+			if (auto resource = shard.Find(key, hash); resource) {
+				return resource;
+			}
+		}
+
+		const std::scoped_lock lock(shard.m_mutex);
+
+		// The resource may have been created in the meantime.
+		if (auto resource = shard.Find(key, hash); resource) {
+			return resource;
+		}
+
+		SharedPtr< ResourceT > new_resource = MakeAllocatedShared< DerivedResourceT >
+			                                  (std::forward< ConstructorArgsT >(args)...);
+
+		shard.m_resource_map.emplace(hash,
+			std::make_pair(KeyT(key), new_resource));
+
+		return new_resource;
+	}
+
+	template< typename KeyT, typename ResourceT, size_t NbShards >
+	template< typename LookupKeyT >
+	void ConcurrentResourcePool< KeyT, ResourceT, NbShards >
+		::Remove(const LookupKeyT& key) {
+
+		const auto hash = Hash(key);
+		auto& shard     = GetShard(hash);
+
+		const std::scoped_lock lock(shard.m_mutex);
+
+		const auto [first, last] = shard.m_resource_map.equal_range(hash);
+		for (auto it = first; it != last; ++it) {
+			if (it->second.first == key) {
+				shard.m_resource_map.erase(it);
+				return;
+			}
+		}
+	}
+
+	template< typename KeyT, typename ResourceT, size_t NbShards >
+	void ConcurrentResourcePool< KeyT, ResourceT, NbShards >
+		::RemoveAll() noexcept {
+
+		for (auto& shard : m_shards) {
+			const std::scoped_lock lock(shard.m_mutex);
+			shard.m_resource_map.clear();
+		}
+	}
+
+	template< typename KeyT, typename ResourceT, size_t NbShards >
+	template< typename LookupKeyT >
+	[[nodiscard]]
+	inline size_t ConcurrentResourcePool< KeyT, ResourceT, NbShards >
+		::Hash(const LookupKeyT& key) noexcept {
+
+		if constexpr (std::is_convertible_v< const LookupKeyT&, std::wstring_view >) {
+			return std::hash< std::wstring_view >()(key);
+		}
+		else if constexpr (std::is_convertible_v< const LookupKeyT&, std::string_view >) {
+			return std::hash< std::string_view >()(key);
+		}
+		else {
+			return std::hash< LookupKeyT >()(key);
+		}
+	}
+
+	template< typename KeyT, typename ResourceT, size_t NbShards >
+	[[nodiscard]]
+	inline typename ConcurrentResourcePool< KeyT, ResourceT, NbShards >::Shard&
+		ConcurrentResourcePool< KeyT, ResourceT, NbShards >
+		::GetShard(size_t hash) const noexcept {
+
+		// Use the high bits for selecting the shard, since the low bits
+		// select the buckets within the shard.
+		const auto mixed = static_cast< U64 >(hash) * 0x9E3779B97F4A7C15ull;
+		return m_shards[static_cast< size_t >(mixed >> 32u) % NbShards];
+	}
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// ConcurrentResourcePool::Shard
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	template< typename KeyT, typename ResourceT, size_t NbShards >
+	template< typename LookupKeyT >
+	[[nodiscard]]
+	SharedPtr< ResourceT > ConcurrentResourcePool< KeyT, ResourceT, NbShards >
+		::Shard::Find(const LookupKeyT& key, size_t hash) const noexcept {
+
+		const auto [first, last] = m_resource_map.equal_range(hash);
+		for (auto it = first; it != last; ++it) {
+			if (it->second.first == key) {
+				return it->second.second;
+			}
+		}
+
+		return SharedPtr< ResourceT >();
+	}
+
+	#pragma endregion
+}
\ No newline at end of file
@@ -6,6 +6,7 @@
 #pragma region
 
 #include "type\types.hpp"
+#include "parallel\parallel.hpp"
 
 #pragma endregion
 
@@ -14,8 +15,15 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
+#include <condition_variable>
+#include <exception>
+#include <future>
+#include <list>
 #include <map>
 #include <mutex>
+#include <tuple>
+#include <type_traits>
+#include <vector>
 
 #pragma endregion
 
@@ -24,6 +32,106 @@
 //-----------------------------------------------------------------------------
 namespace mage {
 
+	//-------------------------------------------------------------------------
+	// Residency
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 Checks whether the given resource type has a @c GetSizeInBytes() member 
+	 method.
+
+	 @tparam		ResourceT
+					The resource type.
+	 */
+	template< typename ResourceT, typename = void >
+	struct has_size_in_bytes : public std::false_type {};
+
+	template< typename ResourceT >
+	struct has_size_in_bytes< ResourceT, std::void_t< decltype(
+		std::declval< const ResourceT& >().GetSizeInBytes()) > > 
+		: public std::true_type {};
+
+	template< typename ResourceT >
+	constexpr bool has_size_in_bytes_v = has_size_in_bytes< ResourceT >::value;
+
+	/**
+	 A struct of residency statistics of resource pools.
+	 */
+	struct ResidencyStatistics final {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Adds the given residency statistics to these residency statistics.
+
+		 @param[in]		statistics
+						A reference to the residency statistics.
+		 @return		A reference to these residency statistics.
+		 */
+		ResidencyStatistics& operator+=(
+			const ResidencyStatistics& statistics) noexcept {
+
+			m_nb_resident_resources += statistics.m_nb_resident_resources;
+			m_resident_size         += statistics.m_resident_size;
+			m_nb_cached_resources   += statistics.m_nb_cached_resources;
+			m_cached_size           += statistics.m_cached_size;
+			m_nb_evicted_resources  += statistics.m_nb_evicted_resources;
+			m_evicted_size          += statistics.m_evicted_size;
+			m_budget                += statistics.m_budget;
+			return *this;
+		}
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The number of resident resources (i.e. referenced and cached 
+		 resources).
+		 */
+		size_t m_nb_resident_resources = 0u;
+
+		/**
+		 The size (in bytes) of the resident resources (i.e. referenced and 
+		 cached resources).
+		 */
+		size_t m_resident_size = 0u;
+
+		/**
+		 The number of cached resources (i.e. resident resources which are 
+		 only referenced by their resource pool).
+		 */
+		size_t m_nb_cached_resources = 0u;
+
+		/**
+		 The size (in bytes) of the cached resources (i.e. resident resources 
+		 which are only referenced by their resource pool).
+		 */
+		size_t m_cached_size = 0u;
+
+		/**
+		 The total number of evicted resources.
+		 */
+		size_t m_nb_evicted_resources = 0u;
+
+		/**
+		 The total size (in bytes) of the evicted resources.
+		 */
+		size_t m_evicted_size = 0u;
+
+		/**
+		 The budget (in bytes) of the resident resources.
+		 */
+		size_t m_budget = 0u;
+	};
+
+	#pragma endregion
+
 	//-------------------------------------------------------------------------
 	// ResourcePool
 	//-------------------------------------------------------------------------
@@ -32,6 +140,20 @@ namespace mage {
 	/**
 	 A class of resource pools.
 
+	 Resources which are no longer referenced outside a resource pool remain 
+	 cached in the resource pool until the size of all resident resources 
+	 exceeds the budget of the resource pool. Cached resources are then 
+	 evicted in least-recently-used order when new resources are added to the 
+	 resource pool or when the resource pool is trimmed explicitly. 
+	 Referenced resources are never evicted.
+
+	 Only cached resources are kept in the least-recently-used list of a 
+	 resource pool. The resources are handed out through references which 
+	 return their resource to that list once the last of them is released, 
+	 so eviction only visits the resources it evicts. The size of a resource 
+	 is obtained from its @c GetSizeInBytes() member method, if present, and 
+	 from @c sizeof otherwise.
+
 	 @tparam		KeyT
 					The key type.
 	 @tparam		ResourceT
@@ -56,14 +178,24 @@ namespace mage {
 		 */
 		using value_type = ResourceT;
 
+		/**
+		 The future type of resource pools.
+		 */
+		using future_type = std::shared_future< SharedPtr< ResourceT > >;
+
 		//---------------------------------------------------------------------
 		// Constructors and Destructors
 		//---------------------------------------------------------------------
 
 		/**
 		 Constructs a resource pool.
+
+		 @param[in]		budget
+						The budget (in bytes) of the resident resources of 
+						this resource pool.
 		 */
-		ResourcePool() = default;
+		explicit ResourcePool(size_t budget = 0u) noexcept
+			: m_budget(budget) {}
 
 		/**
 		 Constructs a resource pool from the given resource pool.
@@ -74,7 +206,8 @@ namespace mage {
 		ResourcePool(const ResourcePool& pool) = delete;
 
 		/**
-		 Constructs a resource pool by moving the given resource pool.
+		 Constructs a resource pool by moving the given resource pool. The 
+		 pending resources of the given resource pool are completed first.
 
 		 @param[in]		pool
 						A reference to the resource pool to move.
@@ -82,11 +215,10 @@ namespace mage {
 		ResourcePool(ResourcePool&& pool) noexcept;
 
 		/**
-		 Destructs this resource pool.
+		 Destructs this resource pool. The pending resources of this resource 
+		 pool are completed first.
 		 */
-		~ResourcePool() noexcept {
-			RemoveAll();
-		}
+		~ResourcePool() noexcept;
 
 		//---------------------------------------------------------------------
 		// Assignment Operators
@@ -166,6 +298,13 @@ namespace mage {
 		 given key, a new resource is created from the given arguments, added 
 		 to this resource pool and returned.
 
+		 If the resource is still being created asynchronously, the calling 
+		 thread waits for it while processing pending enqueued tasks (see 
+		 WaitFor). This member method must not be called from the worker 
+		 threads (see EnqueueTask), e.g. from the constructors of resources 
+		 created asynchronously, unless the requested resource can never 
+		 depend on the calling task: a cyclic wait never finishes.
+
 		 @tparam		ConstructorArgsT
 						The argument types for creating a new resource of type 
 						@c ResourceT.
@@ -189,6 +328,13 @@ namespace mage {
 		 given key, a new resource is created from the given arguments, added 
 		 to this resource pool and returned.
 
+		 If the resource is still being created asynchronously, the calling 
+		 thread waits for it while processing pending enqueued tasks (see 
+		 WaitFor). This member method must not be called from the worker 
+		 threads (see EnqueueTask), e.g. from the constructors of resources 
+		 created asynchronously, unless the requested resource can never 
+		 depend on the calling task: a cyclic wait never finishes.
+
 		 @pre			@c DerivedResourceT is a derived class of @c ResourceT.
 		 @tparam		DerivedResourceT
 						The derived resource type.
@@ -206,10 +352,82 @@ namespace mage {
 		template< typename DerivedResourceT, typename... ConstructorArgsT >
 		SharedPtr< ResourceT > GetOrCreateDerived(const KeyT& key, 
 			                                      ConstructorArgsT&&... args);
+
+		/**
+		 Returns the resource corresponding to the given key from this resource 
+		 pool asynchronously.
+
+		 If no resource is contained in this resource pool corresponding to the 
+		 given key, a new resource is created from the given arguments on a 
+		 worker thread without holding the lock of this resource pool, added 
+		 to this resource pool and returned. Concurrent requests for the same 
+		 key share the same pending resource.
+
+		 This member method must not be called from the worker threads (see 
+		 EnqueueTask), unless the requested resource can never depend on the 
+		 calling task. Waiting on the returned future from a worker thread 
+		 must use WaitFor instead of @c get to avoid starving the worker 
+		 threads.
+
+		 @tparam		ConstructorArgsT
+						The argument types for creating a new resource of type 
+						@c ResourceT.
+		 @param[in]		key
+						A reference to the key of the resource.
+		 @param[in]		args
+						The arguments for creating a new resource of type 
+						@c ResourceT. The arguments are copied; use 
+						@c std::ref to pass arguments by reference.
+		 @return		A shared future of a pointer to the resource 
+						corresponding to the given key from this resource 
+						pool. The shared future rethrows the exception thrown 
+						while creating the resource, if any.
+		 */
+		template< typename... ConstructorArgsT >
+		future_type GetOrCreateAsync(const KeyT& key, 
+									 ConstructorArgsT&&... args);
+
+		/**
+		 Returns the resource corresponding to the given key from this resource 
+		 pool asynchronously.
+
+		 If no resource is contained in this resource pool corresponding to the 
+		 given key, a new resource is created from the given arguments on a 
+		 worker thread without holding the lock of this resource pool, added 
+		 to this resource pool and returned. Concurrent requests for the same 
+		 key share the same pending resource.
+
+		 This member method must not be called from the worker threads (see 
+		 EnqueueTask), unless the requested resource can never depend on the 
+		 calling task. Waiting on the returned future from a worker thread 
+		 must use WaitFor instead of @c get to avoid starving the worker 
+		 threads.
+
+		 @pre			@c DerivedResourceT is a derived class of @c ResourceT.
+		 @tparam		DerivedResourceT
+						The derived resource type.
+		 @tparam		ConstructorArgsT
+						The argument types for creating a new resource of type 
+						@c DerivedResourceT.
+		 @param[in]		key
+						A reference to the key of the resource.
+		 @param[in]		args
+						The arguments for creating a new resource of type 
+						@c DerivedResourceT. The arguments are copied; use 
+						@c std::ref to pass arguments by reference.
+		 @return		A shared future of a pointer to the resource 
+						corresponding to the given key from this resource 
+						pool. The shared future rethrows the exception thrown 
+						while creating the resource, if any.
+		 */
+		template< typename DerivedResourceT, typename... ConstructorArgsT >
+		future_type GetOrCreateDerivedAsync(const KeyT& key, 
+											ConstructorArgsT&&... args);
 		
 		/**
 		 Removes the resource corresponding to the given key from this resource 
-		 pool.
+		 pool. The resource remains alive as long as it is referenced outside 
+		 this resource pool.
 
 		 @param[in]		key
 						A reference to the key of the resource to remove.
@@ -220,114 +438,177 @@ namespace mage {
 		 Removes all resources from this resource pool.
 		 */
 		void RemoveAll() noexcept;
-		
-	private:
 
-		//---------------------------------------------------------------------
-		// Class Member Types
-		//---------------------------------------------------------------------
+		/**
+		 Evicts cached resources from this resource pool in least-recently-used 
+		 order until the size of the resident resources of this resource pool 
+		 does not exceed the budget of this resource pool (or no cached 
+		 resources remain).
+		 */
+		void Trim();
 
 		/**
-		 A resource map used by a resource pool.
+		 Returns the budget (in bytes) of the resident resources of this 
+		 resource pool.
+
+		 @return		The budget (in bytes) of the resident resources of 
+						this resource pool.
+		 */
+		[[nodiscard]]
+		size_t GetBudget() const noexcept;
+
+		/**
+		 Sets the budget (in bytes) of the resident resources of this resource 
+		 pool. This resource pool is trimmed afterwards.
+
+		 @param[in]		budget
+						The budget (in bytes) of the resident resources.
 		 */
-		using ResourceMap = std::map< KeyT, WeakPtr< ResourceT > >;
+		void SetBudget(size_t budget);
+
+		/**
+		 Returns the residency statistics of this resource pool.
+
+		 @return		The residency statistics of this resource pool.
+		 */
+		[[nodiscard]]
+		const ResidencyStatistics GetStatistics() const noexcept;
+		
+	private:
 
 		//---------------------------------------------------------------------
-		// Member Variables
+		// Class Member Types
 		//---------------------------------------------------------------------
 
 		/**
-		 The resource map of this resource pool.
+		 A least-recently-used list of keys used by a resource pool.
 		 */
-		ResourceMap m_resource_map;
+		using LRUList = std::list< KeyT >;
 
 		/**
-		 The mutex for accessing the resource map of this resource pool.
+		 A struct of links from the references handed out by a resource pool 
+		 to the resource pool, which outlive the resource pool.
 		 */
-		mutable std::mutex m_mutex;
+		struct PoolLink final {
 
-		/**
-		 A class of resources.
+		public:
 
-		 @pre			@c DerivedResourceT is a derived class of @c ResourceT.
-		 @tparam		DerivedResourceT
-						The derived resource type.
+			//-----------------------------------------------------------------
+			// Member Variables
+			//-----------------------------------------------------------------
+
+			/**
+			 A pointer to the resource pool of this pool link (or @c nullptr 
+			 if the resource pool is destroyed).
+			 */
+			ResourcePool* m_pool;
+
+			/**
+			 The mutex for accessing the resource pool of this pool link.
+			 */
+			std::mutex m_mutex;
+		};
+
+		/**
+		 A class of references to resources handed out by a resource pool. 
+		 The pointers handed out by a resource pool share the ownership of a 
+		 resource reference, which returns its resource to the 
+		 least-recently-used list of the resource pool when destructed.
 		 */
-		template< typename DerivedResourceT >
-		class Resource final : public DerivedResourceT {
+		class ResourceReference final {
 
 		public:
 
-			static_assert(std::is_base_of_v< ResourceT, DerivedResourceT >);
-
 			//-----------------------------------------------------------------
 			// Constructors and Destructors
 			//-----------------------------------------------------------------
 
 			/**
-			 Constructs a resource.
-
-			 @tparam		ConstructorArgsT
-							The argument types for creating a new resource of 
-							type @c DerivedResourceT.
-			 @param[in]		resource_pool
-							A reference to the resource pool.
-			 @param[in]		resource_key
-							A reference to the key of the resource in the 
-							given resource pool.
-			 @param[in]		args
-							The arguments for creating a new resource of type 
-							@c DerivedResourceT.
+			 Constructs a resource reference.
+
+			 @param[in]		link
+							A pointer to the pool link of the resource pool.
+			 @param[in]		key
+							A reference to the key of the resource.
+			 @param[in]		resource
+							A pointer to the resource.
 			 */
-			template< typename... ConstructorArgsT >
-			Resource(ResourcePool& resource_pool,
-				     const KeyT& resource_key, 
-				     ConstructorArgsT&&... args);
-			
+			explicit ResourceReference(SharedPtr< PoolLink > link, 
+				                       const KeyT& key, 
+				                       SharedPtr< ResourceT > resource)
+				: m_link(std::move(link)), 
+				m_key(key), 
+				m_resource(std::move(resource)) {}
+
 			/**
-			 Constructs a resource from the given resource.
+			 Constructs a resource reference from the given resource 
+			 reference.
 
-			 @param[in]		resource
-							A reference to the resource to copy.
+			 @param[in]		reference
+							A reference to the resource reference to copy.
 			 */
-			Resource(const Resource& resource) = delete;
+			ResourceReference(const ResourceReference& reference) = delete;
 
 			/**
-			 Constructs a resource by moving the given resource poolentry .
+			 Constructs a resource reference by moving the given resource 
+			 reference.
 
-			 @param[in]		resource
-							A reference to the resource to move.
+			 @param[in]		reference
+							A reference to the resource reference to move.
 			 */
-			Resource(Resource&& resource);
+			ResourceReference(ResourceReference&& reference) = delete;
 
 			/**
-			 Destructs this resource.
+			 Destructs this resource reference.
 			 */
-			virtual ~Resource();
+			~ResourceReference() noexcept {
+				const std::scoped_lock lock(m_link->m_mutex);
+
+				if (m_link->m_pool) {
+					m_link->m_pool->Release(m_key, *m_resource);
+				}
+			}
 
 			//-----------------------------------------------------------------
 			// Assignment Operators
 			//-----------------------------------------------------------------
 
 			/**
-			 Copies the given resource to this resource.
+			 Copies the given resource reference to this resource reference.
 
-			 @param[in]		resource
-							A reference to the resource to copy.
-			 @return		A reference to the copy of the given resource (i.e. 
-							this resource).
+			 @param[in]		reference
+							A reference to the resource reference to copy.
+			 @return		A reference to the copy of the given resource 
+							reference (i.e. this resource reference).
 			 */
-			Resource& operator=(const Resource& resource) = delete;
-			
+			ResourceReference& operator=(
+				const ResourceReference& reference) = delete;
+
 			/**
-			 Moves the given resource to this resource.
+			 Moves the given resource reference to this resource reference.
 
-			 @param[in]		resource
-							A reference to the resource to move.
-			 @return		A reference to the moved resource (i.e. this 
-							resource).
+			 @param[in]		reference
+							A reference to the resource reference to move.
+			 @return		A reference to the moved resource reference (i.e. 
+							this resource reference).
+			 */
+			ResourceReference& operator=(
+				ResourceReference&& reference) = delete;
+
+			//-----------------------------------------------------------------
+			// Member Methods
+			//-----------------------------------------------------------------
+
+			/**
+			 Returns the resource of this resource reference.
+
+			 @return		A pointer to the resource of this resource 
+							reference.
 			 */
-			Resource& operator=(Resource&& resource) = delete;
+			[[nodiscard]]
+			ResourceT* GetResource() const noexcept {
+				return m_resource.get();
+			}
 
 		private:
 
@@ -336,16 +617,229 @@ namespace mage {
 			//-----------------------------------------------------------------
 
 			/**
-			 A reference to the resource pool map containing this resource.
+			 A pointer to the pool link of the resource pool of this resource 
+			 reference.
 			 */
-			ResourcePool& m_resource_pool;
+			SharedPtr< PoolLink > m_link;
 
 			/**
-			 The key of this resource in the resource pool map containing
-			 this resource.
+			 The key of the resource of this resource reference.
 			 */
-			KeyT m_resource_key;
+			KeyT m_key;
+
+			/**
+			 A pointer to the resource of this resource reference. The 
+			 resource remains alive as long as it is referenced, even if it 
+			 is removed from the resource pool.
+			 */
+			SharedPtr< ResourceT > m_resource;
 		};
+
+		/**
+		 A struct of resource entries used by a resource pool.
+		 */
+		struct ResourceEntry final {
+
+		public:
+
+			//-----------------------------------------------------------------
+			// Member Variables
+			//-----------------------------------------------------------------
+
+			/**
+			 A pointer to the resource of this resource entry.
+			 */
+			SharedPtr< ResourceT > m_resource;
+
+			/**
+			 A pointer to the references to the resource of this resource 
+			 entry handed out by the resource pool.
+			 */
+			WeakPtr< ResourceT > m_reference;
+
+			/**
+			 The size (in bytes) of the resource of this resource entry.
+			 */
+			size_t m_size;
+
+			/**
+			 The position of the key of this resource entry in the 
+			 least-recently-used list of the resource pool, if cached.
+			 */
+			typename LRUList::iterator m_lru_position;
+
+			/**
+			 A flag indicating whether the resource of this resource entry is 
+			 cached (i.e. not referenced outside the resource pool).
+			 */
+			bool m_cached;
+		};
+
+		/**
+		 A resource map used by a resource pool.
+		 */
+		using ResourceMap = std::map< KeyT, ResourceEntry >;
+
+		/**
+		 A pending resource map used by a resource pool.
+		 */
+		using PendingResourceMap = std::map< KeyT, future_type >;
+
+		//---------------------------------------------------------------------
+		// Class Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the size (in bytes) of the given resource.
+
+		 @param[in]		resource
+						A reference to the resource.
+		 @return		The size (in bytes) of the given resource.
+		 */
+		[[nodiscard]]
+		static size_t GetSizeInBytes(const ResourceT& resource) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Blocks until all pending resources of this resource pool are 
+		 completed.
+		 */
+		void WaitForPendingResources() noexcept;
+
+		/**
+		 Returns a reference to the resource corresponding to the given 
+		 resource entry of this resource pool. The resource is removed from 
+		 the least-recently-used list of this resource pool, if cached.
+
+		 @pre			The mutex of this resource pool is locked.
+		 @param[in]		key
+						A reference to the key of the resource.
+		 @param[in]		entry
+						A reference to the resource entry.
+		 @return		A pointer to the resource corresponding to the given 
+						resource entry of this resource pool.
+		 */
+		[[nodiscard]]
+		SharedPtr< ResourceT > Reference(const KeyT& key, 
+			                             ResourceEntry& entry);
+
+		/**
+		 Marks the resource corresponding to the given key of this resource 
+		 pool as cached and most recently used, if the given resource is 
+		 still contained in this resource pool and no longer referenced 
+		 outside this resource pool.
+
+		 @param[in]		key
+						A reference to the key of the resource.
+		 @param[in]		resource
+						A reference to the resource.
+		 */
+		void Release(const KeyT& key, const ResourceT& resource) noexcept;
+
+		/**
+		 Adds the given resource to this resource pool.
+
+		 @pre			The mutex of this resource pool is locked.
+		 @param[in]		key
+						A reference to the key of the resource.
+		 @param[in]		resource
+						A pointer to the resource.
+		 @return		A pointer to the resource referenced outside this 
+						resource pool.
+		 */
+		[[nodiscard]]
+		SharedPtr< ResourceT > Insert(const KeyT& key, 
+			                          SharedPtr< ResourceT > resource);
+
+		/**
+		 Evicts cached resources from this resource pool in least-recently-used 
+		 order until the size of the resident resources of this resource pool 
+		 does not exceed the budget of this resource pool (or no cached 
+		 resources remain).
+
+		 The evicted resources are returned instead of destroyed, in order to 
+		 destroy them without holding the mutex of this resource pool.
+
+		 @pre			The mutex of this resource pool is locked.
+		 @param[out]	evicted_resources
+						A reference to a vector for storing the evicted 
+						resources.
+		 */
+		void Evict(std::vector< SharedPtr< ResourceT > >& evicted_resources);
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The resource map of this resource pool.
+		 */
+		ResourceMap m_resource_map;
+
+		/**
+		 The least-recently-used list of keys of the cached resources of this 
+		 resource pool (i.e. the most recently used key is at the front).
+		 */
+		LRUList m_lru_list;
+
+		/**
+		 A pointer to the pool link of this resource pool, which is created 
+		 when the first resource is handed out.
+		 */
+		SharedPtr< PoolLink > m_link;
+
+		/**
+		 The pending resource map of this resource pool containing the 
+		 resources which are being created asynchronously.
+		 */
+		PendingResourceMap m_pending_resource_map;
+
+		/**
+		 The number of asynchronous creation tasks of this resource pool which 
+		 did not complete yet.
+		 */
+		size_t m_nb_pending_tasks = 0u;
+
+		/**
+		 The budget (in bytes) of the resident resources of this resource 
+		 pool.
+		 */
+		size_t m_budget;
+
+		/**
+		 The size (in bytes) of the resident resources of this resource pool.
+		 */
+		size_t m_resident_size = 0u;
+
+		/**
+		 The size (in bytes) of the cached resources of this resource pool.
+		 */
+		size_t m_cached_size = 0u;
+
+		/**
+		 The total number of evicted resources of this resource pool.
+		 */
+		size_t m_nb_evicted_resources = 0u;
+
+		/**
+		 The total size (in bytes) of the evicted resources of this resource 
+		 pool.
+		 */
+		size_t m_evicted_size = 0u;
+
+		/**
+		 The mutex for accessing the resource map of this resource pool.
+		 */
+		mutable std::mutex m_mutex;
+
+		/**
+		 The condition variable for signaling the completion of asynchronous 
+		 creation tasks of this resource pool.
+		 */
+		std::condition_variable m_condition;
 	};
 
 	#pragma endregion
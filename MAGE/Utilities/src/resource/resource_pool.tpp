@@ -14,9 +14,49 @@ namespace mage {
 	ResourcePool< KeyT, ResourceT >::ResourcePool(ResourcePool&& pool) noexcept 
 		: m_mutex() {
 
+		pool.WaitForPendingResources();
+
+		SharedPtr< PoolLink > link;
+		{
+			const std::scoped_lock lock(pool.m_mutex);
+			link = pool.m_link;
+		}
+
+		// The references handed out by the given resource pool are released 
+		// to this resource pool from here on. The mutex of the pool link is 
+		// locked before the mutex of the resource pool (see Release).
+		std::unique_lock< std::mutex > link_lock;
+		if (link) {
+			link_lock = std::unique_lock(link->m_mutex);
+			link->m_pool = this;
+		}
+
 		const std::scoped_lock lock(pool.m_mutex);
 
-		m_resource_map = std::move(pool.m_resource_map);
+		m_resource_map         = std::move(pool.m_resource_map);
+		m_lru_list             = std::move(pool.m_lru_list);
+		m_link                 = std::move(pool.m_link);
+		m_budget               = pool.m_budget;
+		m_resident_size        = pool.m_resident_size;
+		m_cached_size          = pool.m_cached_size;
+		m_nb_evicted_resources = pool.m_nb_evicted_resources;
+		m_evicted_size         = pool.m_evicted_size;
+		pool.m_resident_size   = 0u;
+		pool.m_cached_size     = 0u;
+	}
+
+	template< typename KeyT, typename ResourceT >
+	ResourcePool< KeyT, ResourceT >::~ResourcePool() noexcept {
+		WaitForPendingResources();
+
+		// The references handed out by this resource pool may outlive this 
+		// resource pool.
+		if (m_link) {
+			const std::scoped_lock lock(m_link->m_mutex);
+			m_link->m_pool = nullptr;
+		}
+
+		RemoveAll();
 	}
 
 	template< typename KeyT, typename ResourceT >
@@ -42,19 +82,8 @@ namespace mage {
 	bool ResourcePool< KeyT, ResourceT >::Contains(const KeyT& key) noexcept {
 		const std::scoped_lock lock(m_mutex);
 
-		if (const auto it = m_resource_map.find(key); 
-			it != m_resource_map.end()) {
-
-			const auto resource = it->second.lock();
-			
-			if (resource) {
-				return true;
-			}
-			
-			m_resource_map.erase(it);
-		}
-
-		return false;
+		const auto it = m_resource_map.find(key);
+		return (it != m_resource_map.end());
 	}
 
 	template< typename KeyT, typename ResourceT >
@@ -67,13 +96,7 @@ namespace mage {
 		if (const auto it = m_resource_map.find(key); 
 			it != m_resource_map.end()) {
 
-			const auto resource = it->second.lock();
-			
-			if (resource) {
-				return resource;
-			}
-
-			m_resource_map.erase(it);
+			return Reference(it->first, it->second);
 		}
 
 		return SharedPtr< ResourceT >();
@@ -93,76 +116,369 @@ namespace mage {
 	SharedPtr< ResourceT > ResourcePool< KeyT, ResourceT >
 		::GetOrCreateDerived(const KeyT& key, ConstructorArgsT&&... args) {
 		
-		const std::scoped_lock lock(m_mutex);
+		static_assert(std::is_base_of_v< ResourceT, DerivedResourceT >);
 
-		if (const auto it = m_resource_map.find(key); 
-			it != m_resource_map.end()) {
+		using promise_type = std::promise< SharedPtr< ResourceT > >;
+
+		promise_type promise;
+
+		{
+			std::unique_lock lock(m_mutex);
+
+			if (const auto it = m_resource_map.find(key); 
+				it != m_resource_map.end()) {
+
+				return Reference(it->first, it->second);
+			}
+
+			// Wait for the pending resource, if any, without holding the lock 
+			// (and without starving the worker threads).
+			if (const auto it = m_pending_resource_map.find(key); 
+				it != m_pending_resource_map.end()) {
+
+				const auto future = it->second;
+				lock.unlock();
+				return WaitFor(future);
+			}
+
+			// Concurrent requests for the same key wait for this resource 
+			// instead of creating it again.
+			m_pending_resource_map.emplace(key, promise.get_future().share());
+			++m_nb_pending_tasks;
+		}
+
+		// Create the resource without holding the lock, so that neither the 
+		// other requests nor the enqueued tasks processed while waiting for 
+		// the resources this resource depends on are blocked.
+		SharedPtr< ResourceT > resource;
+		std::exception_ptr exception;
+		try {
+			resource = MakeAllocatedShared< DerivedResourceT >(
+				std::forward< ConstructorArgsT >(args)...);
+		}
+		catch (...) {
+			exception = std::current_exception();
+		}
+
+		{
+			// Destroyed after releasing the lock.
+			std::vector< SharedPtr< ResourceT > > evicted_resources;
+			typename PendingResourceMap::node_type pending_resource;
+
+			const std::scoped_lock lock(m_mutex);
 
-			const auto resource = it->second.lock();
 			if (resource) {
-				return resource;
+				resource = Insert(key, std::move(resource));
+				Evict(evicted_resources);
 			}
-			
-			m_resource_map.erase(it);
+			pending_resource = m_pending_resource_map.extract(key);
+
+			--m_nb_pending_tasks;
+			m_condition.notify_all();
+		}
+
+		if (exception) {
+			promise.set_exception(exception);
+			std::rethrow_exception(exception);
 		}
 
-		const auto new_resource 
-			= MakeAllocatedShared< Resource< DerivedResourceT > >
-			  (*this, key, std::forward< ConstructorArgsT >(args)...);
+		promise.set_value(resource);
+		return resource;
+	}
+
+	template< typename KeyT, typename ResourceT >
+	template< typename... ConstructorArgsT >
+	inline typename ResourcePool< KeyT, ResourceT >::future_type 
+		ResourcePool< KeyT, ResourceT >
+		::GetOrCreateAsync(const KeyT& key, ConstructorArgsT&&... args) {
 		
-		m_resource_map.emplace(key, new_resource);
+		return GetOrCreateDerivedAsync< ResourceT, ConstructorArgsT... >(
+			key, std::forward< ConstructorArgsT >(args)...);
+	}
+
+	template< typename KeyT, typename ResourceT >
+	template< typename DerivedResourceT, typename... ConstructorArgsT >
+	typename ResourcePool< KeyT, ResourceT >::future_type 
+		ResourcePool< KeyT, ResourceT >
+		::GetOrCreateDerivedAsync(const KeyT& key, ConstructorArgsT&&... args) {
 		
-		return new_resource;
+		static_assert(std::is_base_of_v< ResourceT, DerivedResourceT >);
+
+		using promise_type = std::promise< SharedPtr< ResourceT > >;
+
+		const std::scoped_lock lock(m_mutex);
+
+		if (const auto it = m_resource_map.find(key); 
+			it != m_resource_map.end()) {
+
+			promise_type promise;
+			promise.set_value(Reference(it->first, it->second));
+			return promise.get_future().share();
+		}
+
+		// Share the pending resource, if any.
+		if (const auto it = m_pending_resource_map.find(key); 
+			it != m_pending_resource_map.end()) {
+
+			return it->second;
+		}
+
+		const auto promise = MakeShared< promise_type >();
+		auto future = promise->get_future().share();
+		
+		m_pending_resource_map.emplace(key, future);
+		++m_nb_pending_tasks;
+
+		// std::make_tuple decays the arguments, but unwraps 
+		// std::reference_wrapper arguments to references.
+		EnqueueTask([this, key, promise, 
+			         args = std::make_tuple(
+						 std::forward< ConstructorArgsT >(args)...)]() noexcept {
+			
+			SharedPtr< ResourceT > resource;
+			std::exception_ptr exception;
+			try {
+				resource = std::apply([](auto&... ctor_args) {
+					return MakeAllocatedShared< DerivedResourceT >(
+						ctor_args...);
+				}, args);
+			}
+			catch (...) {
+				exception = std::current_exception();
+			}
+
+			// Destroyed after releasing the lock.
+			std::vector< SharedPtr< ResourceT > > evicted_resources;
+			typename PendingResourceMap::node_type pending_resource;
+			
+			{
+				const std::scoped_lock lock(m_mutex);
+
+				if (resource) {
+					resource = Insert(key, std::move(resource));
+					Evict(evicted_resources);
+				}
+				pending_resource = m_pending_resource_map.extract(key);
+				
+				--m_nb_pending_tasks;
+				m_condition.notify_all();
+			}
+
+			// This resource pool may be destroyed from here on.
+			if (exception) {
+				promise->set_exception(exception);
+			}
+			else {
+				promise->set_value(std::move(resource));
+			}
+		});
+
+		return future;
 	}
 
 	template< typename KeyT, typename ResourceT >
 	void ResourcePool< KeyT, ResourceT >::Remove(const KeyT& key) {
+		// Destroyed after releasing the lock.
+		SharedPtr< ResourceT > resource;
+
 		const std::scoped_lock lock(m_mutex);
 
 		if (const auto it = m_resource_map.find(key); 
-			it != m_resource_map.end() && it->second.expired()) {
+			it != m_resource_map.end()) {
 
+			resource         = std::move(it->second.m_resource);
+			m_resident_size -= it->second.m_size;
+			if (it->second.m_cached) {
+				m_cached_size -= it->second.m_size;
+				m_lru_list.erase(it->second.m_lru_position);
+			}
 			m_resource_map.erase(it);
 		}
 	}
 
 	template< typename KeyT, typename ResourceT >
 	inline void ResourcePool< KeyT, ResourceT >::RemoveAll() noexcept {
+		// Destroyed after releasing the lock.
+		ResourceMap resource_map;
+
 		const std::scoped_lock lock(m_mutex);
 
-		m_resource_map.clear();
+		resource_map.swap(m_resource_map);
+		m_lru_list.clear();
+		m_resident_size = 0u;
+		m_cached_size   = 0u;
 	}
 
-	#pragma endregion
+	template< typename KeyT, typename ResourceT >
+	void ResourcePool< KeyT, ResourceT >::Trim() {
+		// Destroyed after releasing the lock.
+		std::vector< SharedPtr< ResourceT > > evicted_resources;
 
-	//-------------------------------------------------------------------------
-	// Resource
-	//-------------------------------------------------------------------------
-	#pragma region
+		const std::scoped_lock lock(m_mutex);
+
+		Evict(evicted_resources);
+	}
 
 	template< typename KeyT, typename ResourceT >
-	template< typename DerivedResourceT >
-	template< typename... ConstructorArgsT >
-	ResourcePool< KeyT, ResourceT >::Resource< DerivedResourceT >
-		::Resource(ResourcePool& resource_pool, 
-			       const KeyT& resource_key, 
-			       ConstructorArgsT&&... args)
-		: DerivedResourceT(std::forward< ConstructorArgsT >(args)...),
-		m_resource_pool(resource_pool), 
-		m_resource_key(resource_key) {}
+	[[nodiscard]]
+	inline size_t ResourcePool< KeyT, ResourceT >::GetBudget() const noexcept {
+		const std::scoped_lock lock(m_mutex);
+
+		return m_budget;
+	}
+
+	template< typename KeyT, typename ResourceT >
+	inline void ResourcePool< KeyT, ResourceT >::SetBudget(size_t budget) {
+		{
+			const std::scoped_lock lock(m_mutex);
+			m_budget = budget;
+		}
+
+		Trim();
+	}
+
+	template< typename KeyT, typename ResourceT >
+	[[nodiscard]]
+	const ResidencyStatistics ResourcePool< KeyT, ResourceT >
+		::GetStatistics() const noexcept {
+
+		const std::scoped_lock lock(m_mutex);
+
+		ResidencyStatistics statistics;
+		statistics.m_nb_resident_resources = m_resource_map.size();
+		statistics.m_resident_size         = m_resident_size;
+		statistics.m_nb_cached_resources   = m_lru_list.size();
+		statistics.m_cached_size           = m_cached_size;
+		statistics.m_nb_evicted_resources  = m_nb_evicted_resources;
+		statistics.m_evicted_size          = m_evicted_size;
+		statistics.m_budget                = m_budget;
+		return statistics;
+	}
 
 	template< typename KeyT, typename ResourceT >
-	template< typename DerivedResourceT >
-	ResourcePool< KeyT, ResourceT >::Resource< DerivedResourceT >
-		::Resource(Resource&& resource) = default;
+	[[nodiscard]]
+	inline size_t ResourcePool< KeyT, ResourceT >
+		::GetSizeInBytes(const ResourceT& resource) noexcept {
 
+		if constexpr (has_size_in_bytes_v< ResourceT >) {
+			return resource.GetSizeInBytes();
+		}
+		else {
+			return sizeof(ResourceT);
+		}
+	}
 
 	template< typename KeyT, typename ResourceT >
-	template< typename DerivedResourceT >
-	ResourcePool< KeyT, ResourceT >::Resource< DerivedResourceT >
-		::~Resource() {
+	inline void ResourcePool< KeyT, ResourceT >
+		::WaitForPendingResources() noexcept {
+
+		std::unique_lock lock(m_mutex);
+
+		m_condition.wait(lock, [this]() noexcept {
+			return 0u == m_nb_pending_tasks;
+		});
+	}
+
+	template< typename KeyT, typename ResourceT >
+	[[nodiscard]]
+	SharedPtr< ResourceT > ResourcePool< KeyT, ResourceT >
+		::Reference(const KeyT& key, ResourceEntry& entry) {
+
+		// Share the references handed out already, if any.
+		if (auto reference = entry.m_reference.lock(); reference) {
+			return reference;
+		}
+
+		if (!m_link) {
+			m_link = MakeShared< PoolLink >();
+			m_link->m_pool = this;
+		}
+
+		const auto reference = MakeShared< ResourceReference >(
+			m_link, key, entry.m_resource);
+		
+		if (entry.m_cached) {
+			m_cached_size -= entry.m_size;
+			m_lru_list.erase(entry.m_lru_position);
+			entry.m_cached = false;
+		}
+
+		// The pointer shares the ownership of the resource reference.
+		SharedPtr< ResourceT > resource(reference, reference->GetResource());
+		entry.m_reference = resource;
+		return resource;
+	}
+
+	template< typename KeyT, typename ResourceT >
+	void ResourcePool< KeyT, ResourceT >
+		::Release(const KeyT& key, const ResourceT& resource) noexcept {
+
+		const std::scoped_lock lock(m_mutex);
+
+		const auto it = m_resource_map.find(key);
+		if (it == m_resource_map.end()) {
+			return;
+		}
+
+		auto& entry = it->second;
+		// The resource may be removed and replaced, or referenced again 
+		// before the mutex of this resource pool is locked.
+		if (&resource != entry.m_resource.get() 
+			|| entry.m_cached || !entry.m_reference.expired()) {
+			return;
+		}
+
+		m_lru_list.push_front(key);
+		entry.m_lru_position = m_lru_list.begin();
+		entry.m_cached       = true;
+		m_cached_size       += entry.m_size;
+	}
+
+	template< typename KeyT, typename ResourceT >
+	[[nodiscard]]
+	SharedPtr< ResourceT > ResourcePool< KeyT, ResourceT >
+		::Insert(const KeyT& key, SharedPtr< ResourceT > resource) {
+
+		const auto size = GetSizeInBytes(*resource);
 		
-		m_resource_pool.Remove(m_resource_key);
+		auto it = m_resource_map.find(key);
+		if (it == m_resource_map.end()) {
+			it = m_resource_map.emplace(key, ResourceEntry()).first;
+		}
+		else {
+			// Replace the resource.
+			m_resident_size -= it->second.m_size;
+			if (it->second.m_cached) {
+				m_cached_size -= it->second.m_size;
+				m_lru_list.erase(it->second.m_lru_position);
+			}
+		}
+
+		it->second = ResourceEntry{ std::move(resource), {}, size, {}, false };
+		m_resident_size += size;
+
+		return Reference(it->first, it->second);
+	}
+
+	template< typename KeyT, typename ResourceT >
+	void ResourcePool< KeyT, ResourceT >
+		::Evict(std::vector< SharedPtr< ResourceT > >& evicted_resources) {
+
+		// Only cached resources are contained in the least-recently-used 
+		// list. Evict the least recently used cached resources first.
+		while (m_budget < m_resident_size && !m_lru_list.empty()) {
+			const auto it = m_resource_map.find(m_lru_list.back());
+			m_lru_list.pop_back();
+
+			const auto size = it->second.m_size;
+			m_resident_size -= size;
+			m_cached_size   -= size;
+			++m_nb_evicted_resources;
+			m_evicted_size  += size;
+
+			evicted_resources.push_back(std::move(it->second.m_resource));
+			m_resource_map.erase(it);
+		}
 	}
 
 	#pragma endregion
@@ -0,0 +1,472 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "system\frame_statistics.hpp"
+#include "system\profiler.hpp"
+#include "exception\exception.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <limits>
+#include <string_view>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	namespace {
+
+		/**
+		 The names of the frame metrics.
+		 */
+		constexpr const_zstring g_frame_metric_names[] = {
+			"wall",
+			"cpu",
+			"present"
+		};
+
+		static_assert(std::size(g_frame_metric_names)
+					  == static_cast< size_t >(FrameMetric::Count));
+
+		/**
+		 Converts the given time interval to milliseconds.
+
+		 @param[in]		time
+						The time interval.
+		 @return		The given time interval expressed in milliseconds.
+		 */
+		[[nodiscard]]
+		inline F32 ToMilliseconds(TimeIntervalSeconds time) noexcept {
+			return static_cast< F32 >(time.count() * 1000.0);
+		}
+
+		/**
+		 Writes the given string as a quoted CSV field or JSON string to the
+		 given file stream.
+
+		 @param[in]		stream
+						A pointer to the file stream.
+		 @param[in]		str
+						The string.
+		 @param[in]		json
+						@c true if the given string needs to be written as a
+						JSON string. @c false if the given string needs to be
+						written as a CSV field.
+		 @return		A negative value if the given string could not be
+						written. A non-negative value otherwise.
+		 */
+		[[nodiscard]]
+		int WriteQuotedString(FILE* stream, std::string_view str,
+							  bool json) noexcept {
+			auto result = fputc('"', stream);
+			for (const auto c : str) {
+				// Skip the control characters.
+				if (0 <= c && c < ' ') {
+					continue;
+				}
+
+				// CSV doubles the quotes, JSON escapes the quotes and the
+				// backslashes.
+				if ('"' == c) {
+					result = std::min(result, fputc(json ? '\\' : '"', stream));
+				}
+				else if ('\\' == c && json) {
+					result = std::min(result, fputc('\\', stream));
+				}
+
+				result = std::min(result, fputc(c, stream));
+			}
+			return std::min(result, fputc('"', stream));
+		}
+	}
+
+	//-------------------------------------------------------------------------
+	// QuantileSketch
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	QuantileSketch::QuantileSketch(F32 relative_accuracy,
+								   F32 min_value,
+								   F32 max_value)
+		: m_log_gamma(0.0f),
+		m_offset(0),
+		m_buckets(),
+		m_count(0u),
+		m_sum(0.0),
+		m_max(0.0f) {
+
+		relative_accuracy = std::clamp(relative_accuracy, 0.0001f, 0.5f);
+		min_value = std::max(min_value, std::numeric_limits< F32 >::min());
+		max_value = std::max(max_value, min_value);
+
+		// gamma = (1 + alpha) / (1 - alpha)
+		m_log_gamma = std::log1p(2.0f * relative_accuracy
+								 / (1.0f - relative_accuracy));
+
+		const auto first = static_cast< S32 >(
+			std::ceil(std::log(min_value) / m_log_gamma));
+		const auto last  = static_cast< S32 >(
+			std::ceil(std::log(max_value) / m_log_gamma));
+
+		m_offset = first;
+		m_buckets.resize(static_cast< size_t >(last - first) + 1u, 0u);
+	}
+
+	QuantileSketch::QuantileSketch(const QuantileSketch& sketch) = default;
+
+	QuantileSketch::QuantileSketch(QuantileSketch&& sketch) noexcept = default;
+
+	QuantileSketch::~QuantileSketch() = default;
+
+	QuantileSketch& QuantileSketch
+		::operator=(const QuantileSketch& sketch) = default;
+
+	QuantileSketch& QuantileSketch
+		::operator=(QuantileSketch&& sketch) noexcept = default;
+
+	void QuantileSketch::Add(F32 value) noexcept {
+		value = std::max(value, 0.0f);
+
+		// Bucket i contains the values in (gamma^(i-1), gamma^i].
+		const auto index = (0.0f < value)
+			? static_cast< S32 >(std::ceil(std::log(value) / m_log_gamma))
+			: m_offset;
+		const auto max_bucket = static_cast< S32 >(m_buckets.size()) - 1;
+		const auto bucket = std::clamp(index - m_offset, 0, max_bucket);
+
+		++m_buckets[static_cast< size_t >(bucket)];
+		++m_count;
+		m_sum += value;
+		m_max  = std::max(m_max, value);
+	}
+
+	void QuantileSketch::Clear() noexcept {
+		std::fill(m_buckets.begin(), m_buckets.end(), 0u);
+		m_count = 0u;
+		m_sum   = 0.0;
+		m_max   = 0.0f;
+	}
+
+	[[nodiscard]]
+	F32 QuantileSketch::GetQuantile(F32 q) const noexcept {
+		if (0u == m_count) {
+			return 0.0f;
+		}
+
+		const auto rank = static_cast< U64 >(
+			std::clamp(q, 0.0f, 1.0f) * static_cast< F32 >(m_count - 1u));
+
+		U64 cumulative_count = 0u;
+		for (size_t i = 0u; i < m_buckets.size(); ++i) {
+			cumulative_count += m_buckets[i];
+			if (rank < cumulative_count) {
+				// The representative 2 gamma^i / (gamma + 1) has a relative
+				// error of at most alpha for all values of bucket i.
+				const auto index = static_cast< F32 >(m_offset
+													  + static_cast< S32 >(i));
+				const auto gamma = std::exp(m_log_gamma);
+				const auto value = 2.0f * std::exp(index * m_log_gamma)
+					             / (gamma + 1.0f);
+				return std::min(value, m_max);
+			}
+		}
+
+		return m_max;
+	}
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// FrameStatistics
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	FrameStatistics::FrameStatistics(size_t capacity, F32 hitch_threshold)
+		: m_frames(),
+		m_next(0u),
+		m_nb_frames(0u),
+		m_nb_hitches(0u),
+		m_hitch_threshold(hitch_threshold),
+		m_period_sketches(),
+		m_period_nb_hitches(0u),
+		m_period_time(0.0),
+		m_telemetry_time(0.0),
+		m_telemetry_period(MAGE_DEFAULT_TELEMETRY_PERIOD),
+		m_telemetry_stream(),
+		m_telemetry_path(),
+		m_telemetry_json(false) {
+
+		m_frames.reserve(std::max(capacity, size_t(1u)));
+	}
+
+	FrameStatistics::FrameStatistics(
+		FrameStatistics&& statistics) noexcept = default;
+
+	FrameStatistics::~FrameStatistics() = default;
+
+	FrameStatistics& FrameStatistics
+		::operator=(FrameStatistics&& statistics) noexcept = default;
+
+	void FrameStatistics::Record(TimeIntervalSeconds wall_clock_time,
+								 TimeIntervalSeconds core_clock_time,
+								 TimeIntervalSeconds present_time) {
+		FrameSample sample;
+		sample.m_times[static_cast< size_t >(FrameMetric::WallClock)]
+			= ToMilliseconds(wall_clock_time);
+		sample.m_times[static_cast< size_t >(FrameMetric::CoreClock)]
+			= ToMilliseconds(core_clock_time);
+		sample.m_times[static_cast< size_t >(FrameMetric::Present)]
+			= ToMilliseconds(present_time);
+
+		// Update the ring buffer.
+		if (m_frames.size() < m_frames.capacity()) {
+			m_frames.push_back(sample);
+		}
+		else {
+			m_frames[m_next] = sample;
+		}
+		m_next = (m_next + 1u) % m_frames.capacity();
+
+		++m_nb_frames;
+		const auto hitch = m_hitch_threshold
+			< sample.m_times[static_cast< size_t >(FrameMetric::WallClock)];
+		if (hitch) {
+			++m_nb_hitches;
+			++m_period_nb_hitches;
+		}
+
+		// Update the quantile sketches of the current telemetry period.
+		for (size_t i = 0u; i < std::size(m_period_sketches); ++i) {
+			m_period_sketches[i].Add(sample.m_times[i]);
+		}
+		m_period_time += wall_clock_time;
+
+		if (UsesTelemetry() && m_telemetry_period <= m_period_time) {
+			WriteTelemetry();
+		}
+	}
+
+	[[nodiscard]]
+	size_t FrameStatistics::GetNumberOfRecentHitches() const noexcept {
+		return static_cast< size_t >(std::count_if(
+			m_frames.cbegin(), m_frames.cend(),
+			[threshold = m_hitch_threshold](const FrameSample& sample) noexcept {
+				return threshold
+					< sample.m_times[static_cast< size_t >(FrameMetric::WallClock)];
+			}));
+	}
+
+	[[nodiscard]]
+	const FrameTimePercentiles
+		FrameStatistics::GetRecentPercentiles(FrameMetric metric) const {
+
+		FrameTimePercentiles percentiles;
+		if (m_frames.empty()) {
+			return percentiles;
+		}
+
+		std::vector< F32 > times;
+		times.reserve(m_frames.size());
+		for (const auto& sample : m_frames) {
+			times.push_back(sample.m_times[static_cast< size_t >(metric)]);
+		}
+
+		// Select in decreasing order: each selection partitions the range, so
+		// that the next selection only needs to inspect the lower part.
+		auto last = times.end();
+		const auto select = [&times, &last](F32 q) {
+			const auto n = static_cast< size_t >(
+				q * static_cast< F32 >(times.size() - 1u));
+			const auto it = times.begin() + n;
+			std::nth_element(times.begin(), it, last);
+			last = it + 1;
+			return *it;
+		};
+
+		percentiles.m_max = *std::max_element(times.cbegin(), times.cend());
+		percentiles.m_p99 = select(0.99f);
+		percentiles.m_p95 = select(0.95f);
+		percentiles.m_p50 = select(0.50f);
+		return percentiles;
+	}
+
+	void FrameStatistics::StartTelemetry(std::filesystem::path path,
+										 TimeIntervalSeconds period) {
+		StopTelemetry();
+
+		const auto extension = path.extension();
+		if (L".json" == extension) {
+			m_telemetry_json = true;
+		}
+		else if (L".csv" == extension) {
+			m_telemetry_json = false;
+		}
+		else {
+			throw Exception("%ls: unknown telemetry file extension.",
+							path.c_str());
+		}
+
+		FILE* file;
+		{
+			const errno_t result = _wfopen_s(&file, path.c_str(), L"w");
+			ThrowIfFailed((0 == result),
+						  "%ls: could not open file.", path.c_str());
+		}
+
+		m_telemetry_stream.reset(file);
+		m_telemetry_path   = std::move(path);
+		m_telemetry_period = std::max(period, TimeIntervalSeconds(0.001));
+		m_telemetry_time   = TimeIntervalSeconds(0.0);
+
+		if (!m_telemetry_json) {
+			const int result = fputs("time_s,metric,frames,avg_ms,p50_ms,"
+									 "p95_ms,p99_ms,max_ms,hitches\n",
+									 m_telemetry_stream.get());
+			ThrowIfFailed((EOF != result),
+						  "%ls: could not write to file.",
+						  m_telemetry_path.c_str());
+		}
+
+		ResetPeriod();
+	}
+
+	void FrameStatistics::StopTelemetry() {
+		if (!UsesTelemetry()) {
+			return;
+		}
+
+		if (0u != m_period_sketches[0].GetCount()) {
+			WriteTelemetry();
+		}
+
+		m_telemetry_stream.reset();
+		m_telemetry_path.clear();
+	}
+
+	void FrameStatistics::WriteTelemetry() {
+		m_telemetry_time += m_period_time;
+
+		if (m_telemetry_json) {
+			WriteJSONTelemetry();
+		}
+		else {
+			WriteCSVTelemetry();
+		}
+
+		const int result = fflush(m_telemetry_stream.get());
+		ThrowIfFailed((0 == result),
+					  "%ls: could not write to file.",
+					  m_telemetry_path.c_str());
+
+		ResetPeriod();
+	}
+
+	void FrameStatistics::WriteCSVTelemetry() {
+		const auto stream = m_telemetry_stream.get();
+		const auto time   = m_telemetry_time.count();
+		auto result       = 0;
+
+		for (size_t i = 0u; i < std::size(m_period_sketches); ++i) {
+			const auto& sketch = m_period_sketches[i];
+			result = std::min(result, fprintf(stream,
+				"%.3f,%s,%llu,%.3f,%.3f,%.3f,%.3f,%.3f,%llu\n",
+				time, g_frame_metric_names[i],
+				static_cast< unsigned long long >(sketch.GetCount()),
+				sketch.GetAverage(),
+				sketch.GetQuantile(0.50f),
+				sketch.GetQuantile(0.95f),
+				sketch.GetQuantile(0.99f),
+				sketch.GetMaximum(),
+				static_cast< unsigned long long >(m_period_nb_hitches)));
+		}
+
+		// The profile zones are summarized over the statistics window of the
+		// profiler: the p50 and p95 columns are not available.
+		for (const auto& zone : Profiler::Get().GetStatistics()) {
+			result = std::min(result, fprintf(stream, "%.3f,", time));
+			result = std::min(result, 
+							  WriteQuotedString(stream, zone.m_name, false));
+			result = std::min(result, fprintf(stream,
+				",%u,%.3f,,,%.3f,,\n",
+				zone.m_nb_frames,
+				zone.m_avg,
+				zone.m_p99));
+		}
+
+		ThrowIfFailed((0 <= result),
+					  "%ls: could not write to file.",
+					  m_telemetry_path.c_str());
+	}
+
+	void FrameStatistics::WriteJSONTelemetry() {
+		const auto stream = m_telemetry_stream.get();
+		auto result       = 0;
+
+		result = std::min(result, fprintf(stream,
+			"{\"time_s\":%.3f,\"frames\":%llu,\"hitches\":%llu,"
+			"\"hitch_threshold_ms\":%.3f",
+			m_telemetry_time.count(),
+			static_cast< unsigned long long >(m_period_sketches[0].GetCount()),
+			static_cast< unsigned long long >(m_period_nb_hitches),
+			m_hitch_threshold));
+
+		for (size_t i = 0u; i < std::size(m_period_sketches); ++i) {
+			const auto& sketch = m_period_sketches[i];
+			result = std::min(result, fprintf(stream,
+				",\"%s\":{\"avg_ms\":%.3f,\"p50_ms\":%.3f,\"p95_ms\":%.3f,"
+				"\"p99_ms\":%.3f,\"max_ms\":%.3f}",
+				g_frame_metric_names[i],
+				sketch.GetAverage(),
+				sketch.GetQuantile(0.50f),
+				sketch.GetQuantile(0.95f),
+				sketch.GetQuantile(0.99f),
+				sketch.GetMaximum()));
+		}
+
+		result = std::min(result, fprintf(stream, ",\"passes\":{"));
+		auto first = true;
+		for (const auto& zone : Profiler::Get().GetStatistics()) {
+			if (!first) {
+				result = std::min(result, fputc(',', stream));
+			}
+			result = std::min(result, 
+							  WriteQuotedString(stream, zone.m_name, true));
+			result = std::min(result, fprintf(stream,
+				":{\"calls\":%.2f,\"min_ms\":%.3f,\"avg_ms\":%.3f,"
+				"\"p99_ms\":%.3f}",
+				zone.m_nb_calls,
+				zone.m_min,
+				zone.m_avg,
+				zone.m_p99));
+			first = false;
+		}
+		result = std::min(result, fprintf(stream, "}}\n"));
+
+		ThrowIfFailed((0 <= result),
+					  "%ls: could not write to file.",
+					  m_telemetry_path.c_str());
+	}
+
+	void FrameStatistics::ResetPeriod() noexcept {
+		for (auto& sketch : m_period_sketches) {
+			sketch.Clear();
+		}
+		m_period_nb_hitches = 0u;
+		m_period_time       = TimeIntervalSeconds(0.0);
+	}
+
+	#pragma endregion
+}
\ No newline at end of file
@@ -0,0 +1,587 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "system\timer.hpp"
+#include "memory\memory.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <filesystem>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Defines
+//-----------------------------------------------------------------------------
+#pragma region
+
+/**
+ The default number of recent frames of frame statistics.
+ */
+#define MAGE_DEFAULT_FRAME_STATISTICS_CAPACITY 1024u
+
+/**
+ The default hitch threshold (in milliseconds) of frame statistics.
+ */
+#define MAGE_DEFAULT_HITCH_THRESHOLD 33.3f
+
+/**
+ The default telemetry period (in seconds) of frame statistics.
+ */
+#define MAGE_DEFAULT_TELEMETRY_PERIOD 10.0
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	//-------------------------------------------------------------------------
+	// QuantileSketch
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A class of (streaming) quantile sketches.
+
+	 A quantile sketch counts the values in logarithmically spaced buckets,
+	 which bounds the relative error of each quantile by a fixed relative
+	 accuracy using a fixed amount of memory, independent of the number of
+	 values.
+	 */
+	class QuantileSketch final {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a quantile sketch.
+
+		 @param[in]		relative_accuracy
+						The relative accuracy of the quantiles.
+		 @param[in]		min_value
+						The minimum (strictly positive) distinguishable value.
+						Smaller values are counted as this value.
+		 @param[in]		max_value
+						The maximum distinguishable value. Larger values are
+						counted as this value.
+		 */
+		explicit QuantileSketch(F32 relative_accuracy = 0.01f,
+								F32 min_value = 0.001f,
+								F32 max_value = 100000.0f);
+
+		/**
+		 Constructs a quantile sketch from the given quantile sketch.
+
+		 @param[in]		sketch
+						A reference to the quantile sketch to copy.
+		 */
+		QuantileSketch(const QuantileSketch& sketch);
+
+		/**
+		 Constructs a quantile sketch by moving the given quantile sketch.
+
+		 @param[in]		sketch
+						A reference to the quantile sketch to move.
+		 */
+		QuantileSketch(QuantileSketch&& sketch) noexcept;
+
+		/**
+		 Destructs this quantile sketch.
+		 */
+		~QuantileSketch();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given quantile sketch to this quantile sketch.
+
+		 @param[in]		sketch
+						A reference to the quantile sketch to copy.
+		 @return		A reference to the copy of the given quantile sketch
+						(i.e. this quantile sketch).
+		 */
+		QuantileSketch& operator=(const QuantileSketch& sketch);
+
+		/**
+		 Moves the given quantile sketch to this quantile sketch.
+
+		 @param[in]		sketch
+						A reference to the quantile sketch to move.
+		 @return		A reference to the moved quantile sketch (i.e. this
+						quantile sketch).
+		 */
+		QuantileSketch& operator=(QuantileSketch&& sketch) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Adds the given value to this quantile sketch.
+
+		 @param[in]		value
+						The value.
+		 */
+		void Add(F32 value) noexcept;
+
+		/**
+		 Removes all values of this quantile sketch.
+		 */
+		void Clear() noexcept;
+
+		/**
+		 Returns the number of values of this quantile sketch.
+
+		 @return		The number of values of this quantile sketch.
+		 */
+		[[nodiscard]]
+		U64 GetCount() const noexcept {
+			return m_count;
+		}
+
+		/**
+		 Returns the average of the values of this quantile sketch.
+
+		 @return		The average of the values of this quantile sketch
+						(or zero if this quantile sketch contains no values).
+		 */
+		[[nodiscard]]
+		F32 GetAverage() const noexcept {
+			return (0u == m_count) ? 0.0f
+				                   : static_cast< F32 >(m_sum / m_count);
+		}
+
+		/**
+		 Returns the maximum of the values of this quantile sketch.
+
+		 @return		The maximum of the values of this quantile sketch
+						(or zero if this quantile sketch contains no values).
+		 */
+		[[nodiscard]]
+		F32 GetMaximum() const noexcept {
+			return m_max;
+		}
+
+		/**
+		 Returns the given quantile of the values of this quantile sketch.
+
+		 @param[in]		q
+						The quantile in [0,1].
+		 @return		The given quantile of the values of this quantile
+						sketch (or zero if this quantile sketch contains no
+						values).
+		 */
+		[[nodiscard]]
+		F32 GetQuantile(F32 q) const noexcept;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The (natural) logarithm of the base of the buckets of this quantile
+		 sketch.
+		 */
+		F32 m_log_gamma;
+
+		/**
+		 The index offset of the buckets of this quantile sketch.
+		 */
+		S32 m_offset;
+
+		/**
+		 A vector containing the counts of the buckets of this quantile
+		 sketch.
+		 */
+		std::vector< U32 > m_buckets;
+
+		/**
+		 The number of values of this quantile sketch.
+		 */
+		U64 m_count;
+
+		/**
+		 The sum of the values of this quantile sketch.
+		 */
+		F64 m_sum;
+
+		/**
+		 The maximum of the values of this quantile sketch.
+		 */
+		F32 m_max;
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// FrameStatistics
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 An enumeration of the different frame metrics.
+
+	 This contains:
+	 @c WallClock,
+	 @c CoreClock and
+	 @c Present.
+	 */
+	enum class FrameMetric : U8 {
+		WallClock = 0, // The wall clock time of a frame.
+		CoreClock,     // The core clock (CPU) time of a frame.
+		Present,       // The time spent presenting a frame.
+		Count
+	};
+
+	/**
+	 A struct of frame samples.
+	 */
+	struct FrameSample final {
+
+	public:
+
+		/**
+		 The times (in milliseconds) of each frame metric of this frame
+		 sample.
+		 */
+		F32 m_times[static_cast< size_t >(FrameMetric::Count)] = {};
+	};
+
+	/**
+	 A struct of frame time percentiles.
+	 */
+	struct FrameTimePercentiles final {
+
+	public:
+
+		/**
+		 The median (in milliseconds).
+		 */
+		F32 m_p50 = 0.0f;
+
+		/**
+		 The 95th percentile (in milliseconds).
+		 */
+		F32 m_p95 = 0.0f;
+
+		/**
+		 The 99th percentile (in milliseconds).
+		 */
+		F32 m_p99 = 0.0f;
+
+		/**
+		 The maximum (in milliseconds).
+		 */
+		F32 m_max = 0.0f;
+	};
+
+	/**
+	 A class of frame statistics.
+
+	 Frame statistics keep the most recent frame samples in a ring buffer
+	 (for exact percentiles of the recent frames) and summarize all frame
+	 samples of the current telemetry period in quantile sketches. If
+	 telemetry is enabled, the summary of each telemetry period, including
+	 the statistics of the profile zones (if profiling is enabled), is
+	 appended to a CSV or JSON (Lines) file.
+	 */
+	class FrameStatistics final {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs frame statistics.
+
+		 @param[in]		capacity
+						The number of recent frame samples.
+		 @param[in]		hitch_threshold
+						The hitch threshold (in milliseconds).
+		 */
+		explicit FrameStatistics(
+			size_t capacity     = MAGE_DEFAULT_FRAME_STATISTICS_CAPACITY,
+			F32 hitch_threshold = MAGE_DEFAULT_HITCH_THRESHOLD);
+
+		/**
+		 Constructs frame statistics from the given frame statistics.
+
+		 @param[in]		statistics
+						A reference to the frame statistics to copy.
+		 */
+		FrameStatistics(const FrameStatistics& statistics) = delete;
+
+		/**
+		 Constructs frame statistics by moving the given frame statistics.
+
+		 @param[in]		statistics
+						A reference to the frame statistics to move.
+		 */
+		FrameStatistics(FrameStatistics&& statistics) noexcept;
+
+		/**
+		 Destructs these frame statistics.
+		 */
+		~FrameStatistics();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given frame statistics to these frame statistics.
+
+		 @param[in]		statistics
+						A reference to the frame statistics to copy.
+		 @return		A reference to the copy of the given frame statistics
+						(i.e. these frame statistics).
+		 */
+		FrameStatistics& operator=(const FrameStatistics& statistics) = delete;
+
+		/**
+		 Moves the given frame statistics to these frame statistics.
+
+		 @param[in]		statistics
+						A reference to the frame statistics to move.
+		 @return		A reference to the moved frame statistics (i.e. these
+						frame statistics).
+		 */
+		FrameStatistics& operator=(FrameStatistics&& statistics) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Records a frame.
+
+		 @param[in]		wall_clock_time
+						The wall clock time of the frame.
+		 @param[in]		core_clock_time
+						The core clock (CPU) time of the frame.
+		 @param[in]		present_time
+						The time spent presenting the frame.
+		 @throws		Exception
+						Failed to write the telemetry.
+		 */
+		void Record(TimeIntervalSeconds wall_clock_time,
+					TimeIntervalSeconds core_clock_time,
+					TimeIntervalSeconds present_time);
+
+		/**
+		 Returns the number of recorded frames of these frame statistics.
+
+		 @return		The number of recorded frames of these frame
+						statistics.
+		 */
+		[[nodiscard]]
+		U64 GetNumberOfFrames() const noexcept {
+			return m_nb_frames;
+		}
+
+		/**
+		 Returns the number of recorded hitches of these frame statistics.
+
+		 @return		The number of recorded frames of these frame
+						statistics whose wall clock time exceeds the hitch
+						threshold.
+		 */
+		[[nodiscard]]
+		U64 GetNumberOfHitches() const noexcept {
+			return m_nb_hitches;
+		}
+
+		/**
+		 Returns the number of recent hitches of these frame statistics.
+
+		 @return		The number of recent frames of these frame statistics
+						whose wall clock time exceeds the hitch threshold.
+		 */
+		[[nodiscard]]
+		size_t GetNumberOfRecentHitches() const noexcept;
+
+		/**
+		 Returns the hitch threshold of these frame statistics.
+
+		 @return		The hitch threshold (in milliseconds) of these frame
+						statistics.
+		 */
+		[[nodiscard]]
+		F32 GetHitchThreshold() const noexcept {
+			return m_hitch_threshold;
+		}
+
+		/**
+		 Sets the hitch threshold of these frame statistics to the given
+		 hitch threshold.
+
+		 @param[in]		hitch_threshold
+						The hitch threshold (in milliseconds).
+		 */
+		void SetHitchThreshold(F32 hitch_threshold) noexcept {
+			m_hitch_threshold = hitch_threshold;
+		}
+
+		/**
+		 Returns the percentiles of the given frame metric of the recent
+		 frames of these frame statistics.
+
+		 @param[in]		metric
+						The frame metric.
+		 @return		The percentiles of the given frame metric of the
+						recent frames of these frame statistics.
+		 */
+		[[nodiscard]]
+		const FrameTimePercentiles
+			GetRecentPercentiles(FrameMetric metric) const;
+
+		/**
+		 Checks whether these frame statistics write telemetry.
+
+		 @return		@c true if these frame statistics write telemetry.
+						@c false otherwise.
+		 */
+		[[nodiscard]]
+		bool UsesTelemetry() const noexcept {
+			return nullptr != m_telemetry_stream;
+		}
+
+		/**
+		 Starts writing the telemetry of these frame statistics to the file
+		 associated with the given path.
+
+		 @param[in]		path
+						The path of the telemetry file. The file extension
+						(@c .csv or @c .json) determines the file format.
+		 @param[in]		period
+						The telemetry period.
+		 @throws		Exception
+						Failed to open the telemetry file.
+		 */
+		void StartTelemetry(std::filesystem::path path,
+							TimeIntervalSeconds period
+								= TimeIntervalSeconds(MAGE_DEFAULT_TELEMETRY_PERIOD));
+
+		/**
+		 Stops writing the telemetry of these frame statistics. The summary
+		 of the current (partial) telemetry period is written first.
+
+		 @throws		Exception
+						Failed to write the telemetry.
+		 */
+		void StopTelemetry();
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		void WriteTelemetry();
+
+		void WriteCSVTelemetry();
+
+		void WriteJSONTelemetry();
+
+		void ResetPeriod() noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The ring buffer containing the recent frame samples of these frame
+		 statistics.
+		 */
+		std::vector< FrameSample > m_frames;
+
+		/**
+		 The index of the next frame sample in the ring buffer of these
+		 frame statistics.
+		 */
+		size_t m_next;
+
+		/**
+		 The number of recorded frames of these frame statistics.
+		 */
+		U64 m_nb_frames;
+
+		/**
+		 The number of recorded hitches of these frame statistics.
+		 */
+		U64 m_nb_hitches;
+
+		/**
+		 The hitch threshold (in milliseconds) of these frame statistics.
+		 */
+		F32 m_hitch_threshold;
+
+		/**
+		 The quantile sketches of each frame metric of the current
+		 telemetry period of these frame statistics.
+		 */
+		QuantileSketch m_period_sketches[static_cast< size_t >(FrameMetric::Count)];
+
+		/**
+		 The number of hitches of the current telemetry period of these
+		 frame statistics.
+		 */
+		U64 m_period_nb_hitches;
+
+		/**
+		 The elapsed wall clock time of the current telemetry period of
+		 these frame statistics.
+		 */
+		TimeIntervalSeconds m_period_time;
+
+		/**
+		 The elapsed wall clock time of all telemetry periods of these frame
+		 statistics.
+		 */
+		TimeIntervalSeconds m_telemetry_time;
+
+		/**
+		 The telemetry period of these frame statistics.
+		 */
+		TimeIntervalSeconds m_telemetry_period;
+
+		/**
+		 A pointer to the telemetry file stream of these frame statistics.
+		 */
+		UniqueFileStream m_telemetry_stream;
+
+		/**
+		 The path of the telemetry file of these frame statistics.
+		 */
+		std::filesystem::path m_telemetry_path;
+
+		/**
+		 Flag indicating whether the telemetry of these frame statistics is
+		 written in JSON (Lines) format instead of CSV format.
+		 */
+		bool m_telemetry_json;
+	};
+
+	#pragma endregion
+}
\ No newline at end of file
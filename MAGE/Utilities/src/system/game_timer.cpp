@@ -0,0 +1,82 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "system\game_timer.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <thread>
+#include <timeapi.h>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Linker Directives
+//-----------------------------------------------------------------------------
+#pragma region
+
+#pragma comment (lib, "winmm.lib")
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	void GameTimer::WaitForNextFrame(bool background) noexcept {
+		using Clock = std::chrono::steady_clock;
+
+		const auto frame_time = background 
+			? std::max(m_target_frame_time, m_background_frame_time) 
+			: m_target_frame_time;
+		
+		const auto now = Clock::now();
+		
+		if (TimeIntervalSeconds::zero() == frame_time) {
+			m_frame_start = now;
+			return;
+		}
+
+		const auto deadline = m_frame_start 
+			+ std::chrono::duration_cast< Clock::duration >(frame_time);
+		
+		// Do not catch up with missed deadlines.
+		if (deadline <= now) {
+			m_frame_start = now;
+			return;
+		}
+
+		// Sleep until shortly before the deadline. The resolution of the 
+		// system timer is temporarily increased to 1ms.
+		const auto spin_time = std::chrono::duration_cast< Clock::duration >(
+			TimeIntervalSeconds(MAGE_FRAME_PACING_SPIN_TIME));
+		if (spin_time < deadline - now) {
+			timeBeginPeriod(1u);
+			std::this_thread::sleep_until(deadline - spin_time);
+			timeEndPeriod(1u);
+		}
+
+		// Spin for the remaining time.
+		auto wake = Clock::now();
+		while (wake < deadline) {
+			YieldProcessor();
+			wake = Clock::now();
+		}
+
+		m_frame_start   = deadline;
+		m_pacing_jitter = std::chrono::duration_cast< TimeIntervalSeconds >(
+			wake - deadline);
+		m_average_pacing_jitter 
+			+= MAGE_FRAME_PACING_JITTER_WEIGHT 
+			   * (m_pacing_jitter - m_average_pacing_jitter);
+	}
+}
\ No newline at end of file
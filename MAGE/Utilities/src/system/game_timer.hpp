@@ -9,6 +9,25 @@
 
 #pragma endregion
 
+//-----------------------------------------------------------------------------
+// Engine Defines
+//-----------------------------------------------------------------------------
+#pragma region
+
+/**
+ The time (in seconds) before a frame deadline during which game timers spin 
+ instead of sleep while waiting for the next frame.
+ */
+#define MAGE_FRAME_PACING_SPIN_TIME 0.002
+
+/**
+ The weight of the last pacing jitter in the average pacing jitter of game 
+ timers.
+ */
+#define MAGE_FRAME_PACING_JITTER_WEIGHT 0.1
+
+#pragma endregion
+
 //-----------------------------------------------------------------------------
 // Engine Declarations and Definitions
 //-----------------------------------------------------------------------------
@@ -198,7 +217,14 @@ namespace mage {
 		/**
 		 Constructs a game timer.
 		 */
-		GameTimer() noexcept = default;
+		GameTimer() noexcept
+			: m_wall_clock_timer(), 
+			m_core_clock_timer(), 
+			m_target_frame_time(TimeIntervalSeconds::zero()), 
+			m_background_frame_time(TimeIntervalSeconds::zero()), 
+			m_frame_start(), 
+			m_pacing_jitter(TimeIntervalSeconds::zero()), 
+			m_average_pacing_jitter(TimeIntervalSeconds::zero()) {}
 
 		/**
 		 Constructs a game timer from the given game timer.
@@ -296,6 +322,96 @@ namespace mage {
 							core_clock_time.second);
 		}
 
+		/**
+		 Returns the target frame time of this game timer.
+
+		 @return		The target frame time (in seconds) of this game timer. 
+						Zero if the frame rate is not limited.
+		 */
+		[[nodiscard]]
+		TimeIntervalSeconds GetTargetFrameTime() const noexcept {
+			return m_target_frame_time;
+		}
+
+		/**
+		 Sets the target frame rate of this game timer to the given frame 
+		 rate.
+
+		 @param[in]		frame_rate
+						The target frame rate (in frames per second). Zero 
+						if the frame rate must not be limited.
+		 */
+		void SetTargetFrameRate(F64 frame_rate) noexcept {
+			m_target_frame_time = (0.0 < frame_rate) 
+				? TimeIntervalSeconds(1.0 / frame_rate) 
+				: TimeIntervalSeconds::zero();
+		}
+
+		/**
+		 Returns the background frame time of this game timer.
+
+		 @return		The minimum frame time (in seconds) of this game timer 
+						while running in the background. Zero if the frame 
+						rate is not limited in the background.
+		 */
+		[[nodiscard]]
+		TimeIntervalSeconds GetBackgroundFrameTime() const noexcept {
+			return m_background_frame_time;
+		}
+
+		/**
+		 Sets the background frame rate cap of this game timer to the given 
+		 frame rate.
+
+		 @param[in]		frame_rate
+						The maximum frame rate (in frames per second) while 
+						running in the background. Zero if the frame rate 
+						must not be limited in the background.
+		 */
+		void SetBackgroundFrameRate(F64 frame_rate) noexcept {
+			m_background_frame_time = (0.0 < frame_rate) 
+				? TimeIntervalSeconds(1.0 / frame_rate) 
+				: TimeIntervalSeconds::zero();
+		}
+
+		/**
+		 Blocks the calling thread until the start of the next frame of this 
+		 game timer.
+
+		 The calling thread sleeps until shortly before the deadline of the 
+		 next frame and spins for the remaining time. Frames which miss their 
+		 deadline are not caught up.
+
+		 @param[in]		background
+						@c true if the application runs in the background. 
+						@c false otherwise.
+		 */
+		void WaitForNextFrame(bool background) noexcept;
+
+		/**
+		 Returns the pacing jitter of the last paced frame of this game timer.
+
+		 @return		The time (in seconds) between the deadline and the 
+						actual start of the last paced frame of this game 
+						timer.
+		 */
+		[[nodiscard]]
+		TimeIntervalSeconds GetPacingJitter() const noexcept {
+			return m_pacing_jitter;
+		}
+
+		/**
+		 Returns the average pacing jitter of this game timer.
+
+		 @return		The (exponential moving) average time (in seconds) 
+						between the deadline and the actual start of the paced 
+						frames of this game timer.
+		 */
+		[[nodiscard]]
+		TimeIntervalSeconds GetAveragePacingJitter() const noexcept {
+			return m_average_pacing_jitter;
+		}
+
 	private:
 
 		//---------------------------------------------------------------------
@@ -311,6 +427,33 @@ namespace mage {
 		 The core clock per core timer of this game timer.
 		 */
 		CPUTimer m_core_clock_timer;
+
+		/**
+		 The target frame time (in seconds) of this game timer.
+		 */
+		TimeIntervalSeconds m_target_frame_time;
+
+		/**
+		 The minimum frame time (in seconds) of this game timer while running 
+		 in the background.
+		 */
+		TimeIntervalSeconds m_background_frame_time;
+
+		/**
+		 The (scheduled) start of the current paced frame of this game timer.
+		 */
+		std::chrono::steady_clock::time_point m_frame_start;
+
+		/**
+		 The pacing jitter (in seconds) of the last paced frame of this game 
+		 timer.
+		 */
+		TimeIntervalSeconds m_pacing_jitter;
+
+		/**
+		 The average pacing jitter (in seconds) of this game timer.
+		 */
+		TimeIntervalSeconds m_average_pacing_jitter;
 	};
 
 	#pragma endregion
@@ -0,0 +1,536 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "system\profiler.hpp"
+#include "io\writer.hpp"
+#include "exception\exception.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <unordered_set>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	namespace {
+
+		/**
+		 A pointer to the name of the innermost profile zone of the calling
+		 thread (or @c nullptr).
+		 */
+		thread_local const_zstring g_current_zone = nullptr;
+
+		/**
+		 The nesting depth of the profile zones of the calling thread.
+		 */
+		thread_local U32 g_current_depth = 0u;
+
+		/**
+		 A class of Chrome trace writers for writing profile events.
+		 */
+		class ChromeTraceWriter final : private Writer {
+
+		public:
+
+			//-----------------------------------------------------------------
+			// Constructors and Destructors
+			//-----------------------------------------------------------------
+
+			explicit ChromeTraceWriter(
+				const std::vector< ProfileEvent >& events) noexcept
+				: Writer(),
+				m_events(events) {}
+
+			ChromeTraceWriter(const ChromeTraceWriter& writer) = delete;
+
+			ChromeTraceWriter(ChromeTraceWriter&& writer) = delete;
+
+			~ChromeTraceWriter() = default;
+
+			//-----------------------------------------------------------------
+			// Assignment Operators
+			//-----------------------------------------------------------------
+
+			ChromeTraceWriter& operator=(const ChromeTraceWriter& writer) = delete;
+
+			ChromeTraceWriter& operator=(ChromeTraceWriter&& writer) = delete;
+
+			//-----------------------------------------------------------------
+			// Member Methods
+			//-----------------------------------------------------------------
+
+			using Writer::WriteToFile;
+
+		private:
+
+			//-----------------------------------------------------------------
+			// Member Methods
+			//-----------------------------------------------------------------
+
+			virtual void Write() override {
+				U64 epoch = std::numeric_limits< U64 >::max();
+				U32 nb_threads = 0u;
+				for (const auto& event : m_events) {
+					epoch      = std::min(epoch, event.m_begin);
+					nb_threads = std::max(nb_threads, event.m_thread + 1u);
+				}
+
+				WriteStringLine(NotNull< const_zstring >("{\"traceEvents\":["));
+
+				char buffer[256];
+				const auto not_null_buffer = NotNull< const_zstring >(buffer);
+				auto first = true;
+
+				// Name the threads.
+				for (U32 i = 0u; i < nb_threads; ++i) {
+					sprintf_s(buffer, std::size(buffer),
+							  "%s{\"name\":\"thread_name\",\"ph\":\"M\","
+							  "\"pid\":0,\"tid\":%u,"
+							  "\"args\":{\"name\":\"Thread %u\"}}",
+							  first ? "" : ",\n", i, i);
+					WriteString(not_null_buffer);
+					first = false;
+				}
+
+				// Write the profile events as complete events.
+				for (const auto& event : m_events) {
+					WriteString(NotNull< const_zstring >(
+						first ? "{\"name\":\"" : ",\n{\"name\":\""));
+					WriteEscapedString(event.m_name);
+
+					const auto ts  = (event.m_begin - epoch) / 1000.0;
+					const auto dur = (event.m_end - event.m_begin) / 1000.0;
+					sprintf_s(buffer, std::size(buffer),
+							  "\",\"cat\":\"MAGE\",\"ph\":\"X\",\"pid\":0,"
+							  "\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+							  event.m_thread, ts, dur);
+					WriteString(not_null_buffer);
+					first = false;
+				}
+
+				WriteStringLine(
+					NotNull< const_zstring >("\n],\"displayTimeUnit\":\"ms\"}"));
+			}
+
+			void WriteEscapedString(const_zstring str) {
+				for (; '\0' != *str; ++str) {
+					const auto c = *str;
+					if ('"' == c || '\\' == c) {
+						WriteCharacter('\\');
+						WriteCharacter(c);
+					}
+					else if (' ' <= c || c < 0) {
+						WriteCharacter(c);
+					}
+				}
+			}
+
+			//-----------------------------------------------------------------
+			// Member Variables
+			//-----------------------------------------------------------------
+
+			const std::vector< ProfileEvent >& m_events;
+		};
+	}
+
+	//-------------------------------------------------------------------------
+	// Profiler::ThreadBuffer
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A class of (single-producer, single-consumer) ring buffers of profile
+	 events.
+	 */
+	class Profiler::ThreadBuffer final {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		explicit ThreadBuffer(U32 index)
+			: m_index(index),
+			m_in_use(true),
+			m_head(0u),
+			m_tail(0u),
+			m_events(MAGE_PROFILER_THREAD_BUFFER_SIZE) {}
+
+		ThreadBuffer(const ThreadBuffer& buffer) = delete;
+
+		ThreadBuffer(ThreadBuffer&& buffer) = delete;
+
+		~ThreadBuffer() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		ThreadBuffer& operator=(const ThreadBuffer& buffer) = delete;
+
+		ThreadBuffer& operator=(ThreadBuffer&& buffer) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		[[nodiscard]]
+		U32 GetIndex() const noexcept {
+			return m_index;
+		}
+
+		// A thread buffer is released when its owning thread exits and can
+		// be acquired by another thread (the pending profile events are
+		// still drained).
+		[[nodiscard]]
+		bool Acquire() noexcept {
+			auto in_use = false;
+			return m_in_use.compare_exchange_strong(in_use, true,
+													std::memory_order_acquire);
+		}
+
+		void Release() noexcept {
+			m_in_use.store(false, std::memory_order_release);
+		}
+
+		// Called by the owning thread only.
+		[[nodiscard]]
+		bool Push(const ProfileEvent& event) noexcept {
+			const auto head = m_head.load(std::memory_order_relaxed);
+			const auto tail = m_tail.load(std::memory_order_acquire);
+			if (MAGE_PROFILER_THREAD_BUFFER_SIZE <= head - tail) {
+				return false;
+			}
+
+			m_events[head % MAGE_PROFILER_THREAD_BUFFER_SIZE] = event;
+			m_head.store(head + 1u, std::memory_order_release);
+			return true;
+		}
+
+		// Called by the draining thread only.
+		template< typename ActionT >
+		void Drain(ActionT&& action) {
+			const auto tail = m_tail.load(std::memory_order_relaxed);
+			const auto head = m_head.load(std::memory_order_acquire);
+			for (auto i = tail; i != head; ++i) {
+				action(m_events[i % MAGE_PROFILER_THREAD_BUFFER_SIZE]);
+			}
+			m_tail.store(head, std::memory_order_release);
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		const U32 m_index;
+
+		AtomicBool m_in_use;
+
+		alignas(64) AtomicU64 m_head;
+
+		alignas(64) AtomicU64 m_tail;
+
+		std::vector< ProfileEvent > m_events;
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// Profiler
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	Profiler Profiler::s_profiler;
+
+	[[nodiscard]]
+	U64 Profiler::GetTimeStamp() noexcept {
+		using std::chrono::duration_cast;
+		using std::chrono::nanoseconds;
+		using std::chrono::steady_clock;
+
+		const auto time = steady_clock::now().time_since_epoch();
+		return static_cast< U64 >(duration_cast< nanoseconds >(time).count());
+	}
+
+	Profiler::Profiler()
+		: m_enabled(true),
+		m_nb_dropped_events(0u),
+		m_mutex(),
+		m_thread_buffers(),
+		m_zones(),
+		m_nb_frames(0u),
+		m_capturing(false),
+		m_capture() {}
+
+	Profiler::~Profiler() = default;
+
+	[[nodiscard]]
+	size_t Profiler::ZoneKeyHash::operator()(const ZoneKey& key) const noexcept {
+		const std::hash< std::string_view > hasher;
+		return hasher(key.m_name) ^ (hasher(key.m_parent) * 31u);
+	}
+
+	[[nodiscard]]
+	Profiler::ThreadBuffer& Profiler::GetThreadBuffer() {
+		struct ThreadBufferHandle final {
+
+		public:
+
+			~ThreadBufferHandle() {
+				if (nullptr != m_buffer) {
+					m_buffer->Release();
+				}
+			}
+
+			ThreadBuffer* m_buffer = nullptr;
+		};
+
+		thread_local ThreadBufferHandle t_handle;
+		if (nullptr != t_handle.m_buffer) {
+			return *t_handle.m_buffer;
+		}
+
+		const std::lock_guard< std::mutex > lock(m_mutex);
+
+		// Reuse the thread buffer of an exited thread (e.g., short-lived
+		// threads) or register a new thread buffer.
+		for (const auto& buffer : m_thread_buffers) {
+			if (buffer->Acquire()) {
+				t_handle.m_buffer = buffer.get();
+				return *t_handle.m_buffer;
+			}
+		}
+
+		const auto index = static_cast< U32 >(m_thread_buffers.size());
+		m_thread_buffers.push_back(MakeUnique< ThreadBuffer >(index));
+		t_handle.m_buffer = m_thread_buffers.back().get();
+		return *t_handle.m_buffer;
+	}
+
+	void Profiler::Record(const_zstring name, const_zstring parent,
+						  U64 begin, U64 end, U32 depth) noexcept {
+		try {
+			auto& buffer = GetThreadBuffer();
+
+			ProfileEvent event;
+			event.m_name   = name;
+			event.m_parent = parent;
+			event.m_begin  = begin;
+			event.m_end    = end;
+			event.m_thread = buffer.GetIndex();
+			event.m_depth  = depth;
+
+			if (buffer.Push(event)) {
+				return;
+			}
+		}
+		catch (...) {
+			// The thread buffer could not be registered.
+		}
+
+		m_nb_dropped_events.fetch_add(1u, std::memory_order_relaxed);
+	}
+
+	void Profiler::EndFrame() {
+		++m_nb_frames;
+
+		std::vector< ThreadBuffer* > buffers;
+		{
+			const std::lock_guard< std::mutex > lock(m_mutex);
+			buffers.reserve(m_thread_buffers.size());
+			for (const auto& buffer : m_thread_buffers) {
+				buffers.push_back(buffer.get());
+			}
+		}
+
+		// Drain the profile events of all threads.
+		for (auto buffer : buffers) {
+			buffer->Drain([this](const ProfileEvent& event) {
+				const ZoneKey key = {
+					event.m_name,
+					event.m_parent ? event.m_parent : ""
+				};
+
+				auto& zone = m_zones[key];
+				zone.m_depth = event.m_depth;
+				zone.m_frame_time += event.m_end - event.m_begin;
+				++zone.m_frame_nb_calls;
+
+				if (m_capturing) {
+					if (MAGE_PROFILER_MAX_CAPTURE_SIZE <= m_capture.size()) {
+						m_capturing = false;
+					}
+					else {
+						m_capture.push_back(event);
+					}
+				}
+			});
+		}
+
+		// Update the rolling statistics of all profile zones which were
+		// active during this frame.
+		for (auto& [key, zone] : m_zones) {
+			if (0u == zone.m_frame_nb_calls) {
+				continue;
+			}
+
+			zone.m_times[zone.m_next] = zone.m_frame_time;
+			zone.m_calls[zone.m_next] = zone.m_frame_nb_calls;
+			zone.m_next = (zone.m_next + 1u) % MAGE_PROFILER_STATISTICS_WINDOW;
+			zone.m_nb_frames = std::min(zone.m_nb_frames + 1u,
+										MAGE_PROFILER_STATISTICS_WINDOW);
+
+			zone.m_frame_time     = 0u;
+			zone.m_frame_nb_calls = 0u;
+		}
+	}
+
+	[[nodiscard]]
+	const std::vector< ProfileZoneStatistics > Profiler::GetStatistics() const {
+		std::vector< ProfileZoneStatistics > statistics;
+		statistics.reserve(m_zones.size());
+
+		const auto compute = [](const ZoneKey& key, const Zone& zone, U32 depth) {
+			ProfileZoneStatistics stats;
+			stats.m_name      = key.m_name;
+			stats.m_depth     = depth;
+			stats.m_nb_frames = zone.m_nb_frames;
+			if (0u == zone.m_nb_frames) {
+				return stats;
+			}
+
+			std::vector< U64 > times(zone.m_times,
+									 zone.m_times + zone.m_nb_frames);
+			U64 nb_calls = 0u;
+			for (U32 i = 0u; i < zone.m_nb_frames; ++i) {
+				nb_calls += zone.m_calls[i];
+			}
+
+			U64 sum = 0u;
+			for (const auto time : times) {
+				sum += time;
+			}
+
+			const auto p99 = (99u * times.size() + 99u) / 100u - 1u;
+			std::nth_element(times.begin(), times.begin() + p99, times.end());
+
+			stats.m_nb_calls = static_cast< F32 >(nb_calls) / zone.m_nb_frames;
+			stats.m_min = *std::min_element(times.cbegin(), times.cend()) * 1e-6;
+			stats.m_avg = static_cast< F64 >(sum) / zone.m_nb_frames * 1e-6;
+			stats.m_p99 = times[p99] * 1e-6;
+			return stats;
+		};
+
+		// Group the profile zones by their enclosing profile zone.
+		std::unordered_map< std::string_view,
+			                std::vector< const std::pair< const ZoneKey, Zone >* > > children;
+		for (const auto& zone : m_zones) {
+			children[zone.first.m_parent].push_back(&zone);
+		}
+
+		std::unordered_set< const std::pair< const ZoneKey, Zone >* > visited;
+
+		// Visit the profile zones in depth-first order.
+		const auto visit = [&](const auto& self, std::string_view parent,
+							   U32 depth) -> void {
+			const auto it = children.find(parent);
+			if (children.cend() == it) {
+				return;
+			}
+
+			auto zones = it->second;
+			std::sort(zones.begin(), zones.end(),
+				[](const auto* lhs, const auto* rhs) noexcept {
+					return lhs->first.m_name < rhs->first.m_name;
+				});
+
+			for (const auto* zone : zones) {
+				if (!visited.insert(zone).second) {
+					continue;
+				}
+
+				statistics.push_back(compute(zone->first, zone->second, depth));
+				self(self, zone->first.m_name, depth + 1u);
+			}
+		};
+		visit(visit, "", 0u);
+
+		// Append the profile zones whose enclosing profile zone was never
+		// recorded.
+		for (const auto& zone : m_zones) {
+			if (visited.insert(&zone).second) {
+				statistics.push_back(compute(zone.first, zone.second,
+											 zone.second.m_depth));
+			}
+		}
+
+		return statistics;
+	}
+
+	void Profiler::BeginCapture() {
+		m_capture.clear();
+		m_capture.reserve(MAGE_PROFILER_THREAD_BUFFER_SIZE);
+		m_capturing = true;
+	}
+
+	void Profiler::EndCapture() noexcept {
+		m_capturing = false;
+	}
+
+	void Profiler::ExportChromeTrace(const std::filesystem::path& path) const {
+		ChromeTraceWriter writer(m_capture);
+		writer.WriteToFile(path);
+	}
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// ProfileZone
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	ProfileZone::ProfileZone(NotNull< const_zstring > name) noexcept
+		: m_name(nullptr),
+		m_parent(g_current_zone),
+		m_begin(0u) {
+
+		if (!Profiler::Get().IsEnabled()) {
+			return;
+		}
+
+		m_name = name;
+		g_current_zone = name;
+		++g_current_depth;
+		m_begin = Profiler::GetTimeStamp();
+	}
+
+	ProfileZone::~ProfileZone() {
+		if (nullptr == m_name) {
+			return;
+		}
+
+		const auto end = Profiler::GetTimeStamp();
+		--g_current_depth;
+		g_current_zone = m_parent;
+		Profiler::Get().Record(m_name, m_parent, m_begin, end, g_current_depth);
+	}
+
+	#pragma endregion
+}
\ No newline at end of file
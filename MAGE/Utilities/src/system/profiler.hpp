@@ -0,0 +1,610 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "parallel\atomic.hpp"
+#include "memory\memory.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <filesystem>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Defines
+//-----------------------------------------------------------------------------
+#pragma region
+
+/**
+ The maximum number of pending profile events of each thread.
+ */
+#define MAGE_PROFILER_THREAD_BUFFER_SIZE 16384u
+
+/**
+ The number of frames of the rolling statistics of each profile zone.
+ */
+#define MAGE_PROFILER_STATISTICS_WINDOW 256u
+
+/**
+ The maximum number of profile events of a capture.
+ */
+#define MAGE_PROFILER_MAX_CAPTURE_SIZE 1048576u
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	//-------------------------------------------------------------------------
+	// ProfileEvent
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A struct of profile events.
+	 */
+	struct ProfileEvent final {
+
+	public:
+
+		/**
+		 A pointer to the (static) name of the profile zone of this profile
+		 event.
+		 */
+		const_zstring m_name = nullptr;
+
+		/**
+		 A pointer to the (static) name of the enclosing profile zone of this
+		 profile event (or @c nullptr if this profile event has no enclosing
+		 profile zone).
+		 */
+		const_zstring m_parent = nullptr;
+
+		/**
+		 The begin time stamp (in nanoseconds) of this profile event.
+		 */
+		U64 m_begin = 0u;
+
+		/**
+		 The end time stamp (in nanoseconds) of this profile event.
+		 */
+		U64 m_end = 0u;
+
+		/**
+		 The index of the thread of this profile event.
+		 */
+		U32 m_thread = 0u;
+
+		/**
+		 The nesting depth of this profile event.
+		 */
+		U32 m_depth = 0u;
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// ProfileZoneStatistics
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A struct of profile zone statistics.
+
+	 The statistics are computed over the per-frame time of a profile zone
+	 (i.e. the accumulated time of all profile events of that profile zone
+	 drained during the same frame) for the most recent frames.
+	 */
+	struct ProfileZoneStatistics final {
+
+	public:
+
+		/**
+		 The name of the profile zone.
+		 */
+		std::string_view m_name;
+
+		/**
+		 The nesting depth of the profile zone.
+		 */
+		U32 m_depth = 0u;
+
+		/**
+		 The average number of calls per frame of the profile zone.
+		 */
+		F32 m_nb_calls = 0.0f;
+
+		/**
+		 The number of frames of the statistics of the profile zone.
+		 */
+		U32 m_nb_frames = 0u;
+
+		/**
+		 The minimum per-frame time (in milliseconds) of the profile zone.
+		 */
+		F64 m_min = 0.0;
+
+		/**
+		 The average per-frame time (in milliseconds) of the profile zone.
+		 */
+		F64 m_avg = 0.0;
+
+		/**
+		 The 99th percentile of the per-frame time (in milliseconds) of the
+		 profile zone.
+		 */
+		F64 m_p99 = 0.0;
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// Profiler
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A class of hierarchical CPU profilers.
+
+	 Each thread records the profile events of its profile zones in its own
+	 (single-producer, single-consumer) ring buffer without any locking. The
+	 ring buffers are drained once per frame by the thread calling
+	 @c EndFrame, which updates the rolling statistics of each profile zone
+	 and, while capturing, appends the profile events to the capture which
+	 can be exported as a Chrome trace (chrome://tracing).
+	 */
+	class Profiler final {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the global profiler.
+
+		 @return		A reference to the global profiler.
+		 */
+		[[nodiscard]]
+		static Profiler& Get() noexcept {
+			return s_profiler;
+		}
+
+		/**
+		 Returns the current time stamp (in nanoseconds) of the profiler
+		 clock.
+
+		 @return		The current time stamp (in nanoseconds) of the
+						profiler clock.
+		 */
+		[[nodiscard]]
+		static U64 GetTimeStamp() noexcept;
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a profiler.
+		 */
+		Profiler();
+
+		/**
+		 Constructs a profiler from the given profiler.
+
+		 @param[in]		profiler
+						A reference to the profiler to copy.
+		 */
+		Profiler(const Profiler& profiler) = delete;
+
+		/**
+		 Constructs a profiler by moving the given profiler.
+
+		 @param[in]		profiler
+						A reference to the profiler to move.
+		 */
+		Profiler(Profiler&& profiler) = delete;
+
+		/**
+		 Destructs this profiler.
+		 */
+		~Profiler();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given profiler to this profiler.
+
+		 @param[in]		profiler
+						A reference to the profiler to copy.
+		 @return		A reference to the copy of the given profiler (i.e.
+						this profiler).
+		 */
+		Profiler& operator=(const Profiler& profiler) = delete;
+
+		/**
+		 Moves the given profiler to this profiler.
+
+		 @param[in]		profiler
+						A reference to the profiler to move.
+		 @return		A reference to the moved profiler (i.e. this
+						profiler).
+		 */
+		Profiler& operator=(Profiler&& profiler) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Checks whether this profiler is enabled.
+
+		 @return		@c true if this profiler is enabled. @c false
+						otherwise.
+		 */
+		[[nodiscard]]
+		bool IsEnabled() const noexcept {
+			return m_enabled.load(std::memory_order_relaxed);
+		}
+
+		/**
+		 Enables or disables this profiler.
+
+		 @param[in]		enabled
+						@c true if this profiler needs to be enabled.
+						@c false otherwise.
+		 */
+		void SetEnabled(bool enabled) noexcept {
+			m_enabled.store(enabled, std::memory_order_relaxed);
+		}
+
+		/**
+		 Records the given profile event for the calling thread.
+
+		 The profile event is dropped if the ring buffer of the calling thread
+		 is full.
+
+		 @param[in]		name
+						A pointer to the (static) name of the profile zone.
+		 @param[in]		parent
+						A pointer to the (static) name of the enclosing
+						profile zone (or @c nullptr).
+		 @param[in]		begin
+						The begin time stamp (in nanoseconds).
+		 @param[in]		end
+						The end time stamp (in nanoseconds).
+		 @param[in]		depth
+						The nesting depth.
+		 */
+		void Record(const_zstring name, const_zstring parent,
+					U64 begin, U64 end, U32 depth) noexcept;
+
+		/**
+		 Ends the current frame of this profiler: drains the profile events
+		 of all threads and updates the statistics of all profile zones.
+		 */
+		void EndFrame();
+
+		/**
+		 Returns the number of frames of this profiler.
+
+		 @return		The number of frames of this profiler.
+		 */
+		[[nodiscard]]
+		U64 GetNumberOfFrames() const noexcept {
+			return m_nb_frames;
+		}
+
+		/**
+		 Returns the number of dropped profile events of this profiler.
+
+		 @return		The number of dropped profile events of this
+						profiler.
+		 */
+		[[nodiscard]]
+		U64 GetNumberOfDroppedEvents() const noexcept {
+			return m_nb_dropped_events.load(std::memory_order_relaxed);
+		}
+
+		/**
+		 Returns the statistics of all profile zones of this profiler in
+		 hierarchical (depth-first) order.
+
+		 @return		A vector containing the statistics of all profile
+						zones of this profiler.
+		 */
+		[[nodiscard]]
+		const std::vector< ProfileZoneStatistics > GetStatistics() const;
+
+		/**
+		 Checks whether this profiler is capturing profile events.
+
+		 @return		@c true if this profiler is capturing profile events.
+						@c false otherwise.
+		 */
+		[[nodiscard]]
+		bool IsCapturing() const noexcept {
+			return m_capturing;
+		}
+
+		/**
+		 Returns the number of captured profile events of this profiler.
+
+		 @return		The number of captured profile events of this
+						profiler.
+		 */
+		[[nodiscard]]
+		size_t GetNumberOfCapturedEvents() const noexcept {
+			return m_capture.size();
+		}
+
+		/**
+		 Starts capturing the profile events of this profiler. The profile
+		 events of a previous capture are discarded.
+		 */
+		void BeginCapture();
+
+		/**
+		 Stops capturing the profile events of this profiler.
+		 */
+		void EndCapture() noexcept;
+
+		/**
+		 Exports the captured profile events of this profiler as a Chrome
+		 trace (JSON) file.
+
+		 @param[in]		path
+						A reference to the path.
+		 @throws		Exception
+						Failed to export the captured profile events to the
+						given file.
+		 */
+		void ExportChromeTrace(const std::filesystem::path& path) const;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		class ThreadBuffer;
+
+		struct ZoneKey final {
+
+		public:
+
+			[[nodiscard]]
+			bool operator==(const ZoneKey& key) const noexcept {
+				return m_name == key.m_name && m_parent == key.m_parent;
+			}
+
+			std::string_view m_name;
+			std::string_view m_parent;
+		};
+
+		struct ZoneKeyHash final {
+
+		public:
+
+			[[nodiscard]]
+			size_t operator()(const ZoneKey& key) const noexcept;
+		};
+
+		struct Zone final {
+
+		public:
+
+			U32 m_depth = 0u;
+			U64 m_frame_time = 0u;
+			U32 m_frame_nb_calls = 0u;
+			U32 m_nb_frames = 0u;
+			U32 m_next = 0u;
+			U64 m_times[MAGE_PROFILER_STATISTICS_WINDOW] = {};
+			U32 m_calls[MAGE_PROFILER_STATISTICS_WINDOW] = {};
+		};
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The global profiler.
+		 */
+		static Profiler s_profiler;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		[[nodiscard]]
+		ThreadBuffer& GetThreadBuffer();
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 Flag indicating whether this profiler is enabled.
+		 */
+		AtomicBool m_enabled;
+
+		/**
+		 The number of dropped profile events of this profiler.
+		 */
+		AtomicU64 m_nb_dropped_events;
+
+		/**
+		 The mutex for registering thread buffers of this profiler.
+		 */
+		std::mutex m_mutex;
+
+		/**
+		 A vector containing the thread buffers of this profiler.
+		 */
+		std::vector< UniquePtr< ThreadBuffer > > m_thread_buffers;
+
+		/**
+		 A map containing the profile zones of this profiler.
+		 */
+		std::unordered_map< ZoneKey, Zone, ZoneKeyHash > m_zones;
+
+		/**
+		 The number of frames of this profiler.
+		 */
+		U64 m_nb_frames;
+
+		/**
+		 Flag indicating whether this profiler is capturing profile events.
+		 */
+		bool m_capturing;
+
+		/**
+		 A vector containing the captured profile events of this profiler.
+		 */
+		std::vector< ProfileEvent > m_capture;
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// ProfileZone
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A class of profile zones.
+
+	 A profile zone records a profile event spanning its lifetime. Profile
+	 zones of the same thread need to be nested (which is guaranteed for
+	 scoped profile zones).
+	 */
+	class ProfileZone final {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a profile zone.
+
+		 @param[in]		name
+						A pointer to the (static) name of the profile zone.
+		 */
+		explicit ProfileZone(NotNull< const_zstring > name) noexcept;
+
+		/**
+		 Constructs a profile zone from the given profile zone.
+
+		 @param[in]		zone
+						A reference to the profile zone to copy.
+		 */
+		ProfileZone(const ProfileZone& zone) = delete;
+
+		/**
+		 Constructs a profile zone by moving the given profile zone.
+
+		 @param[in]		zone
+						A reference to the profile zone to move.
+		 */
+		ProfileZone(ProfileZone&& zone) = delete;
+
+		/**
+		 Destructs this profile zone.
+		 */
+		~ProfileZone();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given profile zone to this profile zone.
+
+		 @param[in]		zone
+						A reference to the profile zone to copy.
+		 @return		A reference to the copy of the given profile zone
+						(i.e. this profile zone).
+		 */
+		ProfileZone& operator=(const ProfileZone& zone) = delete;
+
+		/**
+		 Moves the given profile zone to this profile zone.
+
+		 @param[in]		zone
+						A reference to the profile zone to move.
+		 @return		A reference to the moved profile zone (i.e. this
+						profile zone).
+		 */
+		ProfileZone& operator=(ProfileZone&& zone) = delete;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A pointer to the (static) name of this profile zone (or @c nullptr
+		 if the profiler was disabled when this profile zone was
+		 constructed).
+		 */
+		const_zstring m_name;
+
+		/**
+		 A pointer to the (static) name of the enclosing profile zone of this
+		 profile zone.
+		 */
+		const_zstring m_parent;
+
+		/**
+		 The begin time stamp (in nanoseconds) of this profile zone.
+		 */
+		U64 m_begin;
+	};
+
+	#pragma endregion
+}
+
+//-----------------------------------------------------------------------------
+// Engine Defines
+//-----------------------------------------------------------------------------
+#pragma region
+
+#define MAGE_PROFILE_CONCAT_IMPL(a, b) a##b
+#define MAGE_PROFILE_CONCAT(a, b) MAGE_PROFILE_CONCAT_IMPL(a, b)
+
+// Profiling definitions
+// The macro DISABLE_PROFILING controls whether profile zones are compiled.
+#ifdef DISABLE_PROFILING
+	#define MAGE_PROFILE_ZONE(name) (__noop)
+	#define MAGE_PROFILE_FUNCTION() (__noop)
+	#define MAGE_PROFILE_END_FRAME() (__noop)
+#else
+	#define MAGE_PROFILE_ZONE(name) \
+		const mage::ProfileZone MAGE_PROFILE_CONCAT(profile_zone_, __LINE__)( \
+			mage::NotNull< mage::const_zstring >(name))
+	#define MAGE_PROFILE_FUNCTION() MAGE_PROFILE_ZONE(__FUNCTION__)
+	#define MAGE_PROFILE_END_FRAME() mage::Profiler::Get().EndFrame()
+#endif
+
+#pragma endregion
\ No newline at end of file